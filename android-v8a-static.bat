@@ -31,7 +31,7 @@ if /I "%ARCH%"=="arm64" goto :arm64
 if /I "%ARCH%"=="v8a" goto :arm64
 if /I "%ARCH%"=="aarch64" goto :arm64
 
-echo Usage: build_android.bat [armeabi-v7a^|arm64-v8a]
+echo Usage: build_android.bat [armeabi-v7a^|arm64-v8a] [profile]
 exit /b 1
 
 :armv7
@@ -70,8 +70,16 @@ if not exist "%CC%" (
 
 echo CC: %CC%
 
+:: 第二个参数为 profile 时生成供 simpleperf 剖析的库：保留帧指针，关键编码阶段不内联
+set "PROFILE_FLAGS="
+set "SUFFIX="
+if /I "%~2"=="profile" (
+    set "PROFILE_FLAGS=-fno-omit-frame-pointer -mno-omit-leaf-frame-pointer -DBBPE_ENABLE_PROFILE"
+    set "SUFFIX=_profile"
+)
+
 :: 编译标志
-set "CFLAGS=-g -O3 -fPIC -DHAVE_CONFIG_H -DPCRE2_CODE_UNIT_WIDTH=8 -DPCRE2_STATIC -Ithirdparty/cJSON -Ithirdparty/uthash -Ithirdparty/pcre2 -I. %ARCH_FLAGS%"
+set "CFLAGS=-g -O3 -fPIC %PROFILE_FLAGS% -DHAVE_CONFIG_H -DPCRE2_CODE_UNIT_WIDTH=8 -DPCRE2_STATIC -DSUPPORT_JIT -Ithirdparty/cJSON -Ithirdparty/uthash -Ithirdparty/pcre2 -I. %ARCH_FLAGS%"
 
 :: 创建临时目录
 set "TMPDIR=build_tmp_%TARGET_ARCH%_%RANDOM%"
@@ -101,8 +109,8 @@ for %%f in ("%TMPDIR%\cJSON\*.o") do set "OBJ_FILES=!OBJ_FILES! %%f"
 for %%f in ("%TMPDIR%\pcre2\*.o") do set "OBJ_FILES=!OBJ_FILES! %%f"
 
 :: 创建静态库
-call %AR% rcs "libbbpe_%TARGET_ARCH%.a" %OBJ_FILES%
-call %RANLIB% "libbbpe_%TARGET_ARCH%.a"
+call %AR% rcs "libbbpe_%TARGET_ARCH%%SUFFIX%.a" %OBJ_FILES%
+call %RANLIB% "libbbpe_%TARGET_ARCH%%SUFFIX%.a"
 
 echo === Cleaning up ===
 
@@ -110,4 +118,4 @@ echo === Cleaning up ===
 rmdir /S /Q "%TMPDIR%"
 
 echo === Done ===
-echo Output: libbbpe_%TARGET_ARCH%.a
\ No newline at end of file
+echo Output: libbbpe_%TARGET_ARCH%%SUFFIX%.a
\ No newline at end of file
@@ -0,0 +1,2620 @@
+/* 本文件由 tools/gen_normalize_tables.py 生成 (Unicode 14.0.0)，请勿手工修改 */
+#ifndef BBPE_NORMALIZE_TABLES_H
+#define BBPE_NORMALIZE_TABLES_H
+
+#include <stdint.h>
+
+#define BBPE_NORM_NFC_NO 1      /* 单独规范化为 NFC 时改变 */
+#define BBPE_NORM_NFKC_NO 2     /* 单独规范化为 NFKC 时改变 */
+#define BBPE_NORM_COMPOSE_TAIL 4 /* 可与前一字符组合 */
+
+#define BBPE_NORM_BLOCK_SHIFT 7
+#define BBPE_NORM_LIMIT 0x2FA80 /* 不小于该值的码点没有任何属性 */
+
+/* 码点属性：decomp/compat/lower 为 bbpe_norm_pool 下标 (完整展开的 NFD、NFKD 与小写映射)，0 表示不变 */
+typedef struct
+{
+    uint8_t ccc;
+    uint8_t flags;
+    uint16_t decomp;
+    uint16_t compat;
+    uint16_t lower;
+} BBPENormProps;
+
+static const BBPENormProps bbpe_norm_props[4861] = {
+    {0,0,0,0,0},{0,0,0,0,1},{0,0,0,0,3},{0,0,0,0,5},{0,0,0,0,7},{0,0,0,0,9},{0,0,0,0,11},{0,0,0,0,13},
+    {0,0,0,0,15},{0,0,0,0,17},{0,0,0,0,19},{0,0,0,0,21},{0,0,0,0,23},{0,0,0,0,25},{0,0,0,0,27},{0,0,0,0,29},
+    {0,0,0,0,31},{0,0,0,0,33},{0,0,0,0,35},{0,0,0,0,37},{0,0,0,0,39},{0,0,0,0,41},{0,0,0,0,43},{0,0,0,0,45},
+    {0,0,0,0,47},{0,0,0,0,49},{0,0,0,0,51},{0,2,0,53,0},{0,2,0,55,0},{0,2,0,1,0},{0,2,0,58,0},{0,2,0,61,0},
+    {0,2,0,63,0},{0,2,0,65,0},{0,2,0,68,0},{0,2,0,70,0},{0,2,0,73,0},{0,2,0,29,0},{0,2,0,75,0},{0,2,0,79,0},
+    {0,2,0,83,0},{0,0,87,87,90},{0,0,92,92,95},{0,0,97,97,100},{0,0,102,102,105},{0,0,107,107,110},{0,0,112,112,115},{0,0,0,0,117},
+    {0,0,119,119,122},{0,0,124,124,127},{0,0,129,129,132},{0,0,134,134,137},{0,0,139,139,142},{0,0,144,144,147},{0,0,149,149,152},{0,0,154,154,157},
+    {0,0,159,159,162},{0,0,0,0,164},{0,0,166,166,169},{0,0,171,171,174},{0,0,176,176,179},{0,0,181,181,184},{0,0,186,186,189},{0,0,191,191,194},
+    {0,0,0,0,196},{0,0,198,198,201},{0,0,203,203,206},{0,0,208,208,211},{0,0,213,213,216},{0,0,218,218,221},{0,0,0,0,223},{0,0,225,225,0},
+    {0,0,228,228,0},{0,0,231,231,0},{0,0,234,234,0},{0,0,237,237,0},{0,0,240,240,0},{0,0,243,243,0},{0,0,246,246,0},{0,0,249,249,0},
+    {0,0,252,252,0},{0,0,255,255,0},{0,0,258,258,0},{0,0,261,261,0},{0,0,264,264,0},{0,0,267,267,0},{0,0,270,270,0},{0,0,273,273,0},
+    {0,0,276,276,0},{0,0,279,279,0},{0,0,282,282,0},{0,0,285,285,0},{0,0,288,288,0},{0,0,291,291,0},{0,0,294,294,0},{0,0,297,297,0},
+    {0,0,300,300,0},{0,0,303,303,0},{0,0,306,306,309},{0,0,311,311,0},{0,0,314,314,317},{0,0,319,319,0},{0,0,322,322,325},{0,0,327,327,0},
+    {0,0,330,330,333},{0,0,335,335,0},{0,0,338,338,341},{0,0,343,343,0},{0,0,346,346,349},{0,0,351,351,0},{0,0,354,354,357},{0,0,359,359,0},
+    {0,0,362,362,365},{0,0,367,367,0},{0,0,0,0,370},{0,0,372,372,375},{0,0,377,377,0},{0,0,380,380,383},{0,0,385,385,0},{0,0,388,388,391},
+    {0,0,393,393,0},{0,0,396,396,399},{0,0,401,401,0},{0,0,404,404,407},{0,0,409,409,0},{0,0,412,412,415},{0,0,417,417,0},{0,0,420,420,423},
+    {0,0,425,425,0},{0,0,428,428,431},{0,0,433,433,0},{0,0,436,436,439},{0,0,441,441,0},{0,0,444,444,447},{0,0,449,449,0},{0,0,0,0,452},
+    {0,0,454,454,457},{0,0,459,459,0},{0,0,462,462,465},{0,0,467,467,0},{0,0,470,470,473},{0,0,475,475,0},{0,0,478,478,481},{0,0,483,483,0},
+    {0,0,486,486,489},{0,2,0,492,495},{0,2,0,497,0},{0,0,500,500,503},{0,0,505,505,0},{0,0,508,508,511},{0,0,513,513,0},{0,0,516,516,519},
+    {0,0,521,521,0},{0,0,524,524,527},{0,0,529,529,0},{0,0,532,532,535},{0,0,537,537,0},{0,2,0,540,543},{0,2,0,545,0},{0,0,0,0,548},
+    {0,0,550,550,553},{0,0,555,555,0},{0,0,558,558,561},{0,0,563,563,0},{0,0,566,566,569},{0,0,571,571,0},{0,2,0,574,0},{0,0,0,0,577},
+    {0,0,579,579,582},{0,0,584,584,0},{0,0,587,587,590},{0,0,592,592,0},{0,0,595,595,598},{0,0,600,600,0},{0,0,0,0,603},{0,0,605,605,608},
+    {0,0,610,610,0},{0,0,613,613,616},{0,0,618,618,0},{0,0,621,621,624},{0,0,626,626,0},{0,0,629,629,632},{0,0,634,634,0},{0,0,637,637,640},
+    {0,0,642,642,0},{0,0,645,645,648},{0,0,650,650,0},{0,0,653,653,656},{0,0,658,658,0},{0,0,661,661,664},{0,0,666,666,0},{0,0,669,669,672},
+    {0,0,674,674,0},{0,0,0,0,677},{0,0,679,679,682},{0,0,684,684,0},{0,0,687,687,690},{0,0,692,692,0},{0,0,695,695,698},{0,0,700,700,0},
+    {0,0,703,703,706},{0,0,708,708,0},{0,0,711,711,714},{0,0,716,716,0},{0,0,719,719,722},{0,0,724,724,0},{0,0,727,727,730},{0,0,732,732,0},
+    {0,0,735,735,738},{0,0,740,740,0},{0,0,743,743,746},{0,0,748,748,751},{0,0,753,753,0},{0,0,756,756,759},{0,0,761,761,0},{0,0,764,764,767},
+    {0,0,769,769,0},{0,2,0,37,0},{0,0,0,0,772},{0,0,0,0,774},{0,0,0,0,776},{0,0,0,0,778},{0,0,0,0,780},{0,0,0,0,782},
+    {0,0,0,0,784},{0,0,0,0,786},{0,0,0,0,788},{0,0,0,0,790},{0,0,0,0,792},{0,0,0,0,794},{0,0,0,0,796},{0,0,0,0,798},
+    {0,0,0,0,800},{0,0,0,0,802},{0,0,0,0,804},{0,0,0,0,806},{0,0,0,0,808},{0,0,0,0,810},{0,0,812,812,815},{0,0,817,817,0},
+    {0,0,0,0,820},{0,0,0,0,822},{0,0,0,0,824},{0,0,0,0,826},{0,0,0,0,828},{0,0,0,0,830},{0,0,0,0,832},{0,0,834,834,837},
+    {0,0,839,839,0},{0,0,0,0,842},{0,0,0,0,844},{0,0,0,0,846},{0,0,0,0,848},{0,0,0,0,850},{0,0,0,0,852},{0,0,0,0,854},
+    {0,2,0,856,860},{0,2,0,862,860},{0,2,0,866,0},{0,2,0,870,873},{0,2,0,875,873},{0,2,0,878,0},{0,2,0,881,884},{0,2,0,886,884},
+    {0,2,0,889,0},{0,0,892,892,895},{0,0,897,897,0},{0,0,900,900,903},{0,0,905,905,0},{0,0,908,908,911},{0,0,913,913,0},{0,0,916,916,919},
+    {0,0,921,921,0},{0,0,924,924,928},{0,0,930,930,0},{0,0,934,934,938},{0,0,940,940,0},{0,0,944,944,948},{0,0,950,950,0},{0,0,954,954,958},
+    {0,0,960,960,0},{0,0,964,964,968},{0,0,970,970,0},{0,0,974,974,978},{0,0,980,980,0},{0,0,984,984,987},{0,0,989,989,0},{0,0,0,0,992},
+    {0,0,994,994,997},{0,0,999,999,0},{0,0,1002,1002,1005},{0,0,1007,1007,0},{0,0,1010,1010,1013},{0,0,1015,1015,0},{0,0,1018,1018,1022},{0,0,1024,1024,0},
+    {0,0,1028,1028,1031},{0,0,1033,1033,0},{0,0,1036,1036,0},{0,2,0,1039,1042},{0,2,0,1044,1042},{0,2,0,1047,0},{0,0,1050,1050,1053},{0,0,1055,1055,0},
+    {0,0,0,0,1058},{0,0,0,0,1060},{0,0,1062,1062,1065},{0,0,1067,1067,0},{0,0,1070,1070,1074},{0,0,1076,1076,0},{0,0,1080,1080,1083},{0,0,1085,1085,0},
+    {0,0,1088,1088,1091},{0,0,1093,1093,0},{0,0,1096,1096,1099},{0,0,1101,1101,0},{0,0,1104,1104,1107},{0,0,1109,1109,0},{0,0,1112,1112,1115},{0,0,1117,1117,0},
+    {0,0,1120,1120,1123},{0,0,1125,1125,0},{0,0,1128,1128,1131},{0,0,1133,1133,0},{0,0,1136,1136,1139},{0,0,1141,1141,0},{0,0,1144,1144,1147},{0,0,1149,1149,0},
+    {0,0,1152,1152,1155},{0,0,1157,1157,0},{0,0,1160,1160,1163},{0,0,1165,1165,0},{0,0,1168,1168,1171},{0,0,1173,1173,0},{0,0,1176,1176,1179},{0,0,1181,1181,0},
+    {0,0,1184,1184,1187},{0,0,1189,1189,0},{0,0,1192,1192,1195},{0,0,1197,1197,0},{0,0,1200,1200,1203},{0,0,1205,1205,0},{0,0,0,0,1208},{0,0,1210,1210,1213},
+    {0,0,1215,1215,0},{0,0,0,0,1218},{0,0,0,0,1220},{0,0,0,0,1222},{0,0,1224,1224,1227},{0,0,1229,1229,0},{0,0,1232,1232,1235},{0,0,1237,1237,0},
+    {0,0,1240,1240,1244},{0,0,1246,1246,0},{0,0,1250,1250,1254},{0,0,1256,1256,0},{0,0,1260,1260,1263},{0,0,1265,1265,0},{0,0,1268,1268,1272},{0,0,1274,1274,0},
+    {0,0,1278,1278,1281},{0,0,1283,1283,0},{0,0,0,0,1286},{0,0,0,0,1288},{0,0,0,0,1290},{0,0,0,0,1292},{0,0,0,0,1294},{0,0,0,0,1296},
+    {0,0,0,0,1298},{0,0,0,0,1300},{0,0,0,0,1302},{0,0,0,0,1304},{0,0,0,0,1306},{0,0,0,0,1308},{0,0,0,0,1310},{0,2,0,15,0},
+    {0,2,0,1312,0},{0,2,0,19,0},{0,2,0,35,0},{0,2,0,1314,0},{0,2,0,1316,0},{0,2,0,1318,0},{0,2,0,45,0},{0,2,0,49,0},
+    {0,2,0,1320,0},{0,2,0,1323,0},{0,2,0,1326,0},{0,2,0,1329,0},{0,2,0,1332,0},{0,2,0,1335,0},{0,2,0,798,0},{0,2,0,23,0},
+    {0,2,0,47,0},{0,2,0,1338,0},{230,4,0,0,0},{230,0,0,0,0},{232,0,0,0,0},{220,0,0,0,0},{216,4,0,0,0},{202,0,0,0,0},
+    {220,4,0,0,0},{202,4,0,0,0},{1,0,0,0,0},{1,4,0,0,0},{230,3,1340,1340,0},{230,3,1342,1342,0},{230,3,1344,1344,0},{230,3,1346,1346,0},
+    {240,4,0,0,0},{233,0,0,0,0},{234,0,0,0,0},{0,0,0,0,1349},{0,0,0,0,1351},{0,3,1353,1353,0},{0,0,0,0,1355},{0,2,0,1357,0},
+    {0,3,1360,1360,0},{0,0,0,0,1362},{0,2,1364,1367,0},{0,0,1371,1371,1374},{0,3,1376,1376,0},{0,0,1378,1378,1381},{0,0,1383,1383,1386},{0,0,1388,1388,1391},
+    {0,0,1393,1393,1396},{0,0,1398,1398,1401},{0,0,1403,1403,1406},{0,0,1408,1408,0},{0,0,0,0,1412},{0,0,0,0,1414},{0,0,0,0,1416},{0,0,0,0,1418},
+    {0,0,0,0,1420},{0,0,0,0,1422},{0,0,0,0,1424},{0,0,0,0,1426},{0,0,0,0,1428},{0,0,0,0,1430},{0,0,0,0,1432},{0,0,0,0,68},
+    {0,0,0,0,1434},{0,0,0,0,1436},{0,0,0,0,1438},{0,0,0,0,1440},{0,0,0,0,1442},{0,0,0,0,1444},{0,0,0,0,1446},{0,0,0,0,1448},
+    {0,0,0,0,1450},{0,0,0,0,1452},{0,0,0,0,1454},{0,0,0,0,1456},{0,0,1458,1458,1461},{0,0,1463,1463,1466},{0,0,1468,1468,0},{0,0,1471,1471,0},
+    {0,0,1474,1474,0},{0,0,1477,1477,0},{0,0,1480,1480,0},{0,0,1484,1484,0},{0,0,1487,1487,0},{0,0,1490,1490,0},{0,0,1493,1493,0},{0,0,1496,1496,0},
+    {0,0,0,0,1499},{0,2,0,1414,0},{0,2,0,1426,0},{0,2,0,1501,0},{0,2,1503,1398,0},{0,2,1506,1463,0},{0,2,0,1450,0},{0,2,0,1440,0},
+    {0,0,0,0,1509},{0,0,0,0,1511},{0,0,0,0,1513},{0,0,0,0,1515},{0,0,0,0,1517},{0,0,0,0,1519},{0,0,0,0,1521},{0,0,0,0,1523},
+    {0,0,0,0,1525},{0,0,0,0,1527},{0,0,0,0,1529},{0,0,0,0,1531},{0,2,0,1430,0},{0,2,0,1442,0},{0,2,0,1533,0},{0,2,0,1535,1426},
+    {0,2,0,1420,0},{0,0,0,0,1537},{0,2,0,1539,1541},{0,0,0,0,1543},{0,0,0,0,1545},{0,0,0,0,1547},{0,0,0,0,1549},{0,0,1551,1551,1554},
+    {0,0,1556,1556,1559},{0,0,0,0,1561},{0,0,1563,1563,1566},{0,0,0,0,1568},{0,0,0,0,1570},{0,0,0,0,1572},{0,0,1574,1574,1577},{0,0,0,0,1579},
+    {0,0,0,0,1581},{0,0,0,0,1583},{0,0,0,0,1585},{0,0,1587,1587,1590},{0,0,1592,1592,1595},{0,0,1597,1597,1600},{0,0,0,0,1602},{0,0,0,0,1604},
+    {0,0,0,0,1606},{0,0,0,0,1608},{0,0,0,0,1610},{0,0,0,0,1612},{0,0,0,0,1614},{0,0,0,0,1616},{0,0,0,0,1618},{0,0,0,0,1620},
+    {0,0,1622,1622,1625},{0,0,0,0,1627},{0,0,0,0,1629},{0,0,0,0,1631},{0,0,0,0,1633},{0,0,0,0,1635},{0,0,0,0,1637},{0,0,0,0,1639},
+    {0,0,0,0,1641},{0,0,0,0,1643},{0,0,0,0,1645},{0,0,0,0,1647},{0,0,0,0,1649},{0,0,0,0,1651},{0,0,0,0,1653},{0,0,0,0,1655},
+    {0,0,0,0,1657},{0,0,0,0,1659},{0,0,0,0,1661},{0,0,0,0,1663},{0,0,0,0,1665},{0,0,0,0,1667},{0,0,0,0,1669},{0,0,1671,1671,0},
+    {0,0,1674,1674,0},{0,0,1677,1677,0},{0,0,1680,1680,0},{0,0,1683,1683,0},{0,0,1686,1686,0},{0,0,1689,1689,0},{0,0,1692,1692,0},{0,0,0,0,1695},
+    {0,0,0,0,1697},{0,0,0,0,1699},{0,0,0,0,1701},{0,0,0,0,1703},{0,0,0,0,1705},{0,0,0,0,1707},{0,0,0,0,1709},{0,0,0,0,1711},
+    {0,0,0,0,1713},{0,0,0,0,1715},{0,0,1717,1717,1720},{0,0,1722,1722,0},{0,0,0,0,1725},{0,0,0,0,1727},{0,0,0,0,1729},{0,0,0,0,1731},
+    {0,0,0,0,1733},{0,0,0,0,1735},{0,0,0,0,1737},{0,0,0,0,1739},{0,0,0,0,1741},{0,0,0,0,1743},{0,0,0,0,1745},{0,0,0,0,1747},
+    {0,0,0,0,1749},{0,0,0,0,1751},{0,0,0,0,1753},{0,0,0,0,1755},{0,0,0,0,1757},{0,0,0,0,1759},{0,0,0,0,1761},{0,0,0,0,1763},
+    {0,0,0,0,1765},{0,0,0,0,1767},{0,0,0,0,1769},{0,0,0,0,1771},{0,0,0,0,1773},{0,0,0,0,1775},{0,0,0,0,1777},{0,0,0,0,1779},
+    {0,0,0,0,1781},{0,0,0,0,1783},{0,0,0,0,1785},{0,0,0,0,1787},{0,0,0,0,1789},{0,0,1791,1791,1794},{0,0,1796,1796,0},{0,0,0,0,1799},
+    {0,0,0,0,1801},{0,0,0,0,1803},{0,0,0,0,1805},{0,0,0,0,1807},{0,0,0,0,1809},{0,0,1811,1811,1814},{0,0,1816,1816,0},{0,0,1819,1819,1822},
+    {0,0,1824,1824,0},{0,0,0,0,1827},{0,0,1829,1829,1832},{0,0,1834,1834,0},{0,0,0,0,1837},{0,0,1839,1839,1842},{0,0,1844,1844,0},{0,0,1847,1847,1850},
+    {0,0,1852,1852,0},{0,0,1855,1855,1858},{0,0,1860,1860,0},{0,0,0,0,1863},{0,0,1865,1865,1868},{0,0,1870,1870,0},{0,0,1873,1873,1876},{0,0,1878,1878,0},
+    {0,0,1881,1881,1884},{0,0,1886,1886,0},{0,0,0,0,1889},{0,0,1891,1891,1894},{0,0,1896,1896,0},{0,0,1899,1899,1902},{0,0,1904,1904,0},{0,0,1907,1907,1910},
+    {0,0,1912,1912,0},{0,0,1915,1915,1918},{0,0,1920,1920,0},{0,0,1923,1923,1926},{0,0,1928,1928,0},{0,0,1931,1931,1934},{0,0,1936,1936,0},{0,0,0,0,1939},
+    {0,0,1941,1941,1944},{0,0,1946,1946,0},{0,0,0,0,1949},{0,0,0,0,1951},{0,0,0,0,1953},{0,0,0,0,1955},{0,0,0,0,1957},{0,0,0,0,1959},
+    {0,0,0,0,1961},{0,0,0,0,1963},{0,0,0,0,1965},{0,0,0,0,1967},{0,0,0,0,1969},{0,0,0,0,1971},{0,0,0,0,1973},{0,0,0,0,1975},
+    {0,0,0,0,1977},{0,0,0,0,1979},{0,0,0,0,1981},{0,0,0,0,1983},{0,0,0,0,1985},{0,0,0,0,1987},{0,0,0,0,1989},{0,0,0,0,1991},
+    {0,0,0,0,1993},{0,0,0,0,1995},{0,0,0,0,1997},{0,0,0,0,1999},{0,0,0,0,2001},{0,0,0,0,2003},{0,0,0,0,2005},{0,0,0,0,2007},
+    {0,0,0,0,2009},{0,0,0,0,2011},{0,0,0,0,2013},{0,0,0,0,2015},{0,0,0,0,2017},{0,0,0,0,2019},{0,0,0,0,2021},{0,0,0,0,2023},
+    {0,0,0,0,2025},{0,0,0,0,2027},{0,0,0,0,2029},{0,0,0,0,2031},{0,0,0,0,2033},{0,0,0,0,2035},{0,0,0,0,2037},{0,0,0,0,2039},
+    {0,0,0,0,2041},{0,0,0,0,2043},{0,0,0,0,2045},{0,0,0,0,2047},{0,0,0,0,2049},{0,0,0,0,2051},{0,0,0,0,2053},{0,0,0,0,2055},
+    {0,0,0,0,2057},{0,0,0,0,2059},{0,0,0,0,2061},{0,0,0,0,2063},{0,0,0,0,2065},{0,0,0,0,2067},{0,0,0,0,2069},{0,0,0,0,2071},
+    {0,0,0,0,2073},{0,0,0,0,2075},{0,0,0,0,2077},{0,2,0,2079,0},{222,0,0,0,0},{228,0,0,0,0},{10,0,0,0,0},{11,0,0,0,0},
+    {12,0,0,0,0},{13,0,0,0,0},{14,0,0,0,0},{15,0,0,0,0},{16,0,0,0,0},{17,0,0,0,0},{18,0,0,0,0},{19,0,0,0,0},
+    {20,0,0,0,0},{21,0,0,0,0},{22,0,0,0,0},{23,0,0,0,0},{24,0,0,0,0},{25,0,0,0,0},{30,0,0,0,0},{31,0,0,0,0},
+    {32,0,0,0,0},{0,0,2082,2082,0},{0,0,2085,2085,0},{0,0,2088,2088,0},{0,0,2091,2091,0},{0,0,2094,2094,0},{27,0,0,0,0},{28,0,0,0,0},
+    {29,0,0,0,0},{33,0,0,0,0},{34,0,0,0,0},{35,0,0,0,0},{0,2,0,2097,0},{0,2,0,2100,0},{0,2,0,2103,0},{0,2,0,2106,0},
+    {0,0,2109,2109,0},{0,0,2112,2112,0},{0,0,2115,2115,0},{36,0,0,0,0},{0,0,2118,2118,0},{0,0,2121,2121,0},{0,0,2124,2124,0},{7,4,0,0,0},
+    {9,0,0,0,0},{0,3,2127,2127,0},{0,3,2130,2130,0},{0,3,2133,2133,0},{0,3,2136,2136,0},{0,3,2139,2139,0},{0,3,2142,2142,0},{0,3,2145,2145,0},
+    {0,3,2148,2148,0},{7,0,0,0,0},{0,4,0,0,0},{0,0,2151,2151,0},{0,0,2154,2154,0},{0,3,2157,2157,0},{0,3,2160,2160,0},{0,3,2163,2163,0},
+    {0,3,2166,2166,0},{0,3,2169,2169,0},{0,3,2172,2172,0},{0,3,2175,2175,0},{0,3,2178,2178,0},{0,3,2181,2181,0},{0,0,2184,2184,0},{0,0,2187,2187,0},
+    {0,0,2190,2190,0},{0,3,2193,2193,0},{0,3,2196,2196,0},{0,0,2199,2199,0},{0,0,2202,2202,0},{0,0,2205,2205,0},{0,0,2208,2208,0},{0,0,2211,2211,0},
+    {84,0,0,0,0},{91,4,0,0,0},{0,0,2214,2214,0},{0,0,2217,2217,0},{0,0,2220,2220,0},{0,0,2223,2223,0},{0,0,2226,2226,0},{0,0,2230,2230,0},
+    {0,0,2233,2233,0},{0,0,2236,2236,0},{9,4,0,0,0},{0,0,2239,2239,0},{0,0,2242,2242,0},{0,0,2245,2245,0},{0,0,2249,2249,0},{0,2,0,2252,0},
+    {103,0,0,0,0},{107,0,0,0,0},{0,2,0,2255,0},{118,0,0,0,0},{122,0,0,0,0},{0,2,0,2258,0},{0,2,0,2261,0},{0,2,0,2264,0},
+    {216,0,0,0,0},{0,3,2266,2266,0},{0,3,2269,2269,0},{0,3,2272,2272,0},{0,3,2275,2275,0},{0,3,2278,2278,0},{0,3,2281,2281,0},{129,0,0,0,0},
+    {130,0,0,0,0},{0,3,2284,2284,0},{132,0,0,0,0},{0,3,2287,2287,0},{0,3,2290,2290,0},{0,2,0,2293,0},{0,3,2297,2297,0},{0,2,0,2300,0},
+    {0,3,2304,2304,0},{0,3,2307,2307,0},{0,3,2310,2310,0},{0,3,2313,2313,0},{0,3,2316,2316,0},{0,3,2319,2319,0},{0,3,2322,2322,0},{0,0,2325,2325,0},
+    {0,0,0,0,2328},{0,0,0,0,2330},{0,0,0,0,2332},{0,0,0,0,2334},{0,0,0,0,2336},{0,0,0,0,2338},{0,0,0,0,2340},{0,0,0,0,2342},
+    {0,0,0,0,2344},{0,0,0,0,2346},{0,0,0,0,2348},{0,0,0,0,2350},{0,0,0,0,2352},{0,0,0,0,2354},{0,0,0,0,2356},{0,0,0,0,2358},
+    {0,0,0,0,2360},{0,0,0,0,2362},{0,0,0,0,2364},{0,0,0,0,2366},{0,0,0,0,2368},{0,0,0,0,2370},{0,0,0,0,2372},{0,0,0,0,2374},
+    {0,0,0,0,2376},{0,0,0,0,2378},{0,0,0,0,2380},{0,0,0,0,2382},{0,0,0,0,2384},{0,0,0,0,2386},{0,0,0,0,2388},{0,0,0,0,2390},
+    {0,0,0,0,2392},{0,0,0,0,2394},{0,0,0,0,2396},{0,0,0,0,2398},{0,0,0,0,2400},{0,0,0,0,2402},{0,0,0,0,2404},{0,0,0,0,2406},
+    {0,2,0,2408,0},{0,0,0,0,2410},{0,0,0,0,2412},{0,0,0,0,2414},{0,0,0,0,2416},{0,0,0,0,2418},{0,0,0,0,2420},{0,0,0,0,2422},
+    {0,0,0,0,2424},{0,0,0,0,2426},{0,0,0,0,2428},{0,0,0,0,2430},{0,0,0,0,2432},{0,0,0,0,2434},{0,0,0,0,2436},{0,0,0,0,2438},
+    {0,0,0,0,2440},{0,0,0,0,2442},{0,0,0,0,2444},{0,0,0,0,2446},{0,0,0,0,2448},{0,0,0,0,2450},{0,0,0,0,2452},{0,0,0,0,2454},
+    {0,0,0,0,2456},{0,0,0,0,2458},{0,0,0,0,2460},{0,0,0,0,2462},{0,0,0,0,2464},{0,0,0,0,2466},{0,0,0,0,2468},{0,0,0,0,2470},
+    {0,0,0,0,2472},{0,0,0,0,2474},{0,0,0,0,2476},{0,0,0,0,2478},{0,0,0,0,2480},{0,0,0,0,2482},{0,0,0,0,2484},{0,0,0,0,2486},
+    {0,0,0,0,2488},{0,0,0,0,2490},{0,0,0,0,2492},{0,0,0,0,2494},{0,0,0,0,2496},{0,0,0,0,2498},{0,0,0,0,2500},{0,0,0,0,2502},
+    {0,0,0,0,2504},{0,0,0,0,2506},{0,0,0,0,2508},{0,0,0,0,2510},{0,0,0,0,2512},{0,0,0,0,2514},{0,0,0,0,2516},{0,0,0,0,2518},
+    {0,0,0,0,2520},{0,0,0,0,2522},{0,0,0,0,2524},{0,0,0,0,2526},{0,0,0,0,2528},{0,0,0,0,2530},{0,0,0,0,2532},{0,0,0,0,2534},
+    {0,0,0,0,2536},{0,0,0,0,2538},{0,0,0,0,2540},{0,0,0,0,2542},{0,0,0,0,2544},{0,0,0,0,2546},{0,0,0,0,2548},{0,0,0,0,2550},
+    {0,0,0,0,2552},{0,0,0,0,2554},{0,0,0,0,2556},{0,0,0,0,2558},{0,0,0,0,2560},{0,0,0,0,2562},{0,0,0,0,2564},{0,0,0,0,2566},
+    {0,0,0,0,2568},{0,0,0,0,2570},{0,0,0,0,2572},{0,0,0,0,2574},{0,0,0,0,2576},{0,0,0,0,2578},{0,0,0,0,2580},{0,0,2582,2582,0},
+    {0,0,2585,2585,0},{0,0,2588,2588,0},{0,0,2591,2591,0},{0,0,2594,2594,0},{0,0,2597,2597,0},{0,0,2600,2600,0},{0,0,2603,2603,0},{0,0,2606,2606,0},
+    {0,0,2609,2609,0},{0,0,2612,2612,0},{0,0,0,0,2615},{0,0,0,0,2617},{0,0,0,0,2619},{0,0,0,0,2621},{0,0,0,0,2623},{0,0,0,0,2625},
+    {0,0,0,0,2627},{0,0,0,0,2629},{0,0,0,0,2631},{0,0,0,0,2633},{0,0,0,0,2635},{0,0,0,0,2637},{0,0,0,0,2408},{0,0,0,0,2639},
+    {0,0,0,0,2641},{0,0,0,0,2643},{0,0,0,0,2645},{0,0,0,0,2647},{0,0,0,0,2649},{0,0,0,0,2651},{0,0,0,0,2653},{0,0,0,0,2655},
+    {0,0,0,0,2657},{0,0,0,0,2659},{0,0,0,0,2661},{0,0,0,0,2663},{0,0,0,0,2665},{0,0,0,0,2667},{0,0,0,0,2669},{0,0,0,0,2671},
+    {0,0,0,0,2673},{0,0,0,0,2675},{0,0,0,0,2677},{0,0,0,0,2679},{0,0,0,0,2681},{0,0,0,0,2683},{0,0,0,0,2685},{0,0,0,0,2687},
+    {0,0,0,0,2689},{0,0,0,0,2691},{0,0,0,0,2693},{0,0,0,0,2695},{0,0,0,0,2697},{0,0,0,0,2699},{0,0,0,0,2701},{0,0,0,0,2703},
+    {0,2,0,2705,0},{0,2,0,2707,0},{0,2,0,2709,0},{0,2,0,2711,0},{0,2,0,2713,0},{0,2,0,2715,0},{0,2,0,2717,0},{0,2,0,2719,0},
+    {0,2,0,2721,0},{0,2,0,2723,0},{0,2,0,2725,0},{0,2,0,2727,0},{0,2,0,2729,0},{0,2,0,2731,0},{0,2,0,2733,0},{0,2,0,2735,0},
+    {0,2,0,2737,0},{0,2,0,2739,0},{0,2,0,2741,0},{0,2,0,2743,0},{0,2,0,2745,0},{0,2,0,2747,0},{0,2,0,2749,0},{0,2,0,2751,0},
+    {0,2,0,3,0},{0,2,0,7,0},{0,2,0,9,0},{0,2,0,790,0},{0,2,0,792,0},{0,2,0,2753,0},{0,2,0,13,0},{0,2,0,21,0},
+    {0,2,0,25,0},{0,2,0,577,0},{0,2,0,778,0},{0,2,0,2755,0},{0,2,0,2757,0},{0,2,0,31,0},{0,2,0,39,0},{0,2,0,41,0},
+    {0,2,0,2759,0},{0,2,0,806,0},{0,2,0,43,0},{0,2,0,2761,0},{0,2,0,1416,0},{0,2,0,1418,0},{0,2,0,1452,0},{0,2,0,17,0},
+    {0,2,0,1633,0},{0,2,0,2763,0},{0,2,0,5,0},{0,2,0,2765,0},{0,2,0,164,0},{0,2,0,11,0},{0,2,0,2767,0},{0,2,0,2769,0},
+    {0,2,0,2771,0},{0,2,0,802,0},{0,2,0,800,0},{0,2,0,2773,0},{0,2,0,2775,0},{0,2,0,2777,0},{0,2,0,2779,0},{0,2,0,2781,0},
+    {0,2,0,2783,0},{0,2,0,2785,0},{0,2,0,2787,0},{0,2,0,808,0},{0,2,0,2789,0},{0,2,0,2791,0},{0,2,0,810,0},{0,2,0,2793,0},
+    {0,2,0,2795,0},{0,2,0,828,0},{0,2,0,2797,0},{0,2,0,1298,0},{0,2,0,842,0},{0,2,0,2799,0},{0,2,0,844,0},{0,2,0,1300,0},
+    {0,2,0,51,0},{0,2,0,2801,0},{0,2,0,2803,0},{0,2,0,850,0},{214,0,0,0,0},{218,0,0,0,0},{0,0,2805,2805,2808},{0,0,2810,2810,0},
+    {0,0,2813,2813,2816},{0,0,2818,2818,0},{0,0,2821,2821,2824},{0,0,2826,2826,0},{0,0,2829,2829,2832},{0,0,2834,2834,0},{0,0,2837,2837,2841},{0,0,2843,2843,0},
+    {0,0,2847,2847,2850},{0,0,2852,2852,0},{0,0,2855,2855,2858},{0,0,2860,2860,0},{0,0,2863,2863,2866},{0,0,2868,2868,0},{0,0,2871,2871,2874},{0,0,2876,2876,0},
+    {0,0,2879,2879,2882},{0,0,2884,2884,0},{0,0,2887,2887,2891},{0,0,2893,2893,0},{0,0,2897,2897,2901},{0,0,2903,2903,0},{0,0,2907,2907,2910},{0,0,2912,2912,0},
+    {0,0,2915,2915,2918},{0,0,2920,2920,0},{0,0,2923,2923,2927},{0,0,2929,2929,0},{0,0,2933,2933,2936},{0,0,2938,2938,0},{0,0,2941,2941,2944},{0,0,2946,2946,0},
+    {0,0,2949,2949,2952},{0,0,2954,2954,0},{0,0,2957,2957,2960},{0,0,2962,2962,0},{0,0,2965,2965,2968},{0,0,2970,2970,0},{0,0,2973,2973,2976},{0,0,2978,2978,0},
+    {0,0,2981,2981,2984},{0,0,2986,2986,0},{0,0,2989,2989,2992},{0,0,2994,2994,0},{0,0,2997,2997,3001},{0,0,3003,3003,0},{0,0,3007,3007,3010},{0,0,3012,3012,0},
+    {0,0,3015,3015,3018},{0,0,3020,3020,0},{0,0,3023,3023,3026},{0,0,3028,3028,0},{0,0,3031,3031,3034},{0,0,3036,3036,0},{0,0,3039,3039,3043},{0,0,3045,3045,0},
+    {0,0,3049,3049,3052},{0,0,3054,3054,0},{0,0,3057,3057,3060},{0,0,3062,3062,0},{0,0,3065,3065,3068},{0,0,3070,3070,0},{0,0,3073,3073,3076},{0,0,3078,3078,0},
+    {0,0,3081,3081,3084},{0,0,3086,3086,0},{0,0,3089,3089,3092},{0,0,3094,3094,0},{0,0,3097,3097,3100},{0,0,3102,3102,0},{0,0,3105,3105,3108},{0,0,3110,3110,0},
+    {0,0,3113,3113,3116},{0,0,3118,3118,0},{0,0,3121,3121,3125},{0,0,3127,3127,0},{0,0,3131,3131,3135},{0,0,3137,3137,0},{0,0,3141,3141,3145},{0,0,3147,3147,0},
+    {0,0,3151,3151,3155},{0,0,3157,3157,0},{0,0,3161,3161,3164},{0,0,3166,3166,0},{0,0,3169,3169,3172},{0,0,3174,3174,0},{0,0,3177,3177,3180},{0,0,3182,3182,0},
+    {0,0,3185,3185,3188},{0,0,3190,3190,0},{0,0,3193,3193,3197},{0,0,3199,3199,0},{0,0,3203,3203,3206},{0,0,3208,3208,0},{0,0,3211,3211,3214},{0,0,3216,3216,0},
+    {0,0,3219,3219,3222},{0,0,3224,3224,0},{0,0,3227,3227,3231},{0,0,3233,3233,0},{0,0,3237,3237,3241},{0,0,3243,3243,0},{0,0,3247,3247,3251},{0,0,3253,3253,0},
+    {0,0,3257,3257,3260},{0,0,3262,3262,0},{0,0,3265,3265,3268},{0,0,3270,3270,0},{0,0,3273,3273,3276},{0,0,3278,3278,0},{0,0,3281,3281,3284},{0,0,3286,3286,0},
+    {0,0,3289,3289,3292},{0,0,3294,3294,0},{0,0,3297,3297,3300},{0,0,3302,3302,0},{0,0,3305,3305,3308},{0,0,3310,3310,0},{0,0,3313,3313,3317},{0,0,3319,3319,0},
+    {0,0,3323,3323,3327},{0,0,3329,3329,0},{0,0,3333,3333,3336},{0,0,3338,3338,0},{0,0,3341,3341,3344},{0,0,3346,3346,0},{0,0,3349,3349,3352},{0,0,3354,3354,0},
+    {0,0,3357,3357,3360},{0,0,3362,3362,0},{0,0,3365,3365,3368},{0,0,3370,3370,0},{0,0,3373,3373,3376},{0,0,3378,3378,0},{0,0,3381,3381,3384},{0,0,3386,3386,0},
+    {0,0,3389,3389,3392},{0,0,3394,3394,0},{0,0,3397,3397,3400},{0,0,3402,3402,0},{0,0,3405,3405,3408},{0,0,3410,3410,0},{0,0,3413,3413,3416},{0,0,3418,3418,0},
+    {0,0,3421,3421,3424},{0,0,3426,3426,0},{0,0,3429,3429,3432},{0,0,3434,3434,0},{0,0,3437,3437,0},{0,0,3440,3440,0},{0,0,3443,3443,0},{0,0,3446,3446,0},
+    {0,2,0,3449,0},{0,2,3452,3216,0},{0,0,0,0,3455},{0,0,3457,3457,3460},{0,0,3462,3462,0},{0,0,3465,3465,3468},{0,0,3470,3470,0},{0,0,3473,3473,3477},
+    {0,0,3479,3479,0},{0,0,3483,3483,3487},{0,0,3489,3489,0},{0,0,3493,3493,3497},{0,0,3499,3499,0},{0,0,3503,3503,3507},{0,0,3509,3509,0},{0,0,3513,3513,3517},
+    {0,0,3519,3519,0},{0,0,3523,3523,3527},{0,0,3529,3529,0},{0,0,3533,3533,3537},{0,0,3539,3539,0},{0,0,3543,3543,3547},{0,0,3549,3549,0},{0,0,3553,3553,3557},
+    {0,0,3559,3559,0},{0,0,3563,3563,3567},{0,0,3569,3569,0},{0,0,3573,3573,3576},{0,0,3578,3578,0},{0,0,3581,3581,3584},{0,0,3586,3586,0},{0,0,3589,3589,3592},
+    {0,0,3594,3594,0},{0,0,3597,3597,3601},{0,0,3603,3603,0},{0,0,3607,3607,3611},{0,0,3613,3613,0},{0,0,3617,3617,3621},{0,0,3623,3623,0},{0,0,3627,3627,3631},
+    {0,0,3633,3633,0},{0,0,3637,3637,3641},{0,0,3643,3643,0},{0,0,3647,3647,3650},{0,0,3652,3652,0},{0,0,3655,3655,3658},{0,0,3660,3660,0},{0,0,3663,3663,3666},
+    {0,0,3668,3668,0},{0,0,3671,3671,3674},{0,0,3676,3676,0},{0,0,3679,3679,3683},{0,0,3685,3685,0},{0,0,3689,3689,3693},{0,0,3695,3695,0},{0,0,3699,3699,3703},
+    {0,0,3705,3705,0},{0,0,3709,3709,3713},{0,0,3715,3715,0},{0,0,3719,3719,3723},{0,0,3725,3725,0},{0,0,3729,3729,3733},{0,0,3735,3735,0},{0,0,3739,3739,3743},
+    {0,0,3745,3745,0},{0,0,3749,3749,3753},{0,0,3755,3755,0},{0,0,3759,3759,3763},{0,0,3765,3765,0},{0,0,3769,3769,3773},{0,0,3775,3775,0},{0,0,3779,3779,3782},
+    {0,0,3784,3784,0},{0,0,3787,3787,3790},{0,0,3792,3792,0},{0,0,3795,3795,3799},{0,0,3801,3801,0},{0,0,3805,3805,3809},{0,0,3811,3811,0},{0,0,3815,3815,3819},
+    {0,0,3821,3821,0},{0,0,3825,3825,3829},{0,0,3831,3831,0},{0,0,3835,3835,3839},{0,0,3841,3841,0},{0,0,3845,3845,3848},{0,0,3850,3850,0},{0,0,3853,3853,3856},
+    {0,0,3858,3858,0},{0,0,3861,3861,3864},{0,0,3866,3866,0},{0,0,3869,3869,3872},{0,0,3874,3874,0},{0,0,0,0,3877},{0,0,0,0,3879},{0,0,0,0,3881},
+    {0,0,3883,3883,0},{0,0,3886,3886,0},{0,0,3889,3889,0},{0,0,3893,3893,0},{0,0,3897,3897,0},{0,0,3901,3901,0},{0,0,3905,3905,0},{0,0,3909,3909,0},
+    {0,0,3913,3913,3916},{0,0,3918,3918,3921},{0,0,3923,3923,3927},{0,0,3929,3929,3933},{0,0,3935,3935,3939},{0,0,3941,3941,3945},{0,0,3947,3947,3951},{0,0,3953,3953,3957},
+    {0,0,3959,3959,0},{0,0,3962,3962,0},{0,0,3965,3965,0},{0,0,3969,3969,0},{0,0,3973,3973,0},{0,0,3977,3977,0},{0,0,3981,3981,3984},{0,0,3986,3986,3989},
+    {0,0,3991,3991,3995},{0,0,3997,3997,4001},{0,0,4003,4003,4007},{0,0,4009,4009,4013},{0,0,4015,4015,0},{0,0,4018,4018,0},{0,0,4021,4021,0},{0,0,4025,4025,0},
+    {0,0,4029,4029,0},{0,0,4033,4033,0},{0,0,4037,4037,0},{0,0,4041,4041,0},{0,0,4045,4045,4048},{0,0,4050,4050,4053},{0,0,4055,4055,4059},{0,0,4061,4061,4065},
+    {0,0,4067,4067,4071},{0,0,4073,4073,4077},{0,0,4079,4079,4083},{0,0,4085,4085,4089},{0,0,4091,4091,0},{0,0,4094,4094,0},{0,0,4097,4097,0},{0,0,4101,4101,0},
+    {0,0,4105,4105,0},{0,0,4109,4109,0},{0,0,4113,4113,0},{0,0,4117,4117,0},{0,0,4121,4121,4124},{0,0,4126,4126,4129},{0,0,4131,4131,4135},{0,0,4137,4137,4141},
+    {0,0,4143,4143,4147},{0,0,4149,4149,4153},{0,0,4155,4155,4159},{0,0,4161,4161,4165},{0,0,4167,4167,0},{0,0,4170,4170,0},{0,0,4173,4173,0},{0,0,4177,4177,0},
+    {0,0,4181,4181,0},{0,0,4185,4185,0},{0,0,4189,4189,4192},{0,0,4194,4194,4197},{0,0,4199,4199,4203},{0,0,4205,4205,4209},{0,0,4211,4211,4215},{0,0,4217,4217,4221},
+    {0,0,4223,4223,0},{0,0,4226,4226,0},{0,0,4229,4229,0},{0,0,4233,4233,0},{0,0,4237,4237,0},{0,0,4241,4241,0},{0,0,4245,4245,0},{0,0,4249,4249,0},
+    {0,0,4253,4253,4256},{0,0,4258,4258,4262},{0,0,4264,4264,4268},{0,0,4270,4270,4274},{0,0,4276,4276,0},{0,0,4279,4279,0},{0,0,4282,4282,0},{0,0,4286,4286,0},
+    {0,0,4290,4290,0},{0,0,4294,4294,0},{0,0,4298,4298,0},{0,0,4302,4302,0},{0,0,4306,4306,4309},{0,0,4311,4311,4314},{0,0,4316,4316,4320},{0,0,4322,4322,4326},
+    {0,0,4328,4328,4332},{0,0,4334,4334,4338},{0,0,4340,4340,4344},{0,0,4346,4346,4350},{0,0,4352,4352,0},{0,3,1468,1468,0},{0,0,4355,4355,0},{0,3,1471,1471,0},
+    {0,0,4358,4358,0},{0,3,1474,1474,0},{0,0,4361,4361,0},{0,3,1477,1477,0},{0,0,4364,4364,0},{0,3,1490,1490,0},{0,0,4367,4367,0},{0,3,1493,1493,0},
+    {0,0,4370,4370,0},{0,3,1496,1496,0},{0,0,4373,4373,0},{0,0,4377,4377,0},{0,0,4381,4381,0},{0,0,4386,4386,0},{0,0,4391,4391,0},{0,0,4396,4396,0},
+    {0,0,4401,4401,0},{0,0,4406,4406,0},{0,0,4411,4411,4415},{0,0,4417,4417,4421},{0,0,4423,4423,4428},{0,0,4430,4430,4435},{0,0,4437,4437,4442},{0,0,4444,4444,4449},
+    {0,0,4451,4451,4456},{0,0,4458,4458,4463},{0,0,4465,4465,0},{0,0,4469,4469,0},{0,0,4473,4473,0},{0,0,4478,4478,0},{0,0,4483,4483,0},{0,0,4488,4488,0},
+    {0,0,4493,4493,0},{0,0,4498,4498,0},{0,0,4503,4503,4507},{0,0,4509,4509,4513},{0,0,4515,4515,4520},{0,0,4522,4522,4527},{0,0,4529,4529,4534},{0,0,4536,4536,4541},
+    {0,0,4543,4543,4548},{0,0,4550,4550,4555},{0,0,4557,4557,0},{0,0,4561,4561,0},{0,0,4565,4565,0},{0,0,4570,4570,0},{0,0,4575,4575,0},{0,0,4580,4580,0},
+    {0,0,4585,4585,0},{0,0,4590,4590,0},{0,0,4595,4595,4599},{0,0,4601,4601,4605},{0,0,4607,4607,4612},{0,0,4614,4614,4619},{0,0,4621,4621,4626},{0,0,4628,4628,4633},
+    {0,0,4635,4635,4640},{0,0,4642,4642,4647},{0,0,4649,4649,0},{0,0,4652,4652,0},{0,0,4655,4655,0},{0,0,4659,4659,0},{0,0,4662,4662,0},{0,0,4666,4666,0},
+    {0,0,4669,4669,0},{0,0,4673,4673,4676},{0,0,4678,4678,4681},{0,0,4683,4683,4686},{0,3,1371,1371,4688},{0,0,4690,4690,4693},{0,2,0,4695,0},{0,3,1428,1428,0},
+    {0,2,0,4698,0},{0,2,4701,4704,0},{0,0,4708,4708,0},{0,0,4712,4712,0},{0,0,4715,4715,0},{0,0,4719,4719,0},{0,0,4722,4722,0},{0,0,4726,4726,4729},
+    {0,3,1378,1378,4731},{0,0,4733,4733,4736},{0,3,1383,1383,4738},{0,0,4740,4740,4743},{0,2,4745,4748,0},{0,2,4752,4755,0},{0,2,4759,4762,0},{0,0,4766,4766,0},
+    {0,0,4769,4769,0},{0,0,4772,4772,0},{0,3,1408,1408,0},{0,0,4776,4776,0},{0,0,4779,4779,0},{0,0,4783,4783,4786},{0,0,4788,4788,4791},{0,0,4793,4793,4796},
+    {0,3,1388,1388,4798},{0,2,4800,4803,0},{0,2,4807,4810,0},{0,2,4814,4817,0},{0,0,4821,4821,0},{0,0,4824,4824,0},{0,0,4827,4827,0},{0,3,1480,1480,0},
+    {0,0,4831,4831,0},{0,0,4834,4834,0},{0,0,4837,4837,0},{0,0,4840,4840,0},{0,0,4844,4844,4847},{0,0,4849,4849,4852},{0,0,4854,4854,4857},{0,3,1398,1398,4859},
+    {0,0,4861,4861,4864},{0,2,4866,4869,0},{0,3,1364,1367,0},{0,3,4873,4873,0},{0,0,4875,4875,0},{0,0,4879,4879,0},{0,0,4882,4882,0},{0,0,4886,4886,0},
+    {0,0,4889,4889,0},{0,0,4893,4893,4896},{0,3,1393,1393,4898},{0,0,4900,4900,4903},{0,3,1403,1403,4905},{0,0,4907,4907,4910},{0,3,4912,65,0},{0,2,0,4914,0},
+    {0,3,4917,53,0},{0,3,4919,53,0},{0,2,0,4921,0},{0,2,0,4923,0},{0,2,0,4926,0},{0,2,0,4928,0},{0,2,0,4931,0},{0,2,0,4935,0},
+    {0,2,0,4938,0},{0,2,0,4942,0},{0,2,0,4945,0},{0,2,0,4949,0},{0,2,0,4952,0},{0,2,0,4955,0},{0,2,0,4958,0},{0,2,0,4961,0},
+    {0,2,0,4964,0},{0,2,0,4969,0},{0,2,0,4971,0},{0,2,0,4973,0},{0,2,0,4975,0},{0,2,0,4977,0},{0,2,0,4979,0},{0,2,0,4981,0},
+    {0,2,0,4983,0},{0,2,0,4985,0},{0,2,0,4987,0},{0,2,0,4989,0},{0,2,0,4991,0},{0,2,0,27,0},{0,2,0,4993,0},{0,2,0,4996,0},
+    {0,2,0,5000,0},{0,2,0,5004,0},{0,2,0,5006,0},{0,2,0,5009,0},{0,2,0,5013,0},{0,2,0,5017,0},{0,2,0,5019,0},{0,2,0,452,0},
+    {0,2,0,5022,0},{0,2,0,5025,0},{0,2,0,5027,0},{0,2,0,5030,0},{0,2,0,5034,0},{0,2,0,5037,0},{0,3,5039,5039,1456},{0,3,2725,2725,21},
+    {0,3,112,112,115},{0,2,0,5041,0},{0,0,0,0,5043},{0,2,0,5045,0},{0,2,0,5047,0},{0,2,0,5049,0},{0,2,0,5051,0},{0,2,0,5053,0},
+    {0,2,0,5057,0},{0,2,0,5059,0},{0,2,0,5061,0},{0,2,0,5063,0},{0,2,0,5067,0},{0,2,0,5071,0},{0,2,0,5076,0},{0,2,0,5080,0},
+    {0,2,0,5084,0},{0,2,0,5088,0},{0,2,0,5092,0},{0,2,0,5096,0},{0,2,0,5100,0},{0,2,0,5104,0},{0,2,0,5108,0},{0,2,0,5112,0},
+    {0,2,0,5116,0},{0,2,0,5120,0},{0,2,0,5124,0},{0,2,0,2721,5127},{0,2,0,5129,5132},{0,2,0,5134,5138},{0,2,0,5140,5143},{0,2,0,5145,5147},
+    {0,2,0,5149,5152},{0,2,0,5154,5158},{0,2,0,5160,5165},{0,2,0,5167,5170},{0,2,0,5172,5174},{0,2,0,5176,5179},{0,2,0,5181,5185},{0,2,0,2727,5187},
+    {0,2,0,5004,5189},{0,2,0,2711,5191},{0,2,0,2729,5193},{0,2,0,5195,0},{0,2,0,5198,0},{0,2,0,5202,0},{0,2,0,5205,0},{0,2,0,5208,0},
+    {0,2,0,5212,0},{0,2,0,5217,0},{0,2,0,5220,0},{0,2,0,5223,0},{0,0,0,0,5227},{0,2,0,5229,0},{0,0,5233,5233,0},{0,0,5236,5236,0},
+    {0,0,5239,5239,0},{0,0,5242,5242,0},{0,0,5245,5245,0},{0,0,5248,5248,0},{0,0,5251,5251,0},{0,0,5254,5254,0},{0,0,5257,5257,0},{0,0,5260,5260,0},
+    {0,0,5263,5263,0},{0,2,0,5266,0},{0,2,0,5269,0},{0,2,0,5273,0},{0,2,0,5276,0},{0,0,5280,5280,0},{0,0,5283,5283,0},{0,0,5286,5286,0},
+    {0,0,5289,5289,0},{0,0,5292,5292,0},{0,0,5295,5295,0},{0,0,5298,5298,0},{0,0,5301,5301,0},{0,0,5304,5304,0},{0,0,5307,5307,0},{0,0,5310,5310,0},
+    {0,0,5313,5313,0},{0,0,5316,5316,0},{0,0,5319,5319,0},{0,0,5322,5322,0},{0,0,5325,5325,0},{0,0,5328,5328,0},{0,0,5331,5331,0},{0,0,5334,5334,0},
+    {0,0,5337,5337,0},{0,0,5340,5340,0},{0,0,5343,5343,0},{0,0,5346,5346,0},{0,0,5349,5349,0},{0,0,5352,5352,0},{0,0,5355,5355,0},{0,0,5358,5358,0},
+    {0,0,5361,5361,0},{0,0,5364,5364,0},{0,0,5367,5367,0},{0,0,5370,5370,0},{0,0,5373,5373,0},{0,0,5376,5376,0},{0,3,5379,5379,0},{0,3,5381,5381,0},
+    {0,2,0,5383,0},{0,2,0,5386,0},{0,2,0,5389,0},{0,2,0,5392,0},{0,2,0,5395,0},{0,2,0,5398,0},{0,2,0,5401,0},{0,2,0,5404,0},
+    {0,2,0,5407,0},{0,2,0,5410,0},{0,2,0,5413,0},{0,2,0,5416,0},{0,2,0,5420,0},{0,2,0,5424,0},{0,2,0,5428,0},{0,2,0,5432,0},
+    {0,2,0,5436,0},{0,2,0,5440,0},{0,2,0,5444,0},{0,2,0,5448,0},{0,2,0,5452,0},{0,2,0,5457,0},{0,2,0,5462,0},{0,2,0,5467,0},
+    {0,2,0,5472,0},{0,2,0,5477,0},{0,2,0,5482,0},{0,2,0,5487,0},{0,2,0,5492,0},{0,2,0,5497,0},{0,2,0,5502,0},{0,2,0,5507,0},
+    {0,2,0,5510,0},{0,2,0,5513,0},{0,2,0,5516,0},{0,2,0,5519,0},{0,2,0,5522,0},{0,2,0,5525,0},{0,2,0,5528,0},{0,2,0,5531,0},
+    {0,2,0,5534,0},{0,2,0,5538,0},{0,2,0,5542,0},{0,2,0,5546,0},{0,2,0,5550,0},{0,2,0,5554,0},{0,2,0,5558,0},{0,2,0,5562,0},
+    {0,2,0,5566,0},{0,2,0,5570,0},{0,2,0,5574,0},{0,2,0,5578,0},{0,2,0,5582,0},{0,2,0,5586,0},{0,2,0,5590,0},{0,2,0,5594,0},
+    {0,2,0,5598,0},{0,2,0,5602,0},{0,2,0,5606,0},{0,2,0,5610,0},{0,2,0,5614,0},{0,2,0,5618,0},{0,2,0,5622,0},{0,2,0,5626,0},
+    {0,2,0,5630,0},{0,2,0,5634,0},{0,2,0,5638,0},{0,2,0,5642,0},{0,2,0,5646,0},{0,2,0,5650,0},{0,2,0,5654,0},{0,2,0,5658,0},
+    {0,2,0,5662,0},{0,2,0,5666,0},{0,2,0,5670,0},{0,2,0,5674,0},{0,2,0,5678,0},{0,2,0,2705,5682},{0,2,0,2709,5684},{0,2,0,5004,5686},
+    {0,2,0,2711,5688},{0,2,0,2713,5690},{0,2,0,5041,5692},{0,2,0,2717,5694},{0,2,0,2719,5696},{0,2,0,2721,5698},{0,2,0,2723,5700},{0,2,0,2725,5702},
+    {0,2,0,2727,5704},{0,2,0,2729,5706},{0,2,0,2731,5708},{0,2,0,2733,5710},{0,2,0,2737,5712},{0,2,0,5025,5714},{0,2,0,2739,5716},{0,2,0,5718,5720},
+    {0,2,0,2741,5722},{0,2,0,2743,5724},{0,2,0,5145,5726},{0,2,0,2745,5728},{0,2,0,5172,5730},{0,2,0,5732,5734},{0,2,0,5037,5736},{0,2,0,33,0},
+    {0,2,0,5738,0},{0,2,0,5743,0},{0,2,0,5747,0},{0,2,0,5750,0},{0,3,5754,5754,0},{0,0,0,0,5757},{0,0,0,0,5759},{0,0,0,0,5761},
+    {0,0,0,0,5763},{0,0,0,0,5765},{0,0,0,0,5767},{0,0,0,0,5769},{0,0,0,0,5771},{0,0,0,0,5773},{0,0,0,0,5775},{0,0,0,0,5777},
+    {0,0,0,0,5779},{0,0,0,0,5781},{0,0,0,0,5783},{0,0,0,0,5785},{0,0,0,0,5787},{0,0,0,0,5789},{0,0,0,0,5791},{0,0,0,0,5793},
+    {0,0,0,0,5795},{0,0,0,0,5797},{0,0,0,0,5799},{0,0,0,0,5801},{0,0,0,0,5803},{0,0,0,0,5805},{0,0,0,0,5807},{0,0,0,0,5809},
+    {0,0,0,0,5811},{0,0,0,0,5813},{0,0,0,0,5815},{0,0,0,0,5817},{0,0,0,0,5819},{0,0,0,0,5821},{0,0,0,0,5823},{0,0,0,0,5825},
+    {0,0,0,0,5827},{0,0,0,0,5829},{0,0,0,0,5831},{0,0,0,0,5833},{0,0,0,0,5835},{0,0,0,0,5837},{0,0,0,0,5839},{0,0,0,0,5841},
+    {0,0,0,0,5843},{0,0,0,0,5845},{0,0,0,0,5847},{0,0,0,0,5849},{0,0,0,0,5851},{0,0,0,0,5853},{0,0,0,0,5855},{0,0,0,0,5857},
+    {0,0,0,0,5859},{0,0,0,0,5861},{0,0,0,0,5863},{0,0,0,0,5865},{0,0,0,0,2749},{0,0,0,0,2785},{0,0,0,0,2747},{0,0,0,0,2763},
+    {0,0,0,0,5867},{0,0,0,0,5869},{0,2,0,5145,0},{0,0,0,0,5871},{0,0,0,0,5873},{0,0,0,0,5875},{0,0,0,0,5877},{0,0,0,0,5879},
+    {0,0,0,0,5881},{0,0,0,0,5883},{0,0,0,0,5885},{0,0,0,0,5887},{0,0,0,0,5889},{0,0,0,0,5891},{0,0,0,0,5893},{0,0,0,0,5895},
+    {0,0,0,0,5897},{0,0,0,0,5899},{0,0,0,0,5901},{0,0,0,0,5903},{0,0,0,0,5905},{0,0,0,0,5907},{0,0,0,0,5909},{0,0,0,0,5911},
+    {0,0,0,0,5913},{0,0,0,0,5915},{0,0,0,0,5917},{0,0,0,0,5919},{0,0,0,0,5921},{0,0,0,0,5923},{0,0,0,0,5925},{0,0,0,0,5927},
+    {0,0,0,0,5929},{0,0,0,0,5931},{0,0,0,0,5933},{0,0,0,0,5935},{0,0,0,0,5937},{0,0,0,0,5939},{0,0,0,0,5941},{0,0,0,0,5943},
+    {0,0,0,0,5945},{0,0,0,0,5947},{0,0,0,0,5949},{0,0,0,0,5951},{0,0,0,0,5953},{0,0,0,0,5955},{0,0,0,0,5957},{0,0,0,0,5959},
+    {0,0,0,0,5961},{0,0,0,0,5963},{0,0,0,0,5965},{0,0,0,0,5967},{0,0,0,0,5969},{0,0,0,0,5971},{0,0,0,0,5973},{0,0,0,0,5975},
+    {0,0,0,0,5977},{0,0,0,0,5979},{0,2,0,5981,0},{0,2,0,5983,0},{0,2,0,5985,0},{0,2,0,5987,0},{0,2,0,5989,0},{0,2,0,5991,0},
+    {0,2,0,5993,0},{0,2,0,5995,0},{0,2,0,5997,0},{0,2,0,5999,0},{0,2,0,6001,0},{0,2,0,6003,0},{0,2,0,6005,0},{0,2,0,6007,0},
+    {0,2,0,6009,0},{0,2,0,6011,0},{0,2,0,6013,0},{0,2,0,6015,0},{0,2,0,6017,0},{0,2,0,6019,0},{0,2,0,6021,0},{0,2,0,6023,0},
+    {0,2,0,6025,0},{0,2,0,6027,0},{0,2,0,6029,0},{0,2,0,6031,0},{0,2,0,6033,0},{0,2,0,6035,0},{0,2,0,6037,0},{0,2,0,6039,0},
+    {0,2,0,6041,0},{0,2,0,6043,0},{0,2,0,6045,0},{0,2,0,6047,0},{0,2,0,6049,0},{0,2,0,6051,0},{0,2,0,6053,0},{0,2,0,6055,0},
+    {0,2,0,6057,0},{0,2,0,6059,0},{0,2,0,6061,0},{0,2,0,6063,0},{0,2,0,6065,0},{0,2,0,6067,0},{0,2,0,6069,0},{0,2,0,6071,0},
+    {0,2,0,6073,0},{0,2,0,6075,0},{0,2,0,6077,0},{0,2,0,6079,0},{0,2,0,6081,0},{0,2,0,6083,0},{0,2,0,6085,0},{0,2,0,6087,0},
+    {0,2,0,6089,0},{0,2,0,6091,0},{0,2,0,6093,0},{0,2,0,6095,0},{0,2,0,6097,0},{0,2,0,6099,0},{0,2,0,6101,0},{0,2,0,6103,0},
+    {0,2,0,6105,0},{0,2,0,6107,0},{0,2,0,6109,0},{0,2,0,6111,0},{0,2,0,6113,0},{0,2,0,6115,0},{0,2,0,6117,0},{0,2,0,6119,0},
+    {0,2,0,6121,0},{0,2,0,6123,0},{0,2,0,6125,0},{0,2,0,6127,0},{0,2,0,6129,0},{0,2,0,6131,0},{0,2,0,6133,0},{0,2,0,6135,0},
+    {0,2,0,6137,0},{0,2,0,6139,0},{0,2,0,6141,0},{0,2,0,6143,0},{0,2,0,6145,0},{0,2,0,6147,0},{0,2,0,6149,0},{0,2,0,6151,0},
+    {0,2,0,6153,0},{0,2,0,6155,0},{0,2,0,6157,0},{0,2,0,6159,0},{0,2,0,6161,0},{0,2,0,6163,0},{0,2,0,6165,0},{0,2,0,6167,0},
+    {0,2,0,6169,0},{0,2,0,6171,0},{0,2,0,6173,0},{0,2,0,6175,0},{0,2,0,6177,0},{0,2,0,6179,0},{0,2,0,6181,0},{0,2,0,6183,0},
+    {0,2,0,6185,0},{0,2,0,6187,0},{0,2,0,6189,0},{0,2,0,6191,0},{0,2,0,6193,0},{0,2,0,6195,0},{0,2,0,6197,0},{0,2,0,6199,0},
+    {0,2,0,6201,0},{0,2,0,6203,0},{0,2,0,6205,0},{0,2,0,6207,0},{0,2,0,6209,0},{0,2,0,6211,0},{0,2,0,6213,0},{0,2,0,6215,0},
+    {0,2,0,6217,0},{0,2,0,6219,0},{0,2,0,6221,0},{0,2,0,6223,0},{0,2,0,6225,0},{0,2,0,6227,0},{0,2,0,6229,0},{0,2,0,6231,0},
+    {0,2,0,6233,0},{0,2,0,6235,0},{0,2,0,6237,0},{0,2,0,6239,0},{0,2,0,6241,0},{0,2,0,6243,0},{0,2,0,6245,0},{0,2,0,6247,0},
+    {0,2,0,6249,0},{0,2,0,6251,0},{0,2,0,6253,0},{0,2,0,6255,0},{0,2,0,6257,0},{0,2,0,6259,0},{0,2,0,6261,0},{0,2,0,6263,0},
+    {0,2,0,6265,0},{0,2,0,6267,0},{0,2,0,6269,0},{0,2,0,6271,0},{0,2,0,6273,0},{0,2,0,6275,0},{0,2,0,6277,0},{0,2,0,6279,0},
+    {0,2,0,6281,0},{0,2,0,6283,0},{0,2,0,6285,0},{0,2,0,6287,0},{0,2,0,6289,0},{0,2,0,6291,0},{0,2,0,6293,0},{0,2,0,6295,0},
+    {0,2,0,6297,0},{0,2,0,6299,0},{0,2,0,6301,0},{0,2,0,6303,0},{0,2,0,6305,0},{0,2,0,6307,0},{0,2,0,6309,0},{0,2,0,6311,0},
+    {0,2,0,6313,0},{0,2,0,6315,0},{0,2,0,6317,0},{0,2,0,6319,0},{0,2,0,6321,0},{0,2,0,6323,0},{0,2,0,6325,0},{0,2,0,6327,0},
+    {0,2,0,6329,0},{0,2,0,6331,0},{0,2,0,6333,0},{0,2,0,6335,0},{0,2,0,6337,0},{0,2,0,6339,0},{0,2,0,6341,0},{0,2,0,6343,0},
+    {0,2,0,6345,0},{0,2,0,6347,0},{0,2,0,6349,0},{0,2,0,6351,0},{0,2,0,6353,0},{0,2,0,6355,0},{0,2,0,6357,0},{0,2,0,6359,0},
+    {0,2,0,6361,0},{0,2,0,6363,0},{0,2,0,6365,0},{0,2,0,6367,0},{0,2,0,6369,0},{0,2,0,6371,0},{0,2,0,6373,0},{0,2,0,6375,0},
+    {0,2,0,6377,0},{0,2,0,6379,0},{0,2,0,6381,0},{0,2,0,6383,0},{0,2,0,6385,0},{0,2,0,6387,0},{0,2,0,6389,0},{0,2,0,6391,0},
+    {0,2,0,6393,0},{0,2,0,6395,0},{0,2,0,6397,0},{0,2,0,6399,0},{0,2,0,6401,0},{0,2,0,6403,0},{0,2,0,6405,0},{0,2,0,6407,0},
+    {0,2,0,6409,0},{0,2,0,6411,0},{0,2,0,6413,0},{224,0,0,0,0},{0,2,0,6415,0},{0,2,0,6417,0},{0,2,0,6419,0},{0,0,6421,6421,0},
+    {0,0,6424,6424,0},{0,0,6427,6427,0},{0,0,6430,6430,0},{0,0,6433,6433,0},{0,0,6436,6436,0},{0,0,6439,6439,0},{0,0,6442,6442,0},{0,0,6445,6445,0},
+    {0,0,6448,6448,0},{0,0,6451,6451,0},{0,0,6454,6454,0},{0,0,6457,6457,0},{0,0,6460,6460,0},{0,0,6463,6463,0},{0,0,6466,6466,0},{0,0,6469,6469,0},
+    {0,0,6472,6472,0},{0,0,6475,6475,0},{0,0,6478,6478,0},{0,0,6481,6481,0},{0,0,6484,6484,0},{0,0,6487,6487,0},{0,0,6490,6490,0},{0,0,6493,6493,0},
+    {0,0,6496,6496,0},{8,4,0,0,0},{0,2,0,6499,0},{0,2,0,6502,0},{0,0,6505,6505,0},{0,2,0,6508,0},{0,0,6511,6511,0},{0,0,6514,6514,0},
+    {0,0,6517,6517,0},{0,0,6520,6520,0},{0,0,6523,6523,0},{0,0,6526,6526,0},{0,0,6529,6529,0},{0,0,6532,6532,0},{0,0,6535,6535,0},{0,0,6538,6538,0},
+    {0,0,6541,6541,0},{0,0,6544,6544,0},{0,0,6547,6547,0},{0,0,6550,6550,0},{0,0,6553,6553,0},{0,0,6556,6556,0},{0,0,6559,6559,0},{0,0,6562,6562,0},
+    {0,0,6565,6565,0},{0,0,6568,6568,0},{0,0,6571,6571,0},{0,0,6574,6574,0},{0,0,6577,6577,0},{0,0,6580,6580,0},{0,0,6583,6583,0},{0,0,6586,6586,0},
+    {0,0,6589,6589,0},{0,0,6592,6592,0},{0,0,6595,6595,0},{0,0,6598,6598,0},{0,0,6601,6601,0},{0,2,0,6604,0},{0,2,0,6607,0},{0,2,0,6609,0},
+    {0,2,0,6611,0},{0,2,0,6613,0},{0,2,0,6615,0},{0,2,0,6617,0},{0,2,0,6619,0},{0,2,0,6621,0},{0,2,0,6623,0},{0,2,0,6625,0},
+    {0,2,0,6627,0},{0,2,0,6629,0},{0,2,0,6631,0},{0,2,0,6633,0},{0,2,0,6635,0},{0,2,0,6637,0},{0,2,0,6639,0},{0,2,0,6641,0},
+    {0,2,0,6643,0},{0,2,0,6645,0},{0,2,0,6647,0},{0,2,0,6649,0},{0,2,0,6651,0},{0,2,0,6653,0},{0,2,0,6655,0},{0,2,0,6657,0},
+    {0,2,0,6659,0},{0,2,0,6661,0},{0,2,0,6663,0},{0,2,0,6665,0},{0,2,0,6667,0},{0,2,0,6669,0},{0,2,0,6671,0},{0,2,0,6673,0},
+    {0,2,0,6675,0},{0,2,0,6677,0},{0,2,0,6679,0},{0,2,0,6681,0},{0,2,0,6683,0},{0,2,0,6685,0},{0,2,0,6687,0},{0,2,0,6689,0},
+    {0,2,0,6691,0},{0,2,0,6693,0},{0,2,0,6695,0},{0,2,0,6697,0},{0,2,0,6699,0},{0,2,0,6701,0},{0,2,0,6703,0},{0,2,0,6705,0},
+    {0,2,0,6707,0},{0,2,0,6709,0},{0,2,0,6711,0},{0,2,0,6713,0},{0,2,0,6715,0},{0,2,0,6717,0},{0,2,0,6719,0},{0,2,0,6721,0},
+    {0,2,0,6723,0},{0,2,0,6725,0},{0,2,0,6727,0},{0,2,0,6729,0},{0,2,0,6731,0},{0,2,0,6733,0},{0,2,0,6735,0},{0,2,0,6737,0},
+    {0,2,0,6739,0},{0,2,0,6741,0},{0,2,0,6743,0},{0,2,0,6745,0},{0,2,0,6747,0},{0,2,0,6749,0},{0,2,0,6751,0},{0,2,0,6753,0},
+    {0,2,0,6755,0},{0,2,0,6757,0},{0,2,0,6759,0},{0,2,0,6761,0},{0,2,0,6763,0},{0,2,0,6765,0},{0,2,0,6767,0},{0,2,0,6769,0},
+    {0,2,0,6771,0},{0,2,0,6773,0},{0,2,0,6775,0},{0,2,0,6777,0},{0,2,0,6779,0},{0,2,0,6781,0},{0,2,0,6783,0},{0,2,0,6785,0},
+    {0,2,0,6787,0},{0,2,0,6789,0},{0,2,0,6791,0},{0,2,0,6793,0},{0,2,0,6795,0},{0,2,0,6797,0},{0,2,0,6799,0},{0,2,0,6801,0},
+    {0,2,0,6803,0},{0,2,0,6805,0},{0,2,0,6807,0},{0,2,0,6809,0},{0,2,0,6811,0},{0,2,0,6813,0},{0,2,0,6815,0},{0,2,0,6819,0},
+    {0,2,0,6823,0},{0,2,0,6827,0},{0,2,0,6831,0},{0,2,0,6835,0},{0,2,0,6839,0},{0,2,0,6843,0},{0,2,0,6847,0},{0,2,0,6851,0},
+    {0,2,0,6855,0},{0,2,0,6859,0},{0,2,0,6863,0},{0,2,0,6867,0},{0,2,0,6871,0},{0,2,0,6876,0},{0,2,0,6881,0},{0,2,0,6886,0},
+    {0,2,0,6891,0},{0,2,0,6896,0},{0,2,0,6901,0},{0,2,0,6906,0},{0,2,0,6911,0},{0,2,0,6916,0},{0,2,0,6921,0},{0,2,0,6926,0},
+    {0,2,0,6931,0},{0,2,0,6936,0},{0,2,0,6941,0},{0,2,0,6946,0},{0,2,0,6954,0},{0,2,0,6961,0},{0,2,0,6965,0},{0,2,0,6969,0},
+    {0,2,0,6973,0},{0,2,0,6977,0},{0,2,0,6981,0},{0,2,0,6985,0},{0,2,0,6989,0},{0,2,0,6993,0},{0,2,0,6997,0},{0,2,0,7001,0},
+    {0,2,0,7005,0},{0,2,0,7009,0},{0,2,0,7013,0},{0,2,0,7017,0},{0,2,0,7021,0},{0,2,0,7025,0},{0,2,0,7029,0},{0,2,0,7033,0},
+    {0,2,0,7037,0},{0,2,0,7041,0},{0,2,0,7045,0},{0,2,0,7049,0},{0,2,0,7053,0},{0,2,0,7057,0},{0,2,0,7061,0},{0,2,0,7065,0},
+    {0,2,0,7069,0},{0,2,0,7073,0},{0,2,0,7077,0},{0,2,0,7081,0},{0,2,0,7085,0},{0,2,0,7089,0},{0,2,0,7093,0},{0,2,0,7097,0},
+    {0,2,0,7101,0},{0,2,0,7105,0},{0,2,0,7107,0},{0,2,0,7109,0},{0,2,0,7111,0},{0,2,0,7115,0},{0,2,0,7118,0},{0,2,0,7121,0},
+    {0,2,0,7124,0},{0,2,0,7127,0},{0,2,0,7130,0},{0,2,0,7133,0},{0,2,0,7136,0},{0,2,0,7139,0},{0,2,0,7142,0},{0,2,0,7145,0},
+    {0,2,0,7148,0},{0,2,0,7151,0},{0,2,0,7154,0},{0,2,0,7157,0},{0,2,0,7160,0},{0,2,0,7163,0},{0,2,0,7166,0},{0,2,0,7169,0},
+    {0,2,0,7172,0},{0,2,0,7175,0},{0,2,0,7178,0},{0,2,0,7181,0},{0,2,0,7184,0},{0,2,0,7187,0},{0,2,0,7190,0},{0,2,0,7193,0},
+    {0,2,0,7196,0},{0,2,0,7199,0},{0,2,0,7202,0},{0,2,0,7208,0},{0,2,0,7213,0},{0,2,0,7216,0},{0,2,0,7218,0},{0,2,0,7220,0},
+    {0,2,0,7222,0},{0,2,0,7224,0},{0,2,0,7226,0},{0,2,0,7228,0},{0,2,0,7230,0},{0,2,0,7232,0},{0,2,0,7234,0},{0,2,0,7236,0},
+    {0,2,0,7238,0},{0,2,0,7240,0},{0,2,0,7242,0},{0,2,0,7244,0},{0,2,0,7246,0},{0,2,0,7248,0},{0,2,0,7250,0},{0,2,0,7252,0},
+    {0,2,0,7254,0},{0,2,0,7256,0},{0,2,0,7258,0},{0,2,0,7260,0},{0,2,0,7262,0},{0,2,0,7264,0},{0,2,0,7266,0},{0,2,0,7268,0},
+    {0,2,0,7270,0},{0,2,0,7272,0},{0,2,0,7274,0},{0,2,0,7276,0},{0,2,0,7278,0},{0,2,0,7280,0},{0,2,0,7283,0},{0,2,0,7286,0},
+    {0,2,0,7289,0},{0,2,0,7292,0},{0,2,0,7295,0},{0,2,0,7298,0},{0,2,0,7301,0},{0,2,0,7304,0},{0,2,0,7307,0},{0,2,0,7310,0},
+    {0,2,0,7313,0},{0,2,0,7316,0},{0,2,0,7319,0},{0,2,0,7322,0},{0,2,0,7325,0},{0,2,0,7328,0},{0,2,0,7331,0},{0,2,0,7334,0},
+    {0,2,0,7337,0},{0,2,0,7340,0},{0,2,0,7343,0},{0,2,0,7346,0},{0,2,0,7349,0},{0,2,0,7352,0},{0,2,0,7356,0},{0,2,0,7360,0},
+    {0,2,0,7364,0},{0,2,0,7367,0},{0,2,0,7371,0},{0,2,0,7374,0},{0,2,0,7378,0},{0,2,0,7380,0},{0,2,0,7382,0},{0,2,0,7384,0},
+    {0,2,0,7386,0},{0,2,0,7388,0},{0,2,0,7390,0},{0,2,0,7392,0},{0,2,0,7394,0},{0,2,0,7396,0},{0,2,0,7398,0},{0,2,0,7400,0},
+    {0,2,0,7402,0},{0,2,0,7404,0},{0,2,0,7406,0},{0,2,0,7408,0},{0,2,0,7410,0},{0,2,0,7412,0},{0,2,0,7414,0},{0,2,0,7416,0},
+    {0,2,0,7418,0},{0,2,0,7420,0},{0,2,0,7422,0},{0,2,0,7424,0},{0,2,0,7426,0},{0,2,0,7428,0},{0,2,0,7430,0},{0,2,0,7432,0},
+    {0,2,0,7434,0},{0,2,0,7436,0},{0,2,0,7438,0},{0,2,0,7440,0},{0,2,0,7442,0},{0,2,0,7444,0},{0,2,0,7446,0},{0,2,0,7448,0},
+    {0,2,0,7450,0},{0,2,0,7452,0},{0,2,0,7454,0},{0,2,0,7456,0},{0,2,0,7458,0},{0,2,0,7460,0},{0,2,0,7462,0},{0,2,0,7464,0},
+    {0,2,0,7466,0},{0,2,0,7468,0},{0,2,0,7470,0},{0,2,0,7472,0},{0,2,0,7475,0},{0,2,0,7481,0},{0,2,0,7486,0},{0,2,0,7492,0},
+    {0,2,0,7496,0},{0,2,0,7502,0},{0,2,0,7506,0},{0,2,0,7510,0},{0,2,0,7517,0},{0,2,0,7522,0},{0,2,0,7526,0},{0,2,0,7530,0},
+    {0,2,0,7534,0},{0,2,0,7539,0},{0,2,0,7544,0},{0,2,0,7549,0},{0,2,0,7554,0},{0,2,0,7559,0},{0,2,0,7564,0},{0,2,0,7569,0},
+    {0,2,0,7576,0},{0,2,0,7579,0},{0,2,0,7586,0},{0,2,0,7593,0},{0,2,0,7599,0},{0,2,0,7604,0},{0,2,0,7611,0},{0,2,0,7618,0},
+    {0,2,0,7623,0},{0,2,0,7627,0},{0,2,0,7631,0},{0,2,0,7636,0},{0,2,0,7641,0},{0,2,0,7647,0},{0,2,0,7653,0},{0,2,0,7657,0},
+    {0,2,0,7661,0},{0,2,0,7666,0},{0,2,0,7670,0},{0,2,0,7674,0},{0,2,0,7677,0},{0,2,0,7680,0},{0,2,0,7684,0},{0,2,0,7688,0},
+    {0,2,0,7695,0},{0,2,0,7700,0},{0,2,0,7706,0},{0,2,0,7713,0},{0,2,0,7718,0},{0,2,0,7722,0},{0,2,0,7726,0},{0,2,0,7733,0},
+    {0,2,0,7738,0},{0,2,0,7745,0},{0,2,0,7749,0},{0,2,0,7755,0},{0,2,0,7759,0},{0,2,0,7764,0},{0,2,0,7768,0},{0,2,0,7773,0},
+    {0,2,0,7779,0},{0,2,0,7784,0},{0,2,0,7790,0},{0,2,0,7795,0},{0,2,0,7798,0},{0,2,0,7804,0},{0,2,0,7808,0},{0,2,0,7812,0},
+    {0,2,0,7817,0},{0,2,0,7821,0},{0,2,0,7825,0},{0,2,0,7829,0},{0,2,0,7835,0},{0,2,0,7840,0},{0,2,0,7843,0},{0,2,0,7850,0},
+    {0,2,0,7854,0},{0,2,0,7860,0},{0,2,0,7865,0},{0,2,0,7870,0},{0,2,0,7874,0},{0,2,0,7878,0},{0,2,0,7883,0},{0,2,0,7886,0},
+    {0,2,0,7891,0},{0,2,0,7897,0},{0,2,0,7900,0},{0,2,0,7907,0},{0,2,0,7911,0},{0,2,0,7914,0},{0,2,0,7917,0},{0,2,0,7920,0},
+    {0,2,0,7923,0},{0,2,0,7926,0},{0,2,0,7929,0},{0,2,0,7932,0},{0,2,0,7935,0},{0,2,0,7938,0},{0,2,0,7941,0},{0,2,0,7945,0},
+    {0,2,0,7949,0},{0,2,0,7953,0},{0,2,0,7957,0},{0,2,0,7961,0},{0,2,0,7965,0},{0,2,0,7969,0},{0,2,0,7973,0},{0,2,0,7977,0},
+    {0,2,0,7981,0},{0,2,0,7985,0},{0,2,0,7989,0},{0,2,0,7993,0},{0,2,0,7997,0},{0,2,0,8001,0},{0,2,0,8005,0},{0,2,0,8008,0},
+    {0,2,0,8011,0},{0,2,0,8015,0},{0,2,0,8018,0},{0,2,0,8021,0},{0,2,0,8024,0},{0,2,0,8028,0},{0,2,0,8032,0},{0,2,0,8035,0},
+    {0,2,0,8038,0},{0,2,0,8041,0},{0,2,0,8044,0},{0,2,0,8047,0},{0,2,0,8052,0},{0,2,0,8055,0},{0,2,0,8058,0},{0,2,0,8061,0},
+    {0,2,0,8064,0},{0,2,0,8067,0},{0,2,0,8070,0},{0,2,0,8073,0},{0,2,0,8076,0},{0,2,0,8080,0},{0,2,0,8085,0},{0,2,0,8088,0},
+    {0,2,0,8091,0},{0,2,0,8094,0},{0,2,0,8097,0},{0,2,0,8100,0},{0,2,0,8103,0},{0,2,0,8106,0},{0,2,0,8110,0},{0,2,0,8114,0},
+    {0,2,0,8118,0},{0,2,0,8122,0},{0,2,0,8125,0},{0,2,0,8128,0},{0,2,0,8131,0},{0,2,0,8134,0},{0,2,0,8137,0},{0,2,0,8140,0},
+    {0,2,0,8143,0},{0,2,0,8146,0},{0,2,0,8149,0},{0,2,0,8152,0},{0,2,0,8156,0},{0,2,0,8160,0},{0,2,0,8163,0},{0,2,0,8167,0},
+    {0,2,0,8171,0},{0,2,0,8175,0},{0,2,0,8178,0},{0,2,0,8182,0},{0,2,0,8186,0},{0,2,0,8191,0},{0,2,0,8194,0},{0,2,0,8198,0},
+    {0,2,0,8202,0},{0,2,0,8206,0},{0,2,0,8210,0},{0,2,0,8216,0},{0,2,0,8223,0},{0,2,0,8226,0},{0,2,0,8229,0},{0,2,0,8232,0},
+    {0,2,0,8235,0},{0,2,0,8238,0},{0,2,0,8241,0},{0,2,0,8244,0},{0,2,0,8247,0},{0,2,0,8250,0},{0,2,0,8253,0},{0,2,0,8256,0},
+    {0,2,0,8259,0},{0,2,0,8262,0},{0,2,0,8265,0},{0,2,0,8268,0},{0,2,0,8271,0},{0,2,0,8274,0},{0,2,0,8277,0},{0,2,0,8282,0},
+    {0,2,0,8285,0},{0,2,0,8288,0},{0,2,0,8291,0},{0,2,0,8296,0},{0,2,0,8300,0},{0,2,0,8303,0},{0,2,0,8306,0},{0,2,0,8309,0},
+    {0,2,0,8312,0},{0,2,0,8315,0},{0,2,0,8318,0},{0,2,0,8321,0},{0,2,0,8324,0},{0,2,0,8327,0},{0,2,0,8330,0},{0,2,0,8334,0},
+    {0,2,0,8337,0},{0,2,0,8340,0},{0,2,0,8344,0},{0,2,0,8348,0},{0,2,0,8351,0},{0,2,0,8356,0},{0,2,0,8360,0},{0,2,0,8363,0},
+    {0,2,0,8366,0},{0,2,0,8369,0},{0,2,0,8372,0},{0,2,0,8376,0},{0,2,0,8380,0},{0,2,0,8383,0},{0,2,0,8386,0},{0,2,0,8389,0},
+    {0,2,0,8392,0},{0,2,0,8395,0},{0,2,0,8398,0},{0,2,0,8401,0},{0,2,0,8404,0},{0,2,0,8407,0},{0,2,0,8411,0},{0,2,0,8415,0},
+    {0,2,0,8419,0},{0,2,0,8423,0},{0,2,0,8427,0},{0,2,0,8431,0},{0,2,0,8435,0},{0,2,0,8439,0},{0,2,0,8443,0},{0,2,0,8447,0},
+    {0,2,0,8451,0},{0,2,0,8455,0},{0,2,0,8459,0},{0,2,0,8463,0},{0,2,0,8467,0},{0,2,0,8471,0},{0,2,0,8475,0},{0,2,0,8479,0},
+    {0,2,0,8483,0},{0,2,0,8487,0},{0,2,0,8491,0},{0,2,0,8495,0},{0,0,0,0,8499},{0,0,0,0,8501},{0,0,0,0,8503},{0,0,0,0,8505},
+    {0,0,0,0,8507},{0,0,0,0,8509},{0,0,0,0,8511},{0,0,0,0,8513},{0,0,0,0,8515},{0,0,0,0,8517},{0,0,0,0,8519},{0,0,0,0,8521},
+    {0,0,0,0,8523},{0,0,0,0,8525},{0,0,0,0,8527},{0,0,0,0,8529},{0,0,0,0,8531},{0,0,0,0,8533},{0,0,0,0,8535},{0,0,0,0,8537},
+    {0,0,0,0,8539},{0,0,0,0,8541},{0,0,0,0,8543},{0,0,0,0,8545},{0,0,0,0,8547},{0,0,0,0,8549},{0,0,0,0,8551},{0,0,0,0,8553},
+    {0,0,0,0,8555},{0,0,0,0,8557},{0,0,0,0,8559},{0,0,0,0,8561},{0,0,0,0,8563},{0,0,0,0,8565},{0,0,0,0,8567},{0,0,0,0,8569},
+    {0,0,0,0,8571},{0,2,0,1659,0},{0,2,0,1663,0},{0,0,0,0,8573},{0,0,0,0,8575},{0,0,0,0,8577},{0,0,0,0,8579},{0,0,0,0,8581},
+    {0,0,0,0,8583},{0,0,0,0,8585},{0,0,0,0,8587},{0,0,0,0,8589},{0,0,0,0,8591},{0,0,0,0,8593},{0,0,0,0,8595},{0,0,0,0,8597},
+    {0,0,0,0,8599},{0,0,0,0,8601},{0,0,0,0,8603},{0,0,0,0,8605},{0,0,0,0,8607},{0,0,0,0,8609},{0,0,0,0,8611},{0,0,0,0,8613},
+    {0,0,0,0,8615},{0,0,0,0,8617},{0,0,0,0,8619},{0,0,0,0,8621},{0,0,0,0,8623},{0,0,0,0,8625},{0,0,0,0,8627},{0,0,0,0,8629},
+    {0,0,0,0,8631},{0,0,0,0,8633},{0,0,0,0,8635},{0,0,0,0,8637},{0,0,0,0,8639},{0,0,0,0,8641},{0,0,0,0,8643},{0,0,0,0,8645},
+    {0,0,0,0,8647},{0,2,0,8647,0},{0,0,0,0,8649},{0,0,0,0,8651},{0,0,0,0,8653},{0,0,0,0,8655},{0,0,0,0,8657},{0,0,0,0,8659},
+    {0,0,0,0,8661},{0,0,0,0,8663},{0,0,0,0,8665},{0,0,0,0,2771},{0,0,0,0,8667},{0,0,0,0,8669},{0,0,0,0,8671},{0,0,0,0,8673},
+    {0,0,0,0,8675},{0,0,0,0,8677},{0,0,0,0,8679},{0,0,0,0,8681},{0,0,0,0,8683},{0,0,0,0,8685},{0,0,0,0,8687},{0,0,0,0,8689},
+    {0,0,0,0,1312},{0,0,0,0,2753},{0,0,0,0,2769},{0,0,0,0,8691},{0,0,0,0,2773},{0,0,0,0,8693},{0,0,0,0,8695},{0,0,0,0,2777},
+    {0,0,0,0,8697},{0,0,0,0,8699},{0,0,0,0,8701},{0,0,0,0,8703},{0,0,0,0,8705},{0,0,0,0,8707},{0,0,0,0,8709},{0,0,0,0,8711},
+    {0,0,0,0,8713},{0,0,0,0,8715},{0,0,0,0,2795},{0,0,0,0,8717},{0,0,0,0,8719},{0,0,0,0,8721},{0,0,0,0,8723},{0,0,0,0,8725},
+    {0,0,0,0,8727},{0,0,0,0,8729},{0,2,0,8731,0},{0,2,0,603,0},{0,2,0,8577,0},{0,2,0,8733,0},{0,2,0,5855,0},{0,2,0,8735,0},
+    {0,2,0,8737,0},{0,3,8739,8739,0},{0,3,8741,8741,0},{0,3,6303,6303,0},{0,3,8743,8743,0},{0,3,8745,8745,0},{0,3,8747,8747,0},{0,3,8749,8749,0},
+    {0,3,6411,6411,0},{0,3,8751,8751,0},{0,3,6319,6319,0},{0,3,8753,8753,0},{0,3,8755,8755,0},{0,3,8757,8757,0},{0,3,8759,8759,0},{0,3,8761,8761,0},
+    {0,3,8763,8763,0},{0,3,8765,8765,0},{0,3,8767,8767,0},{0,3,8769,8769,0},{0,3,8771,8771,0},{0,3,8773,8773,0},{0,3,8775,8775,0},{0,3,8777,8777,0},
+    {0,3,8779,8779,0},{0,3,8781,8781,0},{0,3,8783,8783,0},{0,3,8785,8785,0},{0,3,8787,8787,0},{0,3,8789,8789,0},{0,3,8791,8791,0},{0,3,8793,8793,0},
+    {0,3,8795,8795,0},{0,3,8797,8797,0},{0,3,8799,8799,0},{0,3,8801,8801,0},{0,3,8803,8803,0},{0,3,8805,8805,0},{0,3,8807,8807,0},{0,3,8809,8809,0},
+    {0,3,8811,8811,0},{0,3,8813,8813,0},{0,3,8815,8815,0},{0,3,8817,8817,0},{0,3,8819,8819,0},{0,3,8821,8821,0},{0,3,8823,8823,0},{0,3,8825,8825,0},
+    {0,3,8827,8827,0},{0,3,8829,8829,0},{0,3,8831,8831,0},{0,3,8833,8833,0},{0,3,6235,6235,0},{0,3,8835,8835,0},{0,3,8837,8837,0},{0,3,8839,8839,0},
+    {0,3,8841,8841,0},{0,3,8843,8843,0},{0,3,8845,8845,0},{0,3,8847,8847,0},{0,3,8849,8849,0},{0,3,8851,8851,0},{0,3,8853,8853,0},{0,3,8855,8855,0},
+    {0,3,6381,6381,0},{0,3,8857,8857,0},{0,3,8859,8859,0},{0,3,8861,8861,0},{0,3,8863,8863,0},{0,3,8865,8865,0},{0,3,8867,8867,0},{0,3,8869,8869,0},
+    {0,3,8871,8871,0},{0,3,8873,8873,0},{0,3,8875,8875,0},{0,3,8877,8877,0},{0,3,8879,8879,0},{0,3,8881,8881,0},{0,3,8883,8883,0},{0,3,8885,8885,0},
+    {0,3,8887,8887,0},{0,3,8889,8889,0},{0,3,8891,8891,0},{0,3,8893,8893,0},{0,3,8895,8895,0},{0,3,8897,8897,0},{0,3,8899,8899,0},{0,3,8901,8901,0},
+    {0,3,8903,8903,0},{0,3,8905,8905,0},{0,3,8907,8907,0},{0,3,8909,8909,0},{0,3,8911,8911,0},{0,3,8913,8913,0},{0,3,8915,8915,0},{0,3,8917,8917,0},
+    {0,3,8919,8919,0},{0,3,8921,8921,0},{0,3,8923,8923,0},{0,3,8925,8925,0},{0,3,8927,8927,0},{0,3,8929,8929,0},{0,3,8931,8931,0},{0,3,8933,8933,0},
+    {0,3,8935,8935,0},{0,3,8937,8937,0},{0,3,8939,8939,0},{0,3,8941,8941,0},{0,3,8943,8943,0},{0,3,8945,8945,0},{0,3,8947,8947,0},{0,3,8949,8949,0},
+    {0,3,6307,6307,0},{0,3,8951,8951,0},{0,3,8953,8953,0},{0,3,8955,8955,0},{0,3,8957,8957,0},{0,3,8959,8959,0},{0,3,8961,8961,0},{0,3,8963,8963,0},
+    {0,3,8965,8965,0},{0,3,8967,8967,0},{0,3,8969,8969,0},{0,3,8971,8971,0},{0,3,8973,8973,0},{0,3,8975,8975,0},{0,3,8977,8977,0},{0,3,8979,8979,0},
+    {0,3,6061,6061,0},{0,3,8981,8981,0},{0,3,8983,8983,0},{0,3,8985,8985,0},{0,3,8987,8987,0},{0,3,8989,8989,0},{0,3,8991,8991,0},{0,3,8993,8993,0},
+    {0,3,8995,8995,0},{0,3,6023,6023,0},{0,3,8997,8997,0},{0,3,8999,8999,0},{0,3,9001,9001,0},{0,3,9003,9003,0},{0,3,9005,9005,0},{0,3,9007,9007,0},
+    {0,3,9009,9009,0},{0,3,9011,9011,0},{0,3,9013,9013,0},{0,3,9015,9015,0},{0,3,9017,9017,0},{0,3,9019,9019,0},{0,3,9021,9021,0},{0,3,9023,9023,0},
+    {0,3,9025,9025,0},{0,3,9027,9027,0},{0,3,9029,9029,0},{0,3,9031,9031,0},{0,3,9033,9033,0},{0,3,9035,9035,0},{0,3,9037,9037,0},{0,3,9039,9039,0},
+    {0,3,9041,9041,0},{0,3,9043,9043,0},{0,3,9045,9045,0},{0,3,9047,9047,0},{0,3,9049,9049,0},{0,3,9051,9051,0},{0,3,9053,9053,0},{0,3,9055,9055,0},
+    {0,3,9057,9057,0},{0,3,9059,9059,0},{0,3,9061,9061,0},{0,3,9063,9063,0},{0,3,9065,9065,0},{0,3,9067,9067,0},{0,3,9069,9069,0},{0,3,9071,9071,0},
+    {0,3,9073,9073,0},{0,3,9075,9075,0},{0,3,9077,9077,0},{0,3,9079,9079,0},{0,3,9081,9081,0},{0,3,9083,9083,0},{0,3,9085,9085,0},{0,3,9087,9087,0},
+    {0,3,9089,9089,0},{0,3,9091,9091,0},{0,3,9093,9093,0},{0,3,9095,9095,0},{0,3,9097,9097,0},{0,3,9099,9099,0},{0,3,9101,9101,0},{0,3,9103,9103,0},
+    {0,3,6409,6409,0},{0,3,9105,9105,0},{0,3,9107,9107,0},{0,3,9109,9109,0},{0,3,9111,9111,0},{0,3,9113,9113,0},{0,3,9115,9115,0},{0,3,9117,9117,0},
+    {0,3,9119,9119,0},{0,3,9121,9121,0},{0,3,9123,9123,0},{0,3,9125,9125,0},{0,3,9127,9127,0},{0,3,7218,7218,0},{0,3,9129,9129,0},{0,3,9131,9131,0},
+    {0,3,9133,9133,0},{0,3,9135,9135,0},{0,3,9137,9137,0},{0,3,9139,9139,0},{0,3,9141,9141,0},{0,3,9143,9143,0},{0,3,9145,9145,0},{0,3,9147,9147,0},
+    {0,3,9149,9149,0},{0,3,9151,9151,0},{0,3,9153,9153,0},{0,3,9155,9155,0},{0,3,9157,9157,0},{0,3,9159,9159,0},{0,3,9161,9161,0},{0,3,9163,9163,0},
+    {0,3,9165,9165,0},{0,3,9167,9167,0},{0,3,9169,9169,0},{0,3,9171,9171,0},{0,3,6317,6317,0},{0,3,9173,9173,0},{0,3,9175,9175,0},{0,3,9177,9177,0},
+    {0,3,9179,9179,0},{0,3,9181,9181,0},{0,3,9183,9183,0},{0,3,9185,9185,0},{0,3,9187,9187,0},{0,3,9189,9189,0},{0,3,9191,9191,0},{0,3,9193,9193,0},
+    {0,3,9195,9195,0},{0,3,9197,9197,0},{0,3,6219,6219,0},{0,3,9199,9199,0},{0,3,9201,9201,0},{0,3,9203,9203,0},{0,3,9205,9205,0},{0,3,9207,9207,0},
+    {0,3,9209,9209,0},{0,3,9211,9211,0},{0,3,9213,9213,0},{0,3,9215,9215,0},{0,3,9217,9217,0},{0,3,9219,9219,0},{0,3,9221,9221,0},{0,3,9223,9223,0},
+    {0,3,9225,9225,0},{0,3,9227,9227,0},{0,3,9229,9229,0},{0,3,6273,6273,0},{0,3,9231,9231,0},{0,3,6279,6279,0},{0,3,9233,9233,0},{0,3,9235,9235,0},
+    {0,3,9237,9237,0},{0,3,9239,9239,0},{0,3,9241,9241,0},{0,3,9243,9243,0},{0,3,9245,9245,0},{0,3,9247,9247,0},{0,3,9249,9249,0},{0,3,9251,9251,0},
+    {0,3,9253,9253,0},{0,3,9255,9255,0},{0,3,9257,9257,0},{0,3,9259,9259,0},{0,3,6233,6233,0},{0,3,9261,9261,0},{0,3,9263,9263,0},{0,3,9265,9265,0},
+    {0,3,9267,9267,0},{0,3,9269,9269,0},{0,3,9271,9271,0},{0,3,9273,9273,0},{0,3,9275,9275,0},{0,3,9277,9277,0},{0,3,9279,9279,0},{0,3,9281,9281,0},
+    {0,3,9283,9283,0},{0,3,9285,9285,0},{0,3,9287,9287,0},{0,3,9289,9289,0},{0,3,9291,9291,0},{0,3,9293,9293,0},{0,3,9295,9295,0},{0,3,9297,9297,0},
+    {0,3,9299,9299,0},{0,3,9301,9301,0},{0,3,9303,9303,0},{0,3,6075,6075,0},{0,3,9305,9305,0},{0,3,9307,9307,0},{0,3,9309,9309,0},{0,3,9311,9311,0},
+    {0,3,9313,9313,0},{0,3,9315,9315,0},{0,3,9317,9317,0},{0,3,9319,9319,0},{0,3,9321,9321,0},{0,3,9323,9323,0},{0,3,9325,9325,0},{0,3,9327,9327,0},
+    {0,3,9329,9329,0},{0,3,9331,9331,0},{0,3,9333,9333,0},{0,3,7228,7228,0},{0,3,9335,9335,0},{0,3,9337,9337,0},{0,3,9339,9339,0},{0,3,9341,9341,0},
+    {0,3,7236,7236,0},{0,3,9343,9343,0},{0,3,9345,9345,0},{0,3,9347,9347,0},{0,3,9349,9349,0},{0,3,9351,9351,0},{0,3,9353,9353,0},{0,3,9355,9355,0},
+    {0,3,9357,9357,0},{0,3,9359,9359,0},{0,3,9361,9361,0},{0,3,9363,9363,0},{0,3,9365,9365,0},{0,3,9367,9367,0},{0,3,9369,9369,0},{0,3,9371,9371,0},
+    {0,3,9373,9373,0},{0,3,9375,9375,0},{0,3,9377,9377,0},{0,3,9379,9379,0},{0,3,9381,9381,0},{0,3,9383,9383,0},{0,3,9385,9385,0},{0,3,9387,9387,0},
+    {0,3,9389,9389,0},{0,3,9391,9391,0},{0,3,9393,9393,0},{0,3,9395,9395,0},{0,3,9397,9397,0},{0,3,9399,9399,0},{0,3,9401,9401,0},{0,3,9403,9403,0},
+    {0,3,9405,9405,0},{0,3,9407,9407,0},{0,3,9409,9409,0},{0,3,9411,9411,0},{0,3,9413,9413,0},{0,3,9415,9415,0},{0,3,9417,9417,0},{0,3,9419,9419,0},
+    {0,3,9421,9421,0},{0,3,9423,9423,0},{0,3,9425,9425,0},{0,3,9427,9427,0},{0,3,9429,9429,0},{0,3,9431,9431,0},{0,3,9433,9433,0},{0,3,9435,9435,0},
+    {0,3,9437,9437,0},{0,3,9439,9439,0},{0,3,9441,9441,0},{0,3,9443,9443,0},{0,3,9445,9445,0},{0,3,9447,9447,0},{0,3,9449,9449,0},{0,3,9451,9451,0},
+    {0,3,9453,9453,0},{0,3,6141,6141,0},{0,3,9455,9455,0},{0,3,9457,9457,0},{0,3,9459,9459,0},{0,3,9461,9461,0},{0,3,9463,9463,0},{0,3,9465,9465,0},
+    {0,3,9467,9467,0},{0,3,9469,9469,0},{0,3,9471,9471,0},{0,3,9473,9473,0},{0,3,9475,9475,0},{0,3,9477,9477,0},{0,3,9479,9479,0},{0,3,9481,9481,0},
+    {0,3,9483,9483,0},{0,3,9485,9485,0},{0,3,9487,9487,0},{0,3,9489,9489,0},{0,3,9491,9491,0},{0,3,9493,9493,0},{0,3,9495,9495,0},{0,3,9497,9497,0},
+    {0,3,9499,9499,0},{0,3,9501,9501,0},{0,3,9503,9503,0},{0,3,9505,9505,0},{0,3,9507,9507,0},{0,3,9509,9509,0},{0,3,9511,9511,0},{0,3,9513,9513,0},
+    {0,3,9515,9515,0},{0,3,9517,9517,0},{0,3,9519,9519,0},{0,3,9521,9521,0},{0,3,9523,9523,0},{0,3,9525,9525,0},{0,3,9527,9527,0},{0,3,9529,9529,0},
+    {0,3,9531,9531,0},{0,3,9533,9533,0},{0,3,9535,9535,0},{0,3,9537,9537,0},{0,3,9539,9539,0},{0,3,9541,9541,0},{0,3,9543,9543,0},{0,3,9545,9545,0},
+    {0,3,9547,9547,0},{0,3,9549,9549,0},{0,2,0,9551,0},{0,2,0,9554,0},{0,2,0,9557,0},{0,2,0,9560,0},{0,2,0,9564,0},{0,2,0,9568,0},
+    {0,2,0,9571,0},{0,2,0,9574,0},{0,2,0,9577,0},{0,2,0,9580,0},{0,2,0,9583,0},{0,3,9586,9586,0},{26,0,0,0,0},{0,3,9589,9589,0},
+    {0,2,0,9592,0},{0,2,0,9594,0},{0,2,0,9596,0},{0,2,0,9598,0},{0,2,0,9600,0},{0,2,0,9602,0},{0,2,0,9604,0},{0,3,9606,9606,0},
+    {0,3,9609,9609,0},{0,3,9612,9612,0},{0,3,9616,9616,0},{0,3,9620,9620,0},{0,3,9623,9623,0},{0,3,9626,9626,0},{0,3,9629,9629,0},{0,3,9632,9632,0},
+    {0,3,9635,9635,0},{0,3,9638,9638,0},{0,3,9641,9641,0},{0,3,9644,9644,0},{0,3,9647,9647,0},{0,3,9650,9650,0},{0,3,9653,9653,0},{0,3,9656,9656,0},
+    {0,3,9659,9659,0},{0,3,9662,9662,0},{0,3,9665,9665,0},{0,3,9668,9668,0},{0,3,9671,9671,0},{0,3,9674,9674,0},{0,3,9677,9677,0},{0,3,9680,9680,0},
+    {0,3,9683,9683,0},{0,3,9686,9686,0},{0,3,9689,9689,0},{0,3,9692,9692,0},{0,3,9695,9695,0},{0,3,9698,9698,0},{0,3,9701,9701,0},{0,2,0,9704,0},
+    {0,2,0,9707,0},{0,2,0,9709,0},{0,2,0,9711,0},{0,2,0,9713,0},{0,2,0,9715,0},{0,2,0,9717,0},{0,2,0,9719,0},{0,2,0,9721,0},
+    {0,2,0,9723,0},{0,2,0,9725,0},{0,2,0,9727,0},{0,2,0,9729,0},{0,2,0,9731,0},{0,2,0,9733,0},{0,2,0,9735,0},{0,2,0,9737,0},
+    {0,2,0,9739,0},{0,2,0,9741,0},{0,2,0,9743,0},{0,2,0,9745,0},{0,2,0,9747,0},{0,2,0,9749,0},{0,2,0,9751,0},{0,2,0,9753,0},
+    {0,2,0,9755,0},{0,2,0,2109,0},{0,2,0,9757,0},{0,2,0,9759,0},{0,2,0,9761,0},{0,2,0,2115,0},{0,2,0,9763,0},{0,2,0,9765,0},
+    {0,2,0,9767,0},{0,2,0,9769,0},{0,2,0,9771,0},{0,2,0,9773,0},{0,2,0,9775,0},{0,2,0,9777,0},{0,2,0,9779,0},{0,2,0,9781,0},
+    {0,2,0,9785,0},{0,2,0,9789,0},{0,2,0,9793,0},{0,2,0,9797,0},{0,2,0,9801,0},{0,2,0,9805,0},{0,2,0,9809,0},{0,2,0,9813,0},
+    {0,2,0,9815,0},{0,2,0,9819,0},{0,2,0,9823,0},{0,2,0,9827,0},{0,2,0,9831,0},{0,2,0,9834,0},{0,2,0,9837,0},{0,2,0,9840,0},
+    {0,2,0,9843,0},{0,2,0,9846,0},{0,2,0,9849,0},{0,2,0,9852,0},{0,2,0,9855,0},{0,2,0,9858,0},{0,2,0,9861,0},{0,2,0,9864,0},
+    {0,2,0,9867,0},{0,2,0,9870,0},{0,2,0,9873,0},{0,2,0,9876,0},{0,2,0,9879,0},{0,2,0,9882,0},{0,2,0,9885,0},{0,2,0,9888,0},
+    {0,2,0,9891,0},{0,2,0,9894,0},{0,2,0,9897,0},{0,2,0,9900,0},{0,2,0,9903,0},{0,2,0,9906,0},{0,2,0,9909,0},{0,2,0,9912,0},
+    {0,2,0,9915,0},{0,2,0,9918,0},{0,2,0,9921,0},{0,2,0,9924,0},{0,2,0,9927,0},{0,2,0,9930,0},{0,2,0,9933,0},{0,2,0,9936,0},
+    {0,2,0,9939,0},{0,2,0,9942,0},{0,2,0,9945,0},{0,2,0,9948,0},{0,2,0,9951,0},{0,2,0,9954,0},{0,2,0,9957,0},{0,2,0,9960,0},
+    {0,2,0,9963,0},{0,2,0,9966,0},{0,2,0,9969,0},{0,2,0,9972,0},{0,2,0,9975,0},{0,2,0,9978,0},{0,2,0,9981,0},{0,2,0,9984,0},
+    {0,2,0,9987,0},{0,2,0,9990,0},{0,2,0,9993,0},{0,2,0,9996,0},{0,2,0,9999,0},{0,2,0,10002,0},{0,2,0,10005,0},{0,2,0,10008,0},
+    {0,2,0,10011,0},{0,2,0,10014,0},{0,2,0,10017,0},{0,2,0,10020,0},{0,2,0,10023,0},{0,2,0,10026,0},{0,2,0,10029,0},{0,2,0,10032,0},
+    {0,2,0,10035,0},{0,2,0,10038,0},{0,2,0,10041,0},{0,2,0,10044,0},{0,2,0,10047,0},{0,2,0,10050,0},{0,2,0,10053,0},{0,2,0,10056,0},
+    {0,2,0,10059,0},{0,2,0,10062,0},{0,2,0,10065,0},{0,2,0,10068,0},{0,2,0,10071,0},{0,2,0,10074,0},{0,2,0,10077,0},{0,2,0,10080,0},
+    {0,2,0,10083,0},{0,2,0,10086,0},{0,2,0,10089,0},{0,2,0,10092,0},{0,2,0,10095,0},{0,2,0,10098,0},{0,2,0,10102,0},{0,2,0,10106,0},
+    {0,2,0,10110,0},{0,2,0,10114,0},{0,2,0,10118,0},{0,2,0,10122,0},{0,2,0,10126,0},{0,2,0,10130,0},{0,2,0,10134,0},{0,2,0,10137,0},
+    {0,2,0,10140,0},{0,2,0,10143,0},{0,2,0,10146,0},{0,2,0,10149,0},{0,2,0,10152,0},{0,2,0,10155,0},{0,2,0,10158,0},{0,2,0,10161,0},
+    {0,2,0,10164,0},{0,2,0,10167,0},{0,2,0,10170,0},{0,2,0,10173,0},{0,2,0,10176,0},{0,2,0,10179,0},{0,2,0,10182,0},{0,2,0,10186,0},
+    {0,2,0,10190,0},{0,2,0,10193,0},{0,2,0,10196,0},{0,2,0,10199,0},{0,2,0,10202,0},{0,2,0,10205,0},{0,2,0,10208,0},{0,2,0,10211,0},
+    {0,2,0,10214,0},{0,2,0,10217,0},{0,2,0,10220,0},{0,2,0,10223,0},{0,2,0,10227,0},{0,2,0,10231,0},{0,2,0,10235,0},{0,2,0,10238,0},
+    {0,2,0,10241,0},{0,2,0,10244,0},{0,2,0,10247,0},{0,2,0,10250,0},{0,2,0,10253,0},{0,2,0,10256,0},{0,2,0,10259,0},{0,2,0,10262,0},
+    {0,2,0,10265,0},{0,2,0,10268,0},{0,2,0,10271,0},{0,2,0,10274,0},{0,2,0,10277,0},{0,2,0,10280,0},{0,2,0,10283,0},{0,2,0,10286,0},
+    {0,2,0,10289,0},{0,2,0,10292,0},{0,2,0,10295,0},{0,2,0,10298,0},{0,2,0,10301,0},{0,2,0,10304,0},{0,2,0,10307,0},{0,2,0,10310,0},
+    {0,2,0,10313,0},{0,2,0,10316,0},{0,2,0,10319,0},{0,2,0,10323,0},{0,2,0,10327,0},{0,2,0,10331,0},{0,2,0,10335,0},{0,2,0,10339,0},
+    {0,2,0,10343,0},{0,2,0,10347,0},{0,2,0,10351,0},{0,2,0,10355,0},{0,2,0,10359,0},{0,2,0,10363,0},{0,2,0,10367,0},{0,2,0,10371,0},
+    {0,2,0,10375,0},{0,2,0,10379,0},{0,2,0,10383,0},{0,2,0,10387,0},{0,2,0,10391,0},{0,2,0,10395,0},{0,2,0,10399,0},{0,2,0,10403,0},
+    {0,2,0,10407,0},{0,2,0,10411,0},{0,2,0,10415,0},{0,2,0,10419,0},{0,2,0,10423,0},{0,2,0,10427,0},{0,2,0,10431,0},{0,2,0,10435,0},
+    {0,2,0,10439,0},{0,2,0,10443,0},{0,2,0,10447,0},{0,2,0,10451,0},{0,2,0,10455,0},{0,2,0,10459,0},{0,2,0,10463,0},{0,2,0,10467,0},
+    {0,2,0,10471,0},{0,2,0,10475,0},{0,2,0,10479,0},{0,2,0,10483,0},{0,2,0,10487,0},{0,2,0,10491,0},{0,2,0,10495,0},{0,2,0,10499,0},
+    {0,2,0,10503,0},{0,2,0,10507,0},{0,2,0,10511,0},{0,2,0,10515,0},{0,2,0,10519,0},{0,2,0,10523,0},{0,2,0,10527,0},{0,2,0,10531,0},
+    {0,2,0,10535,0},{0,2,0,10539,0},{0,2,0,10543,0},{0,2,0,10547,0},{0,2,0,10551,0},{0,2,0,10555,0},{0,2,0,10559,0},{0,2,0,10563,0},
+    {0,2,0,10567,0},{0,2,0,10571,0},{0,2,0,10575,0},{0,2,0,10579,0},{0,2,0,10583,0},{0,2,0,10587,0},{0,2,0,10591,0},{0,2,0,10595,0},
+    {0,2,0,10599,0},{0,2,0,10603,0},{0,2,0,10607,0},{0,2,0,10611,0},{0,2,0,10615,0},{0,2,0,10619,0},{0,2,0,10623,0},{0,2,0,10627,0},
+    {0,2,0,10631,0},{0,2,0,10635,0},{0,2,0,10639,0},{0,2,0,10643,0},{0,2,0,10647,0},{0,2,0,10651,0},{0,2,0,10655,0},{0,2,0,10659,0},
+    {0,2,0,10663,0},{0,2,0,10667,0},{0,2,0,10671,0},{0,2,0,10675,0},{0,2,0,10679,0},{0,2,0,10683,0},{0,2,0,10687,0},{0,2,0,10691,0},
+    {0,2,0,10695,0},{0,2,0,10699,0},{0,2,0,10703,0},{0,2,0,10708,0},{0,2,0,10713,0},{0,2,0,10718,0},{0,2,0,10723,0},{0,2,0,10728,0},
+    {0,2,0,10733,0},{0,2,0,10738,0},{0,2,0,10742,0},{0,2,0,10761,0},{0,2,0,10770,0},{0,2,0,10775,0},{0,2,0,10777,0},{0,2,0,10779,0},
+    {0,2,0,10781,0},{0,2,0,1360,0},{0,2,0,10783,0},{0,2,0,10785,0},{0,2,0,10787,0},{0,2,0,10789,0},{0,2,0,10791,0},{0,2,0,10793,0},
+    {0,2,0,10795,0},{0,2,0,10797,0},{0,2,0,10799,0},{0,2,0,10801,0},{0,2,0,10803,0},{0,2,0,10805,0},{0,2,0,10807,0},{0,2,0,10809,0},
+    {0,2,0,10811,0},{0,2,0,5379,0},{0,2,0,5381,0},{0,2,0,10813,0},{0,2,0,10815,0},{0,2,0,10817,0},{0,2,0,10819,0},{0,2,0,10821,0},
+    {0,2,0,10823,0},{0,2,0,10825,0},{0,2,0,10827,0},{0,2,0,10829,0},{0,2,0,10831,0},{0,2,0,10833,0},{0,2,0,10835,0},{0,2,0,10837,0},
+    {0,2,0,10839,0},{0,2,0,10841,0},{0,2,0,10843,0},{0,2,0,10845,0},{0,2,0,10848,0},{0,2,0,10851,0},{0,2,0,10854,0},{0,2,0,10857,0},
+    {0,2,0,10860,0},{0,2,0,10863,0},{0,2,0,10866,0},{0,2,0,10869,0},{0,2,0,10872,0},{0,2,0,10875,0},{0,2,0,10878,0},{0,2,0,10881,0},
+    {0,2,0,10884,0},{0,2,0,10887,0},{0,2,0,2082,0},{0,2,0,2085,0},{0,2,0,2088,0},{0,2,0,2091,0},{0,2,0,2094,0},{0,2,0,10889,0},
+    {0,2,0,10891,0},{0,2,0,10893,0},{0,2,0,10895,0},{0,2,0,10897,0},{0,2,0,10899,0},{0,2,0,10901,0},{0,2,0,10903,0},{0,2,0,10905,0},
+    {0,2,0,10907,0},{0,2,0,10909,0},{0,2,0,10911,0},{0,2,0,10913,0},{0,2,0,10915,0},{0,2,0,10917,0},{0,2,0,10919,0},{0,2,0,10921,0},
+    {0,2,0,10923,0},{0,2,0,10925,0},{0,2,0,10927,0},{0,2,0,10929,0},{0,2,0,10931,0},{0,2,0,10933,0},{0,2,0,10935,0},{0,2,0,10937,0},
+    {0,2,0,10939,0},{0,2,0,10941,0},{0,2,0,10943,0},{0,2,0,10945,0},{0,2,0,10947,0},{0,2,0,10951,0},{0,2,0,10955,0},{0,2,0,10959,0},
+    {0,2,0,10962,0},{0,2,0,10964,0},{0,2,0,10966,0},{0,2,0,2705,10968},{0,2,0,2709,10970},{0,2,0,5004,10972},{0,2,0,2711,10974},{0,2,0,2713,10976},
+    {0,2,0,5041,10978},{0,2,0,2717,10980},{0,2,0,2719,10982},{0,2,0,2721,10984},{0,2,0,2723,10986},{0,2,0,2725,10988},{0,2,0,2727,10990},{0,2,0,2729,10992},
+    {0,2,0,2731,10994},{0,2,0,2733,10996},{0,2,0,2737,10998},{0,2,0,5025,11000},{0,2,0,2739,11002},{0,2,0,5718,11004},{0,2,0,2741,11006},{0,2,0,2743,11008},
+    {0,2,0,5145,11010},{0,2,0,2745,11012},{0,2,0,5172,11014},{0,2,0,5732,11016},{0,2,0,5037,11018},{0,2,0,11020,0},{0,2,0,4873,0},{0,2,0,11022,0},
+    {0,2,0,11024,0},{0,2,0,11026,0},{0,2,0,11028,0},{0,2,0,11030,0},{0,2,0,11032,0},{0,2,0,11034,0},{0,2,0,11036,0},{0,2,0,11038,0},
+    {0,2,0,11040,0},{0,2,0,11042,0},{0,2,0,11044,0},{0,2,0,11046,0},{0,2,0,11048,0},{0,2,0,11050,0},{0,2,0,11052,0},{0,2,0,11054,0},
+    {0,2,0,11056,0},{0,2,0,11058,0},{0,2,0,11060,0},{0,2,0,11062,0},{0,2,0,11064,0},{0,2,0,11066,0},{0,2,0,11068,0},{0,2,0,11070,0},
+    {0,2,0,11072,0},{0,2,0,11074,0},{0,2,0,11076,0},{0,2,0,11078,0},{0,2,0,11080,0},{0,2,0,11082,0},{0,0,0,0,11084},{0,0,0,0,11086},
+    {0,0,0,0,11088},{0,0,0,0,11090},{0,0,0,0,11092},{0,0,0,0,11094},{0,0,0,0,11096},{0,0,0,0,11098},{0,0,0,0,11100},{0,0,0,0,11102},
+    {0,0,0,0,11104},{0,0,0,0,11106},{0,0,0,0,11108},{0,0,0,0,11110},{0,0,0,0,11112},{0,0,0,0,11114},{0,0,0,0,11116},{0,0,0,0,11118},
+    {0,0,0,0,11120},{0,0,0,0,11122},{0,0,0,0,11124},{0,0,0,0,11126},{0,0,0,0,11128},{0,0,0,0,11130},{0,0,0,0,11132},{0,0,0,0,11134},
+    {0,0,0,0,11136},{0,0,0,0,11138},{0,0,0,0,11140},{0,0,0,0,11142},{0,0,0,0,11144},{0,0,0,0,11146},{0,0,0,0,11148},{0,0,0,0,11150},
+    {0,0,0,0,11152},{0,0,0,0,11154},{0,0,0,0,11156},{0,0,0,0,11158},{0,0,0,0,11160},{0,0,0,0,11162},{0,0,0,0,11164},{0,0,0,0,11166},
+    {0,0,0,0,11168},{0,0,0,0,11170},{0,0,0,0,11172},{0,0,0,0,11174},{0,0,0,0,11176},{0,0,0,0,11178},{0,0,0,0,11180},{0,0,0,0,11182},
+    {0,0,0,0,11184},{0,0,0,0,11186},{0,0,0,0,11188},{0,0,0,0,11190},{0,0,0,0,11192},{0,0,0,0,11194},{0,0,0,0,11196},{0,0,0,0,11198},
+    {0,0,0,0,11200},{0,0,0,0,11202},{0,0,0,0,11204},{0,0,0,0,11206},{0,0,0,0,11208},{0,0,0,0,11210},{0,0,0,0,11212},{0,0,0,0,11214},
+    {0,0,0,0,11216},{0,0,0,0,11218},{0,0,0,0,11220},{0,0,0,0,11222},{0,0,0,0,11224},{0,0,0,0,11226},{0,0,0,0,11228},{0,0,0,0,11230},
+    {0,0,0,0,11232},{0,0,0,0,11234},{0,0,0,0,11236},{0,0,0,0,11238},{0,0,0,0,11240},{0,0,0,0,11242},{0,0,0,0,11244},{0,0,0,0,11246},
+    {0,0,0,0,11248},{0,0,0,0,11250},{0,0,0,0,11252},{0,0,0,0,11254},{0,0,0,0,11256},{0,0,0,0,11258},{0,0,0,0,11260},{0,0,0,0,11262},
+    {0,0,0,0,11264},{0,0,0,0,11266},{0,0,0,0,11268},{0,0,0,0,11270},{0,0,0,0,11272},{0,0,0,0,11274},{0,0,0,0,11276},{0,0,0,0,11278},
+    {0,0,0,0,11280},{0,0,0,0,11282},{0,0,0,0,11284},{0,0,0,0,11286},{0,0,0,0,11288},{0,0,0,0,11290},{0,0,0,0,11292},{0,0,0,0,11294},
+    {0,0,0,0,11296},{0,0,0,0,11298},{0,0,0,0,11300},{0,0,0,0,11302},{0,0,0,0,11304},{0,2,0,11306,0},{0,2,0,11308,0},{0,2,0,117,0},
+    {0,2,0,11310,0},{0,2,0,772,0},{0,2,0,11312,0},{0,2,0,11314,0},{0,2,0,11316,0},{0,2,0,11318,0},{0,2,0,782,0},{0,2,0,784,0},
+    {0,2,0,11320,0},{0,2,0,11322,0},{0,2,0,11324,0},{0,2,0,11326,0},{0,2,0,11328,0},{0,2,0,11330,0},{0,2,0,796,0},{0,2,0,11332,0},
+    {0,2,0,11334,0},{0,2,0,11336,0},{0,2,0,11338,0},{0,2,0,11340,0},{0,2,0,11342,0},{0,2,0,8691,0},{0,2,0,11344,0},{0,2,0,11346,0},
+    {0,2,0,11348,0},{0,2,0,11350,0},{0,2,0,11352,0},{0,2,0,11354,0},{0,2,0,196,0},{0,2,0,11356,0},{0,2,0,11358,0},{0,2,0,11360,0},
+    {0,2,0,11362,0},{0,2,0,5859,0},{0,2,0,11364,0},{0,2,0,824,0},{0,2,0,11366,0},{0,2,0,11368,0},{0,2,0,11370,0},{0,2,0,11372,0},
+    {0,2,0,832,0},{0,2,0,11374,0},{0,2,0,11376,0},{0,2,0,11378,0},{0,2,0,11380,0},{0,2,0,11382,0},{0,2,0,11384,0},{0,2,0,11386,0},
+    {0,2,0,11388,0},{0,2,0,11390,0},{0,2,0,11392,0},{0,0,0,0,11394},{0,0,0,0,11396},{0,0,0,0,11398},{0,0,0,0,11400},{0,0,0,0,11402},
+    {0,0,0,0,11404},{0,0,0,0,11406},{0,0,0,0,11408},{0,0,0,0,11410},{0,0,0,0,11412},{0,0,0,0,11414},{0,0,0,0,11416},{0,0,0,0,11418},
+    {0,0,0,0,11420},{0,0,0,0,11422},{0,0,0,0,11424},{0,0,0,0,11426},{0,0,0,0,11428},{0,0,0,0,11430},{0,0,0,0,11432},{0,0,0,0,11434},
+    {0,0,0,0,11436},{0,0,0,0,11438},{0,0,0,0,11440},{0,0,0,0,11442},{0,0,0,0,11444},{0,0,0,0,11446},{0,0,0,0,11448},{0,0,0,0,11450},
+    {0,0,0,0,11452},{0,0,0,0,11454},{0,0,0,0,11456},{0,0,0,0,11458},{0,0,0,0,11460},{0,0,0,0,11462},{0,0,0,0,11464},{0,0,0,0,11466},
+    {0,0,0,0,11468},{0,0,0,0,11470},{0,0,0,0,11472},{0,0,0,0,11474},{0,0,0,0,11476},{0,0,0,0,11478},{0,0,0,0,11480},{0,0,0,0,11482},
+    {0,0,0,0,11484},{0,0,0,0,11486},{0,0,0,0,11488},{0,0,0,0,11490},{0,0,0,0,11492},{0,0,0,0,11494},{0,0,11496,11496,0},{0,0,11499,11499,0},
+    {0,0,11502,11502,0},{0,0,11505,11505,0},{0,0,11508,11508,0},{0,0,11511,11511,0},{0,0,11514,11514,0},{0,0,11517,11517,0},{0,0,11520,11520,0},{0,0,11523,11523,0},
+    {0,0,11526,11526,0},{0,0,11529,11529,0},{0,0,0,0,11532},{0,0,0,0,11534},{0,0,0,0,11536},{0,0,0,0,11538},{0,0,0,0,11540},{0,0,0,0,11542},
+    {0,0,0,0,11544},{0,0,0,0,11546},{0,0,0,0,11548},{0,0,0,0,11550},{0,0,0,0,11552},{0,0,0,0,11554},{0,0,0,0,11556},{0,0,0,0,11558},
+    {0,0,0,0,11560},{0,0,0,0,11562},{0,0,0,0,11564},{0,0,0,0,11566},{0,0,0,0,11568},{0,0,0,0,11570},{0,0,0,0,11572},{0,0,0,0,11574},
+    {0,0,0,0,11576},{0,0,0,0,11578},{0,0,0,0,11580},{0,0,0,0,11582},{0,0,0,0,11584},{0,0,0,0,11586},{0,0,0,0,11588},{0,0,0,0,11590},
+    {0,0,0,0,11592},{0,0,0,0,11594},{0,0,11596,11596,0},{0,0,0,0,11599},{0,0,0,0,11601},{0,0,0,0,11603},{0,0,0,0,11605},{0,0,0,0,11607},
+    {0,0,0,0,11609},{0,0,0,0,11611},{0,0,0,0,11613},{0,0,0,0,11615},{0,0,0,0,11617},{0,0,0,0,11619},{0,0,0,0,11621},{0,0,0,0,11623},
+    {0,0,0,0,11625},{0,0,0,0,11627},{0,0,0,0,11629},{0,0,0,0,11631},{0,0,0,0,11633},{0,0,0,0,11635},{0,0,0,0,11637},{0,0,0,0,11639},
+    {0,0,0,0,11641},{0,0,0,0,11643},{0,0,0,0,11645},{0,0,0,0,11647},{0,0,0,0,11649},{0,0,0,0,11651},{0,0,0,0,11653},{0,0,0,0,11655},
+    {0,0,0,0,11657},{0,0,0,0,11659},{0,0,0,0,11661},{6,0,0,0,0},{0,3,11663,11663,0},{0,3,11666,11666,0},{0,3,11669,11669,0},{0,3,11673,11673,0},
+    {0,3,11677,11677,0},{0,3,11681,11681,0},{0,3,11685,11685,0},{226,0,0,0,0},{0,3,11689,11689,0},{0,3,11692,11692,0},{0,3,11695,11695,0},{0,3,11699,11699,0},
+    {0,3,11703,11703,0},{0,3,11707,11707,0},{0,2,0,5718,0},{0,2,0,5172,0},{0,2,0,5732,0},{0,2,0,11711,0},{0,2,0,11713,0},{0,2,0,11715,0},
+    {0,2,0,11717,0},{0,2,0,11719,0},{0,2,0,11721,0},{0,2,0,11723,0},{0,2,0,11725,0},{0,2,0,1535,0},{0,2,0,11727,0},{0,2,0,11729,0},
+    {0,2,0,11731,0},{0,2,0,11733,0},{0,2,0,11735,0},{0,2,0,11737,0},{0,2,0,11739,0},{0,2,0,11741,0},{0,2,0,1539,0},{0,2,0,11743,0},
+    {0,2,0,11745,0},{0,2,0,11747,0},{0,2,0,11749,0},{0,2,0,5039,0},{0,2,0,11751,0},{0,2,0,1412,0},{0,2,0,1422,0},{0,2,0,1424,0},
+    {0,2,0,1428,0},{0,2,0,1432,0},{0,2,0,1434,0},{0,2,0,1436,0},{0,2,0,1438,0},{0,2,0,1444,0},{0,2,0,1446,0},{0,2,0,1448,0},
+    {0,2,0,1454,0},{0,2,0,1456,0},{0,2,0,11753,0},{0,2,0,11755,0},{0,2,0,1513,0},{0,0,0,0,11757},{0,0,0,0,11759},{0,0,0,0,11761},
+    {0,0,0,0,11763},{0,0,0,0,11765},{0,0,0,0,11767},{0,0,0,0,11769},{0,0,0,0,11771},{0,0,0,0,11773},{0,0,0,0,11775},{0,0,0,0,11777},
+    {0,0,0,0,11779},{0,0,0,0,11781},{0,0,0,0,11783},{0,0,0,0,11785},{0,0,0,0,11787},{0,0,0,0,11789},{0,0,0,0,11791},{0,0,0,0,11793},
+    {0,0,0,0,11795},{0,0,0,0,11797},{0,0,0,0,11799},{0,0,0,0,11801},{0,0,0,0,11803},{0,0,0,0,11805},{0,0,0,0,11807},{0,0,0,0,11809},
+    {0,0,0,0,11811},{0,0,0,0,11813},{0,0,0,0,11815},{0,0,0,0,11817},{0,0,0,0,11819},{0,0,0,0,11821},{0,0,0,0,11823},{0,2,0,11825,0},
+    {0,2,0,11827,0},{0,2,0,11829,0},{0,2,0,11831,0},{0,2,0,11834,0},{0,2,0,11837,0},{0,2,0,11840,0},{0,2,0,11843,0},{0,2,0,11846,0},
+    {0,2,0,11849,0},{0,2,0,11852,0},{0,2,0,11855,0},{0,2,0,11858,0},{0,2,0,11861,0},{0,2,0,11864,0},{0,2,0,11868,0},{0,2,0,11872,0},
+    {0,2,0,11876,0},{0,2,0,11880,0},{0,2,0,11884,0},{0,2,0,11888,0},{0,2,0,11892,0},{0,2,0,11896,0},{0,2,0,11900,0},{0,2,0,11904,0},
+    {0,2,0,11908,0},{0,2,0,11912,0},{0,2,0,11916,0},{0,2,0,11920,0},{0,2,0,11924,0},{0,2,0,11928,0},{0,2,0,11932,0},{0,2,0,11936,0},
+    {0,2,0,11940,0},{0,2,0,11944,0},{0,2,0,11948,0},{0,2,0,11952,0},{0,2,0,11956,0},{0,2,0,11960,0},{0,2,0,11964,0},{0,2,0,11968,0},
+    {0,2,0,11972,0},{0,2,0,11975,0},{0,2,0,11978,0},{0,2,0,11981,0},{0,2,0,11984,0},{0,2,0,11987,0},{0,2,0,11991,0},{0,2,0,11994,0},
+    {0,2,0,11997,0},{0,2,0,12000,0},{0,2,0,12003,0},{0,2,0,12006,0},{0,2,0,12009,0},{0,2,0,12012,0},{0,2,0,12014,0},{0,2,0,6550,0},
+    {0,2,0,12016,0},{0,2,0,12018,0},{0,2,0,12020,0},{0,2,0,12022,0},{0,2,0,12024,0},{0,2,0,9095,0},{0,2,0,12026,0},{0,2,0,12028,0},
+    {0,2,0,12030,0},{0,2,0,12032,0},{0,2,0,12034,0},{0,2,0,12036,0},{0,2,0,12038,0},{0,2,0,12040,0},{0,2,0,12042,0},{0,2,0,12044,0},
+    {0,2,0,12046,0},{0,2,0,12048,0},{0,2,0,12050,0},{0,2,0,12052,0},{0,2,0,12054,0},{0,2,0,12056,0},{0,2,0,12058,0},{0,2,0,12060,0},
+    {0,2,0,12062,0},{0,2,0,12064,0},{0,2,0,12066,0},{0,2,0,12068,0},{0,2,0,12070,0},{0,2,0,12072,0},{0,2,0,12076,0},{0,2,0,12080,0},
+    {0,2,0,12084,0},{0,2,0,12088,0},{0,2,0,12092,0},{0,2,0,12096,0},{0,2,0,12100,0},{0,2,0,12104,0},{0,2,0,12108,0},{0,2,0,12110,0},
+    {0,3,12112,12112,0},{0,3,12114,12114,0},{0,3,12116,12116,0},{0,3,12118,12118,0},{0,3,12120,12120,0},{0,3,12122,12122,0},{0,3,12124,12124,0},{0,3,12126,12126,0},
+    {0,3,12128,12128,0},{0,3,12130,12130,0},{0,3,12132,12132,0},{0,3,12134,12134,0},{0,3,12136,12136,0},{0,3,12138,12138,0},{0,3,12140,12140,0},{0,3,12142,12142,0},
+    {0,3,12144,12144,0},{0,3,12146,12146,0},{0,3,12030,12030,0},{0,3,12148,12148,0},{0,3,12150,12150,0},{0,3,12152,12152,0},{0,3,12154,12154,0},{0,3,12156,12156,0},
+    {0,3,12158,12158,0},{0,3,6019,6019,0},{0,3,12160,12160,0},{0,3,12162,12162,0},{0,3,12164,12164,0},{0,3,12166,12166,0},{0,3,12066,12066,0},{0,3,12168,12168,0},
+    {0,3,12170,12170,0},{0,3,12172,12172,0},{0,3,12174,12174,0},{0,3,12176,12176,0},{0,3,12178,12178,0},{0,3,12180,12180,0},{0,3,12182,12182,0},{0,3,12184,12184,0},
+    {0,3,12186,12186,0},{0,3,12188,12188,0},{0,3,12190,12190,0},{0,3,12192,12192,0},{0,3,12194,12194,0},{0,3,12196,12196,0},{0,3,12198,12198,0},{0,3,12200,12200,0},
+    {0,3,12202,12202,0},{0,3,12204,12204,0},{0,3,12206,12206,0},{0,3,12208,12208,0},{0,3,12210,12210,0},{0,3,12212,12212,0},{0,3,12214,12214,0},{0,3,12216,12216,0},
+    {0,3,12218,12218,0},{0,3,12220,12220,0},{0,3,12222,12222,0},{0,3,12224,12224,0},{0,3,12226,12226,0},{0,3,12228,12228,0},{0,3,12230,12230,0},{0,3,12232,12232,0},
+    {0,3,12234,12234,0},{0,3,12236,12236,0},{0,3,12238,12238,0},{0,3,12240,12240,0},{0,3,12242,12242,0},{0,3,12244,12244,0},{0,3,12246,12246,0},{0,3,12248,12248,0},
+    {0,3,12250,12250,0},{0,3,12252,12252,0},{0,3,12254,12254,0},{0,3,12256,12256,0},{0,3,12258,12258,0},{0,3,12016,12016,0},{0,3,12260,12260,0},{0,3,12262,12262,0},
+    {0,3,12264,12264,0},{0,3,12266,12266,0},{0,3,12268,12268,0},{0,3,12270,12270,0},{0,3,12272,12272,0},{0,3,12274,12274,0},{0,3,12276,12276,0},{0,3,12278,12278,0},
+    {0,3,12280,12280,0},{0,3,12282,12282,0},{0,3,12284,12284,0},{0,3,12286,12286,0},{0,3,12288,12288,0},{0,3,12290,12290,0},{0,3,12292,12292,0},{0,3,12294,12294,0},
+    {0,3,12296,12296,0},{0,3,12298,12298,0},{0,3,12300,12300,0},{0,3,6071,6071,0},{0,3,12302,12302,0},{0,3,12304,12304,0},{0,3,12306,12306,0},{0,3,12308,12308,0},
+    {0,3,12310,12310,0},{0,3,12312,12312,0},{0,3,12314,12314,0},{0,3,12316,12316,0},{0,3,12318,12318,0},{0,3,12320,12320,0},{0,3,12322,12322,0},{0,3,12324,12324,0},
+    {0,3,12326,12326,0},{0,3,12328,12328,0},{0,3,12330,12330,0},{0,3,12332,12332,0},{0,3,12334,12334,0},{0,3,12336,12336,0},{0,3,12338,12338,0},{0,3,12340,12340,0},
+    {0,3,12342,12342,0},{0,3,12344,12344,0},{0,3,12346,12346,0},{0,3,12348,12348,0},{0,3,6095,6095,0},{0,3,12350,12350,0},{0,3,12352,12352,0},{0,3,12354,12354,0},
+    {0,3,12356,12356,0},{0,3,12358,12358,0},{0,3,12360,12360,0},{0,3,12362,12362,0},{0,3,12364,12364,0},{0,3,12366,12366,0},{0,3,12368,12368,0},{0,3,12370,12370,0},
+    {0,3,12372,12372,0},{0,3,12374,12374,0},{0,3,12376,12376,0},{0,3,12378,12378,0},{0,3,12380,12380,0},{0,3,12382,12382,0},{0,3,12384,12384,0},{0,3,12386,12386,0},
+    {0,3,12388,12388,0},{0,3,12390,12390,0},{0,3,12392,12392,0},{0,3,12394,12394,0},{0,3,12396,12396,0},{0,3,12398,12398,0},{0,3,12400,12400,0},{0,3,12402,12402,0},
+    {0,3,12404,12404,0},{0,3,12406,12406,0},{0,3,12408,12408,0},{0,3,12410,12410,0},{0,3,12412,12412,0},{0,3,12414,12414,0},{0,3,12416,12416,0},{0,3,12418,12418,0},
+    {0,3,12420,12420,0},{0,3,12422,12422,0},{0,3,12424,12424,0},{0,3,12426,12426,0},{0,3,12428,12428,0},{0,3,12430,12430,0},{0,3,12432,12432,0},{0,3,12434,12434,0},
+    {0,3,12436,12436,0},{0,3,12438,12438,0},{0,3,12440,12440,0},{0,3,12442,12442,0},{0,3,12444,12444,0},{0,3,12446,12446,0},{0,3,12448,12448,0},{0,3,12450,12450,0},
+    {0,3,12452,12452,0},{0,3,12454,12454,0},{0,3,12456,12456,0},{0,3,12458,12458,0},{0,3,12460,12460,0},{0,3,12462,12462,0},{0,3,12464,12464,0},{0,3,12466,12466,0},
+    {0,3,12468,12468,0},{0,3,12470,12470,0},{0,3,12472,12472,0},{0,3,12474,12474,0},{0,3,12476,12476,0},{0,3,12478,12478,0},{0,3,12480,12480,0},{0,3,12482,12482,0},
+    {0,3,12484,12484,0},{0,3,12486,12486,0},{0,3,12488,12488,0},{0,3,12490,12490,0},{0,3,12492,12492,0},{0,3,12494,12494,0},{0,3,12496,12496,0},{0,3,12498,12498,0},
+    {0,3,12500,12500,0},{0,3,12502,12502,0},{0,3,12504,12504,0},{0,3,12506,12506,0},{0,3,12508,12508,0},{0,3,12510,12510,0},{0,3,12512,12512,0},{0,3,12514,12514,0},
+    {0,3,12516,12516,0},{0,3,12518,12518,0},{0,3,12520,12520,0},{0,3,12522,12522,0},{0,3,12524,12524,0},{0,3,12526,12526,0},{0,3,12528,12528,0},{0,3,12530,12530,0},
+    {0,3,12532,12532,0},{0,3,12534,12534,0},{0,3,12536,12536,0},{0,3,12538,12538,0},{0,3,12540,12540,0},{0,3,12542,12542,0},{0,3,12544,12544,0},{0,3,12546,12546,0},
+    {0,3,12548,12548,0},{0,3,12550,12550,0},{0,3,12552,12552,0},{0,3,12554,12554,0},{0,3,12556,12556,0},{0,3,12558,12558,0},{0,3,12560,12560,0},{0,3,12562,12562,0},
+    {0,3,12564,12564,0},{0,3,12566,12566,0},{0,3,12568,12568,0},{0,3,12570,12570,0},{0,3,12572,12572,0},{0,3,12574,12574,0},{0,3,12576,12576,0},{0,3,12578,12578,0},
+    {0,3,12580,12580,0},{0,3,12582,12582,0},{0,3,12584,12584,0},{0,3,12586,12586,0},{0,3,12588,12588,0},{0,3,12590,12590,0},{0,3,12592,12592,0},{0,3,12594,12594,0},
+    {0,3,12596,12596,0},{0,3,12598,12598,0},{0,3,12600,12600,0},{0,3,12602,12602,0},{0,3,12604,12604,0},{0,3,12606,12606,0},{0,3,12608,12608,0},{0,3,12610,12610,0},
+    {0,3,12612,12612,0},{0,3,12614,12614,0},{0,3,12616,12616,0},{0,3,12618,12618,0},{0,3,12620,12620,0},{0,3,12622,12622,0},{0,3,12624,12624,0},{0,3,12626,12626,0},
+    {0,3,12628,12628,0},{0,3,12630,12630,0},{0,3,12632,12632,0},{0,3,12634,12634,0},{0,3,12636,12636,0},{0,3,12638,12638,0},{0,3,12640,12640,0},{0,3,12642,12642,0},
+    {0,3,12644,12644,0},{0,3,12646,12646,0},{0,3,12648,12648,0},{0,3,12650,12650,0},{0,3,12652,12652,0},{0,3,12654,12654,0},{0,3,12656,12656,0},{0,3,12658,12658,0},
+    {0,3,12660,12660,0},{0,3,12662,12662,0},{0,3,12664,12664,0},{0,3,12666,12666,0},{0,3,12668,12668,0},{0,3,12670,12670,0},{0,3,12672,12672,0},{0,3,12674,12674,0},
+    {0,3,12676,12676,0},{0,3,12678,12678,0},{0,3,12680,12680,0},{0,3,12682,12682,0},{0,3,12684,12684,0},{0,3,12686,12686,0},{0,3,12688,12688,0},{0,3,12690,12690,0},
+    {0,3,12692,12692,0},{0,3,12694,12694,0},{0,3,12696,12696,0},{0,3,12698,12698,0},{0,3,12700,12700,0},{0,3,12702,12702,0},{0,3,12704,12704,0},{0,3,12706,12706,0},
+    {0,3,12708,12708,0},{0,3,12710,12710,0},{0,3,12712,12712,0},{0,3,12714,12714,0},{0,3,12716,12716,0},{0,3,12718,12718,0},{0,3,12720,12720,0},{0,3,12722,12722,0},
+    {0,3,12724,12724,0},{0,3,12726,12726,0},{0,3,12728,12728,0},{0,3,12730,12730,0},{0,3,12732,12732,0},{0,3,12734,12734,0},{0,3,12736,12736,0},{0,3,12738,12738,0},
+    {0,3,12740,12740,0},{0,3,12742,12742,0},{0,3,12744,12744,0},{0,3,12746,12746,0},{0,3,12748,12748,0},{0,3,12750,12750,0},{0,3,12752,12752,0},{0,3,12754,12754,0},
+    {0,3,12756,12756,0},{0,3,12758,12758,0},{0,3,12760,12760,0},{0,3,12762,12762,0},{0,3,12764,12764,0},{0,3,12766,12766,0},{0,3,12768,12768,0},{0,3,12770,12770,0},
+    {0,3,12772,12772,0},{0,3,12774,12774,0},{0,3,12776,12776,0},{0,3,12778,12778,0},{0,3,12780,12780,0},{0,3,12782,12782,0},{0,3,12784,12784,0},{0,3,12786,12786,0},
+    {0,3,12788,12788,0},{0,3,12790,12790,0},{0,3,12792,12792,0},{0,3,12794,12794,0},{0,3,12796,12796,0},{0,3,12798,12798,0},{0,3,12800,12800,0},{0,3,12802,12802,0},
+    {0,3,12804,12804,0},{0,3,12806,12806,0},{0,3,12808,12808,0},{0,3,12810,12810,0},{0,3,12812,12812,0},{0,3,12814,12814,0},{0,3,12816,12816,0},{0,3,12818,12818,0},
+    {0,3,12820,12820,0},{0,3,12822,12822,0},{0,3,12824,12824,0},{0,3,12826,12826,0},{0,3,12828,12828,0},{0,3,12830,12830,0},{0,3,12832,12832,0},{0,3,12834,12834,0},
+    {0,3,12836,12836,0},{0,3,12838,12838,0},{0,3,12840,12840,0},{0,3,12842,12842,0},{0,3,12844,12844,0},{0,3,12846,12846,0},{0,3,12848,12848,0},{0,3,12850,12850,0},
+    {0,3,12852,12852,0},{0,3,12854,12854,0},{0,3,12856,12856,0},{0,3,12858,12858,0},{0,3,12860,12860,0},{0,3,12862,12862,0},{0,3,12864,12864,0},{0,3,12866,12866,0},
+    {0,3,12868,12868,0},{0,3,12870,12870,0},{0,3,12872,12872,0},{0,3,12874,12874,0},{0,3,12876,12876,0},{0,3,12878,12878,0},{0,3,12880,12880,0},{0,3,12882,12882,0},
+    {0,3,12884,12884,0},{0,3,6275,6275,0},{0,3,12886,12886,0},{0,3,12888,12888,0},{0,3,12890,12890,0},{0,3,12892,12892,0},{0,3,12894,12894,0},{0,3,12896,12896,0},
+    {0,3,12898,12898,0},{0,3,12900,12900,0},{0,3,12902,12902,0},{0,3,12904,12904,0},{0,3,12906,12906,0},{0,3,6289,6289,0},{0,3,12908,12908,0},{0,3,12910,12910,0},
+    {0,3,12912,12912,0},{0,3,12914,12914,0},{0,3,12916,12916,0},{0,3,12918,12918,0},{0,3,12920,12920,0},{0,3,12922,12922,0},{0,3,12924,12924,0},{0,3,12926,12926,0},
+    {0,3,12928,12928,0},{0,3,12930,12930,0},{0,3,12932,12932,0},{0,3,12934,12934,0},{0,3,12936,12936,0},{0,3,12938,12938,0},{0,3,12940,12940,0},{0,3,12942,12942,0},
+    {0,3,12944,12944,0},{0,3,12946,12946,0},{0,3,12948,12948,0},{0,3,12950,12950,0},{0,3,12952,12952,0},{0,3,12954,12954,0},{0,3,12956,12956,0},{0,3,12958,12958,0},
+    {0,3,12960,12960,0},{0,3,12962,12962,0},{0,3,12964,12964,0},{0,3,12966,12966,0},{0,3,12968,12968,0},{0,3,12970,12970,0},{0,3,12972,12972,0},{0,3,12974,12974,0},
+    {0,3,12976,12976,0},{0,3,12978,12978,0},{0,3,12980,12980,0},{0,3,12982,12982,0},{0,3,12984,12984,0},{0,3,12986,12986,0},{0,3,12988,12988,0},{0,3,12990,12990,0},
+    {0,3,12992,12992,0},{0,3,12994,12994,0},{0,3,12996,12996,0},{0,3,12998,12998,0},{0,3,13000,13000,0},{0,3,13002,13002,0},{0,3,13004,13004,0},{0,3,13006,13006,0},
+    {0,3,13008,13008,0},{0,3,13010,13010,0},{0,3,13012,13012,0},{0,3,13014,13014,0},{0,3,13016,13016,0},{0,3,13018,13018,0},{0,3,13020,13020,0},{0,3,13022,13022,0},
+    {0,3,13024,13024,0},{0,3,13026,13026,0},{0,3,13028,13028,0},{0,3,13030,13030,0},{0,3,6385,6385,0},{0,3,13032,13032,0},{0,3,6393,6393,0},{0,3,13034,13034,0},
+    {0,3,13036,13036,0},{0,3,13038,13038,0},{0,3,13040,13040,0},{0,3,6403,6403,0},{0,3,13042,13042,0},
+};
+
+/* 码点 >> 7 → 块号 */
+static const uint8_t bbpe_norm_stage1[1525] = {
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+    32,33,34,35,36,36,37,38,36,36,36,36,36,36,39,40,36,41,42,36,43,44,45,46,47,48,49,50,51,52,53,54,
+    55,56,57,58,59,60,61,36,62,63,36,36,36,36,36,36,36,36,36,36,64,65,36,36,66,67,68,69,36,70,71,72,
+    73,74,75,76,77,78,79,80,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,81,82,83,84,85,86,87,88,36,89,90,91,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,92,93,94,95,96,97,98,99,100,101,102,103,104,105,
+    36,36,36,106,36,107,108,36,109,110,111,112,36,36,36,113,36,36,36,36,114,115,36,36,36,116,117,36,36,118,119,120,
+    121,122,123,124,125,126,127,36,128,129,36,130,131,132,133,36,134,135,136,137,138,139,36,36,131,36,140,141,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,142,143,36,36,36,36,36,144,36,36,145,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,146,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,147,148,149,36,36,36,150,151,152,153,154,155,156,157,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    158,36,143,36,36,159,36,36,36,36,36,36,36,36,36,36,36,160,161,36,36,36,36,36,36,36,36,36,162,163,36,36,
+    36,36,164,165,166,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,167,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+    36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,168,169,170,171,172,
+};
+
+/* 每块 128 个码点 → bbpe_norm_props 下标 */
+static const uint16_t bbpe_norm_stage2[173][128] = {
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        27,0,0,0,0,0,0,0,28,0,29,0,0,0,0,30,0,0,31,32,33,34,0,0,35,36,37,0,38,39,40,0,
+        41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,0,64,65,66,67,68,69,70,0,
+        71,72,73,74,75,76,0,77,78,79,80,81,82,83,84,85,0,86,87,88,89,90,91,0,0,92,93,94,95,96,0,97},
+    {
+        98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,0,115,116,117,118,119,120,121,122,123,124,125,126,127,128,
+        129,130,131,132,133,134,135,0,136,137,138,139,140,141,142,143,144,0,145,146,147,148,149,150,0,151,152,153,154,155,156,157,
+        158,159,0,160,161,162,163,164,165,166,167,0,168,169,170,171,172,173,174,0,175,176,177,178,179,180,181,182,183,184,185,186,
+        187,188,189,190,191,192,193,0,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217},
+    {
+        0,218,219,0,220,0,221,222,0,223,224,225,0,0,226,227,228,229,0,230,231,0,232,233,234,0,0,0,235,236,0,237,
+        238,239,240,0,241,0,242,243,0,244,0,0,245,0,246,247,248,249,250,251,0,252,0,253,254,0,0,0,255,0,0,0,
+        0,0,0,0,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,0,281,282,
+        283,284,285,286,287,0,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313},
+    {
+        314,315,316,317,318,319,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,337,338,339,340,341,342,0,343,344,
+        345,0,346,0,347,0,348,349,350,351,352,353,354,355,356,357,358,359,360,361,0,0,0,0,0,0,362,363,0,364,365,0,
+        0,366,0,367,368,369,370,0,371,0,372,0,373,0,374,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,375,376,377,378,379,380,381,382,383,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,384,385,386,387,388,389,0,0,
+        390,391,217,392,393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        394,394,394,394,394,395,394,394,394,394,394,394,394,395,395,394,395,394,395,394,394,396,397,397,397,397,396,398,397,397,397,397,
+        397,399,399,400,400,400,400,401,401,397,397,397,397,400,400,397,400,400,397,397,402,402,402,402,403,397,397,397,397,395,395,395,
+        404,405,394,406,407,408,395,397,397,397,395,395,395,397,397,0,395,395,395,397,397,397,397,395,396,397,397,395,409,410,410,409,
+        410,410,409,395,395,395,395,395,395,395,395,395,395,395,395,395,411,0,412,0,413,0,414,0,0,0,415,0,0,0,416,417},
+    {
+        0,0,0,0,33,418,419,420,421,422,423,0,424,0,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,
+        443,444,0,445,446,447,448,449,450,451,452,453,454,455,456,457,458,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,459,460,461,462,463,464,465,466,467,468,469,470,471,0,472,0,473,0,474,0,475,0,
+        476,0,477,0,478,0,479,0,480,0,481,0,482,0,483,0,484,485,486,0,487,488,0,489,0,490,491,0,0,492,493,494},
+    {
+        495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,
+        527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,0,0,0,0,0,0,0,0,0,543,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,544,545,0,546,0,0,0,547,0,0,0,0,548,549,550,0,
+        551,0,552,0,553,0,554,0,555,0,556,0,557,0,558,0,559,0,560,0,561,0,562,563,564,0,565,0,566,0,567,0},
+    {
+        568,0,0,395,395,395,395,395,0,0,569,0,570,0,571,0,572,0,573,0,574,0,575,0,576,0,577,0,578,0,579,0,
+        580,0,581,0,582,0,583,0,584,0,585,0,586,0,587,0,588,0,589,0,590,0,591,0,592,0,593,0,594,0,595,0,
+        596,597,598,599,0,600,0,601,0,602,0,603,0,604,0,0,605,606,607,608,609,0,610,611,612,0,613,614,615,616,617,618,
+        619,0,620,621,622,623,624,625,626,0,627,628,629,630,631,632,633,634,635,636,637,638,639,0,640,641,642,0,643,0,644,0},
+    {
+        645,0,646,0,647,0,648,0,649,0,650,0,651,0,652,0,653,0,654,0,655,0,656,0,657,0,658,0,659,0,660,0,
+        661,0,662,0,663,0,664,0,665,0,666,0,667,0,668,0,0,669,670,671,672,673,674,675,676,677,678,679,680,681,682,683,
+        684,685,686,687,688,689,690,691,692,693,694,695,696,697,698,699,700,701,702,703,704,705,706,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,707,0,0,0,0,0,0,0,0,0,397,395,395,395,395,397,395,395,395,708,397,395,395,395,395,
+        395,395,397,397,397,397,397,397,395,395,397,395,395,708,709,395,710,711,712,713,714,715,716,717,718,719,719,720,721,722,0,723,
+        0,724,725,0,395,397,0,718,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,395,395,395,395,395,395,726,727,728,0,0,0,0,0,
+        0,0,729,730,731,732,733,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,734,735,736,726,727,728,737,738,394,394,400,397,395,395,395,395,395,397,395,395,397,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,739,0,0,0,0,740,741,742,743,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        744,0,745,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,746,0,0,395,395,395,395,395,395,395,0,0,395,
+        395,395,395,397,395,0,0,395,395,0,397,395,395,397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,747,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,397,395,395,397,395,395,397,397,397,395,397,397,395,397,395,
+        395,395,397,395,397,395,397,395,397,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,395,395,395,395,395,395,395,397,395,0,0,0,0,0,0,0,0,0,397,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,395,395,0,395,395,395,395,395,
+        395,395,395,395,0,395,395,395,0,395,395,395,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,397,397,397,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,397,397,397,395,395,395,395,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,395,395,395,395,395,397,397,397,397,397,395,395,395,395,395,395,395,395,395,395,395,395,
+        395,395,0,397,395,395,397,395,395,397,395,395,395,397,397,397,734,735,736,395,395,395,397,395,395,397,397,395,395,395,395,395},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,748,0,0,0,0,0,0,0,749,0,0,750,0,0,0,0,0,0,0,751,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,395,397,395,395,0,0,0,753,754,755,756,757,758,759,760,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,0,762,0,
+        0,0,0,0,0,0,0,0,0,0,0,763,764,752,0,0,0,0,0,0,0,0,0,762,0,0,0,0,765,766,0,767,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,768,0,0,769,0,0,0,0,0,761,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,770,771,772,0,0,773,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,0,762,0,
+        0,0,0,0,0,0,0,0,774,0,0,775,776,752,0,0,0,0,0,0,0,0,762,762,0,0,0,0,777,778,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,779,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,762,0,
+        0,0,0,0,0,0,0,0,0,0,780,781,782,752,0,0,0,0,0,0,0,0,0,762,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,0,0,0,
+        0,0,0,0,0,0,0,0,783,0,0,0,0,752,0,0,0,0,0,0,0,784,785,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,0,0,0,
+        786,0,762,0,0,0,0,787,788,0,789,790,0,752,0,0,0,0,0,0,0,762,762,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,752,0,762,0,
+        0,0,0,0,0,0,0,0,0,0,791,792,793,752,0,0,0,0,0,0,0,0,0,762,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,794,0,0,0,0,762,0,0,0,0,0,0,0,0,0,0,795,0,796,797,798,762,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,799,0,0,0,0,800,800,752,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,801,801,801,801,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,802,0,0,0,0,803,803,752,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,804,804,804,804,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,805,806,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,807,0,0,0,0,0,0,0,0,0,0,0,397,397,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,397,0,397,0,808,0,0,0,0,0,0,
+        0,0,0,809,0,0,0,0,0,0,0,0,0,810,0,0,0,0,811,0,0,0,0,812,0,0,0,0,813,0,0,0,
+        0,0,0,0,0,0,0,0,0,814,0,0,0,0,0,0,0,815,816,817,818,819,820,821,822,823,816,816,816,816,0,0},
+    {
+        816,824,395,395,752,0,395,395,0,0,0,0,0,0,0,0,0,0,0,825,0,0,0,0,0,0,0,0,0,826,0,0,
+        0,0,827,0,0,0,0,828,0,0,0,0,829,0,0,0,0,0,0,0,0,0,0,0,0,830,0,0,0,0,0,0,
+        0,0,0,0,0,0,397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,831,0,0,0,0,0,0,0,762,0,0,0,0,0,0,0,0,761,0,752,752,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        832,833,834,835,836,837,838,839,840,841,842,843,844,845,846,847,848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,
+        864,865,866,867,868,869,0,870,0,0,0,0,0,871,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,872,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,762,
+        762,762,762,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,395,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        873,874,875,876,877,878,879,880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,896,897,898,899,900,901,902,903,904,
+        905,906,907,908,909,910,911,912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,928,929,930,931,932,933,934,935,936,
+        937,938,939,940,941,942,943,944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,752,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,395,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,709,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,708,395,397,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,397,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,395,395,395,395,395,395,0,0,397},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,395,395,395,397,397,397,397,397,397,395,395,397,0,397,
+        397,395,395,397,397,395,395,395,395,395,397,395,395,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,959,0,960,0,961,0,962,0,963,0,0,0,964,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,762,0,0,0,0,0,965,0,966,0,0,
+        967,968,0,969,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,395,397,395,395,395,395,395,395,395,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,752,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,761,0,0,0,0,0,0,0,0,0,0,0,752,752,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,970,971,972,973,974,975,976,977,978,979,980,981,982,983,984,985,
+        986,987,988,989,990,991,992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011,1012,0,0,1013,1014,1015,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,395,0,402,397,397,397,397,397,395,395,397,397,397,397,
+        395,0,402,402,402,402,402,402,402,0,0,0,0,397,0,0,0,0,0,0,395,0,0,0,395,395,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,1016,1017,1018,0,1019,1020,1021,1022,1023,1024,1025,1026,1027,1028,1029,0,1030,1031,1032,1033,
+        1034,1035,1036,29,1037,1038,1039,1040,1041,1042,1043,1044,1045,1046,0,1047,1048,1049,37,1050,1051,1052,1053,1054,1055,1056,1057,1058,1059,465,1060,1061,
+        470,1062,1063,378,1055,1058,465,1060,485,470,1062,0,0,0,0,0,0,0,0,0,0,0,0,0,1064,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1065,1066,1067,1068,1045,
+        1069,1070,1071,1072,1073,1074,1075,1076,1077,1078,1079,1080,1081,1082,1083,1084,1085,1086,1087,1088,1089,1090,1091,1092,1093,1094,1095,1096,1097,1098,1099,466,
+        395,395,397,395,395,395,395,395,395,395,397,395,395,410,1100,397,399,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,
+        395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,396,709,709,397,1101,395,409,397,395,397},
+    {
+        1102,1103,1104,1105,1106,1107,1108,1109,1110,1111,1112,1113,1114,1115,1116,1117,1118,1119,1120,1121,1122,1123,1124,1125,1126,1127,1128,1129,1130,1131,1132,1133,
+        1134,1135,1136,1137,1138,1139,1140,1141,1142,1143,1144,1145,1146,1147,1148,1149,1150,1151,1152,1153,1154,1155,1156,1157,1158,1159,1160,1161,1162,1163,1164,1165,
+        1166,1167,1168,1169,1170,1171,1172,1173,1174,1175,1176,1177,1178,1179,1180,1181,1182,1183,1184,1185,1186,1187,1188,1189,1190,1191,1192,1193,1194,1195,1196,1197,
+        1198,1199,1200,1201,1202,1203,1204,1205,1206,1207,1208,1209,1210,1211,1212,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,1223,1224,1225,1226,1227,1228,1229},
+    {
+        1230,1231,1232,1233,1234,1235,1236,1237,1238,1239,1240,1241,1242,1243,1244,1245,1246,1247,1248,1249,1250,1251,1252,1253,1254,1255,1256,1257,0,0,1258,0,
+        1259,1260,1261,1262,1263,1264,1265,1266,1267,1268,1269,1270,1271,1272,1273,1274,1275,1276,1277,1278,1279,1280,1281,1282,1283,1284,1285,1286,1287,1288,1289,1290,
+        1291,1292,1293,1294,1295,1296,1297,1298,1299,1300,1301,1302,1303,1304,1305,1306,1307,1308,1309,1310,1311,1312,1313,1314,1315,1316,1317,1318,1319,1320,1321,1322,
+        1323,1324,1325,1326,1327,1328,1329,1330,1331,1332,1333,1334,1335,1336,1337,1338,1339,1340,1341,1342,1343,1344,1345,1346,1347,1348,1349,0,1350,0,1351,0},
+    {
+        1352,1353,1354,1355,1356,1357,1358,1359,1360,1361,1362,1363,1364,1365,1366,1367,1368,1369,1370,1371,1372,1373,0,0,1374,1375,1376,1377,1378,1379,0,0,
+        1380,1381,1382,1383,1384,1385,1386,1387,1388,1389,1390,1391,1392,1393,1394,1395,1396,1397,1398,1399,1400,1401,1402,1403,1404,1405,1406,1407,1408,1409,1410,1411,
+        1412,1413,1414,1415,1416,1417,0,0,1418,1419,1420,1421,1422,1423,0,0,1424,1425,1426,1427,1428,1429,1430,1431,0,1432,0,1433,0,1434,0,1435,
+        1436,1437,1438,1439,1440,1441,1442,1443,1444,1445,1446,1447,1448,1449,1450,1451,1452,1453,1454,1455,1456,1457,1458,1459,1460,1461,1462,1463,1464,1465,0,0},
+    {
+        1466,1467,1468,1469,1470,1471,1472,1473,1474,1475,1476,1477,1478,1479,1480,1481,1482,1483,1484,1485,1486,1487,1488,1489,1490,1491,1492,1493,1494,1495,1496,1497,
+        1498,1499,1500,1501,1502,1503,1504,1505,1506,1507,1508,1509,1510,1511,1512,1513,1514,1515,1516,1517,1518,0,1519,1520,1521,1522,1523,1524,1525,1526,1527,1526,
+        1528,1529,1530,1531,1532,0,1533,1534,1535,1536,1537,1538,1539,1540,1541,1542,1543,1544,1545,1546,0,0,1547,1548,1549,1550,1551,1552,0,1553,1554,1555,
+        1556,1557,1558,1559,1560,1561,1562,1563,1564,1565,1566,1567,1568,1569,1570,1571,0,0,1572,1573,1574,0,1575,1576,1577,1578,1579,1580,1581,1582,1583,0},
+    {
+        1584,1585,27,27,27,27,27,27,27,27,27,0,0,0,0,0,0,1586,0,0,0,0,0,1587,0,0,0,0,0,0,0,0,
+        0,0,0,0,1588,1589,1590,0,0,0,0,0,0,0,0,27,0,0,0,1591,1592,0,1593,1594,0,0,0,0,1595,0,1596,0,
+        0,0,0,0,0,0,0,1597,1598,1599,0,0,0,0,0,0,0,0,0,0,0,0,0,1600,0,0,0,0,0,0,0,27,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1601,1063,0,0,1602,1603,1604,1605,1606,1607,1608,1609,1610,1611,1612,1613},
+    {
+        1601,36,31,32,1602,1603,1604,1605,1606,1607,1608,1609,1610,1611,1612,0,29,1042,37,392,1043,375,1047,391,1048,1613,1053,217,1054,0,0,0,
+        0,0,0,0,0,0,0,0,1614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,402,402,395,395,395,395,402,402,402,395,395,0,0,0,
+        0,395,0,0,0,402,402,395,397,395,402,402,397,397,397,397,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        1615,1616,1617,1618,0,1619,1620,1621,0,1622,1046,1023,1023,1023,375,1623,1024,1024,1027,391,0,1029,1624,0,0,1032,1625,1033,1033,1033,0,0,
+        1626,1627,1628,0,1629,0,1630,0,1629,0,1631,1632,1018,1617,0,1042,1020,1633,1634,1028,37,1635,1636,1637,1638,1063,0,1639,471,1060,1640,1641,
+        1642,0,0,0,0,1019,1041,1042,1063,377,0,0,0,0,0,0,1643,1644,1645,1646,1647,1648,1649,1650,1651,1652,1653,1654,1655,1656,1657,1658,
+        1659,1660,1661,1662,1663,1664,1665,1666,1667,1668,1669,1670,1671,1672,1673,1674,1063,1675,1676,1677,1058,1678,1679,1680,1681,392,1682,1683,391,1066,1041,1048},
+    {
+        0,0,0,1684,0,0,0,0,0,1685,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1686,1687,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,1688,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,1689,1690,1691,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,1692,0,0,0,0,1693,0,0,1694,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,1695,0,1696,0,0,0,0,0,1697,1698,0,1699,1700,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,1701,0,0,1702,0,0,1703,0,1704,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        1705,0,1706,0,0,0,0,0,0,0,0,0,0,1707,1708,1709,1710,1711,0,0,1712,1713,0,0,1714,1715,0,0,0,0,0,0},
+    {
+        1716,1717,0,0,1718,1719,0,0,1720,1721,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,1722,1723,1724,1725,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        1726,1727,1728,1729,0,0,0,0,0,0,1730,1731,1732,1733,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,1734,1735,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        36,31,32,1602,1603,1604,1605,1606,1607,1736,1737,1738,1739,1740,1741,1742,1743,1744,1745,1746,1747,1748,1749,1750,1751,1752,1753,1754,1755,1756,1757,1758},
+    {
+        1759,1760,1761,1762,1763,1764,1765,1766,1767,1768,1769,1770,1771,1772,1773,1774,1775,1776,1777,1778,1779,1780,1781,1782,1783,1784,1785,1786,1787,1788,1789,1790,
+        1791,1792,1793,1794,1795,1796,1797,1798,1799,1800,1801,1802,1803,1804,1805,1806,1807,1808,1809,1810,1811,1812,1813,1814,1815,1816,1817,1818,1819,1820,1821,1822,
+        1823,1824,1825,1826,1827,1828,1829,1830,1831,1832,1833,1834,1835,1836,1837,1838,29,1040,1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,37,1053,
+        1839,378,217,1054,1055,1058,382,392,383,1096,1601,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,1840,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1841,1842,1843,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1844,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        1845,1846,1847,1848,1849,1850,1851,1852,1853,1854,1855,1856,1857,1858,1859,1860,1861,1862,1863,1864,1865,1866,1867,1868,1869,1870,1871,1872,1873,1874,1875,1876,
+        1877,1878,1879,1880,1881,1882,1883,1884,1885,1886,1887,1888,1889,1890,1891,1892,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        1893,0,1894,1895,1896,0,0,1897,0,1898,0,1899,0,1900,1901,1902,1903,0,1904,0,0,1905,0,0,0,0,0,0,377,1906,1907,1908},
+    {
+        1909,0,1910,0,1911,0,1912,0,1913,0,1914,0,1915,0,1916,0,1917,0,1918,0,1919,0,1920,0,1921,0,1922,0,1923,0,1924,0,
+        1925,0,1926,0,1927,0,1928,0,1929,0,1930,0,1931,0,1932,0,1933,0,1934,0,1935,0,1936,0,1937,0,1938,0,1939,0,1940,0,
+        1941,0,1942,0,1943,0,1944,0,1945,0,1946,0,1947,0,1948,0,1949,0,1950,0,1951,0,1952,0,1953,0,1954,0,1955,0,1956,0,
+        1957,0,1958,0,0,0,0,0,0,0,0,1959,0,1960,0,395,395,395,1961,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1962,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1963,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1964,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        1965,1966,1967,1968,1969,1970,1971,1972,1973,1974,1975,1976,1977,1978,1979,1980,1981,1982,1983,1984,1985,1986,1987,1988,1989,1990,1991,1992,1993,1994,1995,1996,
+        1997,1998,1999,2000,2001,2002,2003,2004,2005,2006,2007,2008,2009,2010,2011,2012,2013,2014,2015,2016,2017,2018,2019,2020,2021,2022,2023,2024,2025,2026,2027,2028,
+        2029,2030,2031,2032,2033,2034,2035,2036,2037,2038,2039,2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,2057,2058,2059,2060,
+        2061,2062,2063,2064,2065,2066,2067,2068,2069,2070,2071,2072,2073,2074,2075,2076,2077,2078,2079,2080,2081,2082,2083,2084,2085,2086,2087,2088,2089,2090,2091,2092},
+    {
+        2093,2094,2095,2096,2097,2098,2099,2100,2101,2102,2103,2104,2105,2106,2107,2108,2109,2110,2111,2112,2113,2114,2115,2116,2117,2118,2119,2120,2121,2122,2123,2124,
+        2125,2126,2127,2128,2129,2130,2131,2132,2133,2134,2135,2136,2137,2138,2139,2140,2141,2142,2143,2144,2145,2146,2147,2148,2149,2150,2151,2152,2153,2154,2155,2156,
+        2157,2158,2159,2160,2161,2162,2163,2164,2165,2166,2167,2168,2169,2170,2171,2172,2173,2174,2175,2176,2177,2178,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,1101,709,396,708,2179,2179,0,0,0,0,0,0,2180,0,1988,2181,2182,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,2183,0,2184,0,2185,0,2186,0,2187,0,2188,0,2189,0,2190,0,2191,0,2192,0,
+        2193,0,2194,0,0,2195,0,2196,0,2197,0,0,0,0,0,0,2198,2199,0,2200,2201,0,2202,2203,0,2204,2205,0,2206,2207,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2208,0,0,0,0,2209,2209,2210,2211,0,2212,2213,
+        0,0,0,0,0,0,0,0,0,0,0,0,2214,0,2215,0,2216,0,2217,0,2218,0,2219,0,2220,0,2221,0,2222,0,2223,0,
+        2224,0,2225,0,0,2226,0,2227,0,2228,0,0,0,0,0,0,2229,2230,0,2231,2232,0,2233,2234,0,2235,2236,0,2237,2238,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2239,0,0,2240,2241,2242,2243,0,0,0,2244,2245},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2246,2247,2248,2249,2250,2251,2252,2253,2254,2255,2256,2257,2258,2259,2260,
+        2261,2262,2263,2264,2265,2266,2267,2268,2269,2270,2271,2272,2273,2274,2275,2276,2277,2278,2279,2280,2281,2282,2283,2284,2285,2286,2287,2288,2289,2290,2291,2292,
+        2293,2294,2295,2296,2297,2298,2299,2300,2301,2302,2303,2304,2305,2306,2307,2308,2309,2310,2311,2312,2313,2314,2315,2316,2317,2318,2319,2320,2321,2322,2323,2324},
+    {
+        2325,2326,2327,2328,2329,2330,2331,2332,2333,2334,2335,2336,2337,2338,2339,0,0,0,1965,1971,2340,2341,2342,2343,2344,2345,1969,2346,2347,2348,2349,1973,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        2350,2351,2352,2353,2354,2355,2356,2357,2358,2359,2360,2361,2362,2363,2364,2365,2366,2367,2368,2369,2370,2371,2372,2373,2374,2375,2376,2377,2378,2379,2380,0,
+        2381,2382,2383,2384,2385,2386,2387,2388,2389,2390,2391,2392,2393,2394,2395,2396,2397,2398,2399,2400,2401,2402,2403,2404,2405,2406,2407,2408,2409,2410,2411,2412,
+        2413,2414,2415,2416,2417,2418,2031,2419,0,0,0,0,0,0,0,0,2420,2421,2422,2423,2424,2425,2426,2427,2428,2429,2430,2431,2432,2433,2434,2435,
+        2246,2249,2252,2254,2262,2263,2266,2268,2269,2271,2272,2273,2274,2275,2436,2437,2438,2439,2440,2441,2442,2443,2444,2445,2446,2447,2448,2449,2450,2451,2452,0},
+    {
+        1965,1971,2340,2341,2453,2454,2455,1976,2456,1988,2038,2050,2049,2039,2131,1996,2036,2457,2458,2459,2460,2461,2462,2463,2464,2465,2466,2002,2467,2468,2469,2470,
+        2471,2472,2473,2474,2342,2343,2344,2475,2476,2477,2478,2479,2480,2481,2482,2483,2484,2485,2486,2487,2488,2489,2490,2491,2492,2493,2494,2495,2496,2497,2498,2499,
+        2500,2501,2502,2503,2504,2505,2506,2507,2508,2509,2510,2511,2512,2513,2514,2515,2516,2517,2518,2519,2520,2521,2522,2523,2524,2525,2526,2527,2528,2529,2530,2531,
+        2532,2533,2534,2535,2536,2537,2538,2539,2540,2541,2542,2543,2544,2545,2546,2547,2548,2549,2550,2551,2552,2553,2554,2555,2556,2557,2558,2559,2560,2561,2562,2563},
+    {
+        2564,2565,2566,2567,2568,2569,2570,2571,2572,2573,2574,2575,2576,2577,2578,2579,2580,2581,2582,2583,2584,2585,2586,2587,2588,2589,2590,2591,2592,2593,2594,2595,
+        2596,2597,2598,2599,2600,2601,2602,2603,2604,2605,2606,2607,2608,2609,2610,2611,2612,2613,2614,2615,2616,2617,2618,2619,2620,2621,2622,2623,2624,2625,2626,2627,
+        2628,2629,2630,2631,2632,2633,2634,2635,2636,2637,2638,2639,2640,2641,2642,2643,2644,2645,2646,2647,2648,2649,2650,2651,2652,2653,2654,2655,2656,2657,2658,2659,
+        2660,2661,2662,2663,2664,2665,2666,2667,2668,2669,2670,2671,2672,2673,2674,2675,2676,2677,2678,2679,2680,2681,2682,2683,2684,2685,2686,2687,2688,2689,2690,2691},
+    {
+        2692,2693,2694,2695,2696,2697,2698,2699,2700,2701,2702,2703,2704,2705,2706,2707,2708,2709,2710,2711,2712,2713,2714,2715,2716,2717,2718,2719,2720,2721,2722,2723,
+        2724,2725,2726,2727,2728,2729,2730,2731,2732,2733,2734,2735,2736,2737,2738,2739,2740,2741,2742,2743,2744,2745,2746,2747,2748,2749,2750,2751,2752,2753,2754,2755,
+        2756,2757,2758,2759,2760,2761,2762,2763,2764,2765,2766,2767,2768,2769,2770,2771,2772,2773,2774,2775,2776,2777,2778,2779,2780,2781,2782,2783,2784,2785,2786,2787,
+        2788,2789,2790,2791,2792,2793,2794,2795,2796,2797,2798,2799,2800,2801,2802,2803,2804,2805,2806,2807,2808,2809,2810,2811,2812,2813,2814,2815,2816,2817,2818,2819},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        2820,0,2821,0,2822,0,2823,0,2824,0,2825,0,2826,0,2827,0,2828,0,2829,0,2830,0,2831,0,2832,0,2833,0,2834,0,2835,0,
+        2836,0,2837,0,2838,0,2839,0,2840,0,2841,0,2842,0,0,395,0,0,0,0,395,395,395,395,395,395,395,395,395,395,0,0},
+    {
+        2843,0,2844,0,2845,0,2846,0,2847,0,2848,0,2849,0,2850,0,2851,0,2852,0,2853,0,2854,0,2855,0,2856,0,2857,2858,395,395,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,2859,0,2860,0,2861,0,2862,0,2863,0,2864,0,2865,0,0,0,2866,0,2867,0,2868,0,2869,0,2870,0,2871,0,2872,0,
+        2873,0,2874,0,2875,0,2876,0,2877,0,2878,0,2879,0,2880,0,2881,0,2882,0,2883,0,2884,0,2885,0,2886,0,2887,0,2888,0,
+        2889,0,2890,0,2891,0,2892,0,2893,0,2894,0,2895,0,2896,0,2897,0,0,0,0,0,0,0,0,2898,0,2899,0,2900,2901,0},
+    {
+        2902,0,2903,0,2904,0,2905,0,0,0,0,2906,0,2907,0,0,2908,0,2909,0,0,0,2910,0,2911,0,2912,0,2913,0,2914,0,
+        2915,0,2916,0,2917,0,2918,0,2919,0,2920,2921,2922,2923,2924,0,2925,2926,2927,2928,2929,0,2930,0,2931,0,2932,0,2933,0,2934,0,
+        2935,0,2936,0,2937,2938,2939,2940,0,2941,0,0,0,0,0,0,2942,0,0,0,0,0,2943,0,2944,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1617,1633,1625,2945,0,0,2946,2947,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,397,397,397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,0,0,0,0,0,0,0,0,0,0,0,0,
+        752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,0,395,395,397,0,0,395,395,0,0,0,0,0,395,395,
+        0,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2948,2949,2950,2951,
+        0,0,0,0,0,0,0,0,0,2952,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        2953,2954,2955,2956,2957,2958,2959,2960,2960,2961,2962,2963,2964,2965,2966,2967,2968,2969,2970,2971,2972,2973,2974,2975,2976,2977,2978,2979,2980,2981,2982,2983,
+        2984,2985,2986,2987,2988,2989,2990,2991,2992,2993,2994,2995,2996,2997,2998,2999,3000,3001,3002,3003,3004,3005,3006,3007,3008,3009,3010,3011,3012,3013,3014,3015,
+        3016,3017,3018,3019,3020,3021,3022,3023,3024,3025,3026,3027,3028,3029,3030,3031,3032,3033,3034,3035,3036,3037,3038,3039,3040,3041,3042,3043,2972,3044,3045,3046,
+        3047,3048,3049,3050,3051,3052,3053,3054,3055,3056,3057,3058,3059,3060,3061,3062,3063,3064,3065,3066,3067,3068,3069,3070,3071,3072,3073,3074,3075,3076,3077,3078},
+    {
+        3079,3080,3081,3082,3083,3084,3085,3086,3087,3088,3089,3090,3091,3092,3093,3094,3095,3096,3097,3098,3099,3100,3101,3102,3103,3104,3105,3106,3107,3108,3109,3110,
+        3111,3062,3112,3113,3114,3115,3116,3117,3118,3119,3046,3120,3121,3122,3123,3124,3125,3126,3127,3128,3129,3130,3131,3132,3133,3134,3135,3136,3137,3138,3139,2972,
+        3140,3141,3142,3143,3144,3145,3146,3147,3148,3149,3150,3151,3152,3153,3154,3155,3156,3157,3158,3159,3160,3161,3162,3163,3164,3165,3166,3048,3167,3168,3169,3170,
+        3171,3172,3173,3174,3175,3176,3177,3178,3179,3180,3181,3182,3183,3184,3185,3186,3187,3188,3189,3190,3191,3192,3193,3194,3195,3196,3197,3198,3199,3200,3201,3202},
+    {
+        3203,3204,3205,3206,3207,3208,3209,3210,3211,3212,3213,3214,3215,3216,0,0,3217,0,3218,0,0,3219,3220,3221,3222,3223,3224,3225,3226,3227,3228,0,
+        3229,0,3230,0,0,3231,3232,0,0,0,3233,3234,3235,3236,3237,3238,3239,3240,3241,3242,3243,3244,3245,3246,3247,3248,3249,3250,3251,3252,3253,3254,
+        3255,3256,3257,3258,3259,3260,3261,3262,3263,3264,3265,3266,3267,3268,3269,3270,3271,3272,3273,3274,3275,3276,3277,3101,3278,3279,3280,3281,3282,3283,3283,3284,
+        3285,3286,3287,3288,3289,3290,3291,3231,3292,3293,3294,3295,3296,3297,0,0,3298,3299,3300,3301,3302,3303,3304,3305,3245,3306,3307,3308,3217,3309,3310,3311},
+    {
+        3312,3313,3314,3315,3316,3317,3318,3319,3320,3254,3321,3255,3322,3323,3324,3325,3326,3218,2993,3327,3328,3329,3063,3150,3330,3331,3262,3332,3263,3333,3334,3335,
+        3220,3336,3337,3338,3339,3340,3221,3341,3342,3343,3344,3345,3346,3277,3347,3348,3101,3349,3281,3350,3351,3352,3353,3354,3286,3355,3230,3356,3287,3044,3357,3288,
+        3358,3290,3359,3360,3361,3362,3363,3292,3226,3364,3293,3365,3294,3366,2960,3367,3368,3369,3370,3371,3372,3373,3374,3375,3376,3377,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        3378,3379,3380,3381,3382,3383,3383,0,0,0,0,0,0,0,0,0,0,0,0,3384,3385,3386,3387,3388,0,0,0,0,0,3389,3390,3391,
+        3392,1635,1638,3393,3394,3395,3396,3397,3398,1608,3399,3400,3401,3402,3403,3404,3405,3406,3407,3408,3409,3410,3411,0,3412,3413,3414,3415,3416,0,3417,0,
+        3418,3419,0,3420,3421,0,3422,3423,3424,3425,3426,3427,3428,3429,3430,3431,3432,3432,3433,3433,3433,3433,3434,3434,3434,3434,3435,3435,3435,3435,3436,3436,
+        3436,3436,3437,3437,3437,3437,3438,3438,3438,3438,3439,3439,3439,3439,3440,3440,3440,3440,3441,3441,3441,3441,3442,3442,3442,3442,3443,3443,3443,3443,3444,3444},
+    {
+        3444,3444,3445,3445,3446,3446,3447,3447,3448,3448,3449,3449,3450,3450,3451,3451,3451,3451,3452,3452,3452,3452,3453,3453,3453,3453,3454,3454,3454,3454,3455,3455,
+        3456,3456,3456,3456,3457,3457,3458,3458,3458,3458,3459,3459,3459,3459,3460,3460,3461,3461,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3462,3462,3462,3462,3463,3463,3464,3464,3465,3465,742,3466,3466,
+        3467,3467,3468,3468,3469,3469,3469,3469,3470,3470,3471,3471,3472,3472,3473,3473,3474,3474,3475,3475,3476,3476,3477,3477,3477,3478,3478,3478,3479,3479,3479,3479},
+    {
+        3480,3481,3482,3478,3483,3484,3485,3486,3487,3488,3489,3490,3491,3492,3493,3494,3495,3496,3497,3498,3499,3500,3501,3502,3503,3504,3505,3506,3507,3508,3509,3510,
+        3511,3512,3513,3514,3515,3516,3517,3518,3519,3520,3521,3522,3523,3524,3525,3526,3527,3528,3529,3530,3531,3532,3533,3534,3535,3536,3537,3538,3539,3540,3541,3542,
+        3543,3544,3545,3546,3547,3548,3549,3550,3551,3552,3553,3554,3555,3556,3557,3558,3559,3560,3561,3562,3563,3564,3565,3566,3567,3568,3569,3570,3571,3572,3573,3574,
+        3575,3576,3577,3578,3579,3580,3482,3581,3478,3483,3582,3583,3487,3584,3488,3489,3585,3586,3493,3587,3494,3495,3588,3589,3497,3590,3498,3499,3528,3529,3532,3533},
+    {
+        3534,3538,3539,3540,3541,3545,3546,3547,3591,3551,3592,3593,3557,3594,3558,3559,3572,3595,3596,3567,3597,3568,3569,3480,3481,3598,3482,3599,3484,3485,3486,3487,
+        3600,3490,3491,3492,3493,3601,3497,3500,3501,3502,3503,3504,3506,3507,3508,3509,3510,3511,3602,3512,3513,3514,3515,3516,3517,3519,3520,3521,3522,3523,3524,3525,
+        3526,3527,3530,3531,3535,3536,3537,3538,3539,3542,3543,3544,3545,3603,3548,3549,3550,3551,3554,3555,3556,3557,3604,3560,3561,3605,3564,3565,3566,3567,3606,3482,
+        3599,3487,3600,3493,3601,3497,3607,3510,3608,3609,3610,3538,3539,3545,3557,3604,3567,3606,3611,3612,3613,3614,3615,3616,3617,3618,3619,3620,3621,3622,3623,3624},
+    {
+        3625,3626,3627,3628,3629,3630,3631,3632,3633,3634,3635,3636,3609,3637,3638,3639,3640,3614,3615,3616,3617,3618,3619,3620,3621,3622,3623,3624,3625,3626,3627,3628,
+        3629,3630,3631,3632,3633,3634,3635,3636,3609,3637,3638,3639,3640,3634,3635,3636,3609,3608,3610,3518,3507,3508,3509,3634,3635,3636,3518,3519,3641,3641,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3642,3643,3643,3644,3645,3646,3647,3648,3649,3649,3650,3651,3652,3653,3654,3655,
+        3655,3656,3657,3657,3658,3658,3659,3660,3660,3661,3662,3662,3663,3663,3664,3665,3665,3666,3666,3667,3668,3669,3670,3670,3671,3672,3673,3674,3675,3675,3676,3677},
+    {
+        3678,3679,3680,3681,3681,3682,3682,3683,3683,3684,3685,3686,3687,3688,3689,3690,0,0,3691,3692,3693,3694,3695,3696,3696,3697,3698,3699,3700,3700,3701,3702,
+        3703,3704,3705,3706,3707,3708,3709,3710,3711,3712,3713,3714,3715,3716,3717,3718,3719,3720,3721,3722,3676,3678,3723,3724,3725,3726,3727,3728,3727,3725,3729,3730,
+        3731,3732,3733,3728,3669,3659,3734,3735,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3736,3737,3738,3739,3740,3741,3742,3743,3744,3745,3746,3747,3748,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3749,3750,3751,3752,3753,3754,3755,3756,3757,1590,0,0,0,0,0,0,
+        395,395,395,395,395,395,395,397,397,397,397,397,397,397,395,395,1589,3758,3759,3760,3760,1611,1612,3761,3762,3763,3764,3765,3766,3767,3768,3769,
+        3770,3771,3772,3773,3774,0,0,3775,3776,1596,1596,1596,1596,3760,3760,3760,3749,3750,1588,0,3753,3752,3755,3754,3758,1611,1612,3761,3762,3763,3764,3777,
+        3778,3779,1608,3780,3781,3782,1610,0,3783,3784,3785,3786,0,0,0,0,3787,3788,3789,0,3790,0,3791,3792,3793,3794,3795,3796,3797,3798,3799,3800},
+    {
+        3801,3802,3802,3803,3803,3804,3804,3805,3805,3806,3806,3806,3806,3807,3807,3808,3808,3808,3808,3809,3809,3810,3810,3810,3810,3811,3811,3811,3811,3812,3812,3812,
+        3812,3813,3813,3813,3813,3814,3814,3814,3814,3815,3815,3816,3816,3817,3817,3818,3818,3819,3819,3819,3819,3820,3820,3820,3820,3821,3821,3821,3821,3822,3822,3822,
+        3822,3823,3823,3823,3823,3824,3824,3824,3824,3825,3825,3825,3825,3826,3826,3826,3826,3827,3827,3827,3827,3828,3828,3828,3828,3829,3829,3829,3829,3830,3830,3830,
+        3830,3831,3831,3831,3831,3832,3832,3832,3832,3833,3833,3833,3833,3834,3834,3470,3470,3835,3835,3835,3835,3836,3836,3837,3837,3838,3838,3839,3839,0,0,0},
+    {
+        0,3754,3840,3777,3784,3785,3778,3841,1611,1612,3779,1608,3749,3780,1588,3842,1601,36,31,32,1602,1603,1604,1605,1606,1607,3752,3753,3781,1610,3782,3755,
+        3786,3843,3844,3845,3846,3847,3848,3849,3850,3851,3852,3853,3854,3855,3856,3857,3858,3859,3860,3861,3862,3863,3864,3865,3866,3867,3868,3775,3783,3776,3869,3760,
+        3870,29,1040,1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058,382,392,383,1096,3761,3871,3762,3872,3873,
+        3874,3751,3771,3772,3750,3875,2562,3876,3877,3878,3879,3880,3881,3882,3883,3884,3885,2516,2517,2518,2519,2520,2521,2522,2523,2524,2525,2526,2527,2528,2529,2530},
+    {
+        2531,2532,2533,2534,2535,2536,2537,2538,2539,2540,2541,2542,2543,2544,2545,2546,2547,2548,2549,2550,2551,2552,2553,2554,2555,2556,2557,2558,2559,3886,3887,3888,
+        2297,2246,2247,2248,2249,2250,2251,2252,2253,2254,2255,2256,2257,2258,2259,2260,2261,2262,2263,2264,2265,2266,2267,2268,2269,2270,2271,2272,2273,2274,2275,0,
+        0,0,2276,2277,2278,2279,2280,2281,0,0,2282,2283,2284,2285,2286,2287,0,0,2288,2289,2290,2291,2292,2293,0,0,2294,2295,2296,0,0,0,
+        3889,3890,3891,30,3892,3893,3894,0,3895,3896,3897,3898,3899,3900,3901,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,397,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,395,395,395,0,0,0,0,0},
+    {
+        3902,3903,3904,3905,3906,3907,3908,3909,3910,3911,3912,3913,3914,3915,3916,3917,3918,3919,3920,3921,3922,3923,3924,3925,3926,3927,3928,3929,3930,3931,3932,3933,
+        3934,3935,3936,3937,3938,3939,3940,3941,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3942,3943,3944,3945,3946,3947,3948,3949,3950,3951,3952,3953,3954,3955,3956,3957,
+        3958,3959,3960,3961,3962,3963,3964,3965,3966,3967,3968,3969,3970,3971,3972,3973,3974,3975,3976,3977,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3978,3979,3980,3981,3982,3983,3984,3985,3986,3987,3988,0,3989,3990,3991,3992},
+    {
+        3993,3994,3995,3996,3997,3998,3999,4000,4001,4002,4003,0,4004,4005,4006,4007,4008,4009,4010,0,4011,4012,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,4013,4014,4015,4016,4017,0,4018,4019,4020,4021,4022,4023,4024,4025,4026,4027,4028,4029,4030,4031,1623,4032,4033,4034,4035,4036,4037,4038,4039,4040,4041,
+        4042,4043,4044,4045,4046,1839,4047,4048,4049,4050,4051,4052,4053,4054,4055,4056,4057,0,4058,4059,4060,4061,4062,4063,4064,4065,4066,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,397,0,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,402,397,0,0,0,0,752,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,395,397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        4067,4068,4069,4070,4071,4072,4073,4074,4075,4076,4077,4078,4079,4080,4081,4082,4083,4084,4085,4086,4087,4088,4089,4090,4091,4092,4093,4094,4095,4096,4097,4098,
+        4099,4100,4101,4102,4103,4104,4105,4106,4107,4108,4109,4110,4111,4112,4113,4114,4115,4116,4117,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,395,395,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,397,397,395,395,395,397,395,397,397,397,397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,395,397,395,397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4118,0,4119,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,4120,0,0,0,0,0,0,0,0,0,0,0,0,0,752,751,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        395,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,762,0,0,0,0,0,0,4121,4122,0,0,0,752,752,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        752,0,0,0,0,0,0,0,0,0,761,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,761,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,761,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,761,761,0,762,0,
+        0,0,0,0,0,0,0,0,0,0,0,4123,4124,752,0,0,0,0,0,0,0,0,0,762,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,395,395,395,395,395,395,395,0,0,0,395,395,395,395,395,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,752,0,0,0,761,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,762,0,0,0,0,0,0,0,0,0,762,4125,4126,762,4127,0,
+        0,0,752,761,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,762,0,0,0,0,0,0,0,0,0,0,4128,4129,0,0,0,752,
+        761,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,761,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,761,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        4130,4131,4132,4133,4134,4135,4136,4137,4138,4139,4140,4141,4142,4143,4144,4145,4146,4147,4148,4149,4150,4151,4152,4153,4154,4155,4156,4157,4158,4159,4160,4161,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,762,0,0,0,0,0,0,0,4162,0,0,0,0,752,752,0,
+        0,0,0,761,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,761,0,752,752,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,752,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,402,402,402,402,402,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,395,395,395,395,395,395,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        4163,4164,4165,4166,4167,4168,4169,4170,4171,4172,4173,4174,4175,4176,4177,4178,4179,4180,4181,4182,4183,4184,4185,4186,4187,4188,4189,4190,4191,4192,4193,4194,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4195,4195,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,402,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4196,4197,
+        4198,4199,4200,4201,4202,808,808,402,402,402,0,0,0,4203,808,808,808,808,808,0,0,0,0,0,0,0,0,397,397,397,397,397},
+    {
+        397,397,397,0,0,395,395,395,395,395,397,397,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,395,395,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,4204,4205,4206,4207,4208,
+        4209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,395,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,1028,1029,1030,1032,1625,1033,4210,1034,1035,1906,1036,4211,4212,1629,29,1040,1066,1041,1042,1069,
+        1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058,382,392,383,1096,1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,
+        1028,1029,1030,1032,1625,1033,4210,1034,1035,1906,1036,4211,4212,1629,29,1040,1066,1041,1042,1069,1046,0,1063,377,1047,391,1048,1613,37,1053,1839,378,
+        217,1054,1055,1058,382,392,383,1096,1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,1028,1029,1030,1032,1625,1033,4210,1034,1035,1906,1036,4211},
+    {
+        4212,1629,29,1040,1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058,382,392,383,1096,1016,0,1617,1019,
+        0,0,1022,0,0,1025,1026,0,0,1029,1030,1032,1625,0,4210,1034,1035,1906,1036,4211,4212,1629,29,1040,1066,1041,0,1069,0,375,1063,377,
+        1047,391,1048,1613,0,1053,1839,378,217,1054,1055,1058,382,392,383,1096,1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,1028,1029,1030,1032,
+        1625,1033,4210,1034,1035,1906,1036,4211,4212,1629,29,1040,1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058},
+    {
+        382,392,383,1096,1016,1018,0,1019,1020,1633,1022,0,0,1025,1026,1027,1028,1029,1030,1032,1625,0,4210,1034,1035,1906,1036,4211,4212,0,29,1040,
+        1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058,382,392,383,1096,1016,1018,0,1019,1020,1633,1022,0,
+        1024,1025,1026,1027,1028,0,1030,0,0,0,4210,1034,1035,1906,1036,4211,4212,0,29,1040,1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,
+        37,1053,1839,378,217,1054,1055,1058,382,392,383,1096,1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,1028,1029,1030,1032,1625,1033,4210,1034},
+    {
+        1035,1906,1036,4211,4212,1629,29,1040,1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058,382,392,383,1096,
+        1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,1028,1029,1030,1032,1625,1033,4210,1034,1035,1906,1036,4211,4212,1629,29,1040,1066,1041,1042,1069,
+        1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058,382,392,383,1096,1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,
+        1028,1029,1030,1032,1625,1033,4210,1034,1035,1906,1036,4211,4212,1629,29,1040,1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378},
+    {
+        217,1054,1055,1058,382,392,383,1096,1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,1028,1029,1030,1032,1625,1033,4210,1034,1035,1906,1036,4211,
+        4212,1629,29,1040,1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058,382,392,383,1096,1016,1018,1617,1019,
+        1020,1633,1022,1023,1024,1025,1026,1027,1028,1029,1030,1032,1625,1033,4210,1034,1035,1906,1036,4211,4212,1629,29,1040,1066,1041,1042,1069,1046,375,1063,377,
+        1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058,382,392,383,1096,1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,1028,1029,1030,1032},
+    {
+        1625,1033,4210,1034,1035,1906,1036,4211,4212,1629,29,1040,1066,1041,1042,1069,1046,375,1063,377,1047,391,1048,1613,37,1053,1839,378,217,1054,1055,1058,
+        382,392,383,1096,4213,4214,0,0,4215,4216,1640,4217,4218,4219,4220,4221,4222,4223,4224,4225,4226,4227,4228,1641,4229,4221,4230,4231,467,4232,4233,4234,
+        4235,4236,4237,465,1060,1061,488,4238,4239,466,4240,484,4241,34,4242,4243,4244,471,485,486,4245,4246,4247,470,1062,4248,4249,4250,488,466,484,470,
+        485,471,4215,4216,1640,4217,4218,4219,4220,4221,4222,4223,4224,4225,4226,4227,4228,1641,4229,4221,4230,4231,467,4232,4233,4234,4235,4236,4237,465,1060,1061},
+    {
+        488,4238,4239,466,4240,484,4241,34,4242,4243,4244,471,485,486,4245,4246,4247,470,1062,4248,4249,4250,488,466,484,470,485,471,4215,4216,1640,4217,
+        4218,4219,4220,4221,4222,4223,4224,4225,4226,4227,4228,1641,4229,4221,4230,4231,467,4232,4233,4234,4235,4236,4237,465,1060,1061,488,4238,4239,466,4240,484,
+        4241,34,4242,4243,4244,471,485,486,4245,4246,4247,470,1062,4248,4249,4250,488,466,484,470,485,471,4215,4216,1640,4217,4218,4219,4220,4221,4222,4223,
+        4224,4225,4226,4227,4228,1641,4229,4221,4230,4231,467,4232,4233,4234,4235,4236,4237,465,1060,1061,488,4238,4239,466,4240,484,4241,34,4242,4243,4244,471},
+    {
+        485,486,4245,4246,4247,470,1062,4248,4249,4250,488,466,484,470,485,471,4215,4216,1640,4217,4218,4219,4220,4221,4222,4223,4224,4225,4226,4227,4228,1641,
+        4229,4221,4230,4231,467,4232,4233,4234,4235,4236,4237,465,1060,1061,488,4238,4239,466,4240,484,4241,34,4242,4243,4244,471,485,486,4245,4246,4247,470,
+        1062,4248,4249,4250,488,466,484,470,485,471,4251,4252,0,0,1601,36,31,32,1602,1603,1604,1605,1606,1607,1601,36,31,32,1602,1603,1604,1605,
+        1606,1607,1601,36,31,32,1602,1603,1604,1605,1606,1607,1601,36,31,32,1602,1603,1604,1605,1606,1607,1601,36,31,32,1602,1603,1604,1605,1606,1607},
+    {
+        395,395,395,395,395,395,395,0,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,395,0,0,395,395,395,395,395,
+        395,395,0,395,395,0,395,395,395,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,395,395,395,395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,397,397,397,397,397,397,397,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        4253,4254,4255,4256,4257,4258,4259,4260,4261,4262,4263,4264,4265,4266,4267,4268,4269,4270,4271,4272,4273,4274,4275,4276,4277,4278,4279,4280,4281,4282,4283,4284,
+        4285,4286,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,395,395,395,395,395,395,761,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        3807,3808,3812,3815,0,3834,3818,3813,3823,3835,3829,3830,3831,3832,3819,3825,3827,3821,3828,3817,3820,3810,3811,3814,3816,3822,3824,3826,4287,3455,4288,4289,
+        0,3808,3812,0,3833,0,0,3813,0,3835,3829,3830,3831,3832,3819,3825,3827,3821,3828,0,3820,3810,3811,3814,0,3822,0,3826,0,0,0,0,
+        0,0,3812,0,0,0,0,3813,0,3835,0,3830,0,3832,3819,3825,0,3821,3828,0,3820,0,0,3814,0,3822,0,3826,0,3455,0,4289,
+        0,3808,3812,0,3833,0,0,3813,3823,3835,3829,0,3831,3832,3819,3825,3827,3821,3828,0,3820,3810,3811,3814,0,3822,3824,3826,4287,0,4288,0},
+    {
+        3807,3808,3812,3815,3833,3834,3818,3813,3823,3835,0,3830,3831,3832,3819,3825,3827,3821,3828,3817,3820,3810,3811,3814,3816,3822,3824,3826,0,0,0,0,
+        0,3808,3812,3815,0,3834,3818,3813,3823,3835,0,3830,3831,3832,3819,3825,3827,3821,3828,3817,3820,3810,3811,3814,3816,3822,3824,3826,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        4290,4291,4292,4293,4294,4295,4296,4297,4298,4299,4300,0,0,0,0,0,4301,4302,4303,4304,4305,4306,4307,4308,4309,4310,4311,4312,4313,4314,4315,4316,
+        4317,4318,4319,4320,4321,4322,4323,4324,4325,4326,4327,1617,1033,4328,4329,0,1016,1018,1617,1019,1020,1633,1022,1023,1024,1025,1026,1027,1028,1029,1030,1032,
+        1625,1033,4210,1034,1035,1906,1036,4211,4212,1629,4330,2749,4331,4332,4333,4334,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,4335,4336,4337,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4338,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        4339,4340,2526,0,0,0,0,0,0,0,0,0,0,0,0,0,2028,4341,4342,4343,1971,4344,4345,2348,4346,4347,4348,4349,4350,4351,4352,4353,
+        4354,4355,2064,4356,4357,4358,4359,4360,4361,1965,2340,4362,2475,2343,2476,4363,2120,4364,4365,4366,4367,4368,2458,2038,4369,4370,4371,4372,0,0,0,0,
+        4373,4374,4375,4376,4377,4378,4379,4380,4381,0,0,0,0,0,0,0,4382,4383,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1601,36,31,32,1602,1603,1604,1605,1606,1607,0,0,0,0,0,0},
+    {
+        4384,4385,4386,4387,4388,3239,4389,4390,4391,4392,3240,4393,4394,4395,3241,4396,4397,4398,4399,4400,4401,4402,4403,4404,4405,4406,4407,3299,4408,4409,4410,4411,
+        4412,4413,4414,4415,4416,3304,3242,3243,3305,4417,4418,3050,4419,3244,4420,4421,4422,4423,4423,4423,4424,4425,4426,4427,4428,4429,4430,4431,4432,4433,4434,4435,
+        4436,4437,4438,4439,4440,4441,4441,3307,4442,4443,4444,4445,3246,4446,4447,4448,3203,4449,4450,4451,4452,4453,4454,4455,4456,4457,4458,4459,4460,4461,4462,4463,
+        4464,4465,4466,4467,4468,4469,4470,4471,4472,4473,4474,4474,4475,4476,4477,3046,4478,4479,4480,4481,4482,4483,4484,4485,3251,4486,4487,4488,4489,4490,4491,4492},
+    {
+        4493,4494,4495,4496,4497,4498,4499,4500,4501,4502,4503,4504,4505,4506,2992,4507,4508,4509,4509,4510,4511,4511,4512,4513,4514,4515,4516,4517,4518,4519,4520,4521,
+        4522,4523,4524,3252,4525,4526,4527,4528,3319,4528,4529,3254,4530,4531,4532,4533,3255,2965,4534,4535,4536,4537,4538,4539,4540,4541,4542,4543,4544,4545,4546,4547,
+        4548,4549,4550,4551,4552,4553,4554,4555,3256,4556,4557,4558,4559,4560,4561,3258,4562,4563,4564,4565,4566,4567,4568,4569,2993,3327,4570,4571,4572,4573,4574,4575,
+        4576,4577,3259,4578,4579,4580,4581,3370,4582,4583,4584,4585,4586,4587,4588,4589,4590,4591,4592,4593,4594,3063,4595,4596,4597,4598,4599,4600,4601,4602,4603,4604},
+    {
+        4605,3260,3150,4606,4607,4608,4609,4610,4611,4612,4613,3331,4614,4615,4616,4617,4618,4619,4620,4621,3332,4622,4623,4624,4625,4626,4627,4628,4629,4630,4631,4632,
+        4633,3334,4634,4635,4636,4637,4638,4639,4640,4641,4642,4643,4644,4644,4645,4646,3336,4647,4648,4649,4650,4651,4652,4653,3049,4654,4655,4656,4657,4658,4659,4660,
+        3342,4661,4662,4663,4664,4665,4666,4666,3343,3372,4667,4668,4669,4670,4671,3011,3345,4672,4673,3271,4674,4675,3225,4676,4677,3275,4678,4679,4680,4681,4681,4682,
+        4683,4684,4685,4686,4687,4688,4689,4690,4691,4692,4693,4694,4695,4696,4697,4698,4699,4700,4701,4702,4703,4704,4705,4706,4707,4708,3281,4709,4710,4711,4712,4713},
+    {
+        4714,4715,4716,4717,4718,4719,4720,4721,4722,4723,4724,4510,4725,4726,4727,4728,4729,4730,4731,4732,4733,4734,4735,4736,3067,4737,4738,4739,4740,4741,4742,3284,
+        4743,4744,4745,4746,4747,4748,4749,4750,4751,4752,4753,4754,4755,4756,4757,4758,4759,4760,4761,4762,3006,4763,4764,4765,4766,4767,4768,3352,4769,4770,4771,4772,
+        4773,4774,4775,4776,4777,4778,4779,4780,4781,4782,4783,4784,4785,4786,4787,4788,3357,3358,4789,4790,4791,4792,4793,4794,4795,4796,4797,4798,4799,4800,4801,3359,
+        4802,4803,4804,4805,4806,4807,4808,4809,4810,4811,4812,4813,4814,4815,4816,4817,4818,4819,4820,4821,4822,4823,4824,4825,4826,4827,4828,4829,4830,4831,3365,3365},
+    {
+        4832,4833,4834,4835,4836,4837,4838,4839,4840,4841,3366,4842,4843,4844,4845,4846,4847,4848,4849,4850,4851,4852,4853,4854,4855,4856,4857,4858,4859,4860,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+};
+
+/* 映射池：长度后紧跟码点 */
+static const uint32_t bbpe_norm_pool[13044] = {
+    0x0,0x1,0x61,0x1,0x62,0x1,0x63,0x1,0x64,0x1,0x65,0x1,0x66,0x1,0x67,0x1,
+    0x68,0x1,0x69,0x1,0x6A,0x1,0x6B,0x1,0x6C,0x1,0x6D,0x1,0x6E,0x1,0x6F,0x1,
+    0x70,0x1,0x71,0x1,0x72,0x1,0x73,0x1,0x74,0x1,0x75,0x1,0x76,0x1,0x77,0x1,
+    0x78,0x1,0x79,0x1,0x7A,0x1,0x20,0x2,0x20,0x308,0x2,0x20,0x304,0x1,0x32,0x1,
+    0x33,0x2,0x20,0x301,0x1,0x3BC,0x2,0x20,0x327,0x1,0x31,0x3,0x31,0x2044,0x34,0x3,
+    0x31,0x2044,0x32,0x3,0x33,0x2044,0x34,0x2,0x41,0x300,0x1,0xE0,0x2,0x41,0x301,0x1,
+    0xE1,0x2,0x41,0x302,0x1,0xE2,0x2,0x41,0x303,0x1,0xE3,0x2,0x41,0x308,0x1,0xE4,
+    0x2,0x41,0x30A,0x1,0xE5,0x1,0xE6,0x2,0x43,0x327,0x1,0xE7,0x2,0x45,0x300,0x1,
+    0xE8,0x2,0x45,0x301,0x1,0xE9,0x2,0x45,0x302,0x1,0xEA,0x2,0x45,0x308,0x1,0xEB,
+    0x2,0x49,0x300,0x1,0xEC,0x2,0x49,0x301,0x1,0xED,0x2,0x49,0x302,0x1,0xEE,0x2,
+    0x49,0x308,0x1,0xEF,0x1,0xF0,0x2,0x4E,0x303,0x1,0xF1,0x2,0x4F,0x300,0x1,0xF2,
+    0x2,0x4F,0x301,0x1,0xF3,0x2,0x4F,0x302,0x1,0xF4,0x2,0x4F,0x303,0x1,0xF5,0x2,
+    0x4F,0x308,0x1,0xF6,0x1,0xF8,0x2,0x55,0x300,0x1,0xF9,0x2,0x55,0x301,0x1,0xFA,
+    0x2,0x55,0x302,0x1,0xFB,0x2,0x55,0x308,0x1,0xFC,0x2,0x59,0x301,0x1,0xFD,0x1,
+    0xFE,0x2,0x61,0x300,0x2,0x61,0x301,0x2,0x61,0x302,0x2,0x61,0x303,0x2,0x61,0x308,
+    0x2,0x61,0x30A,0x2,0x63,0x327,0x2,0x65,0x300,0x2,0x65,0x301,0x2,0x65,0x302,0x2,
+    0x65,0x308,0x2,0x69,0x300,0x2,0x69,0x301,0x2,0x69,0x302,0x2,0x69,0x308,0x2,0x6E,
+    0x303,0x2,0x6F,0x300,0x2,0x6F,0x301,0x2,0x6F,0x302,0x2,0x6F,0x303,0x2,0x6F,0x308,
+    0x2,0x75,0x300,0x2,0x75,0x301,0x2,0x75,0x302,0x2,0x75,0x308,0x2,0x79,0x301,0x2,
+    0x79,0x308,0x2,0x41,0x304,0x1,0x101,0x2,0x61,0x304,0x2,0x41,0x306,0x1,0x103,0x2,
+    0x61,0x306,0x2,0x41,0x328,0x1,0x105,0x2,0x61,0x328,0x2,0x43,0x301,0x1,0x107,0x2,
+    0x63,0x301,0x2,0x43,0x302,0x1,0x109,0x2,0x63,0x302,0x2,0x43,0x307,0x1,0x10B,0x2,
+    0x63,0x307,0x2,0x43,0x30C,0x1,0x10D,0x2,0x63,0x30C,0x2,0x44,0x30C,0x1,0x10F,0x2,
+    0x64,0x30C,0x1,0x111,0x2,0x45,0x304,0x1,0x113,0x2,0x65,0x304,0x2,0x45,0x306,0x1,
+    0x115,0x2,0x65,0x306,0x2,0x45,0x307,0x1,0x117,0x2,0x65,0x307,0x2,0x45,0x328,0x1,
+    0x119,0x2,0x65,0x328,0x2,0x45,0x30C,0x1,0x11B,0x2,0x65,0x30C,0x2,0x47,0x302,0x1,
+    0x11D,0x2,0x67,0x302,0x2,0x47,0x306,0x1,0x11F,0x2,0x67,0x306,0x2,0x47,0x307,0x1,
+    0x121,0x2,0x67,0x307,0x2,0x47,0x327,0x1,0x123,0x2,0x67,0x327,0x2,0x48,0x302,0x1,
+    0x125,0x2,0x68,0x302,0x1,0x127,0x2,0x49,0x303,0x1,0x129,0x2,0x69,0x303,0x2,0x49,
+    0x304,0x1,0x12B,0x2,0x69,0x304,0x2,0x49,0x306,0x1,0x12D,0x2,0x69,0x306,0x2,0x49,
+    0x328,0x1,0x12F,0x2,0x69,0x328,0x2,0x49,0x307,0x2,0x69,0x307,0x2,0x49,0x4A,0x1,
+    0x133,0x2,0x69,0x6A,0x2,0x4A,0x302,0x1,0x135,0x2,0x6A,0x302,0x2,0x4B,0x327,0x1,
+    0x137,0x2,0x6B,0x327,0x2,0x4C,0x301,0x1,0x13A,0x2,0x6C,0x301,0x2,0x4C,0x327,0x1,
+    0x13C,0x2,0x6C,0x327,0x2,0x4C,0x30C,0x1,0x13E,0x2,0x6C,0x30C,0x2,0x4C,0xB7,0x1,
+    0x140,0x2,0x6C,0xB7,0x1,0x142,0x2,0x4E,0x301,0x1,0x144,0x2,0x6E,0x301,0x2,0x4E,
+    0x327,0x1,0x146,0x2,0x6E,0x327,0x2,0x4E,0x30C,0x1,0x148,0x2,0x6E,0x30C,0x2,0x2BC,
+    0x6E,0x1,0x14B,0x2,0x4F,0x304,0x1,0x14D,0x2,0x6F,0x304,0x2,0x4F,0x306,0x1,0x14F,
+    0x2,0x6F,0x306,0x2,0x4F,0x30B,0x1,0x151,0x2,0x6F,0x30B,0x1,0x153,0x2,0x52,0x301,
+    0x1,0x155,0x2,0x72,0x301,0x2,0x52,0x327,0x1,0x157,0x2,0x72,0x327,0x2,0x52,0x30C,
+    0x1,0x159,0x2,0x72,0x30C,0x2,0x53,0x301,0x1,0x15B,0x2,0x73,0x301,0x2,0x53,0x302,
+    0x1,0x15D,0x2,0x73,0x302,0x2,0x53,0x327,0x1,0x15F,0x2,0x73,0x327,0x2,0x53,0x30C,
+    0x1,0x161,0x2,0x73,0x30C,0x2,0x54,0x327,0x1,0x163,0x2,0x74,0x327,0x2,0x54,0x30C,
+    0x1,0x165,0x2,0x74,0x30C,0x1,0x167,0x2,0x55,0x303,0x1,0x169,0x2,0x75,0x303,0x2,
+    0x55,0x304,0x1,0x16B,0x2,0x75,0x304,0x2,0x55,0x306,0x1,0x16D,0x2,0x75,0x306,0x2,
+    0x55,0x30A,0x1,0x16F,0x2,0x75,0x30A,0x2,0x55,0x30B,0x1,0x171,0x2,0x75,0x30B,0x2,
+    0x55,0x328,0x1,0x173,0x2,0x75,0x328,0x2,0x57,0x302,0x1,0x175,0x2,0x77,0x302,0x2,
+    0x59,0x302,0x1,0x177,0x2,0x79,0x302,0x2,0x59,0x308,0x1,0xFF,0x2,0x5A,0x301,0x1,
+    0x17A,0x2,0x7A,0x301,0x2,0x5A,0x307,0x1,0x17C,0x2,0x7A,0x307,0x2,0x5A,0x30C,0x1,
+    0x17E,0x2,0x7A,0x30C,0x1,0x253,0x1,0x183,0x1,0x185,0x1,0x254,0x1,0x188,0x1,0x256,
+    0x1,0x257,0x1,0x18C,0x1,0x1DD,0x1,0x259,0x1,0x25B,0x1,0x192,0x1,0x260,0x1,0x263,
+    0x1,0x269,0x1,0x268,0x1,0x199,0x1,0x26F,0x1,0x272,0x1,0x275,0x2,0x4F,0x31B,0x1,
+    0x1A1,0x2,0x6F,0x31B,0x1,0x1A3,0x1,0x1A5,0x1,0x280,0x1,0x1A8,0x1,0x283,0x1,0x1AD,
+    0x1,0x288,0x2,0x55,0x31B,0x1,0x1B0,0x2,0x75,0x31B,0x1,0x28A,0x1,0x28B,0x1,0x1B4,
+    0x1,0x1B6,0x1,0x292,0x1,0x1B9,0x1,0x1BD,0x3,0x44,0x5A,0x30C,0x1,0x1C6,0x3,0x44,
+    0x7A,0x30C,0x3,0x64,0x7A,0x30C,0x2,0x4C,0x4A,0x1,0x1C9,0x2,0x4C,0x6A,0x2,0x6C,
+    0x6A,0x2,0x4E,0x4A,0x1,0x1CC,0x2,0x4E,0x6A,0x2,0x6E,0x6A,0x2,0x41,0x30C,0x1,
+    0x1CE,0x2,0x61,0x30C,0x2,0x49,0x30C,0x1,0x1D0,0x2,0x69,0x30C,0x2,0x4F,0x30C,0x1,
+    0x1D2,0x2,0x6F,0x30C,0x2,0x55,0x30C,0x1,0x1D4,0x2,0x75,0x30C,0x3,0x55,0x308,0x304,
+    0x1,0x1D6,0x3,0x75,0x308,0x304,0x3,0x55,0x308,0x301,0x1,0x1D8,0x3,0x75,0x308,0x301,
+    0x3,0x55,0x308,0x30C,0x1,0x1DA,0x3,0x75,0x308,0x30C,0x3,0x55,0x308,0x300,0x1,0x1DC,
+    0x3,0x75,0x308,0x300,0x3,0x41,0x308,0x304,0x1,0x1DF,0x3,0x61,0x308,0x304,0x3,0x41,
+    0x307,0x304,0x1,0x1E1,0x3,0x61,0x307,0x304,0x2,0xC6,0x304,0x1,0x1E3,0x2,0xE6,0x304,
+    0x1,0x1E5,0x2,0x47,0x30C,0x1,0x1E7,0x2,0x67,0x30C,0x2,0x4B,0x30C,0x1,0x1E9,0x2,
+    0x6B,0x30C,0x2,0x4F,0x328,0x1,0x1EB,0x2,0x6F,0x328,0x3,0x4F,0x328,0x304,0x1,0x1ED,
+    0x3,0x6F,0x328,0x304,0x2,0x1B7,0x30C,0x1,0x1EF,0x2,0x292,0x30C,0x2,0x6A,0x30C,0x2,
+    0x44,0x5A,0x1,0x1F3,0x2,0x44,0x7A,0x2,0x64,0x7A,0x2,0x47,0x301,0x1,0x1F5,0x2,
+    0x67,0x301,0x1,0x195,0x1,0x1BF,0x2,0x4E,0x300,0x1,0x1F9,0x2,0x6E,0x300,0x3,0x41,
+    0x30A,0x301,0x1,0x1FB,0x3,0x61,0x30A,0x301,0x2,0xC6,0x301,0x1,0x1FD,0x2,0xE6,0x301,
+    0x2,0xD8,0x301,0x1,0x1FF,0x2,0xF8,0x301,0x2,0x41,0x30F,0x1,0x201,0x2,0x61,0x30F,
+    0x2,0x41,0x311,0x1,0x203,0x2,0x61,0x311,0x2,0x45,0x30F,0x1,0x205,0x2,0x65,0x30F,
+    0x2,0x45,0x311,0x1,0x207,0x2,0x65,0x311,0x2,0x49,0x30F,0x1,0x209,0x2,0x69,0x30F,
+    0x2,0x49,0x311,0x1,0x20B,0x2,0x69,0x311,0x2,0x4F,0x30F,0x1,0x20D,0x2,0x6F,0x30F,
+    0x2,0x4F,0x311,0x1,0x20F,0x2,0x6F,0x311,0x2,0x52,0x30F,0x1,0x211,0x2,0x72,0x30F,
+    0x2,0x52,0x311,0x1,0x213,0x2,0x72,0x311,0x2,0x55,0x30F,0x1,0x215,0x2,0x75,0x30F,
+    0x2,0x55,0x311,0x1,0x217,0x2,0x75,0x311,0x2,0x53,0x326,0x1,0x219,0x2,0x73,0x326,
+    0x2,0x54,0x326,0x1,0x21B,0x2,0x74,0x326,0x1,0x21D,0x2,0x48,0x30C,0x1,0x21F,0x2,
+    0x68,0x30C,0x1,0x19E,0x1,0x223,0x1,0x225,0x2,0x41,0x307,0x1,0x227,0x2,0x61,0x307,
+    0x2,0x45,0x327,0x1,0x229,0x2,0x65,0x327,0x3,0x4F,0x308,0x304,0x1,0x22B,0x3,0x6F,
+    0x308,0x304,0x3,0x4F,0x303,0x304,0x1,0x22D,0x3,0x6F,0x303,0x304,0x2,0x4F,0x307,0x1,
+    0x22F,0x2,0x6F,0x307,0x3,0x4F,0x307,0x304,0x1,0x231,0x3,0x6F,0x307,0x304,0x2,0x59,
+    0x304,0x1,0x233,0x2,0x79,0x304,0x1,0x2C65,0x1,0x23C,0x1,0x19A,0x1,0x2C66,0x1,0x242,
+    0x1,0x180,0x1,0x289,0x1,0x28C,0x1,0x247,0x1,0x249,0x1,0x24B,0x1,0x24D,0x1,0x24F,
+    0x1,0x266,0x1,0x279,0x1,0x27B,0x1,0x281,0x2,0x20,0x306,0x2,0x20,0x307,0x2,0x20,
+    0x30A,0x2,0x20,0x328,0x2,0x20,0x303,0x2,0x20,0x30B,0x1,0x295,0x1,0x300,0x1,0x301,
+    0x1,0x313,0x2,0x308,0x301,0x1,0x371,0x1,0x373,0x1,0x2B9,0x1,0x377,0x2,0x20,0x345,
+    0x1,0x3B,0x1,0x3F3,0x2,0xA8,0x301,0x3,0x20,0x308,0x301,0x2,0x391,0x301,0x1,0x3AC,
+    0x1,0xB7,0x2,0x395,0x301,0x1,0x3AD,0x2,0x397,0x301,0x1,0x3AE,0x2,0x399,0x301,0x1,
+    0x3AF,0x2,0x39F,0x301,0x1,0x3CC,0x2,0x3A5,0x301,0x1,0x3CD,0x2,0x3A9,0x301,0x1,0x3CE,
+    0x3,0x3B9,0x308,0x301,0x1,0x3B1,0x1,0x3B2,0x1,0x3B3,0x1,0x3B4,0x1,0x3B5,0x1,0x3B6,
+    0x1,0x3B7,0x1,0x3B8,0x1,0x3B9,0x1,0x3BA,0x1,0x3BB,0x1,0x3BD,0x1,0x3BE,0x1,0x3BF,
+    0x1,0x3C0,0x1,0x3C1,0x1,0x3C3,0x1,0x3C4,0x1,0x3C5,0x1,0x3C6,0x1,0x3C7,0x1,0x3C8,
+    0x1,0x3C9,0x2,0x399,0x308,0x1,0x3CA,0x2,0x3A5,0x308,0x1,0x3CB,0x2,0x3B1,0x301,0x2,
+    0x3B5,0x301,0x2,0x3B7,0x301,0x2,0x3B9,0x301,0x3,0x3C5,0x308,0x301,0x2,0x3B9,0x308,0x2,
+    0x3C5,0x308,0x2,0x3BF,0x301,0x2,0x3C5,0x301,0x2,0x3C9,0x301,0x1,0x3D7,0x1,0x3A5,0x2,
+    0x3D2,0x301,0x2,0x3D2,0x308,0x1,0x3D9,0x1,0x3DB,0x1,0x3DD,0x1,0x3DF,0x1,0x3E1,0x1,
+    0x3E3,0x1,0x3E5,0x1,0x3E7,0x1,0x3E9,0x1,0x3EB,0x1,0x3ED,0x1,0x3EF,0x1,0x3C2,0x1,
+    0x398,0x1,0x3F8,0x1,0x3A3,0x1,0x3F2,0x1,0x3FB,0x1,0x37B,0x1,0x37C,0x1,0x37D,0x2,
+    0x415,0x300,0x1,0x450,0x2,0x415,0x308,0x1,0x451,0x1,0x452,0x2,0x413,0x301,0x1,0x453,
+    0x1,0x454,0x1,0x455,0x1,0x456,0x2,0x406,0x308,0x1,0x457,0x1,0x458,0x1,0x459,0x1,
+    0x45A,0x1,0x45B,0x2,0x41A,0x301,0x1,0x45C,0x2,0x418,0x300,0x1,0x45D,0x2,0x423,0x306,
+    0x1,0x45E,0x1,0x45F,0x1,0x430,0x1,0x431,0x1,0x432,0x1,0x433,0x1,0x434,0x1,0x435,
+    0x1,0x436,0x1,0x437,0x1,0x438,0x2,0x418,0x306,0x1,0x439,0x1,0x43A,0x1,0x43B,0x1,
+    0x43C,0x1,0x43D,0x1,0x43E,0x1,0x43F,0x1,0x440,0x1,0x441,0x1,0x442,0x1,0x443,0x1,
+    0x444,0x1,0x445,0x1,0x446,0x1,0x447,0x1,0x448,0x1,0x449,0x1,0x44A,0x1,0x44B,0x1,
+    0x44C,0x1,0x44D,0x1,0x44E,0x1,0x44F,0x2,0x438,0x306,0x2,0x435,0x300,0x2,0x435,0x308,
+    0x2,0x433,0x301,0x2,0x456,0x308,0x2,0x43A,0x301,0x2,0x438,0x300,0x2,0x443,0x306,0x1,
+    0x461,0x1,0x463,0x1,0x465,0x1,0x467,0x1,0x469,0x1,0x46B,0x1,0x46D,0x1,0x46F,0x1,
+    0x471,0x1,0x473,0x1,0x475,0x2,0x474,0x30F,0x1,0x477,0x2,0x475,0x30F,0x1,0x479,0x1,
+    0x47B,0x1,0x47D,0x1,0x47F,0x1,0x481,0x1,0x48B,0x1,0x48D,0x1,0x48F,0x1,0x491,0x1,
+    0x493,0x1,0x495,0x1,0x497,0x1,0x499,0x1,0x49B,0x1,0x49D,0x1,0x49F,0x1,0x4A1,0x1,
+    0x4A3,0x1,0x4A5,0x1,0x4A7,0x1,0x4A9,0x1,0x4AB,0x1,0x4AD,0x1,0x4AF,0x1,0x4B1,0x1,
+    0x4B3,0x1,0x4B5,0x1,0x4B7,0x1,0x4B9,0x1,0x4BB,0x1,0x4BD,0x1,0x4BF,0x1,0x4CF,0x2,
+    0x416,0x306,0x1,0x4C2,0x2,0x436,0x306,0x1,0x4C4,0x1,0x4C6,0x1,0x4C8,0x1,0x4CA,0x1,
+    0x4CC,0x1,0x4CE,0x2,0x410,0x306,0x1,0x4D1,0x2,0x430,0x306,0x2,0x410,0x308,0x1,0x4D3,
+    0x2,0x430,0x308,0x1,0x4D5,0x2,0x415,0x306,0x1,0x4D7,0x2,0x435,0x306,0x1,0x4D9,0x2,
+    0x4D8,0x308,0x1,0x4DB,0x2,0x4D9,0x308,0x2,0x416,0x308,0x1,0x4DD,0x2,0x436,0x308,0x2,
+    0x417,0x308,0x1,0x4DF,0x2,0x437,0x308,0x1,0x4E1,0x2,0x418,0x304,0x1,0x4E3,0x2,0x438,
+    0x304,0x2,0x418,0x308,0x1,0x4E5,0x2,0x438,0x308,0x2,0x41E,0x308,0x1,0x4E7,0x2,0x43E,
+    0x308,0x1,0x4E9,0x2,0x4E8,0x308,0x1,0x4EB,0x2,0x4E9,0x308,0x2,0x42D,0x308,0x1,0x4ED,
+    0x2,0x44D,0x308,0x2,0x423,0x304,0x1,0x4EF,0x2,0x443,0x304,0x2,0x423,0x308,0x1,0x4F1,
+    0x2,0x443,0x308,0x2,0x423,0x30B,0x1,0x4F3,0x2,0x443,0x30B,0x2,0x427,0x308,0x1,0x4F5,
+    0x2,0x447,0x308,0x1,0x4F7,0x2,0x42B,0x308,0x1,0x4F9,0x2,0x44B,0x308,0x1,0x4FB,0x1,
+    0x4FD,0x1,0x4FF,0x1,0x501,0x1,0x503,0x1,0x505,0x1,0x507,0x1,0x509,0x1,0x50B,0x1,
+    0x50D,0x1,0x50F,0x1,0x511,0x1,0x513,0x1,0x515,0x1,0x517,0x1,0x519,0x1,0x51B,0x1,
+    0x51D,0x1,0x51F,0x1,0x521,0x1,0x523,0x1,0x525,0x1,0x527,0x1,0x529,0x1,0x52B,0x1,
+    0x52D,0x1,0x52F,0x1,0x561,0x1,0x562,0x1,0x563,0x1,0x564,0x1,0x565,0x1,0x566,0x1,
+    0x567,0x1,0x568,0x1,0x569,0x1,0x56A,0x1,0x56B,0x1,0x56C,0x1,0x56D,0x1,0x56E,0x1,
+    0x56F,0x1,0x570,0x1,0x571,0x1,0x572,0x1,0x573,0x1,0x574,0x1,0x575,0x1,0x576,0x1,
+    0x577,0x1,0x578,0x1,0x579,0x1,0x57A,0x1,0x57B,0x1,0x57C,0x1,0x57D,0x1,0x57E,0x1,
+    0x57F,0x1,0x580,0x1,0x581,0x1,0x582,0x1,0x583,0x1,0x584,0x1,0x585,0x1,0x586,0x2,
+    0x565,0x582,0x2,0x627,0x653,0x2,0x627,0x654,0x2,0x648,0x654,0x2,0x627,0x655,0x2,0x64A,
+    0x654,0x2,0x627,0x674,0x2,0x648,0x674,0x2,0x6C7,0x674,0x2,0x64A,0x674,0x2,0x6D5,0x654,
+    0x2,0x6C1,0x654,0x2,0x6D2,0x654,0x2,0x928,0x93C,0x2,0x930,0x93C,0x2,0x933,0x93C,0x2,
+    0x915,0x93C,0x2,0x916,0x93C,0x2,0x917,0x93C,0x2,0x91C,0x93C,0x2,0x921,0x93C,0x2,0x922,
+    0x93C,0x2,0x92B,0x93C,0x2,0x92F,0x93C,0x2,0x9C7,0x9BE,0x2,0x9C7,0x9D7,0x2,0x9A1,0x9BC,
+    0x2,0x9A2,0x9BC,0x2,0x9AF,0x9BC,0x2,0xA32,0xA3C,0x2,0xA38,0xA3C,0x2,0xA16,0xA3C,0x2,
+    0xA17,0xA3C,0x2,0xA1C,0xA3C,0x2,0xA2B,0xA3C,0x2,0xB47,0xB56,0x2,0xB47,0xB3E,0x2,0xB47,
+    0xB57,0x2,0xB21,0xB3C,0x2,0xB22,0xB3C,0x2,0xB92,0xBD7,0x2,0xBC6,0xBBE,0x2,0xBC7,0xBBE,
+    0x2,0xBC6,0xBD7,0x2,0xC46,0xC56,0x2,0xCBF,0xCD5,0x2,0xCC6,0xCD5,0x2,0xCC6,0xCD6,0x2,
+    0xCC6,0xCC2,0x3,0xCC6,0xCC2,0xCD5,0x2,0xD46,0xD3E,0x2,0xD47,0xD3E,0x2,0xD46,0xD57,0x2,
+    0xDD9,0xDCA,0x2,0xDD9,0xDCF,0x3,0xDD9,0xDCF,0xDCA,0x2,0xDD9,0xDDF,0x2,0xE4D,0xE32,0x2,
+    0xECD,0xEB2,0x2,0xEAB,0xE99,0x2,0xEAB,0xEA1,0x1,0xF0B,0x2,0xF42,0xFB7,0x2,0xF4C,0xFB7,
+    0x2,0xF51,0xFB7,0x2,0xF56,0xFB7,0x2,0xF5B,0xFB7,0x2,0xF40,0xFB5,0x2,0xF71,0xF72,0x2,
+    0xF71,0xF74,0x2,0xFB2,0xF80,0x3,0xFB2,0xF71,0xF80,0x2,0xFB3,0xF80,0x3,0xFB3,0xF71,0xF80,
+    0x2,0xF71,0xF80,0x2,0xF92,0xFB7,0x2,0xF9C,0xFB7,0x2,0xFA1,0xFB7,0x2,0xFA6,0xFB7,0x2,
+    0xFAB,0xFB7,0x2,0xF90,0xFB5,0x2,0x1025,0x102E,0x1,0x2D00,0x1,0x2D01,0x1,0x2D02,0x1,0x2D03,
+    0x1,0x2D04,0x1,0x2D05,0x1,0x2D06,0x1,0x2D07,0x1,0x2D08,0x1,0x2D09,0x1,0x2D0A,0x1,0x2D0B,
+    0x1,0x2D0C,0x1,0x2D0D,0x1,0x2D0E,0x1,0x2D0F,0x1,0x2D10,0x1,0x2D11,0x1,0x2D12,0x1,0x2D13,
+    0x1,0x2D14,0x1,0x2D15,0x1,0x2D16,0x1,0x2D17,0x1,0x2D18,0x1,0x2D19,0x1,0x2D1A,0x1,0x2D1B,
+    0x1,0x2D1C,0x1,0x2D1D,0x1,0x2D1E,0x1,0x2D1F,0x1,0x2D20,0x1,0x2D21,0x1,0x2D22,0x1,0x2D23,
+    0x1,0x2D24,0x1,0x2D25,0x1,0x2D27,0x1,0x2D2D,0x1,0x10DC,0x1,0xAB70,0x1,0xAB71,0x1,0xAB72,
+    0x1,0xAB73,0x1,0xAB74,0x1,0xAB75,0x1,0xAB76,0x1,0xAB77,0x1,0xAB78,0x1,0xAB79,0x1,0xAB7A,
+    0x1,0xAB7B,0x1,0xAB7C,0x1,0xAB7D,0x1,0xAB7E,0x1,0xAB7F,0x1,0xAB80,0x1,0xAB81,0x1,0xAB82,
+    0x1,0xAB83,0x1,0xAB84,0x1,0xAB85,0x1,0xAB86,0x1,0xAB87,0x1,0xAB88,0x1,0xAB89,0x1,0xAB8A,
+    0x1,0xAB8B,0x1,0xAB8C,0x1,0xAB8D,0x1,0xAB8E,0x1,0xAB8F,0x1,0xAB90,0x1,0xAB91,0x1,0xAB92,
+    0x1,0xAB93,0x1,0xAB94,0x1,0xAB95,0x1,0xAB96,0x1,0xAB97,0x1,0xAB98,0x1,0xAB99,0x1,0xAB9A,
+    0x1,0xAB9B,0x1,0xAB9C,0x1,0xAB9D,0x1,0xAB9E,0x1,0xAB9F,0x1,0xABA0,0x1,0xABA1,0x1,0xABA2,
+    0x1,0xABA3,0x1,0xABA4,0x1,0xABA5,0x1,0xABA6,0x1,0xABA7,0x1,0xABA8,0x1,0xABA9,0x1,0xABAA,
+    0x1,0xABAB,0x1,0xABAC,0x1,0xABAD,0x1,0xABAE,0x1,0xABAF,0x1,0xABB0,0x1,0xABB1,0x1,0xABB2,
+    0x1,0xABB3,0x1,0xABB4,0x1,0xABB5,0x1,0xABB6,0x1,0xABB7,0x1,0xABB8,0x1,0xABB9,0x1,0xABBA,
+    0x1,0xABBB,0x1,0xABBC,0x1,0xABBD,0x1,0xABBE,0x1,0xABBF,0x1,0x13F8,0x1,0x13F9,0x1,0x13FA,
+    0x1,0x13FB,0x1,0x13FC,0x1,0x13FD,0x2,0x1B05,0x1B35,0x2,0x1B07,0x1B35,0x2,0x1B09,0x1B35,0x2,
+    0x1B0B,0x1B35,0x2,0x1B0D,0x1B35,0x2,0x1B11,0x1B35,0x2,0x1B3A,0x1B35,0x2,0x1B3C,0x1B35,0x2,0x1B3E,
+    0x1B35,0x2,0x1B3F,0x1B35,0x2,0x1B42,0x1B35,0x1,0x10D0,0x1,0x10D1,0x1,0x10D2,0x1,0x10D3,0x1,
+    0x10D4,0x1,0x10D5,0x1,0x10D6,0x1,0x10D7,0x1,0x10D8,0x1,0x10D9,0x1,0x10DA,0x1,0x10DB,0x1,
+    0x10DD,0x1,0x10DE,0x1,0x10DF,0x1,0x10E0,0x1,0x10E1,0x1,0x10E2,0x1,0x10E3,0x1,0x10E4,0x1,
+    0x10E5,0x1,0x10E6,0x1,0x10E7,0x1,0x10E8,0x1,0x10E9,0x1,0x10EA,0x1,0x10EB,0x1,0x10EC,0x1,
+    0x10ED,0x1,0x10EE,0x1,0x10EF,0x1,0x10F0,0x1,0x10F1,0x1,0x10F2,0x1,0x10F3,0x1,0x10F4,0x1,
+    0x10F5,0x1,0x10F6,0x1,0x10F7,0x1,0x10F8,0x1,0x10F9,0x1,0x10FA,0x1,0x10FD,0x1,0x10FE,0x1,
+    0x10FF,0x1,0x41,0x1,0xC6,0x1,0x42,0x1,0x44,0x1,0x45,0x1,0x18E,0x1,0x47,0x1,
+    0x48,0x1,0x49,0x1,0x4A,0x1,0x4B,0x1,0x4C,0x1,0x4D,0x1,0x4E,0x1,0x4F,0x1,
+    0x222,0x1,0x50,0x1,0x52,0x1,0x54,0x1,0x55,0x1,0x57,0x1,0x250,0x1,0x251,0x1,
+    0x1D02,0x1,0x25C,0x1,0x1D16,0x1,0x1D17,0x1,0x1D1D,0x1,0x1D25,0x1,0x252,0x1,0x255,0x1,
+    0x25F,0x1,0x261,0x1,0x265,0x1,0x26A,0x1,0x1D7B,0x1,0x29D,0x1,0x26D,0x1,0x1D85,0x1,
+    0x29F,0x1,0x271,0x1,0x270,0x1,0x273,0x1,0x274,0x1,0x278,0x1,0x282,0x1,0x1AB,0x1,
+    0x1D1C,0x1,0x290,0x1,0x291,0x2,0x41,0x325,0x1,0x1E01,0x2,0x61,0x325,0x2,0x42,0x307,
+    0x1,0x1E03,0x2,0x62,0x307,0x2,0x42,0x323,0x1,0x1E05,0x2,0x62,0x323,0x2,0x42,0x331,
+    0x1,0x1E07,0x2,0x62,0x331,0x3,0x43,0x327,0x301,0x1,0x1E09,0x3,0x63,0x327,0x301,0x2,
+    0x44,0x307,0x1,0x1E0B,0x2,0x64,0x307,0x2,0x44,0x323,0x1,0x1E0D,0x2,0x64,0x323,0x2,
+    0x44,0x331,0x1,0x1E0F,0x2,0x64,0x331,0x2,0x44,0x327,0x1,0x1E11,0x2,0x64,0x327,0x2,
+    0x44,0x32D,0x1,0x1E13,0x2,0x64,0x32D,0x3,0x45,0x304,0x300,0x1,0x1E15,0x3,0x65,0x304,
+    0x300,0x3,0x45,0x304,0x301,0x1,0x1E17,0x3,0x65,0x304,0x301,0x2,0x45,0x32D,0x1,0x1E19,
+    0x2,0x65,0x32D,0x2,0x45,0x330,0x1,0x1E1B,0x2,0x65,0x330,0x3,0x45,0x327,0x306,0x1,
+    0x1E1D,0x3,0x65,0x327,0x306,0x2,0x46,0x307,0x1,0x1E1F,0x2,0x66,0x307,0x2,0x47,0x304,
+    0x1,0x1E21,0x2,0x67,0x304,0x2,0x48,0x307,0x1,0x1E23,0x2,0x68,0x307,0x2,0x48,0x323,
+    0x1,0x1E25,0x2,0x68,0x323,0x2,0x48,0x308,0x1,0x1E27,0x2,0x68,0x308,0x2,0x48,0x327,
+    0x1,0x1E29,0x2,0x68,0x327,0x2,0x48,0x32E,0x1,0x1E2B,0x2,0x68,0x32E,0x2,0x49,0x330,
+    0x1,0x1E2D,0x2,0x69,0x330,0x3,0x49,0x308,0x301,0x1,0x1E2F,0x3,0x69,0x308,0x301,0x2,
+    0x4B,0x301,0x1,0x1E31,0x2,0x6B,0x301,0x2,0x4B,0x323,0x1,0x1E33,0x2,0x6B,0x323,0x2,
+    0x4B,0x331,0x1,0x1E35,0x2,0x6B,0x331,0x2,0x4C,0x323,0x1,0x1E37,0x2,0x6C,0x323,0x3,
+    0x4C,0x323,0x304,0x1,0x1E39,0x3,0x6C,0x323,0x304,0x2,0x4C,0x331,0x1,0x1E3B,0x2,0x6C,
+    0x331,0x2,0x4C,0x32D,0x1,0x1E3D,0x2,0x6C,0x32D,0x2,0x4D,0x301,0x1,0x1E3F,0x2,0x6D,
+    0x301,0x2,0x4D,0x307,0x1,0x1E41,0x2,0x6D,0x307,0x2,0x4D,0x323,0x1,0x1E43,0x2,0x6D,
+    0x323,0x2,0x4E,0x307,0x1,0x1E45,0x2,0x6E,0x307,0x2,0x4E,0x323,0x1,0x1E47,0x2,0x6E,
+    0x323,0x2,0x4E,0x331,0x1,0x1E49,0x2,0x6E,0x331,0x2,0x4E,0x32D,0x1,0x1E4B,0x2,0x6E,
+    0x32D,0x3,0x4F,0x303,0x301,0x1,0x1E4D,0x3,0x6F,0x303,0x301,0x3,0x4F,0x303,0x308,0x1,
+    0x1E4F,0x3,0x6F,0x303,0x308,0x3,0x4F,0x304,0x300,0x1,0x1E51,0x3,0x6F,0x304,0x300,0x3,
+    0x4F,0x304,0x301,0x1,0x1E53,0x3,0x6F,0x304,0x301,0x2,0x50,0x301,0x1,0x1E55,0x2,0x70,
+    0x301,0x2,0x50,0x307,0x1,0x1E57,0x2,0x70,0x307,0x2,0x52,0x307,0x1,0x1E59,0x2,0x72,
+    0x307,0x2,0x52,0x323,0x1,0x1E5B,0x2,0x72,0x323,0x3,0x52,0x323,0x304,0x1,0x1E5D,0x3,
+    0x72,0x323,0x304,0x2,0x52,0x331,0x1,0x1E5F,0x2,0x72,0x331,0x2,0x53,0x307,0x1,0x1E61,
+    0x2,0x73,0x307,0x2,0x53,0x323,0x1,0x1E63,0x2,0x73,0x323,0x3,0x53,0x301,0x307,0x1,
+    0x1E65,0x3,0x73,0x301,0x307,0x3,0x53,0x30C,0x307,0x1,0x1E67,0x3,0x73,0x30C,0x307,0x3,
+    0x53,0x323,0x307,0x1,0x1E69,0x3,0x73,0x323,0x307,0x2,0x54,0x307,0x1,0x1E6B,0x2,0x74,
+    0x307,0x2,0x54,0x323,0x1,0x1E6D,0x2,0x74,0x323,0x2,0x54,0x331,0x1,0x1E6F,0x2,0x74,
+    0x331,0x2,0x54,0x32D,0x1,0x1E71,0x2,0x74,0x32D,0x2,0x55,0x324,0x1,0x1E73,0x2,0x75,
+    0x324,0x2,0x55,0x330,0x1,0x1E75,0x2,0x75,0x330,0x2,0x55,0x32D,0x1,0x1E77,0x2,0x75,
+    0x32D,0x3,0x55,0x303,0x301,0x1,0x1E79,0x3,0x75,0x303,0x301,0x3,0x55,0x304,0x308,0x1,
+    0x1E7B,0x3,0x75,0x304,0x308,0x2,0x56,0x303,0x1,0x1E7D,0x2,0x76,0x303,0x2,0x56,0x323,
+    0x1,0x1E7F,0x2,0x76,0x323,0x2,0x57,0x300,0x1,0x1E81,0x2,0x77,0x300,0x2,0x57,0x301,
+    0x1,0x1E83,0x2,0x77,0x301,0x2,0x57,0x308,0x1,0x1E85,0x2,0x77,0x308,0x2,0x57,0x307,
+    0x1,0x1E87,0x2,0x77,0x307,0x2,0x57,0x323,0x1,0x1E89,0x2,0x77,0x323,0x2,0x58,0x307,
+    0x1,0x1E8B,0x2,0x78,0x307,0x2,0x58,0x308,0x1,0x1E8D,0x2,0x78,0x308,0x2,0x59,0x307,
+    0x1,0x1E8F,0x2,0x79,0x307,0x2,0x5A,0x302,0x1,0x1E91,0x2,0x7A,0x302,0x2,0x5A,0x323,
+    0x1,0x1E93,0x2,0x7A,0x323,0x2,0x5A,0x331,0x1,0x1E95,0x2,0x7A,0x331,0x2,0x68,0x331,
+    0x2,0x74,0x308,0x2,0x77,0x30A,0x2,0x79,0x30A,0x2,0x61,0x2BE,0x2,0x17F,0x307,0x1,
+    0xDF,0x2,0x41,0x323,0x1,0x1EA1,0x2,0x61,0x323,0x2,0x41,0x309,0x1,0x1EA3,0x2,0x61,
+    0x309,0x3,0x41,0x302,0x301,0x1,0x1EA5,0x3,0x61,0x302,0x301,0x3,0x41,0x302,0x300,0x1,
+    0x1EA7,0x3,0x61,0x302,0x300,0x3,0x41,0x302,0x309,0x1,0x1EA9,0x3,0x61,0x302,0x309,0x3,
+    0x41,0x302,0x303,0x1,0x1EAB,0x3,0x61,0x302,0x303,0x3,0x41,0x323,0x302,0x1,0x1EAD,0x3,
+    0x61,0x323,0x302,0x3,0x41,0x306,0x301,0x1,0x1EAF,0x3,0x61,0x306,0x301,0x3,0x41,0x306,
+    0x300,0x1,0x1EB1,0x3,0x61,0x306,0x300,0x3,0x41,0x306,0x309,0x1,0x1EB3,0x3,0x61,0x306,
+    0x309,0x3,0x41,0x306,0x303,0x1,0x1EB5,0x3,0x61,0x306,0x303,0x3,0x41,0x323,0x306,0x1,
+    0x1EB7,0x3,0x61,0x323,0x306,0x2,0x45,0x323,0x1,0x1EB9,0x2,0x65,0x323,0x2,0x45,0x309,
+    0x1,0x1EBB,0x2,0x65,0x309,0x2,0x45,0x303,0x1,0x1EBD,0x2,0x65,0x303,0x3,0x45,0x302,
+    0x301,0x1,0x1EBF,0x3,0x65,0x302,0x301,0x3,0x45,0x302,0x300,0x1,0x1EC1,0x3,0x65,0x302,
+    0x300,0x3,0x45,0x302,0x309,0x1,0x1EC3,0x3,0x65,0x302,0x309,0x3,0x45,0x302,0x303,0x1,
+    0x1EC5,0x3,0x65,0x302,0x303,0x3,0x45,0x323,0x302,0x1,0x1EC7,0x3,0x65,0x323,0x302,0x2,
+    0x49,0x309,0x1,0x1EC9,0x2,0x69,0x309,0x2,0x49,0x323,0x1,0x1ECB,0x2,0x69,0x323,0x2,
+    0x4F,0x323,0x1,0x1ECD,0x2,0x6F,0x323,0x2,0x4F,0x309,0x1,0x1ECF,0x2,0x6F,0x309,0x3,
+    0x4F,0x302,0x301,0x1,0x1ED1,0x3,0x6F,0x302,0x301,0x3,0x4F,0x302,0x300,0x1,0x1ED3,0x3,
+    0x6F,0x302,0x300,0x3,0x4F,0x302,0x309,0x1,0x1ED5,0x3,0x6F,0x302,0x309,0x3,0x4F,0x302,
+    0x303,0x1,0x1ED7,0x3,0x6F,0x302,0x303,0x3,0x4F,0x323,0x302,0x1,0x1ED9,0x3,0x6F,0x323,
+    0x302,0x3,0x4F,0x31B,0x301,0x1,0x1EDB,0x3,0x6F,0x31B,0x301,0x3,0x4F,0x31B,0x300,0x1,
+    0x1EDD,0x3,0x6F,0x31B,0x300,0x3,0x4F,0x31B,0x309,0x1,0x1EDF,0x3,0x6F,0x31B,0x309,0x3,
+    0x4F,0x31B,0x303,0x1,0x1EE1,0x3,0x6F,0x31B,0x303,0x3,0x4F,0x31B,0x323,0x1,0x1EE3,0x3,
+    0x6F,0x31B,0x323,0x2,0x55,0x323,0x1,0x1EE5,0x2,0x75,0x323,0x2,0x55,0x309,0x1,0x1EE7,
+    0x2,0x75,0x309,0x3,0x55,0x31B,0x301,0x1,0x1EE9,0x3,0x75,0x31B,0x301,0x3,0x55,0x31B,
+    0x300,0x1,0x1EEB,0x3,0x75,0x31B,0x300,0x3,0x55,0x31B,0x309,0x1,0x1EED,0x3,0x75,0x31B,
+    0x309,0x3,0x55,0x31B,0x303,0x1,0x1EEF,0x3,0x75,0x31B,0x303,0x3,0x55,0x31B,0x323,0x1,
+    0x1EF1,0x3,0x75,0x31B,0x323,0x2,0x59,0x300,0x1,0x1EF3,0x2,0x79,0x300,0x2,0x59,0x323,
+    0x1,0x1EF5,0x2,0x79,0x323,0x2,0x59,0x309,0x1,0x1EF7,0x2,0x79,0x309,0x2,0x59,0x303,
+    0x1,0x1EF9,0x2,0x79,0x303,0x1,0x1EFB,0x1,0x1EFD,0x1,0x1EFF,0x2,0x3B1,0x313,0x2,0x3B1,
+    0x314,0x3,0x3B1,0x313,0x300,0x3,0x3B1,0x314,0x300,0x3,0x3B1,0x313,0x301,0x3,0x3B1,0x314,
+    0x301,0x3,0x3B1,0x313,0x342,0x3,0x3B1,0x314,0x342,0x2,0x391,0x313,0x1,0x1F00,0x2,0x391,
+    0x314,0x1,0x1F01,0x3,0x391,0x313,0x300,0x1,0x1F02,0x3,0x391,0x314,0x300,0x1,0x1F03,0x3,
+    0x391,0x313,0x301,0x1,0x1F04,0x3,0x391,0x314,0x301,0x1,0x1F05,0x3,0x391,0x313,0x342,0x1,
+    0x1F06,0x3,0x391,0x314,0x342,0x1,0x1F07,0x2,0x3B5,0x313,0x2,0x3B5,0x314,0x3,0x3B5,0x313,
+    0x300,0x3,0x3B5,0x314,0x300,0x3,0x3B5,0x313,0x301,0x3,0x3B5,0x314,0x301,0x2,0x395,0x313,
+    0x1,0x1F10,0x2,0x395,0x314,0x1,0x1F11,0x3,0x395,0x313,0x300,0x1,0x1F12,0x3,0x395,0x314,
+    0x300,0x1,0x1F13,0x3,0x395,0x313,0x301,0x1,0x1F14,0x3,0x395,0x314,0x301,0x1,0x1F15,0x2,
+    0x3B7,0x313,0x2,0x3B7,0x314,0x3,0x3B7,0x313,0x300,0x3,0x3B7,0x314,0x300,0x3,0x3B7,0x313,
+    0x301,0x3,0x3B7,0x314,0x301,0x3,0x3B7,0x313,0x342,0x3,0x3B7,0x314,0x342,0x2,0x397,0x313,
+    0x1,0x1F20,0x2,0x397,0x314,0x1,0x1F21,0x3,0x397,0x313,0x300,0x1,0x1F22,0x3,0x397,0x314,
+    0x300,0x1,0x1F23,0x3,0x397,0x313,0x301,0x1,0x1F24,0x3,0x397,0x314,0x301,0x1,0x1F25,0x3,
+    0x397,0x313,0x342,0x1,0x1F26,0x3,0x397,0x314,0x342,0x1,0x1F27,0x2,0x3B9,0x313,0x2,0x3B9,
+    0x314,0x3,0x3B9,0x313,0x300,0x3,0x3B9,0x314,0x300,0x3,0x3B9,0x313,0x301,0x3,0x3B9,0x314,
+    0x301,0x3,0x3B9,0x313,0x342,0x3,0x3B9,0x314,0x342,0x2,0x399,0x313,0x1,0x1F30,0x2,0x399,
+    0x314,0x1,0x1F31,0x3,0x399,0x313,0x300,0x1,0x1F32,0x3,0x399,0x314,0x300,0x1,0x1F33,0x3,
+    0x399,0x313,0x301,0x1,0x1F34,0x3,0x399,0x314,0x301,0x1,0x1F35,0x3,0x399,0x313,0x342,0x1,
+    0x1F36,0x3,0x399,0x314,0x342,0x1,0x1F37,0x2,0x3BF,0x313,0x2,0x3BF,0x314,0x3,0x3BF,0x313,
+    0x300,0x3,0x3BF,0x314,0x300,0x3,0x3BF,0x313,0x301,0x3,0x3BF,0x314,0x301,0x2,0x39F,0x313,
+    0x1,0x1F40,0x2,0x39F,0x314,0x1,0x1F41,0x3,0x39F,0x313,0x300,0x1,0x1F42,0x3,0x39F,0x314,
+    0x300,0x1,0x1F43,0x3,0x39F,0x313,0x301,0x1,0x1F44,0x3,0x39F,0x314,0x301,0x1,0x1F45,0x2,
+    0x3C5,0x313,0x2,0x3C5,0x314,0x3,0x3C5,0x313,0x300,0x3,0x3C5,0x314,0x300,0x3,0x3C5,0x313,
+    0x301,0x3,0x3C5,0x314,0x301,0x3,0x3C5,0x313,0x342,0x3,0x3C5,0x314,0x342,0x2,0x3A5,0x314,
+    0x1,0x1F51,0x3,0x3A5,0x314,0x300,0x1,0x1F53,0x3,0x3A5,0x314,0x301,0x1,0x1F55,0x3,0x3A5,
+    0x314,0x342,0x1,0x1F57,0x2,0x3C9,0x313,0x2,0x3C9,0x314,0x3,0x3C9,0x313,0x300,0x3,0x3C9,
+    0x314,0x300,0x3,0x3C9,0x313,0x301,0x3,0x3C9,0x314,0x301,0x3,0x3C9,0x313,0x342,0x3,0x3C9,
+    0x314,0x342,0x2,0x3A9,0x313,0x1,0x1F60,0x2,0x3A9,0x314,0x1,0x1F61,0x3,0x3A9,0x313,0x300,
+    0x1,0x1F62,0x3,0x3A9,0x314,0x300,0x1,0x1F63,0x3,0x3A9,0x313,0x301,0x1,0x1F64,0x3,0x3A9,
+    0x314,0x301,0x1,0x1F65,0x3,0x3A9,0x313,0x342,0x1,0x1F66,0x3,0x3A9,0x314,0x342,0x1,0x1F67,
+    0x2,0x3B1,0x300,0x2,0x3B5,0x300,0x2,0x3B7,0x300,0x2,0x3B9,0x300,0x2,0x3BF,0x300,0x2,
+    0x3C5,0x300,0x2,0x3C9,0x300,0x3,0x3B1,0x313,0x345,0x3,0x3B1,0x314,0x345,0x4,0x3B1,0x313,
+    0x300,0x345,0x4,0x3B1,0x314,0x300,0x345,0x4,0x3B1,0x313,0x301,0x345,0x4,0x3B1,0x314,0x301,
+    0x345,0x4,0x3B1,0x313,0x342,0x345,0x4,0x3B1,0x314,0x342,0x345,0x3,0x391,0x313,0x345,0x1,
+    0x1F80,0x3,0x391,0x314,0x345,0x1,0x1F81,0x4,0x391,0x313,0x300,0x345,0x1,0x1F82,0x4,0x391,
+    0x314,0x300,0x345,0x1,0x1F83,0x4,0x391,0x313,0x301,0x345,0x1,0x1F84,0x4,0x391,0x314,0x301,
+    0x345,0x1,0x1F85,0x4,0x391,0x313,0x342,0x345,0x1,0x1F86,0x4,0x391,0x314,0x342,0x345,0x1,
+    0x1F87,0x3,0x3B7,0x313,0x345,0x3,0x3B7,0x314,0x345,0x4,0x3B7,0x313,0x300,0x345,0x4,0x3B7,
+    0x314,0x300,0x345,0x4,0x3B7,0x313,0x301,0x345,0x4,0x3B7,0x314,0x301,0x345,0x4,0x3B7,0x313,
+    0x342,0x345,0x4,0x3B7,0x314,0x342,0x345,0x3,0x397,0x313,0x345,0x1,0x1F90,0x3,0x397,0x314,
+    0x345,0x1,0x1F91,0x4,0x397,0x313,0x300,0x345,0x1,0x1F92,0x4,0x397,0x314,0x300,0x345,0x1,
+    0x1F93,0x4,0x397,0x313,0x301,0x345,0x1,0x1F94,0x4,0x397,0x314,0x301,0x345,0x1,0x1F95,0x4,
+    0x397,0x313,0x342,0x345,0x1,0x1F96,0x4,0x397,0x314,0x342,0x345,0x1,0x1F97,0x3,0x3C9,0x313,
+    0x345,0x3,0x3C9,0x314,0x345,0x4,0x3C9,0x313,0x300,0x345,0x4,0x3C9,0x314,0x300,0x345,0x4,
+    0x3C9,0x313,0x301,0x345,0x4,0x3C9,0x314,0x301,0x345,0x4,0x3C9,0x313,0x342,0x345,0x4,0x3C9,
+    0x314,0x342,0x345,0x3,0x3A9,0x313,0x345,0x1,0x1FA0,0x3,0x3A9,0x314,0x345,0x1,0x1FA1,0x4,
+    0x3A9,0x313,0x300,0x345,0x1,0x1FA2,0x4,0x3A9,0x314,0x300,0x345,0x1,0x1FA3,0x4,0x3A9,0x313,
+    0x301,0x345,0x1,0x1FA4,0x4,0x3A9,0x314,0x301,0x345,0x1,0x1FA5,0x4,0x3A9,0x313,0x342,0x345,
+    0x1,0x1FA6,0x4,0x3A9,0x314,0x342,0x345,0x1,0x1FA7,0x2,0x3B1,0x306,0x2,0x3B1,0x304,0x3,
+    0x3B1,0x300,0x345,0x2,0x3B1,0x345,0x3,0x3B1,0x301,0x345,0x2,0x3B1,0x342,0x3,0x3B1,0x342,
+    0x345,0x2,0x391,0x306,0x1,0x1FB0,0x2,0x391,0x304,0x1,0x1FB1,0x2,0x391,0x300,0x1,0x1F70,
+    0x1,0x1F71,0x2,0x391,0x345,0x1,0x1FB3,0x2,0x20,0x313,0x2,0x20,0x342,0x2,0xA8,0x342,
+    0x3,0x20,0x308,0x342,0x3,0x3B7,0x300,0x345,0x2,0x3B7,0x345,0x3,0x3B7,0x301,0x345,0x2,
+    0x3B7,0x342,0x3,0x3B7,0x342,0x345,0x2,0x395,0x300,0x1,0x1F72,0x1,0x1F73,0x2,0x397,0x300,
+    0x1,0x1F74,0x1,0x1F75,0x2,0x397,0x345,0x1,0x1FC3,0x2,0x1FBF,0x300,0x3,0x20,0x313,0x300,
+    0x2,0x1FBF,0x301,0x3,0x20,0x313,0x301,0x2,0x1FBF,0x342,0x3,0x20,0x313,0x342,0x2,0x3B9,
+    0x306,0x2,0x3B9,0x304,0x3,0x3B9,0x308,0x300,0x2,0x3B9,0x342,0x3,0x3B9,0x308,0x342,0x2,
+    0x399,0x306,0x1,0x1FD0,0x2,0x399,0x304,0x1,0x1FD1,0x2,0x399,0x300,0x1,0x1F76,0x1,0x1F77,
+    0x2,0x1FFE,0x300,0x3,0x20,0x314,0x300,0x2,0x1FFE,0x301,0x3,0x20,0x314,0x301,0x2,0x1FFE,
+    0x342,0x3,0x20,0x314,0x342,0x2,0x3C5,0x306,0x2,0x3C5,0x304,0x3,0x3C5,0x308,0x300,0x2,
+    0x3C1,0x313,0x2,0x3C1,0x314,0x2,0x3C5,0x342,0x3,0x3C5,0x308,0x342,0x2,0x3A5,0x306,0x1,
+    0x1FE0,0x2,0x3A5,0x304,0x1,0x1FE1,0x2,0x3A5,0x300,0x1,0x1F7A,0x1,0x1F7B,0x2,0x3A1,0x314,
+    0x1,0x1FE5,0x2,0xA8,0x300,0x3,0x20,0x308,0x300,0x1,0x60,0x3,0x3C9,0x300,0x345,0x2,
+    0x3C9,0x345,0x3,0x3C9,0x301,0x345,0x2,0x3C9,0x342,0x3,0x3C9,0x342,0x345,0x2,0x39F,0x300,
+    0x1,0x1F78,0x1,0x1F79,0x2,0x3A9,0x300,0x1,0x1F7C,0x1,0x1F7D,0x2,0x3A9,0x345,0x1,0x1FF3,
+    0x1,0xB4,0x2,0x20,0x314,0x1,0x2002,0x1,0x2003,0x1,0x2010,0x2,0x20,0x333,0x1,0x2E,
+    0x2,0x2E,0x2E,0x3,0x2E,0x2E,0x2E,0x2,0x2032,0x2032,0x3,0x2032,0x2032,0x2032,0x2,0x2035,
+    0x2035,0x3,0x2035,0x2035,0x2035,0x2,0x21,0x21,0x2,0x20,0x305,0x2,0x3F,0x3F,0x2,0x3F,
+    0x21,0x2,0x21,0x3F,0x4,0x2032,0x2032,0x2032,0x2032,0x1,0x30,0x1,0x34,0x1,0x35,0x1,
+    0x36,0x1,0x37,0x1,0x38,0x1,0x39,0x1,0x2B,0x1,0x2212,0x1,0x3D,0x1,0x28,0x1,
+    0x29,0x2,0x52,0x73,0x3,0x61,0x2F,0x63,0x3,0x61,0x2F,0x73,0x1,0x43,0x2,0xB0,
+    0x43,0x3,0x63,0x2F,0x6F,0x3,0x63,0x2F,0x75,0x1,0x190,0x2,0xB0,0x46,0x2,0x4E,
+    0x6F,0x1,0x51,0x2,0x53,0x4D,0x3,0x54,0x45,0x4C,0x2,0x54,0x4D,0x1,0x5A,0x1,
+    0x3A9,0x1,0x46,0x1,0x214E,0x1,0x5D0,0x1,0x5D1,0x1,0x5D2,0x1,0x5D3,0x3,0x46,0x41,
+    0x58,0x1,0x393,0x1,0x3A0,0x1,0x2211,0x3,0x31,0x2044,0x37,0x3,0x31,0x2044,0x39,0x4,
+    0x31,0x2044,0x31,0x30,0x3,0x31,0x2044,0x33,0x3,0x32,0x2044,0x33,0x3,0x31,0x2044,0x35,
+    0x3,0x32,0x2044,0x35,0x3,0x33,0x2044,0x35,0x3,0x34,0x2044,0x35,0x3,0x31,0x2044,0x36,
+    0x3,0x35,0x2044,0x36,0x3,0x31,0x2044,0x38,0x3,0x33,0x2044,0x38,0x3,0x35,0x2044,0x38,
+    0x3,0x37,0x2044,0x38,0x2,0x31,0x2044,0x1,0x2170,0x2,0x49,0x49,0x1,0x2171,0x3,0x49,
+    0x49,0x49,0x1,0x2172,0x2,0x49,0x56,0x1,0x2173,0x1,0x56,0x1,0x2174,0x2,0x56,0x49,
+    0x1,0x2175,0x3,0x56,0x49,0x49,0x1,0x2176,0x4,0x56,0x49,0x49,0x49,0x1,0x2177,0x2,
+    0x49,0x58,0x1,0x2178,0x1,0x58,0x1,0x2179,0x2,0x58,0x49,0x1,0x217A,0x3,0x58,0x49,
+    0x49,0x1,0x217B,0x1,0x217C,0x1,0x217D,0x1,0x217E,0x1,0x217F,0x2,0x69,0x69,0x3,0x69,
+    0x69,0x69,0x2,0x69,0x76,0x2,0x76,0x69,0x3,0x76,0x69,0x69,0x4,0x76,0x69,0x69,
+    0x69,0x2,0x69,0x78,0x2,0x78,0x69,0x3,0x78,0x69,0x69,0x1,0x2184,0x3,0x30,0x2044,
+    0x33,0x2,0x2190,0x338,0x2,0x2192,0x338,0x2,0x2194,0x338,0x2,0x21D0,0x338,0x2,0x21D4,0x338,
+    0x2,0x21D2,0x338,0x2,0x2203,0x338,0x2,0x2208,0x338,0x2,0x220B,0x338,0x2,0x2223,0x338,0x2,
+    0x2225,0x338,0x2,0x222B,0x222B,0x3,0x222B,0x222B,0x222B,0x2,0x222E,0x222E,0x3,0x222E,0x222E,0x222E,
+    0x2,0x223C,0x338,0x2,0x2243,0x338,0x2,0x2245,0x338,0x2,0x2248,0x338,0x2,0x3D,0x338,0x2,
+    0x2261,0x338,0x2,0x224D,0x338,0x2,0x3C,0x338,0x2,0x3E,0x338,0x2,0x2264,0x338,0x2,0x2265,
+    0x338,0x2,0x2272,0x338,0x2,0x2273,0x338,0x2,0x2276,0x338,0x2,0x2277,0x338,0x2,0x227A,0x338,
+    0x2,0x227B,0x338,0x2,0x2282,0x338,0x2,0x2283,0x338,0x2,0x2286,0x338,0x2,0x2287,0x338,0x2,
+    0x22A2,0x338,0x2,0x22A8,0x338,0x2,0x22A9,0x338,0x2,0x22AB,0x338,0x2,0x227C,0x338,0x2,0x227D,
+    0x338,0x2,0x2291,0x338,0x2,0x2292,0x338,0x2,0x22B2,0x338,0x2,0x22B3,0x338,0x2,0x22B4,0x338,
+    0x2,0x22B5,0x338,0x1,0x3008,0x1,0x3009,0x2,0x31,0x30,0x2,0x31,0x31,0x2,0x31,0x32,
+    0x2,0x31,0x33,0x2,0x31,0x34,0x2,0x31,0x35,0x2,0x31,0x36,0x2,0x31,0x37,0x2,
+    0x31,0x38,0x2,0x31,0x39,0x2,0x32,0x30,0x3,0x28,0x31,0x29,0x3,0x28,0x32,0x29,
+    0x3,0x28,0x33,0x29,0x3,0x28,0x34,0x29,0x3,0x28,0x35,0x29,0x3,0x28,0x36,0x29,
+    0x3,0x28,0x37,0x29,0x3,0x28,0x38,0x29,0x3,0x28,0x39,0x29,0x4,0x28,0x31,0x30,
+    0x29,0x4,0x28,0x31,0x31,0x29,0x4,0x28,0x31,0x32,0x29,0x4,0x28,0x31,0x33,0x29,
+    0x4,0x28,0x31,0x34,0x29,0x4,0x28,0x31,0x35,0x29,0x4,0x28,0x31,0x36,0x29,0x4,
+    0x28,0x31,0x37,0x29,0x4,0x28,0x31,0x38,0x29,0x4,0x28,0x31,0x39,0x29,0x4,0x28,
+    0x32,0x30,0x29,0x2,0x31,0x2E,0x2,0x32,0x2E,0x2,0x33,0x2E,0x2,0x34,0x2E,0x2,
+    0x35,0x2E,0x2,0x36,0x2E,0x2,0x37,0x2E,0x2,0x38,0x2E,0x2,0x39,0x2E,0x3,0x31,
+    0x30,0x2E,0x3,0x31,0x31,0x2E,0x3,0x31,0x32,0x2E,0x3,0x31,0x33,0x2E,0x3,0x31,
+    0x34,0x2E,0x3,0x31,0x35,0x2E,0x3,0x31,0x36,0x2E,0x3,0x31,0x37,0x2E,0x3,0x31,
+    0x38,0x2E,0x3,0x31,0x39,0x2E,0x3,0x32,0x30,0x2E,0x3,0x28,0x61,0x29,0x3,0x28,
+    0x62,0x29,0x3,0x28,0x63,0x29,0x3,0x28,0x64,0x29,0x3,0x28,0x65,0x29,0x3,0x28,
+    0x66,0x29,0x3,0x28,0x67,0x29,0x3,0x28,0x68,0x29,0x3,0x28,0x69,0x29,0x3,0x28,
+    0x6A,0x29,0x3,0x28,0x6B,0x29,0x3,0x28,0x6C,0x29,0x3,0x28,0x6D,0x29,0x3,0x28,
+    0x6E,0x29,0x3,0x28,0x6F,0x29,0x3,0x28,0x70,0x29,0x3,0x28,0x71,0x29,0x3,0x28,
+    0x72,0x29,0x3,0x28,0x73,0x29,0x3,0x28,0x74,0x29,0x3,0x28,0x75,0x29,0x3,0x28,
+    0x76,0x29,0x3,0x28,0x77,0x29,0x3,0x28,0x78,0x29,0x3,0x28,0x79,0x29,0x3,0x28,
+    0x7A,0x29,0x1,0x24D0,0x1,0x24D1,0x1,0x24D2,0x1,0x24D3,0x1,0x24D4,0x1,0x24D5,0x1,0x24D6,
+    0x1,0x24D7,0x1,0x24D8,0x1,0x24D9,0x1,0x24DA,0x1,0x24DB,0x1,0x24DC,0x1,0x24DD,0x1,0x24DE,
+    0x1,0x24DF,0x1,0x24E0,0x1,0x24E1,0x1,0x53,0x1,0x24E2,0x1,0x24E3,0x1,0x24E4,0x1,0x24E5,
+    0x1,0x24E6,0x1,0x24E7,0x1,0x59,0x1,0x24E8,0x1,0x24E9,0x4,0x222B,0x222B,0x222B,0x222B,0x3,
+    0x3A,0x3A,0x3D,0x2,0x3D,0x3D,0x3,0x3D,0x3D,0x3D,0x2,0x2ADD,0x338,0x1,0x2C30,0x1,
+    0x2C31,0x1,0x2C32,0x1,0x2C33,0x1,0x2C34,0x1,0x2C35,0x1,0x2C36,0x1,0x2C37,0x1,0x2C38,0x1,
+    0x2C39,0x1,0x2C3A,0x1,0x2C3B,0x1,0x2C3C,0x1,0x2C3D,0x1,0x2C3E,0x1,0x2C3F,0x1,0x2C40,0x1,
+    0x2C41,0x1,0x2C42,0x1,0x2C43,0x1,0x2C44,0x1,0x2C45,0x1,0x2C46,0x1,0x2C47,0x1,0x2C48,0x1,
+    0x2C49,0x1,0x2C4A,0x1,0x2C4B,0x1,0x2C4C,0x1,0x2C4D,0x1,0x2C4E,0x1,0x2C4F,0x1,0x2C50,0x1,
+    0x2C51,0x1,0x2C52,0x1,0x2C53,0x1,0x2C54,0x1,0x2C55,0x1,0x2C56,0x1,0x2C57,0x1,0x2C58,0x1,
+    0x2C59,0x1,0x2C5A,0x1,0x2C5B,0x1,0x2C5C,0x1,0x2C5D,0x1,0x2C5E,0x1,0x2C5F,0x1,0x2C61,0x1,
+    0x26B,0x1,0x1D7D,0x1,0x27D,0x1,0x2C68,0x1,0x2C6A,0x1,0x2C6C,0x1,0x2C73,0x1,0x2C76,0x1,
+    0x23F,0x1,0x240,0x1,0x2C81,0x1,0x2C83,0x1,0x2C85,0x1,0x2C87,0x1,0x2C89,0x1,0x2C8B,0x1,
+    0x2C8D,0x1,0x2C8F,0x1,0x2C91,0x1,0x2C93,0x1,0x2C95,0x1,0x2C97,0x1,0x2C99,0x1,0x2C9B,0x1,
+    0x2C9D,0x1,0x2C9F,0x1,0x2CA1,0x1,0x2CA3,0x1,0x2CA5,0x1,0x2CA7,0x1,0x2CA9,0x1,0x2CAB,0x1,
+    0x2CAD,0x1,0x2CAF,0x1,0x2CB1,0x1,0x2CB3,0x1,0x2CB5,0x1,0x2CB7,0x1,0x2CB9,0x1,0x2CBB,0x1,
+    0x2CBD,0x1,0x2CBF,0x1,0x2CC1,0x1,0x2CC3,0x1,0x2CC5,0x1,0x2CC7,0x1,0x2CC9,0x1,0x2CCB,0x1,
+    0x2CCD,0x1,0x2CCF,0x1,0x2CD1,0x1,0x2CD3,0x1,0x2CD5,0x1,0x2CD7,0x1,0x2CD9,0x1,0x2CDB,0x1,
+    0x2CDD,0x1,0x2CDF,0x1,0x2CE1,0x1,0x2CE3,0x1,0x2CEC,0x1,0x2CEE,0x1,0x2CF3,0x1,0x2D61,0x1,
+    0x6BCD,0x1,0x9F9F,0x1,0x4E00,0x1,0x4E28,0x1,0x4E36,0x1,0x4E3F,0x1,0x4E59,0x1,0x4E85,0x1,
+    0x4E8C,0x1,0x4EA0,0x1,0x4EBA,0x1,0x513F,0x1,0x5165,0x1,0x516B,0x1,0x5182,0x1,0x5196,0x1,
+    0x51AB,0x1,0x51E0,0x1,0x51F5,0x1,0x5200,0x1,0x529B,0x1,0x52F9,0x1,0x5315,0x1,0x531A,0x1,
+    0x5338,0x1,0x5341,0x1,0x535C,0x1,0x5369,0x1,0x5382,0x1,0x53B6,0x1,0x53C8,0x1,0x53E3,0x1,
+    0x56D7,0x1,0x571F,0x1,0x58EB,0x1,0x5902,0x1,0x590A,0x1,0x5915,0x1,0x5927,0x1,0x5973,0x1,
+    0x5B50,0x1,0x5B80,0x1,0x5BF8,0x1,0x5C0F,0x1,0x5C22,0x1,0x5C38,0x1,0x5C6E,0x1,0x5C71,0x1,
+    0x5DDB,0x1,0x5DE5,0x1,0x5DF1,0x1,0x5DFE,0x1,0x5E72,0x1,0x5E7A,0x1,0x5E7F,0x1,0x5EF4,0x1,
+    0x5EFE,0x1,0x5F0B,0x1,0x5F13,0x1,0x5F50,0x1,0x5F61,0x1,0x5F73,0x1,0x5FC3,0x1,0x6208,0x1,
+    0x6236,0x1,0x624B,0x1,0x652F,0x1,0x6534,0x1,0x6587,0x1,0x6597,0x1,0x65A4,0x1,0x65B9,0x1,
+    0x65E0,0x1,0x65E5,0x1,0x66F0,0x1,0x6708,0x1,0x6728,0x1,0x6B20,0x1,0x6B62,0x1,0x6B79,0x1,
+    0x6BB3,0x1,0x6BCB,0x1,0x6BD4,0x1,0x6BDB,0x1,0x6C0F,0x1,0x6C14,0x1,0x6C34,0x1,0x706B,0x1,
+    0x722A,0x1,0x7236,0x1,0x723B,0x1,0x723F,0x1,0x7247,0x1,0x7259,0x1,0x725B,0x1,0x72AC,0x1,
+    0x7384,0x1,0x7389,0x1,0x74DC,0x1,0x74E6,0x1,0x7518,0x1,0x751F,0x1,0x7528,0x1,0x7530,0x1,
+    0x758B,0x1,0x7592,0x1,0x7676,0x1,0x767D,0x1,0x76AE,0x1,0x76BF,0x1,0x76EE,0x1,0x77DB,0x1,
+    0x77E2,0x1,0x77F3,0x1,0x793A,0x1,0x79B8,0x1,0x79BE,0x1,0x7A74,0x1,0x7ACB,0x1,0x7AF9,0x1,
+    0x7C73,0x1,0x7CF8,0x1,0x7F36,0x1,0x7F51,0x1,0x7F8A,0x1,0x7FBD,0x1,0x8001,0x1,0x800C,0x1,
+    0x8012,0x1,0x8033,0x1,0x807F,0x1,0x8089,0x1,0x81E3,0x1,0x81EA,0x1,0x81F3,0x1,0x81FC,0x1,
+    0x820C,0x1,0x821B,0x1,0x821F,0x1,0x826E,0x1,0x8272,0x1,0x8278,0x1,0x864D,0x1,0x866B,0x1,
+    0x8840,0x1,0x884C,0x1,0x8863,0x1,0x897E,0x1,0x898B,0x1,0x89D2,0x1,0x8A00,0x1,0x8C37,0x1,
+    0x8C46,0x1,0x8C55,0x1,0x8C78,0x1,0x8C9D,0x1,0x8D64,0x1,0x8D70,0x1,0x8DB3,0x1,0x8EAB,0x1,
+    0x8ECA,0x1,0x8F9B,0x1,0x8FB0,0x1,0x8FB5,0x1,0x9091,0x1,0x9149,0x1,0x91C6,0x1,0x91CC,0x1,
+    0x91D1,0x1,0x9577,0x1,0x9580,0x1,0x961C,0x1,0x96B6,0x1,0x96B9,0x1,0x96E8,0x1,0x9751,0x1,
+    0x975E,0x1,0x9762,0x1,0x9769,0x1,0x97CB,0x1,0x97ED,0x1,0x97F3,0x1,0x9801,0x1,0x98A8,0x1,
+    0x98DB,0x1,0x98DF,0x1,0x9996,0x1,0x9999,0x1,0x99AC,0x1,0x9AA8,0x1,0x9AD8,0x1,0x9ADF,0x1,
+    0x9B25,0x1,0x9B2F,0x1,0x9B32,0x1,0x9B3C,0x1,0x9B5A,0x1,0x9CE5,0x1,0x9E75,0x1,0x9E7F,0x1,
+    0x9EA5,0x1,0x9EBB,0x1,0x9EC3,0x1,0x9ECD,0x1,0x9ED1,0x1,0x9EF9,0x1,0x9EFD,0x1,0x9F0E,0x1,
+    0x9F13,0x1,0x9F20,0x1,0x9F3B,0x1,0x9F4A,0x1,0x9F52,0x1,0x9F8D,0x1,0x9F9C,0x1,0x9FA0,0x1,
+    0x3012,0x1,0x5344,0x1,0x5345,0x2,0x304B,0x3099,0x2,0x304D,0x3099,0x2,0x304F,0x3099,0x2,0x3051,
+    0x3099,0x2,0x3053,0x3099,0x2,0x3055,0x3099,0x2,0x3057,0x3099,0x2,0x3059,0x3099,0x2,0x305B,0x3099,
+    0x2,0x305D,0x3099,0x2,0x305F,0x3099,0x2,0x3061,0x3099,0x2,0x3064,0x3099,0x2,0x3066,0x3099,0x2,
+    0x3068,0x3099,0x2,0x306F,0x3099,0x2,0x306F,0x309A,0x2,0x3072,0x3099,0x2,0x3072,0x309A,0x2,0x3075,
+    0x3099,0x2,0x3075,0x309A,0x2,0x3078,0x3099,0x2,0x3078,0x309A,0x2,0x307B,0x3099,0x2,0x307B,0x309A,
+    0x2,0x3046,0x3099,0x2,0x20,0x3099,0x2,0x20,0x309A,0x2,0x309D,0x3099,0x2,0x3088,0x308A,0x2,
+    0x30AB,0x3099,0x2,0x30AD,0x3099,0x2,0x30AF,0x3099,0x2,0x30B1,0x3099,0x2,0x30B3,0x3099,0x2,0x30B5,
+    0x3099,0x2,0x30B7,0x3099,0x2,0x30B9,0x3099,0x2,0x30BB,0x3099,0x2,0x30BD,0x3099,0x2,0x30BF,0x3099,
+    0x2,0x30C1,0x3099,0x2,0x30C4,0x3099,0x2,0x30C6,0x3099,0x2,0x30C8,0x3099,0x2,0x30CF,0x3099,0x2,
+    0x30CF,0x309A,0x2,0x30D2,0x3099,0x2,0x30D2,0x309A,0x2,0x30D5,0x3099,0x2,0x30D5,0x309A,0x2,0x30D8,
+    0x3099,0x2,0x30D8,0x309A,0x2,0x30DB,0x3099,0x2,0x30DB,0x309A,0x2,0x30A6,0x3099,0x2,0x30EF,0x3099,
+    0x2,0x30F0,0x3099,0x2,0x30F1,0x3099,0x2,0x30F2,0x3099,0x2,0x30FD,0x3099,0x2,0x30B3,0x30C8,0x1,
+    0x1100,0x1,0x1101,0x1,0x11AA,0x1,0x1102,0x1,0x11AC,0x1,0x11AD,0x1,0x1103,0x1,0x1104,0x1,
+    0x1105,0x1,0x11B0,0x1,0x11B1,0x1,0x11B2,0x1,0x11B3,0x1,0x11B4,0x1,0x11B5,0x1,0x111A,0x1,
+    0x1106,0x1,0x1107,0x1,0x1108,0x1,0x1121,0x1,0x1109,0x1,0x110A,0x1,0x110B,0x1,0x110C,0x1,
+    0x110D,0x1,0x110E,0x1,0x110F,0x1,0x1110,0x1,0x1111,0x1,0x1112,0x1,0x1161,0x1,0x1162,0x1,
+    0x1163,0x1,0x1164,0x1,0x1165,0x1,0x1166,0x1,0x1167,0x1,0x1168,0x1,0x1169,0x1,0x116A,0x1,
+    0x116B,0x1,0x116C,0x1,0x116D,0x1,0x116E,0x1,0x116F,0x1,0x1170,0x1,0x1171,0x1,0x1172,0x1,
+    0x1173,0x1,0x1174,0x1,0x1175,0x1,0x1160,0x1,0x1114,0x1,0x1115,0x1,0x11C7,0x1,0x11C8,0x1,
+    0x11CC,0x1,0x11CE,0x1,0x11D3,0x1,0x11D7,0x1,0x11D9,0x1,0x111C,0x1,0x11DD,0x1,0x11DF,0x1,
+    0x111D,0x1,0x111E,0x1,0x1120,0x1,0x1122,0x1,0x1123,0x1,0x1127,0x1,0x1129,0x1,0x112B,0x1,
+    0x112C,0x1,0x112D,0x1,0x112E,0x1,0x112F,0x1,0x1132,0x1,0x1136,0x1,0x1140,0x1,0x1147,0x1,
+    0x114C,0x1,0x11F1,0x1,0x11F2,0x1,0x1157,0x1,0x1158,0x1,0x1159,0x1,0x1184,0x1,0x1185,0x1,
+    0x1188,0x1,0x1191,0x1,0x1192,0x1,0x1194,0x1,0x119E,0x1,0x11A1,0x1,0x4E09,0x1,0x56DB,0x1,
+    0x4E0A,0x1,0x4E2D,0x1,0x4E0B,0x1,0x7532,0x1,0x4E19,0x1,0x4E01,0x1,0x5929,0x1,0x5730,0x3,
+    0x28,0x1100,0x29,0x3,0x28,0x1102,0x29,0x3,0x28,0x1103,0x29,0x3,0x28,0x1105,0x29,0x3,
+    0x28,0x1106,0x29,0x3,0x28,0x1107,0x29,0x3,0x28,0x1109,0x29,0x3,0x28,0x110B,0x29,0x3,
+    0x28,0x110C,0x29,0x3,0x28,0x110E,0x29,0x3,0x28,0x110F,0x29,0x3,0x28,0x1110,0x29,0x3,
+    0x28,0x1111,0x29,0x3,0x28,0x1112,0x29,0x4,0x28,0x1100,0x1161,0x29,0x4,0x28,0x1102,0x1161,
+    0x29,0x4,0x28,0x1103,0x1161,0x29,0x4,0x28,0x1105,0x1161,0x29,0x4,0x28,0x1106,0x1161,0x29,
+    0x4,0x28,0x1107,0x1161,0x29,0x4,0x28,0x1109,0x1161,0x29,0x4,0x28,0x110B,0x1161,0x29,0x4,
+    0x28,0x110C,0x1161,0x29,0x4,0x28,0x110E,0x1161,0x29,0x4,0x28,0x110F,0x1161,0x29,0x4,0x28,
+    0x1110,0x1161,0x29,0x4,0x28,0x1111,0x1161,0x29,0x4,0x28,0x1112,0x1161,0x29,0x4,0x28,0x110C,
+    0x116E,0x29,0x7,0x28,0x110B,0x1169,0x110C,0x1165,0x11AB,0x29,0x6,0x28,0x110B,0x1169,0x1112,0x116E,
+    0x29,0x3,0x28,0x4E00,0x29,0x3,0x28,0x4E8C,0x29,0x3,0x28,0x4E09,0x29,0x3,0x28,0x56DB,
+    0x29,0x3,0x28,0x4E94,0x29,0x3,0x28,0x516D,0x29,0x3,0x28,0x4E03,0x29,0x3,0x28,0x516B,
+    0x29,0x3,0x28,0x4E5D,0x29,0x3,0x28,0x5341,0x29,0x3,0x28,0x6708,0x29,0x3,0x28,0x706B,
+    0x29,0x3,0x28,0x6C34,0x29,0x3,0x28,0x6728,0x29,0x3,0x28,0x91D1,0x29,0x3,0x28,0x571F,
+    0x29,0x3,0x28,0x65E5,0x29,0x3,0x28,0x682A,0x29,0x3,0x28,0x6709,0x29,0x3,0x28,0x793E,
+    0x29,0x3,0x28,0x540D,0x29,0x3,0x28,0x7279,0x29,0x3,0x28,0x8CA1,0x29,0x3,0x28,0x795D,
+    0x29,0x3,0x28,0x52B4,0x29,0x3,0x28,0x4EE3,0x29,0x3,0x28,0x547C,0x29,0x3,0x28,0x5B66,
+    0x29,0x3,0x28,0x76E3,0x29,0x3,0x28,0x4F01,0x29,0x3,0x28,0x8CC7,0x29,0x3,0x28,0x5354,
+    0x29,0x3,0x28,0x796D,0x29,0x3,0x28,0x4F11,0x29,0x3,0x28,0x81EA,0x29,0x3,0x28,0x81F3,
+    0x29,0x1,0x554F,0x1,0x5E7C,0x1,0x7B8F,0x3,0x50,0x54,0x45,0x2,0x32,0x31,0x2,0x32,
+    0x32,0x2,0x32,0x33,0x2,0x32,0x34,0x2,0x32,0x35,0x2,0x32,0x36,0x2,0x32,0x37,
+    0x2,0x32,0x38,0x2,0x32,0x39,0x2,0x33,0x30,0x2,0x33,0x31,0x2,0x33,0x32,0x2,
+    0x33,0x33,0x2,0x33,0x34,0x2,0x33,0x35,0x2,0x1100,0x1161,0x2,0x1102,0x1161,0x2,0x1103,
+    0x1161,0x2,0x1105,0x1161,0x2,0x1106,0x1161,0x2,0x1107,0x1161,0x2,0x1109,0x1161,0x2,0x110B,0x1161,
+    0x2,0x110C,0x1161,0x2,0x110E,0x1161,0x2,0x110F,0x1161,0x2,0x1110,0x1161,0x2,0x1111,0x1161,0x2,
+    0x1112,0x1161,0x5,0x110E,0x1161,0x11B7,0x1100,0x1169,0x4,0x110C,0x116E,0x110B,0x1174,0x2,0x110B,0x116E,
+    0x1,0x4E94,0x1,0x516D,0x1,0x4E03,0x1,0x4E5D,0x1,0x682A,0x1,0x6709,0x1,0x793E,0x1,0x540D,
+    0x1,0x7279,0x1,0x8CA1,0x1,0x795D,0x1,0x52B4,0x1,0x79D8,0x1,0x7537,0x1,0x9069,0x1,0x512A,
+    0x1,0x5370,0x1,0x6CE8,0x1,0x9805,0x1,0x4F11,0x1,0x5199,0x1,0x6B63,0x1,0x5DE6,0x1,0x53F3,
+    0x1,0x533B,0x1,0x5B97,0x1,0x5B66,0x1,0x76E3,0x1,0x4F01,0x1,0x8CC7,0x1,0x5354,0x1,0x591C,
+    0x2,0x33,0x36,0x2,0x33,0x37,0x2,0x33,0x38,0x2,0x33,0x39,0x2,0x34,0x30,0x2,
+    0x34,0x31,0x2,0x34,0x32,0x2,0x34,0x33,0x2,0x34,0x34,0x2,0x34,0x35,0x2,0x34,
+    0x36,0x2,0x34,0x37,0x2,0x34,0x38,0x2,0x34,0x39,0x2,0x35,0x30,0x2,0x31,0x6708,
+    0x2,0x32,0x6708,0x2,0x33,0x6708,0x2,0x34,0x6708,0x2,0x35,0x6708,0x2,0x36,0x6708,0x2,
+    0x37,0x6708,0x2,0x38,0x6708,0x2,0x39,0x6708,0x3,0x31,0x30,0x6708,0x3,0x31,0x31,0x6708,
+    0x3,0x31,0x32,0x6708,0x2,0x48,0x67,0x3,0x65,0x72,0x67,0x2,0x65,0x56,0x3,0x4C,
+    0x54,0x44,0x1,0x30A2,0x1,0x30A4,0x1,0x30A6,0x1,0x30A8,0x1,0x30AA,0x1,0x30AB,0x1,0x30AD,
+    0x1,0x30AF,0x1,0x30B1,0x1,0x30B3,0x1,0x30B5,0x1,0x30B7,0x1,0x30B9,0x1,0x30BB,0x1,0x30BD,
+    0x1,0x30BF,0x1,0x30C1,0x1,0x30C4,0x1,0x30C6,0x1,0x30C8,0x1,0x30CA,0x1,0x30CB,0x1,0x30CC,
+    0x1,0x30CD,0x1,0x30CE,0x1,0x30CF,0x1,0x30D2,0x1,0x30D5,0x1,0x30D8,0x1,0x30DB,0x1,0x30DE,
+    0x1,0x30DF,0x1,0x30E0,0x1,0x30E1,0x1,0x30E2,0x1,0x30E4,0x1,0x30E6,0x1,0x30E8,0x1,0x30E9,
+    0x1,0x30EA,0x1,0x30EB,0x1,0x30EC,0x1,0x30ED,0x1,0x30EF,0x1,0x30F0,0x1,0x30F1,0x1,0x30F2,
+    0x2,0x4EE4,0x548C,0x5,0x30A2,0x30CF,0x309A,0x30FC,0x30C8,0x4,0x30A2,0x30EB,0x30D5,0x30A1,0x5,0x30A2,
+    0x30F3,0x30D8,0x309A,0x30A2,0x3,0x30A2,0x30FC,0x30EB,0x5,0x30A4,0x30CB,0x30F3,0x30AF,0x3099,0x3,0x30A4,
+    0x30F3,0x30C1,0x3,0x30A6,0x30A9,0x30F3,0x6,0x30A8,0x30B9,0x30AF,0x30FC,0x30C8,0x3099,0x4,0x30A8,0x30FC,
+    0x30AB,0x30FC,0x3,0x30AA,0x30F3,0x30B9,0x3,0x30AA,0x30FC,0x30E0,0x3,0x30AB,0x30A4,0x30EA,0x4,0x30AB,
+    0x30E9,0x30C3,0x30C8,0x4,0x30AB,0x30ED,0x30EA,0x30FC,0x4,0x30AB,0x3099,0x30ED,0x30F3,0x4,0x30AB,0x3099,
+    0x30F3,0x30DE,0x4,0x30AD,0x3099,0x30AB,0x3099,0x4,0x30AD,0x3099,0x30CB,0x30FC,0x4,0x30AD,0x30E5,0x30EA,
+    0x30FC,0x6,0x30AD,0x3099,0x30EB,0x30BF,0x3099,0x30FC,0x2,0x30AD,0x30ED,0x6,0x30AD,0x30ED,0x30AF,0x3099,
+    0x30E9,0x30E0,0x6,0x30AD,0x30ED,0x30E1,0x30FC,0x30C8,0x30EB,0x5,0x30AD,0x30ED,0x30EF,0x30C3,0x30C8,0x4,
+    0x30AF,0x3099,0x30E9,0x30E0,0x6,0x30AF,0x3099,0x30E9,0x30E0,0x30C8,0x30F3,0x6,0x30AF,0x30EB,0x30BB,0x3099,
+    0x30A4,0x30ED,0x4,0x30AF,0x30ED,0x30FC,0x30CD,0x3,0x30B1,0x30FC,0x30B9,0x3,0x30B3,0x30EB,0x30CA,0x4,
+    0x30B3,0x30FC,0x30DB,0x309A,0x4,0x30B5,0x30A4,0x30AF,0x30EB,0x5,0x30B5,0x30F3,0x30C1,0x30FC,0x30E0,0x5,
+    0x30B7,0x30EA,0x30F3,0x30AF,0x3099,0x3,0x30BB,0x30F3,0x30C1,0x3,0x30BB,0x30F3,0x30C8,0x4,0x30BF,0x3099,
+    0x30FC,0x30B9,0x3,0x30C6,0x3099,0x30B7,0x3,0x30C8,0x3099,0x30EB,0x2,0x30C8,0x30F3,0x2,0x30CA,0x30CE,
+    0x3,0x30CE,0x30C3,0x30C8,0x3,0x30CF,0x30A4,0x30C4,0x6,0x30CF,0x309A,0x30FC,0x30BB,0x30F3,0x30C8,0x4,
+    0x30CF,0x309A,0x30FC,0x30C4,0x5,0x30CF,0x3099,0x30FC,0x30EC,0x30EB,0x6,0x30D2,0x309A,0x30A2,0x30B9,0x30C8,
+    0x30EB,0x4,0x30D2,0x309A,0x30AF,0x30EB,0x3,0x30D2,0x309A,0x30B3,0x3,0x30D2,0x3099,0x30EB,0x6,0x30D5,
+    0x30A1,0x30E9,0x30C3,0x30C8,0x3099,0x4,0x30D5,0x30A3,0x30FC,0x30C8,0x6,0x30D5,0x3099,0x30C3,0x30B7,0x30A7,
+    0x30EB,0x3,0x30D5,0x30E9,0x30F3,0x5,0x30D8,0x30AF,0x30BF,0x30FC,0x30EB,0x3,0x30D8,0x309A,0x30BD,0x4,
+    0x30D8,0x309A,0x30CB,0x30D2,0x3,0x30D8,0x30EB,0x30C4,0x4,0x30D8,0x309A,0x30F3,0x30B9,0x5,0x30D8,0x309A,
+    0x30FC,0x30B7,0x3099,0x4,0x30D8,0x3099,0x30FC,0x30BF,0x5,0x30DB,0x309A,0x30A4,0x30F3,0x30C8,0x4,0x30DB,
+    0x3099,0x30EB,0x30C8,0x2,0x30DB,0x30F3,0x5,0x30DB,0x309A,0x30F3,0x30C8,0x3099,0x3,0x30DB,0x30FC,0x30EB,
+    0x3,0x30DB,0x30FC,0x30F3,0x4,0x30DE,0x30A4,0x30AF,0x30ED,0x3,0x30DE,0x30A4,0x30EB,0x3,0x30DE,0x30C3,
+    0x30CF,0x3,0x30DE,0x30EB,0x30AF,0x5,0x30DE,0x30F3,0x30B7,0x30E7,0x30F3,0x4,0x30DF,0x30AF,0x30ED,0x30F3,
+    0x2,0x30DF,0x30EA,0x6,0x30DF,0x30EA,0x30CF,0x3099,0x30FC,0x30EB,0x3,0x30E1,0x30AB,0x3099,0x5,0x30E1,
+    0x30AB,0x3099,0x30C8,0x30F3,0x4,0x30E1,0x30FC,0x30C8,0x30EB,0x4,0x30E4,0x30FC,0x30C8,0x3099,0x3,0x30E4,
+    0x30FC,0x30EB,0x3,0x30E6,0x30A2,0x30F3,0x4,0x30EA,0x30C3,0x30C8,0x30EB,0x2,0x30EA,0x30E9,0x4,0x30EB,
+    0x30D2,0x309A,0x30FC,0x5,0x30EB,0x30FC,0x30D5,0x3099,0x30EB,0x2,0x30EC,0x30E0,0x6,0x30EC,0x30F3,0x30C8,
+    0x30B1,0x3099,0x30F3,0x3,0x30EF,0x30C3,0x30C8,0x2,0x30,0x70B9,0x2,0x31,0x70B9,0x2,0x32,0x70B9,
+    0x2,0x33,0x70B9,0x2,0x34,0x70B9,0x2,0x35,0x70B9,0x2,0x36,0x70B9,0x2,0x37,0x70B9,0x2,
+    0x38,0x70B9,0x2,0x39,0x70B9,0x3,0x31,0x30,0x70B9,0x3,0x31,0x31,0x70B9,0x3,0x31,0x32,
+    0x70B9,0x3,0x31,0x33,0x70B9,0x3,0x31,0x34,0x70B9,0x3,0x31,0x35,0x70B9,0x3,0x31,0x36,
+    0x70B9,0x3,0x31,0x37,0x70B9,0x3,0x31,0x38,0x70B9,0x3,0x31,0x39,0x70B9,0x3,0x32,0x30,
+    0x70B9,0x3,0x32,0x31,0x70B9,0x3,0x32,0x32,0x70B9,0x3,0x32,0x33,0x70B9,0x3,0x32,0x34,
+    0x70B9,0x3,0x68,0x50,0x61,0x2,0x64,0x61,0x2,0x41,0x55,0x3,0x62,0x61,0x72,0x2,
+    0x6F,0x56,0x2,0x70,0x63,0x2,0x64,0x6D,0x3,0x64,0x6D,0x32,0x3,0x64,0x6D,0x33,
+    0x2,0x49,0x55,0x2,0x5E73,0x6210,0x2,0x662D,0x548C,0x2,0x5927,0x6B63,0x2,0x660E,0x6CBB,0x4,
+    0x682A,0x5F0F,0x4F1A,0x793E,0x2,0x70,0x41,0x2,0x6E,0x41,0x2,0x3BC,0x41,0x2,0x6D,0x41,
+    0x2,0x6B,0x41,0x2,0x4B,0x42,0x2,0x4D,0x42,0x2,0x47,0x42,0x3,0x63,0x61,0x6C,
+    0x4,0x6B,0x63,0x61,0x6C,0x2,0x70,0x46,0x2,0x6E,0x46,0x2,0x3BC,0x46,0x2,0x3BC,
+    0x67,0x2,0x6D,0x67,0x2,0x6B,0x67,0x2,0x48,0x7A,0x3,0x6B,0x48,0x7A,0x3,0x4D,
+    0x48,0x7A,0x3,0x47,0x48,0x7A,0x3,0x54,0x48,0x7A,0x2,0x3BC,0x6C,0x2,0x6D,0x6C,
+    0x2,0x64,0x6C,0x2,0x6B,0x6C,0x2,0x66,0x6D,0x2,0x6E,0x6D,0x2,0x3BC,0x6D,0x2,
+    0x6D,0x6D,0x2,0x63,0x6D,0x2,0x6B,0x6D,0x3,0x6D,0x6D,0x32,0x3,0x63,0x6D,0x32,
+    0x2,0x6D,0x32,0x3,0x6B,0x6D,0x32,0x3,0x6D,0x6D,0x33,0x3,0x63,0x6D,0x33,0x2,
+    0x6D,0x33,0x3,0x6B,0x6D,0x33,0x3,0x6D,0x2215,0x73,0x4,0x6D,0x2215,0x73,0x32,0x2,
+    0x50,0x61,0x3,0x6B,0x50,0x61,0x3,0x4D,0x50,0x61,0x3,0x47,0x50,0x61,0x3,0x72,
+    0x61,0x64,0x5,0x72,0x61,0x64,0x2215,0x73,0x6,0x72,0x61,0x64,0x2215,0x73,0x32,0x2,
+    0x70,0x73,0x2,0x6E,0x73,0x2,0x3BC,0x73,0x2,0x6D,0x73,0x2,0x70,0x56,0x2,0x6E,
+    0x56,0x2,0x3BC,0x56,0x2,0x6D,0x56,0x2,0x6B,0x56,0x2,0x4D,0x56,0x2,0x70,0x57,
+    0x2,0x6E,0x57,0x2,0x3BC,0x57,0x2,0x6D,0x57,0x2,0x6B,0x57,0x2,0x4D,0x57,0x2,
+    0x6B,0x3A9,0x2,0x4D,0x3A9,0x4,0x61,0x2E,0x6D,0x2E,0x2,0x42,0x71,0x2,0x63,0x63,
+    0x2,0x63,0x64,0x4,0x43,0x2215,0x6B,0x67,0x3,0x43,0x6F,0x2E,0x2,0x64,0x42,0x2,
+    0x47,0x79,0x2,0x68,0x61,0x2,0x48,0x50,0x2,0x69,0x6E,0x2,0x4B,0x4B,0x2,0x4B,
+    0x4D,0x2,0x6B,0x74,0x2,0x6C,0x6D,0x2,0x6C,0x6E,0x3,0x6C,0x6F,0x67,0x2,0x6C,
+    0x78,0x2,0x6D,0x62,0x3,0x6D,0x69,0x6C,0x3,0x6D,0x6F,0x6C,0x2,0x50,0x48,0x4,
+    0x70,0x2E,0x6D,0x2E,0x3,0x50,0x50,0x4D,0x2,0x50,0x52,0x2,0x73,0x72,0x2,0x53,
+    0x76,0x2,0x57,0x62,0x3,0x56,0x2215,0x6D,0x3,0x41,0x2215,0x6D,0x2,0x31,0x65E5,0x2,
+    0x32,0x65E5,0x2,0x33,0x65E5,0x2,0x34,0x65E5,0x2,0x35,0x65E5,0x2,0x36,0x65E5,0x2,0x37,
+    0x65E5,0x2,0x38,0x65E5,0x2,0x39,0x65E5,0x3,0x31,0x30,0x65E5,0x3,0x31,0x31,0x65E5,0x3,
+    0x31,0x32,0x65E5,0x3,0x31,0x33,0x65E5,0x3,0x31,0x34,0x65E5,0x3,0x31,0x35,0x65E5,0x3,
+    0x31,0x36,0x65E5,0x3,0x31,0x37,0x65E5,0x3,0x31,0x38,0x65E5,0x3,0x31,0x39,0x65E5,0x3,
+    0x32,0x30,0x65E5,0x3,0x32,0x31,0x65E5,0x3,0x32,0x32,0x65E5,0x3,0x32,0x33,0x65E5,0x3,
+    0x32,0x34,0x65E5,0x3,0x32,0x35,0x65E5,0x3,0x32,0x36,0x65E5,0x3,0x32,0x37,0x65E5,0x3,
+    0x32,0x38,0x65E5,0x3,0x32,0x39,0x65E5,0x3,0x33,0x30,0x65E5,0x3,0x33,0x31,0x65E5,0x3,
+    0x67,0x61,0x6C,0x1,0xA641,0x1,0xA643,0x1,0xA645,0x1,0xA647,0x1,0xA649,0x1,0xA64B,0x1,
+    0xA64D,0x1,0xA64F,0x1,0xA651,0x1,0xA653,0x1,0xA655,0x1,0xA657,0x1,0xA659,0x1,0xA65B,0x1,
+    0xA65D,0x1,0xA65F,0x1,0xA661,0x1,0xA663,0x1,0xA665,0x1,0xA667,0x1,0xA669,0x1,0xA66B,0x1,
+    0xA66D,0x1,0xA681,0x1,0xA683,0x1,0xA685,0x1,0xA687,0x1,0xA689,0x1,0xA68B,0x1,0xA68D,0x1,
+    0xA68F,0x1,0xA691,0x1,0xA693,0x1,0xA695,0x1,0xA697,0x1,0xA699,0x1,0xA69B,0x1,0xA723,0x1,
+    0xA725,0x1,0xA727,0x1,0xA729,0x1,0xA72B,0x1,0xA72D,0x1,0xA72F,0x1,0xA733,0x1,0xA735,0x1,
+    0xA737,0x1,0xA739,0x1,0xA73B,0x1,0xA73D,0x1,0xA73F,0x1,0xA741,0x1,0xA743,0x1,0xA745,0x1,
+    0xA747,0x1,0xA749,0x1,0xA74B,0x1,0xA74D,0x1,0xA74F,0x1,0xA751,0x1,0xA753,0x1,0xA755,0x1,
+    0xA757,0x1,0xA759,0x1,0xA75B,0x1,0xA75D,0x1,0xA75F,0x1,0xA761,0x1,0xA763,0x1,0xA765,0x1,
+    0xA767,0x1,0xA769,0x1,0xA76B,0x1,0xA76D,0x1,0xA76F,0x1,0xA77A,0x1,0xA77C,0x1,0x1D79,0x1,
+    0xA77F,0x1,0xA781,0x1,0xA783,0x1,0xA785,0x1,0xA787,0x1,0xA78C,0x1,0xA791,0x1,0xA793,0x1,
+    0xA797,0x1,0xA799,0x1,0xA79B,0x1,0xA79D,0x1,0xA79F,0x1,0xA7A1,0x1,0xA7A3,0x1,0xA7A5,0x1,
+    0xA7A7,0x1,0xA7A9,0x1,0x26C,0x1,0x29E,0x1,0x287,0x1,0xAB53,0x1,0xA7B5,0x1,0xA7B7,0x1,
+    0xA7B9,0x1,0xA7BB,0x1,0xA7BD,0x1,0xA7BF,0x1,0xA7C1,0x1,0xA7C3,0x1,0xA794,0x1,0x1D8E,0x1,
+    0xA7C8,0x1,0xA7CA,0x1,0xA7D1,0x1,0xA7D7,0x1,0xA7D9,0x1,0xA7F6,0x1,0x126,0x1,0xAB37,0x1,
+    0xAB52,0x1,0x28D,0x1,0x8C48,0x1,0x66F4,0x1,0x8CC8,0x1,0x6ED1,0x1,0x4E32,0x1,0x53E5,0x1,
+    0x5951,0x1,0x5587,0x1,0x5948,0x1,0x61F6,0x1,0x7669,0x1,0x7F85,0x1,0x863F,0x1,0x87BA,0x1,
+    0x88F8,0x1,0x908F,0x1,0x6A02,0x1,0x6D1B,0x1,0x70D9,0x1,0x73DE,0x1,0x843D,0x1,0x916A,0x1,
+    0x99F1,0x1,0x4E82,0x1,0x5375,0x1,0x6B04,0x1,0x721B,0x1,0x862D,0x1,0x9E1E,0x1,0x5D50,0x1,
+    0x6FEB,0x1,0x85CD,0x1,0x8964,0x1,0x62C9,0x1,0x81D8,0x1,0x881F,0x1,0x5ECA,0x1,0x6717,0x1,
+    0x6D6A,0x1,0x72FC,0x1,0x90CE,0x1,0x4F86,0x1,0x51B7,0x1,0x52DE,0x1,0x64C4,0x1,0x6AD3,0x1,
+    0x7210,0x1,0x76E7,0x1,0x8606,0x1,0x865C,0x1,0x8DEF,0x1,0x9732,0x1,0x9B6F,0x1,0x9DFA,0x1,
+    0x788C,0x1,0x797F,0x1,0x7DA0,0x1,0x83C9,0x1,0x9304,0x1,0x8AD6,0x1,0x58DF,0x1,0x5F04,0x1,
+    0x7C60,0x1,0x807E,0x1,0x7262,0x1,0x78CA,0x1,0x8CC2,0x1,0x96F7,0x1,0x58D8,0x1,0x5C62,0x1,
+    0x6A13,0x1,0x6DDA,0x1,0x6F0F,0x1,0x7D2F,0x1,0x7E37,0x1,0x964B,0x1,0x52D2,0x1,0x808B,0x1,
+    0x51DC,0x1,0x51CC,0x1,0x7A1C,0x1,0x7DBE,0x1,0x83F1,0x1,0x9675,0x1,0x8B80,0x1,0x62CF,0x1,
+    0x8AFE,0x1,0x4E39,0x1,0x5BE7,0x1,0x6012,0x1,0x7387,0x1,0x7570,0x1,0x5317,0x1,0x78FB,0x1,
+    0x4FBF,0x1,0x5FA9,0x1,0x4E0D,0x1,0x6CCC,0x1,0x6578,0x1,0x7D22,0x1,0x53C3,0x1,0x585E,0x1,
+    0x7701,0x1,0x8449,0x1,0x8AAA,0x1,0x6BBA,0x1,0x6C88,0x1,0x62FE,0x1,0x82E5,0x1,0x63A0,0x1,
+    0x7565,0x1,0x4EAE,0x1,0x5169,0x1,0x51C9,0x1,0x6881,0x1,0x7CE7,0x1,0x826F,0x1,0x8AD2,0x1,
+    0x91CF,0x1,0x52F5,0x1,0x5442,0x1,0x5EEC,0x1,0x65C5,0x1,0x6FFE,0x1,0x792A,0x1,0x95AD,0x1,
+    0x9A6A,0x1,0x9E97,0x1,0x9ECE,0x1,0x66C6,0x1,0x6B77,0x1,0x8F62,0x1,0x5E74,0x1,0x6190,0x1,
+    0x6200,0x1,0x649A,0x1,0x6F23,0x1,0x7149,0x1,0x7489,0x1,0x79CA,0x1,0x7DF4,0x1,0x806F,0x1,
+    0x8F26,0x1,0x84EE,0x1,0x9023,0x1,0x934A,0x1,0x5217,0x1,0x52A3,0x1,0x54BD,0x1,0x70C8,0x1,
+    0x88C2,0x1,0x5EC9,0x1,0x5FF5,0x1,0x637B,0x1,0x6BAE,0x1,0x7C3E,0x1,0x7375,0x1,0x4EE4,0x1,
+    0x56F9,0x1,0x5DBA,0x1,0x601C,0x1,0x73B2,0x1,0x7469,0x1,0x7F9A,0x1,0x8046,0x1,0x9234,0x1,
+    0x96F6,0x1,0x9748,0x1,0x9818,0x1,0x4F8B,0x1,0x79AE,0x1,0x91B4,0x1,0x96B8,0x1,0x60E1,0x1,
+    0x4E86,0x1,0x50DA,0x1,0x5BEE,0x1,0x5C3F,0x1,0x6599,0x1,0x71CE,0x1,0x7642,0x1,0x84FC,0x1,
+    0x907C,0x1,0x6688,0x1,0x962E,0x1,0x5289,0x1,0x677B,0x1,0x67F3,0x1,0x6D41,0x1,0x6E9C,0x1,
+    0x7409,0x1,0x7559,0x1,0x786B,0x1,0x7D10,0x1,0x985E,0x1,0x622E,0x1,0x9678,0x1,0x502B,0x1,
+    0x5D19,0x1,0x6DEA,0x1,0x8F2A,0x1,0x5F8B,0x1,0x6144,0x1,0x6817,0x1,0x9686,0x1,0x5229,0x1,
+    0x540F,0x1,0x5C65,0x1,0x6613,0x1,0x674E,0x1,0x68A8,0x1,0x6CE5,0x1,0x7406,0x1,0x75E2,0x1,
+    0x7F79,0x1,0x88CF,0x1,0x88E1,0x1,0x96E2,0x1,0x533F,0x1,0x6EBA,0x1,0x541D,0x1,0x71D0,0x1,
+    0x7498,0x1,0x85FA,0x1,0x96A3,0x1,0x9C57,0x1,0x9E9F,0x1,0x6797,0x1,0x6DCB,0x1,0x81E8,0x1,
+    0x7B20,0x1,0x7C92,0x1,0x72C0,0x1,0x7099,0x1,0x8B58,0x1,0x4EC0,0x1,0x8336,0x1,0x523A,0x1,
+    0x5207,0x1,0x5EA6,0x1,0x62D3,0x1,0x7CD6,0x1,0x5B85,0x1,0x6D1E,0x1,0x66B4,0x1,0x8F3B,0x1,
+    0x964D,0x1,0x5ED3,0x1,0x5140,0x1,0x55C0,0x1,0x585A,0x1,0x6674,0x1,0x51DE,0x1,0x732A,0x1,
+    0x76CA,0x1,0x793C,0x1,0x795E,0x1,0x7965,0x1,0x798F,0x1,0x9756,0x1,0x7CBE,0x1,0x8612,0x1,
+    0x8AF8,0x1,0x9038,0x1,0x90FD,0x1,0x98EF,0x1,0x98FC,0x1,0x9928,0x1,0x9DB4,0x1,0x90DE,0x1,
+    0x96B7,0x1,0x4FAE,0x1,0x50E7,0x1,0x514D,0x1,0x52C9,0x1,0x52E4,0x1,0x5351,0x1,0x559D,0x1,
+    0x5606,0x1,0x5668,0x1,0x5840,0x1,0x58A8,0x1,0x5C64,0x1,0x6094,0x1,0x6168,0x1,0x618E,0x1,
+    0x61F2,0x1,0x654F,0x1,0x65E2,0x1,0x6691,0x1,0x6885,0x1,0x6D77,0x1,0x6E1A,0x1,0x6F22,0x1,
+    0x716E,0x1,0x722B,0x1,0x7422,0x1,0x7891,0x1,0x7949,0x1,0x7948,0x1,0x7950,0x1,0x7956,0x1,
+    0x798D,0x1,0x798E,0x1,0x7A40,0x1,0x7A81,0x1,0x7BC0,0x1,0x7E09,0x1,0x7E41,0x1,0x7F72,0x1,
+    0x8005,0x1,0x81ED,0x1,0x8279,0x1,0x8457,0x1,0x8910,0x1,0x8996,0x1,0x8B01,0x1,0x8B39,0x1,
+    0x8CD3,0x1,0x8D08,0x1,0x8FB6,0x1,0x96E3,0x1,0x97FF,0x1,0x983B,0x1,0x6075,0x1,0x242EE,0x1,
+    0x8218,0x1,0x4E26,0x1,0x51B5,0x1,0x5168,0x1,0x4F80,0x1,0x5145,0x1,0x5180,0x1,0x52C7,0x1,
+    0x52FA,0x1,0x5555,0x1,0x5599,0x1,0x55E2,0x1,0x58B3,0x1,0x5944,0x1,0x5954,0x1,0x5A62,0x1,
+    0x5B28,0x1,0x5ED2,0x1,0x5ED9,0x1,0x5F69,0x1,0x5FAD,0x1,0x60D8,0x1,0x614E,0x1,0x6108,0x1,
+    0x6160,0x1,0x6234,0x1,0x63C4,0x1,0x641C,0x1,0x6452,0x1,0x6556,0x1,0x671B,0x1,0x6756,0x1,
+    0x6EDB,0x1,0x6ECB,0x1,0x701E,0x1,0x77A7,0x1,0x7235,0x1,0x72AF,0x1,0x7471,0x1,0x7506,0x1,
+    0x753B,0x1,0x761D,0x1,0x761F,0x1,0x76DB,0x1,0x76F4,0x1,0x774A,0x1,0x7740,0x1,0x78CC,0x1,
+    0x7AB1,0x1,0x7C7B,0x1,0x7D5B,0x1,0x7F3E,0x1,0x8352,0x1,0x83EF,0x1,0x8779,0x1,0x8941,0x1,
+    0x8986,0x1,0x8ABF,0x1,0x8ACB,0x1,0x8AED,0x1,0x8B8A,0x1,0x8F38,0x1,0x9072,0x1,0x9199,0x1,
+    0x9276,0x1,0x967C,0x1,0x97DB,0x1,0x980B,0x1,0x9B12,0x1,0x2284A,0x1,0x22844,0x1,0x233D5,0x1,
+    0x3B9D,0x1,0x4018,0x1,0x4039,0x1,0x25249,0x1,0x25CD0,0x1,0x27ED3,0x1,0x9F43,0x1,0x9F8E,0x2,
+    0x66,0x66,0x2,0x66,0x69,0x2,0x66,0x6C,0x3,0x66,0x66,0x69,0x3,0x66,0x66,0x6C,
+    0x2,0x73,0x74,0x2,0x574,0x576,0x2,0x574,0x565,0x2,0x574,0x56B,0x2,0x57E,0x576,0x2,
+    0x574,0x56D,0x2,0x5D9,0x5B4,0x2,0x5F2,0x5B7,0x1,0x5E2,0x1,0x5D4,0x1,0x5DB,0x1,0x5DC,
+    0x1,0x5DD,0x1,0x5E8,0x1,0x5EA,0x2,0x5E9,0x5C1,0x2,0x5E9,0x5C2,0x3,0x5E9,0x5BC,0x5C1,
+    0x3,0x5E9,0x5BC,0x5C2,0x2,0x5D0,0x5B7,0x2,0x5D0,0x5B8,0x2,0x5D0,0x5BC,0x2,0x5D1,0x5BC,
+    0x2,0x5D2,0x5BC,0x2,0x5D3,0x5BC,0x2,0x5D4,0x5BC,0x2,0x5D5,0x5BC,0x2,0x5D6,0x5BC,0x2,
+    0x5D8,0x5BC,0x2,0x5D9,0x5BC,0x2,0x5DA,0x5BC,0x2,0x5DB,0x5BC,0x2,0x5DC,0x5BC,0x2,0x5DE,
+    0x5BC,0x2,0x5E0,0x5BC,0x2,0x5E1,0x5BC,0x2,0x5E3,0x5BC,0x2,0x5E4,0x5BC,0x2,0x5E6,0x5BC,
+    0x2,0x5E7,0x5BC,0x2,0x5E8,0x5BC,0x2,0x5E9,0x5BC,0x2,0x5EA,0x5BC,0x2,0x5D5,0x5B9,0x2,
+    0x5D1,0x5BF,0x2,0x5DB,0x5BF,0x2,0x5E4,0x5BF,0x2,0x5D0,0x5DC,0x1,0x671,0x1,0x67B,0x1,
+    0x67E,0x1,0x680,0x1,0x67A,0x1,0x67F,0x1,0x679,0x1,0x6A4,0x1,0x6A6,0x1,0x684,0x1,
+    0x683,0x1,0x686,0x1,0x687,0x1,0x68D,0x1,0x68C,0x1,0x68E,0x1,0x688,0x1,0x698,0x1,
+    0x691,0x1,0x6A9,0x1,0x6AF,0x1,0x6B3,0x1,0x6B1,0x1,0x6BA,0x1,0x6BB,0x1,0x6C1,0x1,
+    0x6BE,0x1,0x6D2,0x1,0x6AD,0x1,0x6C7,0x1,0x6C6,0x1,0x6C8,0x1,0x6CB,0x1,0x6C5,0x1,
+    0x6C9,0x1,0x6D0,0x1,0x649,0x3,0x64A,0x654,0x627,0x3,0x64A,0x654,0x6D5,0x3,0x64A,0x654,
+    0x648,0x3,0x64A,0x654,0x6C7,0x3,0x64A,0x654,0x6C6,0x3,0x64A,0x654,0x6C8,0x3,0x64A,0x654,
+    0x6D0,0x3,0x64A,0x654,0x649,0x1,0x6CC,0x3,0x64A,0x654,0x62C,0x3,0x64A,0x654,0x62D,0x3,
+    0x64A,0x654,0x645,0x3,0x64A,0x654,0x64A,0x2,0x628,0x62C,0x2,0x628,0x62D,0x2,0x628,0x62E,
+    0x2,0x628,0x645,0x2,0x628,0x649,0x2,0x628,0x64A,0x2,0x62A,0x62C,0x2,0x62A,0x62D,0x2,
+    0x62A,0x62E,0x2,0x62A,0x645,0x2,0x62A,0x649,0x2,0x62A,0x64A,0x2,0x62B,0x62C,0x2,0x62B,
+    0x645,0x2,0x62B,0x649,0x2,0x62B,0x64A,0x2,0x62C,0x62D,0x2,0x62C,0x645,0x2,0x62D,0x62C,
+    0x2,0x62D,0x645,0x2,0x62E,0x62C,0x2,0x62E,0x62D,0x2,0x62E,0x645,0x2,0x633,0x62C,0x2,
+    0x633,0x62D,0x2,0x633,0x62E,0x2,0x633,0x645,0x2,0x635,0x62D,0x2,0x635,0x645,0x2,0x636,
+    0x62C,0x2,0x636,0x62D,0x2,0x636,0x62E,0x2,0x636,0x645,0x2,0x637,0x62D,0x2,0x637,0x645,
+    0x2,0x638,0x645,0x2,0x639,0x62C,0x2,0x639,0x645,0x2,0x63A,0x62C,0x2,0x63A,0x645,0x2,
+    0x641,0x62C,0x2,0x641,0x62D,0x2,0x641,0x62E,0x2,0x641,0x645,0x2,0x641,0x649,0x2,0x641,
+    0x64A,0x2,0x642,0x62D,0x2,0x642,0x645,0x2,0x642,0x649,0x2,0x642,0x64A,0x2,0x643,0x627,
+    0x2,0x643,0x62C,0x2,0x643,0x62D,0x2,0x643,0x62E,0x2,0x643,0x644,0x2,0x643,0x645,0x2,
+    0x643,0x649,0x2,0x643,0x64A,0x2,0x644,0x62C,0x2,0x644,0x62D,0x2,0x644,0x62E,0x2,0x644,
+    0x645,0x2,0x644,0x649,0x2,0x644,0x64A,0x2,0x645,0x62C,0x2,0x645,0x62D,0x2,0x645,0x62E,
+    0x2,0x645,0x645,0x2,0x645,0x649,0x2,0x645,0x64A,0x2,0x646,0x62C,0x2,0x646,0x62D,0x2,
+    0x646,0x62E,0x2,0x646,0x645,0x2,0x646,0x649,0x2,0x646,0x64A,0x2,0x647,0x62C,0x2,0x647,
+    0x645,0x2,0x647,0x649,0x2,0x647,0x64A,0x2,0x64A,0x62C,0x2,0x64A,0x62D,0x2,0x64A,0x62E,
+    0x2,0x64A,0x645,0x2,0x64A,0x649,0x2,0x64A,0x64A,0x2,0x630,0x670,0x2,0x631,0x670,0x2,
+    0x649,0x670,0x3,0x20,0x64C,0x651,0x3,0x20,0x64D,0x651,0x3,0x20,0x64E,0x651,0x3,0x20,
+    0x64F,0x651,0x3,0x20,0x650,0x651,0x3,0x20,0x651,0x670,0x3,0x64A,0x654,0x631,0x3,0x64A,
+    0x654,0x632,0x3,0x64A,0x654,0x646,0x2,0x628,0x631,0x2,0x628,0x632,0x2,0x628,0x646,0x2,
+    0x62A,0x631,0x2,0x62A,0x632,0x2,0x62A,0x646,0x2,0x62B,0x631,0x2,0x62B,0x632,0x2,0x62B,
+    0x646,0x2,0x645,0x627,0x2,0x646,0x631,0x2,0x646,0x632,0x2,0x646,0x646,0x2,0x64A,0x631,
+    0x2,0x64A,0x632,0x2,0x64A,0x646,0x3,0x64A,0x654,0x62E,0x3,0x64A,0x654,0x647,0x2,0x628,
+    0x647,0x2,0x62A,0x647,0x2,0x635,0x62E,0x2,0x644,0x647,0x2,0x646,0x647,0x2,0x647,0x670,
+    0x2,0x64A,0x647,0x2,0x62B,0x647,0x2,0x633,0x647,0x2,0x634,0x645,0x2,0x634,0x647,0x3,
+    0x640,0x64E,0x651,0x3,0x640,0x64F,0x651,0x3,0x640,0x650,0x651,0x2,0x637,0x649,0x2,0x637,
+    0x64A,0x2,0x639,0x649,0x2,0x639,0x64A,0x2,0x63A,0x649,0x2,0x63A,0x64A,0x2,0x633,0x649,
+    0x2,0x633,0x64A,0x2,0x634,0x649,0x2,0x634,0x64A,0x2,0x62D,0x649,0x2,0x62D,0x64A,0x2,
+    0x62C,0x649,0x2,0x62C,0x64A,0x2,0x62E,0x649,0x2,0x62E,0x64A,0x2,0x635,0x649,0x2,0x635,
+    0x64A,0x2,0x636,0x649,0x2,0x636,0x64A,0x2,0x634,0x62C,0x2,0x634,0x62D,0x2,0x634,0x62E,
+    0x2,0x634,0x631,0x2,0x633,0x631,0x2,0x635,0x631,0x2,0x636,0x631,0x2,0x627,0x64B,0x3,
+    0x62A,0x62C,0x645,0x3,0x62A,0x62D,0x62C,0x3,0x62A,0x62D,0x645,0x3,0x62A,0x62E,0x645,0x3,
+    0x62A,0x645,0x62C,0x3,0x62A,0x645,0x62D,0x3,0x62A,0x645,0x62E,0x3,0x62C,0x645,0x62D,0x3,
+    0x62D,0x645,0x64A,0x3,0x62D,0x645,0x649,0x3,0x633,0x62D,0x62C,0x3,0x633,0x62C,0x62D,0x3,
+    0x633,0x62C,0x649,0x3,0x633,0x645,0x62D,0x3,0x633,0x645,0x62C,0x3,0x633,0x645,0x645,0x3,
+    0x635,0x62D,0x62D,0x3,0x635,0x645,0x645,0x3,0x634,0x62D,0x645,0x3,0x634,0x62C,0x64A,0x3,
+    0x634,0x645,0x62E,0x3,0x634,0x645,0x645,0x3,0x636,0x62D,0x649,0x3,0x636,0x62E,0x645,0x3,
+    0x637,0x645,0x62D,0x3,0x637,0x645,0x645,0x3,0x637,0x645,0x64A,0x3,0x639,0x62C,0x645,0x3,
+    0x639,0x645,0x645,0x3,0x639,0x645,0x649,0x3,0x63A,0x645,0x645,0x3,0x63A,0x645,0x64A,0x3,
+    0x63A,0x645,0x649,0x3,0x641,0x62E,0x645,0x3,0x642,0x645,0x62D,0x3,0x642,0x645,0x645,0x3,
+    0x644,0x62D,0x645,0x3,0x644,0x62D,0x64A,0x3,0x644,0x62D,0x649,0x3,0x644,0x62C,0x62C,0x3,
+    0x644,0x62E,0x645,0x3,0x644,0x645,0x62D,0x3,0x645,0x62D,0x62C,0x3,0x645,0x62D,0x645,0x3,
+    0x645,0x62D,0x64A,0x3,0x645,0x62C,0x62D,0x3,0x645,0x62C,0x645,0x3,0x645,0x62E,0x62C,0x3,
+    0x645,0x62E,0x645,0x3,0x645,0x62C,0x62E,0x3,0x647,0x645,0x62C,0x3,0x647,0x645,0x645,0x3,
+    0x646,0x62D,0x645,0x3,0x646,0x62D,0x649,0x3,0x646,0x62C,0x645,0x3,0x646,0x62C,0x649,0x3,
+    0x646,0x645,0x64A,0x3,0x646,0x645,0x649,0x3,0x64A,0x645,0x645,0x3,0x628,0x62E,0x64A,0x3,
+    0x62A,0x62C,0x64A,0x3,0x62A,0x62C,0x649,0x3,0x62A,0x62E,0x64A,0x3,0x62A,0x62E,0x649,0x3,
+    0x62A,0x645,0x64A,0x3,0x62A,0x645,0x649,0x3,0x62C,0x645,0x64A,0x3,0x62C,0x62D,0x649,0x3,
+    0x62C,0x645,0x649,0x3,0x633,0x62E,0x649,0x3,0x635,0x62D,0x64A,0x3,0x634,0x62D,0x64A,0x3,
+    0x636,0x62D,0x64A,0x3,0x644,0x62C,0x64A,0x3,0x644,0x645,0x64A,0x3,0x64A,0x62D,0x64A,0x3,
+    0x64A,0x62C,0x64A,0x3,0x64A,0x645,0x64A,0x3,0x645,0x645,0x64A,0x3,0x642,0x645,0x64A,0x3,
+    0x646,0x62D,0x64A,0x3,0x639,0x645,0x64A,0x3,0x643,0x645,0x64A,0x3,0x646,0x62C,0x62D,0x3,
+    0x645,0x62E,0x64A,0x3,0x644,0x62C,0x645,0x3,0x643,0x645,0x645,0x3,0x62C,0x62D,0x64A,0x3,
+    0x62D,0x62C,0x64A,0x3,0x645,0x62C,0x64A,0x3,0x641,0x645,0x64A,0x3,0x628,0x62D,0x64A,0x3,
+    0x633,0x62E,0x64A,0x3,0x646,0x62C,0x64A,0x3,0x635,0x644,0x6D2,0x3,0x642,0x644,0x6D2,0x4,
+    0x627,0x644,0x644,0x647,0x4,0x627,0x643,0x628,0x631,0x4,0x645,0x62D,0x645,0x62F,0x4,0x635,
+    0x644,0x639,0x645,0x4,0x631,0x633,0x648,0x644,0x4,0x639,0x644,0x64A,0x647,0x4,0x648,0x633,
+    0x644,0x645,0x3,0x635,0x644,0x649,0x12,0x635,0x644,0x649,0x20,0x627,0x644,0x644,0x647,0x20,
+    0x639,0x644,0x64A,0x647,0x20,0x648,0x633,0x644,0x645,0x8,0x62C,0x644,0x20,0x62C,0x644,0x627,
+    0x644,0x647,0x4,0x631,0x6CC,0x627,0x644,0x1,0x2C,0x1,0x3001,0x1,0x3002,0x1,0x3A,0x1,
+    0x21,0x1,0x3F,0x1,0x3016,0x1,0x3017,0x1,0x2014,0x1,0x2013,0x1,0x5F,0x1,0x7B,0x1,
+    0x7D,0x1,0x3014,0x1,0x3015,0x1,0x3010,0x1,0x3011,0x1,0x300A,0x1,0x300B,0x1,0x300C,0x1,
+    0x300D,0x1,0x300E,0x1,0x300F,0x1,0x5B,0x1,0x5D,0x1,0x23,0x1,0x26,0x1,0x2A,0x1,
+    0x2D,0x1,0x3C,0x1,0x3E,0x1,0x5C,0x1,0x24,0x1,0x25,0x1,0x40,0x2,0x20,0x64B,
+    0x2,0x640,0x64B,0x2,0x20,0x64C,0x2,0x20,0x64D,0x2,0x20,0x64E,0x2,0x640,0x64E,0x2,
+    0x20,0x64F,0x2,0x640,0x64F,0x2,0x20,0x650,0x2,0x640,0x650,0x2,0x20,0x651,0x2,0x640,
+    0x651,0x2,0x20,0x652,0x2,0x640,0x652,0x1,0x621,0x1,0x627,0x1,0x628,0x1,0x629,0x1,
+    0x62A,0x1,0x62B,0x1,0x62C,0x1,0x62D,0x1,0x62E,0x1,0x62F,0x1,0x630,0x1,0x631,0x1,
+    0x632,0x1,0x633,0x1,0x634,0x1,0x635,0x1,0x636,0x1,0x637,0x1,0x638,0x1,0x639,0x1,
+    0x63A,0x1,0x641,0x1,0x642,0x1,0x643,0x1,0x644,0x1,0x645,0x1,0x646,0x1,0x647,0x1,
+    0x648,0x1,0x64A,0x3,0x644,0x627,0x653,0x3,0x644,0x627,0x654,0x3,0x644,0x627,0x655,0x2,
+    0x644,0x627,0x1,0x22,0x1,0x27,0x1,0x2F,0x1,0xFF41,0x1,0xFF42,0x1,0xFF43,0x1,0xFF44,
+    0x1,0xFF45,0x1,0xFF46,0x1,0xFF47,0x1,0xFF48,0x1,0xFF49,0x1,0xFF4A,0x1,0xFF4B,0x1,0xFF4C,
+    0x1,0xFF4D,0x1,0xFF4E,0x1,0xFF4F,0x1,0xFF50,0x1,0xFF51,0x1,0xFF52,0x1,0xFF53,0x1,0xFF54,
+    0x1,0xFF55,0x1,0xFF56,0x1,0xFF57,0x1,0xFF58,0x1,0xFF59,0x1,0xFF5A,0x1,0x5E,0x1,0x7C,
+    0x1,0x7E,0x1,0x2985,0x1,0x2986,0x1,0x30FB,0x1,0x30A1,0x1,0x30A3,0x1,0x30A5,0x1,0x30A7,
+    0x1,0x30A9,0x1,0x30E3,0x1,0x30E5,0x1,0x30E7,0x1,0x30C3,0x1,0x30FC,0x1,0x30F3,0x1,0x3099,
+    0x1,0x309A,0x1,0xA2,0x1,0xA3,0x1,0xAC,0x1,0xA6,0x1,0xA5,0x1,0x20A9,0x1,0x2502,
+    0x1,0x2190,0x1,0x2191,0x1,0x2192,0x1,0x2193,0x1,0x25A0,0x1,0x25CB,0x1,0x10428,0x1,0x10429,
+    0x1,0x1042A,0x1,0x1042B,0x1,0x1042C,0x1,0x1042D,0x1,0x1042E,0x1,0x1042F,0x1,0x10430,0x1,0x10431,
+    0x1,0x10432,0x1,0x10433,0x1,0x10434,0x1,0x10435,0x1,0x10436,0x1,0x10437,0x1,0x10438,0x1,0x10439,
+    0x1,0x1043A,0x1,0x1043B,0x1,0x1043C,0x1,0x1043D,0x1,0x1043E,0x1,0x1043F,0x1,0x10440,0x1,0x10441,
+    0x1,0x10442,0x1,0x10443,0x1,0x10444,0x1,0x10445,0x1,0x10446,0x1,0x10447,0x1,0x10448,0x1,0x10449,
+    0x1,0x1044A,0x1,0x1044B,0x1,0x1044C,0x1,0x1044D,0x1,0x1044E,0x1,0x1044F,0x1,0x104D8,0x1,0x104D9,
+    0x1,0x104DA,0x1,0x104DB,0x1,0x104DC,0x1,0x104DD,0x1,0x104DE,0x1,0x104DF,0x1,0x104E0,0x1,0x104E1,
+    0x1,0x104E2,0x1,0x104E3,0x1,0x104E4,0x1,0x104E5,0x1,0x104E6,0x1,0x104E7,0x1,0x104E8,0x1,0x104E9,
+    0x1,0x104EA,0x1,0x104EB,0x1,0x104EC,0x1,0x104ED,0x1,0x104EE,0x1,0x104EF,0x1,0x104F0,0x1,0x104F1,
+    0x1,0x104F2,0x1,0x104F3,0x1,0x104F4,0x1,0x104F5,0x1,0x104F6,0x1,0x104F7,0x1,0x104F8,0x1,0x104F9,
+    0x1,0x104FA,0x1,0x104FB,0x1,0x10597,0x1,0x10598,0x1,0x10599,0x1,0x1059A,0x1,0x1059B,0x1,0x1059C,
+    0x1,0x1059D,0x1,0x1059E,0x1,0x1059F,0x1,0x105A0,0x1,0x105A1,0x1,0x105A3,0x1,0x105A4,0x1,0x105A5,
+    0x1,0x105A6,0x1,0x105A7,0x1,0x105A8,0x1,0x105A9,0x1,0x105AA,0x1,0x105AB,0x1,0x105AC,0x1,0x105AD,
+    0x1,0x105AE,0x1,0x105AF,0x1,0x105B0,0x1,0x105B1,0x1,0x105B3,0x1,0x105B4,0x1,0x105B5,0x1,0x105B6,
+    0x1,0x105B7,0x1,0x105B8,0x1,0x105B9,0x1,0x105BB,0x1,0x105BC,0x1,0x2D0,0x1,0x2D1,0x1,0x299,
+    0x1,0x2A3,0x1,0xAB66,0x1,0x2A5,0x1,0x2A4,0x1,0x1D91,0x1,0x258,0x1,0x25E,0x1,0x2A9,
+    0x1,0x264,0x1,0x262,0x1,0x29B,0x1,0x29C,0x1,0x267,0x1,0x284,0x1,0x2AA,0x1,0x2AB,
+    0x1,0x1DF04,0x1,0xA78E,0x1,0x26E,0x1,0x1DF05,0x1,0x28E,0x1,0x1DF06,0x1,0x276,0x1,0x277,
+    0x1,0x27A,0x1,0x1DF08,0x1,0x27E,0x1,0x2A8,0x1,0x2A6,0x1,0xAB67,0x1,0x2A7,0x1,0x2C71,
+    0x1,0x28F,0x1,0x2A1,0x1,0x2A2,0x1,0x298,0x1,0x1C0,0x1,0x1C1,0x1,0x1C2,0x1,0x1DF0A,
+    0x1,0x1DF1E,0x1,0x10CC0,0x1,0x10CC1,0x1,0x10CC2,0x1,0x10CC3,0x1,0x10CC4,0x1,0x10CC5,0x1,0x10CC6,
+    0x1,0x10CC7,0x1,0x10CC8,0x1,0x10CC9,0x1,0x10CCA,0x1,0x10CCB,0x1,0x10CCC,0x1,0x10CCD,0x1,0x10CCE,
+    0x1,0x10CCF,0x1,0x10CD0,0x1,0x10CD1,0x1,0x10CD2,0x1,0x10CD3,0x1,0x10CD4,0x1,0x10CD5,0x1,0x10CD6,
+    0x1,0x10CD7,0x1,0x10CD8,0x1,0x10CD9,0x1,0x10CDA,0x1,0x10CDB,0x1,0x10CDC,0x1,0x10CDD,0x1,0x10CDE,
+    0x1,0x10CDF,0x1,0x10CE0,0x1,0x10CE1,0x1,0x10CE2,0x1,0x10CE3,0x1,0x10CE4,0x1,0x10CE5,0x1,0x10CE6,
+    0x1,0x10CE7,0x1,0x10CE8,0x1,0x10CE9,0x1,0x10CEA,0x1,0x10CEB,0x1,0x10CEC,0x1,0x10CED,0x1,0x10CEE,
+    0x1,0x10CEF,0x1,0x10CF0,0x1,0x10CF1,0x1,0x10CF2,0x2,0x11099,0x110BA,0x2,0x1109B,0x110BA,0x2,0x110A5,
+    0x110BA,0x2,0x11131,0x11127,0x2,0x11132,0x11127,0x2,0x11347,0x1133E,0x2,0x11347,0x11357,0x2,0x114B9,0x114BA,
+    0x2,0x114B9,0x114B0,0x2,0x114B9,0x114BD,0x2,0x115B8,0x115AF,0x2,0x115B9,0x115AF,0x1,0x118C0,0x1,0x118C1,
+    0x1,0x118C2,0x1,0x118C3,0x1,0x118C4,0x1,0x118C5,0x1,0x118C6,0x1,0x118C7,0x1,0x118C8,0x1,0x118C9,
+    0x1,0x118CA,0x1,0x118CB,0x1,0x118CC,0x1,0x118CD,0x1,0x118CE,0x1,0x118CF,0x1,0x118D0,0x1,0x118D1,
+    0x1,0x118D2,0x1,0x118D3,0x1,0x118D4,0x1,0x118D5,0x1,0x118D6,0x1,0x118D7,0x1,0x118D8,0x1,0x118D9,
+    0x1,0x118DA,0x1,0x118DB,0x1,0x118DC,0x1,0x118DD,0x1,0x118DE,0x1,0x118DF,0x2,0x11935,0x11930,0x1,
+    0x16E60,0x1,0x16E61,0x1,0x16E62,0x1,0x16E63,0x1,0x16E64,0x1,0x16E65,0x1,0x16E66,0x1,0x16E67,0x1,
+    0x16E68,0x1,0x16E69,0x1,0x16E6A,0x1,0x16E6B,0x1,0x16E6C,0x1,0x16E6D,0x1,0x16E6E,0x1,0x16E6F,0x1,
+    0x16E70,0x1,0x16E71,0x1,0x16E72,0x1,0x16E73,0x1,0x16E74,0x1,0x16E75,0x1,0x16E76,0x1,0x16E77,0x1,
+    0x16E78,0x1,0x16E79,0x1,0x16E7A,0x1,0x16E7B,0x1,0x16E7C,0x1,0x16E7D,0x1,0x16E7E,0x1,0x16E7F,0x2,
+    0x1D157,0x1D165,0x2,0x1D158,0x1D165,0x3,0x1D158,0x1D165,0x1D16E,0x3,0x1D158,0x1D165,0x1D16F,0x3,0x1D158,0x1D165,
+    0x1D170,0x3,0x1D158,0x1D165,0x1D171,0x3,0x1D158,0x1D165,0x1D172,0x2,0x1D1B9,0x1D165,0x2,0x1D1BA,0x1D165,0x3,
+    0x1D1B9,0x1D165,0x1D16E,0x3,0x1D1BA,0x1D165,0x1D16E,0x3,0x1D1B9,0x1D165,0x1D16F,0x3,0x1D1BA,0x1D165,0x1D16F,0x1,
+    0x131,0x1,0x237,0x1,0x391,0x1,0x392,0x1,0x394,0x1,0x395,0x1,0x396,0x1,0x397,0x1,
+    0x399,0x1,0x39A,0x1,0x39B,0x1,0x39C,0x1,0x39D,0x1,0x39E,0x1,0x39F,0x1,0x3A1,0x1,
+    0x3A4,0x1,0x3A6,0x1,0x3A7,0x1,0x3A8,0x1,0x2207,0x1,0x2202,0x1,0x3DC,0x1,0x1E922,0x1,
+    0x1E923,0x1,0x1E924,0x1,0x1E925,0x1,0x1E926,0x1,0x1E927,0x1,0x1E928,0x1,0x1E929,0x1,0x1E92A,0x1,
+    0x1E92B,0x1,0x1E92C,0x1,0x1E92D,0x1,0x1E92E,0x1,0x1E92F,0x1,0x1E930,0x1,0x1E931,0x1,0x1E932,0x1,
+    0x1E933,0x1,0x1E934,0x1,0x1E935,0x1,0x1E936,0x1,0x1E937,0x1,0x1E938,0x1,0x1E939,0x1,0x1E93A,0x1,
+    0x1E93B,0x1,0x1E93C,0x1,0x1E93D,0x1,0x1E93E,0x1,0x1E93F,0x1,0x1E940,0x1,0x1E941,0x1,0x1E942,0x1,
+    0x1E943,0x1,0x66E,0x1,0x6A1,0x1,0x66F,0x2,0x30,0x2E,0x2,0x30,0x2C,0x2,0x31,0x2C,
+    0x2,0x32,0x2C,0x2,0x33,0x2C,0x2,0x34,0x2C,0x2,0x35,0x2C,0x2,0x36,0x2C,0x2,
+    0x37,0x2C,0x2,0x38,0x2C,0x2,0x39,0x2C,0x3,0x28,0x41,0x29,0x3,0x28,0x42,0x29,
+    0x3,0x28,0x43,0x29,0x3,0x28,0x44,0x29,0x3,0x28,0x45,0x29,0x3,0x28,0x46,0x29,
+    0x3,0x28,0x47,0x29,0x3,0x28,0x48,0x29,0x3,0x28,0x49,0x29,0x3,0x28,0x4A,0x29,
+    0x3,0x28,0x4B,0x29,0x3,0x28,0x4C,0x29,0x3,0x28,0x4D,0x29,0x3,0x28,0x4E,0x29,
+    0x3,0x28,0x4F,0x29,0x3,0x28,0x50,0x29,0x3,0x28,0x51,0x29,0x3,0x28,0x52,0x29,
+    0x3,0x28,0x53,0x29,0x3,0x28,0x54,0x29,0x3,0x28,0x55,0x29,0x3,0x28,0x56,0x29,
+    0x3,0x28,0x57,0x29,0x3,0x28,0x58,0x29,0x3,0x28,0x59,0x29,0x3,0x28,0x5A,0x29,
+    0x3,0x3014,0x53,0x3015,0x2,0x43,0x44,0x2,0x57,0x5A,0x2,0x48,0x56,0x2,0x53,0x44,
+    0x2,0x53,0x53,0x3,0x50,0x50,0x56,0x2,0x57,0x43,0x2,0x4D,0x43,0x2,0x4D,0x44,
+    0x2,0x4D,0x52,0x2,0x44,0x4A,0x2,0x307B,0x304B,0x2,0x30B3,0x30B3,0x1,0x5B57,0x1,0x53CC,
+    0x1,0x591A,0x1,0x89E3,0x1,0x4EA4,0x1,0x6620,0x1,0x7121,0x1,0x524D,0x1,0x5F8C,0x1,0x518D,
+    0x1,0x65B0,0x1,0x521D,0x1,0x7D42,0x1,0x8CA9,0x1,0x58F0,0x1,0x5439,0x1,0x6F14,0x1,0x6295,
+    0x1,0x6355,0x1,0x904A,0x1,0x6307,0x1,0x6253,0x1,0x7981,0x1,0x7A7A,0x1,0x5408,0x1,0x6E80,
+    0x1,0x7533,0x1,0x5272,0x1,0x55B6,0x1,0x914D,0x3,0x3014,0x672C,0x3015,0x3,0x3014,0x4E09,0x3015,
+    0x3,0x3014,0x4E8C,0x3015,0x3,0x3014,0x5B89,0x3015,0x3,0x3014,0x70B9,0x3015,0x3,0x3014,0x6253,0x3015,
+    0x3,0x3014,0x76D7,0x3015,0x3,0x3014,0x52DD,0x3015,0x3,0x3014,0x6557,0x3015,0x1,0x5F97,0x1,0x53EF,
+    0x1,0x4E3D,0x1,0x4E38,0x1,0x4E41,0x1,0x20122,0x1,0x4F60,0x1,0x4FBB,0x1,0x5002,0x1,0x507A,
+    0x1,0x5099,0x1,0x50CF,0x1,0x349E,0x1,0x2063A,0x1,0x5154,0x1,0x5164,0x1,0x5177,0x1,0x2051C,
+    0x1,0x34B9,0x1,0x5167,0x1,0x2054B,0x1,0x5197,0x1,0x51A4,0x1,0x4ECC,0x1,0x51AC,0x1,0x291DF,
+    0x1,0x5203,0x1,0x34DF,0x1,0x523B,0x1,0x5246,0x1,0x5277,0x1,0x3515,0x1,0x5305,0x1,0x5306,
+    0x1,0x5349,0x1,0x535A,0x1,0x5373,0x1,0x537D,0x1,0x537F,0x1,0x20A2C,0x1,0x7070,0x1,0x53CA,
+    0x1,0x53DF,0x1,0x20B63,0x1,0x53EB,0x1,0x53F1,0x1,0x5406,0x1,0x549E,0x1,0x5438,0x1,0x5448,
+    0x1,0x5468,0x1,0x54A2,0x1,0x54F6,0x1,0x5510,0x1,0x5553,0x1,0x5563,0x1,0x5584,0x1,0x55AB,
+    0x1,0x55B3,0x1,0x55C2,0x1,0x5716,0x1,0x5717,0x1,0x5651,0x1,0x5674,0x1,0x58EE,0x1,0x57CE,
+    0x1,0x57F4,0x1,0x580D,0x1,0x578B,0x1,0x5832,0x1,0x5831,0x1,0x58AC,0x1,0x214E4,0x1,0x58F2,
+    0x1,0x58F7,0x1,0x5906,0x1,0x5922,0x1,0x5962,0x1,0x216A8,0x1,0x216EA,0x1,0x59EC,0x1,0x5A1B,
+    0x1,0x5A27,0x1,0x59D8,0x1,0x5A66,0x1,0x36EE,0x1,0x36FC,0x1,0x5B08,0x1,0x5B3E,0x1,0x219C8,
+    0x1,0x5BC3,0x1,0x5BD8,0x1,0x5BF3,0x1,0x21B18,0x1,0x5BFF,0x1,0x5C06,0x1,0x5F53,0x1,0x3781,
+    0x1,0x5C60,0x1,0x5CC0,0x1,0x5C8D,0x1,0x21DE4,0x1,0x5D43,0x1,0x21DE6,0x1,0x5D6E,0x1,0x5D6B,
+    0x1,0x5D7C,0x1,0x5DE1,0x1,0x5DE2,0x1,0x382F,0x1,0x5DFD,0x1,0x5E28,0x1,0x5E3D,0x1,0x5E69,
+    0x1,0x3862,0x1,0x22183,0x1,0x387C,0x1,0x5EB0,0x1,0x5EB3,0x1,0x5EB6,0x1,0x2A392,0x1,0x22331,
+    0x1,0x8201,0x1,0x5F22,0x1,0x38C7,0x1,0x232B8,0x1,0x261DA,0x1,0x5F62,0x1,0x5F6B,0x1,0x38E3,
+    0x1,0x5F9A,0x1,0x5FCD,0x1,0x5FD7,0x1,0x5FF9,0x1,0x6081,0x1,0x393A,0x1,0x391C,0x1,0x226D4,
+    0x1,0x60C7,0x1,0x6148,0x1,0x614C,0x1,0x617A,0x1,0x61B2,0x1,0x61A4,0x1,0x61AF,0x1,0x61DE,
+    0x1,0x6210,0x1,0x621B,0x1,0x625D,0x1,0x62B1,0x1,0x62D4,0x1,0x6350,0x1,0x22B0C,0x1,0x633D,
+    0x1,0x62FC,0x1,0x6368,0x1,0x6383,0x1,0x63E4,0x1,0x22BF1,0x1,0x6422,0x1,0x63C5,0x1,0x63A9,
+    0x1,0x3A2E,0x1,0x6469,0x1,0x647E,0x1,0x649D,0x1,0x6477,0x1,0x3A6C,0x1,0x656C,0x1,0x2300A,
+    0x1,0x65E3,0x1,0x66F8,0x1,0x6649,0x1,0x3B19,0x1,0x3B08,0x1,0x3AE4,0x1,0x5192,0x1,0x5195,
+    0x1,0x6700,0x1,0x669C,0x1,0x80AD,0x1,0x43D9,0x1,0x6721,0x1,0x675E,0x1,0x6753,0x1,0x233C3,
+    0x1,0x3B49,0x1,0x67FA,0x1,0x6785,0x1,0x6852,0x1,0x2346D,0x1,0x688E,0x1,0x681F,0x1,0x6914,
+    0x1,0x6942,0x1,0x69A3,0x1,0x69EA,0x1,0x6AA8,0x1,0x236A3,0x1,0x6ADB,0x1,0x3C18,0x1,0x6B21,
+    0x1,0x238A7,0x1,0x6B54,0x1,0x3C4E,0x1,0x6B72,0x1,0x6B9F,0x1,0x6BBB,0x1,0x23A8D,0x1,0x21D0B,
+    0x1,0x23AFA,0x1,0x6C4E,0x1,0x23CBC,0x1,0x6CBF,0x1,0x6CCD,0x1,0x6C67,0x1,0x6D16,0x1,0x6D3E,
+    0x1,0x6D69,0x1,0x6D78,0x1,0x6D85,0x1,0x23D1E,0x1,0x6D34,0x1,0x6E2F,0x1,0x6E6E,0x1,0x3D33,
+    0x1,0x6EC7,0x1,0x23ED1,0x1,0x6DF9,0x1,0x6F6E,0x1,0x23F5E,0x1,0x23F8E,0x1,0x6FC6,0x1,0x7039,
+    0x1,0x701B,0x1,0x3D96,0x1,0x704A,0x1,0x707D,0x1,0x7077,0x1,0x70AD,0x1,0x20525,0x1,0x7145,
+    0x1,0x24263,0x1,0x719C,0x1,0x243AB,0x1,0x7228,0x1,0x7250,0x1,0x24608,0x1,0x7280,0x1,0x7295,
+    0x1,0x24735,0x1,0x24814,0x1,0x737A,0x1,0x738B,0x1,0x3EAC,0x1,0x73A5,0x1,0x3EB8,0x1,0x7447,
+    0x1,0x745C,0x1,0x7485,0x1,0x74CA,0x1,0x3F1B,0x1,0x7524,0x1,0x24C36,0x1,0x753E,0x1,0x24C92,
+    0x1,0x2219F,0x1,0x7610,0x1,0x24FA1,0x1,0x24FB8,0x1,0x25044,0x1,0x3FFC,0x1,0x4008,0x1,0x250F3,
+    0x1,0x250F2,0x1,0x25119,0x1,0x25133,0x1,0x771E,0x1,0x771F,0x1,0x778B,0x1,0x4046,0x1,0x4096,
+    0x1,0x2541D,0x1,0x784E,0x1,0x40E3,0x1,0x25626,0x1,0x2569A,0x1,0x256C5,0x1,0x79EB,0x1,0x412F,
+    0x1,0x7A4A,0x1,0x7A4F,0x1,0x2597C,0x1,0x25AA7,0x1,0x7AEE,0x1,0x4202,0x1,0x25BAB,0x1,0x7BC6,
+    0x1,0x7BC9,0x1,0x4227,0x1,0x25C80,0x1,0x7CD2,0x1,0x42A0,0x1,0x7CE8,0x1,0x7CE3,0x1,0x7D00,
+    0x1,0x25F86,0x1,0x7D63,0x1,0x4301,0x1,0x7DC7,0x1,0x7E02,0x1,0x7E45,0x1,0x4334,0x1,0x26228,
+    0x1,0x26247,0x1,0x4359,0x1,0x262D9,0x1,0x7F7A,0x1,0x2633E,0x1,0x7F95,0x1,0x7FFA,0x1,0x264DA,
+    0x1,0x26523,0x1,0x8060,0x1,0x265A8,0x1,0x8070,0x1,0x2335F,0x1,0x43D5,0x1,0x80B2,0x1,0x8103,
+    0x1,0x440B,0x1,0x813E,0x1,0x5AB5,0x1,0x267A7,0x1,0x267B5,0x1,0x23393,0x1,0x2339C,0x1,0x8204,
+    0x1,0x8F9E,0x1,0x446B,0x1,0x8291,0x1,0x828B,0x1,0x829D,0x1,0x52B3,0x1,0x82B1,0x1,0x82B3,
+    0x1,0x82BD,0x1,0x82E6,0x1,0x26B3C,0x1,0x831D,0x1,0x8363,0x1,0x83AD,0x1,0x8323,0x1,0x83BD,
+    0x1,0x83E7,0x1,0x8353,0x1,0x83CA,0x1,0x83CC,0x1,0x83DC,0x1,0x26C36,0x1,0x26D6B,0x1,0x26CD5,
+    0x1,0x452B,0x1,0x84F1,0x1,0x84F3,0x1,0x8516,0x1,0x273CA,0x1,0x8564,0x1,0x26F2C,0x1,0x455D,
+    0x1,0x4561,0x1,0x26FB1,0x1,0x270D2,0x1,0x456B,0x1,0x8650,0x1,0x8667,0x1,0x8669,0x1,0x86A9,
+    0x1,0x8688,0x1,0x870E,0x1,0x86E2,0x1,0x8728,0x1,0x876B,0x1,0x8786,0x1,0x45D7,0x1,0x87E1,
+    0x1,0x8801,0x1,0x45F9,0x1,0x8860,0x1,0x27667,0x1,0x88D7,0x1,0x88DE,0x1,0x4635,0x1,0x88FA,
+    0x1,0x34BB,0x1,0x278AE,0x1,0x27966,0x1,0x46BE,0x1,0x46C7,0x1,0x8AA0,0x1,0x27CA8,0x1,0x8CAB,
+    0x1,0x8CC1,0x1,0x8D1B,0x1,0x8D77,0x1,0x27F2F,0x1,0x20804,0x1,0x8DCB,0x1,0x8DBC,0x1,0x8DF0,
+    0x1,0x208DE,0x1,0x8ED4,0x1,0x285D2,0x1,0x285ED,0x1,0x9094,0x1,0x90F1,0x1,0x9111,0x1,0x2872E,
+    0x1,0x911B,0x1,0x9238,0x1,0x92D7,0x1,0x92D8,0x1,0x927C,0x1,0x93F9,0x1,0x9415,0x1,0x28BFA,
+    0x1,0x958B,0x1,0x4995,0x1,0x95B7,0x1,0x28D77,0x1,0x49E6,0x1,0x96C3,0x1,0x5DB2,0x1,0x9723,
+    0x1,0x29145,0x1,0x2921A,0x1,0x4A6E,0x1,0x4A76,0x1,0x97E0,0x1,0x2940A,0x1,0x4AB2,0x1,0x29496,
+    0x1,0x9829,0x1,0x295B6,0x1,0x98E2,0x1,0x4B33,0x1,0x9929,0x1,0x99A7,0x1,0x99C2,0x1,0x99FE,
+    0x1,0x4BCE,0x1,0x29B30,0x1,0x9C40,0x1,0x9CFD,0x1,0x4CCE,0x1,0x4CED,0x1,0x9D67,0x1,0x2A0CE,
+    0x1,0x4CF8,0x1,0x2A105,0x1,0x2A20E,0x1,0x2A291,0x1,0x4D56,0x1,0x9EFE,0x1,0x9F05,0x1,0x9F0F,
+    0x1,0x9F16,0x1,0x2A600,
+};
+
+/* 主组合对 (首码点 << 21 | 次码点) → 组合结果，按键升序排列 (不含谚文) */
+static const struct
+{
+    uint64_t key;
+    uint32_t cp;
+} bbpe_norm_compose[941] = {
+    {0x7800338ULL,0x226E},{0x7A00338ULL,0x2260},{0x7C00338ULL,0x226F},{0x8200300ULL,0xC0},
+    {0x8200301ULL,0xC1},{0x8200302ULL,0xC2},{0x8200303ULL,0xC3},{0x8200304ULL,0x100},
+    {0x8200306ULL,0x102},{0x8200307ULL,0x226},{0x8200308ULL,0xC4},{0x8200309ULL,0x1EA2},
+    {0x820030AULL,0xC5},{0x820030CULL,0x1CD},{0x820030FULL,0x200},{0x8200311ULL,0x202},
+    {0x8200323ULL,0x1EA0},{0x8200325ULL,0x1E00},{0x8200328ULL,0x104},{0x8400307ULL,0x1E02},
+    {0x8400323ULL,0x1E04},{0x8400331ULL,0x1E06},{0x8600301ULL,0x106},{0x8600302ULL,0x108},
+    {0x8600307ULL,0x10A},{0x860030CULL,0x10C},{0x8600327ULL,0xC7},{0x8800307ULL,0x1E0A},
+    {0x880030CULL,0x10E},{0x8800323ULL,0x1E0C},{0x8800327ULL,0x1E10},{0x880032DULL,0x1E12},
+    {0x8800331ULL,0x1E0E},{0x8A00300ULL,0xC8},{0x8A00301ULL,0xC9},{0x8A00302ULL,0xCA},
+    {0x8A00303ULL,0x1EBC},{0x8A00304ULL,0x112},{0x8A00306ULL,0x114},{0x8A00307ULL,0x116},
+    {0x8A00308ULL,0xCB},{0x8A00309ULL,0x1EBA},{0x8A0030CULL,0x11A},{0x8A0030FULL,0x204},
+    {0x8A00311ULL,0x206},{0x8A00323ULL,0x1EB8},{0x8A00327ULL,0x228},{0x8A00328ULL,0x118},
+    {0x8A0032DULL,0x1E18},{0x8A00330ULL,0x1E1A},{0x8C00307ULL,0x1E1E},{0x8E00301ULL,0x1F4},
+    {0x8E00302ULL,0x11C},{0x8E00304ULL,0x1E20},{0x8E00306ULL,0x11E},{0x8E00307ULL,0x120},
+    {0x8E0030CULL,0x1E6},{0x8E00327ULL,0x122},{0x9000302ULL,0x124},{0x9000307ULL,0x1E22},
+    {0x9000308ULL,0x1E26},{0x900030CULL,0x21E},{0x9000323ULL,0x1E24},{0x9000327ULL,0x1E28},
+    {0x900032EULL,0x1E2A},{0x9200300ULL,0xCC},{0x9200301ULL,0xCD},{0x9200302ULL,0xCE},
+    {0x9200303ULL,0x128},{0x9200304ULL,0x12A},{0x9200306ULL,0x12C},{0x9200307ULL,0x130},
+    {0x9200308ULL,0xCF},{0x9200309ULL,0x1EC8},{0x920030CULL,0x1CF},{0x920030FULL,0x208},
+    {0x9200311ULL,0x20A},{0x9200323ULL,0x1ECA},{0x9200328ULL,0x12E},{0x9200330ULL,0x1E2C},
+    {0x9400302ULL,0x134},{0x9600301ULL,0x1E30},{0x960030CULL,0x1E8},{0x9600323ULL,0x1E32},
+    {0x9600327ULL,0x136},{0x9600331ULL,0x1E34},{0x9800301ULL,0x139},{0x980030CULL,0x13D},
+    {0x9800323ULL,0x1E36},{0x9800327ULL,0x13B},{0x980032DULL,0x1E3C},{0x9800331ULL,0x1E3A},
+    {0x9A00301ULL,0x1E3E},{0x9A00307ULL,0x1E40},{0x9A00323ULL,0x1E42},{0x9C00300ULL,0x1F8},
+    {0x9C00301ULL,0x143},{0x9C00303ULL,0xD1},{0x9C00307ULL,0x1E44},{0x9C0030CULL,0x147},
+    {0x9C00323ULL,0x1E46},{0x9C00327ULL,0x145},{0x9C0032DULL,0x1E4A},{0x9C00331ULL,0x1E48},
+    {0x9E00300ULL,0xD2},{0x9E00301ULL,0xD3},{0x9E00302ULL,0xD4},{0x9E00303ULL,0xD5},
+    {0x9E00304ULL,0x14C},{0x9E00306ULL,0x14E},{0x9E00307ULL,0x22E},{0x9E00308ULL,0xD6},
+    {0x9E00309ULL,0x1ECE},{0x9E0030BULL,0x150},{0x9E0030CULL,0x1D1},{0x9E0030FULL,0x20C},
+    {0x9E00311ULL,0x20E},{0x9E0031BULL,0x1A0},{0x9E00323ULL,0x1ECC},{0x9E00328ULL,0x1EA},
+    {0xA000301ULL,0x1E54},{0xA000307ULL,0x1E56},{0xA400301ULL,0x154},{0xA400307ULL,0x1E58},
+    {0xA40030CULL,0x158},{0xA40030FULL,0x210},{0xA400311ULL,0x212},{0xA400323ULL,0x1E5A},
+    {0xA400327ULL,0x156},{0xA400331ULL,0x1E5E},{0xA600301ULL,0x15A},{0xA600302ULL,0x15C},
+    {0xA600307ULL,0x1E60},{0xA60030CULL,0x160},{0xA600323ULL,0x1E62},{0xA600326ULL,0x218},
+    {0xA600327ULL,0x15E},{0xA800307ULL,0x1E6A},{0xA80030CULL,0x164},{0xA800323ULL,0x1E6C},
+    {0xA800326ULL,0x21A},{0xA800327ULL,0x162},{0xA80032DULL,0x1E70},{0xA800331ULL,0x1E6E},
+    {0xAA00300ULL,0xD9},{0xAA00301ULL,0xDA},{0xAA00302ULL,0xDB},{0xAA00303ULL,0x168},
+    {0xAA00304ULL,0x16A},{0xAA00306ULL,0x16C},{0xAA00308ULL,0xDC},{0xAA00309ULL,0x1EE6},
+    {0xAA0030AULL,0x16E},{0xAA0030BULL,0x170},{0xAA0030CULL,0x1D3},{0xAA0030FULL,0x214},
+    {0xAA00311ULL,0x216},{0xAA0031BULL,0x1AF},{0xAA00323ULL,0x1EE4},{0xAA00324ULL,0x1E72},
+    {0xAA00328ULL,0x172},{0xAA0032DULL,0x1E76},{0xAA00330ULL,0x1E74},{0xAC00303ULL,0x1E7C},
+    {0xAC00323ULL,0x1E7E},{0xAE00300ULL,0x1E80},{0xAE00301ULL,0x1E82},{0xAE00302ULL,0x174},
+    {0xAE00307ULL,0x1E86},{0xAE00308ULL,0x1E84},{0xAE00323ULL,0x1E88},{0xB000307ULL,0x1E8A},
+    {0xB000308ULL,0x1E8C},{0xB200300ULL,0x1EF2},{0xB200301ULL,0xDD},{0xB200302ULL,0x176},
+    {0xB200303ULL,0x1EF8},{0xB200304ULL,0x232},{0xB200307ULL,0x1E8E},{0xB200308ULL,0x178},
+    {0xB200309ULL,0x1EF6},{0xB200323ULL,0x1EF4},{0xB400301ULL,0x179},{0xB400302ULL,0x1E90},
+    {0xB400307ULL,0x17B},{0xB40030CULL,0x17D},{0xB400323ULL,0x1E92},{0xB400331ULL,0x1E94},
+    {0xC200300ULL,0xE0},{0xC200301ULL,0xE1},{0xC200302ULL,0xE2},{0xC200303ULL,0xE3},
+    {0xC200304ULL,0x101},{0xC200306ULL,0x103},{0xC200307ULL,0x227},{0xC200308ULL,0xE4},
+    {0xC200309ULL,0x1EA3},{0xC20030AULL,0xE5},{0xC20030CULL,0x1CE},{0xC20030FULL,0x201},
+    {0xC200311ULL,0x203},{0xC200323ULL,0x1EA1},{0xC200325ULL,0x1E01},{0xC200328ULL,0x105},
+    {0xC400307ULL,0x1E03},{0xC400323ULL,0x1E05},{0xC400331ULL,0x1E07},{0xC600301ULL,0x107},
+    {0xC600302ULL,0x109},{0xC600307ULL,0x10B},{0xC60030CULL,0x10D},{0xC600327ULL,0xE7},
+    {0xC800307ULL,0x1E0B},{0xC80030CULL,0x10F},{0xC800323ULL,0x1E0D},{0xC800327ULL,0x1E11},
+    {0xC80032DULL,0x1E13},{0xC800331ULL,0x1E0F},{0xCA00300ULL,0xE8},{0xCA00301ULL,0xE9},
+    {0xCA00302ULL,0xEA},{0xCA00303ULL,0x1EBD},{0xCA00304ULL,0x113},{0xCA00306ULL,0x115},
+    {0xCA00307ULL,0x117},{0xCA00308ULL,0xEB},{0xCA00309ULL,0x1EBB},{0xCA0030CULL,0x11B},
+    {0xCA0030FULL,0x205},{0xCA00311ULL,0x207},{0xCA00323ULL,0x1EB9},{0xCA00327ULL,0x229},
+    {0xCA00328ULL,0x119},{0xCA0032DULL,0x1E19},{0xCA00330ULL,0x1E1B},{0xCC00307ULL,0x1E1F},
+    {0xCE00301ULL,0x1F5},{0xCE00302ULL,0x11D},{0xCE00304ULL,0x1E21},{0xCE00306ULL,0x11F},
+    {0xCE00307ULL,0x121},{0xCE0030CULL,0x1E7},{0xCE00327ULL,0x123},{0xD000302ULL,0x125},
+    {0xD000307ULL,0x1E23},{0xD000308ULL,0x1E27},{0xD00030CULL,0x21F},{0xD000323ULL,0x1E25},
+    {0xD000327ULL,0x1E29},{0xD00032EULL,0x1E2B},{0xD000331ULL,0x1E96},{0xD200300ULL,0xEC},
+    {0xD200301ULL,0xED},{0xD200302ULL,0xEE},{0xD200303ULL,0x129},{0xD200304ULL,0x12B},
+    {0xD200306ULL,0x12D},{0xD200308ULL,0xEF},{0xD200309ULL,0x1EC9},{0xD20030CULL,0x1D0},
+    {0xD20030FULL,0x209},{0xD200311ULL,0x20B},{0xD200323ULL,0x1ECB},{0xD200328ULL,0x12F},
+    {0xD200330ULL,0x1E2D},{0xD400302ULL,0x135},{0xD40030CULL,0x1F0},{0xD600301ULL,0x1E31},
+    {0xD60030CULL,0x1E9},{0xD600323ULL,0x1E33},{0xD600327ULL,0x137},{0xD600331ULL,0x1E35},
+    {0xD800301ULL,0x13A},{0xD80030CULL,0x13E},{0xD800323ULL,0x1E37},{0xD800327ULL,0x13C},
+    {0xD80032DULL,0x1E3D},{0xD800331ULL,0x1E3B},{0xDA00301ULL,0x1E3F},{0xDA00307ULL,0x1E41},
+    {0xDA00323ULL,0x1E43},{0xDC00300ULL,0x1F9},{0xDC00301ULL,0x144},{0xDC00303ULL,0xF1},
+    {0xDC00307ULL,0x1E45},{0xDC0030CULL,0x148},{0xDC00323ULL,0x1E47},{0xDC00327ULL,0x146},
+    {0xDC0032DULL,0x1E4B},{0xDC00331ULL,0x1E49},{0xDE00300ULL,0xF2},{0xDE00301ULL,0xF3},
+    {0xDE00302ULL,0xF4},{0xDE00303ULL,0xF5},{0xDE00304ULL,0x14D},{0xDE00306ULL,0x14F},
+    {0xDE00307ULL,0x22F},{0xDE00308ULL,0xF6},{0xDE00309ULL,0x1ECF},{0xDE0030BULL,0x151},
+    {0xDE0030CULL,0x1D2},{0xDE0030FULL,0x20D},{0xDE00311ULL,0x20F},{0xDE0031BULL,0x1A1},
+    {0xDE00323ULL,0x1ECD},{0xDE00328ULL,0x1EB},{0xE000301ULL,0x1E55},{0xE000307ULL,0x1E57},
+    {0xE400301ULL,0x155},{0xE400307ULL,0x1E59},{0xE40030CULL,0x159},{0xE40030FULL,0x211},
+    {0xE400311ULL,0x213},{0xE400323ULL,0x1E5B},{0xE400327ULL,0x157},{0xE400331ULL,0x1E5F},
+    {0xE600301ULL,0x15B},{0xE600302ULL,0x15D},{0xE600307ULL,0x1E61},{0xE60030CULL,0x161},
+    {0xE600323ULL,0x1E63},{0xE600326ULL,0x219},{0xE600327ULL,0x15F},{0xE800307ULL,0x1E6B},
+    {0xE800308ULL,0x1E97},{0xE80030CULL,0x165},{0xE800323ULL,0x1E6D},{0xE800326ULL,0x21B},
+    {0xE800327ULL,0x163},{0xE80032DULL,0x1E71},{0xE800331ULL,0x1E6F},{0xEA00300ULL,0xF9},
+    {0xEA00301ULL,0xFA},{0xEA00302ULL,0xFB},{0xEA00303ULL,0x169},{0xEA00304ULL,0x16B},
+    {0xEA00306ULL,0x16D},{0xEA00308ULL,0xFC},{0xEA00309ULL,0x1EE7},{0xEA0030AULL,0x16F},
+    {0xEA0030BULL,0x171},{0xEA0030CULL,0x1D4},{0xEA0030FULL,0x215},{0xEA00311ULL,0x217},
+    {0xEA0031BULL,0x1B0},{0xEA00323ULL,0x1EE5},{0xEA00324ULL,0x1E73},{0xEA00328ULL,0x173},
+    {0xEA0032DULL,0x1E77},{0xEA00330ULL,0x1E75},{0xEC00303ULL,0x1E7D},{0xEC00323ULL,0x1E7F},
+    {0xEE00300ULL,0x1E81},{0xEE00301ULL,0x1E83},{0xEE00302ULL,0x175},{0xEE00307ULL,0x1E87},
+    {0xEE00308ULL,0x1E85},{0xEE0030AULL,0x1E98},{0xEE00323ULL,0x1E89},{0xF000307ULL,0x1E8B},
+    {0xF000308ULL,0x1E8D},{0xF200300ULL,0x1EF3},{0xF200301ULL,0xFD},{0xF200302ULL,0x177},
+    {0xF200303ULL,0x1EF9},{0xF200304ULL,0x233},{0xF200307ULL,0x1E8F},{0xF200308ULL,0xFF},
+    {0xF200309ULL,0x1EF7},{0xF20030AULL,0x1E99},{0xF200323ULL,0x1EF5},{0xF400301ULL,0x17A},
+    {0xF400302ULL,0x1E91},{0xF400307ULL,0x17C},{0xF40030CULL,0x17E},{0xF400323ULL,0x1E93},
+    {0xF400331ULL,0x1E95},{0x15000300ULL,0x1FED},{0x15000301ULL,0x385},{0x15000342ULL,0x1FC1},
+    {0x18400300ULL,0x1EA6},{0x18400301ULL,0x1EA4},{0x18400303ULL,0x1EAA},{0x18400309ULL,0x1EA8},
+    {0x18800304ULL,0x1DE},{0x18A00301ULL,0x1FA},{0x18C00301ULL,0x1FC},{0x18C00304ULL,0x1E2},
+    {0x18E00301ULL,0x1E08},{0x19400300ULL,0x1EC0},{0x19400301ULL,0x1EBE},{0x19400303ULL,0x1EC4},
+    {0x19400309ULL,0x1EC2},{0x19E00301ULL,0x1E2E},{0x1A800300ULL,0x1ED2},{0x1A800301ULL,0x1ED0},
+    {0x1A800303ULL,0x1ED6},{0x1A800309ULL,0x1ED4},{0x1AA00301ULL,0x1E4C},{0x1AA00304ULL,0x22C},
+    {0x1AA00308ULL,0x1E4E},{0x1AC00304ULL,0x22A},{0x1B000301ULL,0x1FE},{0x1B800300ULL,0x1DB},
+    {0x1B800301ULL,0x1D7},{0x1B800304ULL,0x1D5},{0x1B80030CULL,0x1D9},{0x1C400300ULL,0x1EA7},
+    {0x1C400301ULL,0x1EA5},{0x1C400303ULL,0x1EAB},{0x1C400309ULL,0x1EA9},{0x1C800304ULL,0x1DF},
+    {0x1CA00301ULL,0x1FB},{0x1CC00301ULL,0x1FD},{0x1CC00304ULL,0x1E3},{0x1CE00301ULL,0x1E09},
+    {0x1D400300ULL,0x1EC1},{0x1D400301ULL,0x1EBF},{0x1D400303ULL,0x1EC5},{0x1D400309ULL,0x1EC3},
+    {0x1DE00301ULL,0x1E2F},{0x1E800300ULL,0x1ED3},{0x1E800301ULL,0x1ED1},{0x1E800303ULL,0x1ED7},
+    {0x1E800309ULL,0x1ED5},{0x1EA00301ULL,0x1E4D},{0x1EA00304ULL,0x22D},{0x1EA00308ULL,0x1E4F},
+    {0x1EC00304ULL,0x22B},{0x1F000301ULL,0x1FF},{0x1F800300ULL,0x1DC},{0x1F800301ULL,0x1D8},
+    {0x1F800304ULL,0x1D6},{0x1F80030CULL,0x1DA},{0x20400300ULL,0x1EB0},{0x20400301ULL,0x1EAE},
+    {0x20400303ULL,0x1EB4},{0x20400309ULL,0x1EB2},{0x20600300ULL,0x1EB1},{0x20600301ULL,0x1EAF},
+    {0x20600303ULL,0x1EB5},{0x20600309ULL,0x1EB3},{0x22400300ULL,0x1E14},{0x22400301ULL,0x1E16},
+    {0x22600300ULL,0x1E15},{0x22600301ULL,0x1E17},{0x29800300ULL,0x1E50},{0x29800301ULL,0x1E52},
+    {0x29A00300ULL,0x1E51},{0x29A00301ULL,0x1E53},{0x2B400307ULL,0x1E64},{0x2B600307ULL,0x1E65},
+    {0x2C000307ULL,0x1E66},{0x2C200307ULL,0x1E67},{0x2D000301ULL,0x1E78},{0x2D200301ULL,0x1E79},
+    {0x2D400308ULL,0x1E7A},{0x2D600308ULL,0x1E7B},{0x2FE00307ULL,0x1E9B},{0x34000300ULL,0x1EDC},
+    {0x34000301ULL,0x1EDA},{0x34000303ULL,0x1EE0},{0x34000309ULL,0x1EDE},{0x34000323ULL,0x1EE2},
+    {0x34200300ULL,0x1EDD},{0x34200301ULL,0x1EDB},{0x34200303ULL,0x1EE1},{0x34200309ULL,0x1EDF},
+    {0x34200323ULL,0x1EE3},{0x35E00300ULL,0x1EEA},{0x35E00301ULL,0x1EE8},{0x35E00303ULL,0x1EEE},
+    {0x35E00309ULL,0x1EEC},{0x35E00323ULL,0x1EF0},{0x36000300ULL,0x1EEB},{0x36000301ULL,0x1EE9},
+    {0x36000303ULL,0x1EEF},{0x36000309ULL,0x1EED},{0x36000323ULL,0x1EF1},{0x36E0030CULL,0x1EE},
+    {0x3D400304ULL,0x1EC},{0x3D600304ULL,0x1ED},{0x44C00304ULL,0x1E0},{0x44E00304ULL,0x1E1},
+    {0x45000306ULL,0x1E1C},{0x45200306ULL,0x1E1D},{0x45C00304ULL,0x230},{0x45E00304ULL,0x231},
+    {0x5240030CULL,0x1EF},{0x72200300ULL,0x1FBA},{0x72200301ULL,0x386},{0x72200304ULL,0x1FB9},
+    {0x72200306ULL,0x1FB8},{0x72200313ULL,0x1F08},{0x72200314ULL,0x1F09},{0x72200345ULL,0x1FBC},
+    {0x72A00300ULL,0x1FC8},{0x72A00301ULL,0x388},{0x72A00313ULL,0x1F18},{0x72A00314ULL,0x1F19},
+    {0x72E00300ULL,0x1FCA},{0x72E00301ULL,0x389},{0x72E00313ULL,0x1F28},{0x72E00314ULL,0x1F29},
+    {0x72E00345ULL,0x1FCC},{0x73200300ULL,0x1FDA},{0x73200301ULL,0x38A},{0x73200304ULL,0x1FD9},
+    {0x73200306ULL,0x1FD8},{0x73200308ULL,0x3AA},{0x73200313ULL,0x1F38},{0x73200314ULL,0x1F39},
+    {0x73E00300ULL,0x1FF8},{0x73E00301ULL,0x38C},{0x73E00313ULL,0x1F48},{0x73E00314ULL,0x1F49},
+    {0x74200314ULL,0x1FEC},{0x74A00300ULL,0x1FEA},{0x74A00301ULL,0x38E},{0x74A00304ULL,0x1FE9},
+    {0x74A00306ULL,0x1FE8},{0x74A00308ULL,0x3AB},{0x74A00314ULL,0x1F59},{0x75200300ULL,0x1FFA},
+    {0x75200301ULL,0x38F},{0x75200313ULL,0x1F68},{0x75200314ULL,0x1F69},{0x75200345ULL,0x1FFC},
+    {0x75800345ULL,0x1FB4},{0x75C00345ULL,0x1FC4},{0x76200300ULL,0x1F70},{0x76200301ULL,0x3AC},
+    {0x76200304ULL,0x1FB1},{0x76200306ULL,0x1FB0},{0x76200313ULL,0x1F00},{0x76200314ULL,0x1F01},
+    {0x76200342ULL,0x1FB6},{0x76200345ULL,0x1FB3},{0x76A00300ULL,0x1F72},{0x76A00301ULL,0x3AD},
+    {0x76A00313ULL,0x1F10},{0x76A00314ULL,0x1F11},{0x76E00300ULL,0x1F74},{0x76E00301ULL,0x3AE},
+    {0x76E00313ULL,0x1F20},{0x76E00314ULL,0x1F21},{0x76E00342ULL,0x1FC6},{0x76E00345ULL,0x1FC3},
+    {0x77200300ULL,0x1F76},{0x77200301ULL,0x3AF},{0x77200304ULL,0x1FD1},{0x77200306ULL,0x1FD0},
+    {0x77200308ULL,0x3CA},{0x77200313ULL,0x1F30},{0x77200314ULL,0x1F31},{0x77200342ULL,0x1FD6},
+    {0x77E00300ULL,0x1F78},{0x77E00301ULL,0x3CC},{0x77E00313ULL,0x1F40},{0x77E00314ULL,0x1F41},
+    {0x78200313ULL,0x1FE4},{0x78200314ULL,0x1FE5},{0x78A00300ULL,0x1F7A},{0x78A00301ULL,0x3CD},
+    {0x78A00304ULL,0x1FE1},{0x78A00306ULL,0x1FE0},{0x78A00308ULL,0x3CB},{0x78A00313ULL,0x1F50},
+    {0x78A00314ULL,0x1F51},{0x78A00342ULL,0x1FE6},{0x79200300ULL,0x1F7C},{0x79200301ULL,0x3CE},
+    {0x79200313ULL,0x1F60},{0x79200314ULL,0x1F61},{0x79200342ULL,0x1FF6},{0x79200345ULL,0x1FF3},
+    {0x79400300ULL,0x1FD2},{0x79400301ULL,0x390},{0x79400342ULL,0x1FD7},{0x79600300ULL,0x1FE2},
+    {0x79600301ULL,0x3B0},{0x79600342ULL,0x1FE7},{0x79C00345ULL,0x1FF4},{0x7A400301ULL,0x3D3},
+    {0x7A400308ULL,0x3D4},{0x80C00308ULL,0x407},{0x82000306ULL,0x4D0},{0x82000308ULL,0x4D2},
+    {0x82600301ULL,0x403},{0x82A00300ULL,0x400},{0x82A00306ULL,0x4D6},{0x82A00308ULL,0x401},
+    {0x82C00306ULL,0x4C1},{0x82C00308ULL,0x4DC},{0x82E00308ULL,0x4DE},{0x83000300ULL,0x40D},
+    {0x83000304ULL,0x4E2},{0x83000306ULL,0x419},{0x83000308ULL,0x4E4},{0x83400301ULL,0x40C},
+    {0x83C00308ULL,0x4E6},{0x84600304ULL,0x4EE},{0x84600306ULL,0x40E},{0x84600308ULL,0x4F0},
+    {0x8460030BULL,0x4F2},{0x84E00308ULL,0x4F4},{0x85600308ULL,0x4F8},{0x85A00308ULL,0x4EC},
+    {0x86000306ULL,0x4D1},{0x86000308ULL,0x4D3},{0x86600301ULL,0x453},{0x86A00300ULL,0x450},
+    {0x86A00306ULL,0x4D7},{0x86A00308ULL,0x451},{0x86C00306ULL,0x4C2},{0x86C00308ULL,0x4DD},
+    {0x86E00308ULL,0x4DF},{0x87000300ULL,0x45D},{0x87000304ULL,0x4E3},{0x87000306ULL,0x439},
+    {0x87000308ULL,0x4E5},{0x87400301ULL,0x45C},{0x87C00308ULL,0x4E7},{0x88600304ULL,0x4EF},
+    {0x88600306ULL,0x45E},{0x88600308ULL,0x4F1},{0x8860030BULL,0x4F3},{0x88E00308ULL,0x4F5},
+    {0x89600308ULL,0x4F9},{0x89A00308ULL,0x4ED},{0x8AC00308ULL,0x457},{0x8E80030FULL,0x476},
+    {0x8EA0030FULL,0x477},{0x9B000308ULL,0x4DA},{0x9B200308ULL,0x4DB},{0x9D000308ULL,0x4EA},
+    {0x9D200308ULL,0x4EB},{0xC4E00653ULL,0x622},{0xC4E00654ULL,0x623},{0xC4E00655ULL,0x625},
+    {0xC9000654ULL,0x624},{0xC9400654ULL,0x626},{0xD8200654ULL,0x6C2},{0xDA400654ULL,0x6D3},
+    {0xDAA00654ULL,0x6C0},{0x12500093CULL,0x929},{0x12600093CULL,0x931},{0x12660093CULL,0x934},
+    {0x138E009BEULL,0x9CB},{0x138E009D7ULL,0x9CC},{0x168E00B3EULL,0xB4B},{0x168E00B56ULL,0xB48},
+    {0x168E00B57ULL,0xB4C},{0x172400BD7ULL,0xB94},{0x178C00BBEULL,0xBCA},{0x178C00BD7ULL,0xBCC},
+    {0x178E00BBEULL,0xBCB},{0x188C00C56ULL,0xC48},{0x197E00CD5ULL,0xCC0},{0x198C00CC2ULL,0xCCA},
+    {0x198C00CD5ULL,0xCC7},{0x198C00CD6ULL,0xCC8},{0x199400CD5ULL,0xCCB},{0x1A8C00D3EULL,0xD4A},
+    {0x1A8C00D57ULL,0xD4C},{0x1A8E00D3EULL,0xD4B},{0x1BB200DCAULL,0xDDA},{0x1BB200DCFULL,0xDDC},
+    {0x1BB200DDFULL,0xDDE},{0x1BB800DCAULL,0xDDD},{0x204A0102EULL,0x1026},{0x360A01B35ULL,0x1B06},
+    {0x360E01B35ULL,0x1B08},{0x361201B35ULL,0x1B0A},{0x361601B35ULL,0x1B0C},{0x361A01B35ULL,0x1B0E},
+    {0x362201B35ULL,0x1B12},{0x367401B35ULL,0x1B3B},{0x367801B35ULL,0x1B3D},{0x367C01B35ULL,0x1B40},
+    {0x367E01B35ULL,0x1B41},{0x368401B35ULL,0x1B43},{0x3C6C00304ULL,0x1E38},{0x3C6E00304ULL,0x1E39},
+    {0x3CB400304ULL,0x1E5C},{0x3CB600304ULL,0x1E5D},{0x3CC400307ULL,0x1E68},{0x3CC600307ULL,0x1E69},
+    {0x3D4000302ULL,0x1EAC},{0x3D4000306ULL,0x1EB6},{0x3D4200302ULL,0x1EAD},{0x3D4200306ULL,0x1EB7},
+    {0x3D7000302ULL,0x1EC6},{0x3D7200302ULL,0x1EC7},{0x3D9800302ULL,0x1ED8},{0x3D9A00302ULL,0x1ED9},
+    {0x3E0000300ULL,0x1F02},{0x3E0000301ULL,0x1F04},{0x3E0000342ULL,0x1F06},{0x3E0000345ULL,0x1F80},
+    {0x3E0200300ULL,0x1F03},{0x3E0200301ULL,0x1F05},{0x3E0200342ULL,0x1F07},{0x3E0200345ULL,0x1F81},
+    {0x3E0400345ULL,0x1F82},{0x3E0600345ULL,0x1F83},{0x3E0800345ULL,0x1F84},{0x3E0A00345ULL,0x1F85},
+    {0x3E0C00345ULL,0x1F86},{0x3E0E00345ULL,0x1F87},{0x3E1000300ULL,0x1F0A},{0x3E1000301ULL,0x1F0C},
+    {0x3E1000342ULL,0x1F0E},{0x3E1000345ULL,0x1F88},{0x3E1200300ULL,0x1F0B},{0x3E1200301ULL,0x1F0D},
+    {0x3E1200342ULL,0x1F0F},{0x3E1200345ULL,0x1F89},{0x3E1400345ULL,0x1F8A},{0x3E1600345ULL,0x1F8B},
+    {0x3E1800345ULL,0x1F8C},{0x3E1A00345ULL,0x1F8D},{0x3E1C00345ULL,0x1F8E},{0x3E1E00345ULL,0x1F8F},
+    {0x3E2000300ULL,0x1F12},{0x3E2000301ULL,0x1F14},{0x3E2200300ULL,0x1F13},{0x3E2200301ULL,0x1F15},
+    {0x3E3000300ULL,0x1F1A},{0x3E3000301ULL,0x1F1C},{0x3E3200300ULL,0x1F1B},{0x3E3200301ULL,0x1F1D},
+    {0x3E4000300ULL,0x1F22},{0x3E4000301ULL,0x1F24},{0x3E4000342ULL,0x1F26},{0x3E4000345ULL,0x1F90},
+    {0x3E4200300ULL,0x1F23},{0x3E4200301ULL,0x1F25},{0x3E4200342ULL,0x1F27},{0x3E4200345ULL,0x1F91},
+    {0x3E4400345ULL,0x1F92},{0x3E4600345ULL,0x1F93},{0x3E4800345ULL,0x1F94},{0x3E4A00345ULL,0x1F95},
+    {0x3E4C00345ULL,0x1F96},{0x3E4E00345ULL,0x1F97},{0x3E5000300ULL,0x1F2A},{0x3E5000301ULL,0x1F2C},
+    {0x3E5000342ULL,0x1F2E},{0x3E5000345ULL,0x1F98},{0x3E5200300ULL,0x1F2B},{0x3E5200301ULL,0x1F2D},
+    {0x3E5200342ULL,0x1F2F},{0x3E5200345ULL,0x1F99},{0x3E5400345ULL,0x1F9A},{0x3E5600345ULL,0x1F9B},
+    {0x3E5800345ULL,0x1F9C},{0x3E5A00345ULL,0x1F9D},{0x3E5C00345ULL,0x1F9E},{0x3E5E00345ULL,0x1F9F},
+    {0x3E6000300ULL,0x1F32},{0x3E6000301ULL,0x1F34},{0x3E6000342ULL,0x1F36},{0x3E6200300ULL,0x1F33},
+    {0x3E6200301ULL,0x1F35},{0x3E6200342ULL,0x1F37},{0x3E7000300ULL,0x1F3A},{0x3E7000301ULL,0x1F3C},
+    {0x3E7000342ULL,0x1F3E},{0x3E7200300ULL,0x1F3B},{0x3E7200301ULL,0x1F3D},{0x3E7200342ULL,0x1F3F},
+    {0x3E8000300ULL,0x1F42},{0x3E8000301ULL,0x1F44},{0x3E8200300ULL,0x1F43},{0x3E8200301ULL,0x1F45},
+    {0x3E9000300ULL,0x1F4A},{0x3E9000301ULL,0x1F4C},{0x3E9200300ULL,0x1F4B},{0x3E9200301ULL,0x1F4D},
+    {0x3EA000300ULL,0x1F52},{0x3EA000301ULL,0x1F54},{0x3EA000342ULL,0x1F56},{0x3EA200300ULL,0x1F53},
+    {0x3EA200301ULL,0x1F55},{0x3EA200342ULL,0x1F57},{0x3EB200300ULL,0x1F5B},{0x3EB200301ULL,0x1F5D},
+    {0x3EB200342ULL,0x1F5F},{0x3EC000300ULL,0x1F62},{0x3EC000301ULL,0x1F64},{0x3EC000342ULL,0x1F66},
+    {0x3EC000345ULL,0x1FA0},{0x3EC200300ULL,0x1F63},{0x3EC200301ULL,0x1F65},{0x3EC200342ULL,0x1F67},
+    {0x3EC200345ULL,0x1FA1},{0x3EC400345ULL,0x1FA2},{0x3EC600345ULL,0x1FA3},{0x3EC800345ULL,0x1FA4},
+    {0x3ECA00345ULL,0x1FA5},{0x3ECC00345ULL,0x1FA6},{0x3ECE00345ULL,0x1FA7},{0x3ED000300ULL,0x1F6A},
+    {0x3ED000301ULL,0x1F6C},{0x3ED000342ULL,0x1F6E},{0x3ED000345ULL,0x1FA8},{0x3ED200300ULL,0x1F6B},
+    {0x3ED200301ULL,0x1F6D},{0x3ED200342ULL,0x1F6F},{0x3ED200345ULL,0x1FA9},{0x3ED400345ULL,0x1FAA},
+    {0x3ED600345ULL,0x1FAB},{0x3ED800345ULL,0x1FAC},{0x3EDA00345ULL,0x1FAD},{0x3EDC00345ULL,0x1FAE},
+    {0x3EDE00345ULL,0x1FAF},{0x3EE000345ULL,0x1FB2},{0x3EE800345ULL,0x1FC2},{0x3EF800345ULL,0x1FF2},
+    {0x3F6C00345ULL,0x1FB7},{0x3F7E00300ULL,0x1FCD},{0x3F7E00301ULL,0x1FCE},{0x3F7E00342ULL,0x1FCF},
+    {0x3F8C00345ULL,0x1FC7},{0x3FEC00345ULL,0x1FF7},{0x3FFC00300ULL,0x1FDD},{0x3FFC00301ULL,0x1FDE},
+    {0x3FFC00342ULL,0x1FDF},{0x432000338ULL,0x219A},{0x432400338ULL,0x219B},{0x432800338ULL,0x21AE},
+    {0x43A000338ULL,0x21CD},{0x43A400338ULL,0x21CF},{0x43A800338ULL,0x21CE},{0x440600338ULL,0x2204},
+    {0x441000338ULL,0x2209},{0x441600338ULL,0x220C},{0x444600338ULL,0x2224},{0x444A00338ULL,0x2226},
+    {0x447800338ULL,0x2241},{0x448600338ULL,0x2244},{0x448A00338ULL,0x2247},{0x449000338ULL,0x2249},
+    {0x449A00338ULL,0x226D},{0x44C200338ULL,0x2262},{0x44C800338ULL,0x2270},{0x44CA00338ULL,0x2271},
+    {0x44E400338ULL,0x2274},{0x44E600338ULL,0x2275},{0x44EC00338ULL,0x2278},{0x44EE00338ULL,0x2279},
+    {0x44F400338ULL,0x2280},{0x44F600338ULL,0x2281},{0x44F800338ULL,0x22E0},{0x44FA00338ULL,0x22E1},
+    {0x450400338ULL,0x2284},{0x450600338ULL,0x2285},{0x450C00338ULL,0x2288},{0x450E00338ULL,0x2289},
+    {0x452200338ULL,0x22E2},{0x452400338ULL,0x22E3},{0x454400338ULL,0x22AC},{0x455000338ULL,0x22AD},
+    {0x455200338ULL,0x22AE},{0x455600338ULL,0x22AF},{0x456400338ULL,0x22EA},{0x456600338ULL,0x22EB},
+    {0x456800338ULL,0x22EC},{0x456A00338ULL,0x22ED},{0x608C03099ULL,0x3094},{0x609603099ULL,0x304C},
+    {0x609A03099ULL,0x304E},{0x609E03099ULL,0x3050},{0x60A203099ULL,0x3052},{0x60A603099ULL,0x3054},
+    {0x60AA03099ULL,0x3056},{0x60AE03099ULL,0x3058},{0x60B203099ULL,0x305A},{0x60B603099ULL,0x305C},
+    {0x60BA03099ULL,0x305E},{0x60BE03099ULL,0x3060},{0x60C203099ULL,0x3062},{0x60C803099ULL,0x3065},
+    {0x60CC03099ULL,0x3067},{0x60D003099ULL,0x3069},{0x60DE03099ULL,0x3070},{0x60DE0309AULL,0x3071},
+    {0x60E403099ULL,0x3073},{0x60E40309AULL,0x3074},{0x60EA03099ULL,0x3076},{0x60EA0309AULL,0x3077},
+    {0x60F003099ULL,0x3079},{0x60F00309AULL,0x307A},{0x60F603099ULL,0x307C},{0x60F60309AULL,0x307D},
+    {0x613A03099ULL,0x309E},{0x614C03099ULL,0x30F4},{0x615603099ULL,0x30AC},{0x615A03099ULL,0x30AE},
+    {0x615E03099ULL,0x30B0},{0x616203099ULL,0x30B2},{0x616603099ULL,0x30B4},{0x616A03099ULL,0x30B6},
+    {0x616E03099ULL,0x30B8},{0x617203099ULL,0x30BA},{0x617603099ULL,0x30BC},{0x617A03099ULL,0x30BE},
+    {0x617E03099ULL,0x30C0},{0x618203099ULL,0x30C2},{0x618803099ULL,0x30C5},{0x618C03099ULL,0x30C7},
+    {0x619003099ULL,0x30C9},{0x619E03099ULL,0x30D0},{0x619E0309AULL,0x30D1},{0x61A403099ULL,0x30D3},
+    {0x61A40309AULL,0x30D4},{0x61AA03099ULL,0x30D6},{0x61AA0309AULL,0x30D7},{0x61B003099ULL,0x30D9},
+    {0x61B00309AULL,0x30DA},{0x61B603099ULL,0x30DC},{0x61B60309AULL,0x30DD},{0x61DE03099ULL,0x30F7},
+    {0x61E003099ULL,0x30F8},{0x61E203099ULL,0x30F9},{0x61E403099ULL,0x30FA},{0x61FA03099ULL,0x30FE},
+    {0x22132110BAULL,0x1109A},{0x22136110BAULL,0x1109C},{0x2214A110BAULL,0x110AB},{0x2226211127ULL,0x1112E},
+    {0x2226411127ULL,0x1112F},{0x2268E1133EULL,0x1134B},{0x2268E11357ULL,0x1134C},{0x22972114B0ULL,0x114BC},
+    {0x22972114BAULL,0x114BB},{0x22972114BDULL,0x114BE},{0x22B70115AFULL,0x115BA},{0x22B72115AFULL,0x115BB},
+    {0x2326A11930ULL,0x11938},
+};
+
+#endif /* BBPE_NORMALIZE_TABLES_H */
@@ -16,10 +16,21 @@
  * - pcre2：正则引擎
  * - uthash：哈希表实现
  *
+ * 线程安全：加载完成后编码/解码不修改分词器 (临时缓冲区位于调用内或 BBPEWorkspace 中，
+ * 唯一的共享可变状态——词级缓存——由 cache_lock 保护)，同一句柄可被多个线程并发使用。
+ *
  * 优化：使用优先队列（最小堆）加速 BPE 合并过程，复杂度 O(n log n)。
  * 修正：堆比较加入位置信息（节点原始下标），确保优先级相同时选择最左边的合并，结果与原始线性扫描一致。
  */
 
+/* NUMA 副本 (BBPE_ENABLE_NUMA) 需要 cpu_set_t 与 pthread_setaffinity_np，须在任何系统头文件之前定义 */
+#if defined(BBPE_ENABLE_NUMA) && defined(__linux__)
+#define BBPE_NUMA 1
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#endif
+
 #include "bbpe_tokenizer.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -28,1814 +39,9480 @@
 #include <limits.h>
 #include <assert.h>
 
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+#endif
+#ifdef BBPE_NUMA
+#include <sched.h>
+#endif
+
+/* ASCII 快速路径的 SIMD 实现：x86 使用 SSE2，ARM (含 -mfpu=neon 的 armv7-a) 使用 NEON，
+   定义 BBPE_DISABLE_SIMD 或其他平台时退回按 8 字节字检查 */
+#if !defined(BBPE_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BBPE_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif !defined(BBPE_DISABLE_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define BBPE_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
 #include "cJSON.h"
 #include "pcre2.h"
+
+/* uthash 的哈希桶与词级缓存条目一样由分词器的分配器分配：使用会分配或释放桶的宏 (HASH_ADD* / HASH_DEL*)
+   的函数须在作用域内声明 cache_allocator */
+#define uthash_malloc(sz) mem_alloc(cache_allocator, sz)
+#define uthash_free(ptr, sz) mem_free(cache_allocator, ptr)
 #include "uthash.h"
+#include "bbpe_unicode_tables.h"
+#include "bbpe_normalize_tables.h"
 
 // ============================================================================
 // 常量定义
 // ============================================================================
 #define STRING_TEMP_SIZE 0xff /* 用于合并规则解析的临时缓冲区大小 */
 #define UNICODE_MAP_SIZE 512  /* unicode_to_byte 映射表大小，必须大于最大 Unicode 码点 */
+#define WORD_CACHE_MAX_KEY 64 /* 可进入词级缓存的文本块最大字节数，更长的块直接走合并流程 */
+#define SMALL_CHUNK_MAX 16    /* 不超过该字节数的文本块使用栈上数组线性扫描合并，更长的块使用优先队列 */
+#define RADIX_CHUNK_MIN 17    /* 不短于该字节数的文本块以基数堆代替最小堆管理合并候选 (实测自 17 字节起即快于最小堆) */
+#define MERGE_PAIR_EMPTY UINT64_MAX /* 合并规则哈希表空槽标记 (合法 ID 非负，不会产生该键) */
+#define BATCH_MAX_THREADS 256       /* bbpe_encode_batch 使用的最大线程数 */
+#define IMAGE_VERSION 3             /* 可直接映射的二进制格式版本号 */
+#define IMAGE_VERSION_WIDE_RULES 2  /* 规则项为 12 字节三元组的旧镜像版本 (加载时转换为 64 位规则项) */
+#define IMAGE_ALIGN 64              /* 二进制镜像中各数据段的对齐字节数 */
+#define PARALLEL_MIN_BYTES 65536    /* bbpe_encode_parallel 中短于该字节数的输入直接串行编码 */
+#define PARALLEL_RANGE_BYTES 16384  /* 并行编码时每个任务区间的最小字节数 */
+#define TRUNCATE_BYTES_PER_TOKEN 8  /* 截断编码按剩余 token 数 × 该值确定每轮预分词的窗口字节数 */
+#define TRUNCATE_WINDOW_MIN 1024    /* 截断编码的最小窗口字节数 */
+#define SPLIT_REGEX_OPTIONS (PCRE2_UTF | PCRE2_UCP) /* Split 正则的编译选项 (加载预编译结果时据此校验) */
+#define LOAD_DEFER_FLAGS (BBPE_LOAD_LAZY_MERGES | BBPE_LOAD_DECODE_ONLY) /* 推迟 (或不) 构建规则行与正则的加载标志 */
+#define LOAD_KEPT_FLAGS (LOAD_DEFER_FLAGS | BBPE_LOAD_PARALLEL)         /* 记录在分词器中的加载标志 */
+#define MERGE_RESOLVE_BLOCK 4096 /* 并行解析合并规则时每次领取的规则数 */
+#define DECODE_BATCH_BLOCK 64         /* bbpe_decode_batch 中工作线程每次领取的序列数 */
+#define DECODE_BATCH_MIN_IDS 65536    /* bbpe_decode_batch 中 ID 总数少于该值时直接串行解码 */
+#define STABLE_TOKEN_MAX 64      /* 参与整词直查的 token 最大字节数 (解码后)，更长的块直接走合并流程 */
+#define STREAM_RETRY_MIN 4096    /* 流式编码器暂存超过该字节数仍找不到切分点时，待缓冲区增长 1/4 后再重新查找 */
+#define JIT_STACK_START 32768    /* 工作区 JIT 栈的初始字节数 (与 PCRE2 默认使用的机器栈大小相同) */
+#define JIT_STACK_MAX (1 << 20)  /* 工作区 JIT 栈可增长到的最大字节数，仍不足时该次匹配改用解释器 */
+#define NORM_SORT_INSERTION 16   /* 规范排序中不超过该长度的非起始字符序列使用插入排序，更长的使用计数排序 */
 
 // ============================================================================
-// uthash 结构定义
+// 线程与互斥锁 (Win32 / pthread 封装)
 // ============================================================================
 
+#ifdef _WIN32
+typedef CRITICAL_SECTION bbpe_mutex_t;
+typedef CONDITION_VARIABLE bbpe_cond_t;
+typedef HANDLE bbpe_thread_t;
+#else
+typedef pthread_mutex_t bbpe_mutex_t;
+typedef pthread_cond_t bbpe_cond_t;
+typedef pthread_t bbpe_thread_t;
+#endif
+
 /**
- * @brief 词汇表项：token 字符串 → id
+ * @brief 线程入口：在线程中调用 fn(arg)
  */
 typedef struct
 {
-    char *token;       /* token 字符串 (UTF-8) */
-    int id;            /* token ID */
-    UT_hash_handle hh; /* uthash 句柄 */
-} VocabEntry;
+    void (*fn)(void *);
+    void *arg;
+} ThreadStart;
+
+static void mutex_init(bbpe_mutex_t *m)
+{
+#ifdef _WIN32
+    InitializeCriticalSection(m);
+#else
+    pthread_mutex_init(m, NULL);
+#endif
+}
+
+static void mutex_destroy(bbpe_mutex_t *m)
+{
+#ifdef _WIN32
+    DeleteCriticalSection(m);
+#else
+    pthread_mutex_destroy(m);
+#endif
+}
+
+static void mutex_lock(bbpe_mutex_t *m)
+{
+#ifdef _WIN32
+    EnterCriticalSection(m);
+#else
+    pthread_mutex_lock(m);
+#endif
+}
+
+static void mutex_unlock(bbpe_mutex_t *m)
+{
+#ifdef _WIN32
+    LeaveCriticalSection(m);
+#else
+    pthread_mutex_unlock(m);
+#endif
+}
+
+static void cond_init(bbpe_cond_t *c)
+{
+#ifdef _WIN32
+    InitializeConditionVariable(c);
+#else
+    pthread_cond_init(c, NULL);
+#endif
+}
+
+static void cond_destroy(bbpe_cond_t *c)
+{
+#ifdef _WIN32
+    (void)c; // Win32 条件变量无需销毁
+#else
+    pthread_cond_destroy(c);
+#endif
+}
 
 /**
- * @brief 特殊 token 表项
+ * @brief 释放 m 并等待 c 被唤醒，返回前重新持有 m (可能虚假唤醒，调用者须在循环中检查条件)
  */
-typedef struct
+static void cond_wait(bbpe_cond_t *c, bbpe_mutex_t *m)
+{
+#ifdef _WIN32
+    SleepConditionVariableCS(c, m, INFINITE);
+#else
+    pthread_cond_wait(c, m);
+#endif
+}
+
+static void cond_broadcast(bbpe_cond_t *c)
 {
-    char *token; /* 特殊 token 字符串 */
-    int id;      /* 对应的 ID */
-    UT_hash_handle hh;
-} SpecialEntry;
+#ifdef _WIN32
+    WakeAllConditionVariable(c);
+#else
+    pthread_cond_broadcast(c);
+#endif
+}
 
 /**
- * @brief 单个合并规则信息
+ * @brief 以获取语义读取标志 (与 flag_store 配对，用于加锁前的快速检查)
  */
-typedef struct
+static int flag_load(const int *flag)
 {
-    int32_t right_id; /* 右 token ID */
-    int32_t new_id;   /* 合并后产生的新 token ID */
-    int32_t priority; /* 优先级 (通常为合并顺序索引，越小优先级越高) */
-} MergeRuleItem;
+#ifdef _WIN32
+    return (int)InterlockedCompareExchange((volatile LONG *)flag, 0, 0);
+#else
+    return __atomic_load_n(flag, __ATOMIC_ACQUIRE);
+#endif
+}
 
 /**
- * @brief 每个 left 对应的规则行 (按 right_id 排序)
+ * @brief 以释放语义写入标志：此前的写入对读到新值的线程均可见
  */
-typedef struct
+static void flag_store(int *flag, int value)
 {
-    MergeRuleItem *items; /* 规则项数组，按 right_id 升序排列 */
-    uint32_t count;       /* 规则数量 */
-} MergeRuleRow;
+#ifdef _WIN32
+    InterlockedExchange((volatile LONG *)flag, (LONG)value);
+#else
+    __atomic_store_n(flag, value, __ATOMIC_RELEASE);
+#endif
+}
 
-// ============================================================================
-// 预分词器配置 (链表节点)
-// ============================================================================
+/**
+ * @brief 原子地把 *value 加上 delta (引用计数)
+ * @return 相加后的值
+ */
+static int atomic_add(int *value, int delta)
+{
+#ifdef _WIN32
+    return (int)InterlockedExchangeAdd((volatile LONG *)value, (LONG)delta) + delta;
+#else
+    return __atomic_add_fetch(value, delta, __ATOMIC_ACQ_REL);
+#endif
+}
+
+#ifdef _WIN32
+static DWORD WINAPI thread_entry(LPVOID param)
+{
+    ThreadStart *start = (ThreadStart *)param;
+    start->fn(start->arg);
+    return 0;
+}
+#else
+static void *thread_entry(void *param)
+{
+    ThreadStart *start = (ThreadStart *)param;
+    start->fn(start->arg);
+    return NULL;
+}
+#endif
 
 /**
- * @brief 预分词器类型
+ * @brief 启动线程
+ * @param thread 输出线程句柄
+ * @param start 线程入口 (需在线程结束前保持有效)
+ * @return 成功返回 1，失败返回 0
  */
-typedef enum
+static int thread_start(bbpe_thread_t *thread, ThreadStart *start)
 {
-    PRE_TOKENIZER_NONE,       /* 无操作 */
-    PRE_TOKENIZER_BYTE_LEVEL, /* ByteLevel 预分词器 (添加前缀空格) */
-    PRE_TOKENIZER_REGEX_SPLIT /* 正则分割预分词器 */
-} PreTokenizerType;
+#ifdef _WIN32
+    *thread = CreateThread(NULL, 0, thread_entry, start, 0, NULL);
+    return *thread != NULL;
+#else
+    return pthread_create(thread, NULL, thread_entry, start) == 0;
+#endif
+}
+
+static void thread_join(bbpe_thread_t thread)
+{
+#ifdef _WIN32
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
 
 /**
- * @brief 预分词器链表节点
+ * @brief 获取在线逻辑处理器数，无法获取时返回 1
  */
-typedef struct PreTokenizerNode
+static int cpu_count(void)
 {
-    PreTokenizerType type; /* 类型 */
-    union
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)(n > INT_MAX ? INT_MAX : n) : 1;
+#endif
+}
+
+/**
+ * @brief 以 num_threads 个线程并行运行 fn(arg)：调用线程自身作为其中一个，其余新建
+ * @param num_threads 期望线程数 (>= 1)
+ * @param fn 工作函数，各线程自行从共享状态领取任务直至完成
+ * @param arg 共享状态
+ * @note 线程创建失败时以已启动的线程继续，工作函数必须能在任意线程数下完成全部任务
+ */
+static void run_parallel(int num_threads, void (*fn)(void *), void *arg)
+{
+    bbpe_thread_t threads[BATCH_MAX_THREADS];
+    ThreadStart start = {fn, arg};
+    int started = 0;
+    if (num_threads > BATCH_MAX_THREADS)
+        num_threads = BATCH_MAX_THREADS;
+    for (int i = 1; i < num_threads; i++)
     {
-        struct
-        {
-            int add_prefix_space; /* 是否在文本前添加空格 (ByteLevel) */
-        } byte_level;
-        struct
-        {
-            char *regex_pattern;        /* 正则表达式字符串，由节点负责释放 */
-            pcre2_code *regex_compiled; /* 编译后的 pcre2 正则代码 */
-        } split;
-    } config;                      /* 类型相关的配置 */
-    struct PreTokenizerNode *next; /* 下一个预分词器节点 (构成链) */
-} PreTokenizerNode;
+        if (!thread_start(&threads[started], &start))
+            break;
+        started++;
+    }
+    fn(arg);
+    for (int i = 0; i < started; i++)
+        thread_join(threads[i]);
+}
 
 // ============================================================================
-// 分词器主结构
+// 内存分配 (BBPEAllocator 封装)
 // ============================================================================
+//
+// 分词器持有的全部内存 (含镜像副本、PCRE2 与 cJSON 的内部分配、uthash 哈希桶) 经其分配器分配；
+// 工作区使用各自的分配器。交给调用者释放的结果 (BBPEOutput、BBPEOffsets、解码字符串、
+// bbpe_save_to_memory 的缓冲区) 仍使用 malloc，以便调用者按原有约定释放。
+// 分配器为 NULL 或其 alloc 为 NULL 时表示标准库 malloc/realloc/free。
 
 /**
- * @brief BBPE 分词器主结构 (不透明指针的具体定义)
+ * @brief 分配 size 字节 (size 为 0 时按 1 字节分配，保证成功时返回非 NULL)
  */
-struct BBPETokenizer
+static void *mem_alloc(const BBPEAllocator *a, size_t size)
 {
-    VocabEntry *vocab_map;                     /* 词汇表哈希表 (token→id) */
-    size_t merge_count;                        /* 合并规则总数 (仅用于统计) */
-    MergeRuleRow *rule_rows;                   /* 规则行数组，索引为 left_id，每行按 right_id 排序 */
-    uint32_t vocab_size;                       /* 词汇表大小 (最大 id + 1) */
-    SpecialEntry *special_tokens_map;          /* 特殊 token 哈希表 (token→id) */
-    uint32_t byte_to_unicode[256];             /* 字节 → Unicode 码点映射 (ByteLevel) */
-    uint8_t unicode_to_byte[UNICODE_MAP_SIZE]; /* Unicode 码点 → 字节映射 (用于解码) */
-    char **id_to_token;                        /* id → token 字符串数组 (指向 vocab 或 special 中的字符串) */
-    PreTokenizerNode *pre_tokenizers;          /* 预分词器链表头 */
-    char *byte_vocab_strs[256];                /* 预计算的字节对应字符串 (UTF-8)，用于快速查找字节 token */
-};
+    if (size == 0)
+        size = 1;
+    return a && a->alloc ? a->alloc(a->user_data, size) : malloc(size);
+}
 
-// ============================================================================
-// 预分词中间结果
-// ============================================================================
+/**
+ * @brief 分配 count × size 字节并清零 (乘积溢出时返回 NULL)
+ */
+static void *mem_calloc(const BBPEAllocator *a, size_t count, size_t size)
+{
+    if (!a || !a->alloc)
+        return calloc(count ? count : 1, size ? size : 1);
+    if (size != 0 && count > SIZE_MAX / size)
+        return NULL;
+    void *ptr = mem_alloc(a, count * size);
+    if (ptr)
+        memset(ptr, 0, count * size);
+    return ptr;
+}
 
 /**
- * @brief 预分词产生的多个文本块
+ * @brief 调整 ptr 的大小 (ptr 为 NULL 时等同于 mem_alloc；size 为 0 时按 1 字节处理，不会释放 ptr)
  */
-typedef struct
+static void *mem_realloc(const BBPEAllocator *a, void *ptr, size_t size)
 {
-    char **chunks; /* 文本块数组，每个块以 '\0' 结尾，由本结构负责释放 */
-    size_t count;  /* 块数量 */
-} PreTokenizedResult;
+    if (size == 0)
+        size = 1;
+    if (!a || !a->alloc)
+        return realloc(ptr, size);
+    return ptr ? a->realloc(a->user_data, ptr, size) : a->alloc(a->user_data, size);
+}
 
 /**
- * @brief 分段结构：普通文本段或特殊 token 段
+ * @brief 释放 mem_alloc / mem_calloc / mem_realloc 的结果 (NULL 时什么也不做)
  */
-typedef struct
+static void mem_free(const BBPEAllocator *a, void *ptr)
 {
-    int is_special; /* 1 表示特殊 token 段，0 表示普通文本段 */
-    char *text;     /* 当 is_special==0 时有效，为普通文本段 (需要释放) */
-    int special_id; /* 当 is_special==1 时有效，为特殊 token 的 ID */
-} TokenSegment;
+    if (!ptr)
+        return;
+    if (a && a->alloc)
+        a->free(a->user_data, ptr);
+    else
+        free(ptr);
+}
 
-// ============================================================================
-// 优先队列（最小堆）相关结构（修正：比较时加入节点位置作为第二关键字）
-// ============================================================================
+/**
+ * @brief 复制以 '\0' 结尾的字符串
+ */
+static char *mem_strdup(const BBPEAllocator *a, const char *str)
+{
+    size_t n = strlen(str) + 1;
+    char *copy = (char *)mem_alloc(a, n);
+    if (copy)
+        memcpy(copy, str, n);
+    return copy;
+}
 
 /**
- * @brief 链表节点，用于表示 BPE 合并过程中的一个 token
+ * @brief 判断分配器是否为自定义分配器 (否则为标准库分配)
  */
-typedef struct TokenNode
+static int allocator_is_custom(const BBPEAllocator *a)
 {
-    int32_t id;             /* token ID */
-    int pos;                /* 节点在原始序列中的位置（字符索引），用于确定最左边合并 */
-    struct TokenNode *prev; /* 前驱节点 */
-    struct TokenNode *next; /* 后继节点 */
-} TokenNode;
+    return a && a->alloc;
+}
 
 /**
- * @brief 堆元素，表示一个相邻对候选
+ * @brief 检查调用者传入的分配器：NULL，或三个回调齐全
  */
-typedef struct
+static int allocator_valid(const BBPEAllocator *a)
 {
-    TokenNode *left_node;  /* 左节点指针 */
-    TokenNode *right_node; /* 右节点指针 */
-    int32_t left_id;       /* 左节点当时的 ID，用于验证 */
-    int32_t right_id;      /* 右节点当时的 ID，用于验证 */
-    int32_t priority;      /* 优先级（数值越小越优先） */
-    int32_t new_id;        /* 合并后的新 token ID */
-} HeapItem;
+    return !a || (a->alloc && a->realloc && a->free);
+}
+
+static void *pcre2_alloc_hook(PCRE2_SIZE size, void *data)
+{
+    return mem_alloc((const BBPEAllocator *)data, size);
+}
+
+static void pcre2_free_hook(void *ptr, void *data)
+{
+    mem_free((const BBPEAllocator *)data, ptr);
+}
 
 /**
- * @brief 最小堆结构
+ * @brief 为自定义分配器创建 PCRE2 通用上下文
+ * @param a 分配器 (须在由该上下文创建的所有 PCRE2 对象释放之前保持有效)
+ * @param out_context 输出通用上下文；标准库分配时为 NULL (PCRE2 使用默认的 malloc/free)
+ * @return BBPEStatus
  */
-typedef struct
+static BBPEStatus pcre2_memory_create(const BBPEAllocator *a, pcre2_general_context **out_context)
 {
-    HeapItem *items; /* 堆数组 */
-    int size;        /* 当前元素个数 */
-    int capacity;    /* 容量 */
-} MinHeap;
+    *out_context = NULL;
+    if (!allocator_is_custom(a))
+        return BBPE_OK;
+    *out_context = pcre2_general_context_create(pcre2_alloc_hook, pcre2_free_hook, (void *)a);
+    return *out_context ? BBPE_OK : BBPE_ERR_MEMORY;
+}
 
-// ============================================================================
-// 辅助函数 (内存安全复制)
-// ============================================================================
+#ifdef _WIN32
+#define BBPE_THREAD_LOCAL __declspec(thread)
+#else
+#define BBPE_THREAD_LOCAL __thread
+#endif
+
+/* cJSON 的分配钩子是进程级的：首次使用自定义分配器时安装转发函数，由当前线程正在解析的分词器决定实际去向 */
+static BBPE_THREAD_LOCAL const BBPEAllocator *json_allocator; /* 当前线程解析 JSON 片段所用的分配器，NULL 为 malloc */
+static int json_hooks_installed;                               /* 非 0 表示已通过 cJSON_InitHooks 安装转发函数 */
+
+static void *json_alloc_hook(size_t size)
+{
+    return mem_alloc(json_allocator, size);
+}
+
+static void json_free_hook(void *ptr)
+{
+    mem_free(json_allocator, ptr);
+}
 
 /**
- * @brief 安全的 strndup 实现
- * @param s 源字符串
- * @param n 最大复制字符数
- * @return 新分配的字符串，需调用 free 释放，失败返回 NULL
+ * @brief 设置当前线程后续 cJSON 调用所用的分配器 (自定义分配器首次出现时安装 cJSON 钩子)
+ * @param a 分配器，NULL 表示恢复 malloc/free
+ * @note 未设置分配器的线程经转发函数仍调用 malloc/free，安装前后分配与释放始终配对
  */
-static char *my_strndup(const char *s, size_t n)
+static void json_use_allocator(const BBPEAllocator *a)
 {
-    char *p = (char *)malloc(n + 1);
-    if (p)
+    if (allocator_is_custom(a) && !flag_load(&json_hooks_installed))
     {
-        memcpy(p, s, n);
-        p[n] = '\0';
+        cJSON_Hooks hooks = {json_alloc_hook, json_free_hook};
+        cJSON_InitHooks(&hooks);
+        flag_store(&json_hooks_installed, 1);
     }
-    return p;
+    json_allocator = allocator_is_custom(a) ? a : NULL;
 }
 
 // ============================================================================
-// UTF-8 编解码工具函数
+// 编码统计 (以 BBPE_ENABLE_STATS 编译时启用，否则各宏展开为空)
 // ============================================================================
 
+#ifdef BBPE_ENABLE_STATS
 /**
- * @brief 从字符串 s 解码一个 UTF-8 字符
- * @param s 输入字符串指针 (至少包含一个完整字符)
- * @param cp 输出 Unicode 码点
- * @return 使用的字节数 (1-4)，若编码错误返回 -1
+ * @brief 单调时钟 (纳秒)
  */
-static int utf8_decode(const char *s, uint32_t *cp)
+static uint64_t stats_now_ns(void)
 {
-    unsigned char c = (unsigned char)*s;
-    if (c < 0x80)
-    {
-        *cp = c;
-        return 1;
-    }
-    else if ((c & 0xE0) == 0xC0)
-    {
-        if ((s[1] & 0xC0) != 0x80)
-            return -1;
-        *cp = ((c & 0x1F) << 6) | (s[1] & 0x3F);
-        return 2;
-    }
-    else if ((c & 0xF0) == 0xE0)
-    {
-        if ((s[1] & 0xC0) != 0x80 || (s[2] & 0xC0) != 0x80)
-            return -1;
-        *cp = ((c & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
-        return 3;
-    }
-    else if ((c & 0xF8) == 0xF0)
-    {
-        if ((s[1] & 0xC0) != 0x80 || (s[2] & 0xC0) != 0x80 || (s[3] & 0xC0) != 0x80)
-            return -1;
-        *cp = ((c & 0x07) << 18) | ((s[1] & 0x3F) << 12) | ((s[2] & 0x3F) << 6) | (s[3] & 0x3F);
-        return 4;
-    }
-    return -1;
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER counter;
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
 }
 
+/* 统计先记在调用私有的工作区中，调用结束时由 stats_flush 一次性计入分词器 */
+#define STATS_ADD(ws, field, n) ((ws)->stats.field += (n))
+#define STATS_TIMER(var) uint64_t var = stats_now_ns()
+#define STATS_ELAPSED(ws, field, var) ((ws)->stats.field += stats_now_ns() - (var))
+#else
+#define STATS_ADD(ws, field, n) ((void)(ws))
+#define STATS_TIMER(var) ((void)0)
+#define STATS_ELAPSED(ws, field, var) ((void)(ws))
+#endif
+
+// ============================================================================
+// 性能剖析 (BBPE_ENABLE_PROFILE / BBPE_ENABLE_USDT / BBPE_ENABLE_ITT)
+// ============================================================================
+//
+// BBPE_ENABLE_PROFILE 禁止内联各编码阶段的关键函数，配合 -fno-omit-frame-pointer 使采样剖析器
+// (perf、VTune、simpleperf) 的调用栈与火焰图能区分特殊 token 提取、规范化、预分词、规则查找与合并，
+// 而不是全部折叠进 bbpe_encode。其余函数照常内联，编码至多慢 5% 左右。
+// 阶段追踪点与编码统计的计时位于同一处，阶段名为 special / pre_tokenize (含规范化) / merge：
+// BBPE_ENABLE_USDT 生成 bbpe:<阶段>-begin (参数为字节数) 与 bbpe:<阶段>-end 静态探针 (需要 <sys/sdt.h>，
+// 未启用时只是一条 nop)；BBPE_ENABLE_ITT 以 __itt_task_begin/__itt_task_end 在 "bbpe" 域下标注任务
+// (需要 <ittnotify.h> 并链接 libittnotify)。都未定义时各宏展开为空。
+
+#ifdef BBPE_ENABLE_PROFILE
+#if defined(_MSC_VER)
+#define PROFILE_NOINLINE __declspec(noinline)
+#elif defined(__clang__)
+#define PROFILE_NOINLINE __attribute__((noinline))
+#else
+#define PROFILE_NOINLINE __attribute__((noinline, noclone)) /* 不生成 .constprop / .isra 副本，符号名保持不变 */
+#endif
+#else
+#define PROFILE_NOINLINE
+#endif
+
+#ifdef BBPE_ENABLE_USDT
+#include <sys/sdt.h>
+#define USDT_BEGIN(phase, bytes) DTRACE_PROBE1(bbpe, phase##__begin, (size_t)(bytes))
+#define USDT_END(phase) DTRACE_PROBE(bbpe, phase##__end)
+#else
+#define USDT_BEGIN(phase, bytes) ((void)0)
+#define USDT_END(phase) ((void)0)
+#endif
+
+#ifdef BBPE_ENABLE_ITT
+#include <ittnotify.h>
+/* 任务名句柄在创建分词器时取得 (tokenizer_alloc) */
+#define ITT_BEGIN(tok, phase) __itt_task_begin((tok)->itt_domain, __itt_null, __itt_null, (tok)->itt_##phase)
+#define ITT_END(tok, phase) __itt_task_end((tok)->itt_domain)
+#else
+#define ITT_BEGIN(tok, phase) ((void)0)
+#define ITT_END(tok, phase) ((void)0)
+#endif
+
+/* <sys/sdt.h> 的探针展开为语句，因此以 do/while 组合 */
+#define TRACE_BEGIN(tok, phase, bytes) \
+    do                                 \
+    {                                  \
+        USDT_BEGIN(phase, bytes);      \
+        ITT_BEGIN(tok, phase);         \
+    } while (0)
+#define TRACE_END(tok, phase) \
+    do                        \
+    {                         \
+        USDT_END(phase);      \
+        ITT_END(tok, phase);  \
+    } while (0)
+
+// ============================================================================
+// 文件映射 (mmap / Win32 文件映射封装)
+// ============================================================================
+
 /**
- * @brief 将 Unicode 码点编码为 UTF-8
- * @param cp Unicode 码点
- * @param out 输出缓冲区 (至少 5 字节)
- * @return 写入的字节数 (1-4)
+ * @brief 二进制镜像的内存来源，决定释放方式
  */
-static int utf8_encode(uint32_t cp, char *out)
+typedef enum
 {
-    if (cp < 0x80)
+    IMAGE_NONE = 0, /* 无镜像：各结构自行分配 */
+    IMAGE_HEAP,     /* 经分词器的分配器分配的副本，由同一分配器释放 */
+    IMAGE_MAPPED,   /* 只读文件映射，解除映射释放 */
+    IMAGE_BORROWED, /* 调用者提供并保证生命周期的缓冲区，不释放 */
+    IMAGE_STATIC,   /* 编译进程序的只读镜像 (bbpe_from_static)：不释放，视为可信，跳过逐项校验 */
+} ImageKind;
+
+/**
+ * @brief 释放二进制镜像
+ */
+static void release_image(const BBPEAllocator *a, const uint8_t *data, size_t size, ImageKind kind)
+{
+    if (!data)
+        return;
+    switch (kind)
     {
-        out[0] = (char)cp;
-        return 1;
+    case IMAGE_HEAP:
+        mem_free(a, (void *)data);
+        break;
+    case IMAGE_MAPPED:
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+#else
+        munmap((void *)data, size);
+#endif
+        break;
+    default:
+        break;
     }
-    else if (cp < 0x800)
+}
+
+/**
+ * @brief 将整个文件读入堆内存 (无法映射时的回退路径)
+ */
+static BBPEStatus read_whole_file(const char *filename, const BBPEAllocator *a, const uint8_t **out_data,
+                                  size_t *out_size)
+{
+    FILE *f = fopen(filename, "rb");
+    if (!f)
+        return BBPE_ERR_FILE_IO;
+    BBPEStatus status = BBPE_ERR_FILE_IO;
+    uint8_t *data = NULL;
+    long size;
+    if (fseek(f, 0, SEEK_END) != 0 || (size = ftell(f)) <= 0 || fseek(f, 0, SEEK_SET) != 0)
+        goto cleanup;
+    data = (uint8_t *)mem_alloc(a, (size_t)size);
+    if (!data)
     {
-        out[0] = 0xC0 | (cp >> 6);
-        out[1] = 0x80 | (cp & 0x3F);
-        return 2;
+        status = BBPE_ERR_MEMORY;
+        goto cleanup;
     }
-    else if (cp < 0x10000)
+    if (fread(data, 1, (size_t)size, f) != (size_t)size)
+        goto cleanup;
+    *out_data = data;
+    *out_size = (size_t)size;
+    data = NULL;
+    status = BBPE_OK;
+
+cleanup:
+    mem_free(a, data);
+    fclose(f);
+    return status;
+}
+
+/**
+ * @brief 以只读方式映射整个文件，映射失败时回退为读入堆内存
+ * @param filename 文件名
+ * @param a 回退路径所用的分配器
+ * @param out_data 输出镜像起始地址 (按页对齐，或为分配器返回的地址)
+ * @param out_size 输出镜像字节数
+ * @param out_kind 输出镜像来源 (IMAGE_MAPPED 或 IMAGE_HEAP)
+ * @return BBPEStatus
+ */
+static BBPEStatus map_file(const char *filename, const BBPEAllocator *a, const uint8_t **out_data, size_t *out_size,
+                           ImageKind *out_kind)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file != INVALID_HANDLE_VALUE)
     {
-        out[0] = 0xE0 | (cp >> 12);
-        out[1] = 0x80 | ((cp >> 6) & 0x3F);
-        out[2] = 0x80 | (cp & 0x3F);
-        return 3;
+        LARGE_INTEGER file_size;
+        const uint8_t *view = NULL;
+        if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 && (uint64_t)file_size.QuadPart <= SIZE_MAX)
+        {
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping)
+            {
+                // 视图在解除映射前保持有效，句柄可立即关闭
+                view = (const uint8_t *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+        if (view)
+        {
+            *out_data = view;
+            *out_size = (size_t)file_size.QuadPart;
+            *out_kind = IMAGE_MAPPED;
+            return BBPE_OK;
+        }
     }
-    else
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd >= 0)
     {
-        out[0] = 0xF0 | (cp >> 18);
-        out[1] = 0x80 | ((cp >> 12) & 0x3F);
-        out[2] = 0x80 | ((cp >> 6) & 0x3F);
-        out[3] = 0x80 | (cp & 0x3F);
-        return 4;
+        struct stat st;
+        void *view = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && st.st_size > 0 && (uint64_t)st.st_size <= SIZE_MAX)
+            view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (view != MAP_FAILED)
+        {
+            *out_data = (const uint8_t *)view;
+            *out_size = (size_t)st.st_size;
+            *out_kind = IMAGE_MAPPED;
+            return BBPE_OK;
+        }
     }
+#endif
+    *out_kind = IMAGE_HEAP;
+    return read_whole_file(filename, a, out_data, out_size);
 }
 
 // ============================================================================
-// 特殊 token 提取
+// uthash 结构定义
 // ============================================================================
 
 /**
- * @brief 将输入文本按特殊 token 分割成多个段
- * @param tok 分词器句柄
- * @param text 输入文本
- * @param out_len 输出段数量
- * @return 新分配的 TokenSegment 数组，使用后需释放各段 text 及数组本身
+ * @brief 词汇表：开放寻址哈希表 (token 字符串 → id)
+ * @note 所有 token 连续存放在字符串池中 (各自以 '\0' 结尾)，条目按插入顺序编号；
+ *       槽位数组只存条目下标，查找时先比较哈希再比较字符串。
+ *       从镜像加载时另有 bbpe_save 预先计算的最小完美哈希，查找只访问一个槽 (再比较一次字符串)
  */
-static TokenSegment *extract_special_tokens(BBPETokenizer *tok, const char *text, size_t *out_len)
+typedef struct
 {
-    size_t capacity = 16;
-    TokenSegment *segments = (TokenSegment *)malloc(capacity * sizeof(TokenSegment));
-    if (!segments)
-        return NULL;
+    char *pool;             /* 字符串池 */
+    size_t pool_size;       /* 池已用字节数 */
+    size_t pool_capacity;   /* 池容量 (字节) */
+    uint32_t *offsets;      /* 条目 → token 在池中的偏移 */
+    uint32_t *lengths;      /* 条目 → token 字节数 */
+    uint32_t *hashes;       /* 条目 → token 哈希值 */
+    int32_t *ids;           /* 条目 → token ID */
+    uint32_t count;         /* 条目数 */
+    uint32_t capacity;      /* 条目数组容量 */
+    uint32_t *slots;        /* 哈希槽：条目下标 + 1，0 表示空槽 */
+    uint32_t slot_mask;     /* 槽位数 - 1 (槽位数为 2 的幂) */
+    const uint32_t *phf_slots;  /* 最小完美哈希：槽 → 条目下标，PHF_EMPTY 为空 (指向镜像，未加载镜像时为 NULL) */
+    const uint32_t *phf_pilots; /* 各桶的位移值，每个 u32 存两个 u16 (低半字为偶数号桶) */
+    uint32_t phf_buckets;       /* 完美哈希的桶数 */
+    uint32_t phf_slot_count;    /* 完美哈希的槽数 */
+    uint32_t phf_seed;          /* 完美哈希的种子 */
+    const BBPEAllocator *alloc; /* 各数组所用的分配器 (指向所属分词器的分配器) */
+} VocabTable;
+
+/** id_to_entry 中的取值：最高位置位表示特殊 token 表的条目，全 1 表示该 ID 没有 token 字符串 */
+#define ID_ENTRY_SPECIAL 0x80000000u
+#define ID_ENTRY_NONE UINT32_MAX
+
+/**
+ * @brief 特殊 token 前缀树节点 (节点 0 为根，子节点以兄弟链表相连，下标 0 表示无)
+ */
+typedef struct
+{
+    uint32_t first_child;  /* 第一个子节点下标 */
+    uint32_t next_sibling; /* 下一个兄弟节点下标 */
+    int32_t token_id;      /* 以该节点结尾的特殊 token ID，-1 表示非终止节点 */
+    uint8_t byte;          /* 进入该节点的字节 */
+} SpecialTrieNode;
+
+/**
+ * @brief 单个合并规则信息，三个字段压缩在一个 64 位字中：
+ *        right_id (高 21 位) | new_id (中间 21 位) | priority (低 22 位)
+ * @note right_id 位于最高位，行内二分查找只需比较 item >> RULE_RIGHT_SHIFT；
+ *       priority 通常为合并顺序索引，越小优先级越高
+ */
+typedef uint64_t MergeRuleItem;
+
+#define RULE_ID_BITS 21        /* right_id 与 new_id 的位宽 */
+#define RULE_PRIORITY_BITS 22  /* priority 的位宽 */
+#define RULE_RIGHT_SHIFT (RULE_ID_BITS + RULE_PRIORITY_BITS)
+#define RULE_ID_LIMIT (1u << RULE_ID_BITS)             /* 规则中可出现的 ID 上限 (不含) */
+#define RULE_PRIORITY_LIMIT (1u << RULE_PRIORITY_BITS) /* 规则优先级上限 (不含) */
+
+/**
+ * @brief 打包一条规则项 (调用者保证各字段在范围内)
+ */
+static inline MergeRuleItem rule_item_pack(uint32_t right_id, uint32_t new_id, uint32_t priority)
+{
+    return ((uint64_t)right_id << RULE_RIGHT_SHIFT) | ((uint64_t)new_id << RULE_PRIORITY_BITS) | priority;
+}
+
+static inline int32_t rule_item_right(MergeRuleItem item)
+{
+    return (int32_t)(item >> RULE_RIGHT_SHIFT);
+}
+
+static inline int32_t rule_item_new_id(MergeRuleItem item)
+{
+    return (int32_t)((item >> RULE_PRIORITY_BITS) & (RULE_ID_LIMIT - 1));
+}
+
+static inline int32_t rule_item_priority(MergeRuleItem item)
+{
+    return (int32_t)(item & (RULE_PRIORITY_LIMIT - 1));
+}
+
+/**
+ * @brief 解析阶段的一条合并规则 (构建规则行之前的临时形式)
+ */
+typedef struct
+{
+    int32_t left_id;
+    int32_t right_id;
+    int32_t new_id;
+    int32_t priority;
+} MergeRecord;
+
+/**
+ * @brief 合并规则哈希表槽位：以 (left << 32 | right) 为键的开放寻址表
+ */
+typedef struct
+{
+    uint64_t key;     /* 打包的 (left, right)，MERGE_PAIR_EMPTY 表示空槽 */
+    int32_t new_id;   /* 合并后产生的新 token ID */
+    int32_t priority; /* 优先级 */
+} MergePairSlot;
+
+/**
+ * @brief 词级缓存项：文本块字节 → 编码后的 ID 序列
+ * @note key 与 ids 位于同一块内存 (结构体之后)，释放结构体即释放全部
+ */
+typedef struct
+{
+    const char *key;   /* 文本块字节 (不以 '\0' 结尾)，指向本结构之后的内存 */
+    size_t key_len;    /* 文本块字节数 */
+    int32_t *ids;      /* 编码结果，指向本结构之后的内存 */
+    uint32_t count;    /* ID 数量 */
+    UT_hash_handle hh; /* uthash 句柄 */
+} WordCacheEntry;
+
+#ifdef BBPE_NUMA
+/**
+ * @brief 单个 NUMA 节点上的热表副本 (bbpe_set_numa_replication)
+ * @note 由首个绑定到该节点的工作线程分配并写入，按首次访问策略落在该节点的内存上；
+ *       规则与单字节表只读，词级缓存是本节点独立的一份 (容量与策略同分词器)
+ */
+typedef struct
+{
+    uint32_t *rule_start;       /* 规则行起点副本 (vocab_size + 1 项)，分词器没有规则行时为 NULL */
+    MergeRuleItem *rule_items;  /* 规则项副本 */
+    MergePairSlot *merge_pairs; /* 合并规则哈希表副本，分词器使用规则行时为 NULL */
+    int32_t byte_to_id[256];    /* 单字节 → token ID 副本 */
+    WordCacheEntry *word_cache; /* 本节点的词级缓存 */
+    bbpe_mutex_t cache_lock;    /* 保护 word_cache */
+} TableReplica;
+
+/**
+ * @brief NUMA 副本的节点信息与各节点副本
+ */
+typedef struct
+{
+    int node_count;          /* 含 CPU 的节点数 (至少 2) */
+    cpu_set_t *cpus;         /* 各节点的 CPU 集合 */
+    TableReplica **replicas; /* 各节点的副本，尚未建立时为 NULL */
+    int next_node;           /* 下一个工作线程绑定的节点 (轮转，受 lock 保护) */
+    bbpe_mutex_t lock;       /* 保护 replicas 与 next_node */
+} NumaState;
+#endif
+
+// ============================================================================
+// 预分词器配置 (链表节点)
+// ============================================================================
+
+/**
+ * @brief 预分词器类型
+ */
+typedef enum
+{
+    PRE_TOKENIZER_NONE,       /* 无操作 */
+    PRE_TOKENIZER_BYTE_LEVEL, /* ByteLevel 预分词器 (添加前缀空格) */
+    PRE_TOKENIZER_REGEX_SPLIT /* 正则分割预分词器 */
+} PreTokenizerType;
+
+/**
+ * @brief 预分词器链表节点
+ */
+typedef struct PreTokenizerNode
+{
+    PreTokenizerType type; /* 类型 */
+    union
+    {
+        struct
+        {
+            int add_prefix_space; /* 是否在文本前添加空格 (ByteLevel) */
+        } byte_level;
+        struct
+        {
+            char *regex_pattern;        /* 正则表达式字符串，由节点负责释放 */
+            pcre2_code *regex_compiled; /* 编译后的 pcre2 正则代码 */
+            int jit;                    /* 1 表示已 JIT 编译成功，匹配时走 pcre2_jit_match */
+            int fast_digits;            /* 非 0 表示使用内置快速分割器，值为 \p{N} 的最大连续匹配数 */
+        } split;
+    } config;                      /* 类型相关的配置 */
+    struct PreTokenizerNode *next; /* 下一个预分词器节点 (构成链) */
+} PreTokenizerNode;
+
+// ============================================================================
+// 规范化器配置 (链表节点)
+// ============================================================================
+
+/**
+ * @brief 规范化器类型 (数值写入二进制镜像，只能在末尾追加)
+ */
+typedef enum
+{
+    NORMALIZER_NFC,       /* Unicode 规范组合 */
+    NORMALIZER_NFD,       /* Unicode 规范分解 */
+    NORMALIZER_NFKC,      /* Unicode 兼容组合 */
+    NORMALIZER_NFKD,      /* Unicode 兼容分解 */
+    NORMALIZER_LOWERCASE, /* 逐字符转为小写 */
+    NORMALIZER_REPLACE,   /* 将字符串 pattern 的每次出现替换为 content */
+    NORMALIZER_PREPEND    /* 在非空文本前添加 content */
+} NormalizerType;
+
+/**
+ * @brief 规范化器链表节点 (Sequence 展开为依次执行的多个节点)
+ */
+typedef struct NormalizerNode
+{
+    NormalizerType type;         /* 类型 */
+    char *pattern;               /* Replace 的查找串，由节点负责释放 (其他类型为 NULL) */
+    size_t pattern_len;          /* 查找串字节数 */
+    char *content;               /* Replace 的替换串或 Prepend 的前缀，由节点负责释放 */
+    size_t content_len;          /* content 字节数 */
+    struct NormalizerNode *next; /* 下一个规范化器节点 */
+} NormalizerNode;
+
+// ============================================================================
+// 异步编码 (线程池与请求队列)
+// ============================================================================
+
+/**
+ * @brief 一个异步编码请求：依次位于待处理队列、运行链表与 (BBPE_ASYNC_DEFERRED 时) 待分发队列之一
+ */
+typedef struct AsyncRequest
+{
+    struct AsyncRequest *next;  /* 所在链表的后继 */
+    uint64_t id;                /* 请求号 */
+    const char *text;           /* 输入文本 (不持有) */
+    size_t len;                 /* 输入文本字节数 */
+    BBPEAsyncCallback callback; /* 完成回调 */
+    void *user_data;            /* 原样传给回调 */
+    int cancel;                 /* 运行中被取消 (flag_load 读取)，编码在下一个块边界处中止 */
+    BBPEStatus status;          /* 完成状态 */
+    BBPEOutput output;          /* 编码结果，随回调交给调用者 */
+} AsyncRequest;
+
+/**
+ * @brief 分词器的异步编码线程池 (除 wake 外的全部状态受分词器的 async_lock 保护)
+ */
+typedef struct
+{
+    bbpe_cond_t wake;                 /* 有新请求或开始停止时唤醒工作线程 */
+    AsyncRequest *queue, *queue_tail; /* 待处理请求 (FIFO) */
+    AsyncRequest *running;            /* 正在编码的请求 */
+    AsyncRequest *done, *done_tail;   /* 待分发的结果 (BBPE_ASYNC_DEFERRED) */
+    uint64_t next_id;                 /* 下一个请求号 */
+    uint32_t flags;                   /* bbpe_async_start 的标志 */
+    int stopping;                     /* 非 0 表示工作线程应在队列清空后退出 */
+    int notify_fds[2];                /* 完成通知：[0] 读端、[1] 写端 (eventfd 时两者相同)，-1 表示没有 */
+    int thread_count;                 /* 已启动的工作线程数 */
+    bbpe_thread_t *threads;           /* 工作线程句柄 */
+    ThreadStart start;                /* 工作线程入口 (参数为分词器) */
+} AsyncPool;
+
+// ============================================================================
+// 分词器主结构
+// ============================================================================
+
+/**
+ * @brief BBPE 分词器主结构 (不透明指针的具体定义)
+ */
+struct BBPETokenizer
+{
+    BBPEAllocator allocator;                   /* 分词器持有的全部内存所用的分配器 (alloc 为 NULL 表示 malloc) */
+    pcre2_general_context *pcre2_memory;       /* 转发到 allocator 的 PCRE2 通用上下文，标准库分配时为 NULL */
+    VocabTable vocab;                          /* 词汇表 (token→id) */
+    int32_t byte_to_id[256];                   /* 单字节 → token ID，-1 表示词表中不存在 */
+    size_t merge_count;                        /* 合并规则总数 (仅用于统计) */
+    uint32_t *rule_start;                      /* 规则行起点 (vocab_size + 1 项)：left 的规则为 rule_items[rule_start[left], rule_start[left+1]) */
+    MergeRuleItem *rule_items;                 /* 全部规则项，按 left 分行，行内按 right_id 升序排列 */
+    int rule_items_in_image;                   /* 非 0 表示 rule_items 指向镜像，不单独释放 (v2 镜像的规则项转换到堆上，不指向镜像) */
+    MergePairSlot *merge_pairs;                /* 可选的合并规则哈希表 (BBPE_MERGE_INDEX_HASH)，NULL 表示使用规则行 */
+    uint64_t merge_pair_mask;                  /* 哈希表槽位数 - 1 */
+    uint32_t vocab_size;                       /* 词汇表大小 (最大 id + 1) */
+    VocabTable specials;                       /* 特殊 token 表 (token→id)，按加入顺序遍历，不参与合并规则的解析 */
+    SpecialTrieNode *special_trie;             /* 特殊 token 前缀树节点数组，用于最长匹配扫描 */
+    uint32_t special_trie_count;               /* 前缀树节点数 */
+    uint32_t special_trie_root[256];           /* 首字节 → 根的子节点下标 (0 表示没有以该字节开头的 token) */
+    uint64_t special_first_set[4];             /* 特殊 token 可能的首字节集合 (256 位)，扫描时据此跳过不可能的位置 */
+    uint32_t special_first_count;              /* 首字节集合的大小，0 表示没有特殊 token，整个提取过程直接跳过 */
+    uint8_t special_first_byte;                /* special_first_count 为 1 时唯一的首字节，用 memchr 跳到候选位置 */
+    uint32_t byte_to_unicode[256];             /* 字节 → Unicode 码点映射 (ByteLevel) */
+    uint8_t unicode_to_byte[UNICODE_MAP_SIZE]; /* Unicode 码点 → 字节映射 (用于解码) */
+    uint32_t *id_to_entry;                     /* id → 字符串条目：词汇表条目下标，或 ID_ENTRY_SPECIAL | 特殊 token 条目下标 */
+    int id_table_in_image;                     /* 非 0 表示 id_to_entry 指向镜像 (只读，不单独释放) */
+    uint32_t *decoded_start;                   /* id → decoded_pool 偏移 (vocab_size + 1 项)，长度为 0 的 id 解码时逐字符校验 */
+    uint8_t *decoded_pool;                     /* 各 token 解码后的原始字节，按 id 顺序连续存放 */
+    int decoded_in_image;                      /* 非 0 表示解码表指向镜像，不单独释放 */
+    uint32_t *stable_tokens;                   /* 可选的稳定 token 位图 (bbpe_set_whole_token_lookup)：第 id 位为 1 表示其字节串合并后恰为该 token */
+    int stable_in_image;                       /* 非 0 表示 stable_tokens 指向镜像，不单独释放 */
+    int32_t *prefix_ids;                       /* 可选的前缀索引 (bbpe_set_prefix_index)：解码字节非空的 ID 按解码字节的字典序排列 */
+    uint32_t prefix_count;                     /* prefix_ids 的元素数 */
+    NormalizerNode *normalizers;               /* 规范化器链表头，NULL 表示不规范化 */
+    PreTokenizerNode *pre_tokenizers;          /* 预分词器链表头 */
+    char byte_vocab_strs[256][5];              /* 预计算的字节对应字符串 (UTF-8，以 '\0' 结尾)，用于快速查找字节 token */
+    WordCacheEntry *word_cache;                /* 词级缓存哈希表，插入顺序即淘汰顺序 (表头最先淘汰) */
+    size_t cache_capacity;                     /* 缓存容量 (条目数)，0 表示禁用 */
+    BBPECachePolicy cache_policy;              /* 缓存淘汰策略 */
+    bbpe_mutex_t cache_lock;                   /* 保护词级缓存 (查找也会调整 LRU 顺序)，使共享分词器可并发编码 */
+    BBPELimits limits;                         /* 病态输入防护上限 (bbpe_set_limits)，全 0 表示不限制 */
+    uint32_t load_flags;                       /* 加载标志 (LOAD_KEPT_FLAGS 中的各位) */
+    int encoder_deferred;                      /* 非 0 表示合并规则或正则尚未构建 (flag_load 读取)，编码前须经 encoder_prepare */
+    bbpe_mutex_t encoder_lock;                 /* 保证延迟构建只执行一次 */
+    char *lazy_merges;                         /* 待解析的 model.merges 数组原文副本 (bbpe_init_ex)，NULL 表示没有 */
+    MergeRecord *lazy_records;                 /* 待构建规则行的合并规则记录 (v1 文件) */
+    size_t lazy_record_count;                  /* lazy_records 的记录数 */
+    const uint8_t *lazy_regex_codes;           /* 待解码的预编译正则 (指向镜像)，NULL 表示按模式编译 */
+    const uint8_t *image;                      /* 二进制镜像 (v2/v3)：非 NULL 时 vocab 与规则行直接指向其中，不单独释放 */
+    size_t image_size;                         /* 镜像字节数 */
+    ImageKind image_kind;                      /* 镜像来源 (决定释放方式) */
+    BBPETokenizer *base;                       /* 派生的分词器 (bbpe_derive) 与之共享表的基础分词器，NULL 表示表都由自己持有 */
+    int refs;                                  /* 引用数：句柄本身与尚未释放的派生分词器各计 1 (atomic_add)，降为 0 时释放 */
+#ifdef BBPE_ENABLE_STATS
+    BBPEStats stats;                           /* 累计编码统计 (受 stats_lock 保护) */
+    bbpe_mutex_t stats_lock;                   /* 保护 stats，各调用结束时计入一次 */
+#endif
+#ifdef BBPE_NUMA
+    NumaState *numa;                           /* NUMA 副本 (bbpe_set_numa_replication)，NULL 表示未启用或只有一个节点 */
+#endif
+    AsyncPool *async;                          /* 异步编码线程池 (bbpe_async_start)，NULL 表示未启动 */
+    bbpe_mutex_t async_lock;                   /* 保护 async 及其队列 */
+#ifdef BBPE_ENABLE_ITT
+    __itt_domain *itt_domain;                  /* ITT 任务所在的域 ("bbpe") */
+    __itt_string_handle *itt_special;          /* 各编码阶段的任务名 (TRACE_BEGIN) */
+    __itt_string_handle *itt_pre_tokenize;
+    __itt_string_handle *itt_merge;
+#endif
+};
+
+/**
+ * @brief 初始化分词器内部的互斥锁 (分配分词器后立即调用，之后即可用 bbpe_destroy 释放)
+ */
+static void tokenizer_init_locks(BBPETokenizer *tok)
+{
+    mutex_init(&tok->cache_lock);
+    mutex_init(&tok->encoder_lock);
+    mutex_init(&tok->async_lock);
+#ifdef BBPE_ENABLE_STATS
+    mutex_init(&tok->stats_lock);
+#endif
+}
+
+/**
+ * @brief 经分配器分配一个清零的分词器并初始化其锁 (之后即可用 bbpe_destroy 释放)
+ * @param a 分配器，NULL 表示 malloc/free
+ * @return 新分词器，内存不足时返回 NULL
+ */
+static BBPETokenizer *tokenizer_alloc(const BBPEAllocator *a)
+{
+    BBPETokenizer *tok = (BBPETokenizer *)mem_calloc(a, 1, sizeof(BBPETokenizer));
+    if (!tok)
+        return NULL;
+    if (a)
+        tok->allocator = *a;
+    tok->vocab.alloc = &tok->allocator;
+    tok->specials.alloc = &tok->allocator;
+    tok->refs = 1;
+    if (pcre2_memory_create(&tok->allocator, &tok->pcre2_memory) != BBPE_OK)
+    {
+        mem_free(a, tok);
+        return NULL;
+    }
+    tokenizer_init_locks(tok);
+#ifdef BBPE_ENABLE_ITT
+    tok->itt_domain = __itt_domain_create("bbpe");
+    tok->itt_special = __itt_string_handle_create("bbpe_special");
+    tok->itt_pre_tokenize = __itt_string_handle_create("bbpe_pre_tokenize");
+    tok->itt_merge = __itt_string_handle_create("bbpe_merge");
+#endif
+    return tok;
+}
+
+static void tokenizer_destroy_locks(BBPETokenizer *tok)
+{
+    mutex_destroy(&tok->cache_lock);
+    mutex_destroy(&tok->encoder_lock);
+    mutex_destroy(&tok->async_lock);
+#ifdef BBPE_ENABLE_STATS
+    mutex_destroy(&tok->stats_lock);
+#endif
+}
+
+// ============================================================================
+// 预分词中间结果
+// ============================================================================
+
+/**
+ * @brief 预分词产生的单个文本块：原始文本中的一个区间 (不复制文本)
+ */
+typedef struct
+{
+    size_t offset;        /* 块在原始文本中的起始字节偏移 */
+    size_t len;           /* 块在原始文本中的字节数 */
+    size_t prefix_spaces; /* 块前需补充的空格数 (ByteLevel add_prefix_space 产生，不在原文中) */
+} ChunkSpan;
+
+/**
+ * @brief 预分词产生的多个文本块
+ */
+typedef struct
+{
+    ChunkSpan *spans; /* 文本块区间数组，由本结构负责释放 */
+    size_t count;     /* 块数量 */
+    size_t capacity;  /* 数组容量 */
+} PreTokenizedResult;
+
+/**
+ * @brief 编码输出目标：可增长的库内缓冲区或调用者提供的固定缓冲区
+ * @note ids 为 NULL、capacity 为 0 的固定缓冲区即只计数的输出目标 (bbpe_count_tokens)
+ */
+typedef struct
+{
+    int32_t *ids;    /* 输出缓冲区 */
+    size_t count;    /* 已产生的 ID 总数 (固定缓冲区溢出后仍继续计数) */
+    size_t capacity; /* 缓冲区容量 (元素个数) */
+    int growable;    /* 1 表示容量不足时 realloc 扩展，0 表示调用者缓冲区，超出部分只计数不写入 */
+} IdSink;
+
+/**
+ * @brief 分段结构：普通文本段或特殊 token 段
+ */
+typedef struct
+{
+    int is_special; /* 1 表示特殊 token 段，0 表示普通文本段 */
+    size_t offset;  /* 段在输入文本中的起始字节偏移 */
+    size_t len;     /* 段字节数 */
+    int special_id; /* 当 is_special==1 时有效，为特殊 token 的 ID */
+} TokenSegment;
+
+// ============================================================================
+// 优先队列（最小堆）相关结构（修正：比较时加入节点位置作为第二关键字）
+// ============================================================================
+
+/**
+ * @brief BPE 合并链表 (结构数组)：节点以原始位置为下标，每个字段单独一个 int32 数组
+ * @note 合并时左节点复用、右节点移出，因此下标始终等于节点在原始序列中的位置，链表头固定为 0；
+ *       cand_priority[i] 记录以 i 为左节点的相邻对当前可用的合并，INT32_MAX 表示没有
+ */
+typedef struct
+{
+    int32_t *ids;           /* token ID */
+    int32_t *prev;          /* 前驱下标，-1 表示链表头 */
+    int32_t *next;          /* 后继下标，-1 表示链表尾 */
+    int32_t *cand_priority; /* 与后继组成的相邻对的合并优先级 */
+    int32_t *cand_new_id;   /* 与后继组成的相邻对合并后的 token ID */
+} MergeList;
+
+/** 合并链表的字段数，工作区节点缓冲区按块长度的这一倍数分配 */
+#define MERGE_LIST_FIELDS 5
+
+/**
+ * @brief 堆元素，表示一个相邻对候选：只记录优先级与左节点位置，弹出时与 cand_priority 对照验证
+ */
+typedef struct
+{
+    int32_t priority; /* 优先级（数值越小越优先） */
+    int32_t pos;      /* 左节点在原始序列中的位置，用于确定最左边合并 */
+} HeapItem;
+
+/**
+ * @brief 最小堆结构
+ */
+typedef struct
+{
+    HeapItem *items; /* 堆数组 */
+    int size;        /* 当前元素个数 */
+    int capacity;    /* 容量 */
+} MinHeap;
+
+#define RADIX_BUCKETS 65    /* 基数堆的桶数：桶 0 存放等于上次弹出键的元素，桶 b 存放与之最高不同位为 b-1 的元素 */
+#define RADIX_DETACHED (-2) /* RadixQueue.prev 中表示节点当前没有候选在队列中 */
+
+/**
+ * @brief 基数堆：长文本块的合并候选队列，键为 (优先级 << 32 | 左节点位置)，按与上次弹出键的最高不同位分桶
+ * @note 每个左节点至多一个候选，元素下标即节点下标；候选改变或失效时立即从桶中摘下，队列中没有过期元素。
+ *       只要弹出的键单调不减 (合并得到的 token 只出现在排在其后的规则中)，合并顺序与最小堆完全相同；
+ *       出现小于上次弹出键的候选时置 violated，由调用者改用最小堆继续
+ */
+typedef struct
+{
+    uint64_t *keys;               /* keys[i]：以 i 为左节点的候选键 */
+    int32_t *next;                /* 桶内后继，-1 表示末尾 */
+    int32_t *prev;                /* 桶内前驱，-1 表示桶首，RADIX_DETACHED 表示不在队列中 */
+    int32_t heads[RADIX_BUCKETS]; /* 各桶的首元素，-1 表示空桶 */
+    uint64_t occupied;            /* 第 b-1 位表示桶 b (b >= 1) 非空 */
+    uint64_t last;                /* 上次弹出的键 */
+    int violated;                 /* 出现过小于 last 的候选 (其候选记录已写入合并链表，但未入队) */
+} RadixQueue;
+
+// ============================================================================
+// 编码工作区
+// ============================================================================
+
+/**
+ * @brief 规范化结果缓冲区 (规范化链的各步骤在两个缓冲区之间交替写入)
+ */
+typedef struct
+{
+    char *text;            /* 规范化后的文本 */
+    size_t len;            /* 文本字节数 */
+    size_t capacity;       /* text 的容量 (字节) */
+    size_t *align;         /* 需要字节区间时记录：align[i] 为结果位置 i 对应的输入位置 (len + 1 项) */
+    size_t align_capacity; /* align 的容量 (元素个数) */
+} NormBuffer;
+
+/**
+ * @brief 编码工作区 (不透明指针的具体定义)
+ * @note 各缓冲区只增不减，每次编码调用开始时仅重置计数，容量留给后续调用复用
+ */
+struct BBPEWorkspace
+{
+    BBPEAllocator allocator;       /* 各缓冲区与 PCRE2 对象所用的分配器 (alloc 为 NULL 表示 malloc) */
+    pcre2_general_context *pcre2_memory; /* 创建 PCRE2 对象所用的通用上下文 (转发到 allocator)，首次需要时创建 */
+    int32_t *nodes;                /* BPE 合并链表 (MergeList) 各字段数组的共用缓冲区 */
+    size_t node_capacity;          /* 节点缓冲区容量 (int32 个数) */
+    MinHeap heap;                  /* 合并候选堆 (items 由工作区持有) */
+    uint64_t *radix;               /* 基数堆缓冲区：每个节点一个键 (uint64) 与 next/prev 两个 int32 */
+    size_t radix_capacity;         /* 基数堆缓冲区容量 (uint64 个数) */
+    TokenSegment *segments;        /* 特殊 token 分段缓冲区 */
+    size_t segment_capacity;       /* 分段缓冲区容量 (元素个数) */
+    PreTokenizedResult spans[2];   /* 预分词链的两个交替缓冲区 */
+    char *joined;                  /* 带前缀空格的块拼接缓冲区 (正则匹配用) */
+    size_t joined_capacity;        /* 拼接缓冲区容量 (字节) */
+    NormBuffer norm[2];            /* 规范化链的两个交替缓冲区 */
+    uint32_t *norm_cps;            /* 规范化时单个组合序列的码点缓冲区 */
+    size_t norm_cp_capacity;       /* 码点缓冲区容量 (元素个数) */
+    size_t *norm_srcs;             /* 与 norm_cps 逐项对应：各码点来源字符在输入中的起点 (用于对齐表) */
+    size_t norm_src_capacity;      /* 来源缓冲区容量 (元素个数) */
+    size_t *chunk_ends;            /* track_ends 非 0 时由 encode_chunk 填写：本块各 token 在块内 (含前缀空格) 的终点 */
+    size_t chunk_end_capacity;     /* 终点缓冲区容量 (元素个数) */
+    int track_ends;                /* 非 0 表示调用方需要字节区间：记录 chunk_ends，此时不使用词级缓存 */
+    pcre2_match_data *match_data;  /* 正则匹配数据，ovector 不足时重建 (解释器的回溯帧也保留在其中) */
+    pcre2_match_context *match_context; /* 匹配上下文，设置了 PCRE2 上限或需要 JIT 栈时才创建 */
+    pcre2_jit_stack *jit_stack;    /* JIT 栈，首次因默认栈不足而失败时创建 */
+    uint32_t match_limit;          /* match_context 当前的 match_limit (BBPELimits 语义，0 表示默认值) */
+    uint32_t depth_limit;          /* match_context 当前的 depth_limit (同上) */
+    const int *cancel;             /* 非 NULL 时编码在块边界处检查，置位后以 BBPE_ERR_CANCELLED 中止 (异步编码) */
+#ifdef BBPE_ENABLE_STATS
+    BBPEStats stats;               /* 本次调用尚未计入分词器的统计 */
+#endif
+#ifdef BBPE_NUMA
+    TableReplica *replica;         /* 当前线程所在节点的副本 (不持有)，NULL 表示直接使用分词器的表 */
+#endif
+};
+
+// ============================================================================
+// 流式解码器
+// ============================================================================
+
+/**
+ * @brief 流式解码器 (不透明指针的具体定义)
+ * @note buf 只增不减；tail 保存上一次调用末尾尚未补全的 UTF-8 序列，下次调用时拼到新字节之前
+ */
+struct BBPEDecoder
+{
+    BBPETokenizer *tokenizer; /* 所属分词器 (不持有) */
+    BBPEAllocator allocator;  /* 分词器分配器的副本 (结构本身与 buf 经其分配) */
+    char *buf;                /* 输出缓冲区，返回给调用者的文本位于此处 */
+    size_t capacity;          /* 输出缓冲区容量 (字节) */
+    char tail[4];             /* 暂存的不完整 UTF-8 序列 (最多 3 字节) */
+    size_t tail_len;          /* tail 中的字节数 */
+};
+
+// ============================================================================
+// 流式编码器
+// ============================================================================
+
+/**
+ * @brief 流式编码器 (不透明指针的具体定义)
+ * @note buf 只保存尚未编码的输入：末尾可能继续延伸的预分词块与可能构成特殊 token 的前缀
+ */
+struct BBPEStreamEncoder
+{
+    BBPETokenizer *tokenizer; /* 所属分词器 (不持有) */
+    BBPEWorkspace ws;         /* 编码工作区 (使用分词器的分配器，结构本身也经其分配) */
+    char *buf;                /* 已输入但尚未编码的文本 */
+    size_t len;               /* buf 中的字节数 */
+    size_t capacity;          /* buf 的容量 (字节) */
+    int32_t *ids;             /* 输出缓冲区，返回给调用者的 ID 位于此处 (经 IdSink 以 malloc 增长) */
+    size_t id_capacity;       /* 输出缓冲区容量 (ID 个数) */
+    size_t special_hold;      /* 最长特殊 token 的字节数减 1：末尾这么多字节内开始的特殊 token 可能尚未完整 */
+    size_t retry_len;         /* 上次未找到切分点时，缓冲区增长到该长度之前不再查找 (0 表示每次都查找) */
+};
+
+// ============================================================================
+// 词汇表 (开放寻址哈希表)
+// ============================================================================
+
+/**
+ * @brief 以 h 为初值继续计算 FNV-1a 哈希 (用于分段拼接的字符串)
+ */
+static uint32_t vocab_hash_update(uint32_t h, const char *str, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        h ^= (uint8_t)str[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/**
+ * @brief token 字符串哈希 (FNV-1a)
+ */
+static uint32_t vocab_hash(const char *str, size_t len)
+{
+    return vocab_hash_update(2166136261u, str, len);
+}
+
+/** 完美哈希槽中的空位 */
+#define PHF_EMPTY UINT32_MAX
+/** 完美哈希段开头的 u32 字段数：桶数、槽数、种子、保留字 */
+#define PHF_HEADER_WORDS 4
+
+/**
+ * @brief 以 h 为初值继续计算 64 位 FNV-1a 哈希 (完美哈希的键，可分段计算)
+ */
+static uint64_t vocab_hash64_update(uint64_t h, const char *str, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        h ^= (uint8_t)str[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+static uint64_t vocab_hash64(const char *str, size_t len)
+{
+    return vocab_hash64_update(14695981039346656037ull, str, len);
+}
+
+/**
+ * @brief 64 位混合函数 (MurmurHash3 的 fmix64)
+ */
+static uint64_t phf_mix(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+/**
+ * @brief 将 32 位值均匀映射到 [0, n) (乘法取高位，不用取模)
+ */
+static uint32_t phf_reduce(uint32_t x, uint32_t n)
+{
+    return (uint32_t)(((uint64_t)x * n) >> 32);
+}
+
+/**
+ * @brief 键在给定位移值下落入的槽
+ * @param key phf_mix(hash64 ^ seed)
+ */
+static uint32_t phf_place(uint64_t key, uint32_t pilot, uint32_t slot_count)
+{
+    return phf_reduce((uint32_t)phf_mix(key ^ (pilot * 0x9E3779B97F4A7C15ull)), slot_count);
+}
+
+/**
+ * @brief 由完美哈希查找 hash64 对应的条目，再核对拼接串 a + b
+ * @return 条目下标，未找到返回 -1
+ */
+static int64_t vocab_table_phf_find(const VocabTable *vt, uint64_t hash64, const char *a, size_t a_len,
+                                    const char *b, size_t b_len)
+{
+    uint64_t key = phf_mix(hash64 ^ vt->phf_seed);
+    uint32_t bucket = phf_reduce((uint32_t)(key >> 32), vt->phf_buckets);
+    uint32_t pilot = (vt->phf_pilots[bucket >> 1] >> ((bucket & 1) * 16)) & 0xFFFF;
+    uint32_t e = vt->phf_slots[phf_place(key, pilot, vt->phf_slot_count)];
+    if (e == PHF_EMPTY || vt->lengths[e] != a_len + b_len)
+        return -1;
+    const char *str = vt->pool + vt->offsets[e];
+    if (memcmp(str, a, a_len) != 0 || (b_len && memcmp(str + a_len, b, b_len) != 0))
+        return -1;
+    return e;
+}
+
+/**
+ * @brief 释放词汇表的全部内存
+ */
+static void vocab_table_free(VocabTable *vt)
+{
+    const BBPEAllocator *a = vt->alloc;
+    mem_free(a, vt->pool);
+    mem_free(a, vt->offsets);
+    mem_free(a, vt->lengths);
+    mem_free(a, vt->hashes);
+    mem_free(a, vt->ids);
+    mem_free(a, vt->slots);
+    memset(vt, 0, sizeof(*vt));
+    vt->alloc = a;
+}
+
+/**
+ * @brief 词汇表已分配的字节数 (按容量计)
+ */
+static size_t vocab_table_bytes(const VocabTable *vt)
+{
+    size_t bytes = vt->pool_capacity + (size_t)vt->capacity * (3 * sizeof(uint32_t) + sizeof(int32_t));
+    if (vt->slots)
+        bytes += ((size_t)vt->slot_mask + 1) * sizeof(uint32_t);
+    return bytes;
+}
+
+/**
+ * @brief 按条目数重建哈希槽 (负载因子不超过 1/2)
+ * @param vt 词汇表
+ * @param min_entries 需要容纳的条目数
+ * @return BBPEStatus
+ */
+static BBPEStatus vocab_table_rehash(VocabTable *vt, uint32_t min_entries)
+{
+    size_t slot_count = 16;
+    while (slot_count < (size_t)min_entries * 2)
+        slot_count *= 2;
+    if (slot_count - 1 > UINT32_MAX)
+        return BBPE_ERR_MEMORY;
+    uint32_t *slots = (uint32_t *)mem_calloc(vt->alloc, slot_count, sizeof(uint32_t));
+    if (!slots)
+        return BBPE_ERR_MEMORY;
+    uint32_t mask = (uint32_t)(slot_count - 1);
+    for (uint32_t i = 0; i < vt->count; i++)
+    {
+        uint32_t idx = vt->hashes[i] & mask;
+        while (slots[idx])
+            idx = (idx + 1) & mask;
+        slots[idx] = i + 1;
+    }
+    mem_free(vt->alloc, vt->slots);
+    vt->slots = slots;
+    vt->slot_mask = mask;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 预留至少 entries 个条目与 pool_bytes 字节的字符串池
+ * @return BBPEStatus
+ */
+static BBPEStatus vocab_table_reserve(VocabTable *vt, uint32_t entries, size_t pool_bytes)
+{
+    if (entries > vt->capacity)
+    {
+        uint32_t *offsets = (uint32_t *)mem_realloc(vt->alloc, vt->offsets, entries * sizeof(uint32_t));
+        if (!offsets)
+            return BBPE_ERR_MEMORY;
+        vt->offsets = offsets;
+        uint32_t *lengths = (uint32_t *)mem_realloc(vt->alloc, vt->lengths, entries * sizeof(uint32_t));
+        if (!lengths)
+            return BBPE_ERR_MEMORY;
+        vt->lengths = lengths;
+        uint32_t *hashes = (uint32_t *)mem_realloc(vt->alloc, vt->hashes, entries * sizeof(uint32_t));
+        if (!hashes)
+            return BBPE_ERR_MEMORY;
+        vt->hashes = hashes;
+        int32_t *ids = (int32_t *)mem_realloc(vt->alloc, vt->ids, entries * sizeof(int32_t));
+        if (!ids)
+            return BBPE_ERR_MEMORY;
+        vt->ids = ids;
+        vt->capacity = entries;
+    }
+    if (!vt->slots || (size_t)entries * 2 > (size_t)vt->slot_mask + 1)
+    {
+        BBPEStatus status = vocab_table_rehash(vt, entries);
+        if (status != BBPE_OK)
+            return status;
+    }
+    if (pool_bytes > vt->pool_capacity)
+    {
+        char *pool = (char *)mem_realloc(vt->alloc, vt->pool, pool_bytes);
+        if (!pool)
+            return BBPE_ERR_MEMORY;
+        vt->pool = pool;
+        vt->pool_capacity = pool_bytes;
+    }
+    return BBPE_OK;
+}
+
+/**
+ * @brief 将条目数组与字符串池收缩到实际用量 (词汇表不再增长后调用)
+ * @note realloc 失败时保留原缓冲区；此后不得再向该表追加条目
+ */
+static void vocab_table_shrink(VocabTable *vt)
+{
+    if (vt->count < vt->capacity && vt->count > 0)
+    {
+        // 容量先记为条目数：某个数组收缩失败时仍比记录的容量大，可以安全使用
+        vt->capacity = vt->count;
+        void *tmp;
+        if ((tmp = mem_realloc(vt->alloc, vt->offsets, vt->count * sizeof(uint32_t))) != NULL)
+            vt->offsets = (uint32_t *)tmp;
+        if ((tmp = mem_realloc(vt->alloc, vt->lengths, vt->count * sizeof(uint32_t))) != NULL)
+            vt->lengths = (uint32_t *)tmp;
+        if ((tmp = mem_realloc(vt->alloc, vt->hashes, vt->count * sizeof(uint32_t))) != NULL)
+            vt->hashes = (uint32_t *)tmp;
+        if ((tmp = mem_realloc(vt->alloc, vt->ids, vt->count * sizeof(int32_t))) != NULL)
+            vt->ids = (int32_t *)tmp;
+    }
+    if (vt->pool_size < vt->pool_capacity && vt->pool_size > 0)
+    {
+        char *pool = (char *)mem_realloc(vt->alloc, vt->pool, vt->pool_size);
+        if (pool)
+        {
+            vt->pool = pool;
+            vt->pool_capacity = vt->pool_size;
+        }
+    }
+}
+
+/**
+ * @brief 查找 token 对应的条目下标
+ * @return 条目下标，未找到返回 -1
+ */
+static int64_t vocab_table_find_entry(const VocabTable *vt, const char *token, size_t len, uint32_t hash)
+{
+    if (!vt->slots)
+        return -1;
+    uint32_t idx = hash & vt->slot_mask;
+    uint32_t slot;
+    while ((slot = vt->slots[idx]) != 0)
+    {
+        uint32_t e = slot - 1;
+        if (vt->hashes[e] == hash && vt->lengths[e] == len && memcmp(vt->pool + vt->offsets[e], token, len) == 0)
+            return e;
+        idx = (idx + 1) & vt->slot_mask;
+    }
+    return -1;
+}
+
+/**
+ * @brief 查找 token 对应的 ID
+ * @param vt 词汇表
+ * @param token token 字符串 (无需以 '\0' 结尾)
+ * @param len token 字节数
+ * @return token ID，未找到返回 -1
+ */
+static int32_t vocab_table_find(const VocabTable *vt, const char *token, size_t len)
+{
+    if (vt->phf_slots)
+    {
+        int64_t e = vocab_table_phf_find(vt, vocab_hash64(token, len), token, len, NULL, 0);
+        return e < 0 ? -1 : vt->ids[e];
+    }
+    int64_t e = vocab_table_find_entry(vt, token, len, vocab_hash(token, len));
+    return e < 0 ? -1 : vt->ids[e];
+}
+
+/**
+ * @brief 查找两段字符串拼接 (a + b) 对应的 ID，无需先拼接到临时缓冲区
+ * @return token ID，未找到返回 -1
+ */
+static int32_t vocab_table_find_concat(const VocabTable *vt, const char *a, size_t a_len, const char *b, size_t b_len)
+{
+    if (vt->phf_slots)
+    {
+        int64_t e = vocab_table_phf_find(vt, vocab_hash64_update(vocab_hash64(a, a_len), b, b_len), a, a_len, b, b_len);
+        return e < 0 ? -1 : vt->ids[e];
+    }
+    if (!vt->slots)
+        return -1;
+    uint32_t hash = vocab_hash_update(vocab_hash(a, a_len), b, b_len);
+    uint32_t idx = hash & vt->slot_mask;
+    uint32_t slot;
+    while ((slot = vt->slots[idx]) != 0)
+    {
+        uint32_t e = slot - 1;
+        const char *str = vt->pool + vt->offsets[e];
+        if (vt->hashes[e] == hash && vt->lengths[e] == a_len + b_len &&
+            memcmp(str, a, a_len) == 0 && memcmp(str + a_len, b, b_len) == 0)
+            return vt->ids[e];
+        idx = (idx + 1) & vt->slot_mask;
+    }
+    return -1;
+}
+
+/**
+ * @brief 向词汇表追加一个 token (字符串复制进池中)
+ * @note 重复的 token 以后加入者为准参与查找，但两个条目都保留 (与原 uthash 行为一致)
+ * @return BBPEStatus
+ */
+static BBPEStatus vocab_table_add(VocabTable *vt, const char *token, size_t len, int32_t id)
+{
+    if (len > UINT32_MAX - 1 || vt->count == UINT32_MAX || vt->pool_size + len + 1 > UINT32_MAX)
+        return BBPE_ERR_MEMORY;
+    uint32_t entries = vt->capacity;
+    if (vt->count >= entries)
+        entries = entries ? (entries > UINT32_MAX / 2 ? UINT32_MAX : entries * 2) : 1024;
+    size_t pool_bytes = vt->pool_capacity;
+    while (vt->pool_size + len + 1 > pool_bytes)
+        pool_bytes = pool_bytes ? pool_bytes * 2 : 16384;
+    BBPEStatus status = vocab_table_reserve(vt, entries, pool_bytes);
+    if (status != BBPE_OK)
+        return status;
+
+    uint32_t e = vt->count++;
+    uint32_t hash = vocab_hash(token, len);
+    memcpy(vt->pool + vt->pool_size, token, len);
+    vt->pool[vt->pool_size + len] = '\0';
+    vt->offsets[e] = (uint32_t)vt->pool_size;
+    vt->lengths[e] = (uint32_t)len;
+    vt->hashes[e] = hash;
+    vt->ids[e] = id;
+    vt->pool_size += len + 1;
+
+    // 已存在相同 token 时让槽位指向新条目，否则占用第一个空槽
+    uint32_t idx = hash & vt->slot_mask;
+    uint32_t slot;
+    while ((slot = vt->slots[idx]) != 0)
+    {
+        uint32_t old = slot - 1;
+        if (vt->hashes[old] == hash && vt->lengths[old] == len &&
+            memcmp(vt->pool + vt->offsets[old], token, len) == 0)
+            break;
+        idx = (idx + 1) & vt->slot_mask;
+    }
+    vt->slots[idx] = e + 1;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 分配 n 项的 id_to_entry 表，全部初始化为 ID_ENTRY_NONE
+ * @return BBPEStatus
+ */
+static BBPEStatus id_table_alloc(BBPETokenizer *tok, uint32_t n)
+{
+    mem_free(&tok->allocator, tok->id_to_entry);
+    tok->id_to_entry = (uint32_t *)mem_alloc(&tok->allocator, (size_t)n * sizeof(uint32_t));
+    if (!tok->id_to_entry)
+        return BBPE_ERR_MEMORY;
+    memset(tok->id_to_entry, 0xFF, (size_t)n * sizeof(uint32_t));
+    return BBPE_OK;
+}
+
+/**
+ * @brief 由词汇表填充 id_to_entry 与 byte_to_id
+ * @param tok 分词器句柄 (id_to_entry 已按 vocab_size 分配，或已指向镜像中现成的表)
+ */
+static void vocab_table_finish(BBPETokenizer *tok)
+{
+    const VocabTable *vt = &tok->vocab;
+    for (uint32_t e = 0; e < vt->count && !tok->id_table_in_image; e++)
+    {
+        int32_t id = vt->ids[e];
+        if (id >= 0 && (uint32_t)id < tok->vocab_size)
+            tok->id_to_entry[id] = e;
+    }
+
+    // 单字节 token：优先查 ByteLevel 映射后的字符串，回退到原始字节
+    for (int b = 0; b < 256; b++)
+    {
+        const char *str = tok->byte_vocab_strs[b];
+        int32_t id = vocab_table_find(vt, str, strlen(str));
+        if (id < 0)
+        {
+            char raw_byte = (char)b;
+            id = vocab_table_find(vt, &raw_byte, 1);
+        }
+        tok->byte_to_id[b] = id;
+    }
+}
+
+/**
+ * @brief 向特殊 token 表追加一个 token，并在 id_to_entry 中登记
+ * @param tok 分词器句柄 (id_to_entry 已分配且覆盖 id)
+ * @param token token 字符串 (无需以 '\0' 结尾)
+ * @param len token 字节数
+ * @param id token ID (调用者保证该 ID 尚无 token 字符串)
+ * @return BBPEStatus
+ */
+static BBPEStatus special_table_add(BBPETokenizer *tok, const char *token, size_t len, int32_t id)
+{
+    BBPEStatus status = vocab_table_add(&tok->specials, token, len, id);
+    if (status == BBPE_OK)
+        tok->id_to_entry[id] = ID_ENTRY_SPECIAL | (tok->specials.count - 1);
+    return status;
+}
+
+/**
+ * @brief 取 ID 对应的 token 字符串 (位于词汇表或特殊 token 表的字符串池中，以 '\0' 结尾)
+ * @return 字符串指针，ID 越界或没有 token 字符串时返回 NULL
+ */
+static const char *token_string(const BBPETokenizer *tok, int32_t id)
+{
+    if (id < 0 || (uint32_t)id >= tok->vocab_size || tok->id_to_entry[id] == ID_ENTRY_NONE)
+        return NULL;
+    uint32_t e = tok->id_to_entry[id];
+    const VocabTable *vt = &tok->vocab;
+    if (e & ID_ENTRY_SPECIAL)
+    {
+        vt = &tok->specials;
+        e &= ~ID_ENTRY_SPECIAL;
+    }
+    return vt->pool + vt->offsets[e];
+}
+
+// ============================================================================
+// UTF-8 编解码工具函数
+// ============================================================================
+
+/**
+ * @brief 从字符串 s 解码一个 UTF-8 字符
+ * @param s 输入字符串指针 (至少包含一个完整字符)
+ * @param cp 输出 Unicode 码点
+ * @return 使用的字节数 (1-4)，若编码错误返回 -1
+ */
+static int utf8_decode(const char *s, uint32_t *cp)
+{
+    unsigned char c = (unsigned char)*s;
+    if (c < 0x80)
+    {
+        *cp = c;
+        return 1;
+    }
+    else if ((c & 0xE0) == 0xC0)
+    {
+        if ((s[1] & 0xC0) != 0x80)
+            return -1;
+        *cp = ((c & 0x1F) << 6) | (s[1] & 0x3F);
+        return 2;
+    }
+    else if ((c & 0xF0) == 0xE0)
+    {
+        if ((s[1] & 0xC0) != 0x80 || (s[2] & 0xC0) != 0x80)
+            return -1;
+        *cp = ((c & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        return 3;
+    }
+    else if ((c & 0xF8) == 0xF0)
+    {
+        if ((s[1] & 0xC0) != 0x80 || (s[2] & 0xC0) != 0x80 || (s[3] & 0xC0) != 0x80)
+            return -1;
+        *cp = ((c & 0x07) << 18) | ((s[1] & 0x3F) << 12) | ((s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+        return 4;
+    }
+    return -1;
+}
+
+/**
+ * @brief 将 Unicode 码点编码为 UTF-8
+ * @param cp Unicode 码点
+ * @param out 输出缓冲区 (至少 5 字节)
+ * @return 写入的字节数 (1-4)
+ */
+static int utf8_encode(uint32_t cp, char *out)
+{
+    if (cp < 0x80)
+    {
+        out[0] = (char)cp;
+        return 1;
+    }
+    else if (cp < 0x800)
+    {
+        out[0] = 0xC0 | (cp >> 6);
+        out[1] = 0x80 | (cp & 0x3F);
+        return 2;
+    }
+    else if (cp < 0x10000)
+    {
+        out[0] = 0xE0 | (cp >> 12);
+        out[1] = 0x80 | ((cp >> 6) & 0x3F);
+        out[2] = 0x80 | (cp & 0x3F);
+        return 3;
+    }
+    else
+    {
+        out[0] = 0xF0 | (cp >> 18);
+        out[1] = 0x80 | ((cp >> 12) & 0x3F);
+        out[2] = 0x80 | ((cp >> 6) & 0x3F);
+        out[3] = 0x80 | (cp & 0x3F);
+        return 4;
+    }
+}
+
+// ============================================================================
+// 特殊 token 提取
+// ============================================================================
+
+/**
+ * @brief 向分段数组追加一个段 (容量不足时按倍数扩展)
+ * @return BBPEStatus
+ */
+static BBPEStatus push_segment(const BBPEAllocator *a, TokenSegment **segments, size_t *count, size_t *capacity,
+                               int is_special, size_t offset, size_t len, int special_id)
+{
+    if (*count >= *capacity)
+    {
+        size_t new_cap = *capacity ? *capacity * 2 : 16;
+        TokenSegment *new_seg = (TokenSegment *)mem_realloc(a, *segments, new_cap * sizeof(TokenSegment));
+        if (!new_seg)
+            return BBPE_ERR_MEMORY;
+        *segments = new_seg;
+        *capacity = new_cap;
+    }
+    TokenSegment *seg = &(*segments)[(*count)++];
+    seg->is_special = is_special;
+    seg->offset = offset;
+    seg->len = len;
+    seg->special_id = special_id;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 由特殊 token 表构建特殊 token 前缀树 (初始化/加载完成后调用)
+ * @param tok 分词器句柄
+ * @return BBPEStatus
+ */
+static BBPEStatus build_special_trie(BBPETokenizer *tok)
+{
+    mem_free(&tok->allocator, tok->special_trie);
+    tok->special_trie = NULL;
+    tok->special_trie_count = 0;
+    memset(tok->special_trie_root, 0, sizeof(tok->special_trie_root));
+    memset(tok->special_first_set, 0, sizeof(tok->special_first_set));
+    tok->special_first_count = 0;
+
+    // 节点数上界：根 + 所有 token 的字节总数
+    const VocabTable *specials = &tok->specials;
+    size_t total = 1;
+    for (uint32_t e = 0; e < specials->count; e++)
+        total += strlen(specials->pool + specials->offsets[e]);
+    if (total > UINT32_MAX)
+        return BBPE_ERR_MEMORY;
+    SpecialTrieNode *trie = (SpecialTrieNode *)mem_calloc(&tok->allocator, total, sizeof(SpecialTrieNode));
+    if (!trie)
+        return BBPE_ERR_MEMORY;
+    trie[0].token_id = -1;
+    uint32_t used = 1;
+
+    for (uint32_t e = 0; e < specials->count; e++)
+    {
+        // 重复的 token 以后加入者为准
+        const uint8_t *p = (const uint8_t *)(specials->pool + specials->offsets[e]);
+        if (!*p)
+            continue; // 空字符串不参与匹配
+        uint32_t node = 0;
+        for (; *p; p++)
+        {
+            // 根的子节点通过首字节表直接定位，其余节点遍历兄弟链表
+            uint32_t *link = node ? &trie[node].first_child : &tok->special_trie_root[*p];
+            uint32_t child = *link;
+            if (node)
+            {
+                while (child && trie[child].byte != *p)
+                {
+                    link = &trie[child].next_sibling;
+                    child = *link;
+                }
+            }
+            if (!child)
+            {
+                child = used++;
+                trie[child].byte = *p;
+                trie[child].token_id = -1;
+                *link = child;
+                if (!node)
+                {
+                    // 新的根子节点对应一个新的首字节
+                    tok->special_first_set[*p >> 6] |= (uint64_t)1 << (*p & 63);
+                    tok->special_first_count++;
+                    tok->special_first_byte = *p;
+                }
+            }
+            node = child;
+        }
+        trie[node].token_id = specials->ids[e];
+    }
+
+    tok->special_trie = trie;
+    tok->special_trie_count = used;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 将输入文本按特殊 token 分割成多个段
+ * @param tok 分词器句柄
+ * @param text 输入文本 (可包含 '\0'，无需以 '\0' 结尾)
+ * @param text_len 输入文本字节数
+ * @param a 分段缓冲区所用的分配器
+ * @param segments 分段缓冲区 (按需扩展，结果各段为 text 中的区间)
+ * @param capacity 分段缓冲区容量，扩展后更新
+ * @param out_len 输出段数量
+ * @return BBPEStatus
+ */
+PROFILE_NOINLINE
+static BBPEStatus extract_special_tokens(BBPETokenizer *tok, const char *text, size_t text_len, const BBPEAllocator *a,
+                                         TokenSegment **segments, size_t *capacity, size_t *out_len)
+{
+    size_t count = 0;
+
+    size_t start = 0;
+    size_t pos = 0;
+
+    // 没有特殊 token 时整个文本即为一个普通段
+    if (tok->special_first_count == 0)
+        pos = text_len;
+
+    while (pos < text_len)
+    {
+        int32_t best_id = -1;
+        size_t best_len = 0;
+
+        // 跳到下一个可能是特殊 token 首字节的位置：首字节唯一时 (如 '<') 用 memchr，否则查 256 位集合
+        if (tok->special_first_count == 1)
+        {
+            const char *hit = (const char *)memchr(text + pos, tok->special_first_byte, text_len - pos);
+            if (!hit)
+            {
+                pos = text_len;
+                break;
+            }
+            pos = (size_t)(hit - text);
+        }
+        else
+        {
+            while (pos < text_len &&
+                   !(tok->special_first_set[(uint8_t)text[pos] >> 6] >> ((uint8_t)text[pos] & 63) & 1))
+                pos++;
+            if (pos == text_len)
+                break;
+        }
+
+        // 沿前缀树向下匹配，记录经过的最长终止节点
+        uint32_t node = tok->special_trie_root[(uint8_t)text[pos]];
+        size_t depth = 0;
+        while (node)
+        {
+            depth++;
+            if (tok->special_trie[node].token_id >= 0)
+            {
+                best_id = tok->special_trie[node].token_id;
+                best_len = depth;
+            }
+            if (pos + depth >= text_len)
+                break;
+            uint8_t c = (uint8_t)text[pos + depth];
+            uint32_t child = tok->special_trie[node].first_child;
+            while (child && tok->special_trie[child].byte != c)
+                child = tok->special_trie[child].next_sibling;
+            node = child;
+        }
+
+        if (best_id >= 0)
+        {
+            // 有普通文本段需要先保存，然后保存特殊 token 段
+            if ((pos > start && push_segment(a, segments, &count, capacity, 0, start, pos - start, -1) != BBPE_OK) ||
+                push_segment(a, segments, &count, capacity, 1, pos, best_len, best_id) != BBPE_OK)
+                return BBPE_ERR_MEMORY;
+
+            start = pos + best_len;
+            pos = start;
+        }
+        else
+        {
+            pos++;
+        }
+    }
+
+    // 处理剩余普通文本
+    if (pos > start && push_segment(a, segments, &count, capacity, 0, start, pos - start, -1) != BBPE_OK)
+        return BBPE_ERR_MEMORY;
+
+    *out_len = count;
+    return BBPE_OK;
+}
+
+// ============================================================================
+// ByteLevel 映射初始化
+// ============================================================================
+
+/**
+ * @brief 初始化字节与 Unicode 码点的双向映射 (ByteLevel BPE 标准映射)
+ * @param tok 分词器句柄
+ */
+static void init_byte_mappings(BBPETokenizer *tok)
+{
+    int n = 0;
+    memset(tok->unicode_to_byte, 0, sizeof(tok->unicode_to_byte));
+    for (int b = 0; b < 256; b++)
+    {
+        // 可打印字符映射到自身，其他映射到 256+ 的私有码点
+        if ((b >= 33 && b <= 126) || (b >= 161 && b <= 172) || (b >= 174 && b <= 255))
+        {
+            tok->byte_to_unicode[b] = b;
+        }
+        else
+        {
+            tok->byte_to_unicode[b] = 256 + n;
+            n++;
+        }
+        tok->unicode_to_byte[tok->byte_to_unicode[b]] = (uint8_t)b;
+    }
+}
+
+/**
+ * @brief 预计算所有字节对应的 UTF-8 字符串 (用于快速查找字节 token)
+ * @param tok 分词器句柄
+ */
+static void precompute_byte_strings(BBPETokenizer *tok)
+{
+    for (int b = 0; b < 256; b++)
+    {
+        uint32_t cp = tok->byte_to_unicode[b];
+        int len = utf8_encode(cp, tok->byte_vocab_strs[b]);
+        tok->byte_vocab_strs[b][len] = '\0';
+    }
+}
+
+// ============================================================================
+// 编码工作区辅助函数
+// ============================================================================
+
+/**
+ * @brief 确保工作区缓冲区至少能容纳 needed 个元素 (按倍数增长，原有内容保留)
+ * @param a 缓冲区所用的分配器
+ * @param buf 缓冲区指针的地址
+ * @param capacity 当前容量 (元素个数)，扩展后更新
+ * @param needed 需要的元素个数
+ * @param elem_size 元素大小
+ * @return BBPEStatus
+ */
+static BBPEStatus workspace_reserve(const BBPEAllocator *a, void **buf, size_t *capacity, size_t needed,
+                                    size_t elem_size)
+{
+    if (needed <= *capacity)
+        return BBPE_OK;
+    size_t new_cap = *capacity ? *capacity : 16;
+    while (new_cap < needed)
+    {
+        if (new_cap > SIZE_MAX / 2)
+            return BBPE_ERR_MEMORY;
+        new_cap *= 2;
+    }
+    if (new_cap > SIZE_MAX / elem_size)
+        return BBPE_ERR_MEMORY;
+    void *tmp = mem_realloc(a, *buf, new_cap * elem_size);
+    if (!tmp)
+        return BBPE_ERR_MEMORY;
+    *buf = tmp;
+    *capacity = new_cap;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 释放工作区持有的全部缓冲区 (不释放工作区结构本身)
+ */
+static void workspace_release(BBPEWorkspace *ws)
+{
+    const BBPEAllocator *a = &ws->allocator;
+    mem_free(a, ws->nodes);
+    mem_free(a, ws->heap.items);
+    mem_free(a, ws->radix);
+    mem_free(a, ws->segments);
+    mem_free(a, ws->spans[0].spans);
+    mem_free(a, ws->spans[1].spans);
+    mem_free(a, ws->joined);
+    for (int i = 0; i < 2; i++)
+    {
+        mem_free(a, ws->norm[i].text);
+        mem_free(a, ws->norm[i].align);
+    }
+    mem_free(a, ws->norm_cps);
+    mem_free(a, ws->norm_srcs);
+    mem_free(a, ws->chunk_ends);
+    if (ws->match_data)
+        pcre2_match_data_free(ws->match_data);
+    pcre2_match_context_free(ws->match_context);
+    pcre2_jit_stack_free(ws->jit_stack);
+    pcre2_general_context_free(ws->pcre2_memory);
+    BBPEAllocator allocator = ws->allocator;
+    memset(ws, 0, sizeof(*ws));
+    ws->allocator = allocator;
+}
+
+/**
+ * @brief 初始化一个空工作区 (编码调用内部的临时工作区使用分词器的分配器)
+ */
+static void workspace_init(BBPEWorkspace *ws, const BBPEAllocator *a)
+{
+    memset(ws, 0, sizeof(*ws));
+    if (a)
+        ws->allocator = *a;
+}
+
+/**
+ * @brief 取得工作区创建 PCRE2 对象所用的通用上下文 (首次使用时创建)
+ * @return BBPEStatus
+ * @note 标准库分配时也显式创建：匹配数据未指定上下文时会沿用正则 (即分词器) 的分配器，
+ *       而工作区可能比分词器存活得更久
+ */
+static BBPEStatus workspace_pcre2_memory(BBPEWorkspace *ws, pcre2_general_context **out_context)
+{
+    if (!ws->pcre2_memory)
+    {
+        BBPEStatus status = pcre2_memory_create(&ws->allocator, &ws->pcre2_memory);
+        if (status != BBPE_OK)
+            return status;
+        if (!ws->pcre2_memory && !(ws->pcre2_memory = pcre2_general_context_create(NULL, NULL, NULL)))
+            return BBPE_ERR_MEMORY;
+    }
+    *out_context = ws->pcre2_memory;
+    return BBPE_OK;
+}
+
+// ============================================================================
+// 预分词相关函数
+// ============================================================================
+
+/**
+ * @brief 向预分词结果追加一个文本块区间 (容量按倍数增长)
+ * @param a 区间数组所用的分配器
+ * @param res 预分词结果
+ * @param offset 块在原始文本中的起始偏移
+ * @param len 块字节数
+ * @param prefix_spaces 块前补充的空格数
+ * @return BBPEStatus
+ */
+static BBPEStatus pre_tokenized_push(const BBPEAllocator *a, PreTokenizedResult *res, size_t offset, size_t len,
+                                     size_t prefix_spaces)
+{
+    if (res->count >= res->capacity)
+    {
+        size_t new_cap = res->capacity ? res->capacity * 2 : 16;
+        if (new_cap > SIZE_MAX / sizeof(ChunkSpan))
+            return BBPE_ERR_MEMORY;
+        ChunkSpan *tmp = (ChunkSpan *)mem_realloc(a, res->spans, new_cap * sizeof(ChunkSpan));
+        if (!tmp)
+            return BBPE_ERR_MEMORY;
+        res->spans = tmp;
+        res->capacity = new_cap;
+    }
+    res->spans[res->count].offset = offset;
+    res->spans[res->count].len = len;
+    res->spans[res->count].prefix_spaces = prefix_spaces;
+    res->count++;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 将虚拟文本 (前缀空格 + 原文区间) 中的 [start, end) 映射为原文区间后追加
+ * @param a 区间数组所用的分配器
+ * @param res 预分词结果
+ * @param in 被分割的输入块
+ * @param start 虚拟文本中的起始偏移
+ * @param end 虚拟文本中的结束偏移
+ * @return BBPEStatus
+ */
+static BBPEStatus pre_tokenized_push_virtual(const BBPEAllocator *a, PreTokenizedResult *res, const ChunkSpan *in,
+                                             size_t start, size_t end)
+{
+    size_t prefix = in->prefix_spaces;
+    size_t spaces = 0;
+    if (start < prefix)
+    {
+        spaces = (end < prefix ? end : prefix) - start;
+        start = prefix;
+    }
+    size_t len = end > start ? end - start : 0;
+    return pre_tokenized_push(a, res, in->offset + (start - prefix), len, spaces);
+}
+
+// ============================================================================
+// 内置快速分割器 (GPT-4 / Qwen 标准 Split 正则)
+// ============================================================================
+
+/* Qwen2/Qwen3 等使用的标准模式 (数字逐个切分) */
+#define FAST_SPLIT_PATTERN_QWEN \
+    "(?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+"
+/* GPT-4 (cl100k_base) 模式 (数字最多 3 个一组) */
+#define FAST_SPLIT_PATTERN_CL100K \
+    "(?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}{1,3}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+"
+
+/**
+ * @brief 识别可由内置分割器处理的正则 (按字符串完全相等判断)
+ * @param pattern 正则字符串
+ * @return \p{N} 的最大连续匹配数；0 表示未识别，需使用 PCRE2
+ */
+static int detect_fast_split(const char *pattern)
+{
+#ifdef BBPE_DISABLE_FAST_SPLIT
+    (void)pattern;
+    return 0;
+#else
+    if (strcmp(pattern, FAST_SPLIT_PATTERN_QWEN) == 0)
+        return 1;
+    if (strcmp(pattern, FAST_SPLIT_PATTERN_CL100K) == 0)
+        return 3;
+    return 0;
+#endif
+}
+
+/**
+ * @brief 计算从 s 开始的连续 ASCII 字节数 (SSE2 / NEON 每次检查 16 字节，之后按 8 字节字与逐字节收尾)
+ * @param s 字节串
+ * @param len 字节数
+ * @return 第一个非 ASCII 字节的下标，全部为 ASCII 时返回 len
+ */
+static inline size_t ascii_prefix_len(const uint8_t *s, size_t len)
+{
+    size_t i = 0;
+#if defined(BBPE_SIMD_SSE2)
+    for (; i + 16 <= len; i += 16)
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(s + i))) != 0)
+            break;
+#elif defined(BBPE_SIMD_NEON)
+    for (; i + 16 <= len; i += 16)
+    {
+        // 各字节最高位移到最低位，两半任一非 0 即含非 ASCII 字节
+        uint64x2_t high = vreinterpretq_u64_u8(vshrq_n_u8(vld1q_u8(s + i), 7));
+        if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) != 0)
+            break;
+    }
+#endif
+    for (; i + 8 <= len; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, s + i, sizeof(word));
+        if (word & 0x8080808080808080ull)
+            break;
+    }
+    while (i < len && s[i] < 0x80)
+        i++;
+    return i;
+}
+
+/**
+ * @brief 按 PCRE2 的规则校验 UTF-8 (拒绝过长编码、代理项与超出 0x10FFFF 的码点)
+ * @return 1 合法，0 非法
+ */
+static int utf8_validate(const uint8_t *s, size_t len)
+{
+    size_t i = 0;
+    while (i < len)
+    {
+        uint8_t c = s[i];
+        if (c < 0x80)
+        {
+            i += ascii_prefix_len(s + i, len - i);
+            continue;
+        }
+        size_t n;
+        uint32_t cp;
+        if (c >= 0xC2 && c <= 0xDF)
+        {
+            n = 2;
+            cp = c & 0x1F;
+        }
+        else if (c >= 0xE0 && c <= 0xEF)
+        {
+            n = 3;
+            cp = c & 0x0F;
+        }
+        else if (c >= 0xF0 && c <= 0xF4)
+        {
+            n = 4;
+            cp = c & 0x07;
+        }
+        else
+            return 0;
+        if (len - i < n)
+            return 0;
+        for (size_t k = 1; k < n; k++)
+        {
+            if ((s[i + k] & 0xC0) != 0x80)
+                return 0;
+            cp = (cp << 6) | (s[i + k] & 0x3F);
+        }
+        if ((n == 3 && (cp < 0x800 || (cp >= 0xD800 && cp <= 0xDFFF))) ||
+            (n == 4 && (cp < 0x10000 || cp > 0x10FFFF)))
+            return 0;
+        i += n;
+    }
+    return 1;
+}
+
+/**
+ * @brief 解码已校验过的 UTF-8 字符
+ * @param s 字符起始位置
+ * @param cp 输出码点
+ * @return 字符字节数
+ */
+static inline size_t fast_decode(const uint8_t *s, uint32_t *cp)
+{
+    uint8_t c = s[0];
+    if (c < 0x80)
+    {
+        *cp = c;
+        return 1;
+    }
+    if (c < 0xE0)
+    {
+        *cp = ((uint32_t)(c & 0x1F) << 6) | (s[1] & 0x3F);
+        return 2;
+    }
+    if (c < 0xF0)
+    {
+        *cp = ((uint32_t)(c & 0x0F) << 12) | ((uint32_t)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        return 3;
+    }
+    *cp = ((uint32_t)(c & 0x07) << 18) | ((uint32_t)(s[1] & 0x3F) << 12) | ((uint32_t)(s[2] & 0x3F) << 6) |
+          (s[3] & 0x3F);
+    return 4;
+}
+
+/**
+ * @brief 查询码点的字符类别 (BBPE_UCLASS_*)
+ */
+static inline int fast_uclass(uint32_t cp)
+{
+    uint8_t block = bbpe_uclass_stage1[cp >> BBPE_UCLASS_BLOCK_SHIFT];
+    uint32_t idx = cp & ((1u << BBPE_UCLASS_BLOCK_SHIFT) - 1);
+    return (bbpe_uclass_stage2[block][idx >> 2] >> ((idx & 3) * 2)) & 3;
+}
+
+/**
+ * @brief 将码点按 (?i:...) 规则折叠为小写 ASCII 字母，非字母返回 0
+ */
+static char fast_fold_letter(uint32_t cp)
+{
+    if (cp >= 'A' && cp <= 'Z')
+        return (char)(cp - 'A' + 'a');
+    if (cp >= 'a' && cp <= 'z')
+        return (char)cp;
+    for (size_t i = 0; i < sizeof(bbpe_caseless_extra) / sizeof(bbpe_caseless_extra[0]); i++)
+        if (bbpe_caseless_extra[i].cp == cp && cp != 0)
+            return bbpe_caseless_extra[i].lower;
+    return 0;
+}
+
+/**
+ * @brief 扫描器中的一个字符：位置、字节数、码点与类别
+ */
+typedef struct
+{
+    size_t pos;
+    size_t len;
+    uint32_t cp;
+    int cls;
+} FastChar;
+
+/**
+ * @brief 读取 pos 处的字符 (pos 到达末尾时 len 为 0)
+ */
+static inline FastChar fast_char_at(const uint8_t *s, size_t len, size_t pos)
+{
+    FastChar ch = {pos, 0, 0, -1};
+    if (pos < len)
+    {
+        if (s[pos] < 0x80)
+        {
+            ch.len = 1;
+            ch.cp = s[pos];
+            ch.cls = bbpe_uclass_ascii[s[pos]];
+        }
+        else
+        {
+            ch.len = fast_decode(s + pos, &ch.cp);
+            ch.cls = fast_uclass(ch.cp);
+        }
+    }
+    return ch;
+}
+
+/**
+ * @brief 从 pos 开始跳过连续的指定类别字符
+ * @return 第一个不属于该类别的字符位置
+ */
+static size_t fast_skip_class(const uint8_t *s, size_t len, size_t pos, int cls)
+{
+    while (pos < len)
+    {
+        if (s[pos] < 0x80) // ASCII 直接查表，不经过码点解码
+        {
+            if (bbpe_uclass_ascii[s[pos]] != cls)
+                break;
+            pos++;
+            continue;
+        }
+        FastChar ch = fast_char_at(s, len, pos);
+        if (ch.cls != cls)
+            break;
+        pos += ch.len;
+    }
+    return pos;
+}
+
+/**
+ * @brief 计算标准模式在 pos 处的匹配终点 (各分支按正则中的顺序尝试，语义与 PCRE2 回溯一致)
+ * @param s 已校验的 UTF-8 文本
+ * @param len 文本字节数
+ * @param pos 匹配起点 (< len)
+ * @param max_digits \p{N} 的最大连续匹配数
+ * @return 匹配终点 (> pos)
+ */
+static size_t fast_split_match(const uint8_t *s, size_t len, size_t pos, int max_digits)
+{
+    FastChar c0 = fast_char_at(s, len, pos);
+    FastChar c1 = fast_char_at(s, len, pos + c0.len);
+
+    // (?i:'s|'t|'re|'ve|'m|'ll|'d)
+    if (c0.cp == '\'' && c1.len)
+    {
+        char f1 = fast_fold_letter(c1.cp);
+        if (f1 == 's' || f1 == 't' || f1 == 'm' || f1 == 'd')
+            return c1.pos + c1.len;
+        if (f1 == 'r' || f1 == 'v' || f1 == 'l')
+        {
+            FastChar c2 = fast_char_at(s, len, c1.pos + c1.len);
+            char f2 = c2.len ? fast_fold_letter(c2.cp) : 0;
+            if (f2 == (f1 == 'l' ? 'l' : 'e'))
+                return c2.pos + c2.len;
+        }
+    }
+
+    // [^\r\n\p{L}\p{N}]?\p{L}+
+    if (c0.cls == BBPE_UCLASS_LETTER)
+        return fast_skip_class(s, len, c0.pos, BBPE_UCLASS_LETTER);
+    if (c0.cls != BBPE_UCLASS_NUMBER && c0.cp != '\r' && c0.cp != '\n' && c1.cls == BBPE_UCLASS_LETTER)
+        return fast_skip_class(s, len, c1.pos, BBPE_UCLASS_LETTER);
+
+    // \p{N} 或 \p{N}{1,3}
+    if (c0.cls == BBPE_UCLASS_NUMBER)
+    {
+        size_t end = c0.pos + c0.len;
+        for (int n = 1; n < max_digits && end < len; n++)
+        {
+            FastChar ch = fast_char_at(s, len, end);
+            if (ch.cls != BBPE_UCLASS_NUMBER)
+                break;
+            end += ch.len;
+        }
+        return end;
+    }
+
+    //  ?[^\s\p{L}\p{N}]+[\r\n]*
+    size_t other_start = 0;
+    int has_other = 0;
+    if (c0.cls == BBPE_UCLASS_OTHER)
+    {
+        other_start = c0.pos;
+        has_other = 1;
+    }
+    else if (c0.cp == ' ' && c1.cls == BBPE_UCLASS_OTHER)
+    {
+        other_start = c1.pos;
+        has_other = 1;
+    }
+    if (has_other)
+    {
+        size_t end = fast_skip_class(s, len, other_start, BBPE_UCLASS_OTHER);
+        while (end < len && (s[end] == '\r' || s[end] == '\n'))
+            end++;
+        return end;
+    }
+
+    // 剩余情况 c0 必为空白：\s*[\r\n]+ | \s+(?!\S) | \s+
+    size_t run_end = c0.pos;
+    size_t last_newline_end = 0;
+    size_t last_char_pos = c0.pos;
+    while (run_end < len)
+    {
+        FastChar ch = fast_char_at(s, len, run_end);
+        if (ch.cls != BBPE_UCLASS_SPACE)
+            break;
+        if (ch.cp == '\r' || ch.cp == '\n')
+            last_newline_end = run_end + 1;
+        last_char_pos = run_end;
+        run_end += ch.len;
+    }
+    if (last_newline_end)
+        return last_newline_end;
+    if (run_end == len || last_char_pos == c0.pos)
+        return run_end;
+    return last_char_pos;
+}
+
+/**
+ * @brief 使用内置分割器切分文本块，结果追加到 out (与对应正则经 PCRE2 切分的结果一致)
+ * @param node Split 预分词器节点
+ * @param subject 待切分文本 (已含前缀空格)
+ * @param text_len 文本字节数
+ * @param in 输入文本块区间
+ * @param a 输出区间数组所用的分配器
+ * @param out 输出预分词结果 (追加)
+ * @return BBPEStatus
+ */
+PROFILE_NOINLINE
+static BBPEStatus fast_split(const PreTokenizerNode *node, const char *subject, size_t text_len,
+                             const ChunkSpan *in, const BBPEAllocator *a, PreTokenizedResult *out)
+{
+    const uint8_t *s = (const uint8_t *)subject;
+    // 空文本或非法 UTF-8 时 PCRE2 不产生任何匹配，整个块原样保留
+    if (text_len == 0 || !utf8_validate(s, text_len))
+        return pre_tokenized_push(a, out, in->offset, in->len, in->prefix_spaces);
+
+    size_t pos = 0;
+    while (pos < text_len)
+    {
+        size_t end = fast_split_match(s, text_len, pos, node->config.split.fast_digits);
+        BBPEStatus status = pre_tokenized_push_virtual(a, out, in, pos, end);
+        if (status != BBPE_OK)
+            return status;
+        pos = end;
+    }
+    return BBPE_OK;
+}
+
+// ============================================================================
+// 规范化器 (NFC / NFD / NFKC / NFKD / Lowercase / Replace / Prepend)
+// ============================================================================
+//
+// 与 tokenizers 库相同，规范化在特殊 token 提取之后、预分词之前对每个普通文本段执行 (特殊 token 按原文匹配)。
+// 各步骤只在文本确实改变时才写入工作区缓冲区，否则直接沿用输入：Unicode 范式按码点属性表跳过不受影响的
+// 字符 (纯 ASCII 文本一次扫描即整段跳过)，Lowercase 对 ASCII 逐字节转换。需要字节区间时另外记录对齐表，
+// 把结果中的每个位置对应回输入位置；同一组合序列产生的字节都对应该序列的起点。
+// 非法 UTF-8 字节原样保留，并视为组合序列的边界。
+
+#define HANGUL_S_BASE 0xAC00
+#define HANGUL_L_BASE 0x1100
+#define HANGUL_V_BASE 0x1161
+#define HANGUL_T_BASE 0x11A7
+#define HANGUL_L_COUNT 19
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_S_COUNT (HANGUL_L_COUNT * HANGUL_V_COUNT * HANGUL_T_COUNT)
+
+/**
+ * @brief 查询码点的规范化属性
+ */
+static inline const BBPENormProps *norm_props(uint32_t cp)
+{
+    if (cp >= BBPE_NORM_LIMIT)
+        return &bbpe_norm_props[0];
+    uint8_t block = bbpe_norm_stage1[cp >> BBPE_NORM_BLOCK_SHIFT];
+    return &bbpe_norm_props[bbpe_norm_stage2[block][cp & ((1u << BBPE_NORM_BLOCK_SHIFT) - 1)]];
+}
+
+/**
+ * @brief 判断码点是否为谚文音节 (按算法分解与组合，不在属性表中)
+ */
+static inline int norm_is_hangul_syllable(uint32_t cp)
+{
+    return cp - HANGUL_S_BASE < HANGUL_S_COUNT;
+}
+
+/**
+ * @brief 判断规范化器节点是否为 Unicode 范式 (NFC / NFD / NFKC / NFKD)
+ */
+static int norm_is_unicode_form(NormalizerType type)
+{
+    return type == NORMALIZER_NFC || type == NORMALIZER_NFD || type == NORMALIZER_NFKC || type == NORMALIZER_NFKD;
+}
+
+/**
+ * @brief 判断码点在该步骤下是否保持不变，且与前后字符相互独立
+ * @param type 规范化器类型 (Unicode 范式或 Lowercase)
+ * @param cp 码点
+ * @return 1 表示该字符原样输出，且其前、其后切开分别规范化与整体规范化结果相同
+ */
+static inline int norm_char_inert(NormalizerType type, uint32_t cp)
+{
+    if (cp < 0x80)
+        return type != NORMALIZER_LOWERCASE || cp - 'A' >= 26;
+    const BBPENormProps *p = norm_props(cp);
+    switch (type)
+    {
+    case NORMALIZER_NFC:
+        return p->ccc == 0 && !(p->flags & (BBPE_NORM_NFC_NO | BBPE_NORM_COMPOSE_TAIL));
+    case NORMALIZER_NFKC:
+        return p->ccc == 0 && !(p->flags & (BBPE_NORM_NFKC_NO | BBPE_NORM_COMPOSE_TAIL));
+    case NORMALIZER_NFD:
+        return p->ccc == 0 && !p->decomp && !norm_is_hangul_syllable(cp);
+    case NORMALIZER_NFKD:
+        return p->ccc == 0 && !p->compat && !norm_is_hangul_syllable(cp);
+    case NORMALIZER_LOWERCASE:
+        return !p->lower;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief 解码一个 UTF-8 字符 (按 PCRE2 的规则校验)
+ * @param s 文本
+ * @param len 文本字节数
+ * @param pos 字符起点
+ * @param cp 输出码点
+ * @return 字符字节数，pos 处不是合法字符时返回 0
+ */
+static inline size_t norm_decode(const uint8_t *s, size_t len, size_t pos, uint32_t *cp)
+{
+    uint8_t c = s[pos];
+    size_t n;
+    uint32_t v;
+    if (c < 0x80)
+    {
+        *cp = c;
+        return 1;
+    }
+    if (c >= 0xC2 && c <= 0xDF)
+    {
+        n = 2;
+        v = c & 0x1F;
+    }
+    else if (c >= 0xE0 && c <= 0xEF)
+    {
+        n = 3;
+        v = c & 0x0F;
+    }
+    else if (c >= 0xF0 && c <= 0xF4)
+    {
+        n = 4;
+        v = c & 0x07;
+    }
+    else
+        return 0;
+    if (len - pos < n)
+        return 0;
+    for (size_t k = 1; k < n; k++)
+    {
+        if ((s[pos + k] & 0xC0) != 0x80)
+            return 0;
+        v = (v << 6) | (s[pos + k] & 0x3F);
+    }
+    if ((n == 3 && (v < 0x800 || (v >= 0xD800 && v <= 0xDFFF))) || (n == 4 && (v < 0x10000 || v > 0x10FFFF)))
+        return 0;
+    *cp = v;
+    return n;
+}
+
+/**
+ * @brief 确保规范化缓冲区还能追加 extra 字节 (track 非 0 时同时扩展对齐表)
+ */
+static BBPEStatus norm_reserve(const BBPEAllocator *a, NormBuffer *b, size_t extra, int track)
+{
+    if (extra > SIZE_MAX - 1 - b->len)
+        return BBPE_ERR_MEMORY;
+    BBPEStatus status = workspace_reserve(a, (void **)&b->text, &b->capacity, b->len + extra, 1);
+    if (status == BBPE_OK && track)
+        status = workspace_reserve(a, (void **)&b->align, &b->align_capacity, b->len + extra + 1, sizeof(size_t));
+    return status;
+}
+
+/**
+ * @brief 原样复制输入 [from, to) 到规范化缓冲区，对齐表逐字节对应
+ */
+static BBPEStatus norm_copy(const BBPEAllocator *a, NormBuffer *b, const char *in, size_t from, size_t to, int track)
+{
+    size_t n = to - from;
+    if (n == 0)
+        return BBPE_OK;
+    BBPEStatus status = norm_reserve(a, b, n, track);
+    if (status != BBPE_OK)
+        return status;
+    memcpy(b->text + b->len, in + from, n);
+    if (track)
+    {
+        for (size_t i = 0; i < n; i++)
+            b->align[b->len + i] = from + i;
+    }
+    b->len += n;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 向规范化缓冲区写入由输入位置 src 开始的序列产生的 n 字节
+ */
+static BBPEStatus norm_emit(const BBPEAllocator *a, NormBuffer *b, const char *bytes, size_t n, size_t src, int track)
+{
+    BBPEStatus status = norm_reserve(a, b, n, track);
+    if (status != BBPE_OK)
+        return status;
+    memcpy(b->text + b->len, bytes, n);
+    if (track)
+    {
+        for (size_t i = 0; i < n; i++)
+            b->align[b->len + i] = src;
+    }
+    b->len += n;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 查询两个码点的主组合结果 (含谚文音节的算法组合)
+ * @return 组合后的码点，不能组合时返回 0
+ */
+static uint32_t norm_compose_pair(uint32_t a, uint32_t b)
+{
+    if (a - HANGUL_L_BASE < HANGUL_L_COUNT && b - HANGUL_V_BASE < HANGUL_V_COUNT)
+        return HANGUL_S_BASE + ((a - HANGUL_L_BASE) * HANGUL_V_COUNT + (b - HANGUL_V_BASE)) * HANGUL_T_COUNT;
+    if (norm_is_hangul_syllable(a) && (a - HANGUL_S_BASE) % HANGUL_T_COUNT == 0 &&
+        b - HANGUL_T_BASE - 1 < HANGUL_T_COUNT - 1)
+        return a + (b - HANGUL_T_BASE);
+    uint64_t key = ((uint64_t)a << 21) | b;
+    size_t lo = 0;
+    size_t hi = sizeof(bbpe_norm_compose) / sizeof(bbpe_norm_compose[0]);
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (bbpe_norm_compose[mid].key < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < sizeof(bbpe_norm_compose) / sizeof(bbpe_norm_compose[0]) && bbpe_norm_compose[lo].key == key
+               ? bbpe_norm_compose[lo].cp
+               : 0;
+}
+
+/**
+ * @brief 对 cps[from, to) 这段非起始字符按组合类稳定排序 (规范排序)，srcs 随之一起移动
+ * @param cps 码点数组，其后至少还有 to - from 个元素的空间 (计数排序的临时区)
+ * @param srcs 各码点的来源位置，其后同样留有临时区
+ */
+static void norm_sort_marks(uint32_t *cps, size_t *srcs, size_t from, size_t to)
+{
+    size_t n = to - from;
+    if (n <= NORM_SORT_INSERTION)
+    {
+        for (size_t i = from + 1; i < to; i++)
+        {
+            uint32_t c = cps[i];
+            size_t src = srcs[i];
+            uint8_t ccc = norm_props(c)->ccc;
+            size_t j = i;
+            while (j > from && norm_props(cps[j - 1])->ccc > ccc)
+            {
+                cps[j] = cps[j - 1];
+                srcs[j] = srcs[j - 1];
+                j--;
+            }
+            cps[j] = c;
+            srcs[j] = src;
+        }
+        return;
+    }
+    // 很长的非起始字符序列 (病态输入) 用计数排序，避免插入排序的平方复杂度
+    size_t start[257] = {0};
+    for (size_t i = from; i < to; i++)
+        start[norm_props(cps[i])->ccc + 1]++;
+    for (int k = 1; k <= 256; k++)
+        start[k] += start[k - 1];
+    uint32_t *tmp = cps + to;
+    size_t *src_tmp = srcs + to;
+    for (size_t i = from; i < to; i++)
+    {
+        size_t k = start[norm_props(cps[i])->ccc]++;
+        tmp[k] = cps[i];
+        src_tmp[k] = srcs[i];
+    }
+    memcpy(cps + from, tmp, n * sizeof(uint32_t));
+    memcpy(srcs + from, src_tmp, n * sizeof(size_t));
+}
+
+/**
+ * @brief 规范化一个组合序列 (输入 [from, to) 为合法 UTF-8)：分解、规范排序，组合范式再执行规范组合
+ * @param ws 工作区 (结果码点写入 norm_cps，各码点的来源位置写入 norm_srcs)
+ * @param type Unicode 范式
+ * @param in 输入文本
+ * @param from 序列起点
+ * @param to 序列终点
+ * @param out_count 输出结果的码点数
+ * @param out_same 输出 1 表示结果与输入逐字节相同 (无需写入输出缓冲区)
+ * @return BBPEStatus
+ */
+static BBPEStatus norm_unicode_run(BBPEWorkspace *ws, NormalizerType type, const uint8_t *in, size_t from, size_t to,
+                                   size_t *out_count, int *out_same)
+{
+    const BBPEAllocator *a = &ws->allocator;
+    int compat = type == NORMALIZER_NFKC || type == NORMALIZER_NFKD;
     size_t count = 0;
+    for (size_t pos = from; pos < to;)
+    {
+        uint32_t cp = 0;
+        size_t src = pos;
+        pos += norm_decode(in, to, pos, &cp); // 序列内均为合法字符
+        // 单个码点最多分解为 18 个码点 (U+FDFA)，计数排序另需等长的临时区
+        BBPEStatus status = workspace_reserve(a, (void **)&ws->norm_cps, &ws->norm_cp_capacity, 2 * (count + 18),
+                                              sizeof(uint32_t));
+        if (status == BBPE_OK)
+            status = workspace_reserve(a, (void **)&ws->norm_srcs, &ws->norm_src_capacity, 2 * (count + 18),
+                                       sizeof(size_t));
+        if (status != BBPE_OK)
+            return status;
+        uint32_t *cps = ws->norm_cps;
+        size_t first = count;
+        if (norm_is_hangul_syllable(cp))
+        {
+            uint32_t s = cp - HANGUL_S_BASE;
+            cps[count++] = HANGUL_L_BASE + s / (HANGUL_V_COUNT * HANGUL_T_COUNT);
+            cps[count++] = HANGUL_V_BASE + s % (HANGUL_V_COUNT * HANGUL_T_COUNT) / HANGUL_T_COUNT;
+            if (s % HANGUL_T_COUNT)
+                cps[count++] = HANGUL_T_BASE + s % HANGUL_T_COUNT;
+        }
+        else
+        {
+            const BBPENormProps *p = norm_props(cp);
+            uint16_t map = compat ? p->compat : p->decomp;
+            if (!map)
+                cps[count++] = cp;
+            for (uint32_t k = 0; map && k < bbpe_norm_pool[map]; k++)
+                cps[count++] = bbpe_norm_pool[map + 1 + k];
+        }
+        for (size_t k = first; k < count; k++)
+            ws->norm_srcs[k] = src;
+    }
+
+    uint32_t *cps = ws->norm_cps;
+    size_t *srcs = ws->norm_srcs;
+    for (size_t i = 0; i < count;)
+    {
+        if (norm_props(cps[i])->ccc == 0)
+        {
+            i++;
+            continue;
+        }
+        size_t j = i + 1;
+        while (j < count && norm_props(cps[j])->ccc != 0)
+            j++;
+        if (j - i > 1)
+            norm_sort_marks(cps, srcs, i, j);
+        i = j;
+    }
+
+    if (type == NORMALIZER_NFC || type == NORMALIZER_NFKC)
+    {
+        // 规范组合：每个字符尝试与最近的起始字符组合，二者之间有组合类不小于它的字符时被阻断。
+        // 组合结果保留起始字符的来源位置
+        size_t out = 0;
+        size_t starter = SIZE_MAX;
+        uint8_t last_ccc = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t c = cps[i];
+            uint8_t ccc = norm_props(c)->ccc;
+            if (starter != SIZE_MAX && (out == starter + 1 || (last_ccc != 0 && last_ccc < ccc)))
+            {
+                uint32_t composed = norm_compose_pair(cps[starter], c);
+                if (composed)
+                {
+                    cps[starter] = composed;
+                    continue;
+                }
+            }
+            if (ccc == 0)
+                starter = out;
+            last_ccc = ccc;
+            srcs[out] = srcs[i];
+            cps[out++] = c;
+        }
+        count = out;
+    }
+
+    // 多数序列 (如天城文的元音符号与半音符) 本已是规范形式，与输入相同时不写入
+    size_t pos = from;
+    int same = 1;
+    for (size_t i = 0; i < count && same; i++)
+    {
+        char bytes[5];
+        size_t n = (size_t)utf8_encode(cps[i], bytes);
+        same = n <= to - pos && memcmp(in + pos, bytes, n) == 0;
+        pos += n;
+    }
+    *out_count = count;
+    *out_same = same && pos == to;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 写入 norm_unicode_run 的结果：每个码点的字节对齐到其来源字符 (按输出顺序取单调不减，排序移动的组合标记归入前面的字符)
+ */
+static BBPEStatus norm_unicode_emit(BBPEWorkspace *ws, size_t count, NormBuffer *b, int track)
+{
+    size_t src = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        char bytes[5];
+        int n = utf8_encode(ws->norm_cps[i], bytes);
+        if (ws->norm_srcs[i] > src || i == 0)
+            src = ws->norm_srcs[i];
+        BBPEStatus status = norm_emit(&ws->allocator, b, bytes, (size_t)n, src, track);
+        if (status != BBPE_OK)
+            return status;
+    }
+    return BBPE_OK;
+}
+
+/**
+ * @brief 执行一个 Unicode 范式步骤：只有不独立的字符所在的组合序列才重新计算，其余字节原样复制
+ * @param ws 工作区
+ * @param type Unicode 范式
+ * @param text 输入文本
+ * @param len 输入字节数
+ * @param b 输出缓冲区 (已清空)
+ * @param track 非 0 时记录对齐表
+ * @param out_changed 输出 1 表示结果写入了 b，0 表示结果与输入相同 (b 未写入)
+ * @return BBPEStatus
+ */
+static BBPEStatus norm_unicode_form(BBPEWorkspace *ws, NormalizerType type, const char *text, size_t len,
+                                    NormBuffer *b, int track, int *out_changed)
+{
+    const uint8_t *s = (const uint8_t *)text;
+    size_t done = 0;        // 已写入输出的输入字节数
+    size_t last = SIZE_MAX; // 紧邻当前位置之前的独立字符的起点 (可能与其后的字符组合)
+    size_t pos = 0;
+    *out_changed = 0;
+    while (pos < len)
+    {
+        if (s[pos] < 0x80)
+        {
+            size_t n = ascii_prefix_len(s + pos, len - pos);
+            pos += n;
+            last = pos - 1;
+            continue;
+        }
+        uint32_t cp;
+        size_t n = norm_decode(s, len, pos, &cp);
+        if (n == 0)
+        {
+            pos++;
+            last = SIZE_MAX;
+            continue;
+        }
+        if (norm_char_inert(type, cp))
+        {
+            last = pos;
+            pos += n;
+            continue;
+        }
+
+        // 组合序列从紧邻的独立字符 (若有) 开始，延伸到下一个独立字符或非法字节之前
+        size_t run = last != SIZE_MAX ? last : pos;
+        size_t end = pos + n;
+        while (end < len)
+        {
+            size_t m = norm_decode(s, len, end, &cp);
+            if (m == 0 || norm_char_inert(type, cp))
+                break;
+            end += m;
+        }
+        size_t count;
+        int same;
+        BBPEStatus status = norm_unicode_run(ws, type, s, run, end, &count, &same);
+        if (status == BBPE_OK && !same)
+        {
+            status = norm_copy(&ws->allocator, b, text, done, run, track);
+            if (status == BBPE_OK)
+                status = norm_unicode_emit(ws, count, b, track);
+            *out_changed = 1;
+            done = end;
+        }
+        if (status != BBPE_OK)
+            return status;
+        pos = end;
+        last = SIZE_MAX;
+    }
+    if (!*out_changed)
+        return BBPE_OK;
+    return norm_copy(&ws->allocator, b, text, done, len, track);
+}
+
+/**
+ * @brief 执行 Lowercase 步骤 (逐字符映射，不做上下文相关的转换)
+ * @note 参数与返回值同 norm_unicode_form
+ */
+static BBPEStatus norm_lowercase(BBPEWorkspace *ws, const char *text, size_t len, NormBuffer *b, int track,
+                                 int *out_changed)
+{
+    const uint8_t *s = (const uint8_t *)text;
+    size_t done = 0;
+    *out_changed = 0;
+    for (size_t pos = 0; pos < len;)
+    {
+        char lower[16]; // 单个字符的小写映射不超过 3 个码点
+        size_t lower_len = 0;
+        uint32_t cp;
+        size_t n = 1;
+        if (s[pos] < 0x80)
+        {
+            if (s[pos] < 'A' || s[pos] > 'Z')
+            {
+                pos++;
+                continue;
+            }
+            lower[lower_len++] = (char)(s[pos] + ('a' - 'A'));
+        }
+        else
+        {
+            n = norm_decode(s, len, pos, &cp);
+            uint16_t map = n ? norm_props(cp)->lower : 0;
+            if (!map)
+            {
+                pos += n ? n : 1;
+                continue;
+            }
+            for (uint32_t k = 0; k < bbpe_norm_pool[map]; k++)
+                lower_len += (size_t)utf8_encode(bbpe_norm_pool[map + 1 + k], lower + lower_len);
+        }
+        BBPEStatus status = norm_copy(&ws->allocator, b, text, done, pos, track);
+        if (status == BBPE_OK)
+            status = norm_emit(&ws->allocator, b, lower, lower_len, pos, track);
+        if (status != BBPE_OK)
+            return status;
+        *out_changed = 1;
+        done = pos += n;
+    }
+    if (!*out_changed)
+        return BBPE_OK;
+    return norm_copy(&ws->allocator, b, text, done, len, track);
+}
+
+/**
+ * @brief 执行 Replace 步骤 (从左到右替换互不重叠的出现)
+ * @note 参数与返回值同 norm_unicode_form
+ */
+static BBPEStatus norm_replace(BBPEWorkspace *ws, const NormalizerNode *node, const char *text, size_t len,
+                               NormBuffer *b, int track, int *out_changed)
+{
+    size_t done = 0;
+    size_t pos = 0;
+    size_t plen = node->pattern_len;
+    *out_changed = 0;
+    while (plen > 0 && len - pos >= plen)
+    {
+        const char *hit = (const char *)memchr(text + pos, node->pattern[0], len - pos - plen + 1);
+        if (!hit)
+            break;
+        pos = (size_t)(hit - text);
+        if (memcmp(hit, node->pattern, plen) != 0)
+        {
+            pos++;
+            continue;
+        }
+        BBPEStatus status = norm_copy(&ws->allocator, b, text, done, pos, track);
+        if (status == BBPE_OK && node->content_len)
+            status = norm_emit(&ws->allocator, b, node->content, node->content_len, pos, track);
+        if (status != BBPE_OK)
+            return status;
+        *out_changed = 1;
+        done = pos += plen;
+    }
+    if (!*out_changed)
+        return BBPE_OK;
+    return norm_copy(&ws->allocator, b, text, done, len, track);
+}
+
+/**
+ * @brief 对一个普通文本段依次执行规范化链
+ * @param tok 分词器句柄
+ * @param ws 工作区 (结果位于其规范化缓冲区中，直到下一次规范化)
+ * @param text 文本段
+ * @param len 文本段字节数
+ * @param track 非 0 时输出对齐表
+ * @param out_text 输出规范化后的文本 (未改变时即 text)
+ * @param out_len 输出规范化后的字节数
+ * @param out_align track 非 0 时输出对齐表 (out_len + 1 项，结果位置 → 文本段内的位置)，未改变时为 NULL
+ * @return BBPEStatus
+ */
+PROFILE_NOINLINE
+static BBPEStatus normalize_text(const BBPETokenizer *tok, BBPEWorkspace *ws, const char *text, size_t len,
+                                 int track, const char **out_text, size_t *out_len, const size_t **out_align)
+{
+    const char *cur = text;
+    size_t cur_len = len;
+    const size_t *cur_align = NULL;
+    int used = -1; // cur 所在的缓冲区，-1 表示输入本身
+    for (const NormalizerNode *node = tok->normalizers; node; node = node->next)
+    {
+        NormBuffer *b = &ws->norm[used == 0 ? 1 : 0];
+        b->len = 0;
+        int changed = 0;
+        BBPEStatus status = BBPE_OK;
+        if (norm_is_unicode_form(node->type))
+            status = norm_unicode_form(ws, node->type, cur, cur_len, b, track, &changed);
+        else if (node->type == NORMALIZER_LOWERCASE)
+            status = norm_lowercase(ws, cur, cur_len, b, track, &changed);
+        else if (node->type == NORMALIZER_REPLACE)
+            status = norm_replace(ws, node, cur, cur_len, b, track, &changed);
+        else if (node->type == NORMALIZER_PREPEND && cur_len > 0)
+        {
+            status = norm_emit(&ws->allocator, b, node->content, node->content_len, 0, track);
+            if (status == BBPE_OK)
+                status = norm_copy(&ws->allocator, b, cur, 0, cur_len, track);
+            changed = 1;
+        }
+        if (status != BBPE_OK)
+            return status;
+        if (!changed)
+            continue;
+
+        if (track)
+        {
+            // 对齐表指向上一步的结果，经上一步的对齐表换算到文本段内的位置
+            if ((status = norm_reserve(&ws->allocator, b, 0, track)) != BBPE_OK)
+                return status;
+            b->align[b->len] = cur_len;
+            if (cur_align)
+            {
+                for (size_t i = 0; i <= b->len; i++)
+                    b->align[i] = cur_align[b->align[i]];
+            }
+            cur_align = b->align;
+        }
+        cur = b->len ? b->text : "";
+        cur_len = b->len;
+        used = (int)(b - ws->norm);
+    }
+    *out_text = cur;
+    *out_len = cur_len;
+    if (out_align)
+        *out_align = cur_align;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 将规范化结果中的区间终点换算为文本段内的位置
+ * @param align normalize_text 输出的对齐表
+ * @param len 规范化结果的字节数
+ * @param pos 区间终点
+ * @return 终点位于某个组合序列的输出内部时为该序列在文本段中的终点
+ */
+static size_t norm_align_end(const size_t *align, size_t len, size_t pos)
+{
+    if (pos == 0)
+        return align[0];
+    size_t base = align[pos - 1];
+    while (pos < len && align[pos] == base)
+        pos++;
+    return align[pos];
+}
+
+/**
+ * @brief 判断规范化链能否在独立字符处切开：只含 Unicode 范式与 Lowercase (Replace 与 Prepend 依赖上下文)
+ */
+static int normalizer_restartable(const BBPETokenizer *tok)
+{
+    for (const NormalizerNode *node = tok->normalizers; node; node = node->next)
+    {
+        if (!norm_is_unicode_form(node->type) && node->type != NORMALIZER_LOWERCASE)
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief 判断码点在整个规范化链下是否独立 (见 norm_char_inert)
+ */
+static int normalizer_char_inert(const BBPETokenizer *tok, uint32_t cp)
+{
+    for (const NormalizerNode *node = tok->normalizers; node; node = node->next)
+    {
+        if (!norm_char_inert(node->type, cp))
+            return 0;
+    }
+    return 1;
+}
+
+// ============================================================================
+// 预分词链
+// ============================================================================
+
+/**
+ * @brief 取得工作区的 PCRE2 匹配上下文，并使其上限与分词器当前的设置一致
+ * @param ws 工作区
+ * @param limits 分词器的上限设置
+ * @param want_jit_stack 非 0 时确保上下文挂接了 JIT 栈 (栈创建失败时不挂接，匹配改用解释器)
+ * @param out_context 输出匹配上下文；既没有上限也没有 JIT 栈时为 NULL (匹配使用默认值)
+ * @return BBPEStatus
+ * @note 上下文与 JIT 栈随工作区复用，工作区换用上限不同的分词器时逐次同步
+ */
+static BBPEStatus workspace_match_context(BBPEWorkspace *ws, const BBPELimits *limits, int want_jit_stack,
+                                          pcre2_match_context **out_context)
+{
+    pcre2_general_context *memory;
+    BBPEStatus status = workspace_pcre2_memory(ws, &memory);
+    if (status != BBPE_OK)
+        return status;
+    if (want_jit_stack && !ws->jit_stack)
+    {
+        ws->jit_stack = pcre2_jit_stack_create(JIT_STACK_START, JIT_STACK_MAX, memory);
+        if (ws->jit_stack && ws->match_context)
+            pcre2_jit_stack_assign(ws->match_context, NULL, ws->jit_stack);
+    }
+    if (!ws->match_context && (ws->jit_stack || limits->match_limit || limits->depth_limit))
+    {
+        ws->match_context = pcre2_match_context_create(memory);
+        if (!ws->match_context)
+            return BBPE_ERR_MEMORY;
+        ws->match_limit = ws->depth_limit = 0;
+        if (ws->jit_stack)
+            pcre2_jit_stack_assign(ws->match_context, NULL, ws->jit_stack);
+    }
+    if (ws->match_context && ws->match_limit != limits->match_limit)
+    {
+        uint32_t value = limits->match_limit;
+        if (!value)
+            pcre2_config(PCRE2_CONFIG_MATCHLIMIT, &value);
+        pcre2_set_match_limit(ws->match_context, value);
+        ws->match_limit = limits->match_limit;
+    }
+    if (ws->match_context && ws->depth_limit != limits->depth_limit)
+    {
+        uint32_t value = limits->depth_limit;
+        if (!value)
+            pcre2_config(PCRE2_CONFIG_DEPTHLIMIT, &value);
+        pcre2_set_depth_limit(ws->match_context, value);
+        ws->depth_limit = limits->depth_limit;
+    }
+    *out_context = ws->match_context;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 应用单个预分词器到一个文本块，结果追加到 out
+ * @param node 预分词器节点
+ * @param limits 分词器的上限设置 (PCRE2 回溯上限经工作区的匹配上下文生效)
+ * @param text 原始文本 (所有区间均相对于它)
+ * @param in 输入文本块区间
+ * @param ws 工作区 (提供拼接缓冲区、匹配数据、匹配上下文与 JIT 栈)
+ * @param out 输出预分词结果 (追加)
+ * @return BBPEStatus
+ */
+static BBPEStatus apply_single_pre_tokenizer(PreTokenizerNode *node, const BBPELimits *limits,
+                                             const char *text, const ChunkSpan *in, BBPEWorkspace *ws,
+                                             PreTokenizedResult *out)
+{
+    if (node->type == PRE_TOKENIZER_BYTE_LEVEL)
+    {
+        // ByteLevel: 可选添加前缀空格，整个块原样保留 (空格只记录数量，不复制文本)
+        return pre_tokenized_push(&ws->allocator, out, in->offset, in->len,
+                                  in->prefix_spaces + (node->config.byte_level.add_prefix_space ? 1 : 0));
+    }
+    else if (node->type == PRE_TOKENIZER_REGEX_SPLIT && node->config.split.regex_compiled)
+    {
+        // 正则分割: 使用 pcre2 匹配，将文本按匹配到的部分分割成块
+        // 带前缀空格的块需要拼出完整文本再匹配 (仅在 ByteLevel 位于 Split 之前时出现)
+        const char *subject = text + in->offset;
+        size_t text_len = in->len + in->prefix_spaces;
+        BBPEStatus status;
+        if (in->prefix_spaces > 0)
+        {
+            status = workspace_reserve(&ws->allocator, (void **)&ws->joined, &ws->joined_capacity, text_len, 1);
+            if (status != BBPE_OK)
+                return status;
+            memset(ws->joined, ' ', in->prefix_spaces);
+            memcpy(ws->joined + in->prefix_spaces, subject, in->len);
+            subject = ws->joined;
+        }
+
+        // 已识别的标准模式由内置分割器处理
+        if (node->config.split.fast_digits)
+            return fast_split(node, subject, text_len, in, &ws->allocator, out);
+
+        // 复用工作区的匹配数据，仅在 ovector 容纳不下该模式的捕获组时重建
+        uint32_t capture_count = 0;
+        pcre2_pattern_info(node->config.split.regex_compiled, PCRE2_INFO_CAPTURECOUNT, &capture_count);
+        if (!ws->match_data || pcre2_get_ovector_count(ws->match_data) < capture_count + 1)
+        {
+            pcre2_general_context *memory;
+            status = workspace_pcre2_memory(ws, &memory);
+            if (status != BBPE_OK)
+                return status;
+            if (ws->match_data)
+                pcre2_match_data_free(ws->match_data);
+            ws->match_data = pcre2_match_data_create_from_pattern(node->config.split.regex_compiled, memory);
+            if (!ws->match_data)
+                return BBPE_ERR_MEMORY;
+        }
+        pcre2_match_data *match_data = ws->match_data;
+        pcre2_match_context *match_context;
+        status = workspace_match_context(ws, limits, 0, &match_context);
+        if (status != BBPE_OK)
+            return status;
+
+        size_t first = out->count;
+        PCRE2_SIZE offset = 0;
+        PCRE2_SIZE last_end = 0;
+        // 首次匹配由 pcre2_match 校验整个 subject 的 UTF-8 合法性，之后的匹配跳过重复校验
+        uint32_t match_options = 0;
+
+        while (offset < text_len)
+        {
+            // 已校验过 UTF-8 时直接调用 JIT 代码；pcre2_match 在模式有 JIT 代码时同样经 JIT 执行
+            int use_jit_match = node->config.split.jit && (match_options & PCRE2_NO_UTF_CHECK);
+            int rc = use_jit_match ? pcre2_jit_match(node->config.split.regex_compiled, (PCRE2_SPTR)subject, text_len,
+                                                     offset, match_options, match_data, match_context)
+                                   : pcre2_match(node->config.split.regex_compiled, (PCRE2_SPTR)subject, text_len,
+                                                 offset, match_options, match_data, match_context);
+            if (rc == PCRE2_ERROR_JIT_STACKLIMIT && !ws->jit_stack)
+            {
+                // 默认的 32 KB 机器栈不足：为工作区创建可增长的 JIT 栈后重试，此后的匹配都使用它
+                status = workspace_match_context(ws, limits, 1, &match_context);
+                if (status != BBPE_OK)
+                    goto done;
+                if (ws->jit_stack)
+                    rc = use_jit_match ? pcre2_jit_match(node->config.split.regex_compiled, (PCRE2_SPTR)subject,
+                                                         text_len, offset, match_options, match_data, match_context)
+                                       : pcre2_match(node->config.split.regex_compiled, (PCRE2_SPTR)subject,
+                                                     text_len, offset, match_options, match_data, match_context);
+            }
+            if (rc == PCRE2_ERROR_JIT_STACKLIMIT) // JIT 栈仍不足时用解释器重试
+                rc = pcre2_match(node->config.split.regex_compiled,
+                                 (PCRE2_SPTR)subject, text_len, offset, match_options | PCRE2_NO_JIT,
+                                 match_data, match_context);
+            match_options = PCRE2_NO_UTF_CHECK;
+            if (rc < 0)
+            {
+                // 不匹配或出错 (含达到回溯上限) 时停止匹配，剩余文本整体作为一个块
+                if (rc == PCRE2_ERROR_MATCHLIMIT || rc == PCRE2_ERROR_DEPTHLIMIT || rc == PCRE2_ERROR_HEAPLIMIT)
+                    STATS_ADD(ws, regex_limit_hits, 1);
+                break;
+            }
+
+            // 处理空匹配（返回 0 表示匹配了空字符串）
+            if (rc == 0)
+            {
+                // 空匹配，推进一个字符以避免无限循环 (新偏移可能落在字符中间，下次需重新校验)
+                offset++;
+                match_options = 0;
+                continue;
+            }
+
+            PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(match_data);
+            PCRE2_SIZE start = ovector[0];
+            PCRE2_SIZE end = ovector[1];
+
+            // 保存匹配前的内容
+            if (start > last_end)
+            {
+                status = pre_tokenized_push_virtual(&ws->allocator, out, in, last_end, start);
+                if (status != BBPE_OK)
+                    goto done;
+            }
+
+            // 保存匹配到的部分本身
+            status = pre_tokenized_push_virtual(&ws->allocator, out, in, start, end);
+            if (status != BBPE_OK)
+                goto done;
+
+            last_end = end;
+            offset = end;
+            if (start == end) // 避免无限循环
+            {
+                offset++;
+                match_options = 0;
+            }
+        }
+
+        // 处理剩余文本
+        if (last_end < text_len)
+        {
+            status = pre_tokenized_push_virtual(&ws->allocator, out, in, last_end, text_len);
+            if (status != BBPE_OK)
+                goto done;
+        }
+
+        // 如果没有产生任何块（例如正则不匹配），则返回原文本作为一个块
+        if (out->count == first)
+            status = pre_tokenized_push(&ws->allocator, out, in->offset, in->len, in->prefix_spaces);
+
+    done:
+        return status;
+    }
+    // 如果类型不匹配或缺少编译好的正则，返回空结果（但通常不会发生）
+    return BBPE_OK;
+}
+
+/**
+ * @brief 将超过长度上限的块在 UTF-8 字符边界处切成多段，前缀空格保留在第一段
+ * @param text 原始文本 (所有区间均相对于它)
+ * @param max_len 块的最大字节数 (含前缀空格)
+ * @param in 输入预分词结果
+ * @param ws 工作区 (记录统计，提供分配器)
+ * @param out 输出预分词结果 (追加)
+ * @return BBPEStatus
+ * @note 切分只取决于块本身的内容，因此整段与分窗口预分词得到的结果相同；上限小于一个字符时按字节切开
+ */
+static BBPEStatus pre_tokenized_limit(const char *text, size_t max_len, const PreTokenizedResult *in,
+                                      BBPEWorkspace *ws, PreTokenizedResult *out)
+{
+    for (size_t i = 0; i < in->count; i++)
+    {
+        const ChunkSpan *span = &in->spans[i];
+        size_t offset = span->offset;
+        size_t remaining = span->len;
+        size_t prefix_spaces = span->prefix_spaces;
+        if (remaining + prefix_spaces > max_len)
+            STATS_ADD(ws, chunk_splits, 1);
+        do
+        {
+            size_t budget = max_len > prefix_spaces ? max_len - prefix_spaces : 1;
+            size_t take = budget < remaining ? budget : remaining;
+            size_t cut = take;
+            while (cut > 0 && cut < remaining && ((uint8_t)text[offset + cut] & 0xC0) == 0x80)
+                cut--;
+            if (cut == 0)
+                cut = take;
+            BBPEStatus status = pre_tokenized_push(&ws->allocator, out, offset, cut, prefix_spaces);
+            if (status != BBPE_OK)
+                return status;
+            offset += cut;
+            remaining -= cut;
+            prefix_spaces = 0;
+        } while (remaining > 0);
+    }
+    return BBPE_OK;
+}
+
+/**
+ * @brief 对文本执行完整的预分词链
+ * @param tok 分词器句柄
+ * @param ws 工作区 (结果存放在其交替缓冲区中)
+ * @param text 输入文本 (无需以 '\0' 结尾)
+ * @param len 输入文本字节数
+ * @param out 输出预分词结果，各块均为 text 中的区间；指向工作区内部，下次预分词前有效
+ * @return BBPEStatus
+ */
+PROFILE_NOINLINE
+static BBPEStatus pre_tokenize(BBPETokenizer *tok, BBPEWorkspace *ws, const char *text, size_t len,
+                               const PreTokenizedResult **out)
+{
+    PreTokenizedResult *current = &ws->spans[0];
+    PreTokenizedResult *next = &ws->spans[1];
+    current->count = 0;
+    BBPEStatus status = pre_tokenized_push(&ws->allocator, current, 0, len, 0);
+    if (status != BBPE_OK)
+        return status;
+
+    PreTokenizerNode *node = tok->pre_tokenizers;
+    for (; node; node = node->next)
+    {
+        // 不添加前缀空格的 ByteLevel 原样输出各块，跳过以免逐块复制
+        if (node->type == PRE_TOKENIZER_BYTE_LEVEL && !node->config.byte_level.add_prefix_space)
+            continue;
+        next->count = 0;
+        for (size_t i = 0; i < current->count; i++)
+        {
+            status = apply_single_pre_tokenizer(node, &tok->limits, text, &current->spans[i], ws, next);
+            if (status != BBPE_OK)
+                return status;
+        }
+
+        // 交换两个缓冲区，旧缓冲区的容量留给下一轮复用
+        PreTokenizedResult *tmp = current;
+        current = next;
+        next = tmp;
+    }
+
+    // 超长块按上限切开，没有超长块时不复制
+    size_t max_len = tok->limits.max_chunk_len;
+    for (size_t i = 0; max_len > 0 && i < current->count; i++)
+    {
+        if (current->spans[i].len + current->spans[i].prefix_spaces > max_len)
+        {
+            next->count = 0;
+            status = pre_tokenized_limit(text, max_len, current, ws, next);
+            if (status != BBPE_OK)
+                return status;
+            current = next;
+            break;
+        }
+    }
+
+    *out = current;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 判断预分词链能否从任一切分点重新开始 (截断编码据此分窗口预分词)
+ * @param tok 分词器句柄
+ * @return 1 表示链中恰有一个由内置分割器处理的 Split，且其前没有添加前缀空格的 ByteLevel
+ * @note 内置分割器的匹配只向后读取，从某个块的起点重新切分，其后的结果与整体切分相同
+ */
+static int pre_tokenizer_restartable(const BBPETokenizer *tok)
+{
+    int splits = 0;
+    for (const PreTokenizerNode *node = tok->pre_tokenizers; node; node = node->next)
+    {
+        if (node->type == PRE_TOKENIZER_REGEX_SPLIT)
+        {
+            if (!node->config.split.fast_digits || ++splits > 1)
+                return 0;
+        }
+        else if (node->type == PRE_TOKENIZER_BYTE_LEVEL && node->config.byte_level.add_prefix_space && !splits)
+            return 0; // 前缀空格只加在整段开头，窗口起点处不能重复添加
+    }
+    return splits == 1;
+}
+
+/**
+ * @brief 判断 q 是否为安全的窗口切分点：前一字符是字母，q 处字符不是
+ * @param tok 文本尚未规范化时为分词器句柄 (两侧字符还须在规范化链下独立)，已规范化时为 NULL
+ * @param s 已校验的 UTF-8 文本
+ * @param len 文本字节数
+ * @param q 候选位置
+ * @return 1 表示在 q 处切开后分别切分，结果与整体切分相同
+ * @note 起点在 q 之前的各分支中只有字母串会读到 q，且它在 q 处结束与在文本末尾结束的效果相同；
+ *       两侧字符独立时，切开后分别规范化的结果拼接起来与整体规范化相同，且这两个字符保持不变
+ */
+static int split_cut_ok(const BBPETokenizer *tok, const uint8_t *s, size_t len, size_t q)
+{
+    if (q == 0 || q >= len || (s[q] & 0xC0) == 0x80)
+        return 0;
+    size_t p = q - 1;
+    while (p > 0 && (s[p] & 0xC0) == 0x80)
+        p--;
+    FastChar prev = fast_char_at(s, len, p);
+    FastChar next = fast_char_at(s, len, q);
+    if (prev.cls != BBPE_UCLASS_LETTER || next.cls == BBPE_UCLASS_LETTER)
+        return 0;
+    return !tok || !tok->normalizers || (normalizer_char_inert(tok, prev.cp) && normalizer_char_inert(tok, next.cp));
+}
+
+/**
+ * @brief 在 (lo, hi) 内寻找距 target 最近的安全切分点
+ * @param tok 同 split_cut_ok
+ * @param s 已校验的 UTF-8 文本
+ * @param len 文本字节数
+ * @param lo 区间起点
+ * @param hi 区间终点
+ * @param target 目标位置 (lo < target < hi)
+ * @param forward 1 表示向 hi 方向寻找，找不到时返回 hi；0 表示向 lo 方向寻找，找不到时返回 lo
+ */
+static size_t split_find_cut(const BBPETokenizer *tok, const uint8_t *s, size_t len, size_t lo, size_t hi,
+                             size_t target, int forward)
+{
+    if (forward)
+    {
+        for (size_t q = target; q < hi; q++)
+            if (split_cut_ok(tok, s, len, q))
+                return q;
+        return hi;
+    }
+    for (size_t q = target; q > lo; q--)
+        if (split_cut_ok(tok, s, len, q))
+            return q;
+    return lo;
+}
+
+// ============================================================================
+// 合并规则查找
+// ============================================================================
+
+/**
+ * @brief 合并规则键的哈希 (乘法散列，取高位混入低位)
+ */
+static inline uint64_t merge_pair_hash(uint64_t key)
+{
+    key *= 0x9E3779B97F4A7C15ull;
+    return key ^ (key >> 29);
+}
+
+/**
+ * @brief 由规则行构建合并规则哈希表 (负载因子不超过 3/4)
+ * @param tok 分词器句柄
+ * @return BBPEStatus
+ * @note 重复的 (left, right) 只保留第一次出现的规则
+ */
+static BBPEStatus build_merge_pairs(BBPETokenizer *tok)
+{
+    size_t total = tok->rule_start ? tok->rule_start[tok->vocab_size] : 0;
+
+    size_t slot_count = 16;
+    while (slot_count - slot_count / 4 < total)
+    {
+        if (slot_count > SIZE_MAX / (2 * sizeof(MergePairSlot)))
+            return BBPE_ERR_MEMORY;
+        slot_count *= 2;
+    }
+    MergePairSlot *slots = (MergePairSlot *)mem_alloc(&tok->allocator, slot_count * sizeof(MergePairSlot));
+    if (!slots)
+        return BBPE_ERR_MEMORY;
+    for (size_t i = 0; i < slot_count; i++)
+        slots[i].key = MERGE_PAIR_EMPTY;
+
+    uint64_t mask = slot_count - 1;
+    for (uint32_t left = 0; tok->rule_start && left < tok->vocab_size; left++)
+    {
+        for (uint32_t j = tok->rule_start[left]; j < tok->rule_start[left + 1]; j++)
+        {
+            MergeRuleItem item = tok->rule_items[j];
+            uint64_t key = ((uint64_t)left << 32) | (uint32_t)rule_item_right(item);
+            uint64_t idx = merge_pair_hash(key) & mask;
+            while (slots[idx].key != MERGE_PAIR_EMPTY && slots[idx].key != key)
+                idx = (idx + 1) & mask;
+            if (slots[idx].key == key)
+                continue;
+            slots[idx].key = key;
+            slots[idx].new_id = rule_item_new_id(item);
+            slots[idx].priority = rule_item_priority(item);
+        }
+    }
+
+    mem_free(&tok->allocator, tok->merge_pairs);
+    tok->merge_pairs = slots;
+    tok->merge_pair_mask = mask;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 在给定的规则表中查找 left+right 的合并规则
+ * @param rule_start 规则行起点 (vocab_size + 1 项)，NULL 表示没有规则
+ * @param rule_items 规则项
+ * @param merge_pairs 合并规则哈希表，非 NULL 时优先使用
+ * @param merge_pair_mask 哈希表槽位数 - 1
+ * @param vocab_size 词汇表大小
+ * @param left 左 token ID
+ * @param right 右 token ID
+ * @param out_new_id 输出合并后的新 token ID
+ * @param out_priority 输出规则优先级
+ * @return 1 表示找到规则，0 表示未找到
+ * @note 分词器自身的表与 NUMA 副本共用此查找
+ */
+static inline int find_merge_rule_in(const uint32_t *rule_start, const MergeRuleItem *rule_items,
+                                     const MergePairSlot *merge_pairs, uint64_t merge_pair_mask, uint32_t vocab_size,
+                                     int32_t left, int32_t right, int32_t *out_new_id, int32_t *out_priority)
+{
+    if (merge_pairs)
+    {
+        // 哈希索引：按打包键线性探测
+        uint64_t key = ((uint64_t)(uint32_t)left << 32) | (uint32_t)right;
+        uint64_t idx = merge_pair_hash(key) & merge_pair_mask;
+        while (merge_pairs[idx].key != MERGE_PAIR_EMPTY)
+        {
+            if (merge_pairs[idx].key == key)
+            {
+                *out_new_id = merge_pairs[idx].new_id;
+                *out_priority = merge_pairs[idx].priority;
+                return 1;
+            }
+            idx = (idx + 1) & merge_pair_mask;
+        }
+        return 0;
+    }
+
+    if (!rule_start)
+        return 0;
+    if (left < 0 || (uint32_t)left >= vocab_size || right < 0 || (uint32_t)right >= RULE_ID_LIMIT)
+        return 0;
+    const MergeRuleItem *items = rule_items + rule_start[left];
+    uint32_t count = rule_start[left + 1] - rule_start[left];
+    if (count == 0)
+        return 0;
+
+    // 二分查找 right_id (位于规则项的最高位)
+    uint64_t target = (uint64_t)right;
+    int lo = 0, hi = (int)count - 1;
+    while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        uint64_t mid_right = items[mid] >> RULE_RIGHT_SHIFT;
+        if (mid_right == target)
+        {
+            *out_new_id = rule_item_new_id(items[mid]);
+            *out_priority = rule_item_priority(items[mid]);
+            return 1;
+        }
+        else if (mid_right < target)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 查找是否存在 left+right 的合并规则
+ * @param tok 分词器句柄
+ * @param left 左 token ID
+ * @param right 右 token ID
+ * @param out_new_id 输出合并后的新 token ID
+ * @param out_priority 输出规则优先级
+ * @return 1 表示找到规则，0 表示未找到
+ */
+PROFILE_NOINLINE
+static int find_merge_rule(BBPETokenizer *tok, int32_t left, int32_t right,
+                           int32_t *out_new_id, int32_t *out_priority)
+{
+    return find_merge_rule_in(tok->rule_start, tok->rule_items, tok->merge_pairs, tok->merge_pair_mask,
+                              tok->vocab_size, left, right, out_new_id, out_priority);
+}
+
+/**
+ * @brief 编码路径上的合并规则查找 (同 find_merge_rule，并计入统计)
+ * @note 工作区绑定了 NUMA 副本时查本节点的副本
+ */
+static inline int lookup_merge_rule(BBPETokenizer *tok, BBPEWorkspace *ws, int32_t left, int32_t right,
+                                    int32_t *out_new_id, int32_t *out_priority)
+{
+#ifdef BBPE_NUMA
+    const TableReplica *replica = ws->replica;
+    int found = replica ? find_merge_rule_in(replica->rule_start, replica->rule_items, replica->merge_pairs,
+                                             tok->merge_pair_mask, tok->vocab_size, left, right, out_new_id,
+                                             out_priority)
+                        : find_merge_rule(tok, left, right, out_new_id, out_priority);
+#else
+    int found = find_merge_rule(tok, left, right, out_new_id, out_priority);
+#endif
+    STATS_ADD(ws, rule_lookups, 1);
+    STATS_ADD(ws, rule_hits, found);
+    return found;
+}
+
+/**
+ * @brief 编码路径使用的单字节 → token ID 表 (工作区绑定了 NUMA 副本时为本节点的副本)
+ */
+static inline const int32_t *chunk_byte_to_id(const BBPETokenizer *tok, const BBPEWorkspace *ws)
+{
+#ifdef BBPE_NUMA
+    if (ws->replica)
+        return ws->replica->byte_to_id;
+#else
+    (void)ws;
+#endif
+    return tok->byte_to_id;
+}
+
+// ============================================================================
+// 优先队列（最小堆）辅助函数（修正：比较优先级和左节点位置）
+// ============================================================================
+
+/**
+ * @brief 交换两个堆元素
+ */
+static void heap_swap(HeapItem *a, HeapItem *b)
+{
+    HeapItem tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/**
+ * @brief 比较两个堆元素，若 a 应排在 b 前面则返回 1（即 a 优先级更小或优先级相同且左节点位置更小）
+ */
+static int heap_item_less(HeapItem *a, HeapItem *b)
+{
+    if (a->priority != b->priority)
+        return a->priority < b->priority;
+    // 优先级相同，比较左节点在原始序列中的位置（位置小的代表更左边）
+    return a->pos < b->pos;
+}
+
+/**
+ * @brief 上浮操作
+ */
+PROFILE_NOINLINE
+static void heap_up(MinHeap *heap, int idx)
+{
+    while (idx > 0)
+    {
+        int parent = (idx - 1) / 2;
+        if (heap_item_less(&heap->items[parent], &heap->items[idx]))
+            break; // 父节点已经更小，无需交换
+        heap_swap(&heap->items[parent], &heap->items[idx]);
+        idx = parent;
+    }
+}
+
+/**
+ * @brief 下沉操作
+ */
+PROFILE_NOINLINE
+static void heap_down(MinHeap *heap, int idx)
+{
+    int size = heap->size;
+    while (1)
+    {
+        int left = 2 * idx + 1;
+        int right = 2 * idx + 2;
+        int smallest = idx;
+
+        if (left < size && heap_item_less(&heap->items[left], &heap->items[smallest]))
+            smallest = left;
+        if (right < size && heap_item_less(&heap->items[right], &heap->items[smallest]))
+            smallest = right;
+
+        if (smallest == idx)
+            break;
+
+        heap_swap(&heap->items[idx], &heap->items[smallest]);
+        idx = smallest;
+    }
+}
+
+/**
+ * @brief 向堆中插入一个元素
+ * @return BBPE_OK 成功，BBPE_ERR_MEMORY 内存不足
+ */
+static int heap_push(const BBPEAllocator *a, MinHeap *heap, HeapItem item)
+{
+    if (heap->size >= heap->capacity)
+    {
+        // 检查容量乘法是否溢出
+        if (heap->capacity > SIZE_MAX / (2 * sizeof(HeapItem)))
+            return BBPE_ERR_MEMORY;
+        int new_cap = heap->capacity * 2;
+        HeapItem *new_items = (HeapItem *)mem_realloc(a, heap->items, sizeof(HeapItem) * new_cap);
+        if (!new_items)
+            return BBPE_ERR_MEMORY;
+        heap->items = new_items;
+        heap->capacity = new_cap;
+    }
+    heap->items[heap->size] = item;
+    heap_up(heap, heap->size);
+    heap->size++;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 从堆顶弹出一个元素
+ * @return 弹出元素，若堆为空则返回的 priority 为 INT32_MAX
+ */
+static HeapItem heap_pop(MinHeap *heap)
+{
+    HeapItem top = {0};
+    if (heap->size == 0)
+    {
+        top.priority = INT32_MAX; // 标记无效
+        return top;
+    }
+    top = heap->items[0];
+    heap->size--;
+    if (heap->size > 0)
+    {
+        heap->items[0] = heap->items[heap->size];
+        heap_down(heap, 0);
+    }
+    return top;
+}
+
+// ============================================================================
+// 基数堆 (长文本块的合并候选队列)
+// ============================================================================
+
+/**
+ * @brief 返回表示 x 所需的位数 (最高位 1 的序号加 1)，x 为 0 时返回 0
+ */
+static inline int bit_width64(uint64_t x)
+{
+    if (x == 0)
+        return 0;
+#if defined(__GNUC__) || defined(__clang__)
+    return 64 - __builtin_clzll(x);
+#else
+    int width = 0;
+    while (x >> width)
+        width++;
+    return width;
+#endif
+}
+
+/**
+ * @brief 返回 x 最低位 1 的序号 (x 不为 0)
+ */
+static inline int lowest_bit64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    int index = 0;
+    while (!(x & 1))
+    {
+        x >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief 按当前 last 计算 key 所在的桶 (key 不小于 last)
+ */
+static inline int radix_bucket(const RadixQueue *q, uint64_t key)
+{
+    return bit_width64(key ^ q->last);
+}
+
+/**
+ * @brief 把节点 i 的候选 (键已写入 keys[i]) 放入所在桶的首部
+ */
+static inline void radix_link(RadixQueue *q, int32_t i)
+{
+    int b = radix_bucket(q, q->keys[i]);
+    int32_t head = q->heads[b];
+    q->next[i] = head;
+    q->prev[i] = -1;
+    if (head >= 0)
+        q->prev[head] = i;
+    q->heads[b] = i;
+    if (b > 0)
+        q->occupied |= (uint64_t)1 << (b - 1);
+}
+
+/**
+ * @brief 把节点 i 的候选从所在桶中摘下 (不在队列中时不做任何事)
+ * @note 未参与重新分桶的元素与新 last 的最高不同位不变，因此所在桶可由键重新算出
+ */
+static inline void radix_unlink(RadixQueue *q, int32_t i)
+{
+    int32_t prev = q->prev[i], next = q->next[i];
+    if (prev == RADIX_DETACHED)
+        return;
+    int b = radix_bucket(q, q->keys[i]);
+    if (prev >= 0)
+        q->next[prev] = next;
+    else
+        q->heads[b] = next;
+    if (next >= 0)
+        q->prev[next] = prev;
+    if (b > 0 && q->heads[b] < 0)
+        q->occupied &= ~((uint64_t)1 << (b - 1));
+    q->prev[i] = RADIX_DETACHED;
+}
+
+/**
+ * @brief 弹出键最小的候选
+ * @param q 基数堆
+ * @param out_pos 输出候选的左节点下标
+ * @return 1 成功，0 队列为空
+ * @note 桶 0 为空时取最低的非空桶，以其中最小的键为新的 last 并把该桶元素重新分到更低的桶；
+ *       每个元素每次重新分桶都落入更低的桶，总代价摊还为每个元素至多 64 次
+ */
+static int radix_pop(RadixQueue *q, int32_t *out_pos)
+{
+    if (q->heads[0] < 0)
+    {
+        if (!q->occupied)
+            return 0;
+        int b = lowest_bit64(q->occupied) + 1;
+        int32_t head = q->heads[b];
+        uint64_t min_key = q->keys[head];
+        for (int32_t i = q->next[head]; i >= 0; i = q->next[i])
+            if (q->keys[i] < min_key)
+                min_key = q->keys[i];
+        q->heads[b] = -1;
+        q->occupied &= ~((uint64_t)1 << (b - 1));
+        q->last = min_key;
+        for (int32_t i = head, next; i >= 0; i = next)
+        {
+            next = q->next[i];
+            radix_link(q, i);
+        }
+    }
+    // 每个节点至多一个候选且键含节点位置，桶 0 中恰有一个元素
+    int32_t i = q->heads[0];
+    radix_unlink(q, i);
+    *out_pos = i;
+    return 1;
+}
+
+// ============================================================================
+// 词级结果缓存
+// ============================================================================
+
+/**
+ * @brief 清空词级缓存中的所有条目 (不改变容量设置)
+ * @param tok 分词器句柄 (提供分配器)
+ * @param cache 缓存表头 (分词器的缓存或某个 NUMA 副本的缓存)
+ */
+static void word_cache_clear(BBPETokenizer *tok, WordCacheEntry **cache)
+{
+    const BBPEAllocator *cache_allocator = &tok->allocator;
+    WordCacheEntry *cur, *tmp;
+    HASH_ITER(hh, *cache, cur, tmp)
+    {
+        HASH_DEL(*cache, cur);
+        mem_free(cache_allocator, cur);
+    }
+}
+
+/**
+ * @brief 在词级缓存中查找文本块
+ * @param tok 分词器句柄 (提供分配器与淘汰策略)
+ * @param cache 缓存表头
+ * @param chunk 文本块字节
+ * @param len 文本块字节数
+ * @return 命中的缓存项，未命中返回 NULL
+ */
+PROFILE_NOINLINE
+static WordCacheEntry *word_cache_lookup(BBPETokenizer *tok, WordCacheEntry **cache, const char *chunk, size_t len)
+{
+    const BBPEAllocator *cache_allocator = &tok->allocator;
+    WordCacheEntry *entry = NULL;
+    HASH_FIND(hh, *cache, chunk, len, entry);
+    if (entry && tok->cache_policy == BBPE_CACHE_LRU)
+    {
+        // LRU：命中后移到表尾，表头始终是最久未使用的条目
+        HASH_DELETE(hh, *cache, entry);
+        HASH_ADD_KEYPTR(hh, *cache, entry->key, entry->key_len, entry);
+    }
+    return entry;
+}
+
+/**
+ * @brief 将文本块的编码结果写入词级缓存，容量已满时先淘汰表头条目
+ * @param tok 分词器句柄 (提供分配器与容量)
+ * @param cache 缓存表头
+ * @param chunk 文本块字节
+ * @param len 文本块字节数
+ * @param ids 编码结果
+ * @param count ID 数量
+ * @note 内存不足时静默放弃缓存，不影响编码结果
+ */
+static void word_cache_insert(BBPETokenizer *tok, WordCacheEntry **cache, const char *chunk, size_t len,
+                              const int32_t *ids, size_t count)
+{
+    const BBPEAllocator *cache_allocator = &tok->allocator;
+    while (HASH_COUNT(*cache) >= tok->cache_capacity && *cache)
+    {
+        WordCacheEntry *oldest = *cache;
+        HASH_DEL(*cache, oldest);
+        mem_free(cache_allocator, oldest);
+    }
+
+    WordCacheEntry *entry =
+        (WordCacheEntry *)mem_alloc(cache_allocator, sizeof(WordCacheEntry) + count * sizeof(int32_t) + len);
+    if (!entry)
+        return;
+    entry->ids = (int32_t *)(entry + 1);
+    memcpy(entry->ids, ids, count * sizeof(int32_t));
+    entry->count = (uint32_t)count;
+    char *key = (char *)(entry->ids + count);
+    memcpy(key, chunk, len);
+    entry->key = key;
+    entry->key_len = len;
+    HASH_ADD_KEYPTR(hh, *cache, entry->key, entry->key_len, entry);
+}
+
+/**
+ * @brief 编码路径使用的词级缓存：工作区绑定了 NUMA 副本时为本节点的缓存，否则为分词器的缓存
+ * @param tok 分词器句柄
+ * @param ws 工作区
+ * @param out_lock 输出保护该缓存的锁
+ * @return 缓存表头
+ */
+static inline WordCacheEntry **chunk_cache(BBPETokenizer *tok, BBPEWorkspace *ws, bbpe_mutex_t **out_lock)
+{
+#ifdef BBPE_NUMA
+    if (ws->replica)
+    {
+        *out_lock = &ws->replica->cache_lock;
+        return &ws->replica->word_cache;
+    }
+#else
+    (void)ws;
+#endif
+    *out_lock = &tok->cache_lock;
+    return &tok->word_cache;
+}
+
+// ============================================================================
+// 编码输出缓冲区
+// ============================================================================
+
+/**
+ * @brief 为即将追加的 n 个 ID 预留空间
+ * @param sink 输出目标
+ * @param n 待追加的 ID 数
+ * @param out_dst 输出写入位置；固定缓冲区已满时为 NULL
+ * @param out_room 输出可写入的 ID 数 (固定缓冲区剩余空间不足时小于 n，超出部分只计数)
+ * @return BBPEStatus
+ * @note 成功后调用者写入前 *out_room 个并自行将 count 增加 n
+ */
+static BBPEStatus sink_reserve(IdSink *sink, size_t n, int32_t **out_dst, size_t *out_room)
+{
+    *out_dst = NULL;
+    *out_room = 0;
+    if (n > SIZE_MAX - sink->count)
+        return BBPE_ERR_MEMORY;
+    size_t needed = sink->count + n;
+    if (needed > sink->capacity)
+    {
+        if (!sink->growable)
+        {
+            if (sink->count < sink->capacity)
+            {
+                *out_dst = sink->ids + sink->count;
+                *out_room = sink->capacity - sink->count;
+            }
+            return BBPE_OK;
+        }
+        size_t new_cap = sink->capacity ? sink->capacity : 16;
+        while (new_cap < needed)
+        {
+            if (new_cap > SIZE_MAX / (2 * sizeof(int32_t)))
+                return BBPE_ERR_MEMORY;
+            new_cap *= 2;
+        }
+        int32_t *new_ids = (int32_t *)realloc(sink->ids, new_cap * sizeof(int32_t));
+        if (!new_ids)
+            return BBPE_ERR_MEMORY;
+        sink->ids = new_ids;
+        sink->capacity = new_cap;
+    }
+    *out_dst = sink->ids + sink->count;
+    *out_room = n;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 向输出目标追加一组 ID
+ * @return BBPEStatus
+ */
+static BBPEStatus sink_push(IdSink *sink, const int32_t *ids, size_t n)
+{
+    int32_t *dst;
+    size_t room;
+    BBPEStatus status = sink_reserve(sink, n, &dst, &room);
+    if (status != BBPE_OK)
+        return status;
+    if (room)
+        memcpy(dst, ids, room * sizeof(int32_t));
+    sink->count += n;
+    return BBPE_OK;
+}
+
+// ============================================================================
+// BPE 合并函数（使用优先队列优化，修正优先级相同问题）
+// ============================================================================
+
+/**
+ * @brief 整词直查：文本块映射后的字符串是稳定 token 时返回其 ID
+ * @param tok 分词器句柄 (stable_tokens 非 NULL)
+ * @param chunk 输入文本块 (无需以 '\0' 结尾)
+ * @param len 文本块字节数
+ * @param prefix_spaces 块前需补充的空格数
+ * @return 稳定 token 的 ID；块不在词汇表中、不稳定或超过 STABLE_TOKEN_MAX 时返回 -1
+ * @note 稳定 token 的字节串经合并恰好得到它自身，因此直接返回的结果与合并循环完全一致
+ */
+static int32_t stable_token_lookup(const BBPETokenizer *tok, const char *chunk, size_t len, size_t prefix_spaces)
+{
+    size_t count = len + prefix_spaces;
+    if (count > STABLE_TOKEN_MAX)
+        return -1;
+
+    // 字节级映射的码点都小于 0x800，每个字节至多 2 字节 UTF-8
+    char mapped[STABLE_TOKEN_MAX * 2];
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint8_t byte = i < prefix_spaces ? (uint8_t)' ' : (uint8_t)chunk[i - prefix_spaces];
+        const char *str = tok->byte_vocab_strs[byte];
+        mapped[n++] = str[0];
+        if (str[1])
+            mapped[n++] = str[1];
+    }
+    int32_t id = vocab_table_find(&tok->vocab, mapped, n);
+    if (id < 0 || !((tok->stable_tokens[(uint32_t)id >> 5] >> ((uint32_t)id & 31)) & 1))
+        return -1;
+    return id;
+}
+
+/**
+ * @brief 确保 ws->chunk_ends 能容纳本块全部 token 的终点
+ * @param ws 工作区
+ * @param count 本块 token 数
+ * @return BBPEStatus
+ */
+static BBPEStatus chunk_ends_reserve(BBPEWorkspace *ws, size_t count)
+{
+    return workspace_reserve(&ws->allocator, (void **)&ws->chunk_ends, &ws->chunk_end_capacity, count,
+                             sizeof(size_t));
+}
+
+/**
+ * @brief 短文本块的合并路径：栈上数组 + 线性扫描最小优先级对 + 原地压缩
+ * @param tok 分词器句柄
+ * @param chunk 输入文本块 (无需以 '\0' 结尾)
+ * @param len 文本块字节数
+ * @param prefix_spaces 块前需补充的空格数 (len + prefix_spaces 不超过 SMALL_CHUNK_MAX)
+ * @param cache_key 词级缓存键，为 NULL 时不写入缓存
+ * @param ws 工作区 (仅用于统计)
+ * @param sink 输出目标 (结果追加到末尾)
+ * @return BBPEStatus
+ * @note 每轮合并优先级最小的相邻对，优先级相同时取最左侧，与优先队列路径结果完全一致
+ */
+static BBPEStatus encode_small_chunk(BBPETokenizer *tok, const char *chunk, size_t len, size_t prefix_spaces,
+                                     const char *cache_key, BBPEWorkspace *ws, IdSink *sink)
+{
+    int32_t ids[SMALL_CHUNK_MAX];
+    int32_t pair_priority[SMALL_CHUNK_MAX]; // pair_priority[i] 对应 (ids[i], ids[i+1])，无规则时为 INT32_MAX
+    int32_t pair_new_id[SMALL_CHUNK_MAX];
+    uint8_t ends[SMALL_CHUNK_MAX]; // 需要字节区间时维护：ends[i] 为 ids[i] 在块内的终点
+    size_t count = len + prefix_spaces;
+    const int32_t *byte_to_id = chunk_byte_to_id(tok, ws);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uint8_t byte = i < prefix_spaces ? (uint8_t)' ' : (uint8_t)chunk[i - prefix_spaces];
+        ids[i] = byte_to_id[byte];
+        if (ids[i] < 0)
+            return BBPE_ERR_TOKEN_NOT_FOUND;
+        ends[i] = (uint8_t)(i + 1);
+    }
+    for (size_t i = 0; i + 1 < count; i++)
+    {
+        if (!lookup_merge_rule(tok, ws, ids[i], ids[i + 1], &pair_new_id[i], &pair_priority[i]))
+            pair_priority[i] = INT32_MAX;
+    }
+
+    while (count > 1)
+    {
+        size_t best = 0;
+        for (size_t i = 1; i + 1 < count; i++)
+        {
+            if (pair_priority[i] < pair_priority[best])
+                best = i;
+        }
+        if (pair_priority[best] == INT32_MAX)
+            break;
+
+        // 合并 best 与 best+1，后续元素整体左移一位
+        STATS_ADD(ws, merges, 1);
+        ids[best] = pair_new_id[best];
+        size_t tail = count - best - 2;
+        memmove(&ids[best + 1], &ids[best + 2], tail * sizeof(int32_t));
+        if (ws->track_ends)
+        {
+            ends[best] = ends[best + 1];
+            memmove(&ends[best + 1], &ends[best + 2], tail);
+        }
+        if (tail > 0)
+        {
+            memmove(&pair_priority[best + 1], &pair_priority[best + 2], (tail - 1) * sizeof(int32_t));
+            memmove(&pair_new_id[best + 1], &pair_new_id[best + 2], (tail - 1) * sizeof(int32_t));
+        }
+        count--;
+
+        // 仅重新计算与合并结果相邻的两个对
+        if (best > 0 && !lookup_merge_rule(tok, ws, ids[best - 1], ids[best], &pair_new_id[best - 1], &pair_priority[best - 1]))
+            pair_priority[best - 1] = INT32_MAX;
+        if (best + 1 < count && !lookup_merge_rule(tok, ws, ids[best], ids[best + 1], &pair_new_id[best], &pair_priority[best]))
+            pair_priority[best] = INT32_MAX;
+    }
+
+    int32_t *dst;
+    size_t room;
+    BBPEStatus status = sink_reserve(sink, count, &dst, &room);
+    if (status != BBPE_OK)
+        return status;
+    sink->count += count;
+    if (room)
+        memcpy(dst, ids, room * sizeof(int32_t));
+    if (ws->track_ends)
+    {
+        if ((status = chunk_ends_reserve(ws, count)) != BBPE_OK)
+            return status;
+        for (size_t i = 0; i < count; i++)
+            ws->chunk_ends[i] = ends[i];
+    }
+
+    if (cache_key)
+    {
+        bbpe_mutex_t *cache_lock;
+        WordCacheEntry **cache = chunk_cache(tok, ws, &cache_lock);
+        mutex_lock(cache_lock);
+        word_cache_insert(tok, cache, cache_key, len + prefix_spaces, ids, count);
+        mutex_unlock(cache_lock);
+    }
+    return BBPE_OK;
+}
+
+/**
+ * @brief 重新计算以 pos 为左节点的相邻对：可合并时更新候选记录并入堆，否则清除候选
+ * @param tok 分词器句柄
+ * @param ws 工作区 (提供合并候选堆)
+ * @param list 合并链表
+ * @param pos 左节点下标 (必须在链表中)
+ * @return BBPE_OK 成功，BBPE_ERR_MEMORY 堆扩容失败
+ */
+static BBPEStatus merge_list_update(BBPETokenizer *tok, BBPEWorkspace *ws, MergeList *list, int32_t pos)
+{
+    int32_t right = list->next[pos];
+    int32_t new_id, priority;
+    if (right < 0 || !lookup_merge_rule(tok, ws, list->ids[pos], list->ids[right], &new_id, &priority))
+    {
+        list->cand_priority[pos] = INT32_MAX;
+        return BBPE_OK;
+    }
+    list->cand_priority[pos] = priority;
+    list->cand_new_id[pos] = new_id;
+    HeapItem item = {priority, pos};
+    STATS_ADD(ws, heap_pushes, 1);
+    return (BBPEStatus)heap_push(&ws->allocator, &ws->heap, item);
+}
+
+/**
+ * @brief 基数堆版本的 merge_list_update：重新计算以 pos 为左节点的相邻对，原有候选先从队列中摘下
+ * @note 新候选的键小于上次弹出的键时只写入候选记录并置 q->violated，不入队
+ */
+static void merge_list_update_radix(BBPETokenizer *tok, BBPEWorkspace *ws, MergeList *list, RadixQueue *q,
+                                    int32_t pos)
+{
+    radix_unlink(q, pos);
+    int32_t right = list->next[pos];
+    int32_t new_id, priority;
+    if (right < 0 || !lookup_merge_rule(tok, ws, list->ids[pos], list->ids[right], &new_id, &priority))
+    {
+        list->cand_priority[pos] = INT32_MAX;
+        return;
+    }
+    list->cand_priority[pos] = priority;
+    list->cand_new_id[pos] = new_id;
+    uint64_t key = (uint64_t)(uint32_t)priority << 32 | (uint32_t)pos;
+    if (key < q->last)
+    {
+        q->violated = 1;
+        return;
+    }
+    q->keys[pos] = key;
+    radix_link(q, pos);
+}
+
+/**
+ * @brief 执行一次合并：left 与其后继合并为 cand_new_id[left]，后继从链表中移除
+ * @return 被移除的右节点下标
+ */
+static inline int32_t merge_list_apply(MergeList *list, int32_t left)
+{
+    int32_t right = list->next[left];
+    list->ids[left] = list->cand_new_id[left];
+    list->next[left] = list->next[right];
+    if (list->next[left] >= 0)
+        list->prev[list->next[left]] = left;
+    list->cand_priority[right] = INT32_MAX;
+    return right;
+}
+
+/**
+ * @brief 以基数堆完成合并链表上的全部合并
+ * @param tok 分词器句柄
+ * @param ws 工作区 (提供基数堆缓冲区)
+ * @param list 合并链表 (尚未计算候选)
+ * @param n 节点数
+ * @param out_done 输出：1 表示已合并完毕；0 表示遇到了比已弹出的键更小的候选 (规则表中某个 token
+ *                 可由多条规则得到时可能出现)，此时各存活节点的候选记录都是最新的，由调用者改用最小堆继续
+ * @return BBPE_OK 成功，BBPE_ERR_MEMORY 缓冲区分配失败
+ */
+PROFILE_NOINLINE
+static BBPEStatus merge_by_radix(BBPETokenizer *tok, BBPEWorkspace *ws, MergeList *list, int32_t n, int *out_done)
+{
+    *out_done = 0;
+    BBPEStatus status = workspace_reserve(&ws->allocator, (void **)&ws->radix, &ws->radix_capacity, 2 * (size_t)n,
+                                          sizeof(uint64_t));
+    if (status != BBPE_OK)
+        return status;
+    RadixQueue q;
+    q.keys = ws->radix;
+    q.next = (int32_t *)(ws->radix + n);
+    q.prev = q.next + n;
+    for (int b = 0; b < RADIX_BUCKETS; b++)
+        q.heads[b] = -1;
+    q.occupied = 0;
+    q.last = 0;
+    q.violated = 0;
+    for (int32_t i = 0; i < n; i++)
+        q.prev[i] = RADIX_DETACHED;
+    for (int32_t i = 0; i < n; i++)
+        merge_list_update_radix(tok, ws, list, &q, i);
+
+    int32_t left;
+    while (radix_pop(&q, &left))
+    {
+        STATS_ADD(ws, merges, 1);
+        // 右节点的候选 (以它为左节点的相邻对) 随之失效
+        radix_unlink(&q, list->next[left]);
+        merge_list_apply(list, left);
+        if (list->prev[left] >= 0)
+            merge_list_update_radix(tok, ws, list, &q, list->prev[left]);
+        merge_list_update_radix(tok, ws, list, &q, left);
+        if (q.violated)
+            return BBPE_OK;
+    }
+    *out_done = 1;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 以最小堆完成合并链表上的全部合并
+ * @param tok 分词器句柄
+ * @param ws 工作区 (提供合并候选堆)
+ * @param list 合并链表
+ * @param n 节点数
+ * @param resume 非 0 表示各存活节点的候选记录已是最新 (基数堆中途退出)，只需把它们入堆
+ * @return BBPE_OK 成功，BBPE_ERR_MEMORY 堆扩容失败
+ */
+PROFILE_NOINLINE
+static BBPEStatus merge_by_heap(BBPETokenizer *tok, BBPEWorkspace *ws, MergeList *list, int32_t n, int resume)
+{
+    // 重置工作区中的优先队列，容量至少为节点数
+    BBPEStatus status;
+    MinHeap *heap = &ws->heap;
+    heap->size = 0;
+    if (heap->capacity < n)
+    {
+        size_t heap_cap = (size_t)heap->capacity;
+        status = workspace_reserve(&ws->allocator, (void **)&heap->items, &heap_cap, (size_t)n, sizeof(HeapItem));
+        if (status != BBPE_OK)
+            return status;
+        heap->capacity = heap_cap > INT_MAX ? INT_MAX : (int)heap_cap;
+    }
+
+    // 将所有可能的相邻对插入堆
+    for (int32_t i = 0; i >= 0 && i < n; i = resume ? list->next[i] : i + 1)
+    {
+        if (resume)
+        {
+            if (list->cand_priority[i] == INT32_MAX)
+                continue;
+            HeapItem item = {list->cand_priority[i], i};
+            STATS_ADD(ws, heap_pushes, 1);
+            status = (BBPEStatus)heap_push(&ws->allocator, heap, item);
+        }
+        else
+            status = merge_list_update(tok, ws, list, i);
+        if (status != BBPE_OK)
+            return status;
+    }
+
+    // 主合并循环
+    while (heap->size > 0)
+    {
+        HeapItem best = heap_pop(heap);
+        STATS_ADD(ws, heap_pops, 1);
+
+        // 验证该对是否仍然有效：左节点已被移出或其相邻对已改变时，候选记录与堆元素不再一致
+        int32_t left = best.pos;
+        if (list->cand_priority[left] != best.priority)
+        {
+            STATS_ADD(ws, heap_stale_pops, 1);
+            continue;
+        }
+        STATS_ADD(ws, merges, 1);
+
+        // 执行合并：左节点复用，右节点从链表中移除，其堆中剩余的元素在弹出时丢弃
+        merge_list_apply(list, left);
+
+        // 重新计算新的左边对（left 的前驱与 left）与右边对（left 与 left 的后继）
+        if (list->prev[left] >= 0)
+        {
+            status = merge_list_update(tok, ws, list, list->prev[left]);
+            if (status != BBPE_OK)
+                return status;
+        }
+        status = merge_list_update(tok, ws, list, left);
+        if (status != BBPE_OK)
+            return status;
+    }
+    return BBPE_OK;
+}
+
+/**
+ * @brief 将单个文本块编码为 token IDs 并追加到输出结构
+ * @param tok 分词器句柄
+ * @param chunk 输入文本块 (无需以 '\0' 结尾)
+ * @param len 文本块字节数
+ * @param prefix_spaces 块前需补充的空格数
+ * @param ws 工作区 (提供节点与堆缓冲区)
+ * @param sink 输出目标 (结果追加到末尾)
+ * @return BBPEStatus
+ */
+PROFILE_NOINLINE
+static BBPEStatus encode_chunk(BBPETokenizer *tok, const char *chunk, size_t len, size_t prefix_spaces,
+                               BBPEWorkspace *ws, IdSink *sink)
+{
+    size_t chunk_len = len + prefix_spaces;
+    if (chunk_len == 0)
+        return BBPE_OK;
+#ifdef BBPE_ENABLE_STATS
+    int bucket = 0;
+    while (bucket + 1 < BBPE_STATS_HIST_BUCKETS && (chunk_len >> (bucket + 1)) != 0)
+        bucket++;
+    ws->stats.chunks++;
+    ws->stats.chunk_len_hist[bucket]++;
+#endif
+
+    // 整词直查：块本身是稳定 token 时直接输出，不经缓存与合并
+    if (tok->stable_tokens)
+    {
+        int32_t id = stable_token_lookup(tok, chunk, len, prefix_spaces);
+        if (id >= 0)
+        {
+            STATS_ADD(ws, stable_hits, 1);
+            if (ws->track_ends)
+            {
+                BBPEStatus status = chunk_ends_reserve(ws, 1);
+                if (status != BBPE_OK)
+                    return status;
+                ws->chunk_ends[0] = chunk_len;
+            }
+            return sink_push(sink, &id, 1);
+        }
+    }
+
+    // 0. 查询词级缓存，命中则直接追加缓存的 ID 序列 (缓存不记录各 token 的终点，需要字节区间时不使用)
+    int use_cache = tok->cache_capacity > 0 && chunk_len <= WORD_CACHE_MAX_KEY && !ws->track_ends;
+    const char *cache_key = chunk;
+    char key_buf[WORD_CACHE_MAX_KEY];
+    if (use_cache && prefix_spaces > 0)
+    {
+        memset(key_buf, ' ', prefix_spaces);
+        memcpy(key_buf + prefix_spaces, chunk, len);
+        cache_key = key_buf;
+    }
+    if (use_cache)
+    {
+        bbpe_mutex_t *cache_lock;
+        WordCacheEntry **cache = chunk_cache(tok, ws, &cache_lock);
+        mutex_lock(cache_lock);
+        WordCacheEntry *cached = word_cache_lookup(tok, cache, cache_key, chunk_len);
+        BBPEStatus hit_status = cached ? sink_push(sink, cached->ids, cached->count) : BBPE_OK;
+        mutex_unlock(cache_lock);
+        STATS_ADD(ws, cache_lookups, 1);
+        STATS_ADD(ws, cache_hits, cached != NULL);
+        if (cached)
+            return hit_status;
+    }
+
+    if (chunk_len <= SMALL_CHUNK_MAX)
+    {
+        STATS_ADD(ws, small_chunks, 1);
+        return encode_small_chunk(tok, chunk, len, prefix_spaces, use_cache ? cache_key : NULL, ws, sink);
+    }
+
+    if (chunk_len > INT_MAX || chunk_len > SIZE_MAX / MERGE_LIST_FIELDS)
+        return BBPE_ERR_INVALID_INPUT;
+
+    // 1. 从工作区取合并链表的各字段数组，建立以下标相连的双向链表
+    BBPEStatus status = workspace_reserve(&ws->allocator, (void **)&ws->nodes, &ws->node_capacity,
+                                          MERGE_LIST_FIELDS * chunk_len, sizeof(int32_t));
+    if (status != BBPE_OK)
+        return status;
+    int32_t n = (int32_t)chunk_len;
+    const int32_t *byte_to_id = chunk_byte_to_id(tok, ws);
+    MergeList list;
+    list.ids = ws->nodes;
+    list.prev = list.ids + n;
+    list.next = list.prev + n;
+    list.cand_priority = list.next + n;
+    list.cand_new_id = list.cand_priority + n;
+    for (int32_t i = 0; i < n; i++)
+    {
+        uint8_t byte = (size_t)i < prefix_spaces ? (uint8_t)' ' : (uint8_t)chunk[i - prefix_spaces];
+        int32_t byte_id = byte_to_id[byte];
+        if (byte_id < 0)
+        {
+            status = BBPE_ERR_TOKEN_NOT_FOUND;
+            goto cleanup;
+        }
+        list.ids[i] = byte_id;
+        list.prev[i] = i - 1;
+        list.next[i] = i + 1;
+    }
+    list.next[n - 1] = -1;
+
+    // 2. 合并：长块先用基数堆，遇到不单调的规则时改用最小堆从当前状态继续
+    int done = 0;
+    if (chunk_len >= RADIX_CHUNK_MIN)
+    {
+        STATS_ADD(ws, radix_chunks, 1);
+        status = merge_by_radix(tok, ws, &list, n, &done);
+        if (status != BBPE_OK)
+            goto cleanup;
+        STATS_ADD(ws, radix_fallbacks, !done);
+    }
+    if (!done)
+    {
+        status = merge_by_heap(tok, ws, &list, n, chunk_len >= RADIX_CHUNK_MIN);
+        if (status != BBPE_OK)
+            goto cleanup;
+    }
+
+    // 3. 收集结果：从链表头 (下标 0) 遍历所有存活节点的 ID
+    size_t token_count = 0;
+    for (int32_t i = 0; i >= 0; i = list.next[i])
+        token_count++;
+
+    // 4. 在输出目标中预留空间并填充 (固定缓冲区放不下时只计数)
+    int32_t *dst;
+    size_t room;
+    status = sink_reserve(sink, token_count, &dst, &room);
+    if (status != BBPE_OK)
+        goto cleanup;
+    sink->count += token_count;
+    size_t idx = 0;
+    for (int32_t i = 0; i >= 0 && idx < room; i = list.next[i])
+        dst[idx++] = list.ids[i];
+
+    // 需要字节区间时记录终点：节点下标即其在块内的起点，终点为下一个存活节点的下标
+    if (ws->track_ends)
+    {
+        if ((status = chunk_ends_reserve(ws, token_count)) != BBPE_OK)
+            goto cleanup;
+        idx = 0;
+        for (int32_t i = 0; i >= 0; i = list.next[i])
+            ws->chunk_ends[idx++] = list.next[i] >= 0 ? (size_t)list.next[i] : chunk_len;
+    }
+
+    // 5. 写入词级缓存 (结果未完整写入输出时，如仅计数，从链表收集)
+    if (use_cache)
+    {
+        const int32_t *cache_ids = dst;
+        int32_t collected[WORD_CACHE_MAX_KEY];
+        if (room < token_count)
+        {
+            idx = 0;
+            for (int32_t i = 0; i >= 0; i = list.next[i])
+                collected[idx++] = list.ids[i];
+            cache_ids = collected;
+        }
+        bbpe_mutex_t *cache_lock;
+        WordCacheEntry **cache = chunk_cache(tok, ws, &cache_lock);
+        mutex_lock(cache_lock);
+        word_cache_insert(tok, cache, cache_key, chunk_len, cache_ids, token_count);
+        mutex_unlock(cache_lock);
+    }
+
+cleanup:
+    return status;
+}
+
+// ============================================================================
+// 整词直查表 (稳定 token 位图)
+// ============================================================================
+
+/**
+ * @brief 判断单个 token 是否稳定：还原为字节串后按合并规则编码，结果恰为该 token
+ * @param tok 分词器句柄 (规则行已就绪，stable_tokens 为 NULL，词级缓存已暂停)
+ * @param id token ID
+ * @param ws 工作区
+ * @param out_stable 输出：非 0 表示稳定
+ * @return BBPEStatus 状态码 (仅内存不足时失败)
+ * @note 含字节级映射以外字符、超过 STABLE_TOKEN_MAX 字节的 token 与特殊 token 均视为不稳定
+ */
+static BBPEStatus stable_token_check(BBPETokenizer *tok, uint32_t id, BBPEWorkspace *ws, int *out_stable)
+{
+    *out_stable = 0;
+    uint32_t e = tok->id_to_entry[id];
+    if (e == ID_ENTRY_NONE || (e & ID_ENTRY_SPECIAL))
+        return BBPE_OK;
+
+    // 严格逆映射：每个字符都必须是某个字节的映射结果，查表时才能由块字节得到同一字符串
+    const VocabTable *vt = &tok->vocab;
+    const char *str = vt->pool + vt->offsets[e];
+    uint32_t str_len = vt->lengths[e];
+    char bytes[STABLE_TOKEN_MAX];
+    size_t n = 0;
+    uint32_t p = 0;
+    while (p < str_len && n < STABLE_TOKEN_MAX)
+    {
+        uint32_t cp;
+        int char_len = utf8_decode(str + p, &cp);
+        if (char_len < 0 || cp >= UNICODE_MAP_SIZE || tok->byte_to_unicode[tok->unicode_to_byte[cp]] != cp)
+            return BBPE_OK;
+        bytes[n++] = (char)tok->unicode_to_byte[cp];
+        p += (uint32_t)char_len;
+    }
+    if (p < str_len || n == 0)
+        return BBPE_OK;
+
+    int32_t ids[2];
+    IdSink sink = {ids, 0, 2, 0};
+    BBPEStatus status = encode_chunk(tok, bytes, n, 0, ws, &sink);
+    if (status == BBPE_ERR_TOKEN_NOT_FOUND)
+        return BBPE_OK; // 某个字节没有对应的 token：该 token 不可能由字节合并得到
+    *out_stable = status == BBPE_OK && sink.count == 1 && ids[0] == (int32_t)id;
+    return status;
+}
+
+/**
+ * @brief 并行计算稳定 token 位图的共享状态
+ */
+typedef struct
+{
+    BBPETokenizer *tok;  /* 分词器 (计算期间只读) */
+    uint32_t *bits;      /* 输出位图，各线程领取的 ID 区间按 32 对齐，互不共享字 */
+    uint32_t next;       /* 下一个待领取的 ID (受 lock 保护) */
+    BBPEStatus status;   /* 第一个错误 (受 lock 保护) */
+    bbpe_mutex_t lock;
+} StableTokensJob;
+
+/**
+ * @brief 计算稳定 token 的工作线程：每次领取 MERGE_RESOLVE_BLOCK 个 ID，使用线程私有的工作区
+ */
+static void stable_tokens_worker(void *arg)
+{
+    StableTokensJob *job = (StableTokensJob *)arg;
+    uint32_t vocab_size = job->tok->vocab_size;
+    BBPEWorkspace ws;
+    workspace_init(&ws, &job->tok->allocator);
+    for (;;)
+    {
+        mutex_lock(&job->lock);
+        uint32_t begin = job->next;
+        int stop = begin >= vocab_size || job->status != BBPE_OK;
+        if (!stop)
+            job->next = vocab_size - begin > MERGE_RESOLVE_BLOCK ? begin + MERGE_RESOLVE_BLOCK : vocab_size;
+        mutex_unlock(&job->lock);
+        if (stop)
+            break;
+
+        uint32_t end = vocab_size - begin > MERGE_RESOLVE_BLOCK ? begin + MERGE_RESOLVE_BLOCK : vocab_size;
+        BBPEStatus status = BBPE_OK;
+        for (uint32_t id = begin; id < end && status == BBPE_OK; id++)
+        {
+            int stable;
+            status = stable_token_check(job->tok, id, &ws, &stable);
+            if (stable)
+                job->bits[id >> 5] |= 1u << (id & 31);
+        }
+        if (status != BBPE_OK)
+        {
+            mutex_lock(&job->lock);
+            job->status = status;
+            mutex_unlock(&job->lock);
+        }
+    }
+    workspace_release(&ws);
+}
+
+/**
+ * @brief 计算稳定 token 位图 (按 CPU 核数多线程进行)
+ * @param tok 分词器句柄 (规则行已就绪，stable_tokens 为 NULL)
+ * @param out_bits 输出位图 ((vocab_size + 31) / 32 个字，经分词器的分配器分配，由调用者释放)
+ * @return BBPEStatus 状态码
+ * @note 计算期间暂停词级缓存，避免用词表条目挤掉调用者的缓存内容
+ */
+static BBPEStatus build_stable_tokens(BBPETokenizer *tok, uint32_t **out_bits)
+{
+    *out_bits = NULL;
+    uint32_t *bits = (uint32_t *)mem_calloc(&tok->allocator, ((size_t)tok->vocab_size + 31) / 32, sizeof(uint32_t));
+    if (!bits)
+        return BBPE_ERR_MEMORY;
+
+    StableTokensJob job;
+    job.tok = tok;
+    job.bits = bits;
+    job.next = 0;
+    job.status = BBPE_OK;
+    mutex_init(&job.lock);
+    size_t cache_capacity = tok->cache_capacity;
+    tok->cache_capacity = 0;
+    uint32_t blocks = (tok->vocab_size + MERGE_RESOLVE_BLOCK - 1) / MERGE_RESOLVE_BLOCK;
+    int threads = cpu_count();
+    run_parallel((uint32_t)threads < blocks ? threads : (int)blocks, stable_tokens_worker, &job);
+    tok->cache_capacity = cache_capacity;
+    mutex_destroy(&job.lock);
+    if (job.status != BBPE_OK)
+    {
+        mem_free(&tok->allocator, bits);
+        return job.status;
+    }
+    *out_bits = bits;
+    return BBPE_OK;
+}
+
+// ============================================================================
+// 预分词器与规范化器节点解析 (JSON)
+// ============================================================================
+
+/**
+ * @brief 为已有编译结果的 Split 节点选择匹配方式：识别标准模式，否则尽可能进行 JIT 编译
+ * @param node Split 类型的预分词器节点 (regex_pattern 与 regex_compiled 已设置)
+ * @note JIT 不可用 (未以 SUPPORT_JIT 构建，或平台禁止可执行内存) 时静默回退到解释执行
+ */
+static void prepare_split_regex(PreTokenizerNode *node)
+{
+    // 标准模式走内置分割器，无需 JIT；编译结果仍保留以校验模式合法性
+    node->config.split.fast_digits = detect_fast_split(node->config.split.regex_pattern);
+    if (!node->config.split.fast_digits)
+        node->config.split.jit = pcre2_jit_compile(node->config.split.regex_compiled, PCRE2_JIT_COMPLETE) == 0;
+}
+
+/**
+ * @brief 编译 Split 预分词器的正则，并尽可能进行 JIT 编译
+ * @param tok 分词器 (编译结果与 JIT 代码经其分配器分配)
+ * @param node Split 类型的预分词器节点 (regex_pattern 已设置)
+ * @return BBPEStatus
+ */
+static BBPEStatus compile_split_regex(BBPETokenizer *tok, PreTokenizerNode *node)
+{
+    pcre2_compile_context *context = NULL;
+    if (tok->pcre2_memory && !(context = pcre2_compile_context_create(tok->pcre2_memory)))
+        return BBPE_ERR_MEMORY;
+    int err;
+    PCRE2_SIZE err_off;
+    node->config.split.regex_compiled = pcre2_compile(
+        (PCRE2_SPTR)node->config.split.regex_pattern,
+        PCRE2_ZERO_TERMINATED, SPLIT_REGEX_OPTIONS, &err, &err_off, context);
+    pcre2_compile_context_free(context);
+    if (!node->config.split.regex_compiled)
+        return BBPE_ERR_REGEX_COMPILE;
+    prepare_split_regex(node);
+    return BBPE_OK;
+}
+
+/**
+ * @brief 为尚未编译的各 Split 节点设置正则：优先解码预编译结果，
+ *        未提供、数量或编译选项不一致、或与当前 PCRE2 版本/配置不兼容时按模式重新编译
+ * @param tok 分词器 (各 Split 节点的 regex_pattern 已设置)
+ * @param serialized pcre2_serialize_encode 的结果 (已校验完整性)，NULL 表示直接编译
+ * @return BBPEStatus
+ * @note 失败时已编译的节点保持不变，再次调用只处理其余节点
+ */
+static BBPEStatus install_split_regexes(BBPETokenizer *tok, const uint8_t *serialized)
+{
+    int32_t n = 0;
+    for (PreTokenizerNode *node = tok->pre_tokenizers; node; node = node->next)
+        n += node->type == PRE_TOKENIZER_REGEX_SPLIT && !node->config.split.regex_compiled;
+    if (n == 0)
+        return BBPE_OK;
+
+    pcre2_code **codes = NULL;
+    int decoded = 0;
+    if (serialized && pcre2_serialize_get_number_of_codes(serialized) == n)
+    {
+        codes = (pcre2_code **)mem_calloc(&tok->allocator, (size_t)n, sizeof(*codes));
+        if (!codes)
+            return BBPE_ERR_MEMORY;
+        decoded = pcre2_serialize_decode(codes, n, serialized, tok->pcre2_memory) == n;
+        for (int32_t i = 0; decoded && i < n; i++)
+        {
+            uint32_t options;
+            if (pcre2_pattern_info(codes[i], PCRE2_INFO_ARGOPTIONS, &options) != 0 || options != SPLIT_REGEX_OPTIONS)
+                decoded = 0;
+        }
+        if (!decoded)
+        {
+            for (int32_t i = 0; i < n; i++)
+                pcre2_code_free(codes[i]);
+        }
+    }
+
+    BBPEStatus status = BBPE_OK;
+    int32_t i = 0;
+    for (PreTokenizerNode *node = tok->pre_tokenizers; node && status == BBPE_OK; node = node->next)
+    {
+        if (node->type != PRE_TOKENIZER_REGEX_SPLIT || node->config.split.regex_compiled)
+            continue;
+        if (decoded)
+        {
+            node->config.split.regex_compiled = codes[i++];
+            prepare_split_regex(node);
+        }
+        else
+            status = compile_split_regex(tok, node);
+    }
+    mem_free(&tok->allocator, codes);
+    return status;
+}
+
+/**
+ * @brief 从 cJSON 对象解析单个预分词器节点
+ * @param tok 分词器 (节点经其分配器分配)
+ * @param obj JSON 对象
+ * @param compile 非 0 时立即编译 Split 正则，否则只保存模式 (由 install_split_regexes 稍后编译)
+ * @param status 输出解析状态
+ * @return 新分配的 PreTokenizerNode，失败返回 NULL
+ */
+static PreTokenizerNode *parse_pre_tokenizer_node(BBPETokenizer *tok, cJSON *obj, int compile, BBPEStatus *status)
+{
+    if (!obj)
+        return NULL;
+    cJSON *type = cJSON_GetObjectItem(obj, "type");
+    if (!type || !type->valuestring)
+    {
+        *status = BBPE_ERR_INVALID_INPUT;
+        return NULL;
+    }
+
+    PreTokenizerNode *node = (PreTokenizerNode *)mem_calloc(&tok->allocator, 1, sizeof(PreTokenizerNode));
+    if (!node)
+    {
+        *status = BBPE_ERR_MEMORY;
+        return NULL;
+    }
+
+    if (strcmp(type->valuestring, "ByteLevel") == 0)
+    {
+        node->type = PRE_TOKENIZER_BYTE_LEVEL;
+        cJSON *add_space = cJSON_GetObjectItem(obj, "add_prefix_space");
+        node->config.byte_level.add_prefix_space = (add_space && cJSON_IsTrue(add_space)) ? 1 : 0;
+    }
+    else if (strcmp(type->valuestring, "Split") == 0)
+    {
+        node->type = PRE_TOKENIZER_REGEX_SPLIT;
+        cJSON *pattern_obj = cJSON_GetObjectItem(obj, "pattern");
+        if (pattern_obj)
+        {
+            cJSON *regex = cJSON_GetObjectItem(pattern_obj, "Regex");
+            if (regex && regex->valuestring)
+            {
+                node->config.split.regex_pattern = mem_strdup(&tok->allocator, regex->valuestring);
+                if (!node->config.split.regex_pattern || (compile && compile_split_regex(tok, node) != BBPE_OK))
+                {
+                    mem_free(&tok->allocator, node->config.split.regex_pattern);
+                    mem_free(&tok->allocator, node);
+                    *status = BBPE_ERR_REGEX_COMPILE;
+                    return NULL;
+                }
+            }
+            else
+            {
+                mem_free(&tok->allocator, node);
+                *status = BBPE_ERR_INVALID_INPUT;
+                return NULL;
+            }
+        }
+        else
+        {
+            mem_free(&tok->allocator, node);
+            *status = BBPE_ERR_INVALID_INPUT;
+            return NULL;
+        }
+    }
+    else
+    {
+        mem_free(&tok->allocator, node);
+        *status = BBPE_ERR_UNSUPPORTED_TYPE;
+        return NULL;
+    }
+    return node;
+}
+
+/**
+ * @brief 释放规范化器链表
+ */
+static void normalizer_list_free(const BBPEAllocator *a, NormalizerNode *node)
+{
+    while (node)
+    {
+        NormalizerNode *next = node->next;
+        mem_free(a, node->pattern);
+        mem_free(a, node->content);
+        mem_free(a, node);
+        node = next;
+    }
+}
+
+/**
+ * @brief 分配一个规范化器节点并复制其字符串参数
+ * @param tok 分词器 (节点经其分配器分配)
+ * @param type 规范化器类型
+ * @param pattern Replace 的查找串，其他类型为 NULL
+ * @param pattern_len 查找串字节数
+ * @param content Replace 的替换串或 Prepend 的前缀，其他类型为 NULL
+ * @param content_len content 字节数
+ * @return 新节点，内存不足时返回 NULL
+ */
+static NormalizerNode *normalizer_node_new(BBPETokenizer *tok, NormalizerType type, const char *pattern,
+                                           size_t pattern_len, const char *content, size_t content_len)
+{
+    NormalizerNode *node = (NormalizerNode *)mem_calloc(&tok->allocator, 1, sizeof(NormalizerNode));
+    if (!node)
+        return NULL;
+    node->type = type;
+    node->pattern_len = pattern_len;
+    node->content_len = content_len;
+    if ((pattern && !(node->pattern = (char *)mem_alloc(&tok->allocator, pattern_len + 1))) ||
+        (content && !(node->content = (char *)mem_alloc(&tok->allocator, content_len + 1))))
+    {
+        normalizer_list_free(&tok->allocator, node);
+        return NULL;
+    }
+    if (pattern)
+    {
+        memcpy(node->pattern, pattern, pattern_len);
+        node->pattern[pattern_len] = '\0';
+    }
+    if (content)
+    {
+        memcpy(node->content, content, content_len);
+        node->content[content_len] = '\0';
+    }
+    return node;
+}
+
+/**
+ * @brief 从 cJSON 对象解析规范化器并追加到链表末尾 (Sequence 递归展开)
+ * @param tok 分词器 (节点经其分配器分配)
+ * @param obj JSON 对象，NULL 或 null 表示不规范化
+ * @param tail 链表末尾 next 指针的地址，追加后更新
+ * @return BBPEStatus (失败时已追加的节点仍在链表上，由调用者统一释放)
+ * @note 支持 NFC、NFD、NFKC、NFKD、Lowercase、Prepend，以及查找串为字符串的 Replace
+ */
+static BBPEStatus parse_normalizer(BBPETokenizer *tok, cJSON *obj, NormalizerNode ***tail)
+{
+    if (!obj || cJSON_IsNull(obj))
+        return BBPE_OK;
+    cJSON *type = cJSON_GetObjectItem(obj, "type");
+    if (!type || !type->valuestring)
+        return BBPE_ERR_INVALID_INPUT;
+
+    const char *name = type->valuestring;
+    if (strcmp(name, "Sequence") == 0)
+    {
+        cJSON *items = cJSON_GetObjectItem(obj, "normalizers");
+        if (!cJSON_IsArray(items))
+            return BBPE_ERR_INVALID_INPUT;
+        cJSON *item;
+        cJSON_ArrayForEach(item, items)
+        {
+            BBPEStatus status = parse_normalizer(tok, item, tail);
+            if (status != BBPE_OK)
+                return status;
+        }
+        return BBPE_OK;
+    }
+
+    static const struct
+    {
+        const char *name;
+        NormalizerType type;
+    } simple[] = {{"NFC", NORMALIZER_NFC},
+                  {"NFD", NORMALIZER_NFD},
+                  {"NFKC", NORMALIZER_NFKC},
+                  {"NFKD", NORMALIZER_NFKD},
+                  {"Lowercase", NORMALIZER_LOWERCASE}};
+    NormalizerNode *node = NULL;
+    size_t i = 0;
+    while (i < sizeof(simple) / sizeof(simple[0]) && strcmp(name, simple[i].name) != 0)
+        i++;
+    if (i < sizeof(simple) / sizeof(simple[0]))
+        node = normalizer_node_new(tok, simple[i].type, NULL, 0, NULL, 0);
+    else if (strcmp(name, "Replace") == 0)
+    {
+        cJSON *pattern = cJSON_GetObjectItem(obj, "pattern");
+        cJSON *content = cJSON_GetObjectItem(obj, "content");
+        if (!pattern || !cJSON_IsString(content))
+            return BBPE_ERR_INVALID_INPUT;
+        cJSON *str = cJSON_GetObjectItem(pattern, "String");
+        if (!cJSON_IsString(str))
+            return cJSON_GetObjectItem(pattern, "Regex") ? BBPE_ERR_UNSUPPORTED_TYPE : BBPE_ERR_INVALID_INPUT;
+        node = normalizer_node_new(tok, NORMALIZER_REPLACE, str->valuestring, strlen(str->valuestring),
+                                   content->valuestring, strlen(content->valuestring));
+    }
+    else if (strcmp(name, "Prepend") == 0)
+    {
+        cJSON *prepend = cJSON_GetObjectItem(obj, "prepend");
+        if (!cJSON_IsString(prepend))
+            return BBPE_ERR_INVALID_INPUT;
+        node = normalizer_node_new(tok, NORMALIZER_PREPEND, NULL, 0, prepend->valuestring,
+                                   strlen(prepend->valuestring));
+    }
+    else
+        return BBPE_ERR_UNSUPPORTED_TYPE;
+    if (!node)
+        return BBPE_ERR_MEMORY;
+    **tail = node;
+    *tail = &node->next;
+    return BBPE_OK;
+}
+
+// ============================================================================
+// 合并规则行构建
+// ============================================================================
+
+/**
+ * @brief 由合并规则记录构建规则行 (按 left 分行，行内按 right_id 升序)
+ * @param tok 分词器句柄 (vocab_size 已确定)
+ * @param records 规则记录数组
+ * @param count 记录数
+ * @return BBPEStatus
+ * @note 两趟稳定的计数排序：先按 right_id 分桶 (只排记录下标)，再按 left 分行，O(count + vocab_size)；
+ *       right_id 相同的重复规则保持原有顺序。left 或 right_id 超出范围的记录被忽略；
+ *       保留的规则中 right_id、new_id 不小于 RULE_ID_LIMIT 或 priority 超出 [0, RULE_PRIORITY_LIMIT)
+ *       时无法打包，返回 BBPE_ERR_INVALID_INPUT
+ */
+static BBPEStatus build_rule_rows(BBPETokenizer *tok, const MergeRecord *records, size_t count)
+{
+    const BBPEAllocator *a = &tok->allocator;
+    uint32_t n_ids = tok->vocab_size;
+    uint32_t *start = (uint32_t *)mem_calloc(a, (size_t)n_ids + 1, sizeof(uint32_t));
+    uint32_t *cursor = (uint32_t *)mem_calloc(a, (size_t)n_ids + 1, sizeof(uint32_t));
+    if (!start || !cursor)
+    {
+        mem_free(a, start);
+        mem_free(a, cursor);
+        return BBPE_ERR_MEMORY;
+    }
+
+    // 1. 同时按 left (start[left + 1]) 与 right_id (cursor[right + 1]) 计数，再分别求前缀和
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t left = (uint32_t)records[i].left_id;
+        uint32_t right = (uint32_t)records[i].right_id;
+        if (left < n_ids && right < n_ids)
+        {
+            if (right >= RULE_ID_LIMIT || (uint32_t)records[i].new_id >= RULE_ID_LIMIT ||
+                (uint32_t)records[i].priority >= RULE_PRIORITY_LIMIT)
+            {
+                mem_free(a, start);
+                mem_free(a, cursor);
+                return BBPE_ERR_INVALID_INPUT;
+            }
+            start[left + 1]++;
+            cursor[right + 1]++;
+            total++;
+        }
+    }
+    if (count > UINT32_MAX) // 分桶只记录下标，规则数也不超过该值
+    {
+        mem_free(a, start);
+        mem_free(a, cursor);
+        return BBPE_ERR_INVALID_INPUT;
+    }
+    for (uint32_t id = 0; id < n_ids; id++)
+    {
+        start[id + 1] += start[id];
+        cursor[id + 1] += cursor[id];
+    }
+
+    MergeRuleItem *items = (MergeRuleItem *)mem_alloc(a, (total ? total : 1) * sizeof(MergeRuleItem));
+    uint32_t *by_right = (uint32_t *)mem_alloc(a, (total ? total : 1) * sizeof(uint32_t));
+    if (!items || !by_right)
+    {
+        mem_free(a, items);
+        mem_free(a, by_right);
+        mem_free(a, start);
+        mem_free(a, cursor);
+        return BBPE_ERR_MEMORY;
+    }
+
+    // 2. 按 right_id 稳定分桶
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t left = (uint32_t)records[i].left_id;
+        uint32_t right = (uint32_t)records[i].right_id;
+        if (left < n_ids && right < n_ids)
+            by_right[cursor[right]++] = (uint32_t)i;
+    }
+
+    // 3. 按 left 稳定分行：各行内自然保持 right_id 升序
+    memcpy(cursor, start, (size_t)n_ids * sizeof(uint32_t));
+    for (size_t i = 0; i < total; i++)
+    {
+        const MergeRecord *rec = &records[by_right[i]];
+        items[cursor[rec->left_id]++] = rule_item_pack((uint32_t)rec->right_id, (uint32_t)rec->new_id,
+                                                       (uint32_t)rec->priority);
+    }
+    mem_free(a, by_right);
+    mem_free(a, cursor);
+
+    mem_free(a, tok->rule_start);
+    mem_free(a, tok->rule_items);
+    tok->rule_start = start;
+    tok->rule_items = items;
+    return BBPE_OK;
+}
+
+// ============================================================================
+// 流式 JSON 读取：直接扫描 tokenizer.json 原文，vocab 与 merges 不构建 DOM
+// ============================================================================
+
+#define JSON_NESTING_LIMIT 1000 /* 与 cJSON 的默认嵌套上限一致 */
+
+/**
+ * @brief 含转义字符的 JSON 字符串的解码缓冲区 (不含转义时直接引用原文)
+ */
+typedef struct
+{
+    char *data;
+    size_t capacity;
+} JsonScratch;
+
+/**
+ * @brief bbpe_init 的读取状态
+ */
+typedef struct
+{
+    const char *p;           /* 当前读取位置 (原文以 '\0' 结尾) */
+    const BBPEAllocator *alloc; /* 解码缓冲区所用的分配器 (分词器的分配器) */
+    JsonScratch key;         /* 对象键 / 合并规则左半部分的解码缓冲区 */
+    JsonScratch value;       /* 合并规则右半部分的解码缓冲区 */
+    int has_model;           /* 已读取 model 对象 */
+    int has_vocab;           /* 已读取 model.vocab */
+    int vocab_ready;         /* vocab 非空且 id_to_entry 已构建 */
+    int max_id;              /* vocab 中的最大 ID */
+    int has_merges;          /* 已遇到 model.merges 数组 */
+    int defer_merges;        /* 非 0 表示不就地解析 merges (延迟构建或只解码)，只记录其位置 */
+    const char *merges_at;   /* merges 出现在 vocab 之前或需要推迟时记录其起止位置 */
+    const char *merges_end;
+    const char *pre_tok_at;  /* pre_tokenizer 值的起止位置 (交给 cJSON 解析的小片段) */
+    const char *pre_tok_end;
+    const char *norm_at;     /* normalizer 值的起止位置 */
+    const char *norm_end;
+    const char *added_at;    /* added_tokens 值的起止位置 */
+    const char *added_end;
+} JsonIngest;
+
+static void json_skip_ws(JsonIngest *in)
+{
+    while ((unsigned char)(*in->p - 1) < 32)
+        in->p++;
+}
+
+/**
+ * @brief 跳过空白后读取一个期望的字符
+ */
+static BBPEStatus json_expect(JsonIngest *in, char ch)
+{
+    json_skip_ws(in);
+    if (*in->p != ch)
+        return BBPE_ERR_JSON_PARSE;
+    in->p++;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 定位对象或数组的下一个元素
+ * @param in 读取状态 (位于 '{' / '[' 之后或上一个元素之后)
+ * @param close 结束字符 '}' 或 ']'
+ * @param index 已读取的元素数
+ * @param out_more 输出 1 表示还有元素 (已越过分隔逗号)，0 表示已越过结束字符
+ * @return BBPEStatus
+ */
+static BBPEStatus json_next_item(JsonIngest *in, char close, size_t index, int *out_more)
+{
+    json_skip_ws(in);
+    if (*in->p == close)
+    {
+        in->p++;
+        *out_more = 0;
+        return BBPE_OK;
+    }
+    if (index > 0)
+    {
+        if (*in->p != ',')
+            return BBPE_ERR_JSON_PARSE;
+        in->p++;
+    }
+    *out_more = 1;
+    return BBPE_OK;
+}
+
+static int json_hex4(const char *s, uint32_t *out)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        char c = s[i];
+        v <<= 4;
+        if (c >= '0' && c <= '9')
+            v |= (uint32_t)(c - '0');
+        else if (c >= 'a' && c <= 'f')
+            v |= (uint32_t)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F')
+            v |= (uint32_t)(c - 'A' + 10);
+        else
+            return 0;
+    }
+    *out = v;
+    return 1;
+}
+
+/**
+ * @brief 读取一个 JSON 字符串
+ * @param in 读取状态
+ * @param scratch 含转义时的解码缓冲区
+ * @param out 输出字符串起点：不含转义时指向原文，否则指向 scratch (均不以 '\0' 结尾)
+ * @param out_len 输出字节数
+ * @return BBPEStatus
+ */
+static BBPEStatus json_read_string(JsonIngest *in, JsonScratch *scratch, const char **out, size_t *out_len)
+{
+    json_skip_ws(in);
+    if (*in->p != '"')
+        return BBPE_ERR_JSON_PARSE;
+    const char *start = in->p + 1;
+    const char *q = start;
+    while (*q != '"' && *q != '\\')
+    {
+        if (*q == '\0')
+            return BBPE_ERR_JSON_PARSE;
+        q++;
+    }
+    if (*q == '"')
+    {
+        *out = start;
+        *out_len = (size_t)(q - start);
+        in->p = q + 1;
+        return BBPE_OK;
+    }
+
+    // 含转义：解码结果不会长于原文，先确定结尾以一次性预留缓冲区
+    const char *end = q;
+    while (*end != '"')
+    {
+        if (*end == '\0' || (*end == '\\' && end[1] == '\0'))
+            return BBPE_ERR_JSON_PARSE;
+        end += *end == '\\' ? 2 : 1;
+    }
+    size_t need = (size_t)(end - start);
+    if (need > scratch->capacity)
+    {
+        char *data = (char *)mem_realloc(in->alloc, scratch->data, need);
+        if (!data)
+            return BBPE_ERR_MEMORY;
+        scratch->data = data;
+        scratch->capacity = need;
+    }
+
+    char *w = scratch->data;
+    memcpy(w, start, (size_t)(q - start));
+    w += q - start;
+    while (q < end)
+    {
+        if (*q != '\\')
+        {
+            *w++ = *q++;
+            continue;
+        }
+        char esc = q[1];
+        q += 2;
+        switch (esc)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            *w++ = esc;
+            break;
+        case 'b':
+            *w++ = '\b';
+            break;
+        case 'f':
+            *w++ = '\f';
+            break;
+        case 'n':
+            *w++ = '\n';
+            break;
+        case 'r':
+            *w++ = '\r';
+            break;
+        case 't':
+            *w++ = '\t';
+            break;
+        case 'u':
+        {
+            // \uXXXX，代理对须成对出现
+            uint32_t cp, low;
+            if (end - q < 4 || !json_hex4(q, &cp))
+                return BBPE_ERR_JSON_PARSE;
+            q += 4;
+            if (cp >= 0xDC00 && cp <= 0xDFFF)
+                return BBPE_ERR_JSON_PARSE;
+            if (cp >= 0xD800 && cp <= 0xDBFF)
+            {
+                if (end - q < 6 || q[0] != '\\' || q[1] != 'u' || !json_hex4(q + 2, &low) ||
+                    low < 0xDC00 || low > 0xDFFF)
+                    return BBPE_ERR_JSON_PARSE;
+                q += 6;
+                cp = 0x10000 + (((cp & 0x3FF) << 10) | (low & 0x3FF));
+            }
+            w += utf8_encode(cp, w);
+            break;
+        }
+        default:
+            return BBPE_ERR_JSON_PARSE;
+        }
+    }
+    *out = scratch->data;
+    *out_len = (size_t)(w - scratch->data);
+    in->p = end + 1;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 读取一个 JSON 数字，并按 cJSON 的 valueint 规则截断为 int
+ */
+static BBPEStatus json_read_int(JsonIngest *in, int *out)
+{
+    json_skip_ws(in);
+    const char *s = in->p;
+    const char *q = s;
+    int neg = *q == '-';
+    if (neg)
+        q++;
+    double value = 0;
+    while (*q >= '0' && *q <= '9')
+        value = value * 10 + (*q++ - '0');
+    if (q == s + neg)
+        return BBPE_ERR_JSON_PARSE;
+    if (neg)
+        value = -value;
+
+    // 含小数或指数时交给 strtod
+    if (*q == '.' || *q == 'e' || *q == 'E')
+    {
+        char buf[64];
+        while ((*q >= '0' && *q <= '9') || *q == '.' || *q == 'e' || *q == 'E' || *q == '+' || *q == '-')
+            q++;
+        size_t len = (size_t)(q - s);
+        if (len >= sizeof(buf))
+            return BBPE_ERR_JSON_PARSE;
+        memcpy(buf, s, len);
+        buf[len] = '\0';
+        char *parse_end;
+        value = strtod(buf, &parse_end);
+        if (parse_end != buf + len)
+            return BBPE_ERR_JSON_PARSE;
+    }
+    in->p = q;
+    *out = value >= INT_MAX ? INT_MAX : value <= (double)INT_MIN ? INT_MIN : (int)value;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 判断对象键是否为 name (与 cJSON_GetObjectItem 一样不区分大小写)
+ */
+static int json_key_is(const char *key, size_t key_len, const char *name)
+{
+    size_t i = 0;
+    for (; i < key_len && name[i]; i++)
+        if (tolower((unsigned char)key[i]) != name[i])
+            return 0;
+    return i == key_len && name[i] == '\0';
+}
+
+/**
+ * @brief 跳过 (并校验) 一个任意 JSON 值
+ */
+static BBPEStatus json_skip_value(JsonIngest *in, int depth)
+{
+    BBPEStatus status;
+    const char *str;
+    size_t len;
+    int more;
+    json_skip_ws(in);
+    switch (*in->p)
+    {
+    case '"':
+        return json_read_string(in, &in->value, &str, &len);
+    case '{':
+    case '[':
+    {
+        char close = *in->p == '{' ? '}' : ']';
+        if (depth >= JSON_NESTING_LIMIT)
+            return BBPE_ERR_JSON_PARSE;
+        in->p++;
+        for (size_t i = 0;; i++)
+        {
+            if ((status = json_next_item(in, close, i, &more)) != BBPE_OK)
+                return status;
+            if (!more)
+                return BBPE_OK;
+            if (close == '}')
+            {
+                if ((status = json_read_string(in, &in->value, &str, &len)) != BBPE_OK ||
+                    (status = json_expect(in, ':')) != BBPE_OK)
+                    return status;
+            }
+            if ((status = json_skip_value(in, depth + 1)) != BBPE_OK)
+                return status;
+        }
+    }
+    case 't':
+        len = strncmp(in->p, "true", 4) == 0 ? 4 : 0;
+        break;
+    case 'f':
+        len = strncmp(in->p, "false", 5) == 0 ? 5 : 0;
+        break;
+    case 'n':
+        len = strncmp(in->p, "null", 4) == 0 ? 4 : 0;
+        break;
+    default:
+    {
+        int ignored;
+        return json_read_int(in, &ignored);
+    }
+    }
+    if (len == 0)
+        return BBPE_ERR_JSON_PARSE;
+    in->p += len;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 读取 model.vocab：键直接从原文复制进词汇表字符串池，非数字的值被忽略
+ */
+static BBPEStatus ingest_vocab(JsonIngest *in, BBPETokenizer *tok)
+{
+    BBPEStatus status;
+    int more;
+    in->p++;
+    for (size_t i = 0;; i++)
+    {
+        const char *key;
+        size_t key_len;
+        if ((status = json_next_item(in, '}', i, &more)) != BBPE_OK || !more)
+            return status;
+        if ((status = json_read_string(in, &in->key, &key, &key_len)) != BBPE_OK ||
+            (status = json_expect(in, ':')) != BBPE_OK)
+            return status;
+        json_skip_ws(in);
+        if (*in->p != '-' && (*in->p < '0' || *in->p > '9'))
+        {
+            if ((status = json_skip_value(in, 2)) != BBPE_OK)
+                return status;
+            continue;
+        }
+        int id;
+        if ((status = json_read_int(in, &id)) != BBPE_OK ||
+            (status = vocab_table_add(&tok->vocab, key, key_len, id)) != BBPE_OK)
+            return status;
+        if (id > in->max_id)
+            in->max_id = id;
+    }
+}
+
+/**
+ * @brief vocab 读完后确定 vocab_size 并填充 id_to_entry 与单字节 token 表
+ * @note vocab 为空时不做任何事，由调用者在扫描结束后报告 BBPE_ERR_VOCAB_MISSING
+ */
+static BBPEStatus finish_vocab(JsonIngest *in, BBPETokenizer *tok)
+{
+    if (in->max_id < 0)
+        return BBPE_OK;
+    tok->vocab_size = (uint32_t)in->max_id + 1;
+    vocab_table_shrink(&tok->vocab);
+    BBPEStatus status = id_table_alloc(tok, tok->vocab_size);
+    if (status != BBPE_OK)
+        return status;
+    vocab_table_finish(tok);
+    in->vocab_ready = 1;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 解析一条合并规则的两半字符串：得到 left、right 与合并后的 token ID，任一不存在时为 -1
+ */
+static void resolve_merge(const VocabTable *vt, const char *left, size_t left_len, const char *right, size_t right_len,
+                          MergeRecord *out)
+{
+    out->left_id = vocab_table_find(vt, left, left_len);
+    out->right_id = vocab_table_find(vt, right, right_len);
+    out->new_id = out->left_id >= 0 && out->right_id >= 0
+                      ? vocab_table_find_concat(vt, left, left_len, right, right_len)
+                      : -1;
+}
+
+/**
+ * @brief 待并行解析的一条合并规则：两半字符串直接指向 JSON 原文，left 为 NULL 表示扫描时已解析
+ */
+typedef struct
+{
+    const char *left;
+    const char *right;
+    uint32_t left_len;
+    uint32_t right_len;
+} MergeRef;
+
+/**
+ * @brief 并行解析合并规则的共享状态
+ */
+typedef struct
+{
+    const VocabTable *vocab; /* 只读的词汇表 */
+    const MergeRef *refs;    /* 待解析的规则 */
+    MergeRecord *records;    /* 输出：与 refs 一一对应 */
+    size_t count;            /* 规则数 */
+    size_t next;             /* 下一个待领取的下标 (受 lock 保护) */
+    bbpe_mutex_t lock;
+} MergeResolveJob;
+
+/**
+ * @brief 并行解析的工作线程：每次领取 MERGE_RESOLVE_BLOCK 条规则
+ */
+static void merge_resolve_worker(void *arg)
+{
+    MergeResolveJob *job = (MergeResolveJob *)arg;
+    for (;;)
+    {
+        mutex_lock(&job->lock);
+        size_t begin = job->next;
+        job->next = begin < job->count ? begin + MERGE_RESOLVE_BLOCK : begin;
+        mutex_unlock(&job->lock);
+        if (begin >= job->count)
+            break;
+
+        size_t end = begin + MERGE_RESOLVE_BLOCK < job->count ? begin + MERGE_RESOLVE_BLOCK : job->count;
+        for (size_t i = begin; i < end; i++)
+        {
+            const MergeRef *ref = &job->refs[i];
+            if (ref->left)
+                resolve_merge(job->vocab, ref->left, ref->left_len, ref->right, ref->right_len, &job->records[i]);
+        }
+    }
+}
+
+/**
+ * @brief 读取 model.merges 并构建规则行 (vocab 须已读完)
+ * @note 支持 "a b" 字符串与 ["a", "b"] 数组两种写法；无法解析或引用未知 token 的规则被忽略，
+ *       优先级按被接受的顺序编号。以 BBPE_LOAD_PARALLEL 加载时先顺序扫描并记录各规则在原文中的位置，
+ *       再由多个线程查找词汇表 (含转义的规则在扫描时即解析)，最后按原顺序编号，结果与单线程相同
+ */
+static BBPEStatus ingest_merges(JsonIngest *in, BBPETokenizer *tok)
+{
+    BBPEStatus status = BBPE_OK;
+    MergeRecord *records = NULL;
+    MergeRef *refs = NULL;
+    size_t record_cnt = 0, record_cap = 0;
+    size_t total = 0;
+    int threads = (tok->load_flags & BBPE_LOAD_PARALLEL) ? cpu_count() : 1;
+    int more;
+    in->p++;
+    for (;; total++)
+    {
+        const char *left, *right;
+        size_t left_len, right_len;
+        if ((status = json_next_item(in, ']', total, &more)) != BBPE_OK)
+            goto cleanup;
+        if (!more)
+            break;
+
+        json_skip_ws(in);
+        if (*in->p == '"')
+        {
+            if ((status = json_read_string(in, &in->key, &left, &left_len)) != BBPE_OK)
+                goto cleanup;
+            const char *space = (const char *)memchr(left, ' ', left_len);
+            if (left_len > STRING_TEMP_SIZE || !space)
+                continue;
+            right = space + 1;
+            right_len = left_len - (size_t)(right - left);
+            left_len = (size_t)(space - left);
+        }
+        else if (*in->p == '[')
+        {
+            // 恰好两个字符串元素才有效，其余元素形态仅做跳过
+            const char *parts[2];
+            size_t part_lens[2];
+            size_t n = 0;
+            int valid = 1;
+            in->p++;
+            for (;; n++)
+            {
+                if ((status = json_next_item(in, ']', n, &more)) != BBPE_OK)
+                    goto cleanup;
+                if (!more)
+                    break;
+                json_skip_ws(in);
+                if (n < 2 && *in->p == '"')
+                    status = json_read_string(in, n == 0 ? &in->key : &in->value, &parts[n], &part_lens[n]);
+                else
+                {
+                    valid = 0;
+                    status = json_skip_value(in, 3);
+                }
+                if (status != BBPE_OK)
+                    goto cleanup;
+            }
+            if (!valid || n != 2 || part_lens[0] + part_lens[1] > STRING_TEMP_SIZE)
+                continue;
+            left = parts[0];
+            left_len = part_lens[0];
+            right = parts[1];
+            right_len = part_lens[1];
+        }
+        else
+        {
+            if ((status = json_skip_value(in, 2)) != BBPE_OK)
+                goto cleanup;
+            continue;
+        }
+
+        if (record_cnt == record_cap)
+        {
+            size_t new_cap = record_cap ? record_cap * 2 : 4096;
+            MergeRecord *grown =
+                (MergeRecord *)mem_realloc(&tok->allocator, records, new_cap * sizeof(MergeRecord));
+            if (!grown)
+            {
+                status = BBPE_ERR_MEMORY;
+                goto cleanup;
+            }
+            records = grown;
+            if (threads > 1)
+            {
+                MergeRef *grown_refs = (MergeRef *)mem_realloc(&tok->allocator, refs, new_cap * sizeof(MergeRef));
+                if (!grown_refs)
+                {
+                    status = BBPE_ERR_MEMORY;
+                    goto cleanup;
+                }
+                refs = grown_refs;
+            }
+            record_cap = new_cap;
+        }
+
+        // 并行时只记录指向原文的位置；解码进缓冲区的字符串 (含转义) 会被下一条覆盖，立即解析
+        int in_scratch = (in->key.data && left >= in->key.data && left < in->key.data + in->key.capacity) ||
+                         (in->value.data && right >= in->value.data && right < in->value.data + in->value.capacity);
+        if (refs && !in_scratch)
+        {
+            MergeRef *ref = &refs[record_cnt];
+            ref->left = left;
+            ref->right = right;
+            ref->left_len = (uint32_t)left_len;
+            ref->right_len = (uint32_t)right_len;
+        }
+        else
+        {
+            if (refs)
+                refs[record_cnt].left = NULL;
+            resolve_merge(&tok->vocab, left, left_len, right, right_len, &records[record_cnt]);
+        }
+        record_cnt++;
+    }
+
+    if (refs)
+    {
+        MergeResolveJob job;
+        job.vocab = &tok->vocab;
+        job.refs = refs;
+        job.records = records;
+        job.count = record_cnt;
+        job.next = 0;
+        mutex_init(&job.lock);
+        size_t blocks = (record_cnt + MERGE_RESOLVE_BLOCK - 1) / MERGE_RESOLVE_BLOCK;
+        run_parallel((size_t)threads < blocks ? threads : (int)blocks, merge_resolve_worker, &job);
+        mutex_destroy(&job.lock);
+    }
+
+    // 丢弃引用未知 token 的规则，其余按原顺序编号
+    size_t accepted = 0;
+    for (size_t i = 0; i < record_cnt; i++)
+    {
+        if (records[i].left_id < 0 || records[i].right_id < 0 || records[i].new_id < 0)
+            continue;
+        records[accepted] = records[i];
+        records[accepted].priority = (int32_t)accepted;
+        accepted++;
+    }
+
+    tok->merge_count = total;
+    status = build_rule_rows(tok, records, accepted);
+
+cleanup:
+    mem_free(&tok->allocator, records);
+    mem_free(&tok->allocator, refs);
+    return status;
+}
+
+/**
+ * @brief 读取 model 对象：vocab 读完后立即构建 id_to_entry；merges 若位于 vocab 之后则就地解析
+ */
+static BBPEStatus ingest_model(JsonIngest *in, BBPETokenizer *tok)
+{
+    BBPEStatus status;
+    int more;
+    in->p++;
+    for (size_t i = 0;; i++)
+    {
+        const char *key;
+        size_t key_len;
+        if ((status = json_next_item(in, '}', i, &more)) != BBPE_OK || !more)
+            return status;
+        if ((status = json_read_string(in, &in->key, &key, &key_len)) != BBPE_OK ||
+            (status = json_expect(in, ':')) != BBPE_OK)
+            return status;
+        json_skip_ws(in);
+
+        if (json_key_is(key, key_len, "vocab") && !in->has_vocab)
+        {
+            in->has_vocab = 1;
+            if (*in->p == '{')
+            {
+                if ((status = ingest_vocab(in, tok)) == BBPE_OK)
+                    status = finish_vocab(in, tok);
+            }
+            else
+                status = json_skip_value(in, 2);
+        }
+        else if (json_key_is(key, key_len, "merges") && !in->has_merges && *in->p == '[')
+        {
+            in->has_merges = 1;
+            if (in->vocab_ready && !in->defer_merges)
+                status = ingest_merges(in, tok);
+            else
+            {
+                in->merges_at = in->p;
+                status = json_skip_value(in, 2);
+                in->merges_end = in->p;
+            }
+        }
+        else
+            status = json_skip_value(in, 2);
+        if (status != BBPE_OK)
+            return status;
+    }
+}
+
+/**
+ * @brief 扫描根对象：model 就地读取，normalizer、pre_tokenizer 与 added_tokens 只记录位置
+ */
+static BBPEStatus ingest_root(JsonIngest *in, BBPETokenizer *tok)
+{
+    BBPEStatus status;
+    int more;
+    json_skip_ws(in);
+    if (*in->p != '{')
+        return json_skip_value(in, 0);
+    in->p++;
+    for (size_t i = 0;; i++)
+    {
+        const char *key;
+        size_t key_len;
+        if ((status = json_next_item(in, '}', i, &more)) != BBPE_OK || !more)
+            return status;
+        if ((status = json_read_string(in, &in->key, &key, &key_len)) != BBPE_OK ||
+            (status = json_expect(in, ':')) != BBPE_OK)
+            return status;
+        json_skip_ws(in);
+
+        const char *value_at = in->p;
+        if (json_key_is(key, key_len, "model") && !in->has_model && *in->p == '{')
+        {
+            in->has_model = 1;
+            status = ingest_model(in, tok);
+        }
+        else
+            status = json_skip_value(in, 1);
+        if (status != BBPE_OK)
+            return status;
+
+        if (json_key_is(key, key_len, "pre_tokenizer") && !in->pre_tok_at)
+        {
+            in->pre_tok_at = value_at;
+            in->pre_tok_end = in->p;
+        }
+        else if (json_key_is(key, key_len, "normalizer") && !in->norm_at)
+        {
+            in->norm_at = value_at;
+            in->norm_end = in->p;
+        }
+        else if (json_key_is(key, key_len, "added_tokens") && !in->added_at)
+        {
+            in->added_at = value_at;
+            in->added_end = in->p;
+        }
+    }
+}
+
+/**
+ * @brief 找出派生用 JSON 中的 added_tokens：根为数组时即其本身，根为对象时其余键只跳过 (不读取 model)
+ */
+static BBPEStatus locate_added_tokens(JsonIngest *in)
+{
+    BBPEStatus status;
+    int more;
+    json_skip_ws(in);
+    if (*in->p == '[')
+    {
+        in->added_at = in->p;
+        status = json_skip_value(in, 0);
+        in->added_end = in->p;
+        return status;
+    }
+    if (*in->p != '{')
+        return BBPE_ERR_JSON_PARSE;
+    in->p++;
+    for (size_t i = 0;; i++)
+    {
+        const char *key;
+        size_t key_len;
+        if ((status = json_next_item(in, '}', i, &more)) != BBPE_OK || !more)
+            return status;
+        if ((status = json_read_string(in, &in->key, &key, &key_len)) != BBPE_OK ||
+            (status = json_expect(in, ':')) != BBPE_OK)
+            return status;
+        json_skip_ws(in);
+
+        const char *value_at = in->p;
+        if ((status = json_skip_value(in, 1)) != BBPE_OK)
+            return status;
+        if (json_key_is(key, key_len, "added_tokens") && !in->added_at)
+        {
+            in->added_at = value_at;
+            in->added_end = in->p;
+        }
+    }
+}
+
+/**
+ * @brief 登记 added_tokens 中的特殊 token (已有 token 字符串的 ID 保持不变)，ID 超出词表时扩展词表大小
+ * @param tok 分词器句柄 (id_to_entry 已按 vocab_size 分配；rule_start 随之扩展，与基础分词器共享时改为自己的副本)
+ * @param added_tokens 解析后的 added_tokens，不是数组时忽略
+ * @return BBPEStatus
+ */
+static BBPEStatus ingest_added_tokens(BBPETokenizer *tok, cJSON *added_tokens)
+{
+    BBPEStatus status;
+    cJSON *token_obj = NULL;
+    if (!cJSON_IsArray(added_tokens))
+        return BBPE_OK;
+    cJSON_ArrayForEach(token_obj, added_tokens)
+    {
+        cJSON *content = cJSON_GetObjectItem(token_obj, "content");
+        cJSON *id = cJSON_GetObjectItem(token_obj, "id");
+        if (!content || !content->valuestring || !id || !cJSON_IsNumber(id) || id->valueint < 0)
+            continue;
+        int32_t sid = (int32_t)id->valueint;
+
+        if ((uint32_t)sid >= tok->vocab_size)
+        {
+            uint32_t new_size = sid + 1;
+
+            // 扩展 id_to_entry (新增的 ID 没有 token 字符串)
+            uint32_t *new_entries =
+                (uint32_t *)mem_realloc(&tok->allocator, tok->id_to_entry, new_size * sizeof(uint32_t));
+            if (!new_entries)
+                return BBPE_ERR_MEMORY;
+            for (uint32_t i = tok->vocab_size; i < new_size; i++)
+                new_entries[i] = ID_ENTRY_NONE;
+            tok->id_to_entry = new_entries;
+
+            // 同步扩展规则行起点数组 (新增的 ID 没有规则，行为空；推迟构建时规则行届时按新大小分配)
+            if (tok->rule_start)
+            {
+                int shared = tok->base && tok->rule_start == tok->base->rule_start;
+                uint32_t *new_start = (uint32_t *)mem_realloc(&tok->allocator, shared ? NULL : tok->rule_start,
+                                                              ((size_t)new_size + 1) * sizeof(uint32_t));
+                if (!new_start)
+                    return BBPE_ERR_MEMORY;
+                if (shared)
+                    memcpy(new_start, tok->rule_start, ((size_t)tok->vocab_size + 1) * sizeof(uint32_t));
+                for (uint32_t i = tok->vocab_size + 1; i <= new_size; i++)
+                    new_start[i] = new_start[tok->vocab_size];
+                tok->rule_start = new_start;
+            }
+
+            tok->vocab_size = new_size;
+        }
+
+        if (tok->id_to_entry[sid] == ID_ENTRY_NONE)
+        {
+            status = special_table_add(tok, content->valuestring, strlen(content->valuestring), sid);
+            if (status != BBPE_OK)
+                return status;
+        }
+    }
+    vocab_table_shrink(&tok->specials);
+    return BBPE_OK;
+}
+
+// ============================================================================
+// 解码辅助函数
+// ============================================================================
+
+/**
+ * @brief 将单个 token 还原为原始字节 (字节级 Unicode 字符映射回字节，其余字符保留 UTF-8)
+ * @param tok 分词器
+ * @param id token ID
+ * @param dst 输出缓冲区，为 NULL 时只计算字节数
+ * @param out_len 输出字节数
+ * @return BBPEStatus 状态码
+ */
+static BBPEStatus decode_token(const BBPETokenizer *tok, int32_t id, char *dst, size_t *out_len)
+{
+    const char *p = token_string(tok, id);
+    if (!p)
+        return BBPE_ERR_TOKEN_NOT_FOUND;
+
+    size_t n = 0;
+    while (*p)
+    {
+        uint32_t cp;
+        int len = utf8_decode(p, &cp);
+        if (len < 0)
+            return BBPE_ERR_INVALID_INPUT;
+
+        // 字节 0x00 映射到的码点在反查表中同样是 0，因此要回查正向表确认
+        if (cp < UNICODE_MAP_SIZE && tok->byte_to_unicode[tok->unicode_to_byte[cp]] == cp)
+        {
+            if (dst)
+                dst[n] = (char)tok->unicode_to_byte[cp]; // 映射回原始字节
+            n += 1;
+        }
+        else
+        {
+            if (dst)
+                memcpy(dst + n, p, len); // 保留原 UTF-8 字符
+            n += len;
+        }
+        p += len;
+    }
+    *out_len = n;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 预先解码全部 token，构建 id → 原始字节的连续字节池 (解码时只需 memcpy)
+ * @param tok 分词器 (id_to_entry 与字节映射已就绪)
+ * @return BBPEStatus 状态码
+ * @note 缺失或无法解码的 id 记为长度 0，解码时由 decode_token 返回与逐字符解码相同的错误码
+ */
+static BBPEStatus build_decode_table(BBPETokenizer *tok)
+{
+    tok->decoded_start =
+        (uint32_t *)mem_alloc(&tok->allocator, ((size_t)tok->vocab_size + 1) * sizeof(uint32_t));
+    if (!tok->decoded_start)
+        return BBPE_ERR_MEMORY;
+
+    // 解码后的字节数不超过 token 字符串的 UTF-8 字节数，按此预留空间后一遍写入
+    size_t total = 0, capacity = 0;
+    for (uint32_t id = 0; id < tok->vocab_size; id++)
+    {
+        tok->decoded_start[id] = (uint32_t)total;
+        const char *str = token_string(tok, (int32_t)id);
+        if (!str)
+            continue;
+        size_t max_len = strlen(str);
+        if (total + max_len > capacity)
+        {
+            size_t new_capacity = capacity ? capacity * 2 : tok->vocab.pool_size + 64;
+            while (new_capacity < total + max_len)
+                new_capacity *= 2;
+            uint8_t *new_pool = (uint8_t *)mem_realloc(&tok->allocator, tok->decoded_pool, new_capacity);
+            if (!new_pool)
+                return BBPE_ERR_MEMORY;
+            tok->decoded_pool = new_pool;
+            capacity = new_capacity;
+        }
+        size_t len;
+        if (decode_token(tok, (int32_t)id, (char *)tok->decoded_pool + total, &len) != BBPE_OK)
+            len = 0;
+        total += len;
+        if (total > UINT32_MAX)
+            return BBPE_ERR_MEMORY;
+    }
+    tok->decoded_start[tok->vocab_size] = (uint32_t)total;
+    if (!tok->decoded_pool && !(tok->decoded_pool = (uint8_t *)mem_alloc(&tok->allocator, 1)))
+        return BBPE_ERR_MEMORY;
+    // 按倍数扩展留下的余量收缩掉 (失败时保留原缓冲区)
+    uint8_t *shrunk = total ? (uint8_t *)mem_realloc(&tok->allocator, tok->decoded_pool, total) : NULL;
+    if (shrunk)
+        tok->decoded_pool = shrunk;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 查表得到单个 token 解码后的字节数
+ * @param tok 分词器
+ * @param id token ID
+ * @param out_len 输出字节数
+ * @return BBPEStatus 状态码 (与 decode_token 相同)
+ */
+static inline BBPEStatus decoded_length(const BBPETokenizer *tok, int32_t id, size_t *out_len)
+{
+    if (id < 0 || (uint32_t)id >= tok->vocab_size)
+        return BBPE_ERR_TOKEN_NOT_FOUND;
+    *out_len = tok->decoded_start[id + 1] - tok->decoded_start[id];
+    if (*out_len != 0)
+        return BBPE_OK;
+    return decode_token(tok, id, NULL, out_len); // 缺失、非法或空 token：按原逻辑判定
+}
+
+/**
+ * @brief 由解码表的长度求一组 ID 解码后的总字节数 (同时校验所有 ID)
+ * @param tok 分词器
+ * @param ids ID 数组 (count 为 0 时可为 NULL)
+ * @param count ID 数量
+ * @param out_len 输出总字节数 (不含结尾 '\0')
+ * @return BBPEStatus 状态码 (第一个非法 ID 的错误码)
+ */
+static BBPEStatus decoded_total(const BBPETokenizer *tok, const int32_t *ids, size_t count, size_t *out_len)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t len;
+        BBPEStatus status = decoded_length(tok, ids[i], &len);
+        if (status != BBPE_OK)
+            return status;
+        total += len;
+    }
+    *out_len = total;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 逐个复制一组 ID 预先解码的字节 (ID 须已由 decoded_total 校验)
+ * @return 写入的字节数
+ */
+static size_t decode_copy(const BBPETokenizer *tok, const int32_t *ids, size_t count, char *dst)
+{
+    size_t pos = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t start = tok->decoded_start[ids[i]];
+        size_t len = tok->decoded_start[ids[i] + 1] - start;
+        memcpy(dst + pos, tok->decoded_pool + start, len);
+        pos += len;
+    }
+    return pos;
+}
+
+/**
+ * @brief 计算字节串末尾被截断的 UTF-8 序列长度
+ * @param s 字节串
+ * @param n 字节数
+ * @return 末尾以合法首字节开头、但续字节尚不足的字节数 (0-3)；
+ *         完整字符或无法补全的非法字节返回 0 (这些字节按原样输出，与 bbpe_decode 一致)
+ */
+static size_t utf8_incomplete_tail(const char *s, size_t n)
+{
+    for (size_t k = 1; k <= 3 && k <= n; k++)
+    {
+        unsigned char c = (unsigned char)s[n - k];
+        if ((c & 0xC0) == 0x80)
+            continue; // 续字节，继续向前寻找首字节
+
+        size_t need = (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 1;
+        return need > k ? k : 0;
+    }
+    return 0;
+}
+
+// ============================================================================
+// 解码字节前缀索引 (约束解码)
+// ============================================================================
+
+#define PREFIX_SORT_INSERTION 16 /* 前缀索引排序中不超过该长度的区间改用插入排序 */
+
+/**
+ * @brief ID 解码后第 depth 字节的值，字节串在此之前结束时返回 -1 (较短者排在前面)
+ */
+static inline int prefix_byte_at(const BBPETokenizer *tok, int32_t id, size_t depth)
+{
+    uint32_t start = tok->decoded_start[id];
+    return depth < tok->decoded_start[id + 1] - start ? tok->decoded_pool[start + depth] : -1;
+}
+
+/**
+ * @brief 比较两个 ID 解码后自第 depth 字节起的部分 (字典序，较短者在前)
+ */
+static int prefix_compare(const BBPETokenizer *tok, int32_t a, int32_t b, size_t depth)
+{
+    const uint32_t *start = tok->decoded_start;
+    size_t a_len = start[a + 1] - start[a] - depth, b_len = start[b + 1] - start[b] - depth;
+    int c = memcmp(tok->decoded_pool + start[a] + depth, tok->decoded_pool + start[b] + depth,
+                   a_len < b_len ? a_len : b_len);
+    if (c != 0)
+        return c;
+    return a_len < b_len ? -1 : a_len > b_len;
+}
+
+/**
+ * @brief 按解码字节对 ids 做稳定的 MSD 基数排序 (各 ID 的前 depth 字节已相同)
+ * @param tmp 与 ids 等长的临时区
+ * @note 递归深度不超过共享前缀较长且成员多于 PREFIX_SORT_INSERTION 的 token 组的前缀长度
+ */
+static void prefix_sort(const BBPETokenizer *tok, int32_t *ids, int32_t *tmp, size_t n, size_t depth)
+{
+    if (n <= PREFIX_SORT_INSERTION)
+    {
+        for (size_t i = 1; i < n; i++)
+        {
+            int32_t id = ids[i];
+            size_t j = i;
+            for (; j > 0 && prefix_compare(tok, ids[j - 1], id, depth) > 0; j--)
+                ids[j] = ids[j - 1];
+            ids[j] = id;
+        }
+        return;
+    }
+
+    // 桶 0 为在第 depth 字节之前结束的字节串，桶 c + 1 为第 depth 字节为 c 的字节串
+    uint32_t start[258] = {0};
+    for (size_t i = 0; i < n; i++)
+        start[prefix_byte_at(tok, ids[i], depth) + 2]++;
+    for (int b = 1; b < 258; b++)
+        start[b] += start[b - 1];
+    for (size_t i = 0; i < n; i++)
+        tmp[start[prefix_byte_at(tok, ids[i], depth) + 1]++] = ids[i];
+    memcpy(ids, tmp, n * sizeof(int32_t));
+    for (int b = 1; b < 257; b++) // 此时 start[b] 为桶 b 的终点；桶 0 中的字节串完全相同，无需再排
+    {
+        size_t from = start[b - 1], to = start[b];
+        if (to - from > 1)
+            prefix_sort(tok, ids + from, tmp, to - from, depth + 1);
+    }
+}
+
+/**
+ * @brief 构建前缀索引：解码字节非空的全部 ID 按解码字节的字典序排列 (相同字节串按 ID 升序)
+ * @return BBPEStatus
+ */
+static BBPEStatus build_prefix_index(BBPETokenizer *tok)
+{
+    const BBPEAllocator *a = &tok->allocator;
+    int32_t *ids = (int32_t *)mem_alloc(a, (size_t)tok->vocab_size * sizeof(int32_t) + 1);
+    int32_t *tmp = (int32_t *)mem_alloc(a, (size_t)tok->vocab_size * sizeof(int32_t) + 1);
+    if (!ids || !tmp)
+    {
+        mem_free(a, ids);
+        mem_free(a, tmp);
+        return BBPE_ERR_MEMORY;
+    }
+    uint32_t n = 0;
+    for (uint32_t id = 0; id < tok->vocab_size; id++)
+    {
+        if (tok->decoded_start[id + 1] != tok->decoded_start[id])
+            ids[n++] = (int32_t)id;
+    }
+    prefix_sort(tok, ids, tmp, n, 0);
+    mem_free(a, tmp);
+    int32_t *shrunk = n ? (int32_t *)mem_realloc(a, ids, (size_t)n * sizeof(int32_t)) : NULL;
+    if (shrunk)
+        ids = shrunk;
+    tok->prefix_ids = ids;
+    tok->prefix_count = n;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 在前缀索引的区间 [*lo, *hi) (前 depth 字节都相同) 中收窄到第 depth 字节为 c 的子区间
+ */
+static void prefix_narrow(const BBPETokenizer *tok, size_t *lo, size_t *hi, size_t depth, uint8_t c)
+{
+    const int32_t *ids = tok->prefix_ids;
+    size_t first = *lo, count = *hi - *lo;
+    while (count > 0) // 第一个第 depth 字节不小于 c 的位置
+    {
+        size_t step = count / 2;
+        if (prefix_byte_at(tok, ids[first + step], depth) < c)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+            count = step;
+    }
+    size_t last = first;
+    count = *hi - first;
+    while (count > 0) // 第一个第 depth 字节大于 c 的位置
+    {
+        size_t step = count / 2;
+        if (prefix_byte_at(tok, ids[last + step], depth) <= c)
+        {
+            last += step + 1;
+            count -= step + 1;
+        }
+        else
+            count = step;
+    }
+    *lo = first;
+    *hi = last;
+}
+
+// ============================================================================
+// 延迟构建 (BBPE_LOAD_LAZY_MERGES / BBPE_LOAD_DECODE_ONLY)
+// ============================================================================
+
+/**
+ * @brief 构建加载时推迟的规则行与 Split 正则 (调用者持有 encoder_lock)
+ * @param tok 分词器句柄
+ * @return BBPEStatus
+ * @note 规则行建成后立即释放待解析的数据；失败时保留，下次调用只重试未完成的部分
+ */
+static BBPEStatus build_deferred_encoder(BBPETokenizer *tok)
+{
+    BBPEStatus status = BBPE_OK;
+    if (!tok->rule_start)
+    {
+        if (tok->lazy_merges)
+        {
+            JsonIngest in;
+            memset(&in, 0, sizeof(in));
+            in.p = tok->lazy_merges;
+            in.alloc = &tok->allocator;
+            status = ingest_merges(&in, tok);
+            mem_free(in.alloc, in.key.data);
+            mem_free(in.alloc, in.value.data);
+        }
+        else
+            status = build_rule_rows(tok, tok->lazy_records, tok->lazy_record_count);
+        if (status != BBPE_OK)
+            return status;
+        mem_free(&tok->allocator, tok->lazy_merges);
+        mem_free(&tok->allocator, tok->lazy_records);
+        tok->lazy_merges = NULL;
+        tok->lazy_records = NULL;
+        tok->lazy_record_count = 0;
+    }
+
+    // 预编译结果只尝试解码一次，之后失败的节点逐个按模式编译
+    const uint8_t *codes = tok->lazy_regex_codes;
+    tok->lazy_regex_codes = NULL;
+    return install_split_regexes(tok, codes);
+}
+
+/**
+ * @brief 编码、保存或构建合并规则哈希表之前确保规则行与正则已就绪
+ * @param tok 分词器句柄
+ * @return BBPEStatus；以 BBPE_LOAD_DECODE_ONLY 加载时返回 BBPE_ERR_DECODE_ONLY
+ * @note 首个调用者在 encoder_lock 下完成构建，并发的调用者等待其结果；就绪后只剩一次原子读取
+ */
+static BBPEStatus encoder_prepare(BBPETokenizer *tok)
+{
+    if (!flag_load(&tok->encoder_deferred))
+        return BBPE_OK;
+    if (tok->load_flags & BBPE_LOAD_DECODE_ONLY)
+        return BBPE_ERR_DECODE_ONLY;
+
+    BBPEStatus status = BBPE_OK;
+    mutex_lock(&tok->encoder_lock);
+    if (tok->encoder_deferred)
+    {
+        status = build_deferred_encoder(tok);
+        if (status == BBPE_OK)
+            flag_store(&tok->encoder_deferred, 0);
+    }
+    mutex_unlock(&tok->encoder_lock);
+    return status;
+}
+
+// ============================================================================
+// 稳定前缀 (流式编码与增量编码共用)
+// ============================================================================
+
+/**
+ * @brief 计算特殊 token 的判定余量：最长特殊 token 的字节数减 1
+ * @param tok 分词器句柄
+ * @return 起点距文本末尾不足该字节数的特殊 token 可能因后续文本而改变 (没有特殊 token 时为 0)
+ */
+static size_t special_hold_bytes(const BBPETokenizer *tok)
+{
+    size_t hold = 0;
+    const VocabTable *specials = &tok->specials;
+    for (uint32_t e = 0; e < specials->count; e++)
+    {
+        size_t len = strlen(specials->pool + specials->offsets[e]);
+        if (len > hold + 1)
+            hold = len - 1;
+    }
+    return hold;
+}
+
+/**
+ * @brief 寻找文本中不受后续文本影响的最长前缀：在该处切开后分别编码，结果与整体编码相同
+ * @param tok 分词器句柄
+ * @param ws 工作区 (使用其分段缓冲区)
+ * @param text 文本 (起点须为普通文本段的起点，或 split_find_cut 认可的切分点)
+ * @param len 文本字节数
+ * @param hold special_hold_bytes 的结果
+ * @param split_text 为 0 时只在特殊 token 之后切开
+ * @param out_cut 输出前缀字节数，0 表示没有可用的切分点
+ * @param out_in_text 输出 1 表示切分点位于普通文本段内部 (其后的同段文本须为合法 UTF-8 才与整体编码相同)
+ * @return BBPEStatus
+ * @note 起点早于末尾 hold 字节的特殊 token 已不会因后续文本而改变，其结束处可直接切开；
+ *       之后的普通文本只在预分词链可从块边界重新开始、且规范化链可在独立字符处切开时，按 split_cut_ok 的规则切开
+ */
+static BBPEStatus find_stable_prefix(BBPETokenizer *tok, BBPEWorkspace *ws, const char *text, size_t len,
+                                     size_t hold, int split_text, size_t *out_cut, int *out_in_text)
+{
+    size_t horizon = len > hold ? len - hold : 0;
+    size_t cut = 0;
+    size_t seg_count = 0;
+    *out_cut = 0;
+    *out_in_text = 0;
+    BBPEStatus status = extract_special_tokens(tok, text, len, &ws->allocator, &ws->segments, &ws->segment_capacity,
+                                               &seg_count);
+    if (status != BBPE_OK)
+        return status;
+    for (size_t i = 0; i < seg_count; i++)
+    {
+        const TokenSegment *seg = &ws->segments[i];
+        if (!seg->is_special)
+            continue;
+        if (seg->offset >= horizon)
+            break;
+        cut = seg->offset + seg->len;
+    }
+
+    if (split_text && cut < horizon && pre_tokenizer_restartable(tok) && normalizer_restartable(tok))
+    {
+        // 只在完整且合法的字符之间寻找切分点：末尾不完整的字符类别未知，非法 UTF-8 的段整体作为一个块
+        const uint8_t *s = (const uint8_t *)text + cut;
+        size_t n = horizon - cut;
+        n -= utf8_incomplete_tail((const char *)s, n);
+        size_t q = n > 1 && utf8_validate(s, n) ? split_find_cut(tok, s, n, 0, n, n - 1, 0) : 0;
+        if (q > 0)
+        {
+            cut += q;
+            *out_in_text = 1;
+        }
+    }
+    *out_cut = cut;
+    return BBPE_OK;
+}
+
+// ============================================================================
+// NUMA 副本 (BBPE_ENABLE_NUMA，仅 Linux)
+// ============================================================================
+//
+// 多路服务器上分词器的表只位于分配它的节点，其他节点上的工作线程每次查合并规则都要跨节点访存。
+// 启用后 bbpe_encode_batch 与 bbpe_encode_parallel 的每个工作线程按轮转绑定到一个节点的 CPU 集合，
+// 并改用该节点的副本：规则行 (及可选的合并规则哈希表)、单字节 → ID 表与独立的词级缓存。
+// 副本由首个绑定到该节点的线程分配并复制，依赖 Linux 默认的首次访问策略落在本节点内存上；
+// 工作线程结束时恢复原来的 CPU 亲和性 (调用线程自身也是工作线程之一)。
+
+#ifdef BBPE_NUMA
+/**
+ * @brief 解析 sysfs 的编号列表 (如 "0-3,8-11\n")
+ * @param path 文件路径
+ * @param out_set 输出编号集合
+ * @return 集合中的编号数，文件不存在或格式错误时返回 0
+ */
+static int read_id_list(const char *path, cpu_set_t *out_set)
+{
+    CPU_ZERO(out_set);
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return 0;
+    char line[4096];
+    int ok = fgets(line, sizeof(line), f) != NULL;
+    fclose(f);
+    if (!ok)
+        return 0;
+
+    const char *p = line;
+    while (*p >= '0' && *p <= '9')
+    {
+        char *end;
+        long first = strtol(p, &end, 10);
+        long last = first;
+        if (*end == '-')
+            last = strtol(end + 1, &end, 10);
+        if (first < 0 || last < first || last >= CPU_SETSIZE)
+            return 0;
+        for (long id = first; id <= last; id++)
+            CPU_SET((int)id, out_set);
+        p = *end == ',' ? end + 1 : end;
+    }
+    return CPU_COUNT(out_set);
+}
+
+/**
+ * @brief 读取含 CPU 的在线 NUMA 节点
+ * @param tok 分词器句柄 (提供分配器)
+ * @param out_state 输出节点信息；只有一个这样的节点 (或无法读取 sysfs) 时为 NULL
+ * @return BBPEStatus
+ */
+static BBPEStatus numa_state_create(BBPETokenizer *tok, NumaState **out_state)
+{
+    *out_state = NULL;
+    cpu_set_t online;
+    if (read_id_list("/sys/devices/system/node/online", &online) < 2)
+        return BBPE_OK;
+
+    const BBPEAllocator *a = &tok->allocator;
+    int capacity = CPU_COUNT(&online);
+    NumaState *state = (NumaState *)mem_calloc(a, 1, sizeof(NumaState));
+    if (!state)
+        return BBPE_ERR_MEMORY;
+    state->cpus = (cpu_set_t *)mem_alloc(a, (size_t)capacity * sizeof(cpu_set_t));
+    state->replicas = (TableReplica **)mem_calloc(a, (size_t)capacity, sizeof(TableReplica *));
+    if (!state->cpus || !state->replicas)
+    {
+        mem_free(a, state->cpus);
+        mem_free(a, state->replicas);
+        mem_free(a, state);
+        return BBPE_ERR_MEMORY;
+    }
+    for (int node = 0; node < CPU_SETSIZE && state->node_count < capacity; node++)
+    {
+        if (!CPU_ISSET(node, &online))
+            continue;
+        char path[64];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        // 只有内存没有 CPU 的节点 (如 CXL 扩展内存) 不绑定工作线程
+        if (read_id_list(path, &state->cpus[state->node_count]) > 0)
+            state->node_count++;
+    }
+    if (state->node_count < 2)
+    {
+        mem_free(a, state->cpus);
+        mem_free(a, state->replicas);
+        mem_free(a, state);
+        return BBPE_OK;
+    }
+    mutex_init(&state->lock);
+    *out_state = state;
+    return BBPE_OK;
+}
+
+static void replica_destroy(BBPETokenizer *tok, TableReplica *replica)
+{
+    if (!replica)
+        return;
+    const BBPEAllocator *a = &tok->allocator;
+    word_cache_clear(tok, &replica->word_cache);
+    mutex_destroy(&replica->cache_lock);
+    mem_free(a, replica->rule_start);
+    mem_free(a, replica->rule_items);
+    mem_free(a, replica->merge_pairs);
+    mem_free(a, replica);
+}
+
+/**
+ * @brief 在当前线程上复制分词器的热表 (调用者已将线程绑定到目标节点，且 encoder_prepare 已成功)
+ * @param tok 分词器句柄
+ * @param out_replica 输出副本
+ * @return BBPEStatus
+ */
+static BBPEStatus replica_create(BBPETokenizer *tok, TableReplica **out_replica)
+{
+    const BBPEAllocator *a = &tok->allocator;
+    TableReplica *replica = (TableReplica *)mem_calloc(a, 1, sizeof(TableReplica));
+    if (!replica)
+        return BBPE_ERR_MEMORY;
+    mutex_init(&replica->cache_lock);
+    memcpy(replica->byte_to_id, tok->byte_to_id, sizeof(replica->byte_to_id));
+
+    if (tok->rule_start)
+    {
+        size_t start_bytes = ((size_t)tok->vocab_size + 1) * sizeof(uint32_t);
+        size_t item_bytes = (size_t)tok->rule_start[tok->vocab_size] * sizeof(MergeRuleItem);
+        replica->rule_start = (uint32_t *)mem_alloc(a, start_bytes);
+        replica->rule_items = (MergeRuleItem *)mem_alloc(a, item_bytes);
+        if (!replica->rule_start || !replica->rule_items)
+            goto fail;
+        memcpy(replica->rule_start, tok->rule_start, start_bytes);
+        memcpy(replica->rule_items, tok->rule_items, item_bytes);
+    }
+    if (tok->merge_pairs)
+    {
+        size_t pair_bytes = ((size_t)tok->merge_pair_mask + 1) * sizeof(MergePairSlot);
+        replica->merge_pairs = (MergePairSlot *)mem_alloc(a, pair_bytes);
+        if (!replica->merge_pairs)
+            goto fail;
+        memcpy(replica->merge_pairs, tok->merge_pairs, pair_bytes);
+    }
+    *out_replica = replica;
+    return BBPE_OK;
+
+fail:
+    replica_destroy(tok, replica);
+    return BBPE_ERR_MEMORY;
+}
+
+/**
+ * @brief 释放全部节点副本 (保留节点信息，下次批量编码时重新建立)
+ * @note 合并索引或词级缓存设置改变时调用，调用时不得有其他线程正在编码
+ */
+static void numa_drop_replicas(BBPETokenizer *tok)
+{
+    if (!tok->numa)
+        return;
+    for (int node = 0; node < tok->numa->node_count; node++)
+    {
+        replica_destroy(tok, tok->numa->replicas[node]);
+        tok->numa->replicas[node] = NULL;
+    }
+}
+
+static void numa_state_destroy(BBPETokenizer *tok)
+{
+    if (!tok->numa)
+        return;
+    numa_drop_replicas(tok);
+    mutex_destroy(&tok->numa->lock);
+    mem_free(&tok->allocator, tok->numa->cpus);
+    mem_free(&tok->allocator, tok->numa->replicas);
+    mem_free(&tok->allocator, tok->numa);
+    tok->numa = NULL;
+}
+#endif
+
+/**
+ * @brief 工作线程的 NUMA 绑定状态 (numa_worker_bind / numa_worker_unbind 之间有效)
+ */
+typedef struct
+{
+#ifdef BBPE_NUMA
+    int bound;       /* 1 表示已改变当前线程的 CPU 亲和性 */
+    cpu_set_t saved; /* 绑定前的 CPU 亲和性 */
+#else
+    int unused;
+#endif
+} NumaBinding;
+
+/**
+ * @brief 将批量/并行编码的当前工作线程绑定到下一个节点，并让工作区使用该节点的副本
+ * @param tok 分词器句柄
+ * @param ws 工作线程的工作区
+ * @param binding 输出绑定状态，结束时交给 numa_worker_unbind
+ * @note 未启用 NUMA 副本时什么也不做；绑定或复制失败时工作区继续使用分词器自身的表，不影响编码结果
+ */
+static void numa_worker_bind(BBPETokenizer *tok, BBPEWorkspace *ws, NumaBinding *binding)
+{
+    memset(binding, 0, sizeof(*binding));
+#ifdef BBPE_NUMA
+    NumaState *state = tok->numa;
+    if (!state || encoder_prepare(tok) != BBPE_OK)
+        return;
+    mutex_lock(&state->lock);
+    int node = state->next_node;
+    state->next_node = (node + 1) % state->node_count;
+    mutex_unlock(&state->lock);
+
+    pthread_t self = pthread_self();
+    if (pthread_getaffinity_np(self, sizeof(cpu_set_t), &binding->saved) != 0 ||
+        pthread_setaffinity_np(self, sizeof(cpu_set_t), &state->cpus[node]) != 0)
+        return;
+    binding->bound = 1;
+
+    // 副本在已绑定的线程上分配并写入，页面按首次访问落在本节点
+    mutex_lock(&state->lock);
+    if (!state->replicas[node])
+        replica_create(tok, &state->replicas[node]);
+    ws->replica = state->replicas[node];
+    mutex_unlock(&state->lock);
+#else
+    (void)tok;
+    (void)ws;
+#endif
+}
+
+/**
+ * @brief 解除 numa_worker_bind 的绑定：恢复线程原来的 CPU 亲和性
+ */
+static void numa_worker_unbind(BBPEWorkspace *ws, const NumaBinding *binding)
+{
+#ifdef BBPE_NUMA
+    ws->replica = NULL;
+    if (binding->bound)
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &binding->saved);
+#else
+    (void)ws;
+    (void)binding;
+#endif
+}
+
+// ============================================================================
+// 公共 API 实现
+// ============================================================================
+
+BBPEStatus bbpe_init(const char *json_content, BBPETokenizer **out_tokenizer)
+{
+    return bbpe_init_ex(json_content, 0, out_tokenizer);
+}
+
+BBPEStatus bbpe_init_ex(const char *json_content, uint32_t flags, BBPETokenizer **out_tokenizer)
+{
+    return bbpe_init_alloc(json_content, flags, NULL, out_tokenizer);
+}
+
+BBPEStatus bbpe_init_alloc(const char *json_content, uint32_t flags, const BBPEAllocator *allocator,
+                           BBPETokenizer **out_tokenizer)
+{
+    if (!json_content || !out_tokenizer || !allocator_valid(allocator))
+        return BBPE_ERR_INVALID_INPUT;
+
+    BBPETokenizer *tok = tokenizer_alloc(allocator);
+    if (!tok)
+        return BBPE_ERR_MEMORY;
+
+    // 初始化 Byte 映射并预计算字符串
+    init_byte_mappings(tok);
+    precompute_byte_strings(tok);
+
+    BBPEStatus status;
+    cJSON *normalizer = NULL;
+    cJSON *pre_tok = NULL;
+    cJSON *added_tokens = NULL;
+    JsonIngest in;
+    memset(&in, 0, sizeof(in));
+    in.p = json_content;
+    in.alloc = &tok->allocator;
+    in.max_id = -1;
+    int defer = (flags & LOAD_DEFER_FLAGS) != 0;
+    in.defer_merges = defer;
+    tok->load_flags = flags & LOAD_KEPT_FLAGS;
+    tok->encoder_deferred = defer;
+
+    // ========== 1. 单遍扫描：就地读取 model.vocab 与 model.merges ==========
+    status = ingest_root(&in, tok);
+    if (status != BBPE_OK)
+        goto cleanup;
+    if (!in.vocab_ready)
+    {
+        status = BBPE_ERR_VOCAB_MISSING;
+        goto cleanup;
+    }
+
+    // ========== 2. merges 位于 vocab 之前、不存在、或需要推迟时的补充处理 ==========
+    if (defer)
+    {
+        // 复制 merges 原文 (调用者可在返回后释放 json_content)，首次编码时再解析，没有 merges 时届时构建空规则行；
+        // 只解码时规则行从不构建
+        if (in.merges_at && !(flags & BBPE_LOAD_DECODE_ONLY))
+        {
+            size_t n = (size_t)(in.merges_end - in.merges_at);
+            tok->lazy_merges = (char *)mem_alloc(&tok->allocator, n + 1);
+            if (!tok->lazy_merges)
+            {
+                status = BBPE_ERR_MEMORY;
+                goto cleanup;
+            }
+            memcpy(tok->lazy_merges, in.merges_at, n);
+            tok->lazy_merges[n] = '\0';
+        }
+    }
+    else if (in.merges_at)
+    {
+        in.p = in.merges_at;
+        status = ingest_merges(&in, tok);
+    }
+    else if (!in.has_merges)
+    {
+        // 即使没有 merges，也构建全空的规则行，以便安全访问
+        tok->merge_count = 0;
+        status = build_rule_rows(tok, NULL, 0);
+    }
+    if (status != BBPE_OK)
+        goto cleanup;
+
+    // ========== 3. 解析 normalizer 与 pre_tokenizer ==========
+    // 这几个小片段经 cJSON 解析，其内部分配在本线程内转发到分词器的分配器 (cleanup 处恢复)
+    json_use_allocator(&tok->allocator);
+    if (in.norm_at)
+    {
+        normalizer = cJSON_ParseWithLength(in.norm_at, (size_t)(in.norm_end - in.norm_at));
+        if (!normalizer)
+        {
+            status = BBPE_ERR_JSON_PARSE;
+            goto cleanup;
+        }
+        NormalizerNode **norm_tail = &tok->normalizers;
+        if ((status = parse_normalizer(tok, normalizer, &norm_tail)) != BBPE_OK)
+            goto cleanup;
+    }
+    if (in.pre_tok_at)
+    {
+        pre_tok = cJSON_ParseWithLength(in.pre_tok_at, (size_t)(in.pre_tok_end - in.pre_tok_at));
+        if (!pre_tok)
+        {
+            status = BBPE_ERR_JSON_PARSE;
+            goto cleanup;
+        }
+    }
+    if (pre_tok)
+    {
+        cJSON *type = cJSON_GetObjectItem(pre_tok, "type");
+        if (type && type->valuestring)
+        {
+            PreTokenizerNode *head = NULL;
+            PreTokenizerNode **tail = &head;
+            BBPEStatus parse_status = BBPE_OK;
+
+            if (strcmp(type->valuestring, "Sequence") == 0)
+            {
+                cJSON *pretokenizers = cJSON_GetObjectItem(pre_tok, "pretokenizers");
+                if (pretokenizers && cJSON_IsArray(pretokenizers))
+                {
+                    int size = cJSON_GetArraySize(pretokenizers);
+                    for (int i = 0; i < size; i++)
+                    {
+                        cJSON *item = cJSON_GetArrayItem(pretokenizers, i);
+                        PreTokenizerNode *node = parse_pre_tokenizer_node(tok, item, !defer, &parse_status);
+                        if (!node)
+                        {
+                            while (head)
+                            {
+                                PreTokenizerNode *next = head->next;
+                                if (head->type == PRE_TOKENIZER_REGEX_SPLIT)
+                                {
+                                    mem_free(&tok->allocator, head->config.split.regex_pattern);
+                                    pcre2_code_free(head->config.split.regex_compiled);
+                                }
+                                mem_free(&tok->allocator, head);
+                                head = next;
+                            }
+                            status = parse_status;
+                            goto cleanup;
+                        }
+                        *tail = node;
+                        tail = &node->next;
+                    }
+                }
+            }
+            else
+            {
+                PreTokenizerNode *node = parse_pre_tokenizer_node(tok, pre_tok, !defer, &parse_status);
+                if (!node)
+                {
+                    status = parse_status;
+                    goto cleanup;
+                }
+                head = node;
+            }
+            tok->pre_tokenizers = head;
+        }
+    }
+
+    // ========== 4. 解析 added_tokens ==========
+    if (in.added_at)
+    {
+        added_tokens = cJSON_ParseWithLength(in.added_at, (size_t)(in.added_end - in.added_at));
+        if (!added_tokens)
+        {
+            status = BBPE_ERR_JSON_PARSE;
+            goto cleanup;
+        }
+    }
+    if ((status = ingest_added_tokens(tok, added_tokens)) != BBPE_OK)
+        goto cleanup;
+    status = build_special_trie(tok);
+    if (status == BBPE_OK)
+        status = build_decode_table(tok);
+
+cleanup:
+    cJSON_Delete(normalizer);
+    cJSON_Delete(pre_tok);
+    cJSON_Delete(added_tokens);
+    json_use_allocator(NULL);
+    mem_free(in.alloc, in.key.data);
+    mem_free(in.alloc, in.value.data);
+    if (status != BBPE_OK)
+    {
+        bbpe_destroy(tok);
+        return status;
+    }
+    *out_tokenizer = tok;
+    return BBPE_OK;
+}
+
+BBPEStatus bbpe_derive(BBPETokenizer *base, const char *json, BBPETokenizer **out_tokenizer)
+{
+    if (!base || !json || !out_tokenizer)
+        return BBPE_ERR_INVALID_INPUT;
+    BBPETokenizer *root = base->base ? base->base : base;
+
+    // 共享的规则行须先构建完成；只解码的基础分词器没有规则行，派生的分词器同样只能解码
+    BBPEStatus status;
+    if (!(root->load_flags & BBPE_LOAD_DECODE_ONLY) && (status = encoder_prepare(root)) != BBPE_OK)
+        return status;
+
+    BBPETokenizer *tok = tokenizer_alloc(&root->allocator);
+    if (!tok)
+        return BBPE_ERR_MEMORY;
+    // 先挂上基础分词器的引用：此后失败时 bbpe_destroy 只释放自己持有的部分
+    tok->base = root;
+    atomic_add(&root->refs, 1);
+
+    cJSON *added_tokens = NULL;
+    JsonIngest in;
+    memset(&in, 0, sizeof(in));
+    in.p = json;
+    in.alloc = &tok->allocator;
+
+    tok->vocab = root->vocab;
+    memcpy(tok->byte_to_unicode, root->byte_to_unicode, sizeof(tok->byte_to_unicode));
+    memcpy(tok->unicode_to_byte, root->unicode_to_byte, sizeof(tok->unicode_to_byte));
+    memcpy(tok->byte_vocab_strs, root->byte_vocab_strs, sizeof(tok->byte_vocab_strs));
+    tok->merge_count = root->merge_count;
+    tok->rule_start = root->rule_start;
+    tok->rule_items = root->rule_items;
+    tok->rule_items_in_image = root->rule_items_in_image;
+    tok->normalizers = root->normalizers;
+    tok->pre_tokenizers = root->pre_tokenizers;
+    tok->load_flags = root->load_flags;
+    tok->encoder_deferred = flag_load(&root->encoder_deferred);
+    tok->cache_capacity = base->cache_capacity;
+    tok->cache_policy = base->cache_policy;
+    tok->limits = base->limits;
+
+    // id 索引覆盖基础分词器的全部 ID，特殊 token 只来自变体
+    tok->vocab_size = root->vocab_size;
+    if ((status = id_table_alloc(tok, tok->vocab_size)) != BBPE_OK)
+        goto cleanup;
+    vocab_table_finish(tok);
+
+    if ((status = locate_added_tokens(&in)) != BBPE_OK)
+        goto cleanup;
+    json_use_allocator(&tok->allocator);
+    if (in.added_at)
+    {
+        added_tokens = cJSON_ParseWithLength(in.added_at, (size_t)(in.added_end - in.added_at));
+        if (!added_tokens)
+        {
+            status = BBPE_ERR_JSON_PARSE;
+            goto cleanup;
+        }
+    }
+    if ((status = ingest_added_tokens(tok, added_tokens)) != BBPE_OK ||
+        (status = build_special_trie(tok)) != BBPE_OK || (status = build_decode_table(tok)) != BBPE_OK)
+        goto cleanup;
+
+    // 合并索引、整词直查与前缀索引的设置从 base 继承 (哈希表直接共享基础分词器的)
+    if (base->merge_pairs && (status = bbpe_set_merge_index(tok, BBPE_MERGE_INDEX_HASH)) != BBPE_OK)
+        goto cleanup;
+    if (base->stable_tokens && (status = bbpe_set_whole_token_lookup(tok, 1)) != BBPE_OK)
+        goto cleanup;
+    if (base->prefix_ids)
+        status = bbpe_set_prefix_index(tok, 1);
+
+cleanup:
+    cJSON_Delete(added_tokens);
+    json_use_allocator(NULL);
+    mem_free(in.alloc, in.key.data);
+    mem_free(in.alloc, in.value.data);
+    if (status != BBPE_OK)
+    {
+        bbpe_destroy(tok);
+        return status;
+    }
+    *out_tokenizer = tok;
+    return BBPE_OK;
+}
+
+BBPEStatus bbpe_encode(BBPETokenizer *tokenizer, const char *text, BBPEOutput *out_output)
+{
+    if (!text)
+        return BBPE_ERR_INVALID_INPUT;
+    return bbpe_encode_n(tokenizer, text, strlen(text), out_output);
+}
+
+/**
+ * @brief 确保字节区间数组至少容纳 n 个元素 (按倍数扩展)
+ * @return BBPEStatus
+ */
+static BBPEStatus offsets_reserve(BBPEOffsets *offsets, size_t n)
+{
+    if (n <= offsets->capacity)
+        return BBPE_OK;
+    size_t new_cap = offsets->capacity ? offsets->capacity : 16;
+    while (new_cap < n)
+    {
+        if (new_cap > SIZE_MAX / (2 * sizeof(size_t)))
+            return BBPE_ERR_MEMORY;
+        new_cap *= 2;
+    }
+    size_t *start = (size_t *)realloc(offsets->start, new_cap * sizeof(size_t));
+    if (!start)
+        return BBPE_ERR_MEMORY;
+    offsets->start = start;
+    size_t *end = (size_t *)realloc(offsets->end, new_cap * sizeof(size_t));
+    if (!end)
+        return BBPE_ERR_MEMORY;
+    offsets->end = end;
+    offsets->capacity = new_cap;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 将块内位置 (含前缀空格) 换算为块文本中的偏移，并限制在块文本之内
+ * @param pos 块内位置
+ * @param prefix_spaces 块前补充的空格数 (不对应输入中的字节)
+ * @param len 块文本字节数
+ * @return 块文本中的偏移 (0 ~ len)
+ */
+static inline size_t chunk_text_offset(size_t pos, size_t prefix_spaces, size_t len)
+{
+    pos = pos > prefix_spaces ? pos - prefix_spaces : 0;
+    return pos < len ? pos : len;
+}
+
+/**
+ * @brief 为一个文本块新产生的 token 计算字节区间 (按 encode_chunk 记录的各 token 终点)
+ * @param offsets 输出区间 (count 增加到 to)
+ * @param ends 各 token 在块内 (含前缀空格) 的终点，共 to - from 项
+ * @param from 该块第一个 token 的下标
+ * @param to 该块最后一个 token 之后的下标
+ * @param start 块文本 (不含前缀空格) 在输入中的偏移
+ * @param len 块文本字节数
+ * @param prefix_spaces 块前补充的空格数
+ * @return BBPEStatus
+ */
+static BBPEStatus offsets_record(BBPEOffsets *offsets, const size_t *ends, size_t from, size_t to, size_t start,
+                                 size_t len, size_t prefix_spaces)
+{
+    BBPEStatus status = offsets_reserve(offsets, to);
+    if (status != BBPE_OK)
+        return status;
+    size_t pos = 0; // 上一个 token 的终点
+    for (size_t i = from; i < to; i++)
+    {
+        offsets->start[i] = start + chunk_text_offset(pos, prefix_spaces, len);
+        pos = ends[i - from];
+        offsets->end[i] = start + chunk_text_offset(pos, prefix_spaces, len);
+    }
+    offsets->count = to;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 将工作区中累计的统计计入分词器并清零 (未启用统计时为空操作)
+ */
+static void stats_flush(BBPETokenizer *tok, BBPEWorkspace *ws)
+{
+#ifdef BBPE_ENABLE_STATS
+    // BBPEStats 全部由 uint64_t 组成，按数组逐项累加
+    const uint64_t *src = (const uint64_t *)&ws->stats;
+    mutex_lock(&tok->stats_lock);
+    uint64_t *dst = (uint64_t *)&tok->stats;
+    for (size_t i = 0; i < sizeof(BBPEStats) / sizeof(uint64_t); i++)
+        dst[i] += src[i];
+    mutex_unlock(&tok->stats_lock);
+    memset(&ws->stats, 0, sizeof(ws->stats));
+#else
+    (void)tok;
+    (void)ws;
+#endif
+}
+
+/**
+ * @brief 编码主流程：特殊 token 提取 → 预分词 → 逐块 BPE 合并，结果追加到 sink
+ * @param tok 分词器句柄
+ * @param ws 工作区
+ * @param text 输入文本
+ * @param len 输入文本字节数
+ * @param sink 输出目标
+ * @param offsets 为 NULL 时不计算字节区间；否则 sink 须为可增长的缓冲区，区间与其中的 ID 一一对应
+ * @return BBPEStatus
+ */
+static BBPEStatus encode_text(BBPETokenizer *tok, BBPEWorkspace *ws, const char *text, size_t len, IdSink *sink,
+                              BBPEOffsets *offsets)
+{
+    BBPEStatus status = encoder_prepare(tok);
+    if (status != BBPE_OK)
+        return status;
+    STATS_ADD(ws, encode_calls, 1);
+    STATS_ADD(ws, encode_bytes, len);
+    ws->track_ends = offsets != NULL;
+
+    size_t seg_count = 0;
+    STATS_TIMER(special_start);
+    TRACE_BEGIN(tok, special, len);
+    status = extract_special_tokens(tok, text, len, &ws->allocator, &ws->segments, &ws->segment_capacity,
+                                    &seg_count);
+    STATS_ELAPSED(ws, special_ns, special_start);
+    TRACE_END(tok, special);
+
+    for (size_t i = 0; i < seg_count && status == BBPE_OK; i++)
+    {
+        const TokenSegment *seg = &ws->segments[i];
+        if (ws->cancel && flag_load(ws->cancel))
+        {
+            status = BBPE_ERR_CANCELLED;
+            break;
+        }
+        if (seg->is_special)
+        {
+            // 特殊 token 直接添加 ID
+            STATS_ADD(ws, special_tokens, 1);
+            status = sink_push(sink, &seg->special_id, 1);
+            if (status == BBPE_OK && offsets)
+            {
+                status = offsets_reserve(offsets, sink->count);
+                if (status == BBPE_OK)
+                {
+                    offsets->start[offsets->count] = seg->offset;
+                    offsets->end[offsets->count++] = seg->offset + seg->len;
+                }
+            }
+        }
+        else
+        {
+            // 普通文本段：规范化、预分词后分别编码
+            const char *seg_text;
+            size_t seg_len;
+            const size_t *align = NULL;
+            const PreTokenizedResult *pre_res;
+            STATS_TIMER(pre_start);
+            TRACE_BEGIN(tok, pre_tokenize, seg->len);
+            status = normalize_text(tok, ws, text + seg->offset, seg->len, offsets != NULL, &seg_text, &seg_len,
+                                    &align);
+            if (status == BBPE_OK)
+                status = pre_tokenize(tok, ws, seg_text, seg_len, &pre_res);
+            STATS_ELAPSED(ws, pre_tokenize_ns, pre_start);
+            TRACE_END(tok, pre_tokenize);
+            if (status != BBPE_OK)
+                break;
+
+            STATS_TIMER(merge_start);
+            TRACE_BEGIN(tok, merge, seg_len);
+            for (size_t j = 0; j < pre_res->count && status == BBPE_OK; j++)
+            {
+                const ChunkSpan *span = &pre_res->spans[j];
+                size_t before = sink->count;
+                if (ws->cancel && (j & 63) == 63 && flag_load(ws->cancel))
+                {
+                    status = BBPE_ERR_CANCELLED; // 每 64 个块检查一次取消标志
+                    break;
+                }
+                status = encode_chunk(tok, seg_text + span->offset, span->len, span->prefix_spaces, ws, sink);
+                if (status != BBPE_OK || !offsets)
+                    continue;
+                status = offsets_record(offsets, ws->chunk_ends, before, sink->count,
+                                        (align ? 0 : seg->offset) + span->offset, span->len, span->prefix_spaces);
+                for (size_t k = before; align && k < sink->count; k++)
+                {
+                    // 规范化结果中的区间换算回原文
+                    offsets->start[k] = seg->offset + align[offsets->start[k]];
+                    offsets->end[k] = seg->offset + norm_align_end(align, seg_len, offsets->end[k]);
+                }
+            }
+            STATS_ELAPSED(ws, merge_ns, merge_start);
+            TRACE_END(tok, merge);
+        }
+    }
+    ws->track_ends = 0;
+    stats_flush(tok, ws);
+    return status;
+}
+
+BBPEStatus bbpe_encode_n(BBPETokenizer *tokenizer, const char *text, size_t len, BBPEOutput *out_output)
+{
+    if (!out_output)
+        return BBPE_ERR_INVALID_INPUT;
+    out_output->ids = NULL;
+    out_output->count = 0;
+    out_output->capacity = 0;
+    BBPEStatus status = bbpe_encode_reuse_ws(tokenizer, NULL, text, len, out_output);
+    if (status != BBPE_OK)
+        bbpe_free_output(out_output); // 失败时不留下需要调用者释放的缓冲区
+    return status;
+}
+
+BBPEStatus bbpe_encode_reuse(BBPETokenizer *tokenizer, const char *text, size_t len, BBPEOutput *output)
+{
+    return bbpe_encode_reuse_ws(tokenizer, NULL, text, len, output);
+}
+
+BBPEStatus bbpe_encode_into(BBPETokenizer *tokenizer, const char *text, size_t len,
+                            int32_t *ids, size_t capacity, size_t *out_count)
+{
+    return bbpe_encode_into_ws(tokenizer, NULL, text, len, ids, capacity, out_count);
+}
+
+BBPEStatus bbpe_count_tokens(BBPETokenizer *tokenizer, const char *text, size_t len, size_t *out_count)
+{
+    return bbpe_count_tokens_ws(tokenizer, NULL, text, len, out_count);
+}
+
+BBPEStatus bbpe_encode_reuse_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                const char *text, size_t len, BBPEOutput *output)
+{
+    if (!tokenizer || (!text && len > 0) || !output)
+        return BBPE_ERR_INVALID_INPUT;
+
+    IdSink sink = {output->ids, 0, output->capacity, 1};
+    if (sink.capacity == 0)
+    {
+        // 首次使用时按经验比例 (约 4 字节一个 token) 一次性预留，避免逐块扩展
+        int32_t *dst;
+        size_t room;
+        BBPEStatus status = sink_reserve(&sink, len / 4 + 16, &dst, &room);
+        if (status != BBPE_OK)
+            return status;
+    }
+
+    // 未提供工作区时使用本次调用内的临时工作区
+    BBPEWorkspace local_ws;
+    workspace_init(&local_ws, &tokenizer->allocator);
+    BBPEStatus status = encode_text(tokenizer, workspace ? workspace : &local_ws, text, len, &sink, NULL);
+    workspace_release(&local_ws);
+
+    output->ids = sink.ids;
+    output->capacity = sink.capacity;
+    output->count = status == BBPE_OK ? sink.count : 0;
+    return status;
+}
+
+BBPEStatus bbpe_encode_into_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace, const char *text, size_t len,
+                               int32_t *ids, size_t capacity, size_t *out_count)
+{
+    if (!tokenizer || (!text && len > 0) || (!ids && capacity > 0) || !out_count)
+        return BBPE_ERR_INVALID_INPUT;
+
+    IdSink sink = {ids, 0, capacity, 0};
+    BBPEWorkspace local_ws;
+    workspace_init(&local_ws, &tokenizer->allocator);
+    BBPEStatus status = encode_text(tokenizer, workspace ? workspace : &local_ws, text, len, &sink, NULL);
+    workspace_release(&local_ws);
+    if (status != BBPE_OK)
+        return status;
+    *out_count = sink.count;
+    return sink.count > capacity ? BBPE_ERR_BUFFER_TOO_SMALL : BBPE_OK;
+}
+
+BBPEStatus bbpe_count_tokens_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                const char *text, size_t len, size_t *out_count)
+{
+    if (!tokenizer || (!text && len > 0) || !out_count)
+        return BBPE_ERR_INVALID_INPUT;
+
+    // 容量为 0 的固定输出目标：各块只累加 ID 数，不写入也不扩展
+    IdSink sink = {NULL, 0, 0, 0};
+    BBPEWorkspace local_ws;
+    workspace_init(&local_ws, &tokenizer->allocator);
+    BBPEStatus status = encode_text(tokenizer, workspace ? workspace : &local_ws, text, len, &sink, NULL);
+    workspace_release(&local_ws);
+    *out_count = status == BBPE_OK ? sink.count : 0;
+    return status;
+}
+
+/**
+ * @brief 反转 ID 数组 (截断开头时从后向前编码，各块结果先反转，最后整体再反转一次)
+ */
+static void reverse_ids(int32_t *ids, size_t n)
+{
+    for (size_t i = 0, j = n; i + 1 < j; i++, j--)
+    {
+        int32_t t = ids[i];
+        ids[i] = ids[j - 1];
+        ids[j - 1] = t;
+    }
+}
+
+/**
+ * @brief 截断编码的进度
+ */
+typedef struct
+{
+    size_t max_tokens; /* token 数上限 */
+    int keep_tail;     /* 1 表示保留末尾 (从后向前编码，sink 中为逆序) */
+    int done;          /* 已达到 max_tokens */
+    size_t offset;     /* 达到上限时截断处在原文中的字节偏移 */
+} TruncateState;
+
+/**
+ * @brief 截断编码一个预分词块，超出上限时只保留所需的 token 并记录截断偏移
+ * @param tok 分词器句柄
+ * @param ws 工作区
+ * @param text 输入文本
+ * @param start 块文本 (不含前缀空格) 在 text 中的偏移
+ * @param len 块文本字节数
+ * @param prefix_spaces 块前需补充的空格数
+ * @param st 截断进度
+ * @param sink 输出目标
+ * @return BBPEStatus
+ */
+static BBPEStatus truncate_encode_chunk(BBPETokenizer *tok, BBPEWorkspace *ws, const char *text, size_t start,
+                                        size_t len, size_t prefix_spaces, TruncateState *st, IdSink *sink)
+{
+    size_t before = sink->count;
+    BBPEStatus status = encode_chunk(tok, text + start, len, prefix_spaces, ws, sink);
+    if (status != BBPE_OK)
+        return status;
+    if (st->keep_tail)
+        reverse_ids(sink->ids + before, sink->count - before);
+    if (sink->count < st->max_tokens)
+        return BBPE_OK;
+
+    // 截断处取自 encode_chunk 记录的 token 终点 (按块内原顺序)：保留开头时为第 keep 个 token 的终点，
+    // 保留末尾时为丢弃的前 count - keep 个 token 的终点
+    size_t count = sink->count - before;
+    size_t keep = st->max_tokens - before;
+    size_t pos;
+    if (st->keep_tail)
+        pos = count > keep ? ws->chunk_ends[count - keep - 1] : 0;
+    else
+        pos = ws->chunk_ends[keep - 1];
+    st->offset = start + chunk_text_offset(pos, prefix_spaces, len);
+    sink->count = st->max_tokens;
+    st->done = 1;
+    return BBPE_OK;
+}
+
+/**
+ * @brief 截断编码一个普通文本段：规范化后条件允许时按窗口逐段预分词，达到上限即停止
+ * @param tok 分词器句柄
+ * @param ws 工作区
+ * @param text 输入文本
+ * @param seg_offset 文本段在 text 中的偏移
+ * @param raw_len 文本段字节数
+ * @param st 截断进度 (截断偏移换算回原文)
+ * @param sink 输出目标
+ * @return BBPEStatus
+ */
+static BBPEStatus truncate_encode_segment(BBPETokenizer *tok, BBPEWorkspace *ws, const char *text,
+                                          size_t seg_offset, size_t raw_len, TruncateState *st, IdSink *sink)
+{
+    const char *seg_text;
+    size_t seg_len;
+    const size_t *align;
+    STATS_TIMER(norm_start);
+    TRACE_BEGIN(tok, pre_tokenize, raw_len);
+    BBPEStatus status = normalize_text(tok, ws, text + seg_offset, raw_len, 1, &seg_text, &seg_len, &align);
+    STATS_ELAPSED(ws, pre_tokenize_ns, norm_start);
+    TRACE_END(tok, pre_tokenize);
+    if (status != BBPE_OK)
+        return status;
+    const uint8_t *s = (const uint8_t *)seg_text;
+    // 非法 UTF-8 的段整体作为一个块，不能分窗口
+    int windowed = pre_tokenizer_restartable(tok) && utf8_validate(s, seg_len);
+    size_t lo = 0;
+    size_t hi = seg_len; // [lo, hi) 为尚未编码的部分
+    while (lo < hi && !st->done)
+    {
+        size_t start = lo;
+        size_t end = hi;
+        size_t window = (st->max_tokens - sink->count) * TRUNCATE_BYTES_PER_TOKEN;
+        if (window < TRUNCATE_WINDOW_MIN)
+            window = TRUNCATE_WINDOW_MIN;
+        if (windowed && hi - lo > window)
+        {
+            if (st->keep_tail)
+                start = split_find_cut(NULL, s, seg_len, lo, hi, hi - window, 0);
+            else
+                end = split_find_cut(NULL, s, seg_len, lo, hi, lo + window, 1);
+        }
+
+        const PreTokenizedResult *pre_res;
+        STATS_TIMER(pre_start);
+        TRACE_BEGIN(tok, pre_tokenize, end - start);
+        status = pre_tokenize(tok, ws, seg_text + start, end - start, &pre_res);
+        STATS_ELAPSED(ws, pre_tokenize_ns, pre_start);
+        TRACE_END(tok, pre_tokenize);
+        if (status != BBPE_OK)
+            return status;
+
+        STATS_TIMER(merge_start);
+        TRACE_BEGIN(tok, merge, end - start);
+        for (size_t j = 0; j < pre_res->count && !st->done && status == BBPE_OK; j++)
+        {
+            const ChunkSpan *span = &pre_res->spans[st->keep_tail ? pre_res->count - 1 - j : j];
+            status = truncate_encode_chunk(tok, ws, seg_text, start + span->offset, span->len, span->prefix_spaces,
+                                           st, sink);
+        }
+        STATS_ELAPSED(ws, merge_ns, merge_start);
+        TRACE_END(tok, merge);
+        if (status != BBPE_OK)
+            return status;
+
+        if (st->keep_tail)
+            hi = start;
+        else
+            lo = end;
+    }
+    if (st->done)
+    {
+        // 截断偏移在规范化结果中：保留末尾时为所留部分的起点，保留开头时为所留部分的终点
+        if (align)
+            st->offset = st->keep_tail ? align[st->offset] : norm_align_end(align, seg_len, st->offset);
+        st->offset += seg_offset;
+    }
+    return BBPE_OK;
+}
+
+/**
+ * @brief 截断编码主流程：按方向逐段编码，达到上限后不再处理剩余文本
+ * @param tok 分词器句柄
+ * @param ws 工作区
+ * @param text 输入文本
+ * @param len 输入文本字节数
+ * @param max_tokens token 数上限
+ * @param side 截断方向
+ * @param sink 输出目标 (可增长)
+ * @param out_offset 输出截断偏移
+ * @return BBPEStatus
+ */
+static BBPEStatus encode_text_truncated(BBPETokenizer *tok, BBPEWorkspace *ws, const char *text, size_t len,
+                                        size_t max_tokens, BBPETruncation side, IdSink *sink, size_t *out_offset)
+{
+    TruncateState st = {max_tokens, side == BBPE_TRUNCATE_LEFT, 0, 0};
+    *out_offset = st.keep_tail ? 0 : len;
+    BBPEStatus status = encoder_prepare(tok);
+    if (status != BBPE_OK)
+        return status;
+    if (max_tokens == 0)
+    {
+        *out_offset = st.keep_tail ? len : 0;
+        return BBPE_OK;
+    }
+    STATS_ADD(ws, encode_calls, 1);
+    STATS_ADD(ws, encode_bytes, len);
+    ws->track_ends = 1;
+
+    size_t seg_count = 0;
+    STATS_TIMER(special_start);
+    TRACE_BEGIN(tok, special, len);
+    status = extract_special_tokens(tok, text, len, &ws->allocator, &ws->segments, &ws->segment_capacity,
+                                    &seg_count);
+    STATS_ELAPSED(ws, special_ns, special_start);
+    TRACE_END(tok, special);
+
+    for (size_t i = 0; i < seg_count && !st.done && status == BBPE_OK; i++)
+    {
+        const TokenSegment *seg = &ws->segments[st.keep_tail ? seg_count - 1 - i : i];
+        if (seg->is_special)
+        {
+            STATS_ADD(ws, special_tokens, 1);
+            status = sink_push(sink, &seg->special_id, 1);
+            if (status == BBPE_OK && sink->count == max_tokens)
+            {
+                st.done = 1;
+                st.offset = st.keep_tail ? seg->offset : seg->offset + seg->len;
+            }
+        }
+        else
+            status = truncate_encode_segment(tok, ws, text, seg->offset, seg->len, &st, sink);
+    }
+    ws->track_ends = 0;
+    stats_flush(tok, ws);
+    if (status != BBPE_OK)
+        return status;
+
+    if (st.keep_tail)
+        reverse_ids(sink->ids, sink->count);
+    if (st.done)
+        *out_offset = st.offset;
+    return BBPE_OK;
+}
+
+BBPEStatus bbpe_encode_with_offsets(BBPETokenizer *tokenizer, const char *text, size_t len,
+                                    BBPEOutput *out_output, BBPEOffsets *out_offsets)
+{
+    if (!out_output || !out_offsets)
+        return BBPE_ERR_INVALID_INPUT;
+    memset(out_output, 0, sizeof(*out_output));
+    memset(out_offsets, 0, sizeof(*out_offsets));
+    BBPEStatus status = bbpe_encode_with_offsets_ws(tokenizer, NULL, text, len, out_output, out_offsets);
+    if (status != BBPE_OK)
+    {
+        bbpe_free_output(out_output);
+        bbpe_free_offsets(out_offsets);
+    }
+    return status;
+}
+
+BBPEStatus bbpe_encode_with_offsets_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                       const char *text, size_t len,
+                                       BBPEOutput *output, BBPEOffsets *offsets)
+{
+    if (!tokenizer || (!text && len > 0) || !output || !offsets)
+        return BBPE_ERR_INVALID_INPUT;
+
+    IdSink sink = {output->ids, 0, output->capacity, 1};
+    offsets->count = 0;
+    if (sink.capacity == 0)
+    {
+        // 同 bbpe_encode_reuse_ws 的一次性预留；区间数组随 ID 按需扩展
+        int32_t *dst;
+        size_t room;
+        BBPEStatus status = sink_reserve(&sink, len / 4 + 16, &dst, &room);
+        if (status != BBPE_OK)
+            return status;
+    }
+
+    BBPEWorkspace local_ws;
+    workspace_init(&local_ws, &tokenizer->allocator);
+    BBPEStatus status = encode_text(tokenizer, workspace ? workspace : &local_ws, text, len, &sink, offsets);
+    workspace_release(&local_ws);
+
+    output->ids = sink.ids;
+    output->capacity = sink.capacity;
+    output->count = status == BBPE_OK ? sink.count : 0;
+    if (status != BBPE_OK)
+        offsets->count = 0;
+    return status;
+}
+
+/**
+ * @brief 计算两段文本的公共前缀字节数
+ */
+static size_t common_prefix_len(const char *a, size_t a_len, const char *b, size_t b_len)
+{
+    size_t n = a_len < b_len ? a_len : b_len;
+    size_t i = 0;
+    // 先按块用 memcmp 跳过相同部分，再逐字节定位第一个不同的位置
+    while (i + 4096 <= n && memcmp(a + i, b + i, 4096) == 0)
+        i += 4096;
+    while (i < n && a[i] == b[i])
+        i++;
+    return i;
+}
+
+/**
+ * @brief 统计起点早于 pos 的 token 数 (区间起点按 token 顺序单调不减)
+ */
+static size_t offsets_count_before(const BBPEOffsets *offsets, size_t pos)
+{
+    size_t lo = 0, hi = offsets->count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (offsets->start[mid] < pos)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * @brief 寻找增量编码的起点：位于新旧文本的公共前缀内，且两段文本的整体编码都在此切开
+ * @param tok 分词器句柄
+ * @param ws 工作区
+ * @param old_text 上一次编码的文本
+ * @param old_len 上一次编码的文本字节数
+ * @param text 新文本
+ * @param len 新文本字节数
+ * @param output 上一次的编码结果
+ * @param offsets 上一次结果的字节区间
+ * @param out_cut 输出起点字节偏移 (0 表示全部重新编码)
+ * @param out_keep 输出可复用的 token 数 (即起点之前的 token 数)
+ * @return BBPEStatus
+ * @note 查找从上一次结果中最后一个足够靠前的特殊 token 之后开始：该处是两段文本共同的普通文本段起点，
+ *       因此只需扫描最后一段，而不是整个公共前缀
+ */
+static BBPEStatus incremental_find_cut(BBPETokenizer *tok, BBPEWorkspace *ws, const char *old_text, size_t old_len,
+                                       const char *text, size_t len, const BBPEOutput *output,
+                                       const BBPEOffsets *offsets, size_t *out_cut, size_t *out_keep)
+{
+    *out_cut = 0;
+    *out_keep = 0;
+    size_t prefix = common_prefix_len(old_text, old_len, text, len);
+    size_t hold = special_hold_bytes(tok);
+    size_t horizon = prefix > hold ? prefix - hold : 0;
+
+    // 起点早于 horizon 的特殊 token 的匹配只读取公共前缀内的字节，在新文本中同样成立
+    size_t base = 0;
+    for (size_t i = offsets_count_before(offsets, horizon); i > 0; i--)
+    {
+        int32_t id = output->ids[i - 1];
+        const char *str = token_string(tok, id);
+        if (str && (tok->id_to_entry[id] & ID_ENTRY_SPECIAL) && offsets->end[i - 1] <= prefix &&
+            offsets->end[i - 1] - offsets->start[i - 1] == strlen(str))
+        {
+            base = offsets->end[i - 1];
+            break;
+        }
+    }
+
+    size_t cut;
+    int in_text;
+    BBPEStatus status = find_stable_prefix(tok, ws, text + base, prefix - base, hold, 1, &cut, &in_text);
+    if (status != BBPE_OK)
+        return status;
+    cut += base;
+    if (in_text && (!utf8_validate((const uint8_t *)text + cut, len - cut) ||
+                    !utf8_validate((const uint8_t *)old_text + cut, old_len - cut)))
+    {
+        // 切点之后出现非法 UTF-8 时整段作为一个块，只能在特殊 token 之后切开
+        status = find_stable_prefix(tok, ws, text + base, prefix - base, hold, 0, &cut, &in_text);
+        if (status != BBPE_OK)
+            return status;
+        cut += base;
+    }
+
+    // 上一次的结果须恰好在切点处分开，否则 (结果与 old_text 不对应) 全部重新编码
+    size_t keep = offsets_count_before(offsets, cut);
+    if (keep > 0 && offsets->end[keep - 1] > cut)
+        return BBPE_OK;
+    *out_cut = cut;
+    *out_keep = keep;
+    return BBPE_OK;
+}
+
+BBPEStatus bbpe_encode_incremental(BBPETokenizer *tokenizer, const char *old_text, size_t old_len,
+                                   const char *text, size_t len, BBPEOutput *output, BBPEOffsets *offsets,
+                                   size_t *out_reused)
+{
+    return bbpe_encode_incremental_ws(tokenizer, NULL, old_text, old_len, text, len, output, offsets, out_reused);
+}
+
+BBPEStatus bbpe_encode_incremental_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                      const char *old_text, size_t old_len, const char *text, size_t len,
+                                      BBPEOutput *output, BBPEOffsets *offsets, size_t *out_reused)
+{
+    if (!tokenizer || (!old_text && old_len > 0) || (!text && len > 0) || !output || !offsets ||
+        offsets->count != output->count)
+        return BBPE_ERR_INVALID_INPUT;
+    if (out_reused)
+        *out_reused = 0;
+    BBPEStatus status = encoder_prepare(tokenizer);
+    if (status != BBPE_OK)
+        return status;
+
+    BBPEWorkspace local_ws;
+    workspace_init(&local_ws, &tokenizer->allocator);
+    BBPEWorkspace *ws = workspace ? workspace : &local_ws;
+    size_t cut = 0, keep = 0;
+    if (old_len > 0 && len > 0)
+        status = incremental_find_cut(tokenizer, ws, old_text, old_len, text, len, output, offsets, &cut, &keep);
+    if (status == BBPE_OK)
+    {
+        // 保留切点之前的 ID 与区间，之后的部分重新编码并把区间平移到新文本中的位置
+        IdSink sink = {output->ids, keep, output->capacity, 1};
+        offsets->count = keep;
+        status = encode_text(tokenizer, ws, len > 0 ? text + cut : text, len - cut, &sink, offsets);
+        output->ids = sink.ids;
+        output->capacity = sink.capacity;
+        output->count = sink.count;
+        for (size_t i = keep; status == BBPE_OK && i < offsets->count; i++)
+        {
+            offsets->start[i] += cut;
+            offsets->end[i] += cut;
+        }
+    }
+    workspace_release(&local_ws);
+
+    if (status != BBPE_OK)
+    {
+        output->count = 0;
+        offsets->count = 0;
+    }
+    else if (out_reused)
+        *out_reused = keep;
+    return status;
+}
+
+BBPEStatus bbpe_encode_truncated(BBPETokenizer *tokenizer, const char *text, size_t len, size_t max_tokens,
+                                 BBPETruncation side, BBPEOutput *out_output, size_t *out_offset)
+{
+    if (!out_output)
+        return BBPE_ERR_INVALID_INPUT;
+    out_output->ids = NULL;
+    out_output->count = 0;
+    out_output->capacity = 0;
+    BBPEStatus status = bbpe_encode_truncated_ws(tokenizer, NULL, text, len, max_tokens, side, out_output, out_offset);
+    if (status != BBPE_OK)
+        bbpe_free_output(out_output);
+    return status;
+}
 
-    const char *start = text;
-    const char *pos = text;
+BBPEStatus bbpe_encode_truncated_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                    const char *text, size_t len, size_t max_tokens,
+                                    BBPETruncation side, BBPEOutput *output, size_t *out_offset)
+{
+    if (!tokenizer || (!text && len > 0) || !output ||
+        (side != BBPE_TRUNCATE_RIGHT && side != BBPE_TRUNCATE_LEFT))
+        return BBPE_ERR_INVALID_INPUT;
 
-    while (*pos)
+    IdSink sink = {output->ids, 0, output->capacity, 1};
+    if (sink.capacity == 0 && max_tokens > 0)
     {
-        SpecialEntry *best_match = NULL;
-        size_t best_len = 0;
+        // 与 bbpe_encode_reuse_ws 相同的经验比例，但不超过上限 (截断处的块可能临时多出几个)
+        size_t expect = len / 4 + 16;
+        int32_t *dst;
+        size_t room;
+        BBPEStatus status = sink_reserve(&sink, expect < max_tokens ? expect : max_tokens, &dst, &room);
+        if (status != BBPE_OK)
+            return status;
+    }
+
+    BBPEWorkspace local_ws;
+    workspace_init(&local_ws, &tokenizer->allocator);
+    size_t offset;
+    BBPEStatus status = encode_text_truncated(tokenizer, workspace ? workspace : &local_ws, text, len,
+                                              max_tokens, side, &sink, &offset);
+    workspace_release(&local_ws);
+
+    output->ids = sink.ids;
+    output->capacity = sink.capacity;
+    output->count = status == BBPE_OK ? sink.count : 0;
+    if (out_offset)
+        *out_offset = status == BBPE_OK ? offset : 0;
+    return status;
+}
+
+BBPEStatus bbpe_workspace_create_alloc(const BBPEAllocator *allocator, BBPEWorkspace **out_workspace)
+{
+    if (!out_workspace || !allocator_valid(allocator))
+        return BBPE_ERR_INVALID_INPUT;
+    *out_workspace = (BBPEWorkspace *)mem_alloc(allocator, sizeof(BBPEWorkspace));
+    if (!*out_workspace)
+        return BBPE_ERR_MEMORY;
+    workspace_init(*out_workspace, allocator);
+    return BBPE_OK;
+}
+
+BBPEStatus bbpe_workspace_create(BBPEWorkspace **out_workspace)
+{
+    return bbpe_workspace_create_alloc(NULL, out_workspace);
+}
+
+void bbpe_workspace_destroy(BBPEWorkspace *workspace)
+{
+    if (!workspace)
+        return;
+    workspace_release(workspace);
+    BBPEAllocator allocator = workspace->allocator;
+    mem_free(&allocator, workspace);
+}
+
+/**
+ * @brief 文档内并行编码的单个块：预分词块或特殊 token
+ */
+typedef struct
+{
+    size_t offset;        /* 块在输入文本中的起始字节偏移 */
+    size_t len;           /* 块字节数 */
+    size_t prefix_spaces; /* 块前需补充的空格数 */
+    int32_t special_id;   /* 特殊 token 的 ID，普通文本块为 -1 */
+} DocChunk;
+
+/**
+ * @brief 串行地提取特殊 token、规范化并预分词，将整个输入展开为块数组
+ * @param tok 分词器句柄
+ * @param ws 工作区
+ * @param text 输入文本
+ * @param len 输入字节数
+ * @param chunks 块数组 (按需扩展)
+ * @param capacity 块数组容量
+ * @param out_count 输出块数
+ * @param doc 规范化改变了文本时输出整个文档规范化后的副本 (经工作区的分配器按需扩展)，块偏移均相对于它；
+ *            否则保持 NULL，块偏移相对于 text
+ * @param doc_capacity 副本的容量
+ * @param out_len 输出块偏移所在文本的字节数
+ * @return BBPEStatus
+ */
+static BBPEStatus collect_doc_chunks(BBPETokenizer *tok, BBPEWorkspace *ws, const char *text, size_t len,
+                                     DocChunk **chunks, size_t *capacity, size_t *out_count,
+                                     char **doc, size_t *doc_capacity, size_t *out_len)
+{
+    size_t count = 0;
+    size_t seg_count = 0;
+    size_t doc_len = 0;
+    STATS_TIMER(special_start);
+    TRACE_BEGIN(tok, special, len);
+    BBPEStatus status = extract_special_tokens(tok, text, len, &ws->allocator, &ws->segments, &ws->segment_capacity,
+                                               &seg_count);
+    STATS_ELAPSED(ws, special_ns, special_start);
+    TRACE_END(tok, special);
+    if (status != BBPE_OK)
+        return status;
 
-        // 遍历所有特殊 token，找到最长匹配
-        SpecialEntry *entry, *tmp;
-        HASH_ITER(hh, tok->special_tokens_map, entry, tmp)
+    for (size_t i = 0; i < seg_count; i++)
+    {
+        const TokenSegment *seg = &ws->segments[i];
+        size_t base = *doc ? doc_len : seg->offset; // 本段在块偏移所在文本中的起点
+        if (seg->is_special)
         {
-            size_t token_len = strlen(entry->token);
-            if (strncmp(pos, entry->token, token_len) == 0)
+            status = workspace_reserve(&ws->allocator, (void **)chunks, capacity, count + 1, sizeof(DocChunk));
+            if (status == BBPE_OK && *doc)
+                status = workspace_reserve(&ws->allocator, (void **)doc, doc_capacity, doc_len + seg->len, 1);
+            if (status != BBPE_OK)
+                return status;
+            if (*doc)
             {
-                if (token_len > best_len)
-                {
-                    best_len = token_len;
-                    best_match = entry;
-                }
+                memcpy(*doc + doc_len, text + seg->offset, seg->len);
+                doc_len += seg->len;
             }
+            DocChunk *c = &(*chunks)[count++];
+            c->offset = base;
+            c->len = seg->len;
+            c->prefix_spaces = 0;
+            c->special_id = seg->special_id;
+            STATS_ADD(ws, special_tokens, 1);
+            continue;
         }
 
-        if (best_match)
+        const char *seg_text;
+        size_t seg_len;
+        const PreTokenizedResult *pre_res;
+        STATS_TIMER(pre_start);
+        TRACE_BEGIN(tok, pre_tokenize, seg->len);
+        status = normalize_text(tok, ws, text + seg->offset, seg->len, 0, &seg_text, &seg_len, NULL);
+        if (status == BBPE_OK)
+            status = pre_tokenize(tok, ws, seg_text, seg_len, &pre_res);
+        STATS_ELAPSED(ws, pre_tokenize_ns, pre_start);
+        TRACE_END(tok, pre_tokenize);
+        if (status != BBPE_OK)
+            return status;
+        if (!*doc && seg_text != text + seg->offset)
         {
-            // 有普通文本段需要先保存
-            if (pos > start)
-            {
-                size_t normal_len = pos - start;
-                if (normal_len > 0)
-                {
-                    if (count >= capacity)
-                    {
-                        capacity *= 2;
-                        TokenSegment *new_seg = (TokenSegment *)realloc(segments, capacity * sizeof(TokenSegment));
-                        if (!new_seg)
-                        {
-                            // 释放已分配的 segments 及其中的 text
-                            for (size_t i = 0; i < count; i++)
-                                if (!segments[i].is_special && segments[i].text)
-                                    free(segments[i].text);
-                            free(segments);
-                            return NULL;
-                        }
-                        segments = new_seg;
-                    }
-                    segments[count].is_special = 0;
-                    segments[count].text = my_strndup(start, normal_len);
-                    if (!segments[count].text)
-                    {
-                        for (size_t i = 0; i < count; i++)
-                            if (!segments[i].is_special && segments[i].text)
-                                free(segments[i].text);
-                        free(segments);
-                        return NULL;
-                    }
-                    segments[count].special_id = -1;
-                    count++;
-                }
-            }
-
-            // 保存特殊 token 段
-            if (count >= capacity)
-            {
-                capacity *= 2;
-                TokenSegment *new_seg = (TokenSegment *)realloc(segments, capacity * sizeof(TokenSegment));
-                if (!new_seg)
-                {
-                    for (size_t i = 0; i < count; i++)
-                        if (!segments[i].is_special && segments[i].text)
-                            free(segments[i].text);
-                    free(segments);
-                    return NULL;
-                }
-                segments = new_seg;
-            }
-            segments[count].is_special = 1;
-            segments[count].text = NULL;
-            segments[count].special_id = best_match->id;
-            count++;
-
-            start = pos + best_len;
-            pos = start;
+            // 第一个被规范化改变的段：之前的文本与原文相同，整体复制到副本中
+            status = workspace_reserve(&ws->allocator, (void **)doc, doc_capacity, seg->offset + seg_len, 1);
+            if (status != BBPE_OK)
+                return status;
+            memcpy(*doc, text, seg->offset);
+            doc_len = seg->offset;
         }
-        else
+        if (*doc)
         {
-            pos++;
+            status = workspace_reserve(&ws->allocator, (void **)doc, doc_capacity, doc_len + seg_len, 1);
+            if (status != BBPE_OK)
+                return status;
+            memcpy(*doc + doc_len, seg_text, seg_len);
+            doc_len += seg_len;
         }
-    }
-
-    // 处理剩余普通文本
-    if (pos > start)
-    {
-        size_t normal_len = pos - start;
-        if (normal_len > 0)
+        status = workspace_reserve(&ws->allocator, (void **)chunks, capacity, count + pre_res->count, sizeof(DocChunk));
+        if (status != BBPE_OK)
+            return status;
+        for (size_t j = 0; j < pre_res->count; j++)
         {
-            if (count >= capacity)
-            {
-                capacity *= 2;
-                TokenSegment *new_seg = (TokenSegment *)realloc(segments, capacity * sizeof(TokenSegment));
-                if (!new_seg)
-                {
-                    for (size_t i = 0; i < count; i++)
-                        if (!segments[i].is_special && segments[i].text)
-                            free(segments[i].text);
-                    free(segments);
-                    return NULL;
-                }
-                segments = new_seg;
-            }
-            segments[count].is_special = 0;
-            segments[count].text = my_strndup(start, normal_len);
-            if (!segments[count].text)
-            {
-                for (size_t i = 0; i < count; i++)
-                    if (!segments[i].is_special && segments[i].text)
-                        free(segments[i].text);
-                free(segments);
-                return NULL;
-            }
-            segments[count].special_id = -1;
-            count++;
+            DocChunk *c = &(*chunks)[count++];
+            c->offset = base + pre_res->spans[j].offset;
+            c->len = pre_res->spans[j].len;
+            c->prefix_spaces = pre_res->spans[j].prefix_spaces;
+            c->special_id = -1;
         }
     }
-
-    *out_len = count;
-    return segments;
+    *out_count = count;
+    *out_len = *doc ? doc_len : len;
+    return BBPE_OK;
 }
 
 // ============================================================================
-// ByteLevel 映射初始化
+// 批量编码调度 (工作窃取)
 // ============================================================================
+//
+// bbpe_encode_batch 与 bbpe_encode_parallel 共用一个调度器：每个工作线程持有一个任务双端队列，
+// 从自己队列的尾部取任务，队列为空时从其他队列的头部窃取。任务有三种：
+// - DOCS：连续的若干短文档，按总字节数打包，避免逐个领取极短文档的开销；
+// - SPLIT：一个长文档 (不短于 PARALLEL_MIN_BYTES) 的串行阶段，提取特殊 token、预分词并把块划分为区间，
+//   每个区间作为 RANGE 任务压入当前线程的队列，其余线程随即可以窃取；
+// - RANGE：长文档的一个块区间，最后完成的区间按顺序拼接该文档的输出。
+// 区间边界总是落在串行预分词的块边界上，因此每个文档的结果都与 bbpe_encode_n 逐个 ID 相同。
 
 /**
- * @brief 初始化字节与 Unicode 码点的双向映射 (ByteLevel BPE 标准映射)
- * @param tok 分词器句柄
+ * @brief 批量编码任务的种类
  */
-static void init_byte_mappings(BBPETokenizer *tok)
+typedef enum
 {
-    int n = 0;
-    memset(tok->unicode_to_byte, 0, sizeof(tok->unicode_to_byte));
-    for (int b = 0; b < 256; b++)
+    BATCH_TASK_DOCS,  /* 连续的若干短文档，逐个整体编码 */
+    BATCH_TASK_SPLIT, /* 长文档的串行阶段，产生该文档的 RANGE 任务 */
+    BATCH_TASK_RANGE  /* 长文档的一个块区间 */
+} BatchTaskKind;
+
+/**
+ * @brief 批量编码任务
+ */
+typedef struct
+{
+    BatchTaskKind kind; /* 任务种类 */
+    size_t doc;         /* DOCS：首个文档下标；SPLIT / RANGE：所属文档下标 */
+    size_t end;         /* DOCS：末尾文档下标 (不含)；SPLIT / RANGE：拆分状态 (BatchJob.splits) 下标 */
+    size_t range;       /* RANGE：区间下标 */
+} BatchTask;
+
+/**
+ * @brief 工作线程的任务双端队列：所有者从尾部压入与取出，其他线程从头部窃取
+ */
+typedef struct
+{
+    BatchTask *tasks;  /* 任务数组，有效任务为 [top, bottom) */
+    size_t top;        /* 窃取端 (最早压入的任务) */
+    size_t bottom;     /* 所有者端 (最近压入的任务之后) */
+    size_t capacity;   /* 数组容量 (元素个数) */
+    bbpe_mutex_t lock; /* 保护本队列 */
+} TaskDeque;
+
+/**
+ * @brief 长文档的拆分状态：SPLIT 任务建立，最后完成的 RANGE 任务拼接输出并释放
+ */
+typedef struct
+{
+    DocChunk *chunks;         /* 串行预分词得到的全部块 */
+    char *text;               /* 规范化后的文档 (规范化改变了文本时才有)，NULL 表示块偏移相对于原文 */
+    size_t *bounds;           /* 区间 r 覆盖块 [bounds[r], bounds[r+1]) */
+    IdSink *sinks;            /* 每个区间的输出 */
+    size_t range_count;       /* 区间数 */
+    size_t remaining;         /* 尚未完成的区间数 (受 BatchJob.lock 保护) */
+    size_t failed_range;      /* 失败区间的最小下标，range_count 表示尚无失败 (受 BatchJob.lock 保护) */
+    BBPEStatus failed_status; /* failed_range 对应的错误码 */
+} BatchSplit;
+
+/**
+ * @brief 批量编码的共享任务状态
+ */
+typedef struct
+{
+    BBPETokenizer *tok;       /* 共享的分词器 (只读) */
+    const char *const *texts; /* 文档数组 */
+    const size_t *lens;       /* 文档字节数数组 (调用者未提供时由 strlen 预先计算) */
+    BBPEOutput *outputs;      /* 与 texts 一一对应的输出 */
+    size_t count;             /* 文档数 */
+    int num_threads;          /* 工作线程数，长文档按它划分区间 */
+    TaskDeque *deques;        /* 每个工作线程一个任务队列 */
+    BatchSplit *splits;       /* 每个长文档一个拆分状态 */
+    int next_worker;          /* 下一个启动的工作线程使用的队列下标 (受 lock 保护) */
+    size_t pending_splits;    /* 尚未完成的 SPLIT 任务数，为 0 后不会再产生新任务 (受 lock 保护) */
+    size_t epoch;             /* SPLIT 任务每压入一批区间任务递增，空闲线程据此判断是否重新查找 (受 lock 保护) */
+    size_t failed_index;      /* 失败文档的最小下标，count 表示尚无失败 (受 lock 保护) */
+    BBPEStatus failed_status; /* failed_index 对应的错误码 */
+    bbpe_mutex_t lock;        /* 保护以上标注的字段与各拆分状态的计数 */
+    bbpe_cond_t wake;         /* SPLIT 任务完成时广播 */
+} BatchJob;
+
+/**
+ * @brief 将 n 个任务压入队列尾部
+ * @return BBPEStatus
+ */
+static BBPEStatus deque_push(const BBPEAllocator *a, TaskDeque *dq, const BatchTask *tasks, size_t n)
+{
+    mutex_lock(&dq->lock);
+    // 已被取走的头部空间不再使用，先整体前移再按需扩容
+    if (dq->top > 0)
     {
-        // 可打印字符映射到自身，其他映射到 256+ 的私有码点
-        if ((b >= 33 && b <= 126) || (b >= 161 && b <= 172) || (b >= 174 && b <= 255))
-        {
-            tok->byte_to_unicode[b] = b;
-        }
-        else
-        {
-            tok->byte_to_unicode[b] = 256 + n;
-            n++;
-        }
-        tok->unicode_to_byte[tok->byte_to_unicode[b]] = (uint8_t)b;
+        memmove(dq->tasks, dq->tasks + dq->top, (dq->bottom - dq->top) * sizeof(BatchTask));
+        dq->bottom -= dq->top;
+        dq->top = 0;
+    }
+    BBPEStatus status = workspace_reserve(a, (void **)&dq->tasks, &dq->capacity, dq->bottom + n, sizeof(BatchTask));
+    if (status == BBPE_OK)
+    {
+        memcpy(dq->tasks + dq->bottom, tasks, n * sizeof(BatchTask));
+        dq->bottom += n;
     }
+    mutex_unlock(&dq->lock);
+    return status;
 }
 
 /**
- * @brief 预计算所有字节对应的 UTF-8 字符串 (用于快速查找字节 token)
- * @param tok 分词器句柄
+ * @brief 取一个任务：先从自己队列的尾部取 (最近压入、缓存最热)，再依次从其他队列的头部窃取
+ * @return 1 表示取到任务，0 表示所有队列均为空
  */
-static void precompute_byte_strings(BBPETokenizer *tok)
+static int batch_take_task(BatchJob *job, int self, BatchTask *out_task)
 {
-    for (int b = 0; b < 256; b++)
+    TaskDeque *own = &job->deques[self];
+    mutex_lock(&own->lock);
+    int found = own->bottom > own->top;
+    if (found)
+        *out_task = own->tasks[--own->bottom];
+    mutex_unlock(&own->lock);
+
+    for (int k = 1; !found && k < job->num_threads; k++)
     {
-        uint32_t cp = tok->byte_to_unicode[b];
-        char *buf = (char *)malloc(5);
-        int len = utf8_encode(cp, buf);
-        buf[len] = '\0';
-        tok->byte_vocab_strs[b] = buf;
+        TaskDeque *victim = &job->deques[(self + k) % job->num_threads];
+        mutex_lock(&victim->lock);
+        found = victim->bottom > victim->top;
+        if (found)
+            *out_task = victim->tasks[victim->top++];
+        mutex_unlock(&victim->lock);
     }
+    return found;
 }
 
-// ============================================================================
-// 预分词相关函数
-// ============================================================================
+/**
+ * @brief 记录文档失败 (只保留下标最小的一个)
+ */
+static void batch_fail(BatchJob *job, size_t doc, BBPEStatus status)
+{
+    mutex_lock(&job->lock);
+    if (doc < job->failed_index)
+    {
+        job->failed_index = doc;
+        job->failed_status = status;
+    }
+    mutex_unlock(&job->lock);
+}
 
 /**
- * @brief 释放预分词结果
- * @param res 预分词结果指针
+ * @brief 文档 doc 是否已无需编码：已有下标更小的文档失败时，结果必然被丢弃
+ * @note 下标不大于 failed_index 的文档总会被编码，因此最终记录的一定是下标最小的失败文档
  */
-static void free_pre_tokenized(PreTokenizedResult *res)
+static int batch_skip(BatchJob *job, size_t doc)
 {
-    if (!res)
-        return;
-    for (size_t i = 0; i < res->count; i++)
-        free(res->chunks[i]);
-    free(res->chunks);
-    res->chunks = NULL;
-    res->count = 0;
+    mutex_lock(&job->lock);
+    int skip = doc > job->failed_index;
+    mutex_unlock(&job->lock);
+    return skip;
+}
+
+static void batch_split_release(BBPETokenizer *tok, BatchSplit *split)
+{
+    if (split->sinks)
+    {
+        for (size_t r = 0; r < split->range_count; r++)
+            free(split->sinks[r].ids); // 各区间的输出经 sink_reserve 以 malloc 分配
+        mem_free(&tok->allocator, split->sinks);
+    }
+    mem_free(&tok->allocator, split->bounds);
+    mem_free(&tok->allocator, split->chunks);
+    mem_free(&tok->allocator, split->text);
+    memset(split, 0, sizeof(*split));
 }
 
 /**
- * @brief 应用单个预分词器到文本
- * @param node 预分词器节点
- * @param text 输入文本
- * @param out 输出预分词结果 (调用者需使用 free_pre_tokenized 释放)
+ * @brief SPLIT 任务：串行展开长文档并按字节数把连续的块划分为区间
+ * @param job 批量编码任务
+ * @param ws 工作区
+ * @param doc 文档下标
+ * @param split 输出拆分状态 (失败时已释放)
  * @return BBPEStatus
  */
-static BBPEStatus apply_single_pre_tokenizer(PreTokenizerNode *node, const char *text, PreTokenizedResult *out)
+static BBPEStatus batch_split_doc(BatchJob *job, BBPEWorkspace *ws, size_t doc, BatchSplit *split)
 {
-    // 初始化输出结构为空
-    out->chunks = NULL;
-    out->count = 0;
+    BBPETokenizer *tok = job->tok;
+    size_t len = job->lens[doc];
+    size_t chunk_capacity = 0;
+    size_t chunk_count = 0;
+    size_t text_capacity = 0;
+    if (!job->texts[doc])
+        return BBPE_ERR_INVALID_INPUT;
+    STATS_ADD(ws, encode_calls, 1);
+    STATS_ADD(ws, encode_bytes, len);
+    BBPEStatus status = collect_doc_chunks(tok, ws, job->texts[doc], len, &split->chunks, &chunk_capacity,
+                                           &chunk_count, &split->text, &text_capacity, &len);
+    if (status != BBPE_OK)
+        goto cleanup;
 
-    if (node->type == PRE_TOKENIZER_BYTE_LEVEL)
+    // 区间数约为线程数的 4 倍以便负载均衡
+    size_t range_bytes = len / ((size_t)job->num_threads * 4);
+    if (range_bytes < PARALLEL_RANGE_BYTES)
+        range_bytes = PARALLEL_RANGE_BYTES;
+    split->bounds = (size_t *)mem_alloc(&tok->allocator, (len / range_bytes + 2) * sizeof(size_t));
+    if (!split->bounds)
     {
-        // ByteLevel: 可选添加前缀空格，整个文本作为一个块
-        size_t len = strlen(text);
-        size_t new_len = len + (node->config.byte_level.add_prefix_space ? 1 : 0);
-        char *buf = (char *)malloc(new_len + 1);
-        if (!buf)
-            return BBPE_ERR_MEMORY;
-        if (node->config.byte_level.add_prefix_space)
-        {
-            buf[0] = ' ';
-            memcpy(buf + 1, text, len);
-        }
-        else
-        {
-            memcpy(buf, text, len);
-        }
-        buf[new_len] = '\0';
-        out->chunks = (char **)malloc(sizeof(char *));
-        if (!out->chunks)
-        {
-            free(buf);
-            return BBPE_ERR_MEMORY;
-        }
-        out->chunks[0] = buf;
-        out->count = 1;
-        return BBPE_OK;
+        status = BBPE_ERR_MEMORY;
+        goto cleanup;
     }
-    else if (node->type == PRE_TOKENIZER_REGEX_SPLIT && node->config.split.regex_compiled)
+    split->bounds[0] = 0;
+    size_t acc = 0;
+    for (size_t i = 0; i < chunk_count; i++)
     {
-        // 正则分割: 使用 pcre2 匹配，将文本按匹配到的部分分割成块
-        pcre2_match_data *match_data = pcre2_match_data_create_from_pattern(
-            node->config.split.regex_compiled, NULL);
-        if (!match_data)
-            return BBPE_ERR_MEMORY;
-
-        size_t text_len = strlen(text);
-        PCRE2_SIZE offset = 0;
-        PCRE2_SIZE last_end = 0;
-        char **chunks = NULL;
-        size_t count = 0;
-
-        while (offset < text_len)
+        acc += split->chunks[i].len; // 只计原文字节，保证区间数不超过 len / range_bytes + 1
+        if (acc >= range_bytes && i + 1 < chunk_count)
         {
-            int rc = pcre2_match(node->config.split.regex_compiled,
-                                 (PCRE2_SPTR)text, text_len, offset, 0,
-                                 match_data, NULL);
-            if (rc < 0)
-            {
-                if (rc == PCRE2_ERROR_NOMATCH)
-                    break;
-                else
-                    break; // 其他错误，停止匹配
-            }
-
-            // 处理空匹配（返回 0 表示匹配了空字符串）
-            if (rc == 0)
-            {
-                // 空匹配，推进一个字符以避免无限循环
-                offset++;
-                continue;
-            }
-
-            PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(match_data);
-            PCRE2_SIZE start = ovector[0];
-            PCRE2_SIZE end = ovector[1];
-
-            // 保存匹配前的内容
-            if (start > last_end)
-            {
-                size_t chunk_len = start - last_end;
-                char *chunk = (char *)malloc(chunk_len + 1);
-                if (!chunk)
-                {
-                    for (size_t i = 0; i < count; i++)
-                        free(chunks[i]);
-                    free(chunks);
-                    pcre2_match_data_free(match_data);
-                    return BBPE_ERR_MEMORY;
-                }
-                memcpy(chunk, text + last_end, chunk_len);
-                chunk[chunk_len] = '\0';
-
-                char **tmp = (char **)realloc(chunks, sizeof(char *) * (count + 1));
-                if (!tmp)
-                {
-                    free(chunk);
-                    for (size_t i = 0; i < count; i++)
-                        free(chunks[i]);
-                    free(chunks);
-                    pcre2_match_data_free(match_data);
-                    return BBPE_ERR_MEMORY;
-                }
-                chunks = tmp;
-                chunks[count++] = chunk;
-            }
-
-            // 保存匹配到的部分本身
-            size_t match_len = end - start;
-            char *match_chunk = (char *)malloc(match_len + 1);
-            if (!match_chunk)
-            {
-                for (size_t i = 0; i < count; i++)
-                    free(chunks[i]);
-                free(chunks);
-                pcre2_match_data_free(match_data);
-                return BBPE_ERR_MEMORY;
-            }
-            memcpy(match_chunk, text + start, match_len);
-            match_chunk[match_len] = '\0';
-
-            char **tmp = (char **)realloc(chunks, sizeof(char *) * (count + 1));
-            if (!tmp)
-            {
-                free(match_chunk);
-                for (size_t i = 0; i < count; i++)
-                    free(chunks[i]);
-                free(chunks);
-                pcre2_match_data_free(match_data);
-                return BBPE_ERR_MEMORY;
-            }
-            chunks = tmp;
-            chunks[count++] = match_chunk;
-
-            last_end = end;
-            offset = end;
-            if (start == end) // 避免无限循环
-                offset++;
+            split->bounds[++split->range_count] = i + 1;
+            acc = 0;
         }
+    }
+    split->bounds[++split->range_count] = chunk_count;
 
-        // 处理剩余文本
-        if (last_end < text_len)
-        {
-            size_t rem_len = text_len - last_end;
-            char *chunk = (char *)malloc(rem_len + 1);
-            if (!chunk)
-            {
-                for (size_t i = 0; i < count; i++)
-                    free(chunks[i]);
-                free(chunks);
-                pcre2_match_data_free(match_data);
-                return BBPE_ERR_MEMORY;
-            }
-            memcpy(chunk, text + last_end, rem_len);
-            chunk[rem_len] = '\0';
-
-            char **tmp = (char **)realloc(chunks, sizeof(char *) * (count + 1));
-            if (!tmp)
-            {
-                free(chunk);
-                for (size_t i = 0; i < count; i++)
-                    free(chunks[i]);
-                free(chunks);
-                pcre2_match_data_free(match_data);
-                return BBPE_ERR_MEMORY;
-            }
-            chunks = tmp;
-            chunks[count++] = chunk;
-        }
+    split->sinks = (IdSink *)mem_calloc(&tok->allocator, split->range_count, sizeof(IdSink));
+    if (!split->sinks)
+    {
+        status = BBPE_ERR_MEMORY;
+        goto cleanup;
+    }
+    for (size_t r = 0; r < split->range_count; r++)
+        split->sinks[r].growable = 1;
+    split->remaining = split->range_count;
+    split->failed_range = split->range_count;
+    split->failed_status = BBPE_OK;
 
-        pcre2_match_data_free(match_data);
+cleanup:
+    if (status != BBPE_OK)
+        batch_split_release(tok, split);
+    return status;
+}
 
-        // 如果没有产生任何块（例如正则不匹配），则返回原文本作为一个块
-        if (count == 0)
+/**
+ * @brief 最后一个区间完成后：按区间顺序拼接长文档的输出 (结果与串行路径逐个 ID 相同)，并释放拆分状态
+ */
+static void batch_join_split(BatchJob *job, size_t doc, BatchSplit *split)
+{
+    BBPEStatus status = split->failed_range < split->range_count ? split->failed_status : BBPE_OK;
+    if (status == BBPE_OK && !batch_skip(job, doc))
+    {
+        size_t total = 0;
+        for (size_t r = 0; r < split->range_count; r++)
+            total += split->sinks[r].count;
+        IdSink out = {NULL, 0, 0, 1};
+        int32_t *dst;
+        size_t room;
+        status = sink_reserve(&out, total, &dst, &room);
+        if (status == BBPE_OK)
         {
-            chunks = (char **)malloc(sizeof(char *));
-            if (!chunks)
-                return BBPE_ERR_MEMORY;
-            chunks[0] = strdup(text);
-            if (!chunks[0])
+            for (size_t r = 0; r < split->range_count; r++)
             {
-                free(chunks);
-                return BBPE_ERR_MEMORY;
+                if (split->sinks[r].count)
+                    memcpy(dst, split->sinks[r].ids, split->sinks[r].count * sizeof(int32_t));
+                dst += split->sinks[r].count;
             }
-            count = 1;
+            job->outputs[doc].ids = out.ids;
+            job->outputs[doc].count = total;
+            job->outputs[doc].capacity = out.capacity;
         }
-
-        out->chunks = chunks;
-        out->count = count;
-        return BBPE_OK;
     }
-    // 如果类型不匹配或缺少编译好的正则，返回空结果（但通常不会发生）
-    return BBPE_OK;
+    if (status != BBPE_OK)
+        batch_fail(job, doc, status);
+    batch_split_release(job->tok, split);
 }
-
-/**
- * @brief 对文本执行完整的预分词链
- * @param tok 分词器句柄
- * @param text 输入文本
- * @param out 输出预分词结果
- * @return BBPEStatus
+
+/**
+ * @brief 执行一个任务
  */
-static BBPEStatus pre_tokenize(BBPETokenizer *tok, const char *text, PreTokenizedResult *out)
+static void batch_run_task(BatchJob *job, BBPEWorkspace *ws, int self, const BatchTask *task)
 {
-    PreTokenizedResult current;
-    current.chunks = (char **)malloc(sizeof(char *));
-    if (!current.chunks)
-        return BBPE_ERR_MEMORY;
-    current.chunks[0] = strdup(text);
-    if (!current.chunks[0])
+    BBPETokenizer *tok = job->tok;
+    if (task->kind == BATCH_TASK_DOCS)
     {
-        free(current.chunks);
-        return BBPE_ERR_MEMORY;
+        for (size_t i = task->doc; i < task->end && !batch_skip(job, i); i++)
+        {
+            BBPEStatus status = bbpe_encode_reuse_ws(tok, ws, job->texts[i], job->lens[i], &job->outputs[i]);
+            if (status != BBPE_OK)
+                batch_fail(job, i, status);
+        }
+        return;
     }
-    current.count = 1;
 
-    PreTokenizerNode *node = tok->pre_tokenizers;
-    while (node)
+    BatchSplit *split = &job->splits[task->end];
+    if (task->kind == BATCH_TASK_SPLIT)
     {
-        PreTokenizedResult next = {NULL, 0};
-        BBPEStatus status;
-
-        for (size_t i = 0; i < current.count; i++)
+        size_t pushed = 0;
+        BBPEStatus status = batch_skip(job, task->doc) ? BBPE_OK : batch_split_doc(job, ws, task->doc, split);
+        if (status == BBPE_OK && split->range_count > 0)
         {
-            PreTokenizedResult part = {NULL, 0}; // 初始化局部变量
-            status = apply_single_pre_tokenizer(node, current.chunks[i], &part);
-            if (status != BBPE_OK)
-            {
-                // 错误处理: 释放已有资源
-                free_pre_tokenized(&part);
-                for (size_t k = 0; k < current.count; k++)
-                    free(current.chunks[k]);
-                free(current.chunks);
-                free_pre_tokenized(&next);
-                return status;
-            }
-
-            if (part.count > 0)
+            // 区间任务逆序压入：所有者从尾部取，先处理文档开头；窃取者从头部取，拿走文档末尾
+            BatchTask *ranges = (BatchTask *)mem_alloc(&tok->allocator, split->range_count * sizeof(BatchTask));
+            status = ranges ? BBPE_OK : BBPE_ERR_MEMORY;
+            for (size_t r = 0; ranges && r < split->range_count; r++)
             {
-                // 合并 part 到 next，检查溢出
-                if (next.count > SIZE_MAX - part.count)
-                {
-                    free_pre_tokenized(&part);
-                    for (size_t k = 0; k < current.count; k++)
-                        free(current.chunks[k]);
-                    free(current.chunks);
-                    free_pre_tokenized(&next);
-                    return BBPE_ERR_MEMORY;
-                }
-
-                size_t new_count = next.count + part.count;
-                char **tmp = (char **)realloc(next.chunks, sizeof(char *) * new_count);
-                if (!tmp)
-                {
-                    free_pre_tokenized(&part);
-                    for (size_t k = 0; k < current.count; k++)
-                        free(current.chunks[k]);
-                    free(current.chunks);
-                    free_pre_tokenized(&next);
-                    return BBPE_ERR_MEMORY;
-                }
-                next.chunks = tmp;
-
-                // 转移 part.chunks 中的指针到 next
-                for (size_t j = 0; j < part.count; j++)
-                {
-                    next.chunks[next.count + j] = part.chunks[j];
-                }
-                next.count = new_count;
-                // 释放 part.chunks 数组本身，但保留其中字符串 (已转移)
-                free(part.chunks);
+                ranges[r].kind = BATCH_TASK_RANGE;
+                ranges[r].doc = task->doc;
+                ranges[r].end = task->end;
+                ranges[r].range = split->range_count - 1 - r;
             }
+            if (ranges)
+                status = deque_push(&tok->allocator, &job->deques[self], ranges, split->range_count);
+            mem_free(&tok->allocator, ranges);
+            if (status == BBPE_OK)
+                pushed = split->range_count;
             else
-            {
-                free_pre_tokenized(&part);
-            }
+                batch_split_release(tok, split);
         }
-
-        // 释放 current 中的字符串和数组
-        for (size_t i = 0; i < current.count; i++)
-            free(current.chunks[i]);
-        free(current.chunks);
-
-        current = next;
-        node = node->next;
+        if (status != BBPE_OK)
+            batch_fail(job, task->doc, status);
+        mutex_lock(&job->lock);
+        if (pushed)
+            job->epoch++;
+        job->pending_splits--;
+        cond_broadcast(&job->wake);
+        mutex_unlock(&job->lock);
+        return;
     }
 
-    *out = current;
-    return BBPE_OK;
+    BBPEStatus status = BBPE_OK;
+    if (!batch_skip(job, task->doc))
+    {
+        IdSink *sink = &split->sinks[task->range];
+        const char *text = split->text ? split->text : job->texts[task->doc];
+        STATS_TIMER(merge_start);
+        TRACE_BEGIN(tok, merge, split->bounds[task->range + 1] - split->bounds[task->range]);
+        for (size_t i = split->bounds[task->range]; i < split->bounds[task->range + 1] && status == BBPE_OK; i++)
+        {
+            const DocChunk *c = &split->chunks[i];
+            if (c->special_id >= 0)
+                status = sink_push(sink, &c->special_id, 1);
+            else
+                status = encode_chunk(tok, text + c->offset, c->len, c->prefix_spaces, ws, sink);
+        }
+        STATS_ELAPSED(ws, merge_ns, merge_start);
+        TRACE_END(tok, merge);
+    }
+    mutex_lock(&job->lock);
+    if (status != BBPE_OK && task->range < split->failed_range)
+    {
+        split->failed_range = task->range;
+        split->failed_status = status;
+    }
+    int last = --split->remaining == 0;
+    mutex_unlock(&job->lock);
+    if (last)
+        batch_join_split(job, task->doc, split);
 }
 
-// ============================================================================
-// 合并规则查找
-// ============================================================================
-
 /**
- * @brief 查找是否存在 left+right 的合并规则
- * @param tok 分词器句柄
- * @param left 左 token ID
- * @param right 右 token ID
- * @param out_new_id 输出合并后的新 token ID
- * @param out_priority 输出规则优先级
- * @return 1 表示找到规则，0 表示未找到
+ * @brief 批量编码工作线程：反复取任务执行；所有队列为空时，若仍有 SPLIT 任务未完成则等待其产生区间任务
  */
-static int find_merge_rule(BBPETokenizer *tok, int32_t left, int32_t right,
-                           int32_t *out_new_id, int32_t *out_priority)
+static void batch_worker(void *arg)
 {
-    if (!tok->rule_rows)
-        return 0;
-    if (left < 0 || left >= tok->vocab_size)
-        return 0;
-    MergeRuleRow *row = &tok->rule_rows[left];
-    if (row->count == 0)
-        return 0;
-
-    // 二分查找 right_id
-    int lo = 0, hi = row->count - 1;
-    while (lo <= hi)
+    BatchJob *job = (BatchJob *)arg;
+    BBPEWorkspace ws;
+    NumaBinding binding;
+    workspace_init(&ws, &job->tok->allocator);
+    numa_worker_bind(job->tok, &ws, &binding);
+    mutex_lock(&job->lock);
+    int self = job->next_worker++;
+    size_t epoch = job->epoch;
+    mutex_unlock(&job->lock);
+
+    for (;;)
     {
-        int mid = (lo + hi) / 2;
-        int32_t mid_right = row->items[mid].right_id;
-        if (mid_right == right)
+        BatchTask task;
+        if (batch_take_task(job, self, &task))
         {
-            *out_new_id = row->items[mid].new_id;
-            *out_priority = row->items[mid].priority;
-            return 1;
+            batch_run_task(job, &ws, self, &task);
+            continue;
         }
-        else if (mid_right < right)
+        // 取任务前后 epoch 未变且没有未完成的 SPLIT 任务时，不会再有新任务
+        mutex_lock(&job->lock);
+        while (job->epoch == epoch && job->pending_splits > 0)
+            cond_wait(&job->wake, &job->lock);
+        int done = job->epoch == epoch;
+        epoch = job->epoch;
+        mutex_unlock(&job->lock);
+        if (done)
+            break;
+    }
+    stats_flush(job->tok, &ws);
+    numa_worker_unbind(&ws, &binding);
+    workspace_release(&ws);
+}
+
+BBPEStatus bbpe_encode_batch(BBPETokenizer *tokenizer, const char *const *texts, const size_t *lens, size_t n,
+                             BBPEOutput *outputs, int num_threads)
+{
+    if (!tokenizer || (n > 0 && (!texts || !outputs)))
+        return BBPE_ERR_INVALID_INPUT;
+    for (size_t i = 0; i < n; i++)
+    {
+        outputs[i].ids = NULL;
+        outputs[i].count = 0;
+        outputs[i].capacity = 0;
+    }
+    if (n == 0)
+        return BBPE_OK;
+    BBPEStatus status = encoder_prepare(tokenizer);
+    if (status != BBPE_OK)
+        return status;
+
+    if (num_threads <= 0)
+        num_threads = cpu_count();
+    if (num_threads > BATCH_MAX_THREADS)
+        num_threads = BATCH_MAX_THREADS;
+
+    const BBPEAllocator *a = &tokenizer->allocator;
+    size_t *doc_lens = NULL;
+    TaskDeque *deques = NULL;
+    BatchSplit *splits = NULL;
+    BatchTask *tasks = NULL;
+    size_t task_count = 0;
+    int deque_count = 0;
+
+    // 1. 文档长度与长文档数；短文档按总字节数打包，每个任务约为短文档总量的 1/(8 × 线程数)，至多 16 KiB
+    if (!lens)
+    {
+        doc_lens = (size_t *)mem_alloc(a, n * sizeof(size_t));
+        if (!doc_lens)
+            return BBPE_ERR_MEMORY;
+        for (size_t i = 0; i < n; i++)
+            doc_lens[i] = texts[i] ? strlen(texts[i]) : 0;
+        lens = doc_lens;
+    }
+    size_t split_count = 0;
+    size_t small_bytes = 0;
+    size_t max_tasks = 0; // 可同时执行的任务数上限，线程数不超过它
+    for (size_t i = 0; i < n; i++)
+    {
+        if (num_threads > 1 && lens[i] >= PARALLEL_MIN_BYTES)
         {
-            lo = mid + 1;
+            split_count++;
+            max_tasks += lens[i] / PARALLEL_RANGE_BYTES + 1;
         }
         else
         {
-            hi = mid - 1;
+            small_bytes += lens[i];
         }
     }
-    return 0;
+    size_t group_bytes = small_bytes / ((size_t)num_threads * 8);
+    if (group_bytes > PARALLEL_RANGE_BYTES)
+        group_bytes = PARALLEL_RANGE_BYTES;
+
+    // 2. 生成初始任务：DOCS 在前、SPLIT 在后
+    tasks = (BatchTask *)mem_alloc(a, n * sizeof(BatchTask));
+    splits = (BatchSplit *)mem_calloc(a, split_count ? split_count : 1, sizeof(BatchSplit));
+    if (!tasks || !splits)
+    {
+        status = BBPE_ERR_MEMORY;
+        goto cleanup;
+    }
+    size_t group_start = 0, group_acc = 0;
+    for (size_t i = 0; i <= n; i++)
+    {
+        int is_long = i < n && num_threads > 1 && lens[i] >= PARALLEL_MIN_BYTES;
+        int close = i == n || is_long || group_acc >= group_bytes;
+        if (close && group_start < i)
+        {
+            BatchTask *t = &tasks[task_count++];
+            t->kind = BATCH_TASK_DOCS;
+            t->doc = group_start;
+            t->end = i;
+            t->range = 0;
+            group_acc = 0;
+        }
+        if (close)
+            group_start = i + (is_long ? 1 : 0);
+        if (i < n && !is_long)
+            group_acc += lens[i];
+    }
+    max_tasks += task_count;
+    for (size_t i = 0, slot = 0; i < n; i++)
+    {
+        if (num_threads > 1 && lens[i] >= PARALLEL_MIN_BYTES)
+        {
+            BatchTask *t = &tasks[task_count++];
+            t->kind = BATCH_TASK_SPLIT;
+            t->doc = i;
+            t->end = slot++;
+            t->range = 0;
+        }
+    }
+    if ((size_t)num_threads > max_tasks)
+        num_threads = (int)max_tasks;
+
+    // 3. 轮流分配到各线程的队列；所有者从尾部取，因此 SPLIT 任务最先开始
+    deques = (TaskDeque *)mem_calloc(a, (size_t)num_threads, sizeof(TaskDeque));
+    if (!deques)
+    {
+        status = BBPE_ERR_MEMORY;
+        goto cleanup;
+    }
+    for (; deque_count < num_threads; deque_count++)
+        mutex_init(&deques[deque_count].lock);
+    for (size_t t = 0; t < task_count && status == BBPE_OK; t++)
+        status = deque_push(a, &deques[t % (size_t)num_threads], &tasks[t], 1);
+    if (status != BBPE_OK)
+        goto cleanup;
+
+    // 4. 并行执行；线程创建失败时，无所有者的队列由其他线程窃取完
+    BatchJob job;
+    job.tok = tokenizer;
+    job.texts = texts;
+    job.lens = lens;
+    job.outputs = outputs;
+    job.count = n;
+    job.num_threads = num_threads;
+    job.deques = deques;
+    job.splits = splits;
+    job.next_worker = 0;
+    job.pending_splits = split_count;
+    job.epoch = 0;
+    job.failed_index = n;
+    job.failed_status = BBPE_OK;
+    mutex_init(&job.lock);
+    cond_init(&job.wake);
+    run_parallel(num_threads, batch_worker, &job);
+    cond_destroy(&job.wake);
+    mutex_destroy(&job.lock);
+    if (job.failed_index < n)
+        status = job.failed_status;
+
+cleanup:
+    for (int d = 0; d < deque_count; d++)
+    {
+        mem_free(a, deques[d].tasks);
+        mutex_destroy(&deques[d].lock);
+    }
+    mem_free(a, deques);
+    mem_free(a, splits);
+    mem_free(a, tasks);
+    mem_free(a, doc_lens);
+    if (status != BBPE_OK)
+    {
+        for (size_t i = 0; i < n; i++)
+            bbpe_free_output(&outputs[i]);
+    }
+    return status;
+}
+
+BBPEStatus bbpe_encode_parallel(BBPETokenizer *tokenizer, const char *text, size_t len,
+                                BBPEOutput *out_output, int num_threads)
+{
+    if (!tokenizer || (!text && len > 0) || !out_output)
+        return BBPE_ERR_INVALID_INPUT;
+    if (num_threads <= 0)
+        num_threads = cpu_count();
+    if (num_threads == 1 || len < PARALLEL_MIN_BYTES)
+        return bbpe_encode_n(tokenizer, text, len, out_output);
+
+    // 单个长文档的批量编码：一个 SPLIT 任务串行预分词，其区间由全部线程窃取执行
+    return bbpe_encode_batch(tokenizer, &text, &len, 1, out_output, num_threads);
 }
 
 // ============================================================================
-// 优先队列（最小堆）辅助函数（修正：比较优先级和左节点位置）
+// 异步编码
 // ============================================================================
+//
+// 每个分词器至多一个线程池 (tok->async)：bbpe_encode_async 把请求追加到 FIFO 队列，工作线程依次取出，
+// 以各自的私有工作区调用 bbpe_encode_reuse_ws。取消分两种：尚在队列中的请求直接移出；正在编码的请求
+// 置位其 cancel 标志，encode_text 在块边界处检查并以 BBPE_ERR_CANCELLED 中止。
+// 未设置 BBPE_ASYNC_DEFERRED 时回调在完成请求的线程上 (释放锁后) 运行；设置时结果排入待分发队列，
+// 并写通知描述符 (eventfd 计数加 1 / 管道写 1 字节)，由事件循环调用 bbpe_async_dispatch 运行回调。
 
 /**
- * @brief 初始化最小堆
- * @param capacity 初始容量
- * @return 堆指针，失败返回 NULL
+ * @brief 写完成通知 (描述符非阻塞：计数已满或管道已满时说明已有未读通知，忽略即可)
  */
-static MinHeap *heap_create(int capacity)
+static void async_notify(const AsyncPool *pool)
 {
-    MinHeap *heap = (MinHeap *)malloc(sizeof(MinHeap));
-    if (!heap)
-        return NULL;
-    heap->items = (HeapItem *)malloc(sizeof(HeapItem) * capacity);
-    if (!heap->items)
-    {
-        free(heap);
-        return NULL;
-    }
-    heap->size = 0;
-    heap->capacity = capacity;
-    return heap;
+#ifndef _WIN32
+    if (pool->notify_fds[1] < 0)
+        return;
+#ifdef __linux__
+    uint64_t one = 1;
+    (void)!write(pool->notify_fds[1], &one, sizeof(one));
+#else
+    char one = 1;
+    (void)!write(pool->notify_fds[1], &one, 1);
+#endif
+#else
+    (void)pool;
+#endif
 }
 
 /**
- * @brief 销毁堆
+ * @brief 读空完成通知
  */
-static void heap_free(MinHeap *heap)
+static void async_drain(const AsyncPool *pool)
 {
-    if (heap)
+#ifndef _WIN32
+    if (pool->notify_fds[0] < 0)
+        return;
+    char buf[64];
+    while (read(pool->notify_fds[0], buf, sizeof(buf)) > 0)
     {
-        free(heap->items);
-        free(heap);
     }
+#else
+    (void)pool;
+#endif
 }
 
 /**
- * @brief 交换两个堆元素
+ * @brief 创建完成通知描述符 (非阻塞、exec 时关闭)
+ * @return 成功返回 1，失败返回 0
  */
-static void heap_swap(HeapItem *a, HeapItem *b)
+static int async_open_fds(AsyncPool *pool)
 {
-    HeapItem tmp = *a;
-    *a = *b;
-    *b = tmp;
+#if defined(_WIN32)
+    (void)pool;
+    return 1;
+#elif defined(__linux__)
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    pool->notify_fds[0] = pool->notify_fds[1] = fd;
+    return fd >= 0;
+#else
+    if (pipe(pool->notify_fds) != 0)
+    {
+        pool->notify_fds[0] = pool->notify_fds[1] = -1;
+        return 0;
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        fcntl(pool->notify_fds[i], F_SETFL, fcntl(pool->notify_fds[i], F_GETFL) | O_NONBLOCK);
+        fcntl(pool->notify_fds[i], F_SETFD, FD_CLOEXEC);
+    }
+    return 1;
+#endif
+}
+
+static void async_close_fds(AsyncPool *pool)
+{
+#ifndef _WIN32
+    if (pool->notify_fds[0] >= 0)
+        close(pool->notify_fds[0]);
+    if (pool->notify_fds[1] >= 0 && pool->notify_fds[1] != pool->notify_fds[0])
+        close(pool->notify_fds[1]);
+#endif
+    pool->notify_fds[0] = pool->notify_fds[1] = -1;
 }
 
 /**
- * @brief 比较两个堆元素，若 a 应排在 b 前面则返回 1（即 a 优先级更小或优先级相同且左节点位置更小）
+ * @brief 运行请求的回调并释放请求
  */
-static int heap_item_less(HeapItem *a, HeapItem *b)
+static void async_finish(BBPETokenizer *tok, AsyncRequest *req)
 {
-    if (a->priority != b->priority)
-        return a->priority < b->priority;
-    // 优先级相同，比较左节点在原始序列中的位置（位置小的代表更左边）
-    assert(a->left_node != NULL && b->left_node != NULL);
-    return a->left_node->pos < b->left_node->pos;
+    req->callback(req->id, req->status, &req->output, req->user_data);
+    mem_free(&tok->allocator, req);
 }
 
 /**
- * @brief 上浮操作
+ * @brief 交付一个已完成 (或已取消) 的请求 (调用时持有 async_lock，返回时仍持有)
+ * @note 未设置 BBPE_ASYNC_DEFERRED 时临时释放锁运行回调，回调中可再提交或取消请求
  */
-static void heap_up(MinHeap *heap, int idx)
+static void async_complete(BBPETokenizer *tok, AsyncPool *pool, AsyncRequest *req)
 {
-    while (idx > 0)
+    if (pool->flags & BBPE_ASYNC_DEFERRED)
     {
-        int parent = (idx - 1) / 2;
-        if (heap_item_less(&heap->items[parent], &heap->items[idx]))
-            break; // 父节点已经更小，无需交换
-        heap_swap(&heap->items[parent], &heap->items[idx]);
-        idx = parent;
+        req->next = NULL;
+        if (pool->done_tail)
+            pool->done_tail->next = req;
+        else
+            pool->done = req;
+        pool->done_tail = req;
+        async_notify(pool);
+        return;
     }
+    mutex_unlock(&tok->async_lock);
+    async_finish(tok, req);
+    mutex_lock(&tok->async_lock);
 }
 
 /**
- * @brief 下沉操作
+ * @brief 工作线程：取出队首请求编码，直至线程池停止且队列为空
  */
-static void heap_down(MinHeap *heap, int idx)
+static void async_worker(void *arg)
 {
-    int size = heap->size;
-    while (1)
-    {
-        int left = 2 * idx + 1;
-        int right = 2 * idx + 2;
-        int smallest = idx;
-
-        if (left < size && heap_item_less(&heap->items[left], &heap->items[smallest]))
-            smallest = left;
-        if (right < size && heap_item_less(&heap->items[right], &heap->items[smallest]))
-            smallest = right;
+    BBPETokenizer *tok = (BBPETokenizer *)arg;
+    AsyncPool *pool = tok->async;
+    BBPEWorkspace ws;
+    workspace_init(&ws, &tok->allocator);
 
-        if (smallest == idx)
+    mutex_lock(&tok->async_lock);
+    for (;;)
+    {
+        while (!pool->queue && !pool->stopping)
+            cond_wait(&pool->wake, &tok->async_lock);
+        AsyncRequest *req = pool->queue;
+        if (!req)
             break;
-
-        heap_swap(&heap->items[idx], &heap->items[smallest]);
-        idx = smallest;
+        pool->queue = req->next;
+        if (!pool->queue)
+            pool->queue_tail = NULL;
+        req->next = pool->running;
+        pool->running = req;
+        mutex_unlock(&tok->async_lock);
+
+        ws.cancel = &req->cancel;
+        BBPEOutput output = {NULL, 0, 0};
+        BBPEStatus status = flag_load(&req->cancel)
+                                ? BBPE_ERR_CANCELLED
+                                : bbpe_encode_reuse_ws(tok, &ws, req->text, req->len, &output);
+        ws.cancel = NULL;
+        if (status != BBPE_OK)
+            bbpe_free_output(&output);
+        req->status = status;
+        req->output = output;
+
+        mutex_lock(&tok->async_lock);
+        AsyncRequest **link = &pool->running;
+        while (*link != req)
+            link = &(*link)->next;
+        *link = req->next;
+        async_complete(tok, pool, req);
     }
+    mutex_unlock(&tok->async_lock);
+    workspace_release(&ws);
 }
 
 /**
- * @brief 向堆中插入一个元素
- * @return BBPE_OK 成功，BBPE_ERR_MEMORY 内存不足
+ * @brief 创建并启动线程池 (调用时持有 async_lock，tok->async 为 NULL)
  */
-static int heap_push(MinHeap *heap, HeapItem item)
+static BBPEStatus async_pool_create(BBPETokenizer *tok, int num_threads, uint32_t flags)
 {
-    if (heap->size >= heap->capacity)
+    const BBPEAllocator *a = &tok->allocator;
+    if (num_threads <= 0)
+        num_threads = cpu_count();
+    if (num_threads > BATCH_MAX_THREADS)
+        num_threads = BATCH_MAX_THREADS;
+
+    AsyncPool *pool = (AsyncPool *)mem_calloc(a, 1, sizeof(AsyncPool));
+    if (!pool)
+        return BBPE_ERR_MEMORY;
+    pool->threads = (bbpe_thread_t *)mem_calloc(a, (size_t)num_threads, sizeof(bbpe_thread_t));
+    pool->next_id = 1;
+    pool->flags = flags;
+    pool->notify_fds[0] = pool->notify_fds[1] = -1;
+    if (!pool->threads || ((flags & BBPE_ASYNC_DEFERRED) && !async_open_fds(pool)))
     {
-        // 检查容量乘法是否溢出
-        if (heap->capacity > SIZE_MAX / (2 * sizeof(HeapItem)))
-            return BBPE_ERR_MEMORY;
-        int new_cap = heap->capacity * 2;
-        HeapItem *new_items = (HeapItem *)realloc(heap->items, sizeof(HeapItem) * new_cap);
-        if (!new_items)
-            return BBPE_ERR_MEMORY;
-        heap->items = new_items;
-        heap->capacity = new_cap;
+        async_close_fds(pool);
+        mem_free(a, pool->threads);
+        mem_free(a, pool);
+        return BBPE_ERR_MEMORY;
+    }
+    cond_init(&pool->wake);
+    pool->start.fn = async_worker;
+    pool->start.arg = tok;
+    tok->async = pool;
+
+    // 工作线程启动后先等待 async_lock，此时尚不会读取 pool
+    while (pool->thread_count < num_threads && thread_start(&pool->threads[pool->thread_count], &pool->start))
+        pool->thread_count++;
+    if (pool->thread_count == 0)
+    {
+        tok->async = NULL;
+        cond_destroy(&pool->wake);
+        async_close_fds(pool);
+        mem_free(a, pool->threads);
+        mem_free(a, pool);
+        return BBPE_ERR_MEMORY;
     }
-    heap->items[heap->size] = item;
-    heap_up(heap, heap->size);
-    heap->size++;
     return BBPE_OK;
 }
 
-/**
- * @brief 从堆顶弹出一个元素
- * @return 弹出元素，若堆为空则返回的 priority 为 INT32_MAX
- */
-static HeapItem heap_pop(MinHeap *heap)
+void bbpe_async_stop(BBPETokenizer *tokenizer)
 {
-    HeapItem top = {0};
-    if (heap->size == 0)
+    if (!tokenizer)
+        return;
+    mutex_lock(&tokenizer->async_lock);
+    AsyncPool *pool = tokenizer->async;
+    if (!pool || pool->stopping)
     {
-        top.priority = INT32_MAX; // 标记无效
-        return top;
+        mutex_unlock(&tokenizer->async_lock);
+        return;
     }
-    top = heap->items[0];
-    heap->size--;
-    if (heap->size > 0)
+    // 取下尚未开始的请求，通知正在编码的请求中止
+    pool->stopping = 1;
+    AsyncRequest *queued = pool->queue;
+    pool->queue = pool->queue_tail = NULL;
+    for (AsyncRequest *r = pool->running; r; r = r->next)
+        flag_store(&r->cancel, 1);
+    cond_broadcast(&pool->wake);
+    mutex_unlock(&tokenizer->async_lock);
+
+    while (queued)
     {
-        heap->items[0] = heap->items[heap->size];
-        heap_down(heap, 0);
+        AsyncRequest *next = queued->next;
+        queued->status = BBPE_ERR_CANCELLED;
+        async_finish(tokenizer, queued);
+        queued = next;
     }
-    return top;
+    for (int i = 0; i < pool->thread_count; i++)
+        thread_join(pool->threads[i]);
+
+    // 工作线程已全部退出，剩余的只有待分发结果
+    mutex_lock(&tokenizer->async_lock);
+    tokenizer->async = NULL;
+    mutex_unlock(&tokenizer->async_lock);
+    while (pool->done)
+    {
+        AsyncRequest *next = pool->done->next;
+        async_finish(tokenizer, pool->done);
+        pool->done = next;
+    }
+    cond_destroy(&pool->wake);
+    async_close_fds(pool);
+    mem_free(&tokenizer->allocator, pool->threads);
+    mem_free(&tokenizer->allocator, pool);
 }
 
-// ============================================================================
-// BPE 合并函数（使用优先队列优化，修正优先级相同问题）
-// ============================================================================
-
-/**
- * @brief 将单个文本块编码为 token IDs 并追加到输出结构
- * @param tok 分词器句柄
- * @param chunk 输入文本块
- * @param out_accum 累积输出结构 (ids 数组会动态扩展)
- * @return BBPEStatus
- */
-static BBPEStatus encode_chunk(BBPETokenizer *tok, const char *chunk, BBPEOutput *out_accum)
+BBPEStatus bbpe_async_start(BBPETokenizer *tokenizer, int num_threads, uint32_t flags)
 {
-    size_t chunk_len = strlen(chunk);
-    if (chunk_len == 0)
-        return BBPE_OK;
-
-    BBPEStatus status = BBPE_OK;
-    TokenNode *nodes = NULL;
-    MinHeap *heap = NULL;
+    if (!tokenizer || (flags & ~(uint32_t)BBPE_ASYNC_DEFERRED))
+        return BBPE_ERR_INVALID_INPUT;
+    bbpe_async_stop(tokenizer);
+    mutex_lock(&tokenizer->async_lock);
+    BBPEStatus status = tokenizer->async ? BBPE_ERR_INVALID_INPUT : async_pool_create(tokenizer, num_threads, flags);
+    mutex_unlock(&tokenizer->async_lock);
+    return status;
+}
 
-    // 1. 分配节点数组，建立双向链表
-    nodes = (TokenNode *)malloc(chunk_len * sizeof(TokenNode));
-    if (!nodes)
+BBPEStatus bbpe_encode_async(BBPETokenizer *tokenizer, const char *text, size_t len, BBPEAsyncCallback callback,
+                             void *user_data, uint64_t *out_request)
+{
+    if (!tokenizer || (!text && len > 0) || !callback)
+        return BBPE_ERR_INVALID_INPUT;
+    BBPEStatus status = encoder_prepare(tokenizer); // 只解码的分词器在提交时即报错
+    if (status != BBPE_OK)
+        return status;
+    AsyncRequest *req = (AsyncRequest *)mem_calloc(&tokenizer->allocator, 1, sizeof(AsyncRequest));
+    if (!req)
+        return BBPE_ERR_MEMORY;
+    req->text = text;
+    req->len = len;
+    req->callback = callback;
+    req->user_data = user_data;
+
+    mutex_lock(&tokenizer->async_lock);
+    if (!tokenizer->async)
+        status = async_pool_create(tokenizer, 0, 0);
+    else if (tokenizer->async->stopping)
+        status = BBPE_ERR_INVALID_INPUT; // 正在停止 (如从回调中提交)
+    if (status == BBPE_OK)
     {
-        status = BBPE_ERR_MEMORY;
-        goto cleanup;
+        AsyncPool *pool = tokenizer->async;
+        req->id = pool->next_id++;
+        if (pool->queue_tail)
+            pool->queue_tail->next = req;
+        else
+            pool->queue = req;
+        pool->queue_tail = req;
+        cond_broadcast(&pool->wake);
+        if (out_request)
+            *out_request = req->id;
     }
+    mutex_unlock(&tokenizer->async_lock);
+    if (status != BBPE_OK)
+        mem_free(&tokenizer->allocator, req);
+    return status;
+}
 
-    TokenNode *head = &nodes[0];
-    TokenNode *tail = &nodes[chunk_len - 1];
-    for (size_t i = 0; i < chunk_len; i++)
+BBPEStatus bbpe_async_cancel(BBPETokenizer *tokenizer, uint64_t request)
+{
+    if (!tokenizer)
+        return BBPE_ERR_INVALID_INPUT;
+    BBPEStatus status = BBPE_ERR_INVALID_INPUT;
+    mutex_lock(&tokenizer->async_lock);
+    AsyncPool *pool = tokenizer->async;
+    if (pool)
     {
-        uint8_t byte = (uint8_t)chunk[i];
-        const char *vocab_str = tok->byte_vocab_strs[byte];
-        VocabEntry *vocab_entry = NULL;
-        HASH_FIND_STR(tok->vocab_map, vocab_str, vocab_entry);
-        if (!vocab_entry) // 回退到原始字节字符串
+        AsyncRequest *prev = NULL, *req = pool->queue;
+        while (req && req->id != request)
         {
-            char raw_byte[2] = {(char)byte, '\0'};
-            HASH_FIND_STR(tok->vocab_map, raw_byte, vocab_entry);
+            prev = req;
+            req = req->next;
         }
-        if (!vocab_entry)
+        if (req)
         {
-            status = BBPE_ERR_TOKEN_NOT_FOUND;
-            goto cleanup;
+            if (prev)
+                prev->next = req->next;
+            else
+                pool->queue = req->next;
+            if (pool->queue_tail == req)
+                pool->queue_tail = prev;
+            req->status = BBPE_ERR_CANCELLED;
+            async_complete(tokenizer, pool, req);
+            status = BBPE_OK;
+        }
+        for (req = status == BBPE_OK ? NULL : pool->running; req; req = req->next)
+        {
+            if (req->id == request)
+            {
+                flag_store(&req->cancel, 1);
+                status = BBPE_OK;
+                break;
+            }
         }
-        nodes[i].id = vocab_entry->id;
-        nodes[i].pos = (int)i; // 记录原始位置
-        nodes[i].prev = (i > 0) ? &nodes[i - 1] : NULL;
-        nodes[i].next = (i < chunk_len - 1) ? &nodes[i + 1] : NULL;
     }
+    mutex_unlock(&tokenizer->async_lock);
+    return status;
+}
 
-    // 2. 初始化优先队列
-    heap = heap_create(chunk_len);
-    if (!heap)
-    {
-        status = BBPE_ERR_MEMORY;
-        goto cleanup;
-    }
+int bbpe_async_fd(BBPETokenizer *tokenizer)
+{
+    if (!tokenizer)
+        return -1;
+    mutex_lock(&tokenizer->async_lock);
+    int fd = tokenizer->async ? tokenizer->async->notify_fds[0] : -1;
+    mutex_unlock(&tokenizer->async_lock);
+    return fd;
+}
 
-    // 3. 将所有可能的相邻对插入堆
-    for (TokenNode *node = head; node && node->next; node = node->next)
+size_t bbpe_async_dispatch(BBPETokenizer *tokenizer)
+{
+    if (!tokenizer)
+        return 0;
+    // 先读空通知再取下队列：此后完成的请求会重新写通知，不会遗漏
+    mutex_lock(&tokenizer->async_lock);
+    AsyncPool *pool = tokenizer->async;
+    AsyncRequest *done = NULL;
+    if (pool)
     {
-        int32_t left_id = node->id;
-        int32_t right_id = node->next->id;
-        int32_t new_id, priority;
-        if (find_merge_rule(tok, left_id, right_id, &new_id, &priority))
-        {
-            HeapItem item;
-            item.left_node = node;
-            item.right_node = node->next;
-            item.left_id = left_id;
-            item.right_id = right_id;
-            item.priority = priority;
-            item.new_id = new_id;
-            int ret = heap_push(heap, item);
-            if (ret != BBPE_OK)
-            {
-                status = ret;
-                goto cleanup;
-            }
-        }
+        async_drain(pool);
+        done = pool->done;
+        pool->done = pool->done_tail = NULL;
     }
+    mutex_unlock(&tokenizer->async_lock);
 
-    // 4. 主合并循环
-    while (heap->size > 0)
+    size_t count = 0;
+    while (done)
     {
-        HeapItem best = heap_pop(heap);
-        if (best.priority == INT32_MAX)
-            break; // 堆空
-
-        // 验证该对是否仍然有效
-        TokenNode *left = best.left_node;
-        TokenNode *right = best.right_node;
+        AsyncRequest *next = done->next;
+        async_finish(tokenizer, done);
+        done = next;
+        count++;
+    }
+    return count;
+}
 
-        // 检查指针关系：必须相邻且仍在链表中
-        if (left->next != right || right->prev != left)
-            continue;
+BBPEStatus bbpe_decode(BBPETokenizer *tokenizer, const int32_t *ids, size_t count, char **out_text)
+{
+    if (!tokenizer || !ids || count == 0 || !out_text)
+        return BBPE_ERR_INVALID_INPUT;
 
-        // 检查 ID 是否与入堆时一致（未被其他合并改变）
-        if (left->id != best.left_id || right->id != best.right_id)
-            continue;
+    // 第一遍：由解码表的长度计算总字节数 (同时校验所有 ID)，第二遍逐个复制预先解码的字节
+    size_t total_bytes;
+    BBPEStatus status = decoded_total(tokenizer, ids, count, &total_bytes);
+    if (status != BBPE_OK)
+        return status;
+    char *result = (char *)malloc(total_bytes + 1);
+    if (!result)
+        return BBPE_ERR_MEMORY;
+    result[decode_copy(tokenizer, ids, count, result)] = '\0';
+    *out_text = result;
+    return BBPE_OK;
+}
 
-        // 执行合并：左节点复用，右节点从链表中移除
-        left->id = best.new_id; // 更新为合并后的 token ID
+BBPEStatus bbpe_decode_into(BBPETokenizer *tokenizer, const int32_t *ids, size_t count, char *buf, size_t capacity,
+                            size_t *out_len)
+{
+    if (!tokenizer || (!ids && count > 0) || (!buf && capacity > 0) || !out_len)
+        return BBPE_ERR_INVALID_INPUT;
+    size_t total;
+    BBPEStatus status = decoded_total(tokenizer, ids, count, &total);
+    if (status != BBPE_OK)
+        return status;
+    *out_len = total;
+    if (capacity <= total)
+        return BBPE_ERR_BUFFER_TOO_SMALL;
+    buf[decode_copy(tokenizer, ids, count, buf)] = '\0';
+    return BBPE_OK;
+}
 
-        // 记录右节点的后继
-        TokenNode *right_next = right->next;
+BBPEStatus bbpe_decoded_length(BBPETokenizer *tokenizer, const int32_t *ids, size_t count, size_t *out_len)
+{
+    if (!tokenizer || (!ids && count > 0) || !out_len)
+        return BBPE_ERR_INVALID_INPUT;
+    return decoded_total(tokenizer, ids, count, out_len);
+}
 
-        // 调整链表：左节点的 next 指向 right_next
-        left->next = right_next;
-        if (right_next)
-            right_next->prev = left;
+/**
+ * @brief 批量解码的共享状态：第一遍计算各序列的文本长度，第二遍把文本复制到各自的偏移处
+ */
+typedef struct
+{
+    const BBPETokenizer *tok; /* 共享的分词器 (只读) */
+    const int32_t *ids;       /* 全部序列的 ID */
+    const size_t *id_offsets; /* n + 1 项：第 i 个序列为 ids[id_offsets[i], id_offsets[i+1]) */
+    size_t *text_offsets;     /* 第一遍写入 text_offsets[i+1] = 第 i 个序列的文本长度，第二遍读取前缀和 */
+    char *text;               /* 第二遍的输出缓冲区 */
+    size_t count;             /* 序列数 */
+    int copy;                 /* 0 表示第一遍 (计算长度)，1 表示第二遍 (复制) */
+    size_t next;              /* 下一个待领取的序列下标 (受 lock 保护) */
+    size_t failed_index;      /* 失败序列的最小下标，count 表示尚无失败 (受 lock 保护) */
+    BBPEStatus failed_status; /* failed_index 对应的错误码 */
+    bbpe_mutex_t lock;        /* 保护任务领取与失败记录 */
+} DecodeBatchJob;
 
-        // 右节点从链表中脱离（不再被使用）
-        right->prev = NULL;
-        right->next = NULL;
+/**
+ * @brief 批量解码工作线程：每次领取 DECODE_BATCH_BLOCK 个序列
+ * @note 与 batch_worker 相同，序列按下标递增领取，出错后停止领取，记录的即为最小失败下标
+ */
+static void decode_batch_worker(void *arg)
+{
+    DecodeBatchJob *job = (DecodeBatchJob *)arg;
+    const BBPETokenizer *tok = job->tok;
+    for (;;)
+    {
+        mutex_lock(&job->lock);
+        size_t begin = job->next;
+        int stop = begin >= job->count || job->failed_index < job->count;
+        if (!stop)
+            job->next = job->count - begin > DECODE_BATCH_BLOCK ? begin + DECODE_BATCH_BLOCK : job->count;
+        mutex_unlock(&job->lock);
+        if (stop)
+            break;
 
-        // 插入新的左边对（left 的前驱与 left）
-        if (left->prev)
+        size_t end = job->count - begin > DECODE_BATCH_BLOCK ? begin + DECODE_BATCH_BLOCK : job->count;
+        for (size_t i = begin; i < end; i++)
         {
-            int32_t lleft_id = left->prev->id;
-            int32_t lright_id = left->id;
-            int32_t new_id2, priority2;
-            if (find_merge_rule(tok, lleft_id, lright_id, &new_id2, &priority2))
+            size_t n = job->id_offsets[i + 1] - job->id_offsets[i];
+            const int32_t *ids = n > 0 ? job->ids + job->id_offsets[i] : NULL;
+            if (job->copy)
             {
-                HeapItem item;
-                item.left_node = left->prev;
-                item.right_node = left;
-                item.left_id = lleft_id;
-                item.right_id = lright_id;
-                item.priority = priority2;
-                item.new_id = new_id2;
-                int ret = heap_push(heap, item);
-                if (ret != BBPE_OK)
-                {
-                    status = ret;
-                    goto cleanup;
-                }
+                decode_copy(tok, ids, n, job->text + job->text_offsets[i]);
+                continue;
             }
-        }
 
-        // 插入新的右边对（left 与 left 的后继）
-        if (left->next)
-        {
-            int32_t lleft_id = left->id;
-            int32_t lright_id = left->next->id;
-            int32_t new_id2, priority2;
-            if (find_merge_rule(tok, lleft_id, lright_id, &new_id2, &priority2))
+            size_t total = 0;
+            BBPEStatus status = job->id_offsets[i + 1] < job->id_offsets[i] ? BBPE_ERR_INVALID_INPUT
+                                                                               : decoded_total(tok, ids, n, &total);
+            if (status != BBPE_OK)
             {
-                HeapItem item;
-                item.left_node = left;
-                item.right_node = left->next;
-                item.left_id = lleft_id;
-                item.right_id = lright_id;
-                item.priority = priority2;
-                item.new_id = new_id2;
-                int ret = heap_push(heap, item);
-                if (ret != BBPE_OK)
+                mutex_lock(&job->lock);
+                if (i < job->failed_index)
                 {
-                    status = ret;
-                    goto cleanup;
+                    job->failed_index = i;
+                    job->failed_status = status;
                 }
+                mutex_unlock(&job->lock);
+                break;
             }
+            job->text_offsets[i + 1] = total;
         }
-
-        // 注意：原先涉及 right 节点的其他堆条目将在被弹出时因验证失败而丢弃
-    }
-
-    // 5. 收集结果：遍历链表收集所有存活节点的 ID
-    size_t token_count = 0;
-    for (TokenNode *node = head; node; node = node->next)
-        token_count++;
-
-    // 6. 直接扩展 out_accum 的 ids 数组，并填充
-    size_t old_count = out_accum->count;
-    size_t new_count = old_count + token_count;
-    int32_t *new_ids = (int32_t *)realloc(out_accum->ids, sizeof(int32_t) * new_count);
-    if (!new_ids)
-    {
-        status = BBPE_ERR_MEMORY;
-        goto cleanup;
     }
-    out_accum->ids = new_ids;
-    out_accum->count = new_count;
-
-    size_t idx = old_count;
-    for (TokenNode *node = head; node; node = node->next)
-        out_accum->ids[idx++] = node->id;
-
-cleanup:
-    if (heap)
-        heap_free(heap);
-    if (nodes)
-        free(nodes);
-    return status;
 }
 
-// ============================================================================
-// 预分词器节点解析 (JSON)
-// ============================================================================
-
 /**
- * @brief 从 cJSON 对象解析单个预分词器节点
- * @param obj JSON 对象
- * @param status 输出解析状态
- * @return 新分配的 PreTokenizerNode，失败返回 NULL
+ * @brief 批量解码的公共部分：计算各序列的文本偏移，缓冲区足够时复制全部文本
+ * @param text 输出缓冲区；为 NULL 时按所需大小分配 (多 1 字节写入结尾 '\0') 并经 out_text 返回
+ * @param capacity text 的容量 (字节)
+ * @param out_text text 为 NULL 时输出分配的缓冲区
+ * @return BBPEStatus 状态码；text 容量不足时返回 BBPE_ERR_BUFFER_TOO_SMALL (偏移已完整写入)
  */
-static PreTokenizerNode *parse_pre_tokenizer_node(cJSON *obj, BBPEStatus *status)
+static BBPEStatus decode_batch(BBPETokenizer *tok, const int32_t *ids, const size_t *id_offsets, size_t n,
+                               char *text, size_t capacity, size_t *text_offsets, char **out_text, int num_threads)
 {
-    if (!obj)
-        return NULL;
-    cJSON *type = cJSON_GetObjectItem(obj, "type");
-    if (!type || !type->valuestring)
-    {
-        *status = BBPE_ERR_INVALID_INPUT;
-        return NULL;
-    }
+    if (!tok || !id_offsets || !text_offsets || (n > 0 && id_offsets[n] != id_offsets[0] && !ids))
+        return BBPE_ERR_INVALID_INPUT;
 
-    PreTokenizerNode *node = (PreTokenizerNode *)calloc(1, sizeof(PreTokenizerNode));
-    if (!node)
+    size_t total_ids = n > 0 && id_offsets[n] > id_offsets[0] ? id_offsets[n] - id_offsets[0] : 0;
+    if (num_threads <= 0)
+        num_threads = cpu_count();
+    if (total_ids < DECODE_BATCH_MIN_IDS)
+        num_threads = 1;
+    size_t blocks = (n + DECODE_BATCH_BLOCK - 1) / DECODE_BATCH_BLOCK;
+    if ((size_t)num_threads > blocks)
+        num_threads = blocks > 0 ? (int)blocks : 1;
+
+    DecodeBatchJob job;
+    job.tok = tok;
+    job.ids = ids;
+    job.id_offsets = id_offsets;
+    job.text_offsets = text_offsets;
+    job.text = NULL;
+    job.count = n;
+    job.copy = 0;
+    job.next = 0;
+    job.failed_index = n;
+    job.failed_status = BBPE_OK;
+    mutex_init(&job.lock);
+
+    // 第一遍：各序列的文本长度 (同时校验全部 ID)，再就地转为前缀和
+    BBPEStatus status = BBPE_OK;
+    text_offsets[0] = 0;
+    run_parallel(num_threads, decode_batch_worker, &job);
+    if (job.failed_index < n)
+        status = job.failed_status;
+    for (size_t i = 0; i < n && status == BBPE_OK; i++)
     {
-        *status = BBPE_ERR_MEMORY;
-        return NULL;
+        if (text_offsets[i + 1] > SIZE_MAX - 1 - text_offsets[i])
+            status = BBPE_ERR_MEMORY;
+        else
+            text_offsets[i + 1] += text_offsets[i];
     }
+    if (status != BBPE_OK)
+        goto cleanup;
 
-    if (strcmp(type->valuestring, "ByteLevel") == 0)
+    // 第二遍：复制到调用者缓冲区或新分配的一整块缓冲区
+    size_t total = text_offsets[n];
+    if (!text)
     {
-        node->type = PRE_TOKENIZER_BYTE_LEVEL;
-        cJSON *add_space = cJSON_GetObjectItem(obj, "add_prefix_space");
-        node->config.byte_level.add_prefix_space = (add_space && cJSON_IsTrue(add_space)) ? 1 : 0;
-    }
-    else if (strcmp(type->valuestring, "Split") == 0)
-    {
-        node->type = PRE_TOKENIZER_REGEX_SPLIT;
-        cJSON *pattern_obj = cJSON_GetObjectItem(obj, "pattern");
-        if (pattern_obj)
-        {
-            cJSON *regex = cJSON_GetObjectItem(pattern_obj, "Regex");
-            if (regex && regex->valuestring)
-            {
-                node->config.split.regex_pattern = strdup(regex->valuestring);
-                int err;
-                PCRE2_SIZE err_off;
-                node->config.split.regex_compiled = pcre2_compile(
-                    (PCRE2_SPTR)node->config.split.regex_pattern,
-                    PCRE2_ZERO_TERMINATED, PCRE2_UTF | PCRE2_UCP, &err, &err_off, NULL);
-                if (!node->config.split.regex_compiled)
-                {
-                    free(node->config.split.regex_pattern);
-                    free(node);
-                    *status = BBPE_ERR_REGEX_COMPILE;
-                    return NULL;
-                }
-            }
-            else
-            {
-                free(node);
-                *status = BBPE_ERR_INVALID_INPUT;
-                return NULL;
-            }
-        }
-        else
+        if (!(text = (char *)malloc(total + 1)))
         {
-            free(node);
-            *status = BBPE_ERR_INVALID_INPUT;
-            return NULL;
+            status = BBPE_ERR_MEMORY;
+            goto cleanup;
         }
+        text[total] = '\0';
+        *out_text = text;
     }
-    else
+    else if (capacity < total)
     {
-        free(node);
-        *status = BBPE_ERR_UNSUPPORTED_TYPE;
-        return NULL;
+        status = BBPE_ERR_BUFFER_TOO_SMALL;
+        goto cleanup;
     }
-    return node;
-}
+    job.text = text;
+    job.copy = 1;
+    job.next = 0;
+    run_parallel(num_threads, decode_batch_worker, &job);
 
-// ============================================================================
-// 合并规则排序比较函数
-// ============================================================================
+cleanup:
+    mutex_destroy(&job.lock);
+    return status;
+}
 
-/**
- * @brief 用于 qsort 比较两个 MergeRuleItem 的 right_id
- */
-static int compare_merge_rule_items(const void *a, const void *b)
+BBPEStatus bbpe_decode_batch(BBPETokenizer *tokenizer, const int32_t *ids, const size_t *id_offsets, size_t n,
+                             char **out_text, size_t *text_offsets, int num_threads)
 {
-    int ra = ((const MergeRuleItem *)a)->right_id;
-    int rb = ((const MergeRuleItem *)b)->right_id;
-    return (ra > rb) - (ra < rb);
+    if (!out_text)
+        return BBPE_ERR_INVALID_INPUT;
+    *out_text = NULL;
+    return decode_batch(tokenizer, ids, id_offsets, n, NULL, 0, text_offsets, out_text, num_threads);
 }
 
-// ============================================================================
-// 公共 API 实现
-// ============================================================================
-
-BBPEStatus bbpe_init(const char *json_content, BBPETokenizer **out_tokenizer)
+BBPEStatus bbpe_decode_batch_into(BBPETokenizer *tokenizer, const int32_t *ids, const size_t *id_offsets, size_t n,
+                                  char *text, size_t capacity, size_t *text_offsets, int num_threads)
 {
-    if (!json_content || !out_tokenizer)
+    if (!text && capacity > 0)
         return BBPE_ERR_INVALID_INPUT;
+    char *unused = NULL;
+    char empty;
+    return decode_batch(tokenizer, ids, id_offsets, n, text ? text : &empty, text ? capacity : 0, text_offsets,
+                        &unused, num_threads);
+}
 
-    cJSON *root = cJSON_Parse(json_content);
-    if (!root)
-        return BBPE_ERR_JSON_PARSE;
+BBPEStatus bbpe_token_to_id(BBPETokenizer *tokenizer, const char *token, size_t len, int32_t *out_id)
+{
+    if (!tokenizer || (!token && len > 0) || !out_id)
+        return BBPE_ERR_INVALID_INPUT;
+    if (!token)
+        token = "";
+    // 与 JSON 中 added_tokens 优先于 model.vocab 的规则一致：先查特殊 token
+    int32_t id = vocab_table_find(&tokenizer->specials, token, len);
+    if (id < 0)
+        id = vocab_table_find(&tokenizer->vocab, token, len);
+    *out_id = id;
+    return id < 0 ? BBPE_ERR_TOKEN_NOT_FOUND : BBPE_OK;
+}
 
-    BBPETokenizer *tok = (BBPETokenizer *)calloc(1, sizeof(BBPETokenizer));
-    if (!tok)
+BBPEStatus bbpe_id_to_token(BBPETokenizer *tokenizer, int32_t id, const char **out_token, size_t *out_len)
+{
+    if (!tokenizer || !out_token || !out_len)
+        return BBPE_ERR_INVALID_INPUT;
+    if (id < 0 || (uint32_t)id >= tokenizer->vocab_size || tokenizer->id_to_entry[id] == ID_ENTRY_NONE)
+        return BBPE_ERR_TOKEN_NOT_FOUND;
+    uint32_t e = tokenizer->id_to_entry[id];
+    const VocabTable *vt = &tokenizer->vocab;
+    if (e & ID_ENTRY_SPECIAL)
     {
-        cJSON_Delete(root);
-        return BBPE_ERR_MEMORY;
+        vt = &tokenizer->specials;
+        e &= ~ID_ENTRY_SPECIAL;
     }
+    *out_token = vt->pool + vt->offsets[e];
+    *out_len = vt->lengths[e];
+    return BBPE_OK;
+}
 
-    // 初始化 Byte 映射并预计算字符串
-    init_byte_mappings(tok);
-    precompute_byte_strings(tok);
+BBPEStatus bbpe_id_to_bytes(BBPETokenizer *tokenizer, int32_t id, const char **out_bytes, size_t *out_len)
+{
+    if (!tokenizer || !out_bytes || !out_len)
+        return BBPE_ERR_INVALID_INPUT;
+    size_t len;
+    BBPEStatus status = decoded_length(tokenizer, id, &len);
+    if (status != BBPE_OK)
+        return status;
+    *out_bytes = (const char *)tokenizer->decoded_pool + tokenizer->decoded_start[id];
+    *out_len = len;
+    return BBPE_OK;
+}
 
-    // ========== 1. 解析 vocab ==========
-    cJSON *model = cJSON_GetObjectItem(root, "model");
-    if (!model || !cJSON_HasObjectItem(model, "vocab"))
-    {
-        bbpe_destroy(tok);
-        cJSON_Delete(root);
-        return BBPE_ERR_VOCAB_MISSING;
-    }
+BBPEStatus bbpe_get_decoded_vocab(BBPETokenizer *tokenizer, const char **out_bytes, const uint32_t **out_offsets,
+                                  size_t *out_vocab_size)
+{
+    if (!tokenizer || !out_bytes || !out_offsets || !out_vocab_size)
+        return BBPE_ERR_INVALID_INPUT;
+    *out_bytes = (const char *)tokenizer->decoded_pool;
+    *out_offsets = tokenizer->decoded_start;
+    *out_vocab_size = tokenizer->vocab_size;
+    return BBPE_OK;
+}
 
-    cJSON *vocab = cJSON_GetObjectItem(model, "vocab");
-    cJSON *item = NULL;
-    int max_id = -1;
-    cJSON_ArrayForEach(item, vocab)
+BBPEStatus bbpe_set_prefix_index(BBPETokenizer *tokenizer, int enable)
+{
+    if (!tokenizer)
+        return BBPE_ERR_INVALID_INPUT;
+    if (!enable)
     {
-        if (item->string && cJSON_IsNumber(item))
-        {
-            VocabEntry *entry = (VocabEntry *)malloc(sizeof(VocabEntry));
-            if (!entry)
-            {
-                bbpe_destroy(tok);
-                cJSON_Delete(root);
-                return BBPE_ERR_MEMORY;
-            }
-            entry->token = strdup(item->string);
-            if (!entry->token)
-            {
-                free(entry);
-                bbpe_destroy(tok);
-                cJSON_Delete(root);
-                return BBPE_ERR_MEMORY;
-            }
-            entry->id = (int)item->valueint;
-            HASH_ADD_KEYPTR(hh, tok->vocab_map, entry->token, strlen(entry->token), entry);
-            if (entry->id > max_id)
-                max_id = entry->id;
-        }
+        mem_free(&tokenizer->allocator, tokenizer->prefix_ids);
+        tokenizer->prefix_ids = NULL;
+        tokenizer->prefix_count = 0;
+        return BBPE_OK;
     }
+    if (tokenizer->prefix_ids)
+        return BBPE_OK;
+    return build_prefix_index(tokenizer);
+}
 
-    // 检查词汇表是否为空
-    if (max_id < 0)
+BBPEStatus bbpe_prefix_tokens(BBPETokenizer *tokenizer, const char *prefix, size_t len, const int32_t **out_ids,
+                              size_t *out_count)
+{
+    if (!tokenizer || !tokenizer->prefix_ids || (!prefix && len > 0) || !out_ids || !out_count)
+        return BBPE_ERR_INVALID_INPUT;
+    size_t lo = 0, hi = tokenizer->prefix_count;
+    for (size_t d = 0; d < len && lo < hi; d++)
+        prefix_narrow(tokenizer, &lo, &hi, d, (uint8_t)prefix[d]);
+    *out_ids = tokenizer->prefix_ids + lo;
+    *out_count = hi - lo;
+    return BBPE_OK;
+}
+
+BBPEStatus bbpe_prefix_mask(BBPETokenizer *tokenizer, const char *bytes, size_t len, uint32_t match, uint32_t *mask)
+{
+    if (!tokenizer || !tokenizer->prefix_ids || (!bytes && len > 0) || !mask)
+        return BBPE_ERR_INVALID_INPUT;
+    const int32_t *ids = tokenizer->prefix_ids;
+    size_t lo = 0, hi = tokenizer->prefix_count;
+    for (size_t d = 0; d < len && lo < hi; d++)
     {
-        bbpe_destroy(tok);
-        cJSON_Delete(root);
-        return BBPE_ERR_VOCAB_MISSING;
+        prefix_narrow(tokenizer, &lo, &hi, d, (uint8_t)bytes[d]);
+        // 区间内恰好在第 d + 1 字节结束的 ID (即 bytes 的前缀) 排在最前面
+        for (size_t i = lo; (match & BBPE_PREFIX_WITHIN) && i < hi && prefix_byte_at(tokenizer, ids[i], d + 1) < 0;
+             i++)
+            mask[(uint32_t)ids[i] >> 5] |= 1u << ((uint32_t)ids[i] & 31);
     }
+    for (size_t i = lo; (match & BBPE_PREFIX_EXTENDS) && i < hi; i++)
+        mask[(uint32_t)ids[i] >> 5] |= 1u << ((uint32_t)ids[i] & 31);
+    return BBPE_OK;
+}
 
-    tok->vocab_size = max_id + 1;
-
-    // 分配 id_to_token 数组
-    tok->id_to_token = (char **)calloc(tok->vocab_size, sizeof(char *));
-    if (!tok->id_to_token)
-    {
-        bbpe_destroy(tok);
-        cJSON_Delete(root);
+BBPEStatus bbpe_decoder_new(BBPETokenizer *tokenizer, BBPEDecoder **out_decoder)
+{
+    if (!tokenizer || !out_decoder)
+        return BBPE_ERR_INVALID_INPUT;
+    BBPEDecoder *decoder = (BBPEDecoder *)mem_calloc(&tokenizer->allocator, 1, sizeof(BBPEDecoder));
+    if (!decoder)
         return BBPE_ERR_MEMORY;
-    }
+    decoder->tokenizer = tokenizer;
+    decoder->allocator = tokenizer->allocator;
+    *out_decoder = decoder;
+    return BBPE_OK;
+}
 
-    // 填充 id_to_token
-    VocabEntry *v_cur, *v_tmp;
-    HASH_ITER(hh, tok->vocab_map, v_cur, v_tmp)
-    {
-        if (v_cur->id >= 0 && v_cur->id < tok->vocab_size)
-        {
-            tok->id_to_token[v_cur->id] = v_cur->token;
-        }
-    }
+BBPEStatus bbpe_decoder_push(BBPEDecoder *decoder, int32_t id, const char **out_text, size_t *out_len)
+{
+    if (!decoder || !out_text || !out_len)
+        return BBPE_ERR_INVALID_INPUT;
 
-    // ========== 2. 解析 merges ==========
-    cJSON *merges = cJSON_GetObjectItem(model, "merges");
-    if (merges && cJSON_IsArray(merges))
-    {
-        size_t merge_count = cJSON_GetArraySize(merges);
-        tok->merge_count = merge_count;
+    size_t len;
+    BBPEStatus status = decoded_length(decoder->tokenizer, id, &len);
+    if (status != BBPE_OK)
+        return status;
 
-        typedef struct
-        {
-            int32_t left_id;
-            int32_t right_id;
-            int32_t new_id;
-            int32_t priority;
-        } MergeRecord;
-        MergeRecord *temp_records = (MergeRecord *)malloc(merge_count * sizeof(MergeRecord));
-        if (!temp_records)
-        {
-            bbpe_destroy(tok);
-            cJSON_Delete(root);
+    // 暂存字节 + 新 token 字节 + 结尾 '\0'
+    size_t needed = decoder->tail_len + len + 1;
+    if (needed > decoder->capacity)
+    {
+        size_t new_capacity = decoder->capacity ? decoder->capacity : 64;
+        while (new_capacity < needed)
+            new_capacity *= 2;
+        char *new_buf = (char *)mem_realloc(&decoder->allocator, decoder->buf, new_capacity);
+        if (!new_buf)
             return BBPE_ERR_MEMORY;
-        }
-        size_t record_cnt = 0;
-
-        char LSTR_BUFFER[STRING_TEMP_SIZE + 1] = {0};
-        char MSTR_BUFFER[STRING_TEMP_SIZE + 1] = {0};
-        size_t i = 0;
-        cJSON *merge_item;
-        cJSON_ArrayForEach(merge_item, merges)
-        {
-            char *left_str = NULL;
-            char *right_str = NULL;
-
-            if (cJSON_IsString(merge_item))
-            {
-                char *combined = merge_item->valuestring;
-                if (strlen(combined) > STRING_TEMP_SIZE)
-                    continue;
-                char *space = strchr(combined, ' ');
-                if (!space)
-                    continue;
-                size_t left_len = space - combined;
-                strncpy(LSTR_BUFFER, combined, left_len);
-                LSTR_BUFFER[left_len] = '\0';
-                left_str = LSTR_BUFFER;
-                right_str = space + 1;
-            }
-            else if (cJSON_IsArray(merge_item) && cJSON_GetArraySize(merge_item) == 2)
-            {
-                cJSON *left_node = cJSON_GetArrayItem(merge_item, 0);
-                cJSON *right_node = cJSON_GetArrayItem(merge_item, 1);
-                if (cJSON_IsString(left_node) && cJSON_IsString(right_node))
-                {
-                    left_str = left_node->valuestring;
-                    right_str = right_node->valuestring;
-                    if (strlen(left_str) + strlen(right_str) > STRING_TEMP_SIZE)
-                        continue;
-                }
-                else
-                    continue;
-            }
-            else
-                continue;
-
-            VocabEntry *left_entry = NULL, *right_entry = NULL;
-            HASH_FIND_STR(tok->vocab_map, left_str, left_entry);
-            HASH_FIND_STR(tok->vocab_map, right_str, right_entry);
-            if (!left_entry || !right_entry)
-                continue;
-
-            int32_t left_id = left_entry->id;
-            int32_t right_id = right_entry->id;
-
-            if (strlen(left_str) + strlen(right_str) >= sizeof(MSTR_BUFFER))
-                continue;
+        decoder->buf = new_buf;
+        decoder->capacity = new_capacity;
+    }
 
-            MSTR_BUFFER[0] = 0;
-            strcat(MSTR_BUFFER, left_str);
-            strcat(MSTR_BUFFER, right_str);
-            VocabEntry *merged_entry = NULL;
-            HASH_FIND_STR(tok->vocab_map, MSTR_BUFFER, merged_entry);
-            if (!merged_entry)
-                continue;
+    memcpy(decoder->buf, decoder->tail, decoder->tail_len);
+    memcpy(decoder->buf + decoder->tail_len, decoder->tokenizer->decoded_pool + decoder->tokenizer->decoded_start[id], len);
+    size_t total = decoder->tail_len + len;
 
-            int32_t new_id = merged_entry->id;
+    // 末尾不完整的字符留到下一个 token 补全
+    size_t hold = utf8_incomplete_tail(decoder->buf, total);
+    memcpy(decoder->tail, decoder->buf + total - hold, hold);
+    decoder->tail_len = hold;
+    decoder->buf[total - hold] = '\0';
 
-            temp_records[record_cnt].left_id = left_id;
-            temp_records[record_cnt].right_id = right_id;
-            temp_records[record_cnt].new_id = new_id;
-            temp_records[record_cnt].priority = (int32_t)i;
-            record_cnt++;
-            i++;
-        }
+    *out_text = decoder->buf;
+    *out_len = total - hold;
+    return BBPE_OK;
+}
 
-        uint32_t *counts = (uint32_t *)calloc(tok->vocab_size, sizeof(uint32_t));
-        if (!counts)
-        {
-            free(temp_records);
-            bbpe_destroy(tok);
-            cJSON_Delete(root);
-            return BBPE_ERR_MEMORY;
-        }
-        for (size_t j = 0; j < record_cnt; j++)
-        {
-            int left = temp_records[j].left_id;
-            if (left >= 0 && left < tok->vocab_size)
-                counts[left]++;
-        }
+BBPEStatus bbpe_decoder_flush(BBPEDecoder *decoder, const char **out_text, size_t *out_len)
+{
+    if (!decoder || !out_text || !out_len)
+        return BBPE_ERR_INVALID_INPUT;
 
-        tok->rule_rows = (MergeRuleRow *)calloc(tok->vocab_size, sizeof(MergeRuleRow));
-        if (!tok->rule_rows)
-        {
-            free(counts);
-            free(temp_records);
-            bbpe_destroy(tok);
-            cJSON_Delete(root);
-            return BBPE_ERR_MEMORY;
-        }
+    // 没有暂存字节时缓冲区可能尚未分配，返回静态空串
+    if (decoder->tail_len == 0)
+    {
+        *out_text = "";
+        *out_len = 0;
+        return BBPE_OK;
+    }
+    memcpy(decoder->buf, decoder->tail, decoder->tail_len);
+    decoder->buf[decoder->tail_len] = '\0';
+    *out_text = decoder->buf;
+    *out_len = decoder->tail_len;
+    decoder->tail_len = 0;
+    return BBPE_OK;
+}
 
-        for (int left = 0; left < tok->vocab_size; left++)
-        {
-            if (counts[left] > 0)
-            {
-                tok->rule_rows[left].items = (MergeRuleItem *)malloc(counts[left] * sizeof(MergeRuleItem));
-                if (!tok->rule_rows[left].items)
-                {
-                    // 分配失败，直接清理整个 tok（bbpe_destroy 会统一释放所有资源）
-                    free(counts);
-                    free(temp_records);
-                    bbpe_destroy(tok);
-                    cJSON_Delete(root);
-                    return BBPE_ERR_MEMORY;
-                }
-                tok->rule_rows[left].count = counts[left];
-            }
-        }
+void bbpe_decoder_reset(BBPEDecoder *decoder)
+{
+    if (decoder)
+        decoder->tail_len = 0;
+}
 
-        memset(counts, 0, tok->vocab_size * sizeof(uint32_t));
-        for (size_t j = 0; j < record_cnt; j++)
-        {
-            int left = temp_records[j].left_id;
-            uint32_t pos = counts[left]++;
-            MergeRuleItem *item = &tok->rule_rows[left].items[pos];
-            item->right_id = temp_records[j].right_id;
-            item->new_id = temp_records[j].new_id;
-            item->priority = temp_records[j].priority;
-        }
+void bbpe_decoder_destroy(BBPEDecoder *decoder)
+{
+    if (!decoder)
+        return;
+    BBPEAllocator allocator = decoder->allocator;
+    mem_free(&allocator, decoder->buf);
+    mem_free(&allocator, decoder);
+}
 
-        for (int left = 0; left < tok->vocab_size; left++)
-        {
-            if (tok->rule_rows[left].count > 0)
-            {
-                qsort(tok->rule_rows[left].items, tok->rule_rows[left].count,
-                      sizeof(MergeRuleItem), compare_merge_rule_items);
-            }
-        }
+BBPEStatus bbpe_stream_encoder_new(BBPETokenizer *tokenizer, BBPEStreamEncoder **out_encoder)
+{
+    if (!tokenizer || !out_encoder)
+        return BBPE_ERR_INVALID_INPUT;
+    BBPEStreamEncoder *enc = (BBPEStreamEncoder *)mem_calloc(&tokenizer->allocator, 1, sizeof(BBPEStreamEncoder));
+    if (!enc)
+        return BBPE_ERR_MEMORY;
+    enc->tokenizer = tokenizer;
+    workspace_init(&enc->ws, &tokenizer->allocator);
+    enc->special_hold = special_hold_bytes(tokenizer);
+    *out_encoder = enc;
+    return BBPE_OK;
+}
+
+BBPEStatus bbpe_stream_encoder_feed(BBPEStreamEncoder *encoder, const char *data, size_t len,
+                                    const int32_t **out_ids, size_t *out_count)
+{
+    if (!encoder || (!data && len > 0) || !out_ids || !out_count)
+        return BBPE_ERR_INVALID_INPUT;
+    *out_ids = encoder->ids;
+    *out_count = 0;
+    if (len > SIZE_MAX - encoder->len)
+        return BBPE_ERR_MEMORY;
+
+    size_t old_len = encoder->len;
+    BBPEStatus status =
+        workspace_reserve(&encoder->ws.allocator, (void **)&encoder->buf, &encoder->capacity, old_len + len, 1);
+    if (status != BBPE_OK)
+        return status;
+    if (len > 0)
+        memcpy(encoder->buf + old_len, data, len);
+    encoder->len += len;
+    if (encoder->len < encoder->retry_len)
+        return BBPE_OK;
 
-        free(counts);
-        free(temp_records);
+    size_t cut;
+    int in_text;
+    status = find_stable_prefix(encoder->tokenizer, &encoder->ws, encoder->buf, encoder->len, encoder->special_hold, 1,
+                                &cut, &in_text);
+    if (status != BBPE_OK)
+    {
+        encoder->len = old_len;
+        return status;
     }
-    else
+    if (cut == 0)
     {
-        tok->merge_count = 0;
-        // 即使没有 merges，也分配一个零数组，以便安全访问
-        tok->rule_rows = (MergeRuleRow *)calloc(tok->vocab_size, sizeof(MergeRuleRow));
-        if (!tok->rule_rows)
-        {
-            bbpe_destroy(tok);
-            cJSON_Delete(root);
-            return BBPE_ERR_MEMORY;
-        }
+        // 长时间找不到切分点 (如不含字母的超长文本) 时按比例推迟下次查找，使总开销保持线性
+        encoder->retry_len = encoder->len >= STREAM_RETRY_MIN ? encoder->len + encoder->len / 4 : 0;
+        return BBPE_OK;
     }
+    encoder->retry_len = 0;
 
-    // ========== 3. 解析 pre_tokenizer ==========
-    cJSON *pre_tok = cJSON_GetObjectItem(root, "pre_tokenizer");
-    if (pre_tok)
+    IdSink sink = {encoder->ids, 0, encoder->id_capacity, 1};
+    status = encode_text(encoder->tokenizer, &encoder->ws, encoder->buf, cut, &sink, NULL);
+    encoder->ids = sink.ids;
+    encoder->id_capacity = sink.capacity;
+    if (status != BBPE_OK)
     {
-        cJSON *type = cJSON_GetObjectItem(pre_tok, "type");
-        if (type && type->valuestring)
-        {
-            PreTokenizerNode *head = NULL;
-            PreTokenizerNode **tail = &head;
-            BBPEStatus parse_status = BBPE_OK;
-
-            if (strcmp(type->valuestring, "Sequence") == 0)
-            {
-                cJSON *pretokenizers = cJSON_GetObjectItem(pre_tok, "pretokenizers");
-                if (pretokenizers && cJSON_IsArray(pretokenizers))
-                {
-                    int size = cJSON_GetArraySize(pretokenizers);
-                    for (int i = 0; i < size; i++)
-                    {
-                        cJSON *item = cJSON_GetArrayItem(pretokenizers, i);
-                        PreTokenizerNode *node = parse_pre_tokenizer_node(item, &parse_status);
-                        if (!node)
-                        {
-                            while (head)
-                            {
-                                PreTokenizerNode *next = head->next;
-                                if (head->type == PRE_TOKENIZER_REGEX_SPLIT)
-                                {
-                                    free(head->config.split.regex_pattern);
-                                    pcre2_code_free(head->config.split.regex_compiled);
-                                }
-                                free(head);
-                                head = next;
-                            }
-                            bbpe_destroy(tok);
-                            cJSON_Delete(root);
-                            return parse_status;
-                        }
-                        *tail = node;
-                        tail = &node->next;
-                    }
-                }
-            }
-            else
-            {
-                PreTokenizerNode *node = parse_pre_tokenizer_node(pre_tok, &parse_status);
-                if (!node)
-                {
-                    bbpe_destroy(tok);
-                    cJSON_Delete(root);
-                    return parse_status;
-                }
-                head = node;
-            }
-            tok->pre_tokenizers = head;
-        }
+        encoder->len = old_len;
+        return status;
     }
+    memmove(encoder->buf, encoder->buf + cut, encoder->len - cut);
+    encoder->len -= cut;
+    *out_ids = encoder->ids;
+    *out_count = sink.count;
+    return BBPE_OK;
+}
 
-    // ========== 4. 解析 added_tokens ==========
-    cJSON *added_tokens = cJSON_GetObjectItem(root, "added_tokens");
-    if (added_tokens && cJSON_IsArray(added_tokens))
-    {
-        cJSON *token_obj = NULL;
-        cJSON_ArrayForEach(token_obj, added_tokens)
-        {
-            cJSON *content = cJSON_GetObjectItem(token_obj, "content");
-            cJSON *id = cJSON_GetObjectItem(token_obj, "id");
-            if (content && content->valuestring && id && cJSON_IsNumber(id))
-            {
-                int32_t sid = (int32_t)id->valueint;
+BBPEStatus bbpe_stream_encoder_finish(BBPEStreamEncoder *encoder, const int32_t **out_ids, size_t *out_count)
+{
+    if (!encoder || !out_ids || !out_count)
+        return BBPE_ERR_INVALID_INPUT;
+    *out_ids = encoder->ids;
+    *out_count = 0;
+    if (encoder->len == 0)
+        return BBPE_OK;
 
-                if (sid >= tok->vocab_size)
-                {
-                    uint32_t new_size = sid + 1;
+    IdSink sink = {encoder->ids, 0, encoder->id_capacity, 1};
+    BBPEStatus status = encode_text(encoder->tokenizer, &encoder->ws, encoder->buf, encoder->len, &sink, NULL);
+    encoder->ids = sink.ids;
+    encoder->id_capacity = sink.capacity;
+    if (status != BBPE_OK)
+        return status;
+    encoder->len = 0;
+    encoder->retry_len = 0;
+    *out_ids = encoder->ids;
+    *out_count = sink.count;
+    return BBPE_OK;
+}
 
-                    // 扩展 id_to_token
-                    char **new_id_to_token = (char **)realloc(tok->id_to_token, new_size * sizeof(char *));
-                    if (!new_id_to_token)
-                    {
-                        bbpe_destroy(tok);
-                        cJSON_Delete(root);
-                        return BBPE_ERR_MEMORY;
-                    }
-                    for (uint32_t i = tok->vocab_size; i < new_size; i++)
-                    {
-                        new_id_to_token[i] = NULL;
-                    }
-                    tok->id_to_token = new_id_to_token;
+size_t bbpe_stream_encoder_pending(const BBPEStreamEncoder *encoder)
+{
+    return encoder ? encoder->len : 0;
+}
 
-                    // 同步扩展 rule_rows 数组
-                    MergeRuleRow *new_rows;
-                    if (tok->rule_rows)
-                    {
-                        new_rows = (MergeRuleRow *)realloc(tok->rule_rows, new_size * sizeof(MergeRuleRow));
-                    }
-                    else
-                    {
-                        new_rows = (MergeRuleRow *)calloc(new_size, sizeof(MergeRuleRow));
-                    }
-                    if (!new_rows)
-                    {
-                        bbpe_destroy(tok);
-                        cJSON_Delete(root);
-                        return BBPE_ERR_MEMORY;
-                    }
-                    if (tok->rule_rows)
-                    {
-                        // realloc 后新增部分未清零
-                        memset(new_rows + tok->vocab_size, 0, (new_size - tok->vocab_size) * sizeof(MergeRuleRow));
-                    }
-                    tok->rule_rows = new_rows;
+void bbpe_stream_encoder_reset(BBPEStreamEncoder *encoder)
+{
+    if (!encoder)
+        return;
+    encoder->len = 0;
+    encoder->retry_len = 0;
+}
 
-                    tok->vocab_size = new_size;
-                }
+void bbpe_stream_encoder_destroy(BBPEStreamEncoder *encoder)
+{
+    if (!encoder)
+        return;
+    BBPEAllocator allocator = encoder->ws.allocator;
+    workspace_release(&encoder->ws);
+    mem_free(&allocator, encoder->buf);
+    free(encoder->ids);
+    mem_free(&allocator, encoder);
+}
 
-                if (tok->id_to_token[sid] == NULL)
-                {
-                    SpecialEntry *entry = (SpecialEntry *)malloc(sizeof(SpecialEntry));
-                    if (!entry)
-                    {
-                        bbpe_destroy(tok);
-                        cJSON_Delete(root);
-                        return BBPE_ERR_MEMORY;
-                    }
-                    entry->token = strdup(content->valuestring);
-                    if (!entry->token)
-                    {
-                        free(entry);
-                        bbpe_destroy(tok);
-                        cJSON_Delete(root);
-                        return BBPE_ERR_MEMORY;
-                    }
-                    entry->id = sid;
-                    HASH_ADD_KEYPTR(hh, tok->special_tokens_map, entry->token, strlen(entry->token), entry);
-                    tok->id_to_token[sid] = entry->token;
-                }
-            }
-        }
-    }
+BBPEStatus bbpe_set_cache(BBPETokenizer *tokenizer, size_t capacity, BBPECachePolicy policy)
+{
+    if (!tokenizer)
+        return BBPE_ERR_INVALID_INPUT;
+    if (policy != BBPE_CACHE_LRU && policy != BBPE_CACHE_FIFO)
+        return BBPE_ERR_INVALID_INPUT;
 
-    *out_tokenizer = tok;
-    cJSON_Delete(root);
+    // 策略改变或禁用时丢弃已有条目；缩小容量时淘汰多余的旧条目
+    if (capacity == 0 || policy != tokenizer->cache_policy)
+        word_cache_clear(tokenizer, &tokenizer->word_cache);
+    const BBPEAllocator *cache_allocator = &tokenizer->allocator;
+    while (HASH_COUNT(tokenizer->word_cache) > capacity && tokenizer->word_cache)
+    {
+        WordCacheEntry *oldest = tokenizer->word_cache;
+        HASH_DEL(tokenizer->word_cache, oldest);
+        mem_free(cache_allocator, oldest);
+    }
+    tokenizer->cache_capacity = capacity;
+    tokenizer->cache_policy = policy;
+#ifdef BBPE_NUMA
+    numa_drop_replicas(tokenizer);
+#endif
     return BBPE_OK;
 }
 
-BBPEStatus bbpe_encode(BBPETokenizer *tokenizer, const char *text, BBPEOutput *out_output)
+BBPEStatus bbpe_set_merge_index(BBPETokenizer *tokenizer, BBPEMergeIndex index)
 {
-    if (!tokenizer || !text || !out_output)
+    if (!tokenizer)
         return BBPE_ERR_INVALID_INPUT;
-
-    out_output->ids = NULL;
-    out_output->count = 0;
-
-    size_t seg_count = 0;
-    TokenSegment *segments = extract_special_tokens(tokenizer, text, &seg_count);
-    if (!segments)
-        return BBPE_ERR_MEMORY;
-
-    BBPEStatus status = BBPE_OK;
-
-    for (size_t i = 0; i < seg_count; i++)
+    switch (index)
     {
-        if (segments[i].is_special)
+    case BBPE_MERGE_INDEX_ROWS:
+        // 基础分词器的哈希表可能正被派生的分词器共享
+        if (!tokenizer->base && tokenizer->merge_pairs && flag_load(&tokenizer->refs) > 1)
+            return BBPE_ERR_INVALID_INPUT;
+#ifdef BBPE_NUMA
+        if (tokenizer->merge_pairs)
+            numa_drop_replicas(tokenizer);
+#endif
+        if (!tokenizer->base || tokenizer->merge_pairs != tokenizer->base->merge_pairs)
+            mem_free(&tokenizer->allocator, tokenizer->merge_pairs);
+        tokenizer->merge_pairs = NULL;
+        tokenizer->merge_pair_mask = 0;
+        return BBPE_OK;
+    case BBPE_MERGE_INDEX_HASH:
+    {
+        BBPEStatus status = encoder_prepare(tokenizer);
+        if (status != BBPE_OK)
+            return status;
+        if (tokenizer->merge_pairs)
+            return BBPE_OK;
+#ifdef BBPE_NUMA
+        numa_drop_replicas(tokenizer);
+#endif
+        // 哈希表只含模型的合并规则，派生的分词器直接共享基础分词器已建好的表
+        if (tokenizer->base && tokenizer->base->merge_pairs)
         {
-            // 特殊 token 直接添加 ID
-            size_t old_count = out_output->count;
-            out_output->count += 1;
-            int32_t *new_ids = (int32_t *)realloc(out_output->ids, sizeof(int32_t) * out_output->count);
-            if (!new_ids)
-            {
-                status = BBPE_ERR_MEMORY;
-                break;
-            }
-            out_output->ids = new_ids;
-            out_output->ids[old_count] = segments[i].special_id;
+            tokenizer->merge_pairs = tokenizer->base->merge_pairs;
+            tokenizer->merge_pair_mask = tokenizer->base->merge_pair_mask;
+            return BBPE_OK;
         }
-        else
-        {
-            // 普通文本段：预分词后分别编码
-            PreTokenizedResult pre_res;
-            status = pre_tokenize(tokenizer, segments[i].text, &pre_res);
-            if (status != BBPE_OK)
-                break;
+        return build_merge_pairs(tokenizer);
+    }
+    default:
+        return BBPE_ERR_INVALID_INPUT;
+    }
+}
 
-            for (size_t j = 0; j < pre_res.count; j++)
-            {
-                status = encode_chunk(tokenizer, pre_res.chunks[j], out_output);
-                if (status != BBPE_OK)
-                {
-                    free_pre_tokenized(&pre_res);
-                    break;
-                }
-            }
-            free_pre_tokenized(&pre_res);
-            if (status != BBPE_OK)
-                break;
-        }
+BBPEStatus bbpe_set_whole_token_lookup(BBPETokenizer *tokenizer, int enable)
+{
+    if (!tokenizer)
+        return BBPE_ERR_INVALID_INPUT;
+    if (!enable)
+    {
+        if (!tokenizer->stable_in_image)
+            mem_free(&tokenizer->allocator, tokenizer->stable_tokens);
+        tokenizer->stable_tokens = NULL;
+        tokenizer->stable_in_image = 0;
+        return BBPE_OK;
     }
+    if (tokenizer->stable_tokens)
+        return BBPE_OK;
+    BBPEStatus status = encoder_prepare(tokenizer);
+    if (status != BBPE_OK)
+        return status;
+    return build_stable_tokens(tokenizer, &tokenizer->stable_tokens);
+}
 
-    // 释放 segments 中的文本
-    for (size_t i = 0; i < seg_count; i++)
+BBPEStatus bbpe_set_numa_replication(BBPETokenizer *tokenizer, int enable)
+{
+    if (!tokenizer)
+        return BBPE_ERR_INVALID_INPUT;
+#ifdef BBPE_NUMA
+    if (!enable)
     {
-        if (!segments[i].is_special && segments[i].text)
-            free(segments[i].text);
+        numa_state_destroy(tokenizer);
+        return BBPE_OK;
     }
-    free(segments);
+    if (tokenizer->numa)
+        return BBPE_OK;
+    if (tokenizer->load_flags & BBPE_LOAD_DECODE_ONLY)
+        return BBPE_ERR_DECODE_ONLY;
+    // 副本在首次批量编码时由各节点的工作线程建立，这里只读取节点拓扑
+    return numa_state_create(tokenizer, &tokenizer->numa);
+#else
+    (void)enable;
+    return BBPE_ERR_UNSUPPORTED_TYPE;
+#endif
+}
 
-    if (status != BBPE_OK)
-        bbpe_free_output(out_output);
+BBPEStatus bbpe_set_limits(BBPETokenizer *tokenizer, const BBPELimits *limits)
+{
+    if (!tokenizer)
+        return BBPE_ERR_INVALID_INPUT;
+    BBPELimits next = {0};
+    if (limits)
+        next = *limits;
 
-    return status;
+    // PCRE2 上限由各工作区的匹配上下文在下次匹配前同步
+    tokenizer->limits = next;
+    return BBPE_OK;
 }
 
-BBPEStatus bbpe_decode(BBPETokenizer *tokenizer, const int32_t *ids, size_t count, char **out_text)
+BBPEStatus bbpe_get_limits(BBPETokenizer *tokenizer, BBPELimits *out_limits)
 {
-    if (!tokenizer || !ids || count == 0 || !out_text)
+    if (!tokenizer || !out_limits)
         return BBPE_ERR_INVALID_INPUT;
+    *out_limits = tokenizer->limits;
+    return BBPE_OK;
+}
 
-    // 第一遍：计算解码后需要的总字节数
-    size_t total_bytes = 0;
-    for (size_t i = 0; i < count; i++)
+BBPEStatus bbpe_get_memory_usage(BBPETokenizer *tokenizer, BBPEMemoryUsage *out_usage)
+{
+    if (!tokenizer || !out_usage)
+        return BBPE_ERR_INVALID_INPUT;
+    BBPEMemoryUsage usage = {0};
+    const BBPETokenizer *tok = tokenizer;
+    const BBPETokenizer *base = tok->base;
+
+    // 由镜像加载时词汇表、规则行 (及解码表) 直接指向镜像，只计入镜像本身；v2 镜像的规则项另计。
+    // 派生的分词器只计入自己持有的部分，与基础分词器共享的表计入基础分词器
+    if (tok->image && tok->image_kind != IMAGE_BORROWED && tok->image_kind != IMAGE_STATIC)
+        usage.image_bytes = tok->image_size;
+    if (!tok->image && !base)
+        usage.vocab_bytes = vocab_table_bytes(&tok->vocab);
+    usage.vocab_bytes += vocab_table_bytes(&tok->specials);
+    if (tok->id_to_entry && !tok->id_table_in_image)
+        usage.vocab_bytes += (size_t)tok->vocab_size * sizeof(uint32_t);
+
+    // 延迟构建可能正在另一线程进行：规则行与正则部分在 encoder_lock 下读取
+    mutex_lock(&tokenizer->encoder_lock);
+    if (!tok->image && tok->rule_start && (!base || tok->rule_start != base->rule_start))
+        usage.merge_bytes = ((size_t)tok->vocab_size + 1) * sizeof(uint32_t);
+    if (tok->rule_start && !tok->rule_items_in_image && !base)
+        usage.merge_bytes += (size_t)tok->rule_start[tok->vocab_size] * sizeof(MergeRuleItem);
+    if (tok->lazy_merges)
+        usage.merge_bytes += strlen(tok->lazy_merges) + 1;
+    usage.merge_bytes += tok->lazy_record_count * sizeof(MergeRecord);
+    if (tok->merge_pairs && (!base || tok->merge_pairs != base->merge_pairs))
+        usage.merge_bytes += ((size_t)tok->merge_pair_mask + 1) * sizeof(MergePairSlot);
+    if (tok->stable_tokens && !tok->stable_in_image)
+        usage.merge_bytes += ((size_t)tok->vocab_size + 31) / 32 * sizeof(uint32_t);
+
+    if (!tok->decoded_in_image && tok->decoded_start)
+        usage.decode_bytes = ((size_t)tok->vocab_size + 1) * sizeof(uint32_t) + tok->decoded_start[tok->vocab_size];
+    usage.decode_bytes += (size_t)tok->prefix_count * sizeof(int32_t);
+
+    usage.special_trie_bytes = (size_t)tok->special_trie_count * sizeof(SpecialTrieNode);
+
+    for (const NormalizerNode *node = base ? NULL : tok->normalizers; node; node = node->next)
+        usage.pre_tokenizer_bytes += sizeof(NormalizerNode) + (node->pattern ? node->pattern_len + 1 : 0) +
+                                     (node->content ? node->content_len + 1 : 0);
+    for (const PreTokenizerNode *node = base ? NULL : tok->pre_tokenizers; node; node = node->next)
     {
-        int32_t id = ids[i];
-        if (id < 0 || id >= tokenizer->vocab_size)
-            return BBPE_ERR_TOKEN_NOT_FOUND;
-        const char *token_str = tokenizer->id_to_token[id];
-        if (!token_str)
-            return BBPE_ERR_TOKEN_NOT_FOUND;
-
-        const char *p = token_str;
-        while (*p)
+        usage.pre_tokenizer_bytes += sizeof(PreTokenizerNode);
+        if (node->type != PRE_TOKENIZER_REGEX_SPLIT)
+            continue;
+        if (node->config.split.regex_pattern)
+            usage.pre_tokenizer_bytes += strlen(node->config.split.regex_pattern) + 1;
+        if (node->config.split.regex_compiled)
         {
-            uint32_t cp;
-            int len = utf8_decode(p, &cp);
-            if (len < 0)
-                return BBPE_ERR_INVALID_INPUT;
-
-            if (cp < UNICODE_MAP_SIZE && tokenizer->unicode_to_byte[cp] != 0)
-            {
-                total_bytes += 1; // 映射回原始字节
-            }
-            else
-            {
-                total_bytes += len; // 保留原 UTF-8 字符
-            }
-            p += len;
+            size_t code_size = 0, jit_size = 0;
+            pcre2_pattern_info(node->config.split.regex_compiled, PCRE2_INFO_SIZE, &code_size);
+            pcre2_pattern_info(node->config.split.regex_compiled, PCRE2_INFO_JITSIZE, &jit_size);
+            usage.pre_tokenizer_bytes += code_size + jit_size;
         }
     }
+    mutex_unlock(&tokenizer->encoder_lock);
 
-    char *result = (char *)malloc(total_bytes + 1);
-    if (!result)
-        return BBPE_ERR_MEMORY;
+    mutex_lock(&tokenizer->cache_lock);
+    WordCacheEntry *entry, *tmp;
+    HASH_ITER(hh, tokenizer->word_cache, entry, tmp)
+    {
+        usage.cache_bytes += sizeof(WordCacheEntry) + entry->count * sizeof(int32_t) + entry->key_len;
+    }
+    if (tokenizer->word_cache)
+        usage.cache_bytes += sizeof(UT_hash_table) + tokenizer->word_cache->hh.tbl->num_buckets * sizeof(UT_hash_bucket);
+    mutex_unlock(&tokenizer->cache_lock);
 
-    // 第二遍：实际解码并填充 result
-    size_t pos = 0;
-    for (size_t i = 0; i < count; i++)
+#ifdef BBPE_NUMA
+    // 各节点副本的规则表计入 merge_bytes，副本的词级缓存计入 cache_bytes
+    if (tok->numa)
     {
-        int32_t id = ids[i];
-        const char *token_str = tokenizer->id_to_token[id];
-        const char *p = token_str;
-        while (*p)
+        mutex_lock(&tok->numa->lock);
+        for (int node = 0; node < tok->numa->node_count; node++)
         {
-            uint32_t cp;
-            int len = utf8_decode(p, &cp);
-            if (len < 0)
-            {
-                free(result);
-                return BBPE_ERR_INVALID_INPUT;
-            }
-
-            if (cp < UNICODE_MAP_SIZE && tokenizer->unicode_to_byte[cp] != 0)
-            {
-                result[pos++] = (char)tokenizer->unicode_to_byte[cp];
-            }
-            else
+            TableReplica *replica = tok->numa->replicas[node];
+            if (!replica)
+                continue;
+            usage.merge_bytes += sizeof(TableReplica);
+            if (replica->rule_start)
+                usage.merge_bytes += ((size_t)tok->vocab_size + 1) * sizeof(uint32_t) +
+                                     (size_t)replica->rule_start[tok->vocab_size] * sizeof(MergeRuleItem);
+            if (replica->merge_pairs)
+                usage.merge_bytes += ((size_t)tok->merge_pair_mask + 1) * sizeof(MergePairSlot);
+            mutex_lock(&replica->cache_lock);
+            HASH_ITER(hh, replica->word_cache, entry, tmp)
             {
-                memcpy(result + pos, p, len);
-                pos += len;
+                usage.cache_bytes += sizeof(WordCacheEntry) + entry->count * sizeof(int32_t) + entry->key_len;
             }
-            p += len;
+            if (replica->word_cache)
+                usage.cache_bytes +=
+                    sizeof(UT_hash_table) + replica->word_cache->hh.tbl->num_buckets * sizeof(UT_hash_bucket);
+            mutex_unlock(&replica->cache_lock);
         }
+        mutex_unlock(&tok->numa->lock);
     }
-    result[pos] = '\0';
-    *out_text = result;
+#endif
+
+    usage.total_bytes = sizeof(BBPETokenizer) + usage.vocab_bytes + usage.merge_bytes + usage.decode_bytes +
+                        usage.special_trie_bytes + usage.pre_tokenizer_bytes + usage.cache_bytes + usage.image_bytes;
+    *out_usage = usage;
+    return BBPE_OK;
+}
+
+BBPEStatus bbpe_get_stats(BBPETokenizer *tokenizer, BBPEStats *out_stats)
+{
+    if (!tokenizer || !out_stats)
+        return BBPE_ERR_INVALID_INPUT;
+#ifdef BBPE_ENABLE_STATS
+    mutex_lock(&tokenizer->stats_lock);
+    *out_stats = tokenizer->stats;
+    mutex_unlock(&tokenizer->stats_lock);
+    return BBPE_OK;
+#else
+    memset(out_stats, 0, sizeof(*out_stats));
+    return BBPE_ERR_UNSUPPORTED_TYPE;
+#endif
+}
+
+BBPEStatus bbpe_reset_stats(BBPETokenizer *tokenizer)
+{
+    if (!tokenizer)
+        return BBPE_ERR_INVALID_INPUT;
+#ifdef BBPE_ENABLE_STATS
+    mutex_lock(&tokenizer->stats_lock);
+    memset(&tokenizer->stats, 0, sizeof(tokenizer->stats));
+    mutex_unlock(&tokenizer->stats_lock);
     return BBPE_OK;
+#else
+    return BBPE_ERR_UNSUPPORTED_TYPE;
+#endif
 }
 
 void bbpe_free_output(BBPEOutput *output)
@@ -1845,59 +9522,105 @@ void bbpe_free_output(BBPEOutput *output)
         free(output->ids);
         output->ids = NULL;
         output->count = 0;
+        output->capacity = 0;
     }
 }
 
-void bbpe_destroy(BBPETokenizer *tokenizer)
+void bbpe_free_offsets(BBPEOffsets *offsets)
 {
-    if (!tokenizer)
-        return;
-
-    // 释放预计算的字节字符串
-    for (int i = 0; i < 256; i++)
-        free(tokenizer->byte_vocab_strs[i]);
-
-    VocabEntry *v_cur, *v_tmp;
-    HASH_ITER(hh, tokenizer->vocab_map, v_cur, v_tmp)
+    if (offsets)
     {
-        HASH_DEL(tokenizer->vocab_map, v_cur);
-        free(v_cur->token);
-        free(v_cur);
+        free(offsets->start);
+        free(offsets->end);
+        offsets->start = NULL;
+        offsets->end = NULL;
+        offsets->count = 0;
+        offsets->capacity = 0;
     }
+}
 
-    SpecialEntry *s_cur, *s_tmp;
-    HASH_ITER(hh, tokenizer->special_tokens_map, s_cur, s_tmp)
-    {
-        HASH_DEL(tokenizer->special_tokens_map, s_cur);
-        free(s_cur->token);
-        free(s_cur);
-    }
+/**
+ * @brief 释放分词器的一个引用，最后一个引用释放时释放分词器；派生的分词器随后释放其对基础分词器的引用
+ */
+static void tokenizer_release(BBPETokenizer *tokenizer)
+{
+    if (atomic_add(&tokenizer->refs, -1) > 0)
+        return;
+    // 分配器随分词器一起释放，先复制一份用于释放结构本身
+    BBPEAllocator allocator = tokenizer->allocator;
+    const BBPEAllocator *a = &allocator;
+    BBPETokenizer *base = tokenizer->base;
 
-    PreTokenizerNode *p_cur = tokenizer->pre_tokenizers;
-    while (p_cur)
+    if (!base)
     {
-        PreTokenizerNode *p_next = p_cur->next;
-        if (p_cur->type == PRE_TOKENIZER_REGEX_SPLIT)
+        // 来自镜像的词汇表与规则行不单独释放，随镜像一并释放
+        if (!tokenizer->image)
+            vocab_table_free(&tokenizer->vocab);
+
+        normalizer_list_free(a, tokenizer->normalizers);
+
+        PreTokenizerNode *p_cur = tokenizer->pre_tokenizers;
+        while (p_cur)
         {
-            free(p_cur->config.split.regex_pattern);
-            if (p_cur->config.split.regex_compiled)
-                pcre2_code_free(p_cur->config.split.regex_compiled);
+            PreTokenizerNode *p_next = p_cur->next;
+            if (p_cur->type == PRE_TOKENIZER_REGEX_SPLIT)
+            {
+                mem_free(a, p_cur->config.split.regex_pattern);
+                if (p_cur->config.split.regex_compiled)
+                    pcre2_code_free(p_cur->config.split.regex_compiled);
+            }
+            mem_free(a, p_cur);
+            p_cur = p_next;
         }
-        free(p_cur);
-        p_cur = p_next;
+
+        if (!tokenizer->image)
+            mem_free(a, tokenizer->rule_start);
+        if (!tokenizer->rule_items_in_image)
+            mem_free(a, tokenizer->rule_items);
+        mem_free(a, tokenizer->merge_pairs);
+    }
+    else
+    {
+        // 词汇表、规则项、规范化器与预分词器属于基础分词器；规则行起点与哈希表与其不同时才是自己的
+        if (tokenizer->rule_start != base->rule_start)
+            mem_free(a, tokenizer->rule_start);
+        if (tokenizer->merge_pairs != base->merge_pairs)
+            mem_free(a, tokenizer->merge_pairs);
     }
 
-    if (tokenizer->rule_rows)
+    vocab_table_free(&tokenizer->specials);
+    word_cache_clear(tokenizer, &tokenizer->word_cache);
+#ifdef BBPE_NUMA
+    numa_state_destroy(tokenizer);
+#endif
+    tokenizer_destroy_locks(tokenizer);
+    mem_free(a, tokenizer->special_trie);
+    mem_free(a, tokenizer->lazy_merges);
+    mem_free(a, tokenizer->lazy_records);
+
+    if (!tokenizer->id_table_in_image)
+        mem_free(a, tokenizer->id_to_entry);
+    if (!tokenizer->decoded_in_image)
     {
-        for (uint32_t i = 0; i < tokenizer->vocab_size; i++)
-        {
-            free(tokenizer->rule_rows[i].items);
-        }
-        free(tokenizer->rule_rows);
+        mem_free(a, tokenizer->decoded_start);
+        mem_free(a, tokenizer->decoded_pool);
     }
+    if (!tokenizer->stable_in_image)
+        mem_free(a, tokenizer->stable_tokens);
+    mem_free(a, tokenizer->prefix_ids);
+    release_image(a, tokenizer->image, tokenizer->image_size, tokenizer->image_kind);
+    pcre2_general_context_free(tokenizer->pcre2_memory);
+    mem_free(a, tokenizer);
+    if (base)
+        tokenizer_release(base);
+}
 
-    free(tokenizer->id_to_token);
-    free(tokenizer);
+void bbpe_destroy(BBPETokenizer *tokenizer)
+{
+    if (!tokenizer)
+        return;
+    bbpe_async_stop(tokenizer);
+    tokenizer_release(tokenizer);
 }
 
 // ============================================================================
@@ -1946,235 +9669,1064 @@ static uint32_t le32_to_host(uint32_t val)
 }
 
 /**
- * @brief 从文件读取一个 uint32_t 小端，并转换为主机字节序
+ * @brief 64 位版本的字节序转换 (写入与读取相同，互为逆操作)
  */
-static BBPEStatus read_u32_le(FILE *f, uint32_t *out)
+static uint64_t le64_to_host(uint64_t val)
 {
-    uint32_t val;
-    if (fread(&val, sizeof(val), 1, f) != 1)
+    uint32_t test = 1;
+    if (*(uint8_t *)&test == 1)
+        return val;
+    return ((uint64_t)le32_to_host((uint32_t)val) << 32) | le32_to_host((uint32_t)(val >> 32));
+}
+
+// ============================================================================
+// 二进制镜像 (v3)：按内存中的最终结构布局，加载时可直接映射使用
+// ============================================================================
+//
+// 布局 (除 RULE_ITEMS 为小端 64 位外，所有整数为小端 32 位)：
+//   ImageHeader (魔数 "BBPE"、版本 3、计数字段、段表)
+//   各数据段，起始偏移按 IMAGE_ALIGN 对齐：
+//     VOCAB_POOL        token 字符串池 (各自以 '\0' 结尾)
+//     VOCAB_OFFSETS     u32[vocab_count]  条目 → 池内偏移
+//     VOCAB_LENGTHS     u32[vocab_count]  条目 → 字节数
+//     VOCAB_HASHES      u32[vocab_count]  条目 → FNV-1a 哈希
+//     VOCAB_IDS         i32[vocab_count]  条目 → token ID
+//     VOCAB_SLOTS       u32[slot_mask+1]  开放寻址槽 (条目下标 + 1)
+//     RULE_START        u32[vocab_size+1] 规则行起点
+//     RULE_ITEMS        u64[规则数]        打包的 {right_id, new_id, priority} (与 MergeRuleItem 相同)，行内按 right_id 排序
+//     SPECIALS          special_count × {u32 id, u32 len, bytes}
+//     PRE_TOKENIZERS    pre_count × 预分词器记录 (与 v1 相同)
+//     REGEX_CODES       u32 校验和、u32 保留字、pcre2_serialize_encode 结果
+//     DECODE_START      u32[vocab_size+1] 解码字节池起点
+//     DECODE_POOL       各 token 解码后的原始字节 (按 id 顺序)
+//     ID_ENTRIES        u32[vocab_size]   id → 字符串条目 (与 id_to_entry 相同)
+//     STABLE_TOKENS     u32[(vocab_size+31)/32] 稳定 token 位图 (启用整词直查时写入，否则为空)
+//     NORMALIZERS       规范化器记录直到段尾：u8 类型，Replace 另有 u32 长度 + 查找串、u32 长度 + 替换串，
+//                       Prepend 另有 u32 长度 + 前缀 (没有规范化器时为空)
+//     VOCAB_PHF         u32 桶数、u32 槽数、u32 种子、u32 保留字、u32[槽数] 条目下标 (全 1 为空)、
+//                       u32[(桶数+1)/2] 每字两个 16 位位移值：词汇表的最小完美哈希 (构建失败时为空)
+// 段表记录每段的 (offset, size)；读取时忽略未知的后续段，缺失的段视为空。
+// v2 镜像布局相同，只是 RULE_ITEMS 为 i32 三元组 {right_id, new_id, priority}，加载时转换到堆上
+
+/**
+ * @brief 镜像数据段编号
+ */
+enum
+{
+    IMG_VOCAB_POOL,
+    IMG_VOCAB_OFFSETS,
+    IMG_VOCAB_LENGTHS,
+    IMG_VOCAB_HASHES,
+    IMG_VOCAB_IDS,
+    IMG_VOCAB_SLOTS,
+    IMG_RULE_START,
+    IMG_RULE_ITEMS,
+    IMG_SPECIALS,
+    IMG_PRE_TOKENIZERS,
+    IMG_REGEX_CODES, /* pcre2_serialize_encode 的结果 (可选，缺失或不兼容时重新编译) */
+    IMG_DECODE_START, /* u32[vocab_size+1] 解码字节池起点 (可选，缺失时加载后重建) */
+    IMG_DECODE_POOL,  /* 各 token 解码后的原始字节 */
+    IMG_ID_ENTRIES,   /* u32[vocab_size] id → 字符串条目 (可选，缺失时加载后重建) */
+    IMG_STABLE_TOKENS, /* 稳定 token 位图 (可选，缺失时不启用整词直查) */
+    IMG_NORMALIZERS,   /* 规范化器链 (可选，缺失时不规范化) */
+    IMG_VOCAB_PHF,     /* 词汇表的最小完美哈希 (可选，缺失时使用开放寻址槽) */
+    IMG_SECTION_COUNT
+};
+
+/**
+ * @brief 镜像段表项
+ */
+typedef struct
+{
+    uint32_t offset; /* 段起始偏移 (相对镜像起点) */
+    uint32_t size;   /* 段字节数 */
+} ImageSection;
+
+/**
+ * @brief 镜像头固定部分 (其后紧跟 section_count 个 ImageSection)
+ */
+typedef struct
+{
+    char magic[4];          /* "BBPE" */
+    uint32_t version;       /* IMAGE_VERSION */
+    uint32_t vocab_size;    /* 最大 ID + 1 */
+    uint32_t vocab_count;   /* 词汇表条目数 */
+    uint32_t slot_mask;     /* 词汇表槽位数 - 1 */
+    uint32_t merge_count;   /* 合并规则统计值 */
+    uint32_t special_count; /* 特殊 token 数 */
+    uint32_t pre_count;     /* 预分词器节点数 */
+    uint32_t section_count; /* 段表项数 */
+} ImageHeader;
+
+#define IMAGE_HEADER_WORDS 8 /* ImageHeader 中 magic 之后的 u32 字段数 */
+
+typedef char image_header_size_check[sizeof(ImageHeader) == 4 + IMAGE_HEADER_WORDS * 4 ? 1 : -1];
+typedef char merge_rule_item_size_check[sizeof(MergeRuleItem) == sizeof(uint64_t) ? 1 : -1];
+
+/**
+ * @brief 判断主机是否为小端字节序
+ */
+static int host_is_little_endian(void)
+{
+    uint32_t test = 1;
+    return *(uint8_t *)&test == 1;
+}
+
+/**
+ * @brief 可增长的字节缓冲区 (用于构建镜像)
+ */
+typedef struct
+{
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+} ByteBuf;
+
+/**
+ * @brief 向缓冲区追加 n 字节，src 为 NULL 时追加 0
+ */
+static BBPEStatus buf_put(ByteBuf *b, const void *src, size_t n)
+{
+    if (n > SIZE_MAX - b->size)
+        return BBPE_ERR_MEMORY;
+    if (b->size + n > b->capacity)
     {
-        return BBPE_ERR_FILE_IO;
+        size_t new_cap = b->capacity ? b->capacity : 4096;
+        while (new_cap < b->size + n)
+        {
+            if (new_cap > SIZE_MAX / 2)
+                return BBPE_ERR_MEMORY;
+            new_cap *= 2;
+        }
+        uint8_t *data = (uint8_t *)realloc(b->data, new_cap);
+        if (!data)
+            return BBPE_ERR_MEMORY;
+        b->data = data;
+        b->capacity = new_cap;
     }
-    *out = le32_to_host(val);
+    if (src)
+        memcpy(b->data + b->size, src, n);
+    else
+        memset(b->data + b->size, 0, n);
+    b->size += n;
     return BBPE_OK;
 }
 
 /**
- * @brief 将一个主机字节序的 uint32_t 转换为小端后写入文件
+ * @brief 以小端追加一个 uint32_t
  */
-static BBPEStatus write_u32_le(FILE *f, uint32_t val)
+static BBPEStatus buf_put_u32(ByteBuf *b, uint32_t val)
 {
     uint32_t le_val = host_to_le32(val);
-    if (fwrite(&le_val, sizeof(le_val), 1, f) != 1)
+    return buf_put(b, &le_val, sizeof(le_val));
+}
+
+/**
+ * @brief 以小端追加 uint32_t 数组 (小端主机整体复制)
+ */
+static BBPEStatus buf_put_u32_array(ByteBuf *b, const uint32_t *vals, size_t n)
+{
+    if (n > SIZE_MAX / sizeof(uint32_t))
+        return BBPE_ERR_MEMORY;
+    if (host_is_little_endian())
+        return buf_put(b, vals, n * sizeof(uint32_t));
+    for (size_t i = 0; i < n; i++)
     {
-        return BBPE_ERR_FILE_IO;
+        BBPEStatus status = buf_put_u32(b, vals[i]);
+        if (status != BBPE_OK)
+            return status;
     }
     return BBPE_OK;
 }
 
-// ============================================================================
-// 序列化实现：bbpe_save
-// ============================================================================
-
-BBPEStatus bbpe_save(BBPETokenizer *tok, const char *filename)
+/**
+ * @brief 以小端追加 uint64_t 数组 (小端主机整体复制)
+ */
+static BBPEStatus buf_put_u64_array(ByteBuf *b, const uint64_t *vals, size_t n)
 {
-    if (!tok || !filename)
-        return BBPE_ERR_INVALID_INPUT;
+    if (n > SIZE_MAX / sizeof(uint64_t))
+        return BBPE_ERR_MEMORY;
+    if (host_is_little_endian())
+        return buf_put(b, vals, n * sizeof(uint64_t));
+    for (size_t i = 0; i < n; i++)
+    {
+        uint64_t le_val = le64_to_host(vals[i]);
+        BBPEStatus status = buf_put(b, &le_val, sizeof(le_val));
+        if (status != BBPE_OK)
+            return status;
+    }
+    return BBPE_OK;
+}
 
-    FILE *f = fopen(filename, "wb");
-    if (!f)
-        return BBPE_ERR_FILE_IO;
+/**
+ * @brief 以 0 填充到 IMAGE_ALIGN 的整数倍
+ */
+static BBPEStatus buf_align(ByteBuf *b)
+{
+    size_t pad = (IMAGE_ALIGN - b->size % IMAGE_ALIGN) % IMAGE_ALIGN;
+    return buf_put(b, NULL, pad);
+}
 
-    BBPEStatus status = BBPE_OK;
-    uint32_t tmp;
-    VocabEntry *v_cur, *v_tmp;
-    SpecialEntry *s_cur, *s_tmp;
+#define PHF_SEED_TRIES 8     /* 换种子 (同时放宽槽数) 重试的次数，全部失败时不写完美哈希段 */
+#define PHF_MAX_BUCKET 64    /* 单个桶内键数的上限，超过时换种子 */
+#define PHF_MAX_PILOT 0xFFFF /* 位移值以 16 位保存 */
 
-    // 1. 写入魔数 "BBPE"
-    if (fwrite("BBPE", 1, 4, f) != 4)
-    {
-        status = BBPE_ERR_FILE_IO;
-        goto cleanup;
-    }
+/**
+ * @brief 为词汇表构建最小完美哈希并写入 VOCAB_PHF 段：
+ *        u32 桶数、u32 槽数、u32 种子、u32 保留字、u32[槽数] 条目下标 (PHF_EMPTY 为空)、u32[(桶数+1)/2] 位移值
+ * @note 按 PTHash 的方法：只收录查找时能命中的条目 (重复 token 以后加入者为准)，键先分到约 k/3 个桶，
+ *       从大到小依次为每个桶寻找使桶内各键落到互不相同空槽的位移值；槽数约为 1.008k。
+ *       构建失败 (多次换种子仍无法放置) 时写入空段，加载后回退到开放寻址槽
+ */
+static BBPEStatus put_vocab_phf(const BBPETokenizer *tok, ByteBuf *out)
+{
+    const VocabTable *vt = &tok->vocab;
+    const BBPEAllocator *a = &tok->allocator;
+    if (vt->count == 0 || !vt->slots)
+        return BBPE_OK;
 
-    // 2. 写入版本号 (1)
-    if (write_u32_le(f, 1) != BBPE_OK)
-    {
-        status = BBPE_ERR_FILE_IO;
+    BBPEStatus status = BBPE_ERR_MEMORY;
+    uint32_t n = 0;
+    uint32_t bucket_count = vt->count / 3 + 1;
+    size_t max_slots = (size_t)vt->count + ((size_t)vt->count >> 7) * PHF_SEED_TRIES + 1;
+    size_t max_words = PHF_HEADER_WORDS + max_slots + ((size_t)bucket_count + 1) / 2;
+    uint64_t *hashes = (uint64_t *)mem_alloc(a, (size_t)vt->count * sizeof(uint64_t));
+    uint64_t *keys = (uint64_t *)mem_alloc(a, (size_t)vt->count * sizeof(uint64_t));
+    uint32_t *entries = (uint32_t *)mem_alloc(a, (size_t)vt->count * sizeof(uint32_t));
+    uint32_t *order = (uint32_t *)mem_alloc(a, (size_t)vt->count * sizeof(uint32_t));
+    uint32_t *bucket_start = (uint32_t *)mem_alloc(a, ((size_t)bucket_count + 1) * sizeof(uint32_t));
+    uint32_t *bucket_order = (uint32_t *)mem_alloc(a, (size_t)bucket_count * sizeof(uint32_t));
+    uint32_t *words = (uint32_t *)mem_alloc(a, max_words * sizeof(uint32_t));
+    if (!hashes || !keys || !entries || !order || !bucket_start || !bucket_order || !words)
         goto cleanup;
-    }
-
-    // 3. 写入词汇表条目数
-    uint32_t vocab_count = HASH_COUNT(tok->vocab_map);
-    if (write_u32_le(f, vocab_count) != BBPE_OK)
+    for (uint32_t e = 0; e < vt->count; e++)
     {
-        status = BBPE_ERR_FILE_IO;
-        goto cleanup;
+        const char *str = vt->pool + vt->offsets[e];
+        if (vocab_table_find_entry(vt, str, vt->lengths[e], vt->hashes[e]) != (int64_t)e)
+            continue;
+        hashes[n] = vocab_hash64(str, vt->lengths[e]);
+        entries[n++] = e;
     }
+    bucket_count = n / 3 + 1;
 
-    // 4. 写入每个词汇表条目
-    HASH_ITER(hh, tok->vocab_map, v_cur, v_tmp)
+    status = BBPE_OK;
+    for (uint32_t attempt = 0; attempt < PHF_SEED_TRIES; attempt++)
     {
-        uint32_t len = (uint32_t)strlen(v_cur->token);
-        if (write_u32_le(f, len) != BBPE_OK)
+        uint32_t seed = 0x9E3779B9u * (attempt + 1);
+        uint32_t slot_count = n + (n >> 7) * (attempt + 1) + 1;
+        uint32_t *slots = words + PHF_HEADER_WORDS;
+        uint32_t *pilots = slots + slot_count;
+        uint32_t pilot_words = (bucket_count + 1) / 2;
+        memset(slots, 0xFF, (size_t)slot_count * sizeof(uint32_t));
+        memset(pilots, 0, (size_t)pilot_words * sizeof(uint32_t));
+
+        // 按桶做计数排序：order 为按桶排列的键下标，bucket_start 为各桶起点
+        memset(bucket_start, 0, ((size_t)bucket_count + 1) * sizeof(uint32_t));
+        for (uint32_t i = 0; i < n; i++)
         {
-            status = BBPE_ERR_FILE_IO;
-            goto cleanup;
+            keys[i] = phf_mix(hashes[i] ^ seed);
+            bucket_start[phf_reduce((uint32_t)(keys[i] >> 32), bucket_count) + 1]++;
         }
-        if (fwrite(v_cur->token, 1, len, f) != len)
+        uint32_t max_size = 0;
+        for (uint32_t b = 0; b < bucket_count; b++)
         {
-            status = BBPE_ERR_FILE_IO;
-            goto cleanup;
+            if (bucket_start[b + 1] > max_size)
+                max_size = bucket_start[b + 1];
+            bucket_start[b + 1] += bucket_start[b];
+        }
+        if (max_size > PHF_MAX_BUCKET)
+            continue;
+        uint32_t fill[PHF_MAX_BUCKET + 2] = {0};
+        for (uint32_t b = 0; b < bucket_count; b++)
+            fill[bucket_start[b + 1] - bucket_start[b]]++;
+        uint32_t pos = 0;
+        for (int size = (int)max_size; size >= 0; size--) // 各大小的桶在 bucket_order 中的起点 (从大到小)
+        {
+            uint32_t c = fill[size];
+            fill[size] = pos;
+            pos += c;
         }
-        if (write_u32_le(f, (uint32_t)v_cur->id) != BBPE_OK)
+        for (uint32_t b = 0; b < bucket_count; b++)
+            bucket_order[fill[bucket_start[b + 1] - bucket_start[b]]++] = b;
+        for (uint32_t i = 0; i < n; i++)
         {
-            status = BBPE_ERR_FILE_IO;
-            goto cleanup;
+            uint32_t b = phf_reduce((uint32_t)(keys[i] >> 32), bucket_count);
+            order[--bucket_start[b + 1]] = i;
         }
-    }
+        // 上面回退后 bucket_start[b + 1] 等于桶 b 的起点，整体后移一位
+        memmove(bucket_start, bucket_start + 1, (size_t)bucket_count * sizeof(uint32_t));
+        bucket_start[bucket_count] = n;
 
-    // 5. 计算并写入合并规则总数
-    uint32_t merge_total = 0;
-    for (uint32_t left = 0; left < tok->vocab_size; left++)
-    {
-        merge_total += tok->rule_rows[left].count;
-    }
-    if (write_u32_le(f, merge_total) != BBPE_OK)
-    {
-        status = BBPE_ERR_FILE_IO;
-        goto cleanup;
+        int placed = 1;
+        for (uint32_t i = 0; i < bucket_count && placed; i++)
+        {
+            uint32_t b = bucket_order[i];
+            const uint32_t *members = order + bucket_start[b];
+            uint32_t size = bucket_start[b + 1] - bucket_start[b];
+            if (size == 0)
+                break; // 其余都是空桶，位移值保持 0
+            uint32_t cand[PHF_MAX_BUCKET];
+            uint32_t pilot = 0;
+            for (; pilot <= PHF_MAX_PILOT; pilot++)
+            {
+                uint32_t j = 0;
+                for (; j < size; j++)
+                {
+                    cand[j] = phf_place(keys[members[j]], pilot, slot_count);
+                    if (slots[cand[j]] != PHF_EMPTY)
+                        break;
+                    uint32_t k = 0;
+                    while (k < j && cand[k] != cand[j])
+                        k++;
+                    if (k < j)
+                        break;
+                }
+                if (j == size)
+                    break;
+            }
+            if (pilot > PHF_MAX_PILOT)
+            {
+                placed = 0;
+                break;
+            }
+            for (uint32_t j = 0; j < size; j++)
+                slots[cand[j]] = entries[members[j]];
+            pilots[b >> 1] |= pilot << ((b & 1) * 16);
+        }
+        if (!placed)
+            continue;
+
+        words[0] = bucket_count;
+        words[1] = slot_count;
+        words[2] = seed;
+        words[3] = 0;
+        status = buf_put_u32_array(out, words, PHF_HEADER_WORDS + (size_t)slot_count + pilot_words);
+        break;
     }
 
-    // 6. 写入所有合并规则 (left, right, new_id, priority)
-    for (uint32_t left = 0; left < tok->vocab_size; left++)
+cleanup:
+    mem_free(a, hashes);
+    mem_free(a, keys);
+    mem_free(a, entries);
+    mem_free(a, order);
+    mem_free(a, bucket_start);
+    mem_free(a, bucket_order);
+    mem_free(a, words);
+    return status;
+}
+
+/**
+ * @brief 写入所有 Split 节点的预编译正则：u32 FNV-1a 校验和、u32 保留字，随后是 pcre2_serialize_encode 的结果
+ * @note 没有 Split 节点或序列化失败时写入空段，加载时回退到重新编译
+ */
+static BBPEStatus put_regex_codes(const BBPETokenizer *tok, ByteBuf *out)
+{
+    int32_t n = 0;
+    for (const PreTokenizerNode *node = tok->pre_tokenizers; node; node = node->next)
+        n += node->type == PRE_TOKENIZER_REGEX_SPLIT;
+    if (n == 0)
+        return BBPE_OK;
+    const pcre2_code **codes = (const pcre2_code **)mem_alloc(&tok->allocator, (size_t)n * sizeof(*codes));
+    if (!codes)
+        return BBPE_ERR_MEMORY;
+    n = 0;
+    for (const PreTokenizerNode *node = tok->pre_tokenizers; node; node = node->next)
+        if (node->type == PRE_TOKENIZER_REGEX_SPLIT)
+            codes[n++] = node->config.split.regex_compiled;
+
+    uint8_t *bytes;
+    PCRE2_SIZE size;
+    int rc = pcre2_serialize_encode(codes, n, &bytes, &size, tok->pcre2_memory);
+    mem_free(&tok->allocator, (void *)codes);
+    if (rc < 0)
+        return BBPE_OK;
+    BBPEStatus status = buf_put_u32(out, vocab_hash((const char *)bytes, size));
+    if (status == BBPE_OK)
+        status = buf_put_u32(out, 0);
+    if (status == BBPE_OK)
+        status = buf_put(out, bytes, size);
+    pcre2_serialize_free(bytes);
+    return status;
+}
+
+/**
+ * @brief 将分词器序列化为 v3 镜像
+ * @param tok 分词器句柄
+ * @param out 输出缓冲区 (调用者负责释放 out->data)
+ * @return BBPEStatus；推迟构建的规则行与正则先行构建，只解码的分词器返回 BBPE_ERR_DECODE_ONLY
+ */
+static BBPEStatus build_image(BBPETokenizer *tok, ByteBuf *out)
+{
+    memset(out, 0, sizeof(*out));
+    BBPEStatus status = encoder_prepare(tok);
+    if (status != BBPE_OK)
+        return status;
+
+    const VocabTable *vt = &tok->vocab;
+    ImageSection sections[IMG_SECTION_COUNT];
+    const VocabTable *specials = &tok->specials;
+    uint32_t special_count = specials->count;
+    uint32_t pre_count = 0;
+    for (PreTokenizerNode *node = tok->pre_tokenizers; node; node = node->next)
+        pre_count++;
+    uint32_t rule_total = tok->rule_start ? tok->rule_start[tok->vocab_size] : 0;
+
+    size_t header_size = sizeof(ImageHeader) + sizeof(sections);
+    status = buf_put(out, NULL, header_size);
+
+    for (int sec = 0; sec < IMG_SECTION_COUNT && status == BBPE_OK; sec++)
     {
-        MergeRuleRow *row = &tok->rule_rows[left];
-        for (uint32_t j = 0; j < row->count; j++)
+        status = buf_align(out);
+        if (status != BBPE_OK)
+            break;
+        size_t start = out->size;
+        switch (sec)
         {
-            MergeRuleItem *item = &row->items[j];
-            if (write_u32_le(f, left) != BBPE_OK)
-            {
-                status = BBPE_ERR_FILE_IO;
-                goto cleanup;
-            }
-            if (write_u32_le(f, (uint32_t)item->right_id) != BBPE_OK)
+        case IMG_VOCAB_POOL:
+            status = buf_put(out, vt->pool, vt->pool_size);
+            break;
+        case IMG_VOCAB_OFFSETS:
+            status = buf_put_u32_array(out, vt->offsets, vt->count);
+            break;
+        case IMG_VOCAB_LENGTHS:
+            status = buf_put_u32_array(out, vt->lengths, vt->count);
+            break;
+        case IMG_VOCAB_HASHES:
+            status = buf_put_u32_array(out, vt->hashes, vt->count);
+            break;
+        case IMG_VOCAB_IDS:
+            status = buf_put_u32_array(out, (const uint32_t *)vt->ids, vt->count);
+            break;
+        case IMG_VOCAB_SLOTS:
+            if (vt->slots)
+                status = buf_put_u32_array(out, vt->slots, (size_t)vt->slot_mask + 1);
+            break;
+        case IMG_RULE_START:
+            if (tok->rule_start)
+                status = buf_put_u32_array(out, tok->rule_start, (size_t)tok->vocab_size + 1);
+            break;
+        case IMG_RULE_ITEMS:
+            status = buf_put_u64_array(out, tok->rule_items, rule_total);
+            break;
+        case IMG_SPECIALS:
+        {
+            for (uint32_t e = 0; e < specials->count; e++)
             {
-                status = BBPE_ERR_FILE_IO;
-                goto cleanup;
+                const char *token = specials->pool + specials->offsets[e];
+                uint32_t len = (uint32_t)strlen(token);
+                if ((status = buf_put_u32(out, (uint32_t)specials->ids[e])) != BBPE_OK ||
+                    (status = buf_put_u32(out, len)) != BBPE_OK ||
+                    (status = buf_put(out, token, len)) != BBPE_OK)
+                    break;
             }
-            if (write_u32_le(f, (uint32_t)item->new_id) != BBPE_OK)
+            break;
+        }
+        case IMG_PRE_TOKENIZERS:
+            for (PreTokenizerNode *node = tok->pre_tokenizers; node && status == BBPE_OK; node = node->next)
             {
-                status = BBPE_ERR_FILE_IO;
-                goto cleanup;
+                uint8_t type_byte = (uint8_t)node->type;
+                status = buf_put(out, &type_byte, 1);
+                if (status != BBPE_OK)
+                    break;
+                if (node->type == PRE_TOKENIZER_BYTE_LEVEL)
+                {
+                    uint8_t add_space = (uint8_t)node->config.byte_level.add_prefix_space;
+                    status = buf_put(out, &add_space, 1);
+                }
+                else if (node->type == PRE_TOKENIZER_REGEX_SPLIT)
+                {
+                    uint32_t pat_len = (uint32_t)strlen(node->config.split.regex_pattern);
+                    status = buf_put_u32(out, pat_len);
+                    if (status == BBPE_OK)
+                        status = buf_put(out, node->config.split.regex_pattern, pat_len);
+                }
+                else
+                    status = BBPE_ERR_UNSUPPORTED_TYPE;
             }
-            if (write_u32_le(f, (uint32_t)item->priority) != BBPE_OK)
+            break;
+        case IMG_REGEX_CODES:
+            status = put_regex_codes(tok, out);
+            break;
+        case IMG_DECODE_START:
+            status = buf_put_u32_array(out, tok->decoded_start, (size_t)tok->vocab_size + 1);
+            break;
+        case IMG_DECODE_POOL:
+            status = buf_put(out, tok->decoded_pool, tok->decoded_start[tok->vocab_size]);
+            break;
+        case IMG_ID_ENTRIES:
+            status = buf_put_u32_array(out, tok->id_to_entry, tok->vocab_size);
+            break;
+        case IMG_STABLE_TOKENS:
+            if (tok->stable_tokens)
+                status = buf_put_u32_array(out, tok->stable_tokens, ((size_t)tok->vocab_size + 31) / 32);
+            break;
+        case IMG_NORMALIZERS:
+            for (NormalizerNode *node = tok->normalizers; node && status == BBPE_OK; node = node->next)
             {
-                status = BBPE_ERR_FILE_IO;
-                goto cleanup;
+                uint8_t type_byte = (uint8_t)node->type;
+                status = buf_put(out, &type_byte, 1);
+                if (status == BBPE_OK && node->type == NORMALIZER_REPLACE &&
+                    (status = buf_put_u32(out, (uint32_t)node->pattern_len)) == BBPE_OK)
+                    status = buf_put(out, node->pattern, node->pattern_len);
+                if (status == BBPE_OK && (node->type == NORMALIZER_REPLACE || node->type == NORMALIZER_PREPEND) &&
+                    (status = buf_put_u32(out, (uint32_t)node->content_len)) == BBPE_OK)
+                    status = buf_put(out, node->content, node->content_len);
             }
+            break;
+        case IMG_VOCAB_PHF:
+            status = put_vocab_phf(tok, out);
+            break;
         }
+        sections[sec].offset = (uint32_t)start;
+        sections[sec].size = (uint32_t)(out->size - start);
+    }
+    if (status == BBPE_OK && out->size > UINT32_MAX)
+        status = BBPE_ERR_INVALID_INPUT; // 段偏移以 32 位记录
+    if (status != BBPE_OK)
+    {
+        free(out->data);
+        memset(out, 0, sizeof(*out));
+        return status;
     }
 
-    // 7. 写入特殊 token 条目数
-    uint32_t special_count = HASH_COUNT(tok->special_tokens_map);
-    if (write_u32_le(f, special_count) != BBPE_OK)
+    // 回填镜像头与段表
+    uint32_t words[IMAGE_HEADER_WORDS + 2 * IMG_SECTION_COUNT] = {
+        IMAGE_VERSION, tok->vocab_size, vt->count, vt->slots ? vt->slot_mask : 0,
+        (uint32_t)tok->merge_count, special_count, pre_count, IMG_SECTION_COUNT};
+    for (int sec = 0; sec < IMG_SECTION_COUNT; sec++)
     {
-        status = BBPE_ERR_FILE_IO;
-        goto cleanup;
+        words[IMAGE_HEADER_WORDS + 2 * sec] = sections[sec].offset;
+        words[IMAGE_HEADER_WORDS + 2 * sec + 1] = sections[sec].size;
+    }
+    memcpy(out->data, "BBPE", 4);
+    for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++)
+    {
+        uint32_t le_val = host_to_le32(words[i]);
+        memcpy(out->data + 4 + i * 4, &le_val, 4);
+    }
+    return BBPE_OK;
+}
+
+/**
+ * @brief 镜像内的顺序读取器 (用于特殊 token 与预分词器段)
+ */
+typedef struct
+{
+    const uint8_t *p; /* 当前位置 */
+    size_t left;      /* 剩余字节数 */
+} ByteReader;
+
+static BBPEStatus reader_bytes(ByteReader *r, const uint8_t **out, size_t n)
+{
+    if (n > r->left)
+        return BBPE_ERR_INVALID_INPUT;
+    *out = r->p;
+    r->p += n;
+    r->left -= n;
+    return BBPE_OK;
+}
+
+static BBPEStatus reader_copy(ByteReader *r, void *dst, size_t n)
+{
+    const uint8_t *p;
+    BBPEStatus status = reader_bytes(r, &p, n);
+    if (status == BBPE_OK && n > 0)
+        memcpy(dst, p, n);
+    return status;
+}
+
+static BBPEStatus reader_u32(ByteReader *r, uint32_t *out)
+{
+    const uint8_t *p;
+    BBPEStatus status = reader_bytes(r, &p, 4);
+    if (status != BBPE_OK)
+        return status;
+    uint32_t val;
+    memcpy(&val, p, 4);
+    *out = le32_to_host(val);
+    return BBPE_OK;
+}
+
+/**
+ * @brief 大端主机上将镜像中所有 u32/u64 段原地转换为主机字节序
+ * @param version 镜像版本 (v2 的规则项按 u32 转换)
+ */
+static void image_swap_sections(uint8_t *data, const ImageSection *sections, uint32_t version)
+{
+    static const int u32_sections[] = {IMG_VOCAB_OFFSETS, IMG_VOCAB_LENGTHS, IMG_VOCAB_HASHES, IMG_VOCAB_IDS,
+                                       IMG_VOCAB_SLOTS, IMG_RULE_START, IMG_RULE_ITEMS, IMG_DECODE_START,
+                                       IMG_ID_ENTRIES, IMG_STABLE_TOKENS, IMG_VOCAB_PHF};
+    for (size_t i = 0; i < sizeof(u32_sections) / sizeof(u32_sections[0]); i++)
+    {
+        const ImageSection *sec = &sections[u32_sections[i]];
+        if (u32_sections[i] == IMG_RULE_ITEMS && version != IMAGE_VERSION_WIDE_RULES)
+        {
+            uint64_t *items = (uint64_t *)(data + sec->offset);
+            for (uint32_t j = 0; j < sec->size / 8; j++)
+                items[j] = le64_to_host(items[j]);
+            continue;
+        }
+        uint32_t *words = (uint32_t *)(data + sec->offset);
+        for (uint32_t j = 0; j < sec->size / 4; j++)
+            words[j] = le32_to_host(words[j]);
+    }
+}
+
+/**
+ * @brief 取出镜像中预编译正则段的序列化数据
+ * @param blob IMG_REGEX_CODES 段内容
+ * @param size 段字节数
+ * @return 序列化数据起点；段缺失、过短或校验和不符时返回 NULL (各 Split 节点改为按模式编译)
+ * @note pcre2_serialize_decode 不校验字节码本身，校验和只用于发现意外损坏
+ */
+static const uint8_t *image_regex_codes(const uint8_t *blob, size_t size)
+{
+    // 序列化数据头 (4 个 u32) 加字符表 (1088 字节) 之后才是第一个模式
+    if (size <= 8 + 16 + 1088)
+        return NULL;
+    uint32_t checksum;
+    memcpy(&checksum, blob, 4);
+    checksum = le32_to_host(checksum);
+    const uint8_t *bytes = blob + 8; // 段按 64 字节对齐，满足序列化数据头的 4 字节对齐要求
+    return checksum == vocab_hash((const char *)bytes, size - 8) ? bytes : NULL;
+}
+
+/**
+ * @brief 从 v3 (或 v2) 镜像构建分词器：词汇表与规则行直接引用镜像，不复制、不重建
+ * @param data 镜像起始地址 (至少 8 字节对齐)
+ * @param size 镜像字节数
+ * @param kind 镜像来源，成功时由分词器接管，失败时在此释放
+ * @param flags 加载标志 (BBPE_LOAD_LAZY_MERGES / BBPE_LOAD_DECODE_ONLY)
+ * @param a 分配器 (IMAGE_HEAP 的镜像也由它分配)
+ * @param out_tokenizer 输出分词器句柄
+ * @return BBPEStatus
+ * @note 所有偏移、长度与 ID 都会做边界检查，损坏的文件返回 BBPE_ERR_INVALID_INPUT；IMAGE_STATIC 的镜像
+ *       由生成器写出并随程序编译，只检查镜像头与段表，跳过逐项 (O(词汇表 + 规则数)) 的校验，也不触及这些页面。
+ *       只解码时不引用也不检查规则行，正则在推迟构建与只解码时都不在此解码。
+ *       v2 镜像的 12 字节规则项在此转换为 64 位规则项 (堆上)，其余各段仍直接引用镜像
+ */
+static BBPEStatus load_image(const uint8_t *data, size_t size, ImageKind kind, uint32_t flags,
+                             const BBPEAllocator *a, BBPETokenizer **out_tokenizer)
+{
+    BBPEStatus status = BBPE_ERR_INVALID_INPUT;
+    BBPETokenizer *tok = NULL;
+    ImageHeader hdr;
+    ImageSection sections[IMG_SECTION_COUNT];
+    memset(sections, 0, sizeof(sections));
+
+    // 1. 解析镜像头与段表
+    if (size < sizeof(ImageHeader) || memcmp(data, "BBPE", 4) != 0)
+        goto fail;
+    memcpy(&hdr, data, sizeof(hdr));
+    uint32_t *hdr_words = &hdr.version;
+    for (int i = 0; i < IMAGE_HEADER_WORDS; i++)
+        hdr_words[i] = le32_to_host(hdr_words[i]);
+    if (hdr.version != IMAGE_VERSION && hdr.version != IMAGE_VERSION_WIDE_RULES)
+    {
+        status = BBPE_ERR_UNSUPPORTED_TYPE;
+        goto fail;
+    }
+    int wide_rules = hdr.version == IMAGE_VERSION_WIDE_RULES;
+    uint64_t rule_item_bytes = wide_rules ? 3 * sizeof(int32_t) : sizeof(MergeRuleItem);
+    if (hdr.section_count > (size - sizeof(ImageHeader)) / sizeof(ImageSection))
+        goto fail;
+    for (uint32_t i = 0; i < hdr.section_count && i < IMG_SECTION_COUNT; i++)
+    {
+        memcpy(&sections[i], data + sizeof(ImageHeader) + i * sizeof(ImageSection), sizeof(ImageSection));
+        sections[i].offset = le32_to_host(sections[i].offset);
+        sections[i].size = le32_to_host(sections[i].size);
+        if (sections[i].offset > size || sections[i].size > size - sections[i].offset)
+            goto fail;
+        if (i != IMG_VOCAB_POOL && i != IMG_SPECIALS && i != IMG_PRE_TOKENIZERS && i != IMG_REGEX_CODES &&
+            i != IMG_DECODE_POOL && i != IMG_NORMALIZERS &&
+            (sections[i].offset % 4 != 0 || sections[i].size % 4 != 0))
+            goto fail;
+        if (i == IMG_RULE_ITEMS && !wide_rules && sections[i].offset % sizeof(MergeRuleItem) != 0)
+            goto fail;
+    }
+
+    // 2. 核对各段大小与计数一致
+    uint32_t vocab_size = hdr.vocab_size;
+    uint32_t count = hdr.vocab_count;
+    uint64_t slot_count = (uint64_t)hdr.slot_mask + 1;
+    if (vocab_size == 0 || vocab_size > INT32_MAX)
+        goto fail;
+    if (sections[IMG_VOCAB_OFFSETS].size != (uint64_t)count * 4 || sections[IMG_VOCAB_LENGTHS].size != (uint64_t)count * 4 ||
+        sections[IMG_VOCAB_HASHES].size != (uint64_t)count * 4 || sections[IMG_VOCAB_IDS].size != (uint64_t)count * 4)
+        goto fail;
+    if (sections[IMG_VOCAB_SLOTS].size == 0 ? count != 0
+                                            : ((slot_count & (slot_count - 1)) != 0 || slot_count <= count ||
+                                               sections[IMG_VOCAB_SLOTS].size != slot_count * 4))
+        goto fail;
+    if (sections[IMG_RULE_START].size != ((uint64_t)vocab_size + 1) * 4 || sections[IMG_RULE_ITEMS].size % rule_item_bytes != 0)
+        goto fail;
+    if (sections[IMG_DECODE_START].size != 0 && sections[IMG_DECODE_START].size != ((uint64_t)vocab_size + 1) * 4)
+        goto fail;
+    if (sections[IMG_ID_ENTRIES].size != 0 && sections[IMG_ID_ENTRIES].size != (uint64_t)vocab_size * 4)
+        goto fail;
+    if (sections[IMG_STABLE_TOKENS].size != 0 && sections[IMG_STABLE_TOKENS].size != ((uint64_t)vocab_size + 31) / 32 * 4)
+        goto fail;
+
+    // 3. 大端主机无法原地使用小端数据：转换到堆上的副本
+    if (!host_is_little_endian())
+    {
+        uint8_t *copy = (uint8_t *)mem_alloc(a, size);
+        if (!copy)
+        {
+            status = BBPE_ERR_MEMORY;
+            goto fail;
+        }
+        memcpy(copy, data, size);
+        image_swap_sections(copy, sections, hdr.version);
+        release_image(a, data, size, kind);
+        data = copy;
+        kind = IMAGE_HEAP;
+    }
+
+    tok = tokenizer_alloc(a);
+    if (!tok)
+    {
+        status = BBPE_ERR_MEMORY;
+        goto fail;
+    }
+    tok->image = data;
+    tok->image_size = size;
+    tok->image_kind = kind;
+    tok->vocab_size = vocab_size;
+    tok->merge_count = hdr.merge_count;
+    tok->load_flags = flags & LOAD_KEPT_FLAGS;
+    tok->encoder_deferred = (flags & LOAD_DEFER_FLAGS) != 0;
+
+    // 4. 词汇表直接指向镜像 (只读使用，字符串池不会增长)
+    VocabTable *vt = &tok->vocab;
+    vt->pool = (char *)(data + sections[IMG_VOCAB_POOL].offset);
+    vt->pool_size = vt->pool_capacity = sections[IMG_VOCAB_POOL].size;
+    vt->offsets = (uint32_t *)(data + sections[IMG_VOCAB_OFFSETS].offset);
+    vt->lengths = (uint32_t *)(data + sections[IMG_VOCAB_LENGTHS].offset);
+    vt->hashes = (uint32_t *)(data + sections[IMG_VOCAB_HASHES].offset);
+    vt->ids = (int32_t *)(data + sections[IMG_VOCAB_IDS].offset);
+    vt->count = vt->capacity = count;
+    vt->slots = count ? (uint32_t *)(data + sections[IMG_VOCAB_SLOTS].offset) : NULL;
+    vt->slot_mask = count ? hdr.slot_mask : 0;
+    status = BBPE_ERR_INVALID_INPUT;
+    int trusted = kind == IMAGE_STATIC;
+    for (uint32_t e = 0; !trusted && e < count; e++)
+    {
+        if (vt->offsets[e] >= vt->pool_size || vt->lengths[e] >= vt->pool_size - vt->offsets[e] ||
+            vt->pool[vt->offsets[e] + vt->lengths[e]] != '\0' || vt->ids[e] < 0 || (uint32_t)vt->ids[e] >= vocab_size)
+            goto fail;
+    }
+    uint32_t used_slots = 0;
+    for (uint64_t i = 0; !trusted && vt->slots && i < slot_count; i++)
+    {
+        if (vt->slots[i] > count)
+            goto fail;
+        used_slots += vt->slots[i] != 0;
+    }
+    if (used_slots > count) // 至少保留一个空槽，保证探测终止
+        goto fail;
+
+    // 完美哈希 (可选)：槽中的条目下标须有效；查找时仍比较字符串，位移值本身无需校验
+    const ImageSection *phf = &sections[IMG_VOCAB_PHF];
+    if (phf->size != 0 && count != 0)
+    {
+        const uint32_t *phf_words = (const uint32_t *)(data + phf->offset);
+        if (phf->size < PHF_HEADER_WORDS * 4)
+            goto fail;
+        uint32_t buckets = phf_words[0], phf_slots = phf_words[1];
+        if (buckets == 0 || phf_slots == 0 ||
+            phf->size != ((uint64_t)PHF_HEADER_WORDS + phf_slots + ((uint64_t)buckets + 1) / 2) * 4)
+            goto fail;
+        for (uint32_t i = 0; !trusted && i < phf_slots; i++)
+        {
+            uint32_t e = phf_words[PHF_HEADER_WORDS + i];
+            if (e != PHF_EMPTY && e >= count)
+                goto fail;
+        }
+        vt->phf_buckets = buckets;
+        vt->phf_slot_count = phf_slots;
+        vt->phf_seed = phf_words[2];
+        vt->phf_slots = phf_words + PHF_HEADER_WORDS;
+        vt->phf_pilots = vt->phf_slots + phf_slots;
     }
 
-    // 8. 写入每个特殊 token 条目
-    HASH_ITER(hh, tok->special_tokens_map, s_cur, s_tmp)
+    // 5. 规则行直接指向镜像 (只解码时不使用)；v2 的规则项逐条打包到堆上
+    if (!(flags & BBPE_LOAD_DECODE_ONLY))
     {
-        uint32_t len = (uint32_t)strlen(s_cur->token);
-        if (write_u32_le(f, len) != BBPE_OK)
+        tok->rule_start = (uint32_t *)(data + sections[IMG_RULE_START].offset);
+        uint32_t rule_total = tok->rule_start[vocab_size];
+        if (tok->rule_start[0] != 0 || (uint64_t)rule_total * rule_item_bytes != sections[IMG_RULE_ITEMS].size)
+            goto fail;
+        for (uint32_t left = 0; !trusted && left < vocab_size; left++)
         {
-            status = BBPE_ERR_FILE_IO;
-            goto cleanup;
+            if (tok->rule_start[left + 1] < tok->rule_start[left])
+                goto fail;
         }
-        if (fwrite(s_cur->token, 1, len, f) != len)
+        if (wide_rules)
         {
-            status = BBPE_ERR_FILE_IO;
-            goto cleanup;
+            const int32_t *triples = (const int32_t *)(data + sections[IMG_RULE_ITEMS].offset);
+            tok->rule_items = (MergeRuleItem *)mem_alloc(&tok->allocator, (size_t)rule_total * sizeof(MergeRuleItem));
+            if (!tok->rule_items)
+            {
+                status = BBPE_ERR_MEMORY;
+                goto fail;
+            }
+            for (uint32_t j = 0; j < rule_total; j++)
+            {
+                uint32_t right = (uint32_t)triples[3 * j], new_id = (uint32_t)triples[3 * j + 1];
+                uint32_t priority = (uint32_t)triples[3 * j + 2];
+                if (right >= RULE_ID_LIMIT || new_id >= RULE_ID_LIMIT || priority >= RULE_PRIORITY_LIMIT)
+                    goto fail;
+                tok->rule_items[j] = rule_item_pack(right, new_id, priority);
+            }
         }
-        if (write_u32_le(f, (uint32_t)s_cur->id) != BBPE_OK)
+        else
         {
-            status = BBPE_ERR_FILE_IO;
-            goto cleanup;
+            tok->rule_items = (MergeRuleItem *)(data + sections[IMG_RULE_ITEMS].offset);
+            tok->rule_items_in_image = 1;
+        }
+        for (uint32_t j = 0; !trusted && j < rule_total; j++)
+        {
+            MergeRuleItem item = tok->rule_items[j];
+            if ((uint32_t)rule_item_right(item) >= vocab_size || (uint32_t)rule_item_new_id(item) >= vocab_size)
+                goto fail;
         }
     }
 
-    // 9. 写入预分词器节点数
-    uint32_t pre_count = 0;
-    PreTokenizerNode *p_cur = tok->pre_tokenizers;
-    while (p_cur)
+    // 6. 字节映射、id_to_entry 与单字节 token 表：镜像中带有 id_to_entry 时直接引用 (第 7 步后校验)，
+    //    否则按词汇表 O(vocab) 回填
+    if (sections[IMG_ID_ENTRIES].size != 0)
     {
-        pre_count++;
-        p_cur = p_cur->next;
+        tok->id_to_entry = (uint32_t *)(data + sections[IMG_ID_ENTRIES].offset);
+        tok->id_table_in_image = 1;
     }
-    if (write_u32_le(f, pre_count) != BBPE_OK)
+    else if ((status = id_table_alloc(tok, vocab_size)) != BBPE_OK)
+        goto fail;
+    init_byte_mappings(tok);
+    precompute_byte_strings(tok);
+    vocab_table_finish(tok);
+
+    // 7. 特殊 token (数量很少，复制到特殊 token 表并重建前缀树)
+    ByteReader reader = {data + sections[IMG_SPECIALS].offset, sections[IMG_SPECIALS].size};
+    for (uint32_t i = 0; i < hdr.special_count; i++)
     {
-        status = BBPE_ERR_FILE_IO;
-        goto cleanup;
+        uint32_t id, len;
+        const uint8_t *bytes;
+        uint32_t expect = tok->id_table_in_image ? (ID_ENTRY_SPECIAL | i) : ID_ENTRY_NONE;
+        if (reader_u32(&reader, &id) != BBPE_OK || reader_u32(&reader, &len) != BBPE_OK ||
+            reader_bytes(&reader, &bytes, len) != BBPE_OK || id >= vocab_size || tok->id_to_entry[id] != expect)
+        {
+            status = BBPE_ERR_INVALID_INPUT;
+            goto fail;
+        }
+        status = tok->id_table_in_image ? vocab_table_add(&tok->specials, (const char *)bytes, len, (int32_t)id)
+                                        : special_table_add(tok, (const char *)bytes, len, (int32_t)id);
+        if (status != BBPE_OK)
+            goto fail;
     }
+    status = BBPE_ERR_INVALID_INPUT;
+    for (uint32_t id = 0; !trusted && tok->id_table_in_image && id < vocab_size; id++)
+    {
+        // 镜像中的条目须指回同一 ID，保证 token_string 不越界
+        uint32_t e = tok->id_to_entry[id];
+        if (e == ID_ENTRY_NONE)
+            continue;
+        const VocabTable *table = (e & ID_ENTRY_SPECIAL) ? &tok->specials : vt;
+        e &= ~ID_ENTRY_SPECIAL;
+        if (e >= table->count || table->ids[e] != (int32_t)id)
+            goto fail;
+    }
+    vocab_table_shrink(&tok->specials);
+    status = build_special_trie(tok);
+    if (status != BBPE_OK)
+        goto fail;
 
-    // 10. 写入每个预分词器节点
-    p_cur = tok->pre_tokenizers;
-    while (p_cur)
+    // 8. 预分词器 (逐个挂到分词器上，失败时由 bbpe_destroy 统一释放)
+    reader.p = data + sections[IMG_PRE_TOKENIZERS].offset;
+    reader.left = sections[IMG_PRE_TOKENIZERS].size;
+    PreTokenizerNode **tail = &tok->pre_tokenizers;
+    for (uint32_t i = 0; i < hdr.pre_count; i++)
     {
-        uint8_t type_byte = (uint8_t)p_cur->type;
-        if (fwrite(&type_byte, 1, 1, f) != 1)
+        const uint8_t *type_byte;
+        status = reader_bytes(&reader, &type_byte, 1);
+        if (status != BBPE_OK)
+            goto fail;
+        PreTokenizerNode *node = (PreTokenizerNode *)mem_calloc(&tok->allocator, 1, sizeof(PreTokenizerNode));
+        if (!node)
         {
-            status = BBPE_ERR_FILE_IO;
-            goto cleanup;
+            status = BBPE_ERR_MEMORY;
+            goto fail;
         }
+        node->type = (PreTokenizerType)*type_byte;
+        *tail = node;
+        tail = &node->next;
 
-        switch (p_cur->type)
+        if (node->type == PRE_TOKENIZER_BYTE_LEVEL)
         {
-        case PRE_TOKENIZER_BYTE_LEVEL:
+            const uint8_t *add_space;
+            status = reader_bytes(&reader, &add_space, 1);
+            if (status != BBPE_OK)
+                goto fail;
+            node->config.byte_level.add_prefix_space = *add_space ? 1 : 0;
+        }
+        else if (node->type == PRE_TOKENIZER_REGEX_SPLIT)
         {
-            uint8_t add_space = (uint8_t)p_cur->config.byte_level.add_prefix_space;
-            if (fwrite(&add_space, 1, 1, f) != 1)
+            uint32_t pat_len;
+            const uint8_t *pat;
+            if ((status = reader_u32(&reader, &pat_len)) != BBPE_OK ||
+                (status = reader_bytes(&reader, &pat, pat_len)) != BBPE_OK)
+                goto fail;
+            node->config.split.regex_pattern = (char *)mem_alloc(&tok->allocator, (size_t)pat_len + 1);
+            if (!node->config.split.regex_pattern)
             {
-                status = BBPE_ERR_FILE_IO;
-                goto cleanup;
+                status = BBPE_ERR_MEMORY;
+                goto fail;
             }
-            break;
+            memcpy(node->config.split.regex_pattern, pat, pat_len);
+            node->config.split.regex_pattern[pat_len] = '\0';
         }
-        case PRE_TOKENIZER_REGEX_SPLIT:
+        else
         {
-            uint32_t pat_len = (uint32_t)strlen(p_cur->config.split.regex_pattern);
-            if (write_u32_le(f, pat_len) != BBPE_OK)
-            {
-                status = BBPE_ERR_FILE_IO;
-                goto cleanup;
-            }
-            if (fwrite(p_cur->config.split.regex_pattern, 1, pat_len, f) != pat_len)
-            {
-                status = BBPE_ERR_FILE_IO;
-                goto cleanup;
-            }
-            break;
+            status = BBPE_ERR_UNSUPPORTED_TYPE;
+            goto fail;
         }
-        default:
+    }
+    const uint8_t *regex_codes = image_regex_codes(data + sections[IMG_REGEX_CODES].offset, sections[IMG_REGEX_CODES].size);
+    if (tok->encoder_deferred)
+        tok->lazy_regex_codes = regex_codes;
+    else if ((status = install_split_regexes(tok, regex_codes)) != BBPE_OK)
+        goto fail;
+
+    // 9. 解码表直接指向镜像；旧文件中没有该段时重新构建
+    if (sections[IMG_DECODE_START].size != 0)
+    {
+        tok->decoded_start = (uint32_t *)(data + sections[IMG_DECODE_START].offset);
+        tok->decoded_pool = (uint8_t *)(data + sections[IMG_DECODE_POOL].offset);
+        tok->decoded_in_image = 1;
+        status = BBPE_ERR_INVALID_INPUT;
+        if (tok->decoded_start[0] != 0 || tok->decoded_start[vocab_size] != sections[IMG_DECODE_POOL].size)
+            goto fail;
+        for (uint32_t id = 0; !trusted && id < vocab_size; id++)
+        {
+            if (tok->decoded_start[id + 1] < tok->decoded_start[id])
+                goto fail;
+        }
+        // 旧版本把字节 0x00 的 token 解码成了 UTF-8 字符，发现时丢弃镜像中的表重新构建
+        int32_t nul_id = tok->byte_to_id[0];
+        if (nul_id >= 0 && (uint32_t)nul_id < vocab_size &&
+            (tok->decoded_start[nul_id + 1] - tok->decoded_start[nul_id] != 1 ||
+             tok->decoded_pool[tok->decoded_start[nul_id]] != 0))
+        {
+            tok->decoded_start = NULL;
+            tok->decoded_pool = NULL;
+            tok->decoded_in_image = 0;
+        }
+    }
+    if (!tok->decoded_in_image && (status = build_decode_table(tok)) != BBPE_OK)
+        goto fail;
+
+    // 10. 保存时启用了整词直查：位图直接指向镜像
+    if (sections[IMG_STABLE_TOKENS].size != 0)
+    {
+        tok->stable_tokens = (uint32_t *)(data + sections[IMG_STABLE_TOKENS].offset);
+        tok->stable_in_image = 1;
+    }
+
+    // 11. 规范化器 (逐个挂到分词器上，失败时由 bbpe_destroy 统一释放)
+    reader.p = data + sections[IMG_NORMALIZERS].offset;
+    reader.left = sections[IMG_NORMALIZERS].size;
+    NormalizerNode **norm_tail = &tok->normalizers;
+    while (reader.left > 0)
+    {
+        const uint8_t *type_byte;
+        uint32_t pattern_len = 0, content_len = 0;
+        const uint8_t *pattern = NULL, *content = NULL;
+        if ((status = reader_bytes(&reader, &type_byte, 1)) != BBPE_OK)
+            goto fail;
+        NormalizerType type = (NormalizerType)*type_byte;
+        if (type > NORMALIZER_PREPEND)
+        {
             status = BBPE_ERR_UNSUPPORTED_TYPE;
-            goto cleanup;
+            goto fail;
+        }
+        if (type == NORMALIZER_REPLACE && ((status = reader_u32(&reader, &pattern_len)) != BBPE_OK ||
+                                           (status = reader_bytes(&reader, &pattern, pattern_len)) != BBPE_OK))
+            goto fail;
+        if ((type == NORMALIZER_REPLACE || type == NORMALIZER_PREPEND) &&
+            ((status = reader_u32(&reader, &content_len)) != BBPE_OK ||
+             (status = reader_bytes(&reader, &content, content_len)) != BBPE_OK))
+            goto fail;
+        NormalizerNode *node = normalizer_node_new(tok, type, (const char *)pattern, pattern_len,
+                                                   (const char *)content, content_len);
+        if (!node)
+        {
+            status = BBPE_ERR_MEMORY;
+            goto fail;
         }
-        p_cur = p_cur->next;
+        *norm_tail = node;
+        norm_tail = &node->next;
     }
 
-cleanup:
-    fclose(f);
+    *out_tokenizer = tok;
+    return BBPE_OK;
+
+fail:
+    if (tok)
+        bbpe_destroy(tok); // 同时释放镜像
+    else
+        release_image(a, data, size, kind);
+    return status;
+}
+
+// ============================================================================
+// 序列化实现：bbpe_save
+// ============================================================================
+
+BBPEStatus bbpe_save(BBPETokenizer *tok, const char *filename)
+{
+    if (!tok || !filename)
+        return BBPE_ERR_INVALID_INPUT;
+
+    ByteBuf image;
+    BBPEStatus status = build_image(tok, &image);
+    if (status != BBPE_OK)
+        return status;
+
+    FILE *f = fopen(filename, "wb");
+    if (!f)
+    {
+        free(image.data);
+        return BBPE_ERR_FILE_IO;
+    }
+    if (fwrite(image.data, 1, image.size, f) != image.size)
+        status = BBPE_ERR_FILE_IO;
+    if (fclose(f) != 0)
+        status = BBPE_ERR_FILE_IO;
+    free(image.data);
     return status;
 }
 
+BBPEStatus bbpe_save_to_memory(BBPETokenizer *tok, void **out_buffer, size_t *out_size)
+{
+    if (!tok || !out_buffer || !out_size)
+        return BBPE_ERR_INVALID_INPUT;
+
+    ByteBuf image;
+    BBPEStatus status = build_image(tok, &image);
+    if (status != BBPE_OK)
+        return status;
+    *out_buffer = image.data;
+    *out_size = image.size;
+    return BBPE_OK;
+}
+
 // ============================================================================
 // 反序列化实现：bbpe_load
 // ============================================================================
 
 typedef struct
 {
-    char *token; // 已分配的字符串，将由 vocab 哈希表接管
+    char *token; // 已分配的字符串，复制进词汇表后释放
     int32_t id;
 } TempVocabEntry;
 
@@ -2184,62 +10736,63 @@ typedef struct
     int32_t id;
 } TempSpecialEntry;
 
-BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
+/**
+ * @brief 从内存中的 v1 格式数据构建分词器 (所有内容复制到新分配的结构中)
+ * @param data 文件内容
+ * @param size 字节数
+ * @param flags 加载标志 (BBPE_LOAD_LAZY_MERGES / BBPE_LOAD_DECODE_ONLY)
+ * @param a 分配器 (分词器与解析用的临时数组均经其分配)
+ * @param out_tokenizer 输出分词器句柄
+ * @return BBPEStatus
+ */
+static BBPEStatus load_v1(const uint8_t *data, size_t size, uint32_t flags, const BBPEAllocator *a,
+                          BBPETokenizer **out_tokenizer)
 {
-    if (!filename || !out_tokenizer)
-        return BBPE_ERR_INVALID_INPUT;
-
-    FILE *f = fopen(filename, "rb");
-    if (!f)
-        return BBPE_ERR_FILE_IO;
-
     BBPEStatus status = BBPE_OK;
     BBPETokenizer *tok = NULL;
     TempVocabEntry *temp_vocab = NULL;
     size_t temp_vocab_cap = 0, temp_vocab_cnt = 0;
     TempSpecialEntry *temp_special = NULL;
     size_t temp_special_cap = 0, temp_special_cnt = 0;
+    MergeRecord *temp_merges = NULL;
 
-    // 读取魔数
-    char magic[4];
-    if (fread(magic, 1, 4, f) != 4 || memcmp(magic, "BBPE", 4) != 0)
-    {
-        status = BBPE_ERR_INVALID_INPUT;
-        goto cleanup;
-    }
-
-    // 读取版本
-    uint32_t version;
-    if (read_u32_le(f, &version) != BBPE_OK)
+    // 跳过魔数与版本号 (已由调用者检查)
+    ByteReader reader = {data, size};
+    const uint8_t *skipped;
+    if (reader_bytes(&reader, &skipped, 8) != BBPE_OK)
     {
         status = BBPE_ERR_FILE_IO;
         goto cleanup;
     }
-    if (version != 1)
-    {
-        status = BBPE_ERR_UNSUPPORTED_TYPE;
-        goto cleanup;
-    }
 
     // 分配主结构
-    tok = (BBPETokenizer *)calloc(1, sizeof(BBPETokenizer));
+    tok = tokenizer_alloc(a);
     if (!tok)
     {
         status = BBPE_ERR_MEMORY;
         goto cleanup;
     }
+    tok->load_flags = flags & LOAD_KEPT_FLAGS;
+    tok->encoder_deferred = (flags & LOAD_DEFER_FLAGS) != 0;
 
     // 读取词汇表条目数
     uint32_t vocab_count;
-    if (read_u32_le(f, &vocab_count) != BBPE_OK)
+    if (reader_u32(&reader, &vocab_count) != BBPE_OK)
     {
         status = BBPE_ERR_FILE_IO;
         goto cleanup;
     }
 
+    // 每个条目至少占 8 字节，据此拒绝明显损坏的计数，避免巨额分配
+    if (vocab_count > reader.left / 8)
+    {
+        status = BBPE_ERR_INVALID_INPUT;
+        goto cleanup;
+    }
+
     // 临时存储词汇表
     temp_vocab_cap = vocab_count > 0 ? vocab_count : 1;
-    temp_vocab = (TempVocabEntry *)malloc(temp_vocab_cap * sizeof(TempVocabEntry));
+    temp_vocab = (TempVocabEntry *)mem_alloc(a, temp_vocab_cap * sizeof(TempVocabEntry));
     if (!temp_vocab)
     {
         status = BBPE_ERR_MEMORY;
@@ -2251,41 +10804,48 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
     for (uint32_t i = 0; i < vocab_count; i++)
     {
         uint32_t len;
-        if (read_u32_le(f, &len) != BBPE_OK)
+        if (reader_u32(&reader, &len) != BBPE_OK || len > reader.left)
         {
             status = BBPE_ERR_FILE_IO;
             goto cleanup;
         }
-        char *token_str = (char *)malloc(len + 1);
+        char *token_str = (char *)mem_alloc(a, len + 1);
         if (!token_str)
         {
             status = BBPE_ERR_MEMORY;
             goto cleanup;
         }
-        if (fread(token_str, 1, len, f) != len)
+        if (reader_copy(&reader, token_str, len) != BBPE_OK)
         {
-            free(token_str);
+            mem_free(a, token_str);
             status = BBPE_ERR_FILE_IO;
             goto cleanup;
         }
         token_str[len] = '\0';
 
         uint32_t id;
-        if (read_u32_le(f, &id) != BBPE_OK)
+        if (reader_u32(&reader, &id) != BBPE_OK)
         {
-            free(token_str);
+            mem_free(a, token_str);
             status = BBPE_ERR_FILE_IO;
             goto cleanup;
         }
+        if ((int32_t)id < 0)
+        {
+            mem_free(a, token_str);
+            status = BBPE_ERR_INVALID_INPUT;
+            goto cleanup;
+        }
 
         // 扩展临时数组
         if (temp_vocab_cnt >= temp_vocab_cap)
         {
             temp_vocab_cap *= 2;
-            TempVocabEntry *new_arr = (TempVocabEntry *)realloc(temp_vocab, temp_vocab_cap * sizeof(TempVocabEntry));
+            TempVocabEntry *new_arr =
+                (TempVocabEntry *)mem_realloc(a, temp_vocab, temp_vocab_cap * sizeof(TempVocabEntry));
             if (!new_arr)
             {
-                free(token_str);
+                mem_free(a, token_str);
                 status = BBPE_ERR_MEMORY;
                 goto cleanup;
             }
@@ -2301,24 +10861,21 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
 
     // 读取合并规则总数
     uint32_t merge_total;
-    if (read_u32_le(f, &merge_total) != BBPE_OK)
+    if (reader_u32(&reader, &merge_total) != BBPE_OK)
     {
         status = BBPE_ERR_FILE_IO;
         goto cleanup;
     }
+    if (merge_total > reader.left / 16)
+    {
+        status = BBPE_ERR_INVALID_INPUT;
+        goto cleanup;
+    }
 
     // 临时存储合并规则
-    typedef struct
-    {
-        int32_t left_id;
-        int32_t right_id;
-        int32_t new_id;
-        int32_t priority;
-    } MergeRecord;
-    MergeRecord *temp_merges = NULL;
     if (merge_total > 0)
     {
-        temp_merges = (MergeRecord *)malloc(merge_total * sizeof(MergeRecord));
+        temp_merges = (MergeRecord *)mem_alloc(a, merge_total * sizeof(MergeRecord));
         if (!temp_merges)
         {
             status = BBPE_ERR_MEMORY;
@@ -2327,10 +10884,10 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
         for (uint32_t i = 0; i < merge_total; i++)
         {
             uint32_t left, right, new_id, priority;
-            if (read_u32_le(f, &left) != BBPE_OK ||
-                read_u32_le(f, &right) != BBPE_OK ||
-                read_u32_le(f, &new_id) != BBPE_OK ||
-                read_u32_le(f, &priority) != BBPE_OK)
+            if (reader_u32(&reader, &left) != BBPE_OK ||
+                reader_u32(&reader, &right) != BBPE_OK ||
+                reader_u32(&reader, &new_id) != BBPE_OK ||
+                reader_u32(&reader, &priority) != BBPE_OK)
             {
                 status = BBPE_ERR_FILE_IO;
                 goto cleanup;
@@ -2350,14 +10907,19 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
 
     // 读取特殊 token 条目数
     uint32_t special_count;
-    if (read_u32_le(f, &special_count) != BBPE_OK)
+    if (reader_u32(&reader, &special_count) != BBPE_OK)
     {
         status = BBPE_ERR_FILE_IO;
         goto cleanup;
     }
 
+    if (special_count > reader.left / 8)
+    {
+        status = BBPE_ERR_INVALID_INPUT;
+        goto cleanup;
+    }
     temp_special_cap = special_count > 0 ? special_count : 1;
-    temp_special = (TempSpecialEntry *)malloc(temp_special_cap * sizeof(TempSpecialEntry));
+    temp_special = (TempSpecialEntry *)mem_alloc(a, temp_special_cap * sizeof(TempSpecialEntry));
     if (!temp_special)
     {
         status = BBPE_ERR_MEMORY;
@@ -2368,40 +10930,47 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
     for (uint32_t i = 0; i < special_count; i++)
     {
         uint32_t len;
-        if (read_u32_le(f, &len) != BBPE_OK)
+        if (reader_u32(&reader, &len) != BBPE_OK || len > reader.left)
         {
             status = BBPE_ERR_FILE_IO;
             goto cleanup;
         }
-        char *token_str = (char *)malloc(len + 1);
+        char *token_str = (char *)mem_alloc(a, len + 1);
         if (!token_str)
         {
             status = BBPE_ERR_MEMORY;
             goto cleanup;
         }
-        if (fread(token_str, 1, len, f) != len)
+        if (reader_copy(&reader, token_str, len) != BBPE_OK)
         {
-            free(token_str);
+            mem_free(a, token_str);
             status = BBPE_ERR_FILE_IO;
             goto cleanup;
         }
         token_str[len] = '\0';
 
         uint32_t id;
-        if (read_u32_le(f, &id) != BBPE_OK)
+        if (reader_u32(&reader, &id) != BBPE_OK)
         {
-            free(token_str);
+            mem_free(a, token_str);
             status = BBPE_ERR_FILE_IO;
             goto cleanup;
         }
+        if ((int32_t)id < 0)
+        {
+            mem_free(a, token_str);
+            status = BBPE_ERR_INVALID_INPUT;
+            goto cleanup;
+        }
 
         if (temp_special_cnt >= temp_special_cap)
         {
             temp_special_cap *= 2;
-            TempSpecialEntry *new_arr = (TempSpecialEntry *)realloc(temp_special, temp_special_cap * sizeof(TempSpecialEntry));
+            TempSpecialEntry *new_arr =
+                (TempSpecialEntry *)mem_realloc(a, temp_special, temp_special_cap * sizeof(TempSpecialEntry));
             if (!new_arr)
             {
-                free(token_str);
+                mem_free(a, token_str);
                 status = BBPE_ERR_MEMORY;
                 goto cleanup;
             }
@@ -2418,138 +10987,69 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
     // 现在 max_id 是最终最大 id，计算 vocab_size
     tok->vocab_size = max_id + 1;
 
-    // 分配 id_to_token 数组
-    tok->id_to_token = (char **)calloc(tok->vocab_size, sizeof(char *));
-    if (!tok->id_to_token)
-    {
-        status = BBPE_ERR_MEMORY;
+    // 分配 id_to_entry 数组
+    status = id_table_alloc(tok, tok->vocab_size);
+    if (status != BBPE_OK)
         goto cleanup;
-    }
 
-    // 构建词汇表哈希表并填充 id_to_token
+    // 构建词汇表 (字符串复制进池中，临时字符串在 cleanup 时释放) 并填充 id_to_entry
+    size_t pool_bytes = 0;
+    for (size_t i = 0; i < temp_vocab_cnt; i++)
+        pool_bytes += strlen(temp_vocab[i].token) + 1;
+    status = vocab_table_reserve(&tok->vocab, (uint32_t)temp_vocab_cnt, pool_bytes);
+    if (status != BBPE_OK)
+        goto cleanup;
     for (size_t i = 0; i < temp_vocab_cnt; i++)
     {
-        VocabEntry *entry = (VocabEntry *)malloc(sizeof(VocabEntry));
-        if (!entry)
-        {
-            status = BBPE_ERR_MEMORY;
+        status = vocab_table_add(&tok->vocab, temp_vocab[i].token, strlen(temp_vocab[i].token), temp_vocab[i].id);
+        if (status != BBPE_OK)
             goto cleanup;
-        }
-        entry->token = temp_vocab[i].token; // 接管字符串
-        entry->id = temp_vocab[i].id;
-        HASH_ADD_KEYPTR(hh, tok->vocab_map, entry->token, strlen(entry->token), entry);
-        if (entry->id >= 0 && entry->id < tok->vocab_size)
-        {
-            tok->id_to_token[entry->id] = entry->token;
-        }
-        // 将 temp_vocab 中的指针置空，避免后续重复释放
-        temp_vocab[i].token = NULL;
     }
 
-    // 构建特殊 token 哈希表并填充 id_to_token
+    // 初始化字节映射和预计算字符串，随后填充 id_to_entry 与单字节 token 表
+    init_byte_mappings(tok);
+    precompute_byte_strings(tok);
+    vocab_table_finish(tok);
+
+    // 构建特殊 token 表并填充 id_to_entry (字符串复制进池中，临时字符串在 cleanup 时释放)
     for (size_t i = 0; i < temp_special_cnt; i++)
     {
         // 检查 id 是否已被 vocab 占用 (可选，这里简单处理，如果冲突返回错误)
-        if (tok->id_to_token[temp_special[i].id] != NULL)
+        if (tok->id_to_entry[temp_special[i].id] != ID_ENTRY_NONE)
         {
             status = BBPE_ERR_INVALID_INPUT;
             goto cleanup;
         }
-        SpecialEntry *entry = (SpecialEntry *)malloc(sizeof(SpecialEntry));
-        if (!entry)
-        {
-            status = BBPE_ERR_MEMORY;
+        status = special_table_add(tok, temp_special[i].token, strlen(temp_special[i].token), temp_special[i].id);
+        if (status != BBPE_OK)
             goto cleanup;
-        }
-        entry->token = temp_special[i].token; // 接管字符串
-        entry->id = temp_special[i].id;
-        HASH_ADD_KEYPTR(hh, tok->special_tokens_map, entry->token, strlen(entry->token), entry);
-        tok->id_to_token[entry->id] = entry->token;
-        temp_special[i].token = NULL;
     }
+    vocab_table_shrink(&tok->specials);
+    status = build_special_trie(tok);
+    if (status == BBPE_OK)
+        status = build_decode_table(tok);
+    if (status != BBPE_OK)
+        goto cleanup;
 
-    // 构建 rule_rows
-    if (merge_total > 0)
+    // 构建规则行；推迟构建时由分词器接管规则记录，只解码时直接丢弃
+    if (!tok->encoder_deferred)
     {
-        uint32_t *counts = (uint32_t *)calloc(tok->vocab_size, sizeof(uint32_t));
-        if (!counts)
-        {
-            status = BBPE_ERR_MEMORY;
-            goto cleanup;
-        }
-
-        // 统计每个 left 的规则数量
-        for (uint32_t i = 0; i < merge_total; i++)
-        {
-            int left = temp_merges[i].left_id;
-            if (left >= 0 && left < tok->vocab_size)
-            {
-                counts[left]++;
-            }
-        }
-
-        tok->rule_rows = (MergeRuleRow *)calloc(tok->vocab_size, sizeof(MergeRuleRow));
-        if (!tok->rule_rows)
-        {
-            free(counts);
-            status = BBPE_ERR_MEMORY;
+        status = build_rule_rows(tok, temp_merges, merge_total);
+        if (status != BBPE_OK)
             goto cleanup;
-        }
-
-        for (int left = 0; left < tok->vocab_size; left++)
-        {
-            if (counts[left] > 0)
-            {
-                tok->rule_rows[left].items = (MergeRuleItem *)malloc(counts[left] * sizeof(MergeRuleItem));
-                if (!tok->rule_rows[left].items)
-                {
-                    free(counts);
-                    status = BBPE_ERR_MEMORY;
-                    goto cleanup;
-                }
-                tok->rule_rows[left].count = counts[left];
-            }
-        }
-
-        // 重置 counts 用于填充
-        memset(counts, 0, tok->vocab_size * sizeof(uint32_t));
-        for (uint32_t i = 0; i < merge_total; i++)
-        {
-            int left = temp_merges[i].left_id;
-            uint32_t pos = counts[left]++;
-            MergeRuleItem *item = &tok->rule_rows[left].items[pos];
-            item->right_id = temp_merges[i].right_id;
-            item->new_id = temp_merges[i].new_id;
-            item->priority = temp_merges[i].priority;
-        }
-
-        // 对每个 left 的规则按 right_id 排序
-        for (int left = 0; left < tok->vocab_size; left++)
-        {
-            if (tok->rule_rows[left].count > 0)
-            {
-                qsort(tok->rule_rows[left].items, tok->rule_rows[left].count,
-                      sizeof(MergeRuleItem), compare_merge_rule_items);
-            }
-        }
-
-        free(counts);
     }
-    else
+    else if (!(flags & BBPE_LOAD_DECODE_ONLY))
     {
-        tok->rule_rows = (MergeRuleRow *)calloc(tok->vocab_size, sizeof(MergeRuleRow));
-        if (!tok->rule_rows)
-        {
-            status = BBPE_ERR_MEMORY;
-            goto cleanup;
-        }
+        tok->lazy_records = temp_merges;
+        tok->lazy_record_count = merge_total;
+        temp_merges = NULL;
     }
 
     tok->merge_count = merge_total;
 
     // 读取预分词器节点
     uint32_t pre_count;
-    if (read_u32_le(f, &pre_count) != BBPE_OK)
+    if (reader_u32(&reader, &pre_count) != BBPE_OK)
     {
         status = BBPE_ERR_FILE_IO;
         goto cleanup;
@@ -2559,13 +11059,13 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
     for (uint32_t i = 0; i < pre_count; i++)
     {
         uint8_t type_byte;
-        if (fread(&type_byte, 1, 1, f) != 1)
+        if (reader_copy(&reader, &type_byte, 1) != BBPE_OK)
         {
             status = BBPE_ERR_FILE_IO;
             goto cleanup;
         }
 
-        PreTokenizerNode *node = (PreTokenizerNode *)calloc(1, sizeof(PreTokenizerNode));
+        PreTokenizerNode *node = (PreTokenizerNode *)mem_calloc(a, 1, sizeof(PreTokenizerNode));
         if (!node)
         {
             status = BBPE_ERR_MEMORY;
@@ -2578,9 +11078,9 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
         case PRE_TOKENIZER_BYTE_LEVEL:
         {
             uint8_t add_space;
-            if (fread(&add_space, 1, 1, f) != 1)
+            if (reader_copy(&reader, &add_space, 1) != BBPE_OK)
             {
-                free(node);
+                mem_free(a, node);
                 status = BBPE_ERR_FILE_IO;
                 goto cleanup;
             }
@@ -2590,45 +11090,40 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
         case PRE_TOKENIZER_REGEX_SPLIT:
         {
             uint32_t pat_len;
-            if (read_u32_le(f, &pat_len) != BBPE_OK)
+            if (reader_u32(&reader, &pat_len) != BBPE_OK || pat_len > reader.left)
             {
-                free(node);
+                mem_free(a, node);
                 status = BBPE_ERR_FILE_IO;
                 goto cleanup;
             }
-            char *pattern = (char *)malloc(pat_len + 1);
+            char *pattern = (char *)mem_alloc(a, pat_len + 1);
             if (!pattern)
             {
-                free(node);
+                mem_free(a, node);
                 status = BBPE_ERR_MEMORY;
                 goto cleanup;
             }
-            if (fread(pattern, 1, pat_len, f) != pat_len)
+            if (reader_copy(&reader, pattern, pat_len) != BBPE_OK)
             {
-                free(pattern);
-                free(node);
+                mem_free(a, pattern);
+                mem_free(a, node);
                 status = BBPE_ERR_FILE_IO;
                 goto cleanup;
             }
             pattern[pat_len] = '\0';
             node->config.split.regex_pattern = pattern;
 
-            int err;
-            PCRE2_SIZE err_off;
-            node->config.split.regex_compiled = pcre2_compile(
-                (PCRE2_SPTR)pattern, PCRE2_ZERO_TERMINATED,
-                PCRE2_UTF | PCRE2_UCP, &err, &err_off, NULL);
-            if (!node->config.split.regex_compiled)
+            if (!tok->encoder_deferred && compile_split_regex(tok, node) != BBPE_OK)
             {
-                free(pattern);
-                free(node);
+                mem_free(a, pattern);
+                mem_free(a, node);
                 status = BBPE_ERR_REGEX_COMPILE;
                 goto cleanup;
             }
             break;
         }
         default:
-            free(node);
+            mem_free(a, node);
             status = BBPE_ERR_UNSUPPORTED_TYPE;
             goto cleanup;
         }
@@ -2638,36 +11133,29 @@ BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
     }
     tok->pre_tokenizers = head;
 
-    // 初始化字节映射和预计算字符串
-    init_byte_mappings(tok);
-    precompute_byte_strings(tok);
-
     *out_tokenizer = tok;
     tok = NULL; // 防止被 cleanup 释放
     status = BBPE_OK;
 
 cleanup:
-    if (f)
-        fclose(f);
-
     // 释放临时词汇表条目中未被接管的字符串
     if (temp_vocab)
     {
         for (size_t i = 0; i < temp_vocab_cnt; i++)
         {
-            free(temp_vocab[i].token);
+            mem_free(a, temp_vocab[i].token);
         }
-        free(temp_vocab);
+        mem_free(a, temp_vocab);
     }
     if (temp_special)
     {
         for (size_t i = 0; i < temp_special_cnt; i++)
         {
-            free(temp_special[i].token);
+            mem_free(a, temp_special[i].token);
         }
-        free(temp_special);
+        mem_free(a, temp_special);
     }
-    free(temp_merges);
+    mem_free(a, temp_merges);
 
     if (status != BBPE_OK && tok)
     {
@@ -2675,3 +11163,101 @@ cleanup:
     }
     return status;
 }
+
+/**
+ * @brief 读取文件头中的版本号
+ * @return 版本号；数据过短或魔数不符时返回 0
+ */
+static uint32_t peek_version(const uint8_t *data, size_t size)
+{
+    uint32_t version;
+    if (size < 8 || memcmp(data, "BBPE", 4) != 0)
+        return 0;
+    memcpy(&version, data + 4, 4);
+    return le32_to_host(version);
+}
+
+/**
+ * @brief 按版本号从内存数据构建分词器
+ * @param data 文件内容
+ * @param size 字节数
+ * @param kind 数据来源：镜像 (v2/v3) 成功时由分词器接管；v1 数据或失败时在此释放
+ * @param flags 加载标志
+ * @param a 分配器 (IMAGE_HEAP 的数据也由它分配)
+ * @param out_tokenizer 输出分词器句柄
+ * @return BBPEStatus
+ */
+static BBPEStatus load_buffer(const uint8_t *data, size_t size, ImageKind kind, uint32_t flags,
+                              const BBPEAllocator *a, BBPETokenizer **out_tokenizer)
+{
+    uint32_t version = peek_version(data, size);
+    if (version == IMAGE_VERSION || version == IMAGE_VERSION_WIDE_RULES)
+        return load_image(data, size, kind, flags, a, out_tokenizer);
+
+    BBPEStatus status = version == 1   ? load_v1(data, size, flags, a, out_tokenizer)
+                        : version == 0 ? BBPE_ERR_INVALID_INPUT
+                                       : BBPE_ERR_UNSUPPORTED_TYPE;
+    release_image(a, data, size, kind);
+    return status;
+}
+
+BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer)
+{
+    return bbpe_load_ex(filename, 0, out_tokenizer);
+}
+
+BBPEStatus bbpe_load_ex(const char *filename, uint32_t flags, BBPETokenizer **out_tokenizer)
+{
+    return bbpe_load_alloc(filename, flags, NULL, out_tokenizer);
+}
+
+BBPEStatus bbpe_load_alloc(const char *filename, uint32_t flags, const BBPEAllocator *allocator,
+                           BBPETokenizer **out_tokenizer)
+{
+    if (!filename || !out_tokenizer || !allocator_valid(allocator))
+        return BBPE_ERR_INVALID_INPUT;
+
+    // 映射整个文件：镜像 (v2/v3) 直接使用，v1 从映射中解析后解除映射
+    const uint8_t *data;
+    size_t size;
+    ImageKind kind;
+    BBPEStatus status = map_file(filename, allocator, &data, &size, &kind);
+    if (status != BBPE_OK)
+        return status;
+    return load_buffer(data, size, kind, flags, allocator, out_tokenizer);
+}
+
+BBPEStatus bbpe_load_from_memory(const void *buffer, size_t size, uint32_t flags, BBPETokenizer **out_tokenizer)
+{
+    return bbpe_load_from_memory_alloc(buffer, size, flags, NULL, out_tokenizer);
+}
+
+BBPEStatus bbpe_load_from_memory_alloc(const void *buffer, size_t size, uint32_t flags,
+                                       const BBPEAllocator *allocator, BBPETokenizer **out_tokenizer)
+{
+    if (!buffer || !out_tokenizer || !allocator_valid(allocator))
+        return BBPE_ERR_INVALID_INPUT;
+
+    // v1 数据总是被复制进新结构，无需副本；镜像要求 8 字节对齐才能原地使用 (大端主机由 load_image 自行转换副本)
+    const uint8_t *data = (const uint8_t *)buffer;
+    int borrow = (flags & BBPE_LOAD_BORROW) && ((uintptr_t)data % sizeof(MergeRuleItem)) == 0;
+    uint32_t version = peek_version(data, size);
+    if (borrow || (version != IMAGE_VERSION && version != IMAGE_VERSION_WIDE_RULES))
+        return load_buffer(data, size, IMAGE_BORROWED, flags, allocator, out_tokenizer);
+
+    uint8_t *copy = (uint8_t *)mem_alloc(allocator, size);
+    if (!copy)
+        return BBPE_ERR_MEMORY;
+    memcpy(copy, data, size);
+    return load_buffer(copy, size, IMAGE_HEAP, flags, allocator, out_tokenizer);
+}
+
+BBPEStatus bbpe_from_static(const void *image, size_t size, uint32_t flags, BBPETokenizer **out_tokenizer)
+{
+    // 只接受可原地使用的当前版本镜像，保证不复制 (大端主机由 load_image 转换字节序时除外)
+    const uint8_t *data = (const uint8_t *)image;
+    if (!data || !out_tokenizer || ((uintptr_t)data % sizeof(MergeRuleItem)) != 0 ||
+        peek_version(data, size) != IMAGE_VERSION)
+        return BBPE_ERR_INVALID_INPUT;
+    return load_buffer(data, size, IMAGE_STATIC, flags, NULL, out_tokenizer);
+}
@@ -21,8 +21,11 @@ extern "C"
         BBPE_ERR_REGEX_COMPILE = -4,    /* 正则表达式编译失败 */
         BBPE_ERR_TOKEN_NOT_FOUND = -5,  /* Token 未找到 */
         BBPE_ERR_INVALID_INPUT = -6,    /* 输入参数无效 */
-        BBPE_ERR_UNSUPPORTED_TYPE = -7, /* 不支持的预分词器类型 */
+        BBPE_ERR_UNSUPPORTED_TYPE = -7, /* 不支持的预分词器或规范化器类型 */
         BBPE_ERR_FILE_IO = -8,          /* 文件读写错误 */
+        BBPE_ERR_BUFFER_TOO_SMALL = -9, /* 调用者提供的缓冲区容量不足 */
+        BBPE_ERR_DECODE_ONLY = -10,     /* 分词器以 BBPE_LOAD_DECODE_ONLY 加载，不支持编码与保存 */
+        BBPE_ERR_CANCELLED = -11,       /* 异步编码请求在完成前被取消 */
     } BBPEStatus;
 
     /**
@@ -30,23 +33,191 @@ extern "C"
      */
     typedef struct
     {
-        int32_t *ids; /* token ID 数组，由调用者通过 bbpe_free_output 释放 */
-        size_t count; /* ID 数量 */
+        int32_t *ids;    /* token ID 数组，由调用者通过 bbpe_free_output 释放 */
+        size_t count;    /* ID 数量 */
+        size_t capacity; /* ids 数组容量 (元素个数)，bbpe_encode_reuse 复用该容量 */
     } BBPEOutput;
 
+    /**
+     * @brief 各 token 在输入文本中的字节区间 (与 BBPEOutput.ids 一一对应的并行数组)
+     */
+    typedef struct
+    {
+        size_t *start;   /* 起始字节偏移，由调用者通过 bbpe_free_offsets 释放 */
+        size_t *end;     /* 结束字节偏移 (不含) */
+        size_t count;    /* 区间数量 (等于对应结果的 ID 数量) */
+        size_t capacity; /* 两个数组的容量 (元素个数)，bbpe_encode_with_offsets_ws 复用该容量 */
+    } BBPEOffsets;
+
+    /**
+     * @brief 词级缓存淘汰策略
+     */
+    typedef enum
+    {
+        BBPE_CACHE_LRU = 0,  /* 淘汰最久未使用的条目 */
+        BBPE_CACHE_FIFO = 1, /* 淘汰最早写入的条目 */
+    } BBPECachePolicy;
+
+    /**
+     * @brief 合并规则索引方式
+     */
+    typedef enum
+    {
+        BBPE_MERGE_INDEX_ROWS = 0, /* 按 left 分行、行内按 right 二分查找 (默认，内存最省) */
+        BBPE_MERGE_INDEX_HASH = 1, /* 以 (left, right) 为键的开放寻址哈希表 (查找更快，额外占用约 16 字节 × 规则数 × 4/3 ~ 8/3) */
+    } BBPEMergeIndex;
+
+    /**
+     * @brief bbpe_encode_truncated 的截断方向
+     */
+    typedef enum
+    {
+        BBPE_TRUNCATE_RIGHT = 0, /* 保留前 max_tokens 个 token，截去结尾 */
+        BBPE_TRUNCATE_LEFT = 1,  /* 保留后 max_tokens 个 token，截去开头 */
+    } BBPETruncation;
+
+    /**
+     * @brief 病态输入防护上限 (bbpe_set_limits)，各字段为 0 表示不限制 / 使用 PCRE2 默认值 (默认全部为 0)
+     */
+    typedef struct
+    {
+        size_t max_chunk_len; /* 预分词块的最大字节数 (含前缀空格)，更长的块在 UTF-8 字符边界处切成多段分别合并 */
+        uint32_t match_limit; /* PCRE2 单次匹配的回溯次数上限 (pcre2_set_match_limit，JIT 同样遵守) */
+        uint32_t depth_limit; /* PCRE2 解释执行的回溯深度上限 (pcre2_set_depth_limit，JIT 不使用) */
+    } BBPELimits;
+
+#define BBPE_STATS_HIST_BUCKETS 16 /* 块长度直方图的桶数 */
+
+    /**
+     * @brief 编码过程统计 (仅以 BBPE_ENABLE_STATS 编译时收集，全部字段为 uint64_t)
+     * @note 耗时为各调用的累计值 (纳秒)，多线程并发编码时为各线程之和
+     */
+    typedef struct
+    {
+        uint64_t encode_calls;    /* 编码调用次数 (bbpe_encode* / bbpe_encode_batch 中的每个文档) */
+        uint64_t encode_bytes;    /* 输入字节数 */
+        uint64_t special_ns;      /* 特殊 token 提取耗时 */
+        uint64_t pre_tokenize_ns; /* 预分词 (正则分割等) 耗时 */
+        uint64_t merge_ns;        /* BPE 合并 (含词级缓存查找与结果写出) 耗时 */
+        uint64_t special_tokens;  /* 匹配到的特殊 token 数 */
+        uint64_t chunks;          /* 预分词产生的文本块数 */
+        uint64_t chunk_len_hist[BBPE_STATS_HIST_BUCKETS]; /* 块长度直方图：桶 i 统计 [2^i, 2^(i+1)) 字节的块，最后一桶含更长的块 */
+        uint64_t small_chunks;    /* 走线性扫描路径的短块数 */
+        uint64_t heap_pushes;     /* 合并候选入堆次数 */
+        uint64_t heap_pops;       /* 出堆次数 */
+        uint64_t heap_stale_pops; /* 出堆后因已失效而丢弃的次数 */
+        uint64_t merges;          /* 实际执行的合并次数 */
+        uint64_t rule_lookups;    /* 合并规则查找次数 */
+        uint64_t rule_hits;       /* 找到规则的查找次数 */
+        uint64_t cache_lookups;   /* 词级缓存查找次数 */
+        uint64_t cache_hits;      /* 词级缓存命中次数 */
+        uint64_t chunk_splits;    /* 因超过 max_chunk_len 被切开的块数 */
+        uint64_t regex_limit_hits; /* PCRE2 匹配因达到 match_limit / depth_limit 而中止的次数 */
+        uint64_t stable_hits;     /* 整词直查命中 (块本身是稳定 token，未经合并) 的块数 */
+        uint64_t radix_chunks;    /* 以基数堆合并的块数 (长于 16 字节的块，其候选不计入 heap_* 字段) */
+        uint64_t radix_fallbacks; /* 其中因规则优先级不单调而中途改用最小堆的块数 */
+    } BBPEStats;
+
+    /**
+     * @brief 分词器占用的内存 (字节)，按各缓冲区实际分配的容量统计，不含分配器自身的开销
+     * @note 由镜像加载时，直接指向镜像的部分 (词汇表、规则行、解码表) 只计入 image_bytes
+     */
+    typedef struct
+    {
+        size_t vocab_bytes;         /* 词汇表与特殊 token 表 (字符串池、条目数组、哈希槽) 及 id 索引 */
+        size_t merge_bytes;         /* 合并规则行与可选的合并规则哈希表 */
+        size_t decode_bytes;        /* 解码字节池与偏移表，及可选的前缀索引 */
+        size_t special_trie_bytes;  /* 特殊 token 前缀树 */
+        size_t pre_tokenizer_bytes; /* 规范化器与预分词器节点、正则模式与 PCRE2 编译结果 (含 JIT 代码) */
+        size_t cache_bytes;         /* 词级缓存条目与哈希桶 */
+        size_t image_bytes;         /* bbpe_load 映射或复制的二进制镜像 (借用调用者缓冲区时为 0) */
+        size_t total_bytes;         /* 以上各项与分词器结构本身之和 */
+    } BBPEMemoryUsage;
+
+    /**
+     * @brief bbpe_init_ex、bbpe_load_ex 与 bbpe_load_from_memory 的标志位 (可按位组合)
+     */
+    enum
+    {
+        BBPE_LOAD_COPY = 0,         /* 复制缓冲区，返回后调用者可立即释放 (默认) */
+        BBPE_LOAD_BORROW = 1,       /* 借用缓冲区：调用者保证其内容在 bbpe_destroy 之前保持有效且不被修改 (仅 bbpe_load_from_memory) */
+        BBPE_LOAD_LAZY_MERGES = 2,  /* 合并规则与预分词器正则推迟到首次编码、保存或切换合并索引时构建 (只构建一次) */
+        BBPE_LOAD_DECODE_ONLY = 4,  /* 只构建解码所需的结构：合并规则与预分词器正则从不构建，编码与保存返回 BBPE_ERR_DECODE_ONLY */
+        BBPE_LOAD_PARALLEL = 8,     /* 由 JSON 构建合并规则时按 CPU 核数多线程解析规则字符串 (结果与单线程相同) */
+    };
+
+    /**
+     * @brief 自定义内存分配器 (bbpe_init_alloc、bbpe_load_alloc 等接口使用)
+     * @note 三个回调须同时提供；size 总是大于 0，realloc 的 ptr 总是非 NULL，返回的地址须满足 malloc 的对齐要求。
+     *       分词器持有的全部内存 (含 PCRE2 与 cJSON 的内部分配) 以及由它创建的解码器、流式编码器都经此分配，
+     *       回调须在这些对象全部销毁前保持可用 (可被多个线程同时调用)；PCRE2 JIT 的可执行内存仍由 PCRE2 自行映射。
+     *       交给调用者释放的结果 (BBPEOutput、BBPEOffsets、解码字符串、bbpe_save_to_memory 的缓冲区) 仍使用 malloc
+     */
+    typedef struct
+    {
+        void *(*alloc)(void *user_data, size_t size);              /* 分配 size 字节，失败返回 NULL */
+        void *(*realloc)(void *user_data, void *ptr, size_t size); /* 调整 ptr 的大小，失败返回 NULL 且不释放 ptr */
+        void (*free)(void *user_data, void *ptr);                  /* 释放 ptr (不会传入 NULL) */
+        void *user_data;                                           /* 原样传给三个回调 */
+    } BBPEAllocator;
+
     /**
      * @brief 分词器句柄 (不透明指针)
+     * @note 线程安全：初始化/加载完成后，编码 (bbpe_encode* 系列、bbpe_encode_batch) 与解码 (bbpe_decode、bbpe_decode_into、bbpe_decode_batch*、bbpe_decoded_length)
+     *       只读取分词器，可由任意多个线程同时对同一句柄调用；临时状态均位于调用内或工作区中，
+     *       词级缓存与延迟构建 (BBPE_LOAD_LAZY_MERGES) 由内部互斥锁保护。bbpe_set_cache、bbpe_set_merge_index、bbpe_set_whole_token_lookup、bbpe_set_numa_replication、bbpe_set_prefix_index、bbpe_set_limits、bbpe_save、
+     *       bbpe_destroy 会修改或释放句柄，调用时不得有其他线程正在使用该句柄。异步编码 (bbpe_encode_async 等) 自带互斥锁，
+     *       可与上述编码调用并发，bbpe_async_start / bbpe_async_stop 除外。bbpe_derive 可与基础分词器上的编码并发调用
      */
     typedef struct BBPETokenizer BBPETokenizer;
 
+    /**
+     * @brief 编码工作区句柄 (不透明指针)，持有编码过程中的临时缓冲区，可跨调用复用
+     */
+    typedef struct BBPEWorkspace BBPEWorkspace;
+
+    /**
+     * @brief 流式解码器句柄 (不透明指针)，逐个接收 token ID 并只输出已完整的 UTF-8 文本
+     */
+    typedef struct BBPEDecoder BBPEDecoder;
+
+    /**
+     * @brief 流式编码器句柄 (不透明指针)，分段接收文本并尽早输出已确定的 token ID
+     */
+    typedef struct BBPEStreamEncoder BBPEStreamEncoder;
+
     /**
      * @brief 从 JSON 字符串初始化分词器
      * @param json_content tokenizer.json 的完整内容字符串 (UTF-8)
      * @param out_tokenizer 输出分词器句柄的指针，成功时指向新创建的对象
      * @return BBPEStatus 状态码
+     * @note 每条合并规则在内存中压缩为 8 字节：参与合并的 ID 须小于 2^21、规则数 (优先级) 须小于 2^22，
+     *       否则返回 BBPE_ERR_INVALID_INPUT (特殊 token 的 ID 不受此限)。
+     *       normalizer 支持 NFC / NFD / NFKC / NFKD / Lowercase / Replace (String 模式) / Prepend / Sequence，
+     *       在提取特殊 token 之后逐段作用于普通文本；其他类型返回 BBPE_ERR_UNSUPPORTED_TYPE
      */
     BBPEStatus bbpe_init(const char *json_content, BBPETokenizer **out_tokenizer);
 
+    /**
+     * @brief 按加载标志从 JSON 字符串初始化分词器
+     * @param json_content tokenizer.json 的完整内容字符串 (UTF-8)
+     * @param flags 0，或 BBPE_LOAD_LAZY_MERGES / BBPE_LOAD_DECODE_ONLY / BBPE_LOAD_PARALLEL 的组合
+     * @param out_tokenizer 输出分词器句柄的指针，成功时指向新创建的对象
+     * @return BBPEStatus 状态码
+     * @note 延迟构建时 model.merges 的原文被复制保留，json_content 在返回后即可释放；
+     *       合并规则或正则的错误 (如无法编译的模式) 推迟到首次编码时返回
+     */
+    BBPEStatus bbpe_init_ex(const char *json_content, uint32_t flags, BBPETokenizer **out_tokenizer);
+
+    /**
+     * @brief 同 bbpe_init_ex，但分词器的内存经 allocator 分配
+     * @param allocator 分配器 (为 NULL 时使用 malloc/free)；仅复制结构体，回调与 user_data 须在 bbpe_destroy 之前有效
+     * @return BBPEStatus 状态码 (回调未同时提供时返回 BBPE_ERR_INVALID_INPUT)
+     * @note 解析期间当前线程的 cJSON 分配也经 allocator 转发；其他线程直接使用 cJSON 不受影响
+     */
+    BBPEStatus bbpe_init_alloc(const char *json_content, uint32_t flags, const BBPEAllocator *allocator,
+                               BBPETokenizer **out_tokenizer);
+
     /**
      * @brief 执行分词推理 (文本 → token IDs)
      * @param tokenizer 分词器句柄
@@ -56,6 +227,275 @@ extern "C"
      */
     BBPEStatus bbpe_encode(BBPETokenizer *tokenizer, const char *text, BBPEOutput *out_output);
 
+    /**
+     * @brief 执行分词推理，输入由显式长度界定 (无需以 '\0' 结尾，可包含 '\0')
+     * @param tokenizer 分词器句柄
+     * @param text 输入文本 (UTF-8)，len 为 0 时可为 NULL
+     * @param len 输入文本字节数
+     * @param out_output 输出结果结构，使用后需调用 bbpe_free_output 释放
+     * @return BBPEStatus 状态码
+     */
+    BBPEStatus bbpe_encode_n(BBPETokenizer *tokenizer, const char *text, size_t len, BBPEOutput *out_output);
+
+    /**
+     * @brief 执行分词推理并复用输出结构中已有的缓冲区 (容量不足时才扩展)
+     * @param tokenizer 分词器句柄
+     * @param text 输入文本 (UTF-8)
+     * @param len 输入文本字节数
+     * @param output 输入输出结构：首次使用前需清零，之后每次调用覆盖 ids/count 并保留容量，
+     *               不再使用时调用 bbpe_free_output 释放；失败时 count 为 0，缓冲区保留
+     * @return BBPEStatus 状态码
+     */
+    BBPEStatus bbpe_encode_reuse(BBPETokenizer *tokenizer, const char *text, size_t len, BBPEOutput *output);
+
+    /**
+     * @brief 执行分词推理并写入调用者提供的缓冲区 (不做任何输出分配)
+     * @param tokenizer 分词器句柄
+     * @param text 输入文本 (UTF-8)
+     * @param len 输入文本字节数
+     * @param ids 调用者缓冲区，capacity 为 0 时可为 NULL
+     * @param capacity 缓冲区容量 (元素个数)
+     * @param out_count 输出实际需要的 ID 数量 (无论缓冲区是否足够)
+     * @return BBPE_OK 表示全部写入；BBPE_ERR_BUFFER_TOO_SMALL 表示只写入了前 capacity 个，
+     *         可按 *out_count 扩大缓冲区后重试
+     */
+    BBPEStatus bbpe_encode_into(BBPETokenizer *tokenizer, const char *text, size_t len,
+                                int32_t *ids, size_t capacity, size_t *out_count);
+
+    /**
+     * @brief 只统计文本编码后的 token 数，不生成 ID 数组
+     * @param tokenizer 分词器句柄
+     * @param text 输入文本 (UTF-8)
+     * @param len 输入文本字节数
+     * @param out_count 输出 token 数 (与 bbpe_encode_n 结果的 count 相同)
+     * @return BBPEStatus 状态码
+     * @note 不做任何输出分配；启用词级缓存时命中的块无需合并
+     */
+    BBPEStatus bbpe_count_tokens(BBPETokenizer *tokenizer, const char *text, size_t len, size_t *out_count);
+
+    /**
+     * @brief 编码并截断到最多 max_tokens 个 token，达到上限后即停止预分词与合并
+     * @param tokenizer 分词器句柄
+     * @param text 输入文本 (UTF-8)
+     * @param len 输入文本字节数
+     * @param max_tokens token 数上限
+     * @param side 截断方向
+     * @param out_output 输出结果，与 bbpe_encode_n 结果的前 (RIGHT) 或后 (LEFT) max_tokens 个 ID 相同
+     * @param out_offset 可为 NULL；RIGHT 时输出保留的 token 覆盖的原文结束偏移，LEFT 时输出起始偏移
+     *                   (未截断时分别为 len 与 0)
+     * @return BBPEStatus 状态码
+     * @note 偏移取自合并时各 token 在块中的位置，位于 token 边界，可能落在多字节 UTF-8 字符中间
+     */
+    BBPEStatus bbpe_encode_truncated(BBPETokenizer *tokenizer, const char *text, size_t len, size_t max_tokens,
+                                     BBPETruncation side, BBPEOutput *out_output, size_t *out_offset);
+
+    /**
+     * @brief 编码并同时输出每个 token 在输入中的字节区间
+     * @param tokenizer 分词器句柄
+     * @param text 输入文本 (UTF-8)
+     * @param len 输入文本字节数
+     * @param out_output 输出结果 (同 bbpe_encode_n)
+     * @param out_offsets 输出字节区间，使用后需调用 bbpe_free_offsets 释放
+     * @return BBPEStatus 状态码
+     * @note 区间按 token 的原始字节计算：多字节字符被拆到多个 token 时区间落在字符中间；
+     *       只覆盖 ByteLevel 补充的前缀空格的 token 区间长度为 0
+     */
+    BBPEStatus bbpe_encode_with_offsets(BBPETokenizer *tokenizer, const char *text, size_t len,
+                                        BBPEOutput *out_output, BBPEOffsets *out_offsets);
+
+    /**
+     * @brief 增量重新编码：复用上一次结果中未改变的前缀，只编码其后的部分 (适用于每轮只追加或修改结尾的多轮对话)
+     * @param tokenizer 分词器句柄
+     * @param old_text 上一次编码的文本
+     * @param old_len 上一次编码的文本字节数
+     * @param text 新文本
+     * @param len 新文本字节数
+     * @param output 输入为 old_text 的编码结果，输出 text 的编码结果 (原地更新，复用容量)
+     * @param offsets 输入为 output 对应的字节区间 (bbpe_encode_with_offsets 或本函数的输出)，原地更新为新结果的区间
+     * @param out_reused 可为 NULL；输出从上一次结果中直接复用的 token 数
+     * @return BBPEStatus 状态码；失败时 output 与 offsets 的 count 为 0，缓冲区保留
+     * @note 复用的前缀止于公共前缀内最后一个可切开的预分词块边界 (规则同 bbpe_stream_encoder_feed)，
+     *       结果与 bbpe_encode_with_offsets 对新文本的结果逐个 ID、逐个区间相同。
+     *       重新编码的开销只与切点之后的文本有关；比较公共前缀仍需一次 memcmp 级的扫描
+     */
+    BBPEStatus bbpe_encode_incremental(BBPETokenizer *tokenizer, const char *old_text, size_t old_len,
+                                       const char *text, size_t len, BBPEOutput *output, BBPEOffsets *offsets,
+                                       size_t *out_reused);
+
+    /**
+     * @brief 创建编码工作区
+     * @param out_workspace 输出工作区句柄
+     * @return BBPEStatus 状态码
+     * @note 工作区不与特定分词器绑定；同一时刻只能被一个调用使用，建议每个线程持有一个
+     */
+    BBPEStatus bbpe_workspace_create(BBPEWorkspace **out_workspace);
+
+    /**
+     * @brief 同 bbpe_workspace_create，但工作区及其缓冲区 (含 PCRE2 匹配数据) 经 allocator 分配
+     * @param allocator 分配器 (为 NULL 时使用 malloc/free)，须在 bbpe_workspace_destroy 之前有效
+     * @param out_workspace 输出工作区句柄
+     * @return BBPEStatus 状态码
+     */
+    BBPEStatus bbpe_workspace_create_alloc(const BBPEAllocator *allocator, BBPEWorkspace **out_workspace);
+
+    /**
+     * @brief 销毁编码工作区并释放其全部缓冲区
+     * @param workspace 工作区句柄 (可为 NULL)
+     */
+    void bbpe_workspace_destroy(BBPEWorkspace *workspace);
+
+    /**
+     * @brief 同 bbpe_encode_reuse，但使用调用者提供的工作区 (稳定状态下不再分配内存)
+     * @param workspace 工作区句柄，为 NULL 时等同于 bbpe_encode_reuse
+     */
+    BBPEStatus bbpe_encode_reuse_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                    const char *text, size_t len, BBPEOutput *output);
+
+    /**
+     * @brief 同 bbpe_encode_into，但使用调用者提供的工作区 (稳定状态下不再分配内存)
+     * @param workspace 工作区句柄，为 NULL 时等同于 bbpe_encode_into
+     */
+    BBPEStatus bbpe_encode_into_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace, const char *text, size_t len,
+                                   int32_t *ids, size_t capacity, size_t *out_count);
+
+    /**
+     * @brief 同 bbpe_count_tokens，但使用调用者提供的工作区 (稳定状态下不再分配内存)
+     * @param workspace 工作区句柄，为 NULL 时等同于 bbpe_count_tokens
+     */
+    BBPEStatus bbpe_count_tokens_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                    const char *text, size_t len, size_t *out_count);
+
+    /**
+     * @brief 同 bbpe_encode_truncated，但使用调用者提供的工作区并复用输出缓冲区 (同 bbpe_encode_reuse)
+     * @param workspace 工作区句柄，为 NULL 时使用本次调用内的临时工作区
+     */
+    BBPEStatus bbpe_encode_truncated_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                        const char *text, size_t len, size_t max_tokens,
+                                        BBPETruncation side, BBPEOutput *output, size_t *out_offset);
+
+    /**
+     * @brief 同 bbpe_encode_with_offsets，但使用调用者提供的工作区并复用输出与区间缓冲区 (同 bbpe_encode_reuse)
+     * @param workspace 工作区句柄，为 NULL 时使用本次调用内的临时工作区
+     */
+    BBPEStatus bbpe_encode_with_offsets_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                           const char *text, size_t len,
+                                           BBPEOutput *output, BBPEOffsets *offsets);
+
+    /**
+     * @brief 同 bbpe_encode_incremental，但使用调用者提供的工作区
+     * @param workspace 工作区句柄，为 NULL 时等同于 bbpe_encode_incremental
+     */
+    BBPEStatus bbpe_encode_incremental_ws(BBPETokenizer *tokenizer, BBPEWorkspace *workspace,
+                                          const char *old_text, size_t old_len, const char *text, size_t len,
+                                          BBPEOutput *output, BBPEOffsets *offsets, size_t *out_reused);
+
+    /**
+     * @brief 批量编码多个文档：多个工作线程共享同一分词器，各自使用私有工作区
+     * @param tokenizer 分词器句柄
+     * @param texts 文档数组 (UTF-8)，长度为 0 的文档可为 NULL
+     * @param lens 各文档字节数，为 NULL 时各文档按 '\0' 结尾计算长度
+     * @param n 文档数
+     * @param outputs 输出数组 (n 个元素，无需预先初始化)，outputs[i] 对应 texts[i]，
+     *                使用后需对每个元素调用 bbpe_free_output 释放
+     * @param num_threads 线程数 (含调用线程)，<= 0 表示使用全部逻辑处理器，超过可并行的任务数时按任务数计
+     * @return BBPEStatus 状态码；任一文档失败时返回下标最小的失败文档的错误码，且所有输出均已释放
+     * @note 各线程以工作窃取调度任务：短文档按字节数打包成任务，不短于 64 KiB 的文档像 bbpe_encode_parallel 一样
+     *       拆成块区间由所有线程分担，结果仍与逐个调用 bbpe_encode_n 相同。
+     *       编码期间不得并发调用 bbpe_set_cache / bbpe_set_merge_index / bbpe_set_whole_token_lookup /
+     *       bbpe_set_numa_replication / bbpe_set_limits / bbpe_destroy
+     */
+    BBPEStatus bbpe_encode_batch(BBPETokenizer *tokenizer, const char *const *texts, const size_t *lens, size_t n,
+                                 BBPEOutput *outputs, int num_threads);
+
+    /**
+     * @brief 文档内并行编码：串行完成特殊 token 提取与预分词后，将连续的文本块划分为区间在多个线程上合并，
+     *        再按顺序拼接 (适用于超长单个输入)
+     * @param tokenizer 分词器句柄
+     * @param text 输入文本 (UTF-8)
+     * @param len 输入文本字节数
+     * @param out_output 输出结果结构，与 bbpe_encode_n 的结果逐个 ID 相同，使用后需调用 bbpe_free_output 释放
+     * @param num_threads 线程数 (含调用线程)，<= 0 表示使用全部逻辑处理器
+     * @return BBPEStatus 状态码
+     * @note 输入短于 64 KiB 或 num_threads 为 1 时直接串行编码
+     */
+    BBPEStatus bbpe_encode_parallel(BBPETokenizer *tokenizer, const char *text, size_t len,
+                                    BBPEOutput *out_output, int num_threads);
+
+    /**
+     * @brief bbpe_async_start 的标志位
+     */
+    enum
+    {
+        BBPE_ASYNC_DEFERRED = 1, /* 完成的请求排队，由 bbpe_async_dispatch 在调用线程上运行回调 (配合 bbpe_async_fd 使用) */
+    };
+
+    /**
+     * @brief 异步编码的完成回调
+     * @param request bbpe_encode_async 返回的请求号
+     * @param status 编码结果；被取消时为 BBPE_ERR_CANCELLED
+     * @param output 编码结果 (失败或取消时为空)，由回调负责以 bbpe_free_output 释放 (也可直接接管 ids)
+     * @param user_data 提交时传入的指针
+     */
+    typedef void (*BBPEAsyncCallback)(uint64_t request, BBPEStatus status, BBPEOutput *output, void *user_data);
+
+    /**
+     * @brief 启动分词器的异步编码线程池 (已启动时先按 bbpe_async_stop 停止)
+     * @param tokenizer 分词器句柄
+     * @param num_threads 工作线程数，<= 0 表示使用全部逻辑处理器
+     * @param flags 0 表示回调在工作线程上运行；BBPE_ASYNC_DEFERRED 表示回调由 bbpe_async_dispatch 运行
+     * @return BBPEStatus 状态码；一个线程也无法启动或无法创建通知描述符时返回 BBPE_ERR_MEMORY
+     * @note 未调用本函数时，第一次 bbpe_encode_async 以 (0, 0) 自动启动。不得与其他异步调用并发
+     */
+    BBPEStatus bbpe_async_start(BBPETokenizer *tokenizer, int num_threads, uint32_t flags);
+
+    /**
+     * @brief 停止异步编码线程池：取消全部未完成的请求，等待工作线程退出
+     * @param tokenizer 分词器句柄 (未启动时不做任何事)
+     * @note 尚未开始的请求与排队待分发的结果在本函数中 (调用线程上) 运行回调，正在编码的请求在下一个块边界处中止；
+     *       返回时每个请求的回调都已运行过恰好一次。bbpe_destroy 会自动调用，不得在回调中调用
+     */
+    void bbpe_async_stop(BBPETokenizer *tokenizer);
+
+    /**
+     * @brief 提交一个异步编码请求，立即返回
+     * @param tokenizer 分词器句柄
+     * @param text 输入文本 (UTF-8)，回调运行之前须保持有效 (不复制)
+     * @param len 输入文本字节数
+     * @param callback 完成回调 (每个请求恰好调用一次，结果与 bbpe_encode_n 相同)
+     * @param user_data 原样传给回调
+     * @param out_request 输出请求号 (从 1 开始递增，用于 bbpe_async_cancel)，可为 NULL
+     * @return BBPEStatus 状态码；失败时回调不会被调用
+     * @note 请求按提交顺序开始编码，由各工作线程以私有工作区执行，完成顺序不确定
+     */
+    BBPEStatus bbpe_encode_async(BBPETokenizer *tokenizer, const char *text, size_t len, BBPEAsyncCallback callback,
+                                 void *user_data, uint64_t *out_request);
+
+    /**
+     * @brief 取消一个异步编码请求
+     * @param tokenizer 分词器句柄
+     * @param request 请求号
+     * @return BBPE_OK 表示回调将以 BBPE_ERR_CANCELLED 运行；请求已完成或不存在时返回 BBPE_ERR_INVALID_INPUT
+     * @note 尚未开始的请求立即移出队列：未设置 BBPE_ASYNC_DEFERRED 时其回调在本函数返回前于调用线程上运行，
+     *       否则排入待分发队列。正在编码的请求在下一个块边界处 (至多几十个块之后) 中止
+     */
+    BBPEStatus bbpe_async_cancel(BBPETokenizer *tokenizer, uint64_t request);
+
+    /**
+     * @brief 返回完成通知描述符：有结果待分发时可读 (Linux 为 eventfd，其他 POSIX 系统为管道的读端)
+     * @param tokenizer 分词器句柄
+     * @return 描述符；未以 BBPE_ASYNC_DEFERRED 启动或在 Windows 上返回 -1 (此时可定期调用 bbpe_async_dispatch)
+     * @note 描述符由分词器持有，可加入 epoll / io_uring / poll (只需关注可读)，不得读取或关闭，bbpe_async_stop 时关闭
+     */
+    int bbpe_async_fd(BBPETokenizer *tokenizer);
+
+    /**
+     * @brief 清除完成通知，并在调用线程上依次运行全部待分发结果的回调 (BBPE_ASYNC_DEFERRED)
+     * @param tokenizer 分词器句柄
+     * @return 运行的回调数
+     * @note 回调中可以提交或取消请求；同一时刻只应有一个线程调用本函数
+     */
+    size_t bbpe_async_dispatch(BBPETokenizer *tokenizer);
+
     /**
      * @brief 将 token ID 序列解码回原始文本 (token IDs → 文本)
      * @param tokenizer 分词器句柄
@@ -66,15 +506,340 @@ extern "C"
      */
     BBPEStatus bbpe_decode(BBPETokenizer *tokenizer, const int32_t *ids, size_t count, char **out_text);
 
+    /**
+     * @brief 将 token ID 序列解码到调用者提供的缓冲区 (不做任何分配)
+     * @param tokenizer 分词器句柄
+     * @param ids 输入的 ID 数组 (count 为 0 时可为 NULL)
+     * @param count ID 数量 (可为 0，输出空字符串)
+     * @param buf 调用者缓冲区，capacity 为 0 时可为 NULL
+     * @param capacity 缓冲区容量 (字节，须容纳结尾 '\0')
+     * @param out_len 输出解码后的字节数 (不含结尾 '\0'，无论缓冲区是否足够)
+     * @return BBPE_OK 表示已写入以 '\0' 结尾的文本；BBPE_ERR_BUFFER_TOO_SMALL 表示 capacity <= *out_len，
+     *         未写入任何内容，可按 *out_len + 1 扩大缓冲区后重试
+     */
+    BBPEStatus bbpe_decode_into(BBPETokenizer *tokenizer, const int32_t *ids, size_t count, char *buf, size_t capacity,
+                                size_t *out_len);
+
+    /**
+     * @brief 计算 token ID 序列解码后的字节数 (查预先计算的逐 ID 长度表，不解码)
+     * @param tokenizer 分词器句柄
+     * @param ids 输入的 ID 数组 (count 为 0 时可为 NULL)
+     * @param count ID 数量
+     * @param out_len 输出字节数 (不含结尾 '\0')，与 bbpe_decode 结果的 strlen 相同
+     * @return BBPEStatus 状态码 (与 bbpe_decode 相同，含非法 ID 时失败)
+     */
+    BBPEStatus bbpe_decoded_length(BBPETokenizer *tokenizer, const int32_t *ids, size_t count, size_t *out_len);
+
+    /**
+     * @brief 批量解码多个 ID 序列，全部文本依次写入一块连续缓冲区 (只分配一次)
+     * @param tokenizer 分词器句柄
+     * @param ids 全部序列首尾相接的 ID 数组 (ID 总数为 0 时可为 NULL)
+     * @param id_offsets n + 1 项：第 i 个序列为 ids[id_offsets[i], id_offsets[i+1])，允许空序列
+     * @param n 序列数
+     * @param out_text 输出全部文本 (以 '\0' 结尾，序列之间没有分隔符)，调用者需使用 free() 释放；失败时为 NULL
+     * @param text_offsets 调用者提供的 n + 1 项数组：第 i 个序列的文本为 (*out_text)[text_offsets[i], text_offsets[i+1])
+     * @param num_threads 线程数 (含调用线程)，<= 0 表示使用全部逻辑处理器；ID 总数少于 65536 时串行解码
+     * @return BBPEStatus 状态码；任一序列含非法 ID 时返回下标最小的失败序列的错误码
+     */
+    BBPEStatus bbpe_decode_batch(BBPETokenizer *tokenizer, const int32_t *ids, const size_t *id_offsets, size_t n,
+                                 char **out_text, size_t *text_offsets, int num_threads);
+
+    /**
+     * @brief 同 bbpe_decode_batch，但写入调用者提供的缓冲区 (不做任何分配，不写结尾 '\0')
+     * @param text 调用者缓冲区，capacity 为 0 时可为 NULL
+     * @param capacity 缓冲区容量 (字节)
+     * @return BBPE_OK 表示全部写入；BBPE_ERR_BUFFER_TOO_SMALL 表示未写入任何文本，
+     *         text_offsets 已完整填写，可按 text_offsets[n] 扩大缓冲区后重试
+     */
+    BBPEStatus bbpe_decode_batch_into(BBPETokenizer *tokenizer, const int32_t *ids, const size_t *id_offsets, size_t n,
+                                      char *text, size_t capacity, size_t *text_offsets, int num_threads);
+
+    /**
+     * @brief 查找 token 字符串对应的 ID (查分词器已有的哈希表，不重建任何映射)
+     * @param tokenizer 分词器句柄
+     * @param token 词汇表中的写法 (与 tokenizer.json 相同，即字节级映射后的字符串，无需以 '\0' 结尾)
+     * @param len token 字节数
+     * @param out_id 输出 token ID；未找到时为 -1
+     * @return BBPE_OK；不在词汇表与特殊 token 中时返回 BBPE_ERR_TOKEN_NOT_FOUND
+     * @note 先查特殊 token 再查词汇表 (与 added_tokens 覆盖 model.vocab 的规则一致)，可在多个线程中同时调用
+     */
+    BBPEStatus bbpe_token_to_id(BBPETokenizer *tokenizer, const char *token, size_t len, int32_t *out_id);
+
+    /**
+     * @brief 取 ID 对应的 token 字符串 (词汇表中的写法)
+     * @param tokenizer 分词器句柄
+     * @param id token ID
+     * @param out_token 输出字符串 (以 '\0' 结尾)，指向分词器内部存储，在 bbpe_destroy 之前有效
+     * @param out_len 输出字节数
+     * @return BBPE_OK；ID 越界或没有对应 token 时返回 BBPE_ERR_TOKEN_NOT_FOUND
+     */
+    BBPEStatus bbpe_id_to_token(BBPETokenizer *tokenizer, int32_t id, const char **out_token, size_t *out_len);
+
+    /**
+     * @brief 取 ID 解码后的原始字节 (与对单个 ID 调用 bbpe_decode 的结果相同，查预先计算的解码表)
+     * @param tokenizer 分词器句柄
+     * @param id token ID
+     * @param out_bytes 输出字节 (不以 '\0' 结尾，可能不是完整的 UTF-8)，指向分词器内部存储，在 bbpe_destroy 之前有效
+     * @param out_len 输出字节数
+     * @return BBPEStatus 状态码 (与 bbpe_decode 相同)
+     */
+    BBPEStatus bbpe_id_to_bytes(BBPETokenizer *tokenizer, int32_t id, const char **out_bytes, size_t *out_len);
+
+    /**
+     * @brief 取全部 token 解码后的字节表 (不复制)：ID i 的字节为 bytes[offsets[i], offsets[i+1])
+     * @param tokenizer 分词器句柄
+     * @param out_bytes 输出连续字节池，指向分词器内部存储，在 bbpe_destroy 之前有效
+     * @param out_offsets 输出 (*out_vocab_size + 1) 项的偏移数组，同样指向分词器内部存储
+     * @param out_vocab_size 输出 ID 上限 (最大 ID + 1)
+     * @return BBPEStatus 状态码
+     * @note 供约束解码等需要整张词表的场合一次性取用；没有 token 或无法解码的 ID 长度为 0
+     *       (与空 token 无法区分，需要时以 bbpe_id_to_bytes 判断)
+     */
+    BBPEStatus bbpe_get_decoded_vocab(BBPETokenizer *tokenizer, const char **out_bytes, const uint32_t **out_offsets,
+                                      size_t *out_vocab_size);
+
+    /**
+     * @brief bbpe_prefix_mask 的匹配方式 (可按位组合)
+     */
+    typedef enum
+    {
+        BBPE_PREFIX_EXTENDS = 1, /* 解码字节以给定字节串开头 (含相等)：token 是给定前缀的延续 */
+        BBPE_PREFIX_WITHIN = 2,  /* 解码字节是给定字节串的非空前缀 (含相等)：token 完全落在给定字节串之内 */
+    } BBPEPrefixMatch;
+
+    /**
+     * @brief 启用或关闭解码字节前缀索引 (约束解码用)：解码字节非空的全部 ID 按解码字节的字典序排列
+     * @param tokenizer 分词器句柄
+     * @param enable 非 0 时立即构建 (已有时直接返回)，0 时释放
+     * @return BBPEStatus 状态码
+     * @note 构建为一次 MSD 基数排序 (Qwen3 约 10 ms、0.6 MB)，不写入序列化文件；以 BBPE_LOAD_DECODE_ONLY 加载时同样可用
+     */
+    BBPEStatus bbpe_set_prefix_index(BBPETokenizer *tokenizer, int enable);
+
+    /**
+     * @brief 列出解码字节以 prefix 开头的全部 token (O(len·log V)，不复制)
+     * @param tokenizer 分词器句柄 (已启用前缀索引)
+     * @param prefix 前缀字节串 (len 为 0 时可为 NULL，此时列出全部非空 token)
+     * @param len 前缀字节数
+     * @param out_ids 输出 ID 数组，按解码字节的字典序排列，指向分词器内部，在关闭索引或 bbpe_destroy 之前有效
+     * @param out_count 输出 ID 个数
+     * @return BBPEStatus 状态码；未启用前缀索引时返回 BBPE_ERR_INVALID_INPUT
+     */
+    BBPEStatus bbpe_prefix_tokens(BBPETokenizer *tokenizer, const char *prefix, size_t len, const int32_t **out_ids,
+                                  size_t *out_count);
+
+    /**
+     * @brief 把与 bytes 相容的 token 在位图中置位 (第 id 位为 mask[id / 32] 的第 id % 32 位，只置位不清零)
+     * @param tokenizer 分词器句柄 (已启用前缀索引)
+     * @param bytes 允许的字节串 (len 为 0 时可为 NULL)
+     * @param len 字节数
+     * @param match BBPE_PREFIX_EXTENDS、BBPE_PREFIX_WITHIN 或两者之和 (两者之和即解码字节与 bytes 互为前缀)
+     * @param mask 调用者提供的位图，至少 (vocab_size + 31) / 32 个字 (vocab_size 见 bbpe_get_decoded_vocab)
+     * @return BBPEStatus 状态码；未启用前缀索引时返回 BBPE_ERR_INVALID_INPUT
+     * @note 对允许集合中的每个字节串依次调用即可得到它们的并集；特殊 token 按其文本参与匹配，需要时由调用者清除
+     */
+    BBPEStatus bbpe_prefix_mask(BBPETokenizer *tokenizer, const char *bytes, size_t len, uint32_t match, uint32_t *mask);
+
+    /**
+     * @brief 创建流式解码器 (用于生成时逐 token 输出文本)
+     * @param tokenizer 分词器句柄，须在解码器销毁之前保持有效
+     * @param out_decoder 输出解码器句柄
+     * @return BBPEStatus 状态码
+     * @note 解码器同一时刻只能被一个线程使用；多个解码器可同时共享同一分词器
+     */
+    BBPEStatus bbpe_decoder_new(BBPETokenizer *tokenizer, BBPEDecoder **out_decoder);
+
+    /**
+     * @brief 向流式解码器追加一个 token，输出因此而完整的文本
+     * @param decoder 解码器句柄
+     * @param id token ID
+     * @param out_text 输出文本指针 (以 '\0' 结尾，可能为空串)，指向解码器内部缓冲区，
+     *                 下一次调用 push/flush/destroy 之前有效
+     * @param out_len 输出文本字节数
+     * @return BBPEStatus 状态码；失败时解码器状态不变
+     * @note 末尾被拆到后续 token 中的多字节 UTF-8 字符 (最多 3 字节) 暂存在解码器内，补全后随下一次输出；
+     *       逐个 push 的输出拼接后与 bbpe_decode 对完整序列的结果逐字节相同 (末尾需调用 bbpe_decoder_flush)
+     */
+    BBPEStatus bbpe_decoder_push(BBPEDecoder *decoder, int32_t id, const char **out_text, size_t *out_len);
+
+    /**
+     * @brief 输出并清空暂存的不完整字节 (生成结束时调用)
+     * @param decoder 解码器句柄
+     * @param out_text 输出文本指针，规则同 bbpe_decoder_push；暂存字节按原样输出，可能不是合法 UTF-8
+     * @param out_len 输出文本字节数
+     * @return BBPEStatus 状态码
+     */
+    BBPEStatus bbpe_decoder_flush(BBPEDecoder *decoder, const char **out_text, size_t *out_len);
+
+    /**
+     * @brief 丢弃暂存字节，使解码器可用于新的序列 (保留缓冲区)
+     * @param decoder 解码器句柄 (可为 NULL)
+     */
+    void bbpe_decoder_reset(BBPEDecoder *decoder);
+
+    /**
+     * @brief 销毁流式解码器
+     * @param decoder 解码器句柄 (可为 NULL)
+     */
+    void bbpe_decoder_destroy(BBPEDecoder *decoder);
+
+    /**
+     * @brief 创建流式编码器 (用于日志、网络流等无法一次取得完整文本的输入)
+     * @param tokenizer 分词器句柄，须在编码器销毁之前保持有效
+     * @param out_encoder 输出编码器句柄
+     * @return BBPEStatus 状态码
+     * @note 编码器同一时刻只能被一个线程使用；多个编码器可同时共享同一分词器
+     */
+    BBPEStatus bbpe_stream_encoder_new(BBPETokenizer *tokenizer, BBPEStreamEncoder **out_encoder);
+
+    /**
+     * @brief 向流式编码器追加一段文本，输出因此而确定的 token ID
+     * @param encoder 编码器句柄
+     * @param data 文本片段 (可在任意字节处切开，包括 UTF-8 字符与特殊 token 的中间)
+     * @param len 片段字节数
+     * @param out_ids 输出 ID 数组指针，指向编码器内部缓冲区，下一次调用 feed/finish/destroy 之前有效
+     * @param out_count 输出 ID 数 (可能为 0)
+     * @return BBPEStatus 状态码；失败时编码器状态不变 (本次片段未被接收)
+     * @note 编码器只暂存末尾可能继续延伸的预分词块与可能构成特殊 token 的前缀，其余文本立即编码。
+     *       预分词链为内置分割器处理的单个标准 Split 时，在字母与非字母之间切开；其他配置只在特殊 token 之后切开。
+     *       输入为合法 UTF-8 时，各次输出拼接后与 bbpe_encode_n 对完整文本的结果逐个 ID 相同 (末尾需调用
+     *       bbpe_stream_encoder_finish)；某段文本在切开之后才出现非法 UTF-8 时，仅切点之后的部分整体作为一个块
+     */
+    BBPEStatus bbpe_stream_encoder_feed(BBPEStreamEncoder *encoder, const char *data, size_t len,
+                                        const int32_t **out_ids, size_t *out_count);
+
+    /**
+     * @brief 编码全部暂存文本 (输入结束时调用)，之后编码器可用于新的文本
+     * @param encoder 编码器句柄
+     * @param out_ids 输出 ID 数组指针，规则同 bbpe_stream_encoder_feed
+     * @param out_count 输出 ID 数
+     * @return BBPEStatus 状态码；失败时暂存文本保留
+     */
+    BBPEStatus bbpe_stream_encoder_finish(BBPEStreamEncoder *encoder, const int32_t **out_ids, size_t *out_count);
+
+    /**
+     * @brief 查询暂存的尚未编码的字节数
+     * @param encoder 编码器句柄 (可为 NULL)
+     * @return 暂存字节数
+     */
+    size_t bbpe_stream_encoder_pending(const BBPEStreamEncoder *encoder);
+
+    /**
+     * @brief 丢弃暂存文本，使编码器可用于新的文本 (保留缓冲区)
+     * @param encoder 编码器句柄 (可为 NULL)
+     */
+    void bbpe_stream_encoder_reset(BBPEStreamEncoder *encoder);
+
+    /**
+     * @brief 销毁流式编码器
+     * @param encoder 编码器句柄 (可为 NULL)
+     */
+    void bbpe_stream_encoder_destroy(BBPEStreamEncoder *encoder);
+
+    /**
+     * @brief 配置词级 BPE 结果缓存 (预分词块字节 → ID 序列)
+     * @param tokenizer 分词器句柄
+     * @param capacity 最大缓存条目数，0 表示禁用并释放缓存 (默认禁用)
+     * @param policy 容量满时的淘汰策略
+     * @return BBPEStatus 状态码
+     * @note 仅缓存不超过 64 字节的文本块；缓存不改变编码结果
+     */
+    BBPEStatus bbpe_set_cache(BBPETokenizer *tokenizer, size_t capacity, BBPECachePolicy policy);
+
+    /**
+     * @brief 选择 BPE 合并时使用的合并规则索引
+     * @param tokenizer 分词器句柄
+     * @param index 索引方式；切换到 BBPE_MERGE_INDEX_HASH 时立即构建哈希表，切回 ROWS 时释放
+     * @return BBPEStatus 状态码
+     * @note 索引方式不改变编码结果，也不写入序列化文件。派生的分词器 (bbpe_derive) 直接共享基础分词器已建好的哈希表；
+     *       基础分词器的哈希表正被共享时不能切回 ROWS (返回 BBPE_ERR_INVALID_INPUT)
+     */
+    BBPEStatus bbpe_set_merge_index(BBPETokenizer *tokenizer, BBPEMergeIndex index);
+
+    /**
+     * @brief 启用或关闭整词直查：预分词块本身是"稳定" token 时直接查词汇表得到其 ID，不经逐字节合并
+     * @param tokenizer 分词器句柄
+     * @param enable 非 0 时立即计算稳定 token 位图 (已有时直接返回)，0 时释放
+     * @return BBPEStatus 状态码；以 BBPE_LOAD_DECODE_ONLY 加载时启用返回 BBPE_ERR_DECODE_ONLY
+     * @note 稳定 token 指其字节串按合并规则编码后恰为它自身的 token，因此直查不改变编码结果。
+     *       位图随 bbpe_save 写入二进制文件，加载该文件时自动启用且无需重新计算 (映射加载时与镜像共享)
+     */
+    BBPEStatus bbpe_set_whole_token_lookup(BBPETokenizer *tokenizer, int enable);
+
+    /**
+     * @brief 启用或关闭批量/并行编码的 NUMA 副本 (多路服务器上避免工作线程跨节点查表)
+     * @param tokenizer 分词器句柄
+     * @param enable 非 0 时读取节点拓扑；之后 bbpe_encode_batch 与 bbpe_encode_parallel 的工作线程按轮转绑定到各节点的 CPU，
+     *               并使用本节点的合并规则、单字节表与词级缓存副本 (由首个到达该节点的工作线程建立)。0 时释放全部副本
+     * @return BBPEStatus 状态码；未以 BBPE_ENABLE_NUMA 编译或非 Linux 平台返回 BBPE_ERR_UNSUPPORTED_TYPE，
+     *         以 BBPE_LOAD_DECODE_ONLY 加载时启用返回 BBPE_ERR_DECODE_ONLY
+     * @note 只有一个含 CPU 的节点时返回 BBPE_OK 但不做任何事。副本不改变编码结果；每个节点的词级缓存各自最多容纳
+     *       bbpe_set_cache 设置的条目数。工作线程结束时恢复原来的 CPU 亲和性 (调用线程也是工作线程之一)。
+     *       bbpe_set_cache 与 bbpe_set_merge_index 会丢弃已有副本，下次批量编码时重新建立
+     */
+    BBPEStatus bbpe_set_numa_replication(BBPETokenizer *tokenizer, int enable);
+
+    /**
+     * @brief 设置病态输入防护上限 (超长无空白文本、使正则大量回溯的文本)
+     * @param tokenizer 分词器句柄
+     * @param limits 新的上限，为 NULL 时恢复默认 (全部不限制)
+     * @return BBPEStatus 状态码
+     * @note 两种上限都不会使编码失败：超过 max_chunk_len 的块被切开后分别合并，结果可能与不切开时不同；
+     *       Split 的某次匹配达到 PCRE2 上限时，该段剩余文本整体作为一个块 (仍受 max_chunk_len 约束)。
+     *       内置分割器处理的标准模式为线性时间，不受 PCRE2 上限影响。上限不写入序列化文件
+     */
+    BBPEStatus bbpe_set_limits(BBPETokenizer *tokenizer, const BBPELimits *limits);
+
+    /**
+     * @brief 读取当前的病态输入防护上限
+     * @param tokenizer 分词器句柄
+     * @param out_limits 输出上限
+     * @return BBPEStatus 状态码
+     */
+    BBPEStatus bbpe_get_limits(BBPETokenizer *tokenizer, BBPELimits *out_limits);
+
+    /**
+     * @brief 统计分词器当前占用的内存
+     * @param tokenizer 分词器句柄
+     * @param out_usage 输出各部分的字节数
+     * @return BBPEStatus 状态码
+     * @note 词级缓存部分需读取缓存，会短暂持有缓存锁，可与编码并发调用。派生的分词器 (bbpe_derive) 只计入自己持有的部分，
+     *       共享的词汇表、规则行、规范化器与预分词器计入基础分词器
+     */
+    BBPEStatus bbpe_get_memory_usage(BBPETokenizer *tokenizer, BBPEMemoryUsage *out_usage);
+
+    /**
+     * @brief 读取自加载或上次重置以来累计的编码统计
+     * @param tokenizer 分词器句柄
+     * @param out_stats 输出统计
+     * @return BBPEStatus 状态码；未以 BBPE_ENABLE_STATS 编译时 *out_stats 清零并返回 BBPE_ERR_UNSUPPORTED_TYPE
+     * @note 每次编码调用结束时才计入，可与编码并发调用
+     */
+    BBPEStatus bbpe_get_stats(BBPETokenizer *tokenizer, BBPEStats *out_stats);
+
+    /**
+     * @brief 将编码统计清零
+     * @param tokenizer 分词器句柄
+     * @return BBPEStatus 状态码；未以 BBPE_ENABLE_STATS 编译时返回 BBPE_ERR_UNSUPPORTED_TYPE
+     */
+    BBPEStatus bbpe_reset_stats(BBPETokenizer *tokenizer);
+
     /**
      * @brief 释放分词结果内存
      * @param output 分词结果结构，ids 成员将被释放，结构本身不释放
      */
     void bbpe_free_output(BBPEOutput *output);
 
+    /**
+     * @brief 释放字节区间内存
+     * @param offsets 区间结构，start 与 end 成员将被释放，结构本身不释放
+     */
+    void bbpe_free_offsets(BBPEOffsets *offsets);
+
     /**
      * @brief 释放分词器资源
      * @param tokenizer 分词器句柄
+     * @note 与派生的分词器 (bbpe_derive) 共享的表在最后一个使用者释放时才释放，因此基础与派生的分词器可按任意顺序释放
      */
     void bbpe_destroy(BBPETokenizer *tokenizer);
 
@@ -83,9 +848,19 @@ extern "C"
      * @param tokenizer 分词器句柄
      * @param filename 文件名
      * @return BBPEStatus
+     * @note 写出 v3 格式，合并规则与内存中一样每条 8 字节；bbpe_load 仍可读取 v1 与 v2 文件
      */
     BBPEStatus bbpe_save(BBPETokenizer *tokenizer, const char *filename);
 
+    /**
+     * @brief 将分词器序列化到新分配的内存缓冲区 (内容与 bbpe_save 写出的文件相同)
+     * @param tokenizer 分词器句柄
+     * @param out_buffer 输出缓冲区指针，调用者需使用 free() 释放
+     * @param out_size 输出缓冲区字节数
+     * @return BBPEStatus
+     */
+    BBPEStatus bbpe_save_to_memory(BBPETokenizer *tokenizer, void **out_buffer, size_t *out_size);
+
     /**
      * @brief 从二进制文件加载分词器
      * @param filename 文件名
@@ -94,6 +869,68 @@ extern "C"
      */
     BBPEStatus bbpe_load(const char *filename, BBPETokenizer **out_tokenizer);
 
+    /**
+     * @brief 按加载标志从二进制文件加载分词器
+     * @param filename 文件名
+     * @param flags 0，或 BBPE_LOAD_LAZY_MERGES / BBPE_LOAD_DECODE_ONLY
+     * @param out_tokenizer 输出分词器句柄的指针
+     * @return BBPEStatus
+     * @note v3 文件的规则行本就直接引用映射，延迟构建省去的是正则解码与 JIT 编译；v1 文件还省去规则行的构建，
+     *       v2 文件的规则项加载时总是转换为 8 字节格式 (不推迟)
+     */
+    BBPEStatus bbpe_load_ex(const char *filename, uint32_t flags, BBPETokenizer **out_tokenizer);
+
+    /**
+     * @brief 同 bbpe_load_ex，但分词器的内存 (含未映射时的文件副本) 经 allocator 分配
+     * @param allocator 分配器 (为 NULL 时使用 malloc/free)，须在 bbpe_destroy 之前有效
+     */
+    BBPEStatus bbpe_load_alloc(const char *filename, uint32_t flags, const BBPEAllocator *allocator,
+                               BBPETokenizer **out_tokenizer);
+
+    /**
+     * @brief 从内存缓冲区加载分词器 (格式与 bbpe_load 读取的文件相同，例如嵌入资源或 bbpe_save_to_memory 的结果)
+     * @param buffer 序列化数据
+     * @param size 数据字节数
+     * @param flags BBPE_LOAD_COPY 或 BBPE_LOAD_BORROW，可再组合 BBPE_LOAD_LAZY_MERGES / BBPE_LOAD_DECODE_ONLY
+     * @param out_tokenizer 输出分词器句柄的指针
+     * @return BBPEStatus
+     * @note BBPE_LOAD_BORROW 仅对 8 字节对齐的 v2/v3 数据生效，分词器直接引用缓冲区中的词汇表与合并规则；
+     *       其余情况 (v1 数据、未对齐) 仍会复制，此时缓冲区在返回后即可释放
+     */
+    BBPEStatus bbpe_load_from_memory(const void *buffer, size_t size, uint32_t flags, BBPETokenizer **out_tokenizer);
+
+    /**
+     * @brief 同 bbpe_load_from_memory，但分词器的内存 (含 BBPE_LOAD_COPY 的缓冲区副本) 经 allocator 分配
+     * @param allocator 分配器 (为 NULL 时使用 malloc/free)，须在 bbpe_destroy 之前有效
+     */
+    BBPEStatus bbpe_load_from_memory_alloc(const void *buffer, size_t size, uint32_t flags,
+                                           const BBPEAllocator *allocator, BBPETokenizer **out_tokenizer);
+
+    /**
+     * @brief 从编译进程序的只读镜像创建分词器 (tools/gen_static_tokenizer.c 生成的数组)
+     * @param image 当前版本 (v3) 的镜像，须 8 字节对齐，且在 bbpe_destroy 之前保持有效且不被修改
+     * @param size 镜像字节数
+     * @param flags 0，或 BBPE_LOAD_LAZY_MERGES / BBPE_LOAD_DECODE_ONLY
+     * @param out_tokenizer 输出分词器句柄的指针
+     * @return BBPEStatus；镜像为旧版本或未对齐 (无法原地使用) 时返回 BBPE_ERR_INVALID_INPUT
+     * @note 同 bbpe_load_from_memory(..., BBPE_LOAD_BORROW, ...)，但保证不复制镜像：词汇表、合并规则与解码表
+     *       直接引用只读数据段，只解码很小的特殊 token、规范化器与预分词器段 (大端主机仍会转换为堆上副本)
+     */
+    BBPEStatus bbpe_from_static(const void *image, size_t size, uint32_t flags, BBPETokenizer **out_tokenizer);
+
+    /**
+     * @brief 由已加载的分词器派生一个只替换特殊 token 的分词器 (同一模型的多个 added_tokens 变体)
+     * @param base 基础分词器；本身是派生的分词器时改为共享其基础分词器的表
+     * @param json 变体的 tokenizer.json (只读取 added_tokens，其余键只跳过不解析)，或单独的 added_tokens 数组
+     * @param out_tokenizer 输出分词器句柄的指针
+     * @return BBPEStatus 状态码
+     * @note 词汇表、合并规则 (及合并规则哈希表)、规范化器与预分词器按引用计数与基础分词器共享，不复制；派生的分词器只持有
+     *       自己的特殊 token 表与前缀树、id 索引和解码表 (新增的 ID 超出基础词表时另有一份规则行起点)。调用者须保证变体的
+     *       model、normalizer 与 pre_tokenizer 与基础分词器相同。词级缓存容量、上限、合并规则索引、整词直查与前缀索引的设置
+     *       从 base 继承，之后各自独立；词级缓存与 NUMA 副本不共享
+     */
+    BBPEStatus bbpe_derive(BBPETokenizer *base, const char *json, BBPETokenizer **out_tokenizer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,504 @@
+/**
+ * @file bbpe_tokenizer.hpp
+ * @brief bbpe_tokenizer.h 的 C++20 头文件封装：RAII 管理句柄与输出，std::string_view 输入、std::span 输出
+ *
+ * 只依赖 C 接口，无需额外编译单元；失败的调用抛出 bbpe::Error (携带 BBPEStatus)。
+ * 返回 std::span 的接口直接指向可复用缓冲区，不复制 ID；下一次写入同一缓冲区之前有效。
+ */
+#ifndef BBPE_TOKENIZER_HPP
+#define BBPE_TOKENIZER_HPP
+
+#if __cplusplus < 202002L && !(defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#error "bbpe_tokenizer.hpp requires C++20 (std::span)"
+#endif
+
+#include "bbpe_tokenizer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace bbpe
+{
+    /**
+     * @brief C 接口返回非 BBPE_OK 时抛出的异常
+     */
+    class Error : public std::runtime_error
+    {
+    public:
+        explicit Error(BBPEStatus status)
+            : std::runtime_error("bbpe: " + std::string(name(status))), status_(status) {}
+
+        BBPEStatus status() const noexcept { return status_; }
+
+        /**
+         * @brief 状态码名称 (与 bbpe_tokenizer.h 中的枚举名相同)
+         */
+        static const char *name(BBPEStatus status) noexcept
+        {
+            switch (status)
+            {
+            case BBPE_OK: return "BBPE_OK";
+            case BBPE_ERR_MEMORY: return "BBPE_ERR_MEMORY";
+            case BBPE_ERR_JSON_PARSE: return "BBPE_ERR_JSON_PARSE";
+            case BBPE_ERR_VOCAB_MISSING: return "BBPE_ERR_VOCAB_MISSING";
+            case BBPE_ERR_REGEX_COMPILE: return "BBPE_ERR_REGEX_COMPILE";
+            case BBPE_ERR_TOKEN_NOT_FOUND: return "BBPE_ERR_TOKEN_NOT_FOUND";
+            case BBPE_ERR_INVALID_INPUT: return "BBPE_ERR_INVALID_INPUT";
+            case BBPE_ERR_UNSUPPORTED_TYPE: return "BBPE_ERR_UNSUPPORTED_TYPE";
+            case BBPE_ERR_FILE_IO: return "BBPE_ERR_FILE_IO";
+            case BBPE_ERR_BUFFER_TOO_SMALL: return "BBPE_ERR_BUFFER_TOO_SMALL";
+            case BBPE_ERR_DECODE_ONLY: return "BBPE_ERR_DECODE_ONLY";
+            case BBPE_ERR_CANCELLED: return "BBPE_ERR_CANCELLED";
+            }
+            return "unknown status";
+        }
+
+    private:
+        BBPEStatus status_;
+    };
+
+    /**
+     * @brief 状态码不为 BBPE_OK 时抛出 Error
+     */
+    inline void check(BBPEStatus status)
+    {
+        if (status != BBPE_OK)
+            throw Error(status);
+    }
+
+    /**
+     * @brief 编码工作区 (BBPEWorkspace 的只可移动封装)，每个线程各用一个
+     */
+    class Workspace
+    {
+    public:
+        Workspace() { check(bbpe_workspace_create(&ws_)); }
+        explicit Workspace(const BBPEAllocator &allocator) { check(bbpe_workspace_create_alloc(&allocator, &ws_)); }
+        Workspace(Workspace &&other) noexcept : ws_(std::exchange(other.ws_, nullptr)) {}
+        Workspace &operator=(Workspace &&other) noexcept
+        {
+            std::swap(ws_, other.ws_);
+            return *this;
+        }
+        Workspace(const Workspace &) = delete;
+        Workspace &operator=(const Workspace &) = delete;
+        ~Workspace() { bbpe_workspace_destroy(ws_); }
+
+        BBPEWorkspace *get() const noexcept { return ws_; }
+
+    private:
+        BBPEWorkspace *ws_ = nullptr;
+    };
+
+    /**
+     * @brief 可复用的 ID 缓冲区 (BBPEOutput 的只可移动封装)，每次编码覆盖内容并保留容量
+     */
+    class TokenBuffer
+    {
+    public:
+        TokenBuffer() noexcept = default;
+        TokenBuffer(TokenBuffer &&other) noexcept : out_(std::exchange(other.out_, BBPEOutput{})) {}
+        TokenBuffer &operator=(TokenBuffer &&other) noexcept
+        {
+            std::swap(out_, other.out_);
+            return *this;
+        }
+        TokenBuffer(const TokenBuffer &) = delete;
+        TokenBuffer &operator=(const TokenBuffer &) = delete;
+        ~TokenBuffer() { bbpe_free_output(&out_); }
+
+        std::span<const int32_t> ids() const noexcept { return {out_.ids, out_.count}; }
+        size_t size() const noexcept { return out_.count; }
+        size_t capacity() const noexcept { return out_.capacity; }
+
+        /**
+         * @brief 底层结构，可直接传给 bbpe_encode_reuse 系列接口
+         */
+        BBPEOutput *get() noexcept { return &out_; }
+
+    private:
+        BBPEOutput out_{};
+    };
+
+    /**
+     * @brief bbpe_encode_batch 的结果：每个文档一个 ID 序列，重复使用时先释放上一批
+     */
+    class BatchOutput
+    {
+    public:
+        BatchOutput() = default;
+        BatchOutput(BatchOutput &&) noexcept = default;
+        BatchOutput &operator=(BatchOutput &&other) noexcept
+        {
+            std::swap(outputs_, other.outputs_);
+            return *this;
+        }
+        BatchOutput(const BatchOutput &) = delete;
+        BatchOutput &operator=(const BatchOutput &) = delete;
+        ~BatchOutput() { clear(); }
+
+        size_t size() const noexcept { return outputs_.size(); }
+        std::span<const int32_t> operator[](size_t i) const noexcept { return {outputs_[i].ids, outputs_[i].count}; }
+
+        void clear() noexcept
+        {
+            for (BBPEOutput &out : outputs_)
+                bbpe_free_output(&out);
+            outputs_.clear();
+        }
+
+    private:
+        friend class Tokenizer;
+        std::vector<BBPEOutput> outputs_;
+    };
+
+    /**
+     * @brief 分词器 (BBPETokenizer 的只可移动封装)
+     * @note 带调用者缓冲区 / 工作区参数的 const 成员只读取句柄，可由多个线程同时调用；
+     *       encode(text) 与 decode(ids) 等使用对象内置的缓冲区与工作区，同一对象同一时刻只能被一个线程调用
+     */
+    class Tokenizer
+    {
+    public:
+        /**
+         * @brief 接管已有句柄 (析构时调用 bbpe_destroy)
+         */
+        explicit Tokenizer(BBPETokenizer *handle) noexcept : tok_(handle) {}
+
+        /**
+         * @brief 从 tokenizer.json 的内容创建 (同 bbpe_init_alloc)
+         * @param allocator 为 NULL 时使用 malloc/free，须在分词器销毁之前有效
+         */
+        static Tokenizer from_json(const std::string &json, uint32_t flags = 0,
+                                   const BBPEAllocator *allocator = nullptr)
+        {
+            BBPETokenizer *tok = nullptr;
+            check(bbpe_init_alloc(json.c_str(), flags, allocator, &tok));
+            return Tokenizer(tok);
+        }
+
+        /**
+         * @brief 从 bbpe_save 写出的文件加载 (同 bbpe_load_alloc)
+         */
+        static Tokenizer load(const std::string &path, uint32_t flags = 0, const BBPEAllocator *allocator = nullptr)
+        {
+            BBPETokenizer *tok = nullptr;
+            check(bbpe_load_alloc(path.c_str(), flags, allocator, &tok));
+            return Tokenizer(tok);
+        }
+
+        /**
+         * @brief 从内存中的镜像加载 (同 bbpe_load_from_memory_alloc；BBPE_LOAD_BORROW 时 data 须比分词器活得久)
+         */
+        static Tokenizer load_from_memory(std::span<const std::byte> data, uint32_t flags = BBPE_LOAD_COPY,
+                                          const BBPEAllocator *allocator = nullptr)
+        {
+            BBPETokenizer *tok = nullptr;
+            check(bbpe_load_from_memory_alloc(data.data(), data.size(), flags, allocator, &tok));
+            return Tokenizer(tok);
+        }
+
+        /**
+         * @brief 派生一个共享本分词器词汇表与合并规则、只替换特殊 token 的分词器 (同 bbpe_derive)
+         * @param json 变体的 tokenizer.json 或 added_tokens 数组；两者可按任意顺序销毁
+         */
+        Tokenizer derive(const std::string &json) const
+        {
+            BBPETokenizer *tok = nullptr;
+            check(bbpe_derive(tok_, json.c_str(), &tok));
+            return Tokenizer(tok);
+        }
+
+        Tokenizer(Tokenizer &&other) noexcept
+            : tok_(std::exchange(other.tok_, nullptr)), buffer_(std::move(other.buffer_)),
+              ws_(std::move(other.ws_)), text_(std::move(other.text_))
+        {
+        }
+        Tokenizer &operator=(Tokenizer &&other) noexcept
+        {
+            std::swap(tok_, other.tok_);
+            std::swap(buffer_, other.buffer_);
+            std::swap(ws_, other.ws_);
+            std::swap(text_, other.text_);
+            return *this;
+        }
+        Tokenizer(const Tokenizer &) = delete;
+        Tokenizer &operator=(const Tokenizer &) = delete;
+        ~Tokenizer() { bbpe_destroy(tok_); }
+
+        BBPETokenizer *get() const noexcept { return tok_; }
+
+        /**
+         * @brief 放弃所有权并返回句柄 (之后由调用者负责 bbpe_destroy)
+         */
+        BBPETokenizer *release() noexcept { return std::exchange(tok_, nullptr); }
+
+        // ---------- 编码 ----------
+
+        /**
+         * @brief 编码到调用者的缓冲区 (同 bbpe_encode_reuse_ws)，返回的 span 指向 out
+         * @param ws 为 NULL 时使用本次调用内的临时工作区
+         */
+        std::span<const int32_t> encode(std::string_view text, TokenBuffer &out, Workspace *ws = nullptr) const
+        {
+            check(bbpe_encode_reuse_ws(tok_, ws ? ws->get() : nullptr, text.data(), text.size(), out.get()));
+            return out.ids();
+        }
+
+        /**
+         * @brief 编码到对象内置的缓冲区，返回的 span 在下一次 encode(text) 之前有效
+         */
+        std::span<const int32_t> encode(std::string_view text) { return encode(text, buffer_, &workspace()); }
+
+        /**
+         * @brief 编码到 std::vector (容量足够时不分配，同 bbpe_encode_into_ws)
+         */
+        void encode_to(std::string_view text, std::vector<int32_t> &ids, Workspace *ws = nullptr) const
+        {
+            size_t count = 0;
+            ids.resize(ids.capacity());
+            BBPEStatus status = bbpe_encode_into_ws(tok_, ws ? ws->get() : nullptr, text.data(), text.size(),
+                                                    ids.data(), ids.size(), &count);
+            if (status == BBPE_ERR_BUFFER_TOO_SMALL)
+            {
+                ids.resize(count);
+                status = bbpe_encode_into_ws(tok_, ws ? ws->get() : nullptr, text.data(), text.size(),
+                                             ids.data(), ids.size(), &count);
+            }
+            ids.resize(status == BBPE_OK ? count : 0);
+            check(status);
+        }
+
+        /**
+         * @brief 只统计 token 数 (同 bbpe_count_tokens_ws)
+         */
+        size_t count(std::string_view text, Workspace *ws = nullptr) const
+        {
+            size_t n = 0;
+            check(bbpe_count_tokens_ws(tok_, ws ? ws->get() : nullptr, text.data(), text.size(), &n));
+            return n;
+        }
+
+        /**
+         * @brief 批量编码 (同 bbpe_encode_batch)，out 中原有的结果先被释放
+         * @param num_threads 线程数 (含调用线程)，<= 0 表示使用全部逻辑处理器
+         */
+        void encode_batch(std::span<const std::string_view> texts, BatchOutput &out, int num_threads = 0) const
+        {
+            std::vector<const char *> ptrs(texts.size());
+            std::vector<size_t> lens(texts.size());
+            for (size_t i = 0; i < texts.size(); i++)
+            {
+                ptrs[i] = texts[i].data();
+                lens[i] = texts[i].size();
+            }
+            out.clear();
+            out.outputs_.resize(texts.size());
+            BBPEStatus status = bbpe_encode_batch(tok_, ptrs.data(), lens.data(), texts.size(),
+                                                  out.outputs_.data(), num_threads);
+            if (status != BBPE_OK)
+                out.outputs_.clear(); // 失败时 C 接口已释放全部输出
+            check(status);
+        }
+
+        // ---------- 异步编码 ----------
+
+        /**
+         * @brief 启动异步编码线程池 (同 bbpe_async_start)
+         */
+        void async_start(int num_threads = 0, uint32_t flags = 0) { check(bbpe_async_start(tok_, num_threads, flags)); }
+
+        /**
+         * @brief 停止线程池，全部未完成的请求以 BBPE_ERR_CANCELLED 回调 (同 bbpe_async_stop，析构时自动调用)
+         */
+        void async_stop() noexcept { bbpe_async_stop(tok_); }
+
+        /**
+         * @brief 提交异步编码 (同 bbpe_encode_async)，返回请求号
+         * @param fn 以 (request, status, ids) 调用恰好一次，ids 只在调用期间有效；fn 被移入请求中保存，不得抛出异常
+         * @note text 指向的内容在回调运行之前须保持有效
+         */
+        template <typename F>
+        uint64_t encode_async(std::string_view text, F fn) const
+        {
+            auto state = std::make_unique<F>(std::move(fn));
+            uint64_t request = 0;
+            check(bbpe_encode_async(tok_, text.data(), text.size(), &async_trampoline<F>, state.get(), &request));
+            state.release(); // 由回调释放
+            return request;
+        }
+
+        /**
+         * @brief 取消请求 (同 bbpe_async_cancel)，请求已完成或不存在时返回 false
+         */
+        bool async_cancel(uint64_t request) const noexcept { return bbpe_async_cancel(tok_, request) == BBPE_OK; }
+
+        /**
+         * @brief 完成通知描述符 (同 bbpe_async_fd)，仅 BBPE_ASYNC_DEFERRED 模式下有效
+         */
+        int async_fd() const noexcept { return bbpe_async_fd(tok_); }
+
+        /**
+         * @brief 运行待分发结果的回调 (同 bbpe_async_dispatch)，返回运行的回调数
+         */
+        size_t async_dispatch() const noexcept { return bbpe_async_dispatch(tok_); }
+
+        // ---------- 解码 ----------
+
+        /**
+         * @brief 解码到 text (覆盖原内容，容量足够时不分配)
+         */
+        void decode_to(std::span<const int32_t> ids, std::string &text) const
+        {
+            size_t len = 0;
+            BBPEStatus status = bbpe_decoded_length(tok_, ids.data(), ids.size(), &len);
+            if (status == BBPE_OK)
+            {
+                // 结尾 '\0' 写入 std::string 自带的终止符位置
+                text.resize(len);
+                status = bbpe_decode_into(tok_, ids.data(), ids.size(), text.data(), len + 1, &len);
+            }
+            if (status != BBPE_OK)
+                text.clear();
+            check(status);
+        }
+
+        /**
+         * @brief 解码到对象内置的字符串，返回的视图在下一次 decode(ids) 之前有效
+         */
+        std::string_view decode(std::span<const int32_t> ids)
+        {
+            decode_to(ids, text_);
+            return text_;
+        }
+
+        /**
+         * @brief 批量解码 (同 bbpe_decode_batch_into)：第 i 个序列为 ids[id_offsets[i], id_offsets[i+1])，
+         *        其文本为 text[text_offsets[i], text_offsets[i+1])
+         * @param id_offsets 序列数 + 1 项
+         * @param text 输出全部文本 (序列之间没有分隔符)，容量足够时不分配
+         * @param text_offsets 输出 id_offsets.size() 项偏移
+         */
+        void decode_batch_to(std::span<const int32_t> ids, std::span<const size_t> id_offsets, std::string &text,
+                             std::vector<size_t> &text_offsets, int num_threads = 0) const
+        {
+            if (id_offsets.empty())
+                check(BBPE_ERR_INVALID_INPUT);
+            size_t n = id_offsets.size() - 1;
+            text_offsets.resize(n + 1);
+            text.resize(text.capacity());
+            BBPEStatus status = bbpe_decode_batch_into(tok_, ids.data(), id_offsets.data(), n, text.data(),
+                                                       text.size(), text_offsets.data(), num_threads);
+            if (status == BBPE_ERR_BUFFER_TOO_SMALL)
+            {
+                text.resize(text_offsets[n]);
+                status = bbpe_decode_batch_into(tok_, ids.data(), id_offsets.data(), n, text.data(), text.size(),
+                                                text_offsets.data(), num_threads);
+            }
+            text.resize(status == BBPE_OK ? text_offsets[n] : 0);
+            check(status);
+        }
+
+        // ---------- 词表查询 ----------
+
+        /**
+         * @brief token 字符串 (词汇表中的写法) 对应的 ID，不存在时返回 std::nullopt
+         */
+        std::optional<int32_t> token_to_id(std::string_view token) const
+        {
+            int32_t id = -1;
+            BBPEStatus status = bbpe_token_to_id(tok_, token.data(), token.size(), &id);
+            if (status == BBPE_ERR_TOKEN_NOT_FOUND)
+                return std::nullopt;
+            check(status);
+            return id;
+        }
+
+        /**
+         * @brief ID 对应的 token 字符串，视图指向分词器内部，在分词器销毁之前有效
+         */
+        std::string_view id_to_token(int32_t id) const
+        {
+            const char *token = nullptr;
+            size_t len = 0;
+            check(bbpe_id_to_token(tok_, id, &token, &len));
+            return {token, len};
+        }
+
+        /**
+         * @brief ID 解码后的原始字节，视图指向分词器内部，在分词器销毁之前有效
+         */
+        std::string_view id_to_bytes(int32_t id) const
+        {
+            const char *bytes = nullptr;
+            size_t len = 0;
+            check(bbpe_id_to_bytes(tok_, id, &bytes, &len));
+            return {bytes, len};
+        }
+
+        /**
+         * @brief 全部 token 解码后的字节表 (同 bbpe_get_decoded_vocab)：ID i 为 bytes[offsets[i], offsets[i+1])
+         * @return {bytes, offsets}，offsets 共 最大 ID + 2 项，均指向分词器内部
+         */
+        std::pair<std::string_view, std::span<const uint32_t>> decoded_vocab() const
+        {
+            const char *bytes = nullptr;
+            const uint32_t *offsets = nullptr;
+            size_t n = 0;
+            check(bbpe_get_decoded_vocab(tok_, &bytes, &offsets, &n));
+            return {std::string_view(bytes, offsets[n]), std::span<const uint32_t>(offsets, n + 1)};
+        }
+
+        /**
+         * @brief 解码字节以 prefix 开头的全部 token (同 bbpe_prefix_tokens，需先以 bbpe_set_prefix_index 启用索引)
+         */
+        std::span<const int32_t> prefix_tokens(std::string_view prefix) const
+        {
+            const int32_t *ids = nullptr;
+            size_t n = 0;
+            check(bbpe_prefix_tokens(tok_, prefix.data(), prefix.size(), &ids, &n));
+            return {ids, n};
+        }
+
+        /**
+         * @brief 把与 bytes 相容的 token 在 mask 中置位 (同 bbpe_prefix_mask，mask 至少 (最大 ID + 32) / 32 个字)
+         */
+        void prefix_mask(std::string_view bytes, uint32_t match, std::span<uint32_t> mask) const
+        {
+            check(bbpe_prefix_mask(tok_, bytes.data(), bytes.size(), match, mask.data()));
+        }
+
+    private:
+        template <typename F>
+        static void async_trampoline(uint64_t request, BBPEStatus status, BBPEOutput *output, void *user_data)
+        {
+            std::unique_ptr<F> fn(static_cast<F *>(user_data));
+            (*fn)(request, status, std::span<const int32_t>(output->ids, output->count));
+            bbpe_free_output(output);
+        }
+
+        // 内置工作区在首次 encode(text) 时创建
+        Workspace &workspace()
+        {
+            if (!ws_)
+                ws_.emplace();
+            return *ws_;
+        }
+
+        BBPETokenizer *tok_ = nullptr;
+        TokenBuffer buffer_;
+        std::optional<Workspace> ws_;
+        std::string text_;
+    };
+} // namespace bbpe
+
+#endif // BBPE_TOKENIZER_HPP
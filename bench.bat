@@ -0,0 +1,6 @@
+@echo off
+setlocal enabledelayedexpansion
+gcc -O2 -DHAVE_CONFIG_H -DPCRE2_CODE_UNIT_WIDTH=8 -DPCRE2_STATIC -DSUPPORT_JIT -DBENCH_COUNT_ALLOCS -Ithirdparty/cJSON -Ithirdparty/uthash -Ithirdparty/pcre2 -I. -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc -o bench.exe bbpe_tokenizer.c bench.c thirdparty/cJSON/*.c thirdparty/pcre2/*.c -lpsapi
+bench qwen3-tokenizer.json %* > bench_output.txt
+type bench_output.txt
+pause
\ No newline at end of file
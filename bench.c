@@ -0,0 +1,587 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bbpe_tokenizer.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <time.h>
+#include <sys/resource.h>
+#endif
+
+// 性能基准程序：测量 bbpe_init / bbpe_load 以及各语料上的编码、解码
+// 用法: bench tokenizer.json [-b tokenizer.bin] [-r 重复次数] [-d] [-w] [语料文件 ...]
+//   未指定语料文件时使用内置生成的语料 (英文、中日韩、代码、emoji、长文档)
+//   语料文件默认每行一个文档 (一次调用)，-d 表示每个文件整体作为一个文档
+//   -w 表示编码前启用整词直查 (bbpe_set_whole_token_lookup)，并报告计算稳定 token 位图的耗时
+// 以 -DBENCH_COUNT_ALLOCS 编译并链接 -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc 时统计每次调用的分配次数
+
+static const char *SAVE_FILE = "bench_saved.bin";
+
+// ---------- 分配计数 ----------
+#ifdef BENCH_COUNT_ALLOCS
+static size_t alloc_count = 0;
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t size);
+void *__wrap_malloc(size_t size)
+{
+  alloc_count++;
+  return __real_malloc(size);
+}
+void *__wrap_calloc(size_t n, size_t size)
+{
+  alloc_count++;
+  return __real_calloc(n, size);
+}
+void *__wrap_realloc(void *p, size_t size)
+{
+  alloc_count++;
+  return __real_realloc(p, size);
+}
+#define ALLOCS() alloc_count
+#else
+#define ALLOCS() ((size_t)0)
+#endif
+
+// ---------- 计时与内存 ----------
+static double now_seconds(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER freq, counter;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&counter);
+  return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+// 进程启动以来的峰值常驻内存 (MB)
+static double peak_rss_mb(void)
+{
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS pmc;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+    return 0;
+  return pmc.PeakWorkingSetSize / (1024.0 * 1024.0);
+#else
+  struct rusage ru;
+  if (getrusage(RUSAGE_SELF, &ru) != 0)
+    return 0;
+#ifdef __APPLE__
+  return ru.ru_maxrss / (1024.0 * 1024.0); // macOS 以字节为单位
+#else
+  return ru.ru_maxrss / 1024.0; // Linux 以 KB 为单位
+#endif
+#endif
+}
+
+static int compare_double(const void *a, const void *b)
+{
+  double x = *(const double *)a, y = *(const double *)b;
+  return x < y ? -1 : x > y;
+}
+
+// 对 samples 排序后取百分位 (p 取 0~100)
+static double percentile(double *samples, size_t n, double p)
+{
+  if (n == 0)
+    return 0;
+  qsort(samples, n, sizeof(double), compare_double);
+  size_t idx = (size_t)(p / 100.0 * (n - 1) + 0.5);
+  return samples[idx];
+}
+
+// ---------- 语料 ----------
+typedef struct
+{
+  char *data;
+  size_t len;
+  size_t cap;
+} StrBuf;
+
+static void sb_append(StrBuf *sb, const char *s, size_t n)
+{
+  if (sb->len + n + 1 > sb->cap)
+  {
+    size_t cap = sb->cap ? sb->cap : 256;
+    while (cap < sb->len + n + 1)
+      cap *= 2;
+    char *data = (char *)realloc(sb->data, cap);
+    if (!data)
+    {
+      fprintf(stderr, "Memory allocation failed\n");
+      exit(1);
+    }
+    sb->data = data;
+    sb->cap = cap;
+  }
+  memcpy(sb->data + sb->len, s, n);
+  sb->len += n;
+  sb->data[sb->len] = '\0';
+}
+
+static void sb_puts(StrBuf *sb, const char *s)
+{
+  sb_append(sb, s, strlen(s));
+}
+
+typedef struct
+{
+  char name[64];
+  char **docs;  // 每个文档以 '\0' 结尾
+  size_t *lens; // 各文档字节数
+  size_t count;
+  size_t cap;
+  size_t bytes; // 全部文档的总字节数
+} Corpus;
+
+static void corpus_add(Corpus *c, const char *text, size_t len)
+{
+  if (c->count == c->cap)
+  {
+    c->cap = c->cap ? c->cap * 2 : 64;
+    c->docs = (char **)realloc(c->docs, c->cap * sizeof(char *));
+    c->lens = (size_t *)realloc(c->lens, c->cap * sizeof(size_t));
+    if (!c->docs || !c->lens)
+    {
+      fprintf(stderr, "Memory allocation failed\n");
+      exit(1);
+    }
+  }
+  char *doc = (char *)malloc(len + 1);
+  if (!doc)
+  {
+    fprintf(stderr, "Memory allocation failed\n");
+    exit(1);
+  }
+  memcpy(doc, text, len);
+  doc[len] = '\0';
+  c->docs[c->count] = doc;
+  c->lens[c->count] = len;
+  c->count++;
+  c->bytes += len;
+}
+
+static void corpus_free(Corpus *c)
+{
+  for (size_t i = 0; i < c->count; i++)
+    free(c->docs[i]);
+  free(c->docs);
+  free(c->lens);
+}
+
+// 固定种子的伪随机数，保证每次运行的内置语料相同
+static uint32_t rng_state = 2463534242u;
+static uint32_t rng_next(void)
+{
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+#define PICK(arr) (arr[rng_next() % (sizeof(arr) / sizeof(arr[0]))])
+
+static const char *EN_WORDS[] = {
+    "the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was", "with", "be", "by", "on",
+    "not", "this", "are", "from", "at", "which", "have", "an", "they", "you", "were", "their", "has",
+    "would", "when", "there", "people", "first", "language", "model", "tokenizer", "performance",
+    "research", "government", "international", "understanding", "however", "between", "different",
+    "experience", "development", "history", "because", "through", "information", "don't", "it's",
+    "we've", "they'll", "company's", "2024", "3.14", "1,000", "U.S.", "e-mail", "well-known"};
+static const char *EN_PUNCT[] = {" ", " ", " ", " ", " ", " ", ", ", "; ", " (", ") ", " \"", "\" ", " - "};
+
+static const char *CJK_PIECES[] = {
+    "的", "一", "是", "在", "不", "了", "有", "和", "人", "这", "中", "大", "为", "上", "个", "国",
+    "我", "以", "要", "他", "时", "来", "用", "们", "生", "到", "作", "地", "于", "出", "就", "分",
+    "对", "成", "会", "可", "主", "发", "年", "动", "同", "工", "也", "能", "下", "过", "子", "说",
+    "分词器", "性能", "模型", "语言", "数据", "测试", "北京", "上海", "人工智能", "计算机",
+    "これは", "テスト", "です", "東京", "私たち", "ありがとう", "ございます", "日本語",
+    "안녕하세요", "감사합니다", "한국어", "，", "。", "、", "！", "？", "「", "」", "123", "ABC"};
+
+static const char *CODE_LINES[] = {
+    "#include <stdio.h>\n",
+    "static int parse_header(const uint8_t *data, size_t size, Header *out)\n",
+    "{\n",
+    "}\n",
+    "    for (size_t i = 0; i < count; i++) {\n",
+    "        if (items[i].id < 0 || items[i].id >= vocab_size)\n",
+    "            return ERR_INVALID_INPUT;\n",
+    "    memcpy(dst + offset, src, len * sizeof(int32_t));\n",
+    "def process_batch(items, *, limit=None):\n",
+    "    \"\"\"Return the non-empty values keyed by name.\"\"\"\n",
+    "    return {k: v for k, v in items.items() if v is not None}\n",
+    "class TokenCache(dict):\n",
+    "        self._hits += 1  # cache hit\n",
+    "const express = require('express');\n",
+    "app.get('/api/v1/users/:id', async (req, res) => {\n",
+    "  res.json({ ok: true, user: await db.find(req.params.id) });\n",
+    "func (s *Server) Handle(w http.ResponseWriter, r *http.Request) error {\n",
+    "\tif err != nil {\n\t\treturn fmt.Errorf(\"decode: %w\", err)\n\t}\n",
+    "SELECT id, name, created_at FROM users WHERE status = 'active' ORDER BY id;\n",
+    "    // TODO(perf): avoid the second pass over the buffer\n",
+    "\n"};
+
+static const char *EMOJI_PIECES[] = {
+    "😀", "😂", "🚀", "🎉", "❤️", "👍", "👍🏽", "👨‍👩‍👧‍👦", "🏳️‍🌈", "🦙", "😶‍🌫️", "🇨🇳", "🇺🇸",
+    "🔥", "✅", "✨", "🙏🏻", "💯", "🤖", " ", " ", " ", "lol", "wow", "ok", "so good", "!!!", "？", "哈哈"};
+
+static void build_builtin_corpora(Corpus *corpora, size_t *n)
+{
+  StrBuf sb = {0};
+  Corpus *en = &corpora[0], *cjk = &corpora[1], *code = &corpora[2], *emoji = &corpora[3], *lng = &corpora[4];
+  memset(corpora, 0, 5 * sizeof(Corpus));
+  strcpy(en->name, "english");
+  strcpy(cjk->name, "cjk");
+  strcpy(code->name, "code");
+  strcpy(emoji->name, "emoji");
+  strcpy(lng->name, "long");
+
+  for (int d = 0; d < 2000; d++)
+  {
+    // 英文：数个句子，每句首字母大写
+    sb.len = 0;
+    int sentences = 1 + rng_next() % 6;
+    for (int s = 0; s < sentences; s++)
+    {
+      int words = 4 + rng_next() % 16;
+      for (int w = 0; w < words; w++)
+      {
+        const char *word = PICK(EN_WORDS);
+        if (w == 0)
+        {
+          char cap[2] = {(char)(word[0] >= 'a' && word[0] <= 'z' ? word[0] - 32 : word[0]), 0};
+          sb_puts(&sb, cap);
+          sb_puts(&sb, word + 1);
+        }
+        else
+          sb_puts(&sb, word);
+        sb_puts(&sb, w + 1 < words ? PICK(EN_PUNCT) : (rng_next() % 4 ? ". " : "? "));
+      }
+    }
+    corpus_add(en, sb.data, sb.len);
+
+    // 中日韩混合文本
+    sb.len = 0;
+    int pieces = 20 + rng_next() % 120;
+    for (int p = 0; p < pieces; p++)
+      sb_puts(&sb, PICK(CJK_PIECES));
+    corpus_add(cjk, sb.data, sb.len);
+
+    // 多种语言的代码片段
+    sb.len = 0;
+    int lines = 5 + rng_next() % 30;
+    for (int l = 0; l < lines; l++)
+      sb_puts(&sb, PICK(CODE_LINES));
+    corpus_add(code, sb.data, sb.len);
+
+    // emoji 密集的短消息 (含 ZWJ 序列与肤色修饰)
+    sb.len = 0;
+    pieces = 5 + rng_next() % 40;
+    for (int p = 0; p < pieces; p++)
+      sb_puts(&sb, PICK(EMOJI_PIECES));
+    corpus_add(emoji, sb.data, sb.len);
+  }
+
+  // 长文档：轮流拼接上述语料直到约 1 MiB
+  sb.len = 0;
+  for (size_t i = 0; sb.len < (1u << 20); i++)
+  {
+    Corpus *src = &corpora[i % 4];
+    sb_append(&sb, src->docs[(i / 4) % src->count], src->lens[(i / 4) % src->count]);
+    sb_puts(&sb, "\n\n");
+  }
+  corpus_add(lng, sb.data, sb.len);
+  free(sb.data);
+  *n = 5;
+}
+
+static char *read_file(const char *path, size_t *out_len)
+{
+  FILE *fp = fopen(path, "rb");
+  if (!fp)
+    return NULL;
+  fseek(fp, 0, SEEK_END);
+  long fsize = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  char *buf = fsize >= 0 ? (char *)malloc((size_t)fsize + 1) : NULL;
+  if (!buf || fread(buf, 1, (size_t)fsize, fp) != (size_t)fsize)
+  {
+    free(buf);
+    fclose(fp);
+    return NULL;
+  }
+  fclose(fp);
+  buf[fsize] = '\0';
+  *out_len = (size_t)fsize;
+  return buf;
+}
+
+static int load_corpus_file(Corpus *c, const char *path, int whole)
+{
+  size_t len;
+  char *text = read_file(path, &len);
+  if (!text)
+    return 0;
+  memset(c, 0, sizeof(*c));
+  const char *base = strrchr(path, '/');
+  const char *base2 = strrchr(path, '\\');
+  if (base2 > base)
+    base = base2;
+  snprintf(c->name, sizeof(c->name), "%s", base ? base + 1 : path);
+  if (whole)
+    corpus_add(c, text, len);
+  else
+  {
+    size_t start = 0;
+    for (size_t i = 0; i <= len; i++)
+    {
+      if (i == len || text[i] == '\n')
+      {
+        if (i > start)
+          corpus_add(c, text + start, i - start);
+        start = i + 1;
+      }
+    }
+  }
+  free(text);
+  return c->count > 0;
+}
+
+// ---------- 报告 ----------
+static void print_header(void)
+{
+  printf("%-8s %-14s %8s %12s %9s %10s %10s %11s\n", "phase", "corpus", "calls", "tokens/s", "MB/s",
+         "p50(us)", "p99(us)", "allocs/call");
+}
+
+static void print_row(const char *phase, const char *corpus, double *latencies, size_t calls, double seconds,
+                      size_t tokens, size_t bytes, size_t allocs)
+{
+  double p50 = percentile(latencies, calls, 50) * 1e6;
+  double p99 = percentile(latencies, calls, 99) * 1e6;
+  printf("%-8s %-14s %8zu %12.0f %9.2f %10.1f %10.1f ", phase, corpus, calls, tokens / seconds,
+         bytes / seconds / 1e6, p50, p99);
+#ifdef BENCH_COUNT_ALLOCS
+  printf("%11.2f\n", (double)allocs / calls);
+#else
+  (void)allocs;
+  printf("%11s\n", "n/a");
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+  const char *json_path = NULL;
+  const char *bin_path = NULL;
+  int repeats = 3;
+  int whole_docs = 0;
+  int whole_tokens = 0;
+  const char **corpus_paths = (const char **)calloc(argc, sizeof(char *));
+  int corpus_path_count = 0;
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+      bin_path = argv[++i];
+    else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+      repeats = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-d") == 0)
+      whole_docs = 1;
+    else if (strcmp(argv[i], "-w") == 0)
+      whole_tokens = 1;
+    else if (!json_path)
+      json_path = argv[i];
+    else
+      corpus_paths[corpus_path_count++] = argv[i];
+  }
+  if (!json_path || repeats <= 0)
+  {
+    fprintf(stderr, "Usage: %s tokenizer.json [-b tokenizer.bin] [-r repeats] [-d] [-w] [corpus.txt ...]\n", argv[0]);
+    free(corpus_paths);
+    return 1;
+  }
+
+  size_t json_len;
+  char *json_content = read_file(json_path, &json_len);
+  if (!json_content)
+  {
+    fprintf(stderr, "Failed to read %s\n", json_path);
+    free(corpus_paths);
+    return 1;
+  }
+
+  double *samples = (double *)malloc(sizeof(double) * (size_t)repeats);
+  BBPETokenizer *tokenizer = NULL;
+  BBPEStatus status;
+  size_t allocs;
+
+  // ---------- bbpe_init ----------
+  allocs = ALLOCS();
+  for (int r = 0; r < repeats; r++)
+  {
+    double t0 = now_seconds();
+    status = bbpe_init(json_content, &tokenizer);
+    samples[r] = now_seconds() - t0;
+    if (status != BBPE_OK)
+    {
+      fprintf(stderr, "Failed to init tokenizer: %d\n", status);
+      return 1;
+    }
+    if (r + 1 < repeats)
+      bbpe_destroy(tokenizer);
+  }
+  allocs = ALLOCS() - allocs;
+  free(json_content);
+  printf("bbpe_init  p50 %8.2f ms  allocs/call %10.0f  peak RSS %7.1f MB\n", percentile(samples, repeats, 50) * 1e3,
+         (double)allocs / repeats, peak_rss_mb());
+
+  // ---------- bbpe_load ----------
+  if (!bin_path)
+  {
+    bin_path = SAVE_FILE;
+    status = bbpe_save(tokenizer, SAVE_FILE);
+    if (status != BBPE_OK)
+    {
+      fprintf(stderr, "Failed to save tokenizer: %d\n", status);
+      return 1;
+    }
+  }
+  allocs = ALLOCS();
+  for (int r = 0; r < repeats; r++)
+  {
+    BBPETokenizer *loaded = NULL;
+    double t0 = now_seconds();
+    status = bbpe_load(bin_path, &loaded);
+    samples[r] = now_seconds() - t0;
+    if (status != BBPE_OK)
+    {
+      fprintf(stderr, "Failed to load %s: %d\n", bin_path, status);
+      return 1;
+    }
+    bbpe_destroy(loaded);
+  }
+  allocs = ALLOCS() - allocs;
+  printf("bbpe_load  p50 %8.2f ms  allocs/call %10.0f  peak RSS %7.1f MB\n\n", percentile(samples, repeats, 50) * 1e3,
+         (double)allocs / repeats, peak_rss_mb());
+  if (bin_path == SAVE_FILE)
+    remove(SAVE_FILE);
+  free(samples);
+
+  if (whole_tokens)
+  {
+    double t0 = now_seconds();
+    status = bbpe_set_whole_token_lookup(tokenizer, 1);
+    if (status != BBPE_OK)
+    {
+      fprintf(stderr, "Failed to enable whole-token lookup: %d\n", status);
+      return 1;
+    }
+    printf("whole-token lookup built in %.2f ms\n\n", (now_seconds() - t0) * 1e3);
+  }
+
+  // ---------- 语料 ----------
+  size_t corpus_count = 0;
+  Corpus *corpora = (Corpus *)calloc(corpus_path_count > 5 ? corpus_path_count : 5, sizeof(Corpus));
+  if (corpus_path_count == 0)
+    build_builtin_corpora(corpora, &corpus_count);
+  for (int i = 0; i < corpus_path_count; i++)
+  {
+    if (!load_corpus_file(&corpora[corpus_count], corpus_paths[i], whole_docs))
+    {
+      fprintf(stderr, "Skipping unreadable or empty corpus %s\n", corpus_paths[i]);
+      continue;
+    }
+    corpus_count++;
+  }
+  free(corpus_paths);
+
+  print_header();
+  for (size_t c = 0; c < corpus_count; c++)
+  {
+    Corpus *corpus = &corpora[c];
+    size_t calls = corpus->count * (size_t)repeats;
+    double *latencies = (double *)malloc(sizeof(double) * calls);
+    BBPEOutput *outputs = (BBPEOutput *)calloc(corpus->count, sizeof(BBPEOutput));
+    if (!latencies || !outputs)
+    {
+      fprintf(stderr, "Memory allocation failed\n");
+      return 1;
+    }
+
+    // 预热一遍 (同时保留各文档的 ID 供解码使用)
+    size_t tokens = 0;
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+      status = bbpe_encode_n(tokenizer, corpus->docs[i], corpus->lens[i], &outputs[i]);
+      if (status != BBPE_OK)
+      {
+        fprintf(stderr, "Encoding failed on %s doc %zu: %d\n", corpus->name, i, status);
+        return 1;
+      }
+      tokens += outputs[i].count;
+    }
+
+    // 编码
+    size_t k = 0;
+    double total = 0;
+    allocs = ALLOCS();
+    for (int r = 0; r < repeats; r++)
+    {
+      for (size_t i = 0; i < corpus->count; i++)
+      {
+        BBPEOutput out;
+        double t0 = now_seconds();
+        bbpe_encode_n(tokenizer, corpus->docs[i], corpus->lens[i], &out);
+        double dt = now_seconds() - t0;
+        latencies[k++] = dt;
+        total += dt;
+        bbpe_free_output(&out);
+      }
+    }
+    print_row("encode", corpus->name, latencies, calls, total, tokens * repeats, corpus->bytes * repeats,
+              ALLOCS() - allocs);
+
+    // 解码
+    k = 0;
+    total = 0;
+    allocs = ALLOCS();
+    for (int r = 0; r < repeats; r++)
+    {
+      for (size_t i = 0; i < corpus->count; i++)
+      {
+        if (outputs[i].count == 0)
+        {
+          latencies[k++] = 0;
+          continue;
+        }
+        char *text = NULL;
+        double t0 = now_seconds();
+        bbpe_decode(tokenizer, outputs[i].ids, outputs[i].count, &text);
+        double dt = now_seconds() - t0;
+        latencies[k++] = dt;
+        total += dt;
+        free(text);
+      }
+    }
+    print_row("decode", corpus->name, latencies, calls, total, tokens * repeats, corpus->bytes * repeats,
+              ALLOCS() - allocs);
+
+    for (size_t i = 0; i < corpus->count; i++)
+      bbpe_free_output(&outputs[i]);
+    free(outputs);
+    free(latencies);
+    corpus_free(corpus);
+  }
+  printf("\npeak RSS %.1f MB\n", peak_rss_mb());
+
+  free(corpora);
+  bbpe_destroy(tokenizer);
+  return 0;
+}
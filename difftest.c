@@ -0,0 +1,506 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "bbpe_tokenizer.h"
+#include "cJSON.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// 差分测试：逐文档比较本库各编码路径与参考 ID (tools/gen_reference.py 用 HuggingFace tokenizers 生成)，并记录吞吐量
+// 用法: difftest tokenizer.json reference.jsonl [-r 重复次数] [-t 线程数] [-n 最多报告数] [-l 构建标签] [-o 结果.csv]
+//   参考文件每行一个 JSON 对象 {"text": 文档, "ids": [...]}
+//   每种配置 (默认、词级缓存、哈希合并索引、整词直查、镜像加载、批量、单文档并行、流式) 各用一个新的分词器编码全部文档；
+//   不一致时报告文档号、第一个不同 token 的位置、两边重新对齐之前覆盖的原文片段及双方的 ID
+//   吞吐量取 -r 次中最快的一次；-o 把每种配置的结果追加为 CSV 的一行 (标签默认为本程序的编译时间)，便于比较不同构建
+//   有任何不一致或编码失败时退出码为 1
+
+#define STREAM_PIECE 61    /* 流式配置每次追加的字节数 (质数，经常切开多字节字符) */
+#define CACHE_CAPACITY 65536 /* 词级缓存配置的容量 */
+#define SPAN_PRINT_MAX 240 /* 报告中原文片段最多显示的字节数 */
+
+static double now_seconds(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER freq, counter;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&counter);
+  return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+static char *read_file(const char *path, size_t *out_len)
+{
+  FILE *fp = fopen(path, "rb");
+  if (!fp)
+    return NULL;
+  fseek(fp, 0, SEEK_END);
+  long fsize = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  char *buf = fsize >= 0 ? (char *)malloc((size_t)fsize + 1) : NULL;
+  if (!buf || fread(buf, 1, (size_t)fsize, fp) != (size_t)fsize)
+  {
+    free(buf);
+    fclose(fp);
+    return NULL;
+  }
+  fclose(fp);
+  buf[fsize] = '\0';
+  *out_len = (size_t)fsize;
+  return buf;
+}
+
+// ---------- 参考数据 ----------
+typedef struct
+{
+  char **docs;     // 各文档 (以 '\0' 结尾)
+  size_t *lens;    // 各文档字节数
+  int32_t **ids;   // 各文档的参考 ID
+  size_t *counts;  // 各文档的参考 ID 数
+  size_t count;    // 文档数
+  size_t cap;
+  size_t bytes;    // 全部文档的总字节数
+  size_t tokens;   // 全部参考 ID 数
+} Reference;
+
+static void *xrealloc(void *p, size_t size)
+{
+  void *q = realloc(p, size ? size : 1);
+  if (!q)
+  {
+    fprintf(stderr, "Memory allocation failed\n");
+    exit(1);
+  }
+  return q;
+}
+
+// 解析一行 {"text": ..., "ids": [...]}，格式不符时返回 0
+static int reference_add(Reference *ref, const char *line, size_t len)
+{
+  cJSON *obj = cJSON_ParseWithLength(line, len);
+  cJSON *text = cJSON_GetObjectItemCaseSensitive(obj, "text");
+  cJSON *ids = cJSON_GetObjectItemCaseSensitive(obj, "ids");
+  if (!cJSON_IsString(text) || !cJSON_IsArray(ids))
+  {
+    cJSON_Delete(obj);
+    return 0;
+  }
+  if (ref->count == ref->cap)
+  {
+    ref->cap = ref->cap ? ref->cap * 2 : 1024;
+    ref->docs = (char **)xrealloc(ref->docs, ref->cap * sizeof(char *));
+    ref->lens = (size_t *)xrealloc(ref->lens, ref->cap * sizeof(size_t));
+    ref->ids = (int32_t **)xrealloc(ref->ids, ref->cap * sizeof(int32_t *));
+    ref->counts = (size_t *)xrealloc(ref->counts, ref->cap * sizeof(size_t));
+  }
+  size_t text_len = strlen(text->valuestring);
+  size_t n = (size_t)cJSON_GetArraySize(ids);
+  char *doc = (char *)xrealloc(NULL, text_len + 1);
+  memcpy(doc, text->valuestring, text_len + 1);
+  int32_t *doc_ids = (int32_t *)xrealloc(NULL, n * sizeof(int32_t));
+  size_t k = 0;
+  const cJSON *item;
+  cJSON_ArrayForEach(item, ids)
+  {
+    doc_ids[k++] = (int32_t)item->valuedouble;
+  }
+  cJSON_Delete(obj);
+
+  ref->docs[ref->count] = doc;
+  ref->lens[ref->count] = text_len;
+  ref->ids[ref->count] = doc_ids;
+  ref->counts[ref->count] = n;
+  ref->count++;
+  ref->bytes += text_len;
+  ref->tokens += n;
+  return 1;
+}
+
+static int load_reference(Reference *ref, const char *path)
+{
+  size_t len;
+  char *data = read_file(path, &len);
+  if (!data)
+    return 0;
+  memset(ref, 0, sizeof(*ref));
+  size_t start = 0, line_no = 0;
+  for (size_t i = 0; i <= len; i++)
+  {
+    if (i < len && data[i] != '\n')
+      continue;
+    line_no++;
+    if (i > start && !reference_add(ref, data + start, i - start))
+      fprintf(stderr, "Skipping malformed reference line %zu\n", line_no);
+    start = i + 1;
+  }
+  free(data);
+  return ref->count > 0;
+}
+
+static void reference_free(Reference *ref)
+{
+  for (size_t i = 0; i < ref->count; i++)
+  {
+    free(ref->docs[i]);
+    free(ref->ids[i]);
+  }
+  free(ref->docs);
+  free(ref->lens);
+  free(ref->ids);
+  free(ref->counts);
+}
+
+// ---------- 配置 ----------
+typedef enum
+{
+  RUN_SINGLE,   // bbpe_encode_n 逐个文档
+  RUN_BATCH,    // bbpe_encode_batch 一次编码全部文档
+  RUN_PARALLEL, // bbpe_encode_parallel 逐个文档
+  RUN_STREAM,   // 流式编码器，每次追加 STREAM_PIECE 字节
+} RunMode;
+
+typedef enum
+{
+  SETUP_NONE,
+  SETUP_CACHE,
+  SETUP_HASH_INDEX,
+  SETUP_WHOLE_TOKEN,
+  SETUP_IMAGE, // 经 bbpe_save_to_memory / bbpe_load_from_memory 往返后的分词器
+} SetupKind;
+
+typedef struct
+{
+  const char *name;
+  SetupKind setup;
+  RunMode mode;
+} Config;
+
+static const Config CONFIGS[] = {
+    {"default", SETUP_NONE, RUN_SINGLE},
+    {"cache", SETUP_CACHE, RUN_SINGLE},
+    {"hash-index", SETUP_HASH_INDEX, RUN_SINGLE},
+    {"whole-token", SETUP_WHOLE_TOKEN, RUN_SINGLE},
+    {"image", SETUP_IMAGE, RUN_SINGLE},
+    {"batch", SETUP_NONE, RUN_BATCH},
+    {"parallel", SETUP_NONE, RUN_PARALLEL},
+    {"stream", SETUP_NONE, RUN_STREAM},
+};
+
+static BBPEStatus create_tokenizer(const char *json, SetupKind setup, BBPETokenizer **out)
+{
+  BBPEStatus status = bbpe_init(json, out);
+  if (status != BBPE_OK)
+    return status;
+  switch (setup)
+  {
+  case SETUP_NONE:
+    break;
+  case SETUP_CACHE:
+    status = bbpe_set_cache(*out, CACHE_CAPACITY, BBPE_CACHE_LRU);
+    break;
+  case SETUP_HASH_INDEX:
+    status = bbpe_set_merge_index(*out, BBPE_MERGE_INDEX_HASH);
+    break;
+  case SETUP_WHOLE_TOKEN:
+    status = bbpe_set_whole_token_lookup(*out, 1);
+    break;
+  case SETUP_IMAGE:
+  {
+    void *image = NULL;
+    size_t size = 0;
+    BBPETokenizer *loaded = NULL;
+    status = bbpe_save_to_memory(*out, &image, &size);
+    if (status == BBPE_OK)
+      status = bbpe_load_from_memory(image, size, 0, &loaded);
+    free(image);
+    bbpe_destroy(*out);
+    *out = loaded;
+    return status;
+  }
+  }
+  if (status != BBPE_OK)
+  {
+    bbpe_destroy(*out);
+    *out = NULL;
+  }
+  return status;
+}
+
+static BBPEStatus stream_encode(BBPEStreamEncoder *enc, const char *text, size_t len, BBPEOutput *out)
+{
+  memset(out, 0, sizeof(*out));
+  for (size_t pos = 0;; pos += STREAM_PIECE)
+  {
+    const int32_t *piece;
+    size_t piece_count;
+    int last = pos >= len;
+    BBPEStatus status = last ? bbpe_stream_encoder_finish(enc, &piece, &piece_count)
+                             : bbpe_stream_encoder_feed(enc, text + pos, len - pos < STREAM_PIECE ? len - pos : STREAM_PIECE,
+                                                        &piece, &piece_count);
+    if (status != BBPE_OK)
+    {
+      bbpe_free_output(out);
+      bbpe_stream_encoder_reset(enc);
+      return status;
+    }
+    if (out->count + piece_count > out->capacity)
+    {
+      out->capacity = (out->count + piece_count) * 2;
+      out->ids = (int32_t *)xrealloc(out->ids, out->capacity * sizeof(int32_t));
+    }
+    if (piece_count > 0)
+      memcpy(out->ids + out->count, piece, piece_count * sizeof(int32_t));
+    out->count += piece_count;
+    if (last)
+      return BBPE_OK;
+  }
+}
+
+// 以 config 的方式编码全部文档，outputs 由调用者提供 (ref->count 个)；返回第一个失败的状态码
+static BBPEStatus encode_all(BBPETokenizer *tok, const Config *config, const Reference *ref, BBPEOutput *outputs,
+                             int threads)
+{
+  BBPEStatus status = BBPE_OK;
+  if (config->mode == RUN_BATCH)
+    return bbpe_encode_batch(tok, (const char *const *)ref->docs, ref->lens, ref->count, outputs, threads);
+
+  BBPEStreamEncoder *enc = NULL;
+  if (config->mode == RUN_STREAM && (status = bbpe_stream_encoder_new(tok, &enc)) != BBPE_OK)
+    return status;
+  for (size_t i = 0; i < ref->count && status == BBPE_OK; i++)
+  {
+    if (config->mode == RUN_SINGLE)
+      status = bbpe_encode_n(tok, ref->docs[i], ref->lens[i], &outputs[i]);
+    else if (config->mode == RUN_PARALLEL)
+      status = bbpe_encode_parallel(tok, ref->docs[i], ref->lens[i], &outputs[i], threads);
+    else
+      status = stream_encode(enc, ref->docs[i], ref->lens[i], &outputs[i]);
+    if (status != BBPE_OK)
+    {
+      fprintf(stderr, "[%s] encoding failed on doc %zu: %d\n", config->name, i, status);
+      memset(&outputs[i], 0, sizeof(outputs[i]));
+    }
+  }
+  bbpe_stream_encoder_destroy(enc);
+  return status;
+}
+
+// ---------- 不一致报告 ----------
+
+// 单个 token 解码后的字节数 (参考 ID 不属于该分词器时记为 0)
+static size_t token_bytes(BBPETokenizer *tok, int32_t id)
+{
+  size_t n = 0;
+  if (bbpe_decoded_length(tok, &id, 1, &n) != BBPE_OK)
+    return 0;
+  return n;
+}
+
+static void print_escaped(const char *s, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+  {
+    unsigned char c = (unsigned char)s[i];
+    if (c == '\n')
+      fputs("\\n", stdout);
+    else if (c == '\t')
+      fputs("\\t", stdout);
+    else if (c == '\\' || c == '"')
+      printf("\\%c", c);
+    else if (c < 0x20 || c == 0x7F)
+      printf("\\x%02X", c);
+    else
+      putchar(c); // 其余字节 (含 UTF-8 多字节字符) 原样输出
+  }
+}
+
+static void print_ids(const char *label, const int32_t *ids, size_t from, size_t to)
+{
+  printf("  %-10s", label);
+  for (size_t i = from; i < to; i++)
+    printf(" %d", ids[i]);
+  printf("\n");
+}
+
+// 从第一个不同的 token 起，两边各自累加解码字节数，直到再次落在同一字节位置：这段原文就是结果不同的片段
+static void report_mismatch(BBPETokenizer *tok, const char *config, size_t doc, const char *text, size_t len,
+                            const int32_t *want, size_t want_n, const int32_t *got, size_t got_n)
+{
+  size_t k = 0;
+  while (k < want_n && k < got_n && want[k] == got[k])
+    k++;
+  size_t start = 0;
+  if (bbpe_decoded_length(tok, got, k, &start) != BBPE_OK)
+    start = 0;
+  size_t i = k, j = k, a = start, b = start;
+  while (a != b || (i == k && j == k))
+  {
+    if (a <= b && i < want_n)
+      a += token_bytes(tok, want[i++]);
+    else if (j < got_n)
+      b += token_bytes(tok, got[j++]);
+    else if (i < want_n)
+      a += token_bytes(tok, want[i++]);
+    else
+      break;
+  }
+  size_t end = a > b ? a : b;
+  if (end > len)
+    end = len;
+  if (start > end)
+    start = end;
+
+  printf("MISMATCH [%s] doc %zu token %zu (reference %zu tokens, bbpe %zu), bytes %zu..%zu: \"", config, doc, k,
+         want_n, got_n, start, end);
+  print_escaped(text + start, end - start < SPAN_PRINT_MAX ? end - start : SPAN_PRINT_MAX);
+  printf("%s\"\n", end - start > SPAN_PRINT_MAX ? "..." : "");
+  print_ids("reference", want, k, i);
+  print_ids("bbpe", got, k, j);
+}
+
+// ---------- 主程序 ----------
+int main(int argc, char *argv[])
+{
+  const char *json_path = NULL, *ref_path = NULL, *csv_path = NULL;
+  const char *label = __DATE__ " " __TIME__;
+  int repeats = 3, threads = 0;
+  long max_reports = 20;
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+      repeats = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+      threads = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+      max_reports = atol(argv[++i]);
+    else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc)
+      label = argv[++i];
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      csv_path = argv[++i];
+    else if (!json_path)
+      json_path = argv[i];
+    else if (!ref_path)
+      ref_path = argv[i];
+  }
+  if (!json_path || !ref_path || repeats <= 0)
+  {
+    fprintf(stderr, "Usage: %s tokenizer.json reference.jsonl [-r repeats] [-t threads] [-n max_reports] "
+                    "[-l label] [-o results.csv]\n", argv[0]);
+    return 1;
+  }
+
+  size_t json_len;
+  char *json = read_file(json_path, &json_len);
+  if (!json)
+  {
+    fprintf(stderr, "Failed to read %s\n", json_path);
+    return 1;
+  }
+  Reference ref;
+  if (!load_reference(&ref, ref_path))
+  {
+    fprintf(stderr, "Failed to read %s (or it has no records)\n", ref_path);
+    free(json);
+    return 1;
+  }
+  printf("%zu docs, %.2f MB, %zu reference tokens, build \"%s\"\n\n", ref.count, ref.bytes / 1e6, ref.tokens, label);
+
+  FILE *csv = NULL;
+  if (csv_path)
+  {
+    csv = fopen(csv_path, "a");
+    if (!csv)
+    {
+      fprintf(stderr, "Failed to open %s\n", csv_path);
+      return 1;
+    }
+    fseek(csv, 0, SEEK_END);
+    if (ftell(csv) == 0)
+      fprintf(csv, "label,config,docs,bytes,mismatched_docs,mb_per_s,tokens_per_s\n");
+  }
+
+  BBPEOutput *outputs = (BBPEOutput *)xrealloc(NULL, ref.count * sizeof(BBPEOutput));
+  int failed = 0;
+  long reported = 0;
+  const size_t config_count = sizeof(CONFIGS) / sizeof(CONFIGS[0]);
+  double *mb_per_s = (double *)xrealloc(NULL, config_count * sizeof(double));
+  size_t *mismatched = (size_t *)xrealloc(NULL, config_count * sizeof(size_t));
+  for (size_t c = 0; c < config_count; c++)
+  {
+    const Config *config = &CONFIGS[c];
+    BBPETokenizer *tok = NULL;
+    BBPEStatus status = create_tokenizer(json, config->setup, &tok);
+    mb_per_s[c] = 0;
+    mismatched[c] = ref.count;
+    if (status != BBPE_OK)
+    {
+      fprintf(stderr, "[%s] failed to create tokenizer: %d\n", config->name, status);
+      failed = 1;
+      continue;
+    }
+
+    // 第一遍的结果用于比较，其余各遍只计时
+    double best = 0;
+    for (int r = 0; r < repeats; r++)
+    {
+      memset(outputs, 0, ref.count * sizeof(BBPEOutput));
+      double t0 = now_seconds();
+      status = encode_all(tok, config, &ref, outputs, threads);
+      double dt = now_seconds() - t0;
+      if (r == 0 || dt < best)
+        best = dt;
+      if (status != BBPE_OK)
+        failed = 1;
+      if (r == 0)
+      {
+        mismatched[c] = 0;
+        for (size_t i = 0; i < ref.count; i++)
+        {
+          if (outputs[i].count == ref.counts[i] &&
+              (ref.counts[i] == 0 || memcmp(outputs[i].ids, ref.ids[i], ref.counts[i] * sizeof(int32_t)) == 0))
+            continue;
+          mismatched[c]++;
+          if (reported++ < max_reports)
+            report_mismatch(tok, config->name, i, ref.docs[i], ref.lens[i], ref.ids[i], ref.counts[i], outputs[i].ids,
+                            outputs[i].count);
+        }
+      }
+      for (size_t i = 0; i < ref.count; i++)
+        bbpe_free_output(&outputs[i]);
+      if (status != BBPE_OK)
+        break;
+    }
+    mb_per_s[c] = best > 0 ? ref.bytes / best / 1e6 : 0;
+    if (mismatched[c] > 0)
+      failed = 1;
+    if (csv)
+      fprintf(csv, "\"%s\",%s,%zu,%zu,%zu,%.3f,%.0f\n", label, config->name, ref.count, ref.bytes, mismatched[c],
+              mb_per_s[c], best > 0 ? ref.tokens / best : 0);
+    bbpe_destroy(tok);
+  }
+  if (reported > max_reports)
+    printf("... %ld more mismatches not shown (-n)\n", reported - max_reports);
+
+  printf("\n%-12s %10s %10s\n", "config", "mismatched", "MB/s");
+  for (size_t c = 0; c < config_count; c++)
+    printf("%-12s %10zu %10.2f\n", CONFIGS[c].name, mismatched[c], mb_per_s[c]);
+  printf("\n%s\n", failed ? "FAILED" : "ALL MATCH");
+
+  if (csv)
+    fclose(csv);
+  free(mb_per_s);
+  free(mismatched);
+  free(outputs);
+  reference_free(&ref);
+  free(json);
+  return failed ? 1 : 0;
+}
@@ -3,7 +3,30 @@
 #include <string.h>
 #include "bbpe_tokenizer.h"
 
-static const char *SAVE_FILE = "tokenizer_saved.bin";
+/* 保存/加载检查使用的文件名，放在系统临时目录下 (不覆盖或删除仓库中的文件) */
+static const char *SAVE_NAME = "bbpe_main_saved.bin";
+
+/* 异步编码检查：请求号连续分配，第 request - first 个请求对应 expected 中的同一下标 */
+typedef struct
+{
+  const BBPEOutput *expected;
+  uint64_t first, cancelled;
+  size_t completed;
+  int ok;
+} AsyncCheck;
+
+static void async_check_done(uint64_t request, BBPEStatus status, BBPEOutput *output, void *user_data)
+{
+  AsyncCheck *check = (AsyncCheck *)user_data;
+  const BBPEOutput *expected = &check->expected[request - check->first];
+  if (status == BBPE_ERR_CANCELLED)
+    check->ok &= request == check->cancelled;
+  else
+    check->ok &= status == BBPE_OK && output->count == expected->count &&
+                 memcmp(output->ids, expected->ids, output->count * sizeof(int32_t)) == 0;
+  bbpe_free_output(output);
+  check->completed++;
+}
 
 int main(int argc, char *argv[])
 {
@@ -14,6 +37,18 @@ int main(int argc, char *argv[])
   }
 
   const char *json_path = argv[1];
+  char save_file[1024];
+  const char *tmp_dir = getenv("TMPDIR");
+  if (!tmp_dir)
+    tmp_dir = getenv("TEMP");
+#ifdef _WIN32
+  if (!tmp_dir)
+    tmp_dir = ".";
+#else
+  if (!tmp_dir)
+    tmp_dir = "/tmp";
+#endif
+  snprintf(save_file, sizeof(save_file), "%s/%s", tmp_dir, SAVE_NAME);
   printf("Loading tokenizer from %s...\n", json_path);
   // 读取 JSON 文件内容
   FILE *fp = fopen(json_path, "r");
@@ -54,6 +89,11 @@ int main(int argc, char *argv[])
   }
   printf("BBPETokenizer initialized: %p\n", tokenizer);
 
+  BBPEMemoryUsage usage;
+  if (bbpe_get_memory_usage(tokenizer, &usage) == BBPE_OK)
+    printf("Memory usage: %.1f MiB (vocab %.1f, merges %.1f, decode %.1f)\n", usage.total_bytes / 1048576.0,
+           usage.vocab_bytes / 1048576.0, usage.merge_bytes / 1048576.0, usage.decode_bytes / 1048576.0);
+
   const char *RAWSTR = "\n \n\n \n\n\n \t \t\t \t\n  \n   \n    \n     \n🚀 (normal) 😶\u200d🌫️ (multiple emojis concatenated) ✅ 🦙🦙 3 33 333 3333 33333 333333 3333333 33333333 3.3 3..3 3...3 កាន់តែពិសេសអាច😁 ?我想在apple工作1314151天～ ------======= нещо на Български \'\'\'\'\'\'```````\"\"\"\"......!!!!!!?????? I\'ve been \'told he\'s there, \'RE you sure? \'M not sure I\'ll make it, \'D you like some tea? We\'Ve a\'lL";
 
   // ---------- 第一次编码 ----------
@@ -92,6 +132,232 @@ int main(int argc, char *argv[])
     return 1;
   }
 
+  // 流式解码验证：逐个 token 追加，拼接后应与原文一致
+  BBPEDecoder *decoder = NULL;
+  char *streamed = (char *)malloc(strlen(RAWSTR) + 1);
+  size_t streamed_len = 0;
+  int stream_ok = streamed && bbpe_decoder_new(tokenizer, &decoder) == BBPE_OK;
+  for (size_t i = 0; stream_ok && i <= output.count; i++)
+  {
+    const char *piece;
+    size_t piece_len;
+    status = i < output.count ? bbpe_decoder_push(decoder, output.ids[i], &piece, &piece_len)
+                              : bbpe_decoder_flush(decoder, &piece, &piece_len);
+    stream_ok = status == BBPE_OK && streamed_len + piece_len <= strlen(RAWSTR);
+    if (stream_ok)
+    {
+      memcpy(streamed + streamed_len, piece, piece_len);
+      streamed_len += piece_len;
+    }
+  }
+  stream_ok = stream_ok && streamed_len == strlen(RAWSTR) && memcmp(streamed, RAWSTR, streamed_len) == 0;
+  printf("Streaming decode matches original? %s\n", stream_ok ? "YES" : "NO");
+  bbpe_decoder_destroy(decoder);
+  free(streamed);
+
+  // 解码到调用者缓冲区：先查长度，容量不足时报告所需大小，足够时结果与 bbpe_decode 相同
+  size_t need = 0, written = 0;
+  char *into = NULL;
+  int into_ok = bbpe_decoded_length(tokenizer, output.ids, output.count, &need) == BBPE_OK &&
+                need == strlen(RAWSTR) && (into = (char *)malloc(need + 1)) != NULL &&
+                bbpe_decode_into(tokenizer, output.ids, output.count, into, need, &written) == BBPE_ERR_BUFFER_TOO_SMALL &&
+                written == need &&
+                bbpe_decode_into(tokenizer, output.ids, output.count, into, need + 1, &written) == BBPE_OK &&
+                strcmp(into, RAWSTR) == 0;
+  free(into);
+  printf("Decoding into a buffer matches original? %s\n", into_ok ? "YES" : "NO");
+
+  // 含 NUL 字节的输入：按长度编码后解码应逐字节还原 (字节 0x00 的 token 不能解码成 U+0100)
+  static const char nul_text[] = "ab\0c\0\0<|im_start|>\0";
+  size_t nul_len = sizeof(nul_text) - 1, nul_written = 0;
+  char nul_decoded[sizeof(nul_text)];
+  BBPEOutput nul_output;
+  int nul_ok = bbpe_encode_n(tokenizer, nul_text, nul_len, &nul_output) == BBPE_OK;
+  if (nul_ok)
+  {
+    nul_ok = bbpe_decode_into(tokenizer, nul_output.ids, nul_output.count, nul_decoded, sizeof(nul_decoded),
+                              &nul_written) == BBPE_OK &&
+             nul_written == nul_len && memcmp(nul_decoded, nul_text, nul_len) == 0;
+    bbpe_free_output(&nul_output);
+  }
+  printf("Text with NUL bytes round-trips? %s\n", nul_ok ? "YES" : "NO");
+
+  // 流式编码验证：每次追加 3 字节 (会切开多字节字符)，各次输出拼接后应与一次性编码相同
+  BBPEStreamEncoder *stream_enc = NULL;
+  int32_t *stream_ids = (int32_t *)malloc((output.count + 1) * sizeof(int32_t));
+  size_t stream_count = 0;
+  size_t raw_len = strlen(RAWSTR);
+  int stream_enc_ok = stream_ids && bbpe_stream_encoder_new(tokenizer, &stream_enc) == BBPE_OK;
+  for (size_t pos = 0; stream_enc_ok; pos += 3)
+  {
+    // 输入全部追加后调用 finish 取出暂存部分
+    int last = pos >= raw_len;
+    const int32_t *piece;
+    size_t piece_count;
+    status = last ? bbpe_stream_encoder_finish(stream_enc, &piece, &piece_count)
+                  : bbpe_stream_encoder_feed(stream_enc, RAWSTR + pos, raw_len - pos < 3 ? raw_len - pos : 3,
+                                             &piece, &piece_count);
+    stream_enc_ok = status == BBPE_OK && stream_count + piece_count <= output.count;
+    if (stream_enc_ok && piece_count > 0)
+    {
+      memcpy(stream_ids + stream_count, piece, piece_count * sizeof(int32_t));
+      stream_count += piece_count;
+    }
+    if (last)
+      break;
+  }
+  stream_enc_ok = stream_enc_ok && stream_count == output.count &&
+                  memcmp(stream_ids, output.ids, stream_count * sizeof(int32_t)) == 0;
+  printf("Streaming encode matches one-shot? %s\n", stream_enc_ok ? "YES" : "NO");
+  bbpe_stream_encoder_destroy(stream_enc);
+  free(stream_ids);
+
+  // 仅计数：结果应与编码得到的 token 数一致
+  size_t counted = 0;
+  status = bbpe_count_tokens(tokenizer, RAWSTR, strlen(RAWSTR), &counted);
+  printf("Token count matches encoding? %s\n", status == BBPE_OK && counted == output.count ? "YES" : "NO");
+
+  // 截断编码：应与完整结果的前 / 后 N 个 ID 相同
+  int truncate_ok = 1;
+  for (int side = BBPE_TRUNCATE_RIGHT; side <= BBPE_TRUNCATE_LEFT && truncate_ok; side++)
+  {
+    BBPEOutput truncated;
+    size_t keep = output.count / 2;
+    status = bbpe_encode_truncated(tokenizer, RAWSTR, strlen(RAWSTR), keep, (BBPETruncation)side, &truncated, NULL);
+    const int32_t *expected = side == BBPE_TRUNCATE_RIGHT ? output.ids : output.ids + output.count - keep;
+    truncate_ok = status == BBPE_OK && truncated.count == keep &&
+                  memcmp(truncated.ids, expected, keep * sizeof(int32_t)) == 0;
+    bbpe_free_output(&truncated);
+  }
+  printf("Truncated encoding matches? %s\n", truncate_ok ? "YES" : "NO");
+
+  // 字节区间：各区间首尾相接并恰好覆盖整个输入
+  BBPEOutput with_offsets;
+  BBPEOffsets offsets;
+  int offsets_ok = bbpe_encode_with_offsets(tokenizer, RAWSTR, strlen(RAWSTR), &with_offsets, &offsets) == BBPE_OK &&
+                   offsets.count == output.count;
+  size_t covered = 0;
+  for (size_t i = 0; offsets_ok && i < offsets.count; i++)
+  {
+    offsets_ok = offsets.start[i] == covered && offsets.end[i] >= covered;
+    covered = offsets.end[i];
+  }
+  offsets_ok = offsets_ok && covered == strlen(RAWSTR);
+  printf("Token offsets cover input? %s\n", offsets_ok ? "YES" : "NO");
+  bbpe_free_output(&with_offsets);
+  bbpe_free_offsets(&offsets);
+
+  // 规范化器 (NFC)：分解形式与预组合形式编码相同，区间仍按原文计算
+  const char decomposed[] = "cafe\xcc\x81";
+  BBPEOutput composed;
+  int normalize_ok = bbpe_encode(tokenizer, "caf\xc3\xa9", &composed) == BBPE_OK &&
+                     bbpe_encode_with_offsets(tokenizer, decomposed, strlen(decomposed), &with_offsets, &offsets) ==
+                         BBPE_OK;
+  normalize_ok = normalize_ok && with_offsets.count == composed.count &&
+                 memcmp(with_offsets.ids, composed.ids, composed.count * sizeof(int32_t)) == 0 &&
+                 offsets.count > 0 && offsets.end[offsets.count - 1] == strlen(decomposed);
+  printf("Normalized encoding matches composed form? %s\n", normalize_ok ? "YES" : "NO");
+  bbpe_free_output(&composed);
+  bbpe_free_output(&with_offsets);
+  bbpe_free_offsets(&offsets);
+
+  // 本已是 NFC 的天城文与谚文 (含组合标记) 原样保留：区间首尾相接，每个 token 的解码字节即原文对应片段
+  const char *stable_nfc = "\xe0\xa4\xa8\xe0\xa5\x8d \xe0\xa4\xb9\xe0\xa4\xbf\xe0\xa4\xa8\xe0\xa5\x8d\xe0\xa4"
+                           "\xa6\xe0\xa5\x80 \xed\x95\x9c\xea\xb5\xad\xec\x96\xb4";
+  size_t stable_len = strlen(stable_nfc);
+  int aligned_ok = bbpe_encode_with_offsets(tokenizer, stable_nfc, stable_len, &with_offsets, &offsets) == BBPE_OK &&
+                   offsets.count == with_offsets.count && offsets.count > 0 && offsets.start[0] == 0 &&
+                   offsets.end[offsets.count - 1] == stable_len;
+  for (size_t i = 0; aligned_ok && i < offsets.count; i++)
+  {
+    const char *piece;
+    size_t piece_len;
+    aligned_ok = (i == 0 || offsets.start[i] == offsets.end[i - 1]) && offsets.start[i] < offsets.end[i] &&
+                 bbpe_id_to_bytes(tokenizer, with_offsets.ids[i], &piece, &piece_len) == BBPE_OK &&
+                 piece_len == offsets.end[i] - offsets.start[i] &&
+                 memcmp(piece, stable_nfc + offsets.start[i], piece_len) == 0;
+  }
+  printf("Offsets of NFC-stable Indic/Hangul text are exact? %s\n", aligned_ok ? "YES" : "NO");
+  bbpe_free_output(&with_offsets);
+  bbpe_free_offsets(&offsets);
+
+  // 增量编码：先编码前半段，再追加其余部分，复用前缀后的结果应与一次性编码相同
+  size_t half = strlen(RAWSTR) / 2;
+  while (half > 0 && ((unsigned char)RAWSTR[half] & 0xC0) == 0x80)
+    half--;
+  size_t reused = 0;
+  int incremental_ok =
+      bbpe_encode_with_offsets(tokenizer, RAWSTR, half, &with_offsets, &offsets) == BBPE_OK &&
+      bbpe_encode_incremental(tokenizer, RAWSTR, half, RAWSTR, strlen(RAWSTR), &with_offsets, &offsets, &reused) == BBPE_OK &&
+      reused > 0 && with_offsets.count == output.count &&
+      memcmp(with_offsets.ids, output.ids, output.count * sizeof(int32_t)) == 0;
+  printf("Incremental encoding matches one-shot? %s\n", incremental_ok ? "YES" : "NO");
+  bbpe_free_output(&with_offsets);
+  bbpe_free_offsets(&offsets);
+
+  // 词表查询：ID → token 字符串 → ID 往返一致，各 ID 的解码字节 (经整张解码表) 拼接后还原原文
+  const char *vocab_bytes = NULL;
+  const uint32_t *vocab_offsets = NULL;
+  size_t vocab_ids = 0, joined_len = 0;
+  char *joined = (char *)malloc(strlen(RAWSTR) + 1);
+  int lookup_ok = joined && bbpe_get_decoded_vocab(tokenizer, &vocab_bytes, &vocab_offsets, &vocab_ids) == BBPE_OK;
+  for (size_t i = 0; lookup_ok && i < output.count; i++)
+  {
+    const char *token, *bytes;
+    size_t token_len, bytes_len;
+    int32_t id = -1;
+    lookup_ok = bbpe_id_to_token(tokenizer, output.ids[i], &token, &token_len) == BBPE_OK &&
+                bbpe_token_to_id(tokenizer, token, token_len, &id) == BBPE_OK && id == output.ids[i] &&
+                bbpe_id_to_bytes(tokenizer, id, &bytes, &bytes_len) == BBPE_OK && (size_t)id < vocab_ids &&
+                bytes == vocab_bytes + vocab_offsets[id] && bytes_len == vocab_offsets[id + 1] - vocab_offsets[id] &&
+                joined_len + bytes_len <= strlen(RAWSTR);
+    if (lookup_ok)
+    {
+      memcpy(joined + joined_len, bytes, bytes_len);
+      joined_len += bytes_len;
+    }
+  }
+  int32_t missing_id = 0;
+  lookup_ok = lookup_ok && joined_len == strlen(RAWSTR) && memcmp(joined, RAWSTR, joined_len) == 0 &&
+              bbpe_token_to_id(tokenizer, "\x01not-a-token", 12, &missing_id) == BBPE_ERR_TOKEN_NOT_FOUND &&
+              missing_id == -1;
+  printf("Token/ID lookup round-trips? %s\n", lookup_ok ? "YES" : "NO");
+  free(joined);
+
+  // 前缀索引：首个 token 的解码字节是原文的前缀，应出现在以其字节开头的 token 中，并在 WITHIN 位图中置位
+  const int32_t *prefixed = NULL;
+  size_t prefixed_count = 0;
+  uint32_t *mask = (uint32_t *)calloc((vocab_ids + 31) / 32, sizeof(uint32_t));
+  int32_t first_id = output.count ? output.ids[0] : -1;
+  int prefix_ok = mask && first_id >= 0 && bbpe_set_prefix_index(tokenizer, 1) == BBPE_OK &&
+                  bbpe_prefix_tokens(tokenizer, vocab_bytes + vocab_offsets[first_id],
+                                     vocab_offsets[first_id + 1] - vocab_offsets[first_id], &prefixed,
+                                     &prefixed_count) == BBPE_OK &&
+                  bbpe_prefix_mask(tokenizer, RAWSTR, strlen(RAWSTR), BBPE_PREFIX_WITHIN, mask) == BBPE_OK &&
+                  ((mask[first_id >> 5] >> (first_id & 31)) & 1);
+  int prefix_found = 0;
+  for (size_t i = 0; prefix_ok && i < prefixed_count; i++)
+    prefix_found |= prefixed[i] == first_id;
+  prefix_ok = prefix_ok && prefix_found;
+  printf("Prefix index finds token by decoded bytes? %s\n", prefix_ok ? "YES" : "NO");
+  free(mask);
+
+  // 输入上限：超长块被切开后结果仍应能解码回原文，恢复默认后与首次编码一致
+  BBPELimits limits = {8, 10000, 1000};
+  BBPEOutput limited;
+  int limits_ok = bbpe_set_limits(tokenizer, &limits) == BBPE_OK &&
+                  bbpe_encode(tokenizer, RAWSTR, &limited) == BBPE_OK;
+  if (limits_ok)
+  {
+    char *limited_text = NULL;
+    limits_ok = bbpe_decode(tokenizer, limited.ids, limited.count, &limited_text) == BBPE_OK &&
+                strcmp(limited_text, RAWSTR) == 0;
+    free(limited_text);
+    bbpe_free_output(&limited);
+  }
+  limits_ok = bbpe_set_limits(tokenizer, NULL) == BBPE_OK && limits_ok;
+  printf("Limited encoding decodes to original? %s\n", limits_ok ? "YES" : "NO");
+
   // 保存第一次的 ids 用于后续比较
   int32_t *first_ids = (int32_t *)malloc(output.count * sizeof(int32_t));
   if (!first_ids)
@@ -106,8 +372,8 @@ int main(int argc, char *argv[])
   bbpe_free_output(&output);
 
   // ---------- 序列化保存 ----------
-  printf("\nSaving tokenizer to %s...\n", SAVE_FILE);
-  status = bbpe_save(tokenizer, SAVE_FILE);
+  printf("\nSaving tokenizer to %s...\n", save_file);
+  status = bbpe_save(tokenizer, save_file);
   if (status != BBPE_OK)
   {
     fprintf(stderr, "bbpe_save failed: %d\n", status);
@@ -122,19 +388,34 @@ int main(int argc, char *argv[])
   tokenizer = NULL;
 
   // ---------- 从保存的文件加载 ----------
-  printf("Loading tokenizer from %s...\n", SAVE_FILE);
-  status = bbpe_load(SAVE_FILE, &tokenizer);
+  printf("Loading tokenizer from %s...\n", save_file);
+  status = bbpe_load(save_file, &tokenizer);
   if (status != BBPE_OK)
   {
     fprintf(stderr, "bbpe_load failed: %d\n", status);
     free(first_ids);
-    remove(SAVE_FILE);
+    remove(save_file);
     return 1;
   }
   printf("Load successful.\n");
 
+  // 只解码加载：不构建合并规则与正则，解码结果不变，编码返回 BBPE_ERR_DECODE_ONLY
+  BBPETokenizer *decode_only = NULL;
+  int decode_only_ok = bbpe_load_ex(save_file, BBPE_LOAD_DECODE_ONLY, &decode_only) == BBPE_OK;
+  if (decode_only_ok)
+  {
+    char *decoded_text = NULL;
+    BBPEOutput rejected;
+    decode_only_ok = bbpe_decode(decode_only, first_ids, first_count, &decoded_text) == BBPE_OK &&
+                     strcmp(decoded_text, RAWSTR) == 0 &&
+                     bbpe_encode(decode_only, RAWSTR, &rejected) == BBPE_ERR_DECODE_ONLY;
+    free(decoded_text);
+    bbpe_destroy(decode_only);
+  }
+  printf("Decode-only load decodes original? %s\n", decode_only_ok ? "YES" : "NO");
+
   // 可选删除临时文件
-  remove(SAVE_FILE);
+  remove(save_file);
 
   // ---------- 再次编码同一文本 ----------
   BBPEOutput output2;
@@ -160,10 +441,168 @@ int main(int argc, char *argv[])
               (memcmp(first_ids, output2.ids, first_count * sizeof(int32_t)) == 0);
   printf("\nSerialization test: %s\n", match ? "PASS" : "FAIL");
 
-  // 释放资源
-  free(first_ids);
+  // 整词直查：稳定 token 直接查表，结果须与逐字节合并一致
+  BBPEOutput whole;
+  int whole_ok = bbpe_set_whole_token_lookup(tokenizer, 1) == BBPE_OK &&
+                 bbpe_encode(tokenizer, RAWSTR, &whole) == BBPE_OK;
+  if (whole_ok)
+  {
+    whole_ok = whole.count == first_count && memcmp(whole.ids, first_ids, first_count * sizeof(int32_t)) == 0;
+    bbpe_free_output(&whole);
+  }
+  bbpe_set_whole_token_lookup(tokenizer, 0);
+  printf("Whole-token lookup matches merging? %s\n", whole_ok ? "YES" : "NO");
+
+  // ---------- 共享句柄的并发编码/解码 ----------
+  // 开启较小的词级缓存以频繁触发淘汰，多线程同时编码 RAWSTR 的各个后缀，
+  // 结果须与单线程编码一致，且每个结果都能解码回原文
+  enum
+  {
+    STRESS_DOCS = 2048,
+    STRESS_THREADS = 8
+  };
+  bbpe_set_cache(tokenizer, 64, BBPE_CACHE_LRU);
+  const char **docs = (const char **)malloc(STRESS_DOCS * sizeof(const char *));
+  BBPEOutput *batch = (BBPEOutput *)malloc(STRESS_DOCS * sizeof(BBPEOutput));
+  int stress_ok = docs && batch;
+  int batch_done = 0;
+  if (stress_ok)
+  {
+    size_t raw_len = strlen(RAWSTR);
+    size_t off = 0;
+    for (size_t i = 0; i < STRESS_DOCS; i++)
+    {
+      // 只在 UTF-8 字符边界处截取后缀
+      off = (off + 7) % raw_len;
+      while (((unsigned char)RAWSTR[off] & 0xC0) == 0x80)
+        off++;
+      docs[i] = RAWSTR + off;
+    }
+    status = bbpe_encode_batch(tokenizer, docs, NULL, STRESS_DOCS, batch, STRESS_THREADS);
+    stress_ok = batch_done = status == BBPE_OK;
+  }
+  for (size_t i = 0; stress_ok && i < STRESS_DOCS; i++)
+  {
+    BBPEOutput serial;
+    char *decoded = NULL;
+    stress_ok = bbpe_encode(tokenizer, docs[i], &serial) == BBPE_OK;
+    if (!stress_ok)
+      break;
+    stress_ok = serial.count == batch[i].count &&
+                memcmp(serial.ids, batch[i].ids, serial.count * sizeof(int32_t)) == 0;
+    bbpe_free_output(&serial);
+    if (stress_ok && batch[i].count > 0)
+    {
+      stress_ok = bbpe_decode(tokenizer, batch[i].ids, batch[i].count, &decoded) == BBPE_OK &&
+                  strcmp(decoded, docs[i]) == 0;
+      free(decoded);
+    }
+  }
+  // 批量解码：全部结果拼接为一个 ID 数组，一次解码到连续缓冲区，各段须与原文一致
+  int batch_decode_ok = 0;
+  if (stress_ok)
+  {
+    size_t *id_offsets = (size_t *)malloc((STRESS_DOCS + 1) * sizeof(size_t));
+    size_t *text_offsets = (size_t *)malloc((STRESS_DOCS + 1) * sizeof(size_t));
+    int32_t *flat = NULL;
+    char *texts = NULL;
+    if (id_offsets && text_offsets)
+    {
+      id_offsets[0] = 0;
+      for (size_t i = 0; i < STRESS_DOCS; i++)
+        id_offsets[i + 1] = id_offsets[i] + batch[i].count;
+      flat = (int32_t *)malloc((id_offsets[STRESS_DOCS] + 1) * sizeof(int32_t));
+    }
+    if (flat)
+    {
+      for (size_t i = 0; i < STRESS_DOCS; i++)
+        memcpy(flat + id_offsets[i], batch[i].ids, batch[i].count * sizeof(int32_t));
+      batch_decode_ok = bbpe_decode_batch(tokenizer, flat, id_offsets, STRESS_DOCS, &texts, text_offsets,
+                                          STRESS_THREADS) == BBPE_OK;
+    }
+    for (size_t i = 0; batch_decode_ok && i < STRESS_DOCS; i++)
+    {
+      size_t len = text_offsets[i + 1] - text_offsets[i];
+      batch_decode_ok = len == strlen(docs[i]) && memcmp(texts + text_offsets[i], docs[i], len) == 0;
+    }
+    free(texts);
+    free(flat);
+    free(id_offsets);
+    free(text_offsets);
+  }
+  printf("Batch decode matches (%d docs)? %s\n", (int)STRESS_DOCS, batch_decode_ok ? "YES" : "NO");
+
+  // 异步编码：延迟分发模式下提交全部文档并取消最后一个，回调在本线程上运行，
+  // 每个请求恰好完成一次，未被取消的结果须与批量编码一致
+  AsyncCheck async_check = {batch, 0, 0, 0, stress_ok};
+  if (stress_ok && bbpe_async_start(tokenizer, STRESS_THREADS, BBPE_ASYNC_DEFERRED) == BBPE_OK)
+  {
+    size_t submitted = 0;
+    for (uint64_t request; submitted < STRESS_DOCS; submitted++)
+    {
+      if (bbpe_encode_async(tokenizer, docs[submitted], strlen(docs[submitted]), async_check_done, &async_check,
+                            &request) != BBPE_OK)
+        break;
+      if (submitted == 0)
+        async_check.first = request;
+      async_check.cancelled = request;
+    }
+    // 最后一个请求可能已经完成，此时取消失败，回调照常报告结果
+    bbpe_async_cancel(tokenizer, async_check.cancelled);
+    while (async_check.completed < submitted)
+      bbpe_async_dispatch(tokenizer);
+    bbpe_async_stop(tokenizer);
+    async_check.ok &= submitted == STRESS_DOCS && async_check.completed == submitted;
+  }
+  else
+    async_check.ok = 0;
+  printf("Async encode matches batch? %s\n", async_check.ok ? "YES" : "NO");
+
+  if (batch_done)
+  {
+    for (size_t i = 0; i < STRESS_DOCS; i++)
+      bbpe_free_output(&batch[i]);
+  }
+  free(docs);
+  free(batch);
+  printf("Concurrency test (%d threads, %d docs): %s\n", (int)STRESS_THREADS, (int)STRESS_DOCS,
+         stress_ok ? "PASS" : "FAIL");
+
+  // 派生分词器：共享词汇表与合并规则，只换用变体的特殊 token (新增的 ID 超出基础词表)；
+  // 先销毁基础分词器，派生的分词器仍可使用
+  const char *variant = "[{\"id\": 151643, \"content\": \"<|endoftext|>\", \"special\": true},"
+                        " {\"id\": 151669, \"content\": \"<|tool_x|>\", \"special\": true}]";
+  const char *derived_text = "hi<|tool_x|><|endoftext|><|im_start|>";
+  BBPETokenizer *derived = NULL;
+  BBPEOutput derived_base = {0}, derived_out = {0}, derived_raw = {0};
+  int derive_ok = bbpe_derive(tokenizer, variant, &derived) == BBPE_OK &&
+                  bbpe_encode(tokenizer, derived_text, &derived_base) == BBPE_OK;
   bbpe_free_output(&output2);
   bbpe_destroy(tokenizer);
+  if (derive_ok && bbpe_encode(derived, RAWSTR, &derived_raw) == BBPE_OK &&
+      bbpe_encode(derived, derived_text, &derived_out) == BBPE_OK)
+  {
+    // 基础分词器把 <|im_start|> 识别为特殊 token、<|tool_x|> 按普通文本切分；派生的分词器正相反
+    char *derived_decoded = NULL;
+    derive_ok = derived_raw.count == first_count &&
+                memcmp(derived_raw.ids, first_ids, first_count * sizeof(int32_t)) == 0 &&
+                derived_out.count > 3 && derived_out.ids[1] == 151669 && derived_out.ids[2] == 151643 &&
+                derived_base.ids[derived_base.count - 1] == 151644 &&
+                derived_out.ids[derived_out.count - 1] != 151644 &&
+                bbpe_decode(derived, derived_out.ids, derived_out.count, &derived_decoded) == BBPE_OK &&
+                strcmp(derived_decoded, derived_text) == 0;
+    free(derived_decoded);
+  }
+  else
+    derive_ok = 0;
+  printf("Derived tokenizer shares tables and outlives its base? %s\n", derive_ok ? "YES" : "NO");
+  bbpe_free_output(&derived_base);
+  bbpe_free_output(&derived_out);
+  bbpe_free_output(&derived_raw);
+  bbpe_destroy(derived);
+
+  // 释放资源
+  free(first_ids);
 
   return 0;
 }
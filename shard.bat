@@ -0,0 +1,3 @@
+@echo off
+setlocal enabledelayedexpansion
+gcc -O2 -DHAVE_CONFIG_H -DPCRE2_CODE_UNIT_WIDTH=8 -DPCRE2_STATIC -DSUPPORT_JIT -Ithirdparty/cJSON -Ithirdparty/uthash -Ithirdparty/pcre2 -I. -o shard.exe bbpe_tokenizer.c shard.c thirdparty/cJSON/*.c thirdparty/pcre2/*.c
\ No newline at end of file
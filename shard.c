@@ -0,0 +1,711 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "bbpe_tokenizer.h"
+#include "cJSON.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+// 数据集分片工具：把大文本 / JSONL 文件流式编码为紧凑的 token 分片与索引文件
+// 用法: shard tokenizer.json|tokenizer.bin -o 输出前缀 [选项] [输入文件 ...]
+//   未指定输入文件或文件名为 - 时读取标准输入；默认每行一个文档，-f jsonl 时取每行 JSON 对象中 -k 指定的字符串字段
+//   三级流水线：读取线程按大块 fread 切出文档并打包成批 → 调用线程以 bbpe_encode_batch 多线程编码 →
+//   写出线程写入分片与索引。批在三者之间循环复用，总数固定为 -q，任一级变慢时上游阻塞等待 (背压)
+//
+// 输出 (所有整数为小端)：
+//   前缀-00000.bin ...  各文档的 token ID 依次相接，每个 ID 占 2 或 4 字节 (-w)，文档不跨分片
+//   前缀.idx           16 字节文件头 ("BBPEIDX1"、u32 ID 字节数、u32 保留)，之后每个文档一条 16 字节记录：
+//                      u32 分片号、u32 token 数、u64 文档在分片内的起始位置 (以 token 计)
+
+#define READ_CHUNK (8u << 20)     /* 每次 fread 的字节数 */
+#define BATCH_MAX_BYTES (8u << 20) /* 单批文档的最大总字节数 (与 -b 的文档数先到者为准) */
+
+// ---------- 线程与同步 ----------
+#ifdef _WIN32
+typedef HANDLE thread_t;
+typedef CRITICAL_SECTION lock_t;
+typedef CONDITION_VARIABLE cond_t;
+#define lock_init(l) InitializeCriticalSection(l)
+#define lock_destroy(l) DeleteCriticalSection(l)
+#define lock_acquire(l) EnterCriticalSection(l)
+#define lock_release(l) LeaveCriticalSection(l)
+#define cond_init(c) InitializeConditionVariable(c)
+#define cond_destroy(c) ((void)(c))
+#define cond_wait(c, l) SleepConditionVariableCS(c, l, INFINITE)
+#define cond_signal(c) WakeConditionVariable(c)
+#define cond_broadcast(c) WakeAllConditionVariable(c)
+#else
+typedef pthread_t thread_t;
+typedef pthread_mutex_t lock_t;
+typedef pthread_cond_t cond_t;
+#define lock_init(l) pthread_mutex_init(l, NULL)
+#define lock_destroy(l) pthread_mutex_destroy(l)
+#define lock_acquire(l) pthread_mutex_lock(l)
+#define lock_release(l) pthread_mutex_unlock(l)
+#define cond_init(c) pthread_cond_init(c, NULL)
+#define cond_destroy(c) pthread_cond_destroy(c)
+#define cond_wait(c, l) pthread_cond_wait(c, l)
+#define cond_signal(c) pthread_cond_signal(c)
+#define cond_broadcast(c) pthread_cond_broadcast(c)
+#endif
+
+typedef struct
+{
+  void (*fn)(void *);
+  void *arg;
+} ThreadStart;
+
+#ifdef _WIN32
+static DWORD WINAPI thread_entry(LPVOID param)
+{
+  ThreadStart *start = (ThreadStart *)param;
+  start->fn(start->arg);
+  return 0;
+}
+#else
+static void *thread_entry(void *param)
+{
+  ThreadStart *start = (ThreadStart *)param;
+  start->fn(start->arg);
+  return NULL;
+}
+#endif
+
+// start 须保持有效直到 thread_join 返回
+static int thread_start(thread_t *thread, ThreadStart *start)
+{
+#ifdef _WIN32
+  *thread = CreateThread(NULL, 0, thread_entry, start, 0, NULL);
+  return *thread != NULL;
+#else
+  return pthread_create(thread, NULL, thread_entry, start) == 0;
+#endif
+}
+
+static void thread_join(thread_t thread)
+{
+#ifdef _WIN32
+  WaitForSingleObject(thread, INFINITE);
+  CloseHandle(thread);
+#else
+  pthread_join(thread, NULL);
+#endif
+}
+
+static double now_seconds(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER freq, counter;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&counter);
+  return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+static void *xrealloc(void *p, size_t size)
+{
+  void *q = realloc(p, size);
+  if (!q)
+  {
+    fprintf(stderr, "Memory allocation failed\n");
+    exit(1);
+  }
+  return q;
+}
+
+// ---------- 批与队列 ----------
+typedef struct Batch
+{
+  char *data;          // 本批全部文档的字节，依次相接
+  size_t size;         // data 已用字节数
+  size_t cap;          // data 容量
+  size_t *starts;      // 各文档在 data 中的起点
+  size_t *lens;        // 各文档字节数
+  const char **texts;  // 编码前由 starts 换算的文档指针
+  BBPEOutput *outputs; // 编码结果
+  size_t count;        // 文档数
+  size_t doc_cap;      // starts / lens / texts / outputs 的容量
+  struct Batch *next;  // 所在队列中的下一个批
+} Batch;
+
+static void batch_add(Batch *b, const char *text, size_t len)
+{
+  if (b->count == b->doc_cap)
+  {
+    b->doc_cap = b->doc_cap ? b->doc_cap * 2 : 256;
+    b->starts = (size_t *)xrealloc(b->starts, b->doc_cap * sizeof(size_t));
+    b->lens = (size_t *)xrealloc(b->lens, b->doc_cap * sizeof(size_t));
+    b->texts = (const char **)xrealloc((void *)b->texts, b->doc_cap * sizeof(char *));
+    b->outputs = (BBPEOutput *)xrealloc(b->outputs, b->doc_cap * sizeof(BBPEOutput));
+  }
+  if (b->size + len > b->cap)
+  {
+    size_t cap = b->cap ? b->cap : 1024;
+    while (cap < b->size + len)
+      cap *= 2;
+    b->data = (char *)xrealloc(b->data, cap);
+    b->cap = cap;
+  }
+  memcpy(b->data + b->size, text, len);
+  b->starts[b->count] = b->size;
+  b->lens[b->count] = len;
+  b->count++;
+  b->size += len;
+}
+
+static void batch_free(Batch *b)
+{
+  free(b->data);
+  free(b->starts);
+  free(b->lens);
+  free((void *)b->texts);
+  free(b->outputs);
+  free(b);
+}
+
+// 先进先出的阻塞队列：pop 在队列为空且未关闭时等待，关闭后取完剩余的批即返回 NULL
+typedef struct
+{
+  Batch *head;
+  Batch *tail;
+  int closed;
+  lock_t lock;
+  cond_t ready;
+} Queue;
+
+static void queue_init(Queue *q)
+{
+  q->head = q->tail = NULL;
+  q->closed = 0;
+  lock_init(&q->lock);
+  cond_init(&q->ready);
+}
+
+static void queue_destroy(Queue *q)
+{
+  while (q->head)
+  {
+    Batch *b = q->head;
+    q->head = b->next;
+    batch_free(b);
+  }
+  lock_destroy(&q->lock);
+  cond_destroy(&q->ready);
+}
+
+static void queue_push(Queue *q, Batch *b)
+{
+  b->next = NULL;
+  lock_acquire(&q->lock);
+  if (q->tail)
+    q->tail->next = b;
+  else
+    q->head = b;
+  q->tail = b;
+  cond_signal(&q->ready);
+  lock_release(&q->lock);
+}
+
+static Batch *queue_pop(Queue *q)
+{
+  lock_acquire(&q->lock);
+  while (!q->head && !q->closed)
+    cond_wait(&q->ready, &q->lock);
+  Batch *b = q->head;
+  if (b)
+  {
+    q->head = b->next;
+    if (!q->head)
+      q->tail = NULL;
+  }
+  lock_release(&q->lock);
+  return b;
+}
+
+static void queue_close(Queue *q)
+{
+  lock_acquire(&q->lock);
+  q->closed = 1;
+  cond_broadcast(&q->ready);
+  lock_release(&q->lock);
+}
+
+// ---------- 流水线 ----------
+typedef struct
+{
+  // 选项
+  const char **inputs;
+  int input_count;
+  int jsonl;
+  const char *key;
+  size_t batch_docs;
+  int token_bytes;
+  unsigned long long shard_tokens; // 0 表示不限
+  long long eos_id;                // < 0 表示不追加
+  const char *prefix;
+
+  // 三个队列：空闲批 → 待编码 → 待写出 → 空闲批
+  Queue free_batches;
+  Queue to_encode;
+  Queue to_write;
+  int failed;          // 任一级出错后置 1，读取线程停止读取，写出线程只回收批 (受 fail_lock 保护)
+  lock_t fail_lock;
+
+  // 统计 (读取线程 / 写出线程各自写入，结束后由主线程读取)
+  unsigned long long bytes_read;
+  unsigned long long docs_skipped;
+  unsigned long long docs_written;
+  unsigned long long tokens_written;
+  unsigned shard_count;
+} Pipeline;
+
+static void pipeline_fail(Pipeline *p)
+{
+  lock_acquire(&p->fail_lock);
+  p->failed = 1;
+  lock_release(&p->fail_lock);
+}
+
+static int pipeline_failed(Pipeline *p)
+{
+  lock_acquire(&p->fail_lock);
+  int failed = p->failed;
+  lock_release(&p->fail_lock);
+  return failed;
+}
+
+// ---------- 读取 ----------
+typedef struct
+{
+  Pipeline *p;
+  Batch *batch;
+} Reader;
+
+static void reader_submit(Reader *r)
+{
+  queue_push(&r->p->to_encode, r->batch);
+  r->batch = queue_pop(&r->p->free_batches); // 没有空闲批时在此等待下游
+}
+
+static void reader_add_line(Reader *r, const char *line, size_t len)
+{
+  if (len > 0 && line[len - 1] == '\r')
+    len--;
+  if (len == 0)
+    return;
+  if (r->p->jsonl)
+  {
+    cJSON *obj = cJSON_ParseWithLength(line, len);
+    const cJSON *item = cJSON_GetObjectItemCaseSensitive(obj, r->p->key);
+    if (cJSON_IsString(item) && item->valuestring[0])
+      batch_add(r->batch, item->valuestring, strlen(item->valuestring));
+    else
+      r->p->docs_skipped++;
+    cJSON_Delete(obj);
+  }
+  else
+    batch_add(r->batch, line, len);
+  if (r->batch->count >= r->p->batch_docs || r->batch->size >= BATCH_MAX_BYTES)
+    reader_submit(r);
+}
+
+// 以 READ_CHUNK 为单位读取并切出完整的行；超长的行使缓冲区按倍数增长
+static int read_stream(Reader *r, FILE *fp)
+{
+  size_t cap = READ_CHUNK, len = 0, scan = 0;
+  char *buf = (char *)xrealloc(NULL, cap);
+  for (;;)
+  {
+    if (len == cap)
+    {
+      cap *= 2;
+      buf = (char *)xrealloc(buf, cap);
+    }
+    size_t got = fread(buf + len, 1, cap - len, fp);
+    len += got;
+    r->p->bytes_read += got;
+
+    size_t start = 0;
+    char *nl;
+    while ((nl = (char *)memchr(buf + scan, '\n', len - scan)) != NULL)
+    {
+      reader_add_line(r, buf + start, (size_t)(nl - (buf + start)));
+      start = scan = (size_t)(nl - buf) + 1;
+    }
+    int failed = pipeline_failed(r->p);
+    if (got == 0 || failed)
+    {
+      if (len > start && !failed)
+        reader_add_line(r, buf + start, len - start); // 末尾没有换行符的最后一行
+      break;
+    }
+    // 未完整的行移到缓冲区开头，下次只在新读入的部分查找换行符
+    memmove(buf, buf + start, len - start);
+    len -= start;
+    scan = len;
+  }
+  free(buf);
+  return !ferror(fp);
+}
+
+static void reader_main(void *arg)
+{
+  Pipeline *p = (Pipeline *)arg;
+  Reader r = {p, queue_pop(&p->free_batches)};
+  for (int i = 0; i < p->input_count && !pipeline_failed(p); i++)
+  {
+    const char *path = p->inputs[i];
+    FILE *fp = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    if (!fp)
+    {
+      fprintf(stderr, "Failed to open %s\n", path);
+      pipeline_fail(p);
+      break;
+    }
+    if (!read_stream(&r, fp))
+    {
+      fprintf(stderr, "Failed to read %s\n", path);
+      pipeline_fail(p);
+    }
+    if (fp != stdin)
+      fclose(fp);
+  }
+  if (r.batch->count > 0)
+    queue_push(&p->to_encode, r.batch);
+  else
+    queue_push(&p->free_batches, r.batch);
+  queue_close(&p->to_encode);
+}
+
+// ---------- 写出 ----------
+static void put_le32(unsigned char *dst, uint32_t v)
+{
+  dst[0] = (unsigned char)v;
+  dst[1] = (unsigned char)(v >> 8);
+  dst[2] = (unsigned char)(v >> 16);
+  dst[3] = (unsigned char)(v >> 24);
+}
+
+typedef struct
+{
+  Pipeline *p;
+  FILE *index;
+  FILE *shard;
+  unsigned long long shard_used; // 当前分片已写入的 token 数
+  unsigned char *buf;            // 打包后的 token 字节
+  size_t buf_cap;
+} Writer;
+
+static int writer_open_shard(Writer *w)
+{
+  char path[1024];
+  if (w->shard && fclose(w->shard) != 0)
+    return 0;
+  snprintf(path, sizeof(path), "%s-%05u.bin", w->p->prefix, w->p->shard_count);
+  w->shard = fopen(path, "wb");
+  if (!w->shard)
+  {
+    fprintf(stderr, "Failed to create %s\n", path);
+    return 0;
+  }
+  w->p->shard_count++;
+  w->shard_used = 0;
+  return 1;
+}
+
+// 写出一个文档：token 与索引记录；返回 0 表示失败
+static int writer_put_doc(Writer *w, const BBPEOutput *out)
+{
+  Pipeline *p = w->p;
+  size_t count = out->count + (p->eos_id >= 0);
+  if (p->shard_tokens && w->shard_used > 0 && w->shard_used + count > p->shard_tokens && !writer_open_shard(w))
+    return 0;
+
+  size_t need = count * (size_t)p->token_bytes;
+  if (need > w->buf_cap)
+  {
+    w->buf_cap = need * 2;
+    w->buf = (unsigned char *)xrealloc(w->buf, w->buf_cap);
+  }
+  for (size_t i = 0; i < count; i++)
+  {
+    uint32_t id = (uint32_t)(i < out->count ? out->ids[i] : p->eos_id);
+    if (p->token_bytes == 4)
+      put_le32(w->buf + i * 4, id);
+    else if (id > 0xFFFF)
+    {
+      fprintf(stderr, "Token ID %u does not fit in 16 bits; use -w 32\n", id);
+      return 0;
+    }
+    else
+    {
+      w->buf[i * 2] = (unsigned char)id;
+      w->buf[i * 2 + 1] = (unsigned char)(id >> 8);
+    }
+  }
+
+  unsigned char rec[16];
+  put_le32(rec, p->shard_count - 1);
+  put_le32(rec + 4, (uint32_t)count);
+  put_le32(rec + 8, (uint32_t)w->shard_used);
+  put_le32(rec + 12, (uint32_t)(w->shard_used >> 32));
+  if (fwrite(w->buf, 1, need, w->shard) != need || fwrite(rec, 1, sizeof(rec), w->index) != sizeof(rec))
+  {
+    fprintf(stderr, "Failed to write output\n");
+    return 0;
+  }
+  w->shard_used += count;
+  p->docs_written++;
+  p->tokens_written += count;
+  return 1;
+}
+
+static void writer_main(void *arg)
+{
+  Writer *w = (Writer *)arg;
+  Pipeline *p = w->p;
+  Batch *b;
+  while ((b = queue_pop(&p->to_write)) != NULL)
+  {
+    int failed = pipeline_failed(p);
+    for (size_t i = 0; i < b->count; i++)
+    {
+      if (!failed && !writer_put_doc(w, &b->outputs[i]))
+      {
+        pipeline_fail(p);
+        failed = 1;
+      }
+      bbpe_free_output(&b->outputs[i]);
+    }
+    b->count = 0;
+    b->size = 0;
+    queue_push(&p->free_batches, b);
+  }
+}
+
+static char *read_file(const char *path, size_t *out_len)
+{
+  FILE *fp = fopen(path, "rb");
+  if (!fp)
+    return NULL;
+  fseek(fp, 0, SEEK_END);
+  long len = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  char *data = len >= 0 ? (char *)malloc((size_t)len + 1) : NULL;
+  if (data && fread(data, 1, (size_t)len, fp) != (size_t)len)
+  {
+    free(data);
+    data = NULL;
+  }
+  fclose(fp);
+  if (data)
+  {
+    data[len] = '\0';
+    *out_len = (size_t)len;
+  }
+  return data;
+}
+
+static BBPETokenizer *load_tokenizer(const char *path)
+{
+  BBPETokenizer *tok = NULL;
+  BBPEStatus status;
+  size_t n = strlen(path);
+  if (n >= 5 && strcmp(path + n - 5, ".json") == 0)
+  {
+    size_t len;
+    char *json = read_file(path, &len);
+    if (!json)
+    {
+      fprintf(stderr, "Failed to read %s\n", path);
+      return NULL;
+    }
+    status = bbpe_init_ex(json, BBPE_LOAD_PARALLEL, &tok);
+    free(json);
+  }
+  else
+    status = bbpe_load(path, &tok);
+  if (status != BBPE_OK)
+  {
+    fprintf(stderr, "Failed to load tokenizer %s: %d\n", path, status);
+    return NULL;
+  }
+  // 预处理整个数据集时，整词直查的一次性计算远小于其节省的合并时间
+  status = bbpe_set_whole_token_lookup(tok, 1);
+  if (status != BBPE_OK)
+  {
+    fprintf(stderr, "Failed to enable whole-token lookup: %d\n", status);
+    bbpe_destroy(tok);
+    return NULL;
+  }
+  return tok;
+}
+
+static void usage(const char *prog)
+{
+  fprintf(stderr,
+          "Usage: %s tokenizer.json|tokenizer.bin -o prefix [-f text|jsonl] [-k key] [-t threads] [-w 16|32]\n"
+          "       [-s shard_tokens] [-e eos_id] [-b batch_docs] [-q depth] [input ...]\n",
+          prog);
+}
+
+int main(int argc, char **argv)
+{
+  Pipeline p;
+  memset(&p, 0, sizeof(p));
+  p.key = "text";
+  p.batch_docs = 4096;
+  p.token_bytes = 4;
+  p.eos_id = -1;
+  const char *tokenizer_path = NULL;
+  int threads = 0;
+  int depth = 4;
+  const char **inputs = (const char **)calloc((size_t)argc + 1, sizeof(char *));
+  for (int i = 1; i < argc; i++)
+  {
+    const char *arg = argv[i];
+    int has_value = i + 1 < argc;
+    if (strcmp(arg, "-o") == 0 && has_value)
+      p.prefix = argv[++i];
+    else if (strcmp(arg, "-f") == 0 && has_value)
+      p.jsonl = strcmp(argv[++i], "jsonl") == 0;
+    else if (strcmp(arg, "-k") == 0 && has_value)
+      p.key = argv[++i];
+    else if (strcmp(arg, "-t") == 0 && has_value)
+      threads = atoi(argv[++i]);
+    else if (strcmp(arg, "-w") == 0 && has_value)
+      p.token_bytes = atoi(argv[++i]) == 16 ? 2 : 4;
+    else if (strcmp(arg, "-s") == 0 && has_value)
+      p.shard_tokens = strtoull(argv[++i], NULL, 10);
+    else if (strcmp(arg, "-e") == 0 && has_value)
+      p.eos_id = atoll(argv[++i]);
+    else if (strcmp(arg, "-b") == 0 && has_value)
+      p.batch_docs = (size_t)atoi(argv[++i]);
+    else if (strcmp(arg, "-q") == 0 && has_value)
+      depth = atoi(argv[++i]);
+    else if (!tokenizer_path)
+      tokenizer_path = arg;
+    else
+      inputs[p.input_count++] = arg;
+  }
+  if (!tokenizer_path || !p.prefix || p.batch_docs == 0 || depth < 2 || p.eos_id > INT32_MAX)
+  {
+    usage(argv[0]);
+    free((void *)inputs);
+    return 1;
+  }
+  if (p.input_count == 0)
+    inputs[p.input_count++] = "-";
+  p.inputs = inputs;
+#ifdef _WIN32
+  _setmode(_fileno(stdin), _O_BINARY);
+#endif
+
+  BBPETokenizer *tok = load_tokenizer(tokenizer_path);
+  if (!tok)
+  {
+    free((void *)inputs);
+    return 1;
+  }
+
+  char index_path[1024];
+  snprintf(index_path, sizeof(index_path), "%s.idx", p.prefix);
+  Writer w;
+  memset(&w, 0, sizeof(w));
+  w.p = &p;
+  w.index = fopen(index_path, "wb");
+  unsigned char header[16] = {'B', 'B', 'P', 'E', 'I', 'D', 'X', '1'};
+  put_le32(header + 8, (uint32_t)p.token_bytes);
+  if (!w.index || fwrite(header, 1, sizeof(header), w.index) != sizeof(header) || !writer_open_shard(&w))
+  {
+    fprintf(stderr, "Failed to create output files for %s\n", p.prefix);
+    if (w.index)
+      fclose(w.index);
+    bbpe_destroy(tok);
+    free((void *)inputs);
+    return 1;
+  }
+
+  lock_init(&p.fail_lock);
+  queue_init(&p.free_batches);
+  queue_init(&p.to_encode);
+  queue_init(&p.to_write);
+  for (int i = 0; i < depth; i++)
+  {
+    Batch *batch = (Batch *)calloc(1, sizeof(Batch));
+    if (!batch)
+    {
+      fprintf(stderr, "Memory allocation failed\n");
+      return 1;
+    }
+    queue_push(&p.free_batches, batch);
+  }
+
+  double t0 = now_seconds();
+  thread_t reader_thread, writer_thread;
+  ThreadStart reader_start = {reader_main, &p};
+  ThreadStart writer_start = {writer_main, &w};
+  if (!thread_start(&reader_thread, &reader_start) || !thread_start(&writer_thread, &writer_start))
+  {
+    fprintf(stderr, "Failed to start threads\n");
+    return 1;
+  }
+
+  // 编码级在调用线程上运行，每批交给 bbpe_encode_batch 的线程池
+  Batch *b;
+  while ((b = queue_pop(&p.to_encode)) != NULL)
+  {
+    for (size_t i = 0; i < b->count; i++)
+      b->texts[i] = b->data + b->starts[i];
+    int failed = pipeline_failed(&p);
+    BBPEStatus status = failed ? BBPE_OK : bbpe_encode_batch(tok, b->texts, b->lens, b->count, b->outputs, threads);
+    if (failed || status != BBPE_OK)
+    {
+      if (!failed)
+        fprintf(stderr, "Encoding failed: %d\n", status);
+      pipeline_fail(&p);
+      b->count = 0; // 失败时 bbpe_encode_batch 已释放全部输出
+      b->size = 0;
+      queue_push(&p.free_batches, b);
+      continue;
+    }
+    queue_push(&p.to_write, b);
+  }
+  queue_close(&p.to_write);
+  thread_join(reader_thread);
+  thread_join(writer_thread);
+  double seconds = now_seconds() - t0;
+
+  int ok = !pipeline_failed(&p);
+  if (fclose(w.shard) != 0 || fclose(w.index) != 0)
+  {
+    fprintf(stderr, "Failed to write output\n");
+    ok = 0;
+  }
+  if (ok)
+    fprintf(stderr, "%llu docs (%llu skipped), %llu tokens, %u shard(s), %.1f MB in %.2f s (%.1f MB/s)\n",
+            p.docs_written, p.docs_skipped, p.tokens_written, p.shard_count, p.bytes_read / 1e6, seconds,
+            seconds > 0 ? p.bytes_read / 1e6 / seconds : 0.0);
+
+  queue_destroy(&p.free_batches);
+  queue_destroy(&p.to_encode);
+  queue_destroy(&p.to_write);
+  lock_destroy(&p.fail_lock);
+  free(w.buf);
+  bbpe_destroy(tok);
+  free((void *)inputs);
+  return ok ? 0 : 1;
+}
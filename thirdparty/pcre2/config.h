@@ -8,7 +8,8 @@
 /* #undef SUPPORT_PCRE2_32 */ /* 如需 32 位，改为 #define SUPPORT_PCRE2_32 1 */
 #define SUPPORT_UNICODE 1
 
-/* 禁用 JIT */
+/* JIT 默认不在此处开启：构建脚本通过 -DSUPPORT_JIT 启用 (需要 thirdparty/deps/sljit)，
+   不支持可执行内存的平台 (如 iOS) 去掉该宏即可，运行时也会自动回退到解释执行 */
 /* #undef SUPPORT_JIT */
 
 /* 不启用 Valgrind、差分 fuzzing 等 */
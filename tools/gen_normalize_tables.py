@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""
+@file gen_normalize_tables.py
+@brief 生成 bbpe_normalize_tables.h：规范化器 (NFC/NFD/NFKC/NFKD/Lowercase) 使用的 Unicode 表
+
+PCRE2 不含分解映射，这里直接取自 Python 内置的 unicodedata (其 Unicode 版本写入文件头)，
+小写映射与 str.lower() 对单个字符的结果一致 (不含上下文相关的希腊语词尾 sigma 规则)。
+升级 Python 后可重新生成：
+  python3 tools/gen_normalize_tables.py > bbpe_normalize_tables.h
+"""
+
+import sys
+import unicodedata as ud
+
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+# 谚文音节按算法分解与组合，不进表
+HANGUL_S_BASE, HANGUL_S_COUNT = 0xAC00, 11172
+HANGUL_V_BASE, HANGUL_V_COUNT = 0x1161, 21
+HANGUL_T_BASE, HANGUL_T_COUNT = 0x11A7, 28
+
+FLAG_NFC_NO = 1      # 单独规范化为 NFC 时改变 (NFC_Quick_Check=No)
+FLAG_NFKC_NO = 2     # 单独规范化为 NFKC 时改变 (NFKC_Quick_Check=No)
+FLAG_COMPOSE_TAIL = 4  # 可作为组合对的第二个码点，与前一字符组合 (Quick_Check=Maybe)
+
+
+def in_hangul_syllables(cp):
+    return HANGUL_S_BASE <= cp < HANGUL_S_BASE + HANGUL_S_COUNT
+
+
+def main():
+    max_cp = 0x110000
+    chars = [None if 0xD800 <= cp <= 0xDFFF else chr(cp) for cp in range(max_cp)]
+
+    # 主组合对：单层规范分解恰为两个码点、首码点为起始字符、且不在组合排除表中
+    pairs = {}
+    for cp, c in enumerate(chars):
+        if c is None:
+            continue
+        d = ud.decomposition(c)
+        if not d or d.startswith('<'):
+            continue
+        parts = [int(x, 16) for x in d.split()]
+        if len(parts) == 2 and ud.combining(chr(parts[0])) == 0 and ud.normalize('NFC', c) == c:
+            pairs[(parts[0], parts[1])] = cp
+    tails = {b for _, b in pairs}
+    tails.update(range(HANGUL_V_BASE, HANGUL_V_BASE + HANGUL_V_COUNT))
+    tails.update(range(HANGUL_T_BASE + 1, HANGUL_T_BASE + HANGUL_T_COUNT))
+
+    # 映射池：pool[i] 为长度，其后紧跟码点；下标 0 表示没有映射
+    pool = [0]
+    pool_index = {}
+
+    def intern(s):
+        key = tuple(ord(ch) for ch in s)
+        if key not in pool_index:
+            pool_index[key] = len(pool)
+            pool.append(len(key))
+            pool.extend(key)
+        return pool_index[key]
+
+    props = [(0, 0, 0, 0, 0)]
+    prop_index = {props[0]: 0}
+    keys = [0] * max_cp
+    for cp, c in enumerate(chars):
+        if c is None or in_hangul_syllables(cp):
+            continue
+        nfd, nfkd, lower = ud.normalize('NFD', c), ud.normalize('NFKD', c), c.lower()
+        flags = 0
+        if ud.normalize('NFC', c) != c:
+            flags |= FLAG_NFC_NO
+        if ud.normalize('NFKC', c) != c:
+            flags |= FLAG_NFKC_NO
+        if cp in tails:
+            flags |= FLAG_COMPOSE_TAIL
+        key = (ud.combining(c), flags,
+               intern(nfd) if nfd != c else 0,
+               intern(nfkd) if nfkd != c else 0,
+               intern(lower) if lower != c else 0)
+        if key not in prop_index:
+            prop_index[key] = len(props)
+            props.append(key)
+        keys[cp] = prop_index[key]
+
+    if len(pool) > 0xFFFF or len(props) > 0xFFFF:
+        sys.exit('tables exceed 16-bit indices')
+    limit = (max(cp for cp in range(max_cp) if keys[cp]) >> BLOCK_SHIFT) + 1
+
+    blocks = []
+    block_index = {}
+    stage1 = []
+    for b in range(limit):
+        block = tuple(keys[b * BLOCK_SIZE:(b + 1) * BLOCK_SIZE])
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_index[block])
+    if len(blocks) > 256:
+        sys.exit('too many blocks: %d' % len(blocks))
+
+    out = sys.stdout
+    out.write('/* 本文件由 tools/gen_normalize_tables.py 生成 (Unicode %s)，请勿手工修改 */\n' % ud.unidata_version)
+    out.write('#ifndef BBPE_NORMALIZE_TABLES_H\n#define BBPE_NORMALIZE_TABLES_H\n\n#include <stdint.h>\n\n')
+    out.write('#define BBPE_NORM_NFC_NO %d      /* 单独规范化为 NFC 时改变 */\n' % FLAG_NFC_NO)
+    out.write('#define BBPE_NORM_NFKC_NO %d     /* 单独规范化为 NFKC 时改变 */\n' % FLAG_NFKC_NO)
+    out.write('#define BBPE_NORM_COMPOSE_TAIL %d /* 可与前一字符组合 */\n\n' % FLAG_COMPOSE_TAIL)
+    out.write('#define BBPE_NORM_BLOCK_SHIFT %d\n#define BBPE_NORM_LIMIT 0x%X /* 不小于该值的码点没有任何属性 */\n\n'
+              % (BLOCK_SHIFT, limit << BLOCK_SHIFT))
+
+    out.write('/* 码点属性：decomp/compat/lower 为 bbpe_norm_pool 下标 (完整展开的 NFD、NFKD 与小写映射)，0 表示不变 */\n')
+    out.write('typedef struct\n{\n    uint8_t ccc;\n    uint8_t flags;\n    uint16_t decomp;\n'
+              '    uint16_t compat;\n    uint16_t lower;\n} BBPENormProps;\n\n')
+
+    out.write('static const BBPENormProps bbpe_norm_props[%d] = {' % len(props))
+    for i, p in enumerate(props):
+        out.write('%s{%d,%d,%d,%d,%d},' % ('' if i % 8 else '\n    ', *p))
+    out.write('\n};\n\n')
+
+    out.write('/* 码点 >> %d → 块号 */\nstatic const uint8_t bbpe_norm_stage1[%d] = {' % (BLOCK_SHIFT, limit))
+    for i, b in enumerate(stage1):
+        out.write('%s%d,' % ('' if i % 32 else '\n    ', b))
+    out.write('\n};\n\n')
+
+    out.write('/* 每块 %d 个码点 → bbpe_norm_props 下标 */\nstatic const uint16_t bbpe_norm_stage2[%d][%d] = {\n'
+              % (BLOCK_SIZE, len(blocks), BLOCK_SIZE))
+    for block in blocks:
+        out.write('    {')
+        for i, k in enumerate(block):
+            out.write('%s%d%s' % ('' if i % 32 else '\n        ', k, ',' if i + 1 < BLOCK_SIZE else ''))
+        out.write('},\n')
+    out.write('};\n\n')
+
+    out.write('/* 映射池：长度后紧跟码点 */\nstatic const uint32_t bbpe_norm_pool[%d] = {' % len(pool))
+    for i, v in enumerate(pool):
+        out.write('%s0x%X,' % ('' if i % 16 else '\n    ', v))
+    out.write('\n};\n\n')
+
+    out.write('/* 主组合对 (首码点 << 21 | 次码点) → 组合结果，按键升序排列 (不含谚文) */\n')
+    out.write('static const struct\n{\n    uint64_t key;\n    uint32_t cp;\n} bbpe_norm_compose[%d] = {' % len(pairs))
+    for i, ((a, b), cp) in enumerate(sorted(pairs.items())):
+        out.write('%s{0x%XULL,0x%X},' % ('' if i % 4 else '\n    ', (a << 21) | b, cp))
+    out.write('\n};\n\n#endif /* BBPE_NORMALIZE_TABLES_H */\n')
+
+    sys.stderr.write('%d props, %d blocks, %d pool words, %d pairs\n' % (len(props), len(blocks), len(pool), len(pairs)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""
+@file gen_reference.py
+@brief 用 HuggingFace tokenizers 生成 difftest 使用的参考 ID (JSONL，每行 {"text": 文档, "ids": [...]})
+
+默认每个语料文件按行切分为文档 (空行跳过)，-d 时每个文件整体作为一个文档。
+编码不添加 post_processor 的特殊 token (add_special_tokens=False)，与 bbpe_encode_n 一致；
+含非法 UTF-8 或 NUL 的文档无法经 JSON 传给 difftest，跳过并在 stderr 计数。
+  pip install tokenizers
+  python3 tools/gen_reference.py qwen3-tokenizer.json corpus.txt [more.txt ...] > reference.jsonl
+  ./difftest qwen3-tokenizer.json reference.jsonl -o results.csv
+"""
+
+import json
+import sys
+
+from tokenizers import Tokenizer
+
+BATCH_DOCS = 1024
+
+
+def read_docs(paths, whole_file):
+    skipped = 0
+    for path in paths:
+        with open(path, 'rb') as f:
+            data = f.read()
+        for raw in [data] if whole_file else data.split(b'\n'):
+            if not raw or (not whole_file and not raw.strip()):
+                continue
+            try:
+                text = raw.decode('utf-8')
+            except UnicodeDecodeError:
+                skipped += 1
+                continue
+            if '\0' in text:
+                skipped += 1
+                continue
+            yield text
+    if skipped:
+        sys.stderr.write('skipped %d docs (invalid UTF-8 or NUL)\n' % skipped)
+
+
+def main():
+    args = sys.argv[1:]
+    whole_file = '-d' in args
+    args = [a for a in args if a != '-d']
+    if len(args) < 2:
+        sys.exit('Usage: gen_reference.py tokenizer.json corpus.txt [more ...] [-d] > reference.jsonl')
+    tokenizer = Tokenizer.from_file(args[0])
+
+    # 不依赖控制台编码 (Windows 下默认不是 UTF-8)
+    out = open(sys.stdout.fileno(), 'w', encoding='utf-8', newline='\n', closefd=False)
+    docs = tokens = 0
+    batch = []
+
+    def flush():
+        nonlocal docs, tokens
+        for text, enc in zip(batch, tokenizer.encode_batch(batch, add_special_tokens=False)):
+            out.write(json.dumps({'text': text, 'ids': enc.ids}, ensure_ascii=False))
+            out.write('\n')
+            docs += 1
+            tokens += len(enc.ids)
+        batch.clear()
+
+    for text in read_docs(args[1:], whole_file):
+        batch.append(text)
+        if len(batch) == BATCH_DOCS:
+            flush()
+    flush()
+    out.flush()
+    sys.stderr.write('%d docs, %d tokens\n' % (docs, tokens))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,171 @@
+/**
+ * @file gen_static_tokenizer.c
+ * @brief 把分词器转换为可直接编译进程序的 C 源文件与头文件 (配合 bbpe_from_static 使用)
+ *
+ * 生成的数组就是 bbpe_save 写出的 v3 镜像：词汇表字符串池、开放寻址槽与最小完美哈希、已排序的合并规则行、
+ * 解码表、特殊 token、规范化器与预分词器配置 (含预编译的正则字节码) 全部位于只读数据段，
+ * 启动时不解析 JSON、不读文件，同一程序的多个进程共享这些页面。
+ *   gcc -O2 -DHAVE_CONFIG_H -DPCRE2_CODE_UNIT_WIDTH=8 -DPCRE2_STATIC -DSUPPORT_JIT -Ithirdparty/cJSON \
+ *       -Ithirdparty/uthash -Ithirdparty/pcre2 -I. tools/gen_static_tokenizer.c bbpe_tokenizer.c \
+ *       thirdparty/cJSON/cJSON.c thirdparty/pcre2/pcre2_*.c -o gen_static_tokenizer
+ *   ./gen_static_tokenizer qwen3-tokenizer.json qwen3 qwen3_tokenizer
+ * 得到 qwen3_tokenizer.h 与 qwen3_tokenizer.c，程序中调用 qwen3_load(0, &tok) 即可。
+ * 镜像中的正则字节码与 PCRE2 版本相关：升级 PCRE2 后需重新生成 (否则加载时回退为从模式源码编译)。
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "bbpe_tokenizer.h"
+
+#define BYTES_PER_LINE 32
+
+static char *read_file(const char *path, size_t *out_len)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *buf = n >= 0 ? (char *)malloc((size_t)n + 1) : NULL;
+    if (buf && fread(buf, 1, (size_t)n, f) != (size_t)n)
+    {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    if (!buf)
+        return NULL;
+    buf[n] = '\0';
+    *out_len = (size_t)n;
+    return buf;
+}
+
+/* 名称须是合法的 C 标识符 (用作生成的符号前缀) */
+static int valid_identifier(const char *name)
+{
+    if (!*name || (*name >= '0' && *name <= '9'))
+        return 0;
+    for (const char *p = name; *p; p++)
+        if (!((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') || (*p >= '0' && *p <= '9') || *p == '_'))
+            return 0;
+    return 1;
+}
+
+static BBPETokenizer *open_tokenizer(const char *path)
+{
+    BBPETokenizer *tok = NULL;
+    BBPEStatus status;
+    size_t n = strlen(path);
+    if (n >= 5 && strcmp(path + n - 5, ".json") == 0)
+    {
+        size_t len;
+        char *json = read_file(path, &len);
+        if (!json)
+        {
+            fprintf(stderr, "cannot read %s\n", path);
+            return NULL;
+        }
+        status = bbpe_init_ex(json, BBPE_LOAD_PARALLEL, &tok);
+        free(json);
+    }
+    else
+        status = bbpe_load(path, &tok);
+    if (status != BBPE_OK)
+    {
+        fprintf(stderr, "cannot load %s (status %d)\n", path, (int)status);
+        return NULL;
+    }
+    return tok;
+}
+
+static int write_header(const char *path, const char *name, const char *guard, size_t size)
+{
+    FILE *f = fopen(path, "w");
+    if (!f)
+        return 0;
+    fprintf(f, "/* 本文件由 tools/gen_static_tokenizer.c 生成，请勿手工修改 */\n");
+    fprintf(f, "#ifndef %s\n#define %s\n\n#include <stddef.h>\n#include <stdint.h>\n\n", guard, guard);
+    fprintf(f, "#include \"bbpe_tokenizer.h\"\n\n");
+    fprintf(f, "#ifdef __cplusplus\nextern \"C\"\n{\n#endif\n\n");
+    fprintf(f, "    /* bbpe_save 格式的镜像 (64 字节对齐，只读) */\n");
+    fprintf(f, "    extern const uint8_t %s_image[%zu];\n", name, size);
+    fprintf(f, "    extern const size_t %s_image_size;\n\n", name);
+    fprintf(f, "    /**\n     * @brief 从编译进程序的镜像创建分词器 (同 bbpe_from_static)\n");
+    fprintf(f, "     * @param flags 0，或 BBPE_LOAD_LAZY_MERGES / BBPE_LOAD_DECODE_ONLY\n     */\n");
+    fprintf(f, "    static inline BBPEStatus %s_load(uint32_t flags, BBPETokenizer **out_tokenizer)\n    {\n", name);
+    fprintf(f, "        return bbpe_from_static(%s_image, %s_image_size, flags, out_tokenizer);\n    }\n\n", name, name);
+    fprintf(f, "#ifdef __cplusplus\n}\n#endif\n\n#endif /* %s */\n", guard);
+    return fclose(f) == 0;
+}
+
+static int write_source(const char *path, const char *header, const char *name, const uint8_t *image, size_t size)
+{
+    FILE *f = fopen(path, "w");
+    if (!f)
+        return 0;
+    fprintf(f, "/* 本文件由 tools/gen_static_tokenizer.c 生成，请勿手工修改 */\n");
+    fprintf(f, "#include \"%s\"\n\n", header);
+    fprintf(f, "#if defined(_MSC_VER)\n__declspec(align(64))\n#else\n__attribute__((aligned(64)))\n#endif\n");
+    fprintf(f, "const uint8_t %s_image[%zu] = {", name, size);
+    for (size_t i = 0; i < size; i++)
+        fprintf(f, "%s%u,", i % BYTES_PER_LINE ? "" : "\n", (unsigned)image[i]);
+    fprintf(f, "\n};\n\nconst size_t %s_image_size = %zu;\n", name, size);
+    return fclose(f) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 4 || !valid_identifier(argv[2]))
+    {
+        fprintf(stderr, "Usage: %s tokenizer.json|tokenizer.bin name output_prefix\n"
+                        "  writes output_prefix.h and output_prefix.c; name must be a C identifier\n", argv[0]);
+        return 1;
+    }
+    const char *name = argv[2], *prefix = argv[3];
+
+    BBPETokenizer *tok = open_tokenizer(argv[1]);
+    if (!tok)
+        return 1;
+    void *image = NULL;
+    size_t size = 0;
+    BBPEStatus status = bbpe_save_to_memory(tok, &image, &size);
+    bbpe_destroy(tok);
+    if (status != BBPE_OK)
+    {
+        fprintf(stderr, "cannot serialize tokenizer (status %d)\n", (int)status);
+        return 1;
+    }
+
+    // 头文件保护宏：名称转大写
+    size_t plen = strlen(prefix), nlen = strlen(name);
+    char *header_path = (char *)malloc(plen + 3), *source_path = (char *)malloc(plen + 3);
+    char *guard = (char *)malloc(nlen + 16);
+    sprintf(header_path, "%s.h", prefix);
+    sprintf(source_path, "%s.c", prefix);
+    for (size_t i = 0; i <= nlen; i++)
+        guard[i] = name[i] >= 'a' && name[i] <= 'z' ? (char)(name[i] - 'a' + 'A') : name[i];
+    strcat(guard, "_TOKENIZER_H");
+
+    // 源文件按文件名 (不含目录) 包含头文件，两者总是生成在同一目录
+    const char *header_name = strrchr(header_path, '/');
+    const char *backslash = strrchr(header_path, '\\');
+    if (backslash && (!header_name || backslash > header_name))
+        header_name = backslash;
+    header_name = header_name ? header_name + 1 : header_path;
+
+    int ok = write_header(header_path, name, guard, size) &&
+             write_source(source_path, header_name, name, (const uint8_t *)image, size);
+    if (ok)
+        fprintf(stderr, "%s, %s: %zu bytes\n", header_path, source_path, size);
+    else
+        fprintf(stderr, "cannot write %s / %s\n", header_path, source_path);
+    free(image);
+    free(header_path);
+    free(source_path);
+    free(guard);
+    return ok ? 0 : 1;
+}
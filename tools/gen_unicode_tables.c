@@ -0,0 +1,198 @@
+/**
+ * @file gen_unicode_tables.c
+ * @brief 生成 bbpe_unicode_tables.h：快速预分词器使用的 Unicode 字符类别表
+ *
+ * 类别直接由 PCRE2 判定 (与 Split 正则在 PCRE2_UTF | PCRE2_UCP 下的语义逐码点一致)，
+ * 升级 PCRE2 后需重新生成：
+ *   gcc -DHAVE_CONFIG_H -DPCRE2_CODE_UNIT_WIDTH=8 -DPCRE2_STATIC -Ithirdparty/pcre2 \
+ *       tools/gen_unicode_tables.c thirdparty/pcre2/pcre2_*.c -o gen_unicode_tables
+ *   ./gen_unicode_tables > bbpe_unicode_tables.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "pcre2.h"
+
+#define MAX_CP 0x110000
+#define BLOCK_SHIFT 8
+#define BLOCK_SIZE (1 << BLOCK_SHIFT)
+#define BLOCK_BYTES (BLOCK_SIZE / 4) /* 每个码点 2 bit */
+
+enum
+{
+    CLS_OTHER = 0,
+    CLS_LETTER = 1,
+    CLS_NUMBER = 2,
+    CLS_SPACE = 3
+};
+
+static int utf8_encode(uint32_t cp, unsigned char *out)
+{
+    if (cp < 0x80)
+    {
+        out[0] = (unsigned char)cp;
+        return 1;
+    }
+    if (cp < 0x800)
+    {
+        out[0] = 0xC0 | (cp >> 6);
+        out[1] = 0x80 | (cp & 0x3F);
+        return 2;
+    }
+    if (cp < 0x10000)
+    {
+        out[0] = 0xE0 | (cp >> 12);
+        out[1] = 0x80 | ((cp >> 6) & 0x3F);
+        out[2] = 0x80 | (cp & 0x3F);
+        return 3;
+    }
+    out[0] = 0xF0 | (cp >> 18);
+    out[1] = 0x80 | ((cp >> 12) & 0x3F);
+    out[2] = 0x80 | ((cp >> 6) & 0x3F);
+    out[3] = 0x80 | (cp & 0x3F);
+    return 4;
+}
+
+static pcre2_code *compile(const char *pattern)
+{
+    int err;
+    PCRE2_SIZE off;
+    pcre2_code *code = pcre2_compile((PCRE2_SPTR)pattern, PCRE2_ZERO_TERMINATED,
+                                     PCRE2_UTF | PCRE2_UCP | PCRE2_ANCHORED, &err, &off, NULL);
+    if (!code)
+    {
+        fprintf(stderr, "compile failed: %s\n", pattern);
+        exit(1);
+    }
+    return code;
+}
+
+/* 判断单个码点是否被模式完整匹配 */
+static int matches(pcre2_code *code, pcre2_match_data *md, uint32_t cp)
+{
+    unsigned char buf[4];
+    int n = utf8_encode(cp, buf);
+    int rc = pcre2_match(code, buf, (PCRE2_SIZE)n, 0, 0, md, NULL);
+    return rc > 0 && pcre2_get_ovector_pointer(md)[1] == (PCRE2_SIZE)n;
+}
+
+int main(void)
+{
+    pcre2_code *re_l = compile("\\p{L}");
+    pcre2_code *re_n = compile("\\p{N}");
+    pcre2_code *re_s = compile("\\s");
+    pcre2_match_data *md = pcre2_match_data_create(1, NULL);
+
+    uint8_t *cls = (uint8_t *)calloc(MAX_CP, 1);
+    for (uint32_t cp = 0; cp < MAX_CP; cp++)
+    {
+        if (cp >= 0xD800 && cp <= 0xDFFF)
+            continue; /* 代理项不是合法 UTF-8，校验阶段已拒绝 */
+        int l = matches(re_l, md, cp), n = matches(re_n, md, cp), s = matches(re_s, md, cp);
+        if (l + n + s > 1)
+        {
+            fprintf(stderr, "overlapping classes at U+%04X\n", cp);
+            return 1;
+        }
+        cls[cp] = l ? CLS_LETTER : n ? CLS_NUMBER : s ? CLS_SPACE : CLS_OTHER;
+    }
+
+    /* 两级表：码点高位 → 块号，块内每码点 2 bit，相同的块只存一份 */
+    static uint8_t blocks[MAX_CP / BLOCK_SIZE][BLOCK_BYTES];
+    static uint16_t stage1[MAX_CP / BLOCK_SIZE];
+    int nblocks = 0;
+    for (uint32_t b = 0; b < MAX_CP / BLOCK_SIZE; b++)
+    {
+        uint8_t packed[BLOCK_BYTES] = {0};
+        for (int i = 0; i < BLOCK_SIZE; i++)
+            packed[i >> 2] |= cls[(b << BLOCK_SHIFT) + i] << ((i & 3) * 2);
+        int found = -1;
+        for (int k = 0; k < nblocks; k++)
+            if (memcmp(blocks[k], packed, BLOCK_BYTES) == 0)
+            {
+                found = k;
+                break;
+            }
+        if (found < 0)
+        {
+            memcpy(blocks[nblocks], packed, BLOCK_BYTES);
+            found = nblocks++;
+        }
+        stage1[b] = (uint16_t)found;
+    }
+
+    /* (?i:...) 中缩写字母的非 ASCII 大小写等价字符 */
+    static const char letters[] = "stremvld";
+    pcre2_code *re_fold[sizeof(letters) - 1];
+    for (size_t i = 0; i < sizeof(letters) - 1; i++)
+    {
+        char pat[8];
+        snprintf(pat, sizeof(pat), "(?i:%c)", letters[i]);
+        re_fold[i] = compile(pat);
+    }
+
+    const char *version = "";
+    char version_buf[32];
+    if (pcre2_config(PCRE2_CONFIG_UNICODE_VERSION, version_buf) > 0)
+        version = version_buf;
+
+    printf("/* 本文件由 tools/gen_unicode_tables.c 生成 (PCRE2 %d.%02d, Unicode %s)，请勿手工修改 */\n",
+           PCRE2_MAJOR, PCRE2_MINOR, version);
+    printf("#ifndef BBPE_UNICODE_TABLES_H\n#define BBPE_UNICODE_TABLES_H\n\n");
+    printf("#include <stdint.h>\n\n");
+    printf("#define BBPE_UCLASS_OTHER %d  /* 非 \\p{L}、\\p{N}、\\s */\n", CLS_OTHER);
+    printf("#define BBPE_UCLASS_LETTER %d /* \\p{L} */\n", CLS_LETTER);
+    printf("#define BBPE_UCLASS_NUMBER %d /* \\p{N} */\n", CLS_NUMBER);
+    printf("#define BBPE_UCLASS_SPACE %d  /* \\s (PCRE2_UCP) */\n\n", CLS_SPACE);
+    printf("#define BBPE_UCLASS_BLOCK_SHIFT %d\n\n", BLOCK_SHIFT);
+
+    printf("/* 码点 >> %d → 块号 */\nstatic const uint8_t bbpe_uclass_stage1[%d] = {", BLOCK_SHIFT, MAX_CP / BLOCK_SIZE);
+    if (nblocks > 256)
+    {
+        fprintf(stderr, "too many blocks: %d\n", nblocks);
+        return 1;
+    }
+    for (int b = 0; b < MAX_CP / BLOCK_SIZE; b++)
+        printf("%s%d,", b % 32 ? "" : "\n    ", stage1[b]);
+    printf("\n};\n\n");
+
+    printf("/* 每块 %d 个码点，每码点 2 bit (低位在前) */\nstatic const uint8_t bbpe_uclass_stage2[%d][%d] = {\n",
+           BLOCK_SIZE, nblocks, BLOCK_BYTES);
+    for (int k = 0; k < nblocks; k++)
+    {
+        printf("    {");
+        for (int i = 0; i < BLOCK_BYTES; i++)
+            printf("%s%d%s", i % 32 ? "" : "\n        ", blocks[k][i], i + 1 < BLOCK_BYTES ? "," : "");
+        printf("},\n");
+    }
+    printf("};\n\n");
+
+    printf("/* ASCII 码点 → 类别 (与两级表一致，供 ASCII 快速路径直接查表) */\nstatic const uint8_t bbpe_uclass_ascii[128] = {");
+    for (int cp = 0; cp < 128; cp++)
+        printf("%s%d%s", cp % 32 ? "" : "\n    ", cls[cp], cp + 1 < 128 ? "," : "");
+    printf("\n};\n\n");
+
+    printf("/* (?i:'s|'t|'re|'ve|'m|'ll|'d) 中字母的非 ASCII 大小写等价码点 → 对应小写 ASCII 字母 */\n");
+    printf("static const struct\n{\n    uint32_t cp;\n    char lower;\n} bbpe_caseless_extra[] = {\n");
+    int extra = 0;
+    for (uint32_t cp = 0x80; cp < MAX_CP; cp++)
+    {
+        if (cp >= 0xD800 && cp <= 0xDFFF)
+            continue;
+        for (size_t i = 0; i < sizeof(letters) - 1; i++)
+            if (matches(re_fold[i], md, cp))
+            {
+                printf("    {0x%04X, '%c'},\n", cp, letters[i]);
+                extra++;
+            }
+    }
+    if (!extra)
+        printf("    {0, 0},\n");
+    printf("};\n\n#endif /* BBPE_UNICODE_TABLES_H */\n");
+
+    fprintf(stderr, "%d blocks, %d caseless extras\n", nblocks, extra);
+    return 0;
+}
@@ -27,13 +27,21 @@ if /I "%ARCH%"=="x86_64" (
     goto :build
 )
 
-echo Usage: build.bat [x86^|x64]
+echo Usage: build.bat [x86^|x64] [profile]
 exit /b 1
 
 :build
 echo Building for: %TARGET%
 
-set "CFLAGS=-g %ARCH_FLAGS% -DHAVE_CONFIG_H -DPCRE2_CODE_UNIT_WIDTH=8 -DPCRE2_STATIC -Ithirdparty/cJSON -Ithirdparty/uthash -Ithirdparty/pcre2 -I."
+:: 第二个参数为 profile 时生成供采样剖析的库：保留帧指针，关键编码阶段不内联
+set "PROFILE_FLAGS="
+set "SUFFIX="
+if /I "%~2"=="profile" (
+    set "PROFILE_FLAGS=-O2 -fno-omit-frame-pointer -DBBPE_ENABLE_PROFILE"
+    set "SUFFIX=_profile"
+)
+
+set "CFLAGS=-g %ARCH_FLAGS% %PROFILE_FLAGS% -DHAVE_CONFIG_H -DPCRE2_CODE_UNIT_WIDTH=8 -DPCRE2_STATIC -DSUPPORT_JIT -Ithirdparty/cJSON -Ithirdparty/uthash -Ithirdparty/pcre2 -I."
 
 :: 创建临时目录
 set "TMPDIR=build_tmp_%RANDOM%"
@@ -63,7 +71,7 @@ for %%f in ("%TMPDIR%\cJSON\*.o") do set "OBJ_FILES=!OBJ_FILES! %%f"
 for %%f in ("%TMPDIR%\pcre2\*.o") do set "OBJ_FILES=!OBJ_FILES! %%f"
 
 :: 创建静态库
-ar rcs "libbbpe_%TARGET%.a" %OBJ_FILES%
+ar rcs "libbbpe_%TARGET%%SUFFIX%.a" %OBJ_FILES%
 
 echo === Cleaning up ===
 
@@ -71,4 +79,4 @@ echo === Cleaning up ===
 rmdir /S /Q "%TMPDIR%"
 
 echo === Done ===
-echo Output: libbbpe_%TARGET%.a
\ No newline at end of file
+echo Output: libbbpe_%TARGET%%SUFFIX%.a
\ No newline at end of file